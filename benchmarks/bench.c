@@ -0,0 +1,511 @@
+// Benchmark harness: calibration, sampling, statistics, hardware counters and
+// JSON/CSV output. See bench.h for usage.
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "bench.h"
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Bench output uses printf/fprintf; write errors are not recoverable here.
+// NOLINTBEGIN(cert-err33-c)
+
+// Defaults for the common options
+enum { DEFAULT_SAMPLES = 20, DEFAULT_WARMUP_SAMPLES = 3, DEFAULT_MIN_TIME_MS = 5 };
+
+// Upper bound on calibrated iterations per sample
+static constexpr uint64_t MAX_ITERATIONS = 1ULL << 40;
+
+// Largest growth factor per calibration step
+static constexpr uint64_t MAX_CALIBRATION_GROWTH = 16;
+
+typedef enum {
+  CASE_CALIBRATE,
+  CASE_WARMUP,
+  CASE_SAMPLE,
+} case_phase_t;
+
+/// Harness state shared by all benchmarks of an executable.
+typedef struct {
+  const char *suite;
+  const char *filter;
+  const char *json_path;
+  const char *csv_path;
+  const char *section;
+  bool section_printed; // Header is printed with the section's first benchmark
+  uint32_t samples;
+  uint32_t warmup_samples;
+  uint64_t min_time_ns;
+  int cpu;
+  bool perf_enabled;
+  int perf_fds[BENCH_COUNTER_COUNT];
+  bench_stats_t *results;
+  size_t result_count;
+  size_t result_capacity;
+} bench_state_t;
+
+static bench_state_t bench = {
+    .suite = "bench",
+    .samples = DEFAULT_SAMPLES,
+    .warmup_samples = DEFAULT_WARMUP_SAMPLES,
+    .min_time_ns = (uint64_t)DEFAULT_MIN_TIME_MS * 1000000,
+    .cpu = -1,
+    .perf_fds = {-1, -1, -1, -1},
+};
+
+static const char *const COUNTER_NAMES[BENCH_COUNTER_COUNT] = {
+    "cycles",
+    "instructions",
+    "cache_misses",
+    "branch_misses",
+};
+
+// =============================================================================
+// Hardware Counters
+// =============================================================================
+
+#ifdef __linux__
+
+static const uint64_t COUNTER_CONFIGS[BENCH_COUNTER_COUNT] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+static void perf_close(void) {
+  for (size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+    if (bench.perf_fds[i] >= 0) {
+      close(bench.perf_fds[i]);
+      bench.perf_fds[i] = -1;
+    }
+  }
+  bench.perf_enabled = false;
+}
+
+/// Open all counters as one group led by the cycle counter, so they are
+/// scheduled together and read with a single read().
+static bool perf_open(void) {
+  for (size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+    struct perf_event_attr attr;
+    __builtin___memset_chk(&attr, 0, sizeof(attr), sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = COUNTER_CONFIGS[i];
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const int group = i == 0 ? -1 : bench.perf_fds[0];
+    const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+    if (fd < 0) {
+      perf_close();
+      return false;
+    }
+    bench.perf_fds[i] = (int)fd;
+  }
+  ioctl(bench.perf_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(bench.perf_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  bench.perf_enabled = true;
+  return true;
+}
+
+static void perf_read(uint64_t out[BENCH_COUNTER_COUNT]) {
+  // PERF_FORMAT_GROUP layout: { u64 nr; u64 values[nr]; }
+  uint64_t buf[1 + BENCH_COUNTER_COUNT];
+  if (read(bench.perf_fds[0], buf, sizeof(buf)) != (ssize_t)sizeof(buf)) {
+    __builtin___memset_chk(buf, 0, sizeof(buf), sizeof(buf));
+  }
+  for (size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+    out[i] = buf[1 + i];
+  }
+}
+
+static bool pin_cpu(int cpu) {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+#else
+
+static void perf_close(void) {}
+
+static bool perf_open(void) { return false; }
+
+static void perf_read(uint64_t out[BENCH_COUNTER_COUNT]) {
+  for (size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+    out[i] = 0;
+  }
+}
+
+static bool pin_cpu(int cpu) {
+  (void)cpu;
+  return false;
+}
+
+#endif
+
+// =============================================================================
+// Harness
+// =============================================================================
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [--filter SUBSTR] [--samples N] [--min-time-ms N] [--cpu N] [--perf]\n"
+          "       [--json PATH] [--csv PATH]\n",
+          argv0);
+}
+
+bool bench_begin(int argc, char **argv, const char *suite) {
+  bench.suite = suite;
+  bool perf = false;
+  for (int i = 1; i < argc; i++) {
+    const bool has_value = i + 1 < argc;
+    if (strcmp(argv[i], "--filter") == 0 && has_value) {
+      bench.filter = argv[++i];
+    } else if (strcmp(argv[i], "--samples") == 0 && has_value) {
+      bench.samples = (uint32_t)strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--min-time-ms") == 0 && has_value) {
+      bench.min_time_ns = strtoull(argv[++i], nullptr, 10) * 1000000;
+    } else if (strcmp(argv[i], "--cpu") == 0 && has_value) {
+      bench.cpu = (int)strtol(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--perf") == 0) {
+      perf = true;
+    } else if (strcmp(argv[i], "--json") == 0 && has_value) {
+      bench.json_path = argv[++i];
+    } else if (strcmp(argv[i], "--csv") == 0 && has_value) {
+      bench.csv_path = argv[++i];
+    } else {
+      usage(argv[0]);
+      return false;
+    }
+  }
+  if (bench.samples == 0 || bench.min_time_ns == 0) {
+    usage(argv[0]);
+    return false;
+  }
+
+  if (bench.cpu >= 0 && !pin_cpu(bench.cpu)) {
+    fprintf(stderr, "bench: failed to pin to CPU %d, running unpinned\n", bench.cpu);
+  }
+  if (perf && !perf_open()) {
+    fprintf(stderr, "bench: hardware counters unavailable (check perf_event_paranoid)\n");
+  }
+  return true;
+}
+
+const bench_stats_t *bench_last(void) {
+  return bench.result_count == 0 ? nullptr : &bench.results[bench.result_count - 1];
+}
+
+static bool record_result(const bench_stats_t *stats) {
+  if (bench.result_count == bench.result_capacity) {
+    const size_t capacity = bench.result_capacity == 0 ? 64 : bench.result_capacity * 2;
+    bench_stats_t *results = realloc(bench.results, capacity * sizeof(bench_stats_t));
+    if (results == nullptr) {
+      return false;
+    }
+    bench.results = results;
+    bench.result_capacity = capacity;
+  }
+  bench.results[bench.result_count++] = *stats;
+  return true;
+}
+
+void bench_section(const char *name) {
+  bench.section = name;
+  bench.section_printed = false;
+}
+
+static void print_section_header(void) {
+  if (bench.section_printed || bench.section == nullptr) {
+    return;
+  }
+  bench.section_printed = true;
+  printf("\n=== %s ===\n", bench.section);
+  printf("%-40s %12s %12s %8s %14s", "Benchmark", "Median", "p95", "Stddev", "Throughput");
+  if (bench.perf_enabled) {
+    printf(" %10s %6s %9s %9s", "Cycles", "IPC", "Cache-miss", "Br-miss");
+  }
+  printf("\n");
+  printf("----------------------------------------------------------------------------------"
+         "--------------\n");
+}
+
+// =============================================================================
+// Benchmark Case
+// =============================================================================
+
+bool bench_case_begin(bench_case_t *bc, const char *name) {
+  if (bench.filter != nullptr && strstr(name, bench.filter) == nullptr) {
+    return false;
+  }
+  __builtin___memset_chk(bc, 0, sizeof(*bc), __builtin_object_size(bc, 0));
+  print_section_header();
+  bc->name = name;
+  bc->phase = CASE_CALIBRATE;
+  bc->sample_ns = malloc(bench.samples * sizeof(double));
+  if (bc->sample_ns == nullptr) {
+    fprintf(stderr, "bench: out of memory\n");
+    return false;
+  }
+  return true;
+}
+
+bool bench_case_next(bench_case_t *bc) {
+  switch ((case_phase_t)bc->phase) {
+  case CASE_CALIBRATE:
+    if (bc->iterations == 0) {
+      bc->iterations = 1;
+      return true;
+    }
+    if (bc->elapsed_ns < bench.min_time_ns && bc->iterations < MAX_ITERATIONS) {
+      // Grow towards the target with 20% headroom, at most 16x per step
+      uint64_t growth = MAX_CALIBRATION_GROWTH;
+      if (bc->elapsed_ns > 0) {
+        growth = (bench.min_time_ns + (bench.min_time_ns / 5)) / bc->elapsed_ns + 1;
+        growth = growth > MAX_CALIBRATION_GROWTH ? MAX_CALIBRATION_GROWTH : growth;
+      }
+      bc->iterations *= growth < 2 ? 2 : growth;
+      return true;
+    }
+    bc->phase = CASE_WARMUP;
+    bc->sample = 0;
+    [[fallthrough]];
+  case CASE_WARMUP:
+    if (bc->sample < bench.warmup_samples) {
+      return true;
+    }
+    bc->phase = CASE_SAMPLE;
+    bc->sample = 0;
+    [[fallthrough]];
+  case CASE_SAMPLE:
+    return bc->sample < bench.samples;
+  }
+  return false;
+}
+
+void bench_case_start(bench_case_t *bc) {
+  if (bench.perf_enabled && bc->phase == CASE_SAMPLE) {
+    perf_read(bc->counters_start);
+  }
+  bc->start_ns = bench_now_ns();
+}
+
+void bench_case_stop(bench_case_t *bc) {
+  bc->elapsed_ns = bench_now_ns() - bc->start_ns;
+  switch ((case_phase_t)bc->phase) {
+  case CASE_CALIBRATE:
+    break;
+  case CASE_WARMUP:
+    bc->sample++;
+    break;
+  case CASE_SAMPLE:
+    if (bench.perf_enabled) {
+      uint64_t counters[BENCH_COUNTER_COUNT];
+      perf_read(counters);
+      for (size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+        bc->counters_total[i] += counters[i] - bc->counters_start[i];
+      }
+    }
+    bc->sample_ns[bc->sample++] = (double)bc->elapsed_ns / (double)bc->iterations;
+    break;
+  }
+}
+
+static int compare_double(const void *a, const void *b) {
+  const double x = *(const double *)a;
+  const double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+/// Linearly interpolated quantile of sorted values.
+static double quantile(const double *sorted, size_t count, double q) {
+  const double pos = q * (double)(count - 1);
+  const size_t lower = (size_t)pos;
+  if (lower + 1 >= count) {
+    return sorted[count - 1];
+  }
+  const double frac = pos - (double)lower;
+  return sorted[lower] + (frac * (sorted[lower + 1] - sorted[lower]));
+}
+
+static void compute_stats(const bench_case_t *bc, bench_stats_t *stats) {
+  const size_t count = bench.samples;
+  double *sorted = bc->sample_ns;
+  qsort(sorted, count, sizeof(double), compare_double);
+
+  __builtin___memset_chk(stats, 0, sizeof(*stats), __builtin_object_size(stats, 0));
+  stats->name = bc->name;
+  stats->section = bench.section;
+  stats->iterations = bc->iterations;
+  stats->samples = (uint32_t)count;
+  stats->median_ns = quantile(sorted, count, 0.5);
+  stats->p95_ns = quantile(sorted, count, 0.95);
+  stats->min_ns = sorted[0];
+  stats->max_ns = sorted[count - 1];
+
+  // Tukey fences: samples beyond 1.5 IQR are preemption or frequency noise
+  const double q1 = quantile(sorted, count, 0.25);
+  const double q3 = quantile(sorted, count, 0.75);
+  const double low = q1 - (1.5 * (q3 - q1));
+  const double high = q3 + (1.5 * (q3 - q1));
+  double sum = 0;
+  size_t inliers = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (sorted[i] >= low && sorted[i] <= high) {
+      sum += sorted[i];
+      inliers++;
+    }
+  }
+  stats->outliers = (uint32_t)(count - inliers);
+  stats->mean_ns = sum / (double)inliers;
+  double sq = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (sorted[i] >= low && sorted[i] <= high) {
+      sq += (sorted[i] - stats->mean_ns) * (sorted[i] - stats->mean_ns);
+    }
+  }
+  stats->stddev_ns = inliers > 1 ? sqrt(sq / (double)(inliers - 1)) : 0.0;
+
+  if (bench.perf_enabled) {
+    stats->has_counters = true;
+    const double ops = (double)bc->iterations * (double)count;
+    for (size_t i = 0; i < BENCH_COUNTER_COUNT; i++) {
+      stats->counters[i] = (double)bc->counters_total[i] / ops;
+    }
+  }
+}
+
+static void print_stats(const bench_stats_t *stats) {
+  const double stddev_pct = stats->mean_ns > 0 ? stats->stddev_ns * 100.0 / stats->mean_ns : 0.0;
+  printf("%-40s %9.2f ns %9.2f ns %7.1f%% %10.0f op/s", stats->name, stats->median_ns,
+         stats->p95_ns, stddev_pct, stats->median_ns > 0 ? 1e9 / stats->median_ns : 0.0);
+  if (stats->has_counters) {
+    const double cycles = stats->counters[BENCH_COUNTER_CYCLES];
+    printf(" %10.1f %6.2f %9.3f %9.3f", cycles,
+           cycles > 0 ? stats->counters[BENCH_COUNTER_INSTRUCTIONS] / cycles : 0.0,
+           stats->counters[BENCH_COUNTER_CACHE_MISSES],
+           stats->counters[BENCH_COUNTER_BRANCH_MISSES]);
+  }
+  printf("\n");
+}
+
+void bench_case_end(bench_case_t *bc) {
+  bench_stats_t stats;
+  compute_stats(bc, &stats);
+  print_stats(&stats);
+  if (!record_result(&stats)) {
+    fprintf(stderr, "bench: out of memory recording %s\n", bc->name);
+  }
+  free(bc->sample_ns);
+  bc->sample_ns = nullptr;
+}
+
+// =============================================================================
+// Output
+// =============================================================================
+
+static void write_json_string(FILE *out, const char *str) {
+  fputc('"', out);
+  for (const char *c = str; c != nullptr && *c != '\0'; c++) {
+    if (*c == '"' || *c == '\\') {
+      fputc('\\', out);
+    }
+    fputc(*c, out);
+  }
+  fputc('"', out);
+}
+
+static bool write_json(const char *path) {
+  FILE *out = fopen(path, "w");
+  if (out == nullptr) {
+    fprintf(stderr, "bench: failed to open %s\n", path);
+    return false;
+  }
+  fputs("{\n  \"suite\": ", out);
+  write_json_string(out, bench.suite);
+  fprintf(out, ",\n  \"samples\": %u,\n  \"min_time_ns\": %" PRIu64 ",\n  \"benchmarks\": [\n",
+          bench.samples, bench.min_time_ns);
+  for (size_t i = 0; i < bench.result_count; i++) {
+    const bench_stats_t *s = &bench.results[i];
+    fputs("    {\"name\": ", out);
+    write_json_string(out, s->name);
+    fputs(", \"section\": ", out);
+    write_json_string(out, s->section != nullptr ? s->section : "");
+    fprintf(out,
+            ", \"iterations\": %" PRIu64 ", \"samples\": %u, \"outliers\": %u, \"median_ns\": %.4f"
+            ", \"p95_ns\": %.4f, \"mean_ns\": %.4f, \"stddev_ns\": %.4f, \"min_ns\": %.4f"
+            ", \"max_ns\": %.4f",
+            s->iterations, s->samples, s->outliers, s->median_ns, s->p95_ns, s->mean_ns,
+            s->stddev_ns, s->min_ns, s->max_ns);
+    if (s->has_counters) {
+      for (size_t c = 0; c < BENCH_COUNTER_COUNT; c++) {
+        fprintf(out, ", \"%s\": %.4f", COUNTER_NAMES[c], s->counters[c]);
+      }
+    }
+    fprintf(out, "}%s\n", i + 1 < bench.result_count ? "," : "");
+  }
+  fputs("  ]\n}\n", out);
+  const bool ok = ferror(out) == 0;
+  return fclose(out) == 0 && ok;
+}
+
+static bool write_csv(const char *path) {
+  FILE *out = fopen(path, "w");
+  if (out == nullptr) {
+    fprintf(stderr, "bench: failed to open %s\n", path);
+    return false;
+  }
+  fputs("suite,section,name,iterations,samples,outliers,median_ns,p95_ns,mean_ns,stddev_ns,"
+        "min_ns,max_ns,cycles,instructions,cache_misses,branch_misses\n",
+        out);
+  for (size_t i = 0; i < bench.result_count; i++) {
+    const bench_stats_t *s = &bench.results[i];
+    fprintf(out,
+            "\"%s\",\"%s\",\"%s\",%" PRIu64 ",%u,%u,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f", bench.suite,
+            s->section != nullptr ? s->section : "", s->name, s->iterations, s->samples,
+            s->outliers, s->median_ns, s->p95_ns, s->mean_ns, s->stddev_ns, s->min_ns, s->max_ns);
+    for (size_t c = 0; c < BENCH_COUNTER_COUNT; c++) {
+      if (s->has_counters) {
+        fprintf(out, ",%.4f", s->counters[c]);
+      } else {
+        fputc(',', out);
+      }
+    }
+    fputc('\n', out);
+  }
+  const bool ok = ferror(out) == 0;
+  return fclose(out) == 0 && ok;
+}
+
+int bench_end(void) {
+  int exit_code = 0;
+  if (bench.json_path != nullptr && !write_json(bench.json_path)) {
+    fprintf(stderr, "bench: failed to write %s\n", bench.json_path);
+    exit_code = 1;
+  }
+  if (bench.csv_path != nullptr && !write_csv(bench.csv_path)) {
+    fprintf(stderr, "bench: failed to write %s\n", bench.csv_path);
+    exit_code = 1;
+  }
+  perf_close();
+  free(bench.results);
+  bench.results = nullptr;
+  bench.result_count = 0;
+  bench.result_capacity = 0;
+  return exit_code;
+}
+
+// NOLINTEND(cert-err33-c)
@@ -1,16 +1,33 @@
 #ifndef DIV0_BENCH_H
 #define DIV0_BENCH_H
 
-// Simple C benchmarking macros for div0
-// Uses CLOCK_MONOTONIC for high-resolution timing
-
+// Benchmark harness for div0
+//
+// Each benchmark is calibrated (iterations grown until one sample takes at
+// least --min-time-ms), warmed up, then timed over --samples samples. Results
+// report median, p95, mean and standard deviation per operation, with Tukey
+// outliers (outside 1.5 IQR) excluded from mean and stddev. Hardware counters
+// (cycles, instructions, cache and branch misses) are collected with
+// perf_event_open when --perf is given and the kernel allows it.
+//
+// Usage in a benchmark executable:
+//
+//   int main(int argc, char **argv) {
+//     if (!bench_begin(argc, argv, "uint256")) return 2;
+//     bench_section("Addition");
+//     BENCH_RUN("uint256_add", { r = uint256_add(a, b); BENCH_DO_NOT_OPTIMIZE(r); });
+//     return bench_end();
+//   }
+//
+// Common options: --filter SUBSTR, --samples N, --min-time-ms N, --cpu N,
+// --perf, --json PATH, --csv PATH. Results from two --json runs can be
+// compared with bench_compare.
+
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <time.h>
 
-// Default number of iterations for benchmarks
-#define BENCH_DEFAULT_ITERATIONS 1000000
-
 // Get current time in nanoseconds
 static inline uint64_t bench_now_ns(void) {
   struct timespec ts;
@@ -18,70 +35,113 @@ static inline uint64_t bench_now_ns(void) {
   return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
 }
 
-// Benchmark context
+// Macro to prevent compiler from optimizing away a value
+#define BENCH_DO_NOT_OPTIMIZE(var)                                                                 \
+  do {                                                                                             \
+    __asm__ volatile("" : : "r,m"(var) : "memory");                                                \
+  } while (0)
+
+// =============================================================================
+// Results
+// =============================================================================
+
+/// Hardware counter indices.
+enum {
+  BENCH_COUNTER_CYCLES,
+  BENCH_COUNTER_INSTRUCTIONS,
+  BENCH_COUNTER_CACHE_MISSES,
+  BENCH_COUNTER_BRANCH_MISSES,
+  BENCH_COUNTER_COUNT,
+};
+
+/// Statistics of one benchmark; all times and counters are per operation.
 typedef struct {
   const char *name;
-  uint64_t iterations;
+  const char *section;
+  uint64_t iterations; // Operations per sample
+  uint32_t samples;    // Timed samples
+  uint32_t outliers;   // Samples outside 1.5 IQR
+  double median_ns;
+  double p95_ns;
+  double min_ns;
+  double max_ns;
+  double mean_ns;   // Excluding outliers
+  double stddev_ns; // Excluding outliers
+  bool has_counters;
+  double counters[BENCH_COUNTER_COUNT];
+} bench_stats_t;
+
+// =============================================================================
+// Harness
+// =============================================================================
+
+/// Parse the common options and set up pinning and counters.
+/// Unknown options are an error unless the executable handles them first.
+/// @param argc Argument count
+/// @param argv Arguments
+/// @param suite Suite name recorded in JSON/CSV output
+/// @return false on invalid options (usage has been printed)
+bool bench_begin(int argc, char **argv, const char *suite);
+
+/// Write --json/--csv output and release the harness.
+/// @return Process exit code
+int bench_end(void);
+
+/// Start a named section; printed as a table header.
+/// @param name Section name
+void bench_section(const char *name);
+
+/// Statistics of the most recently completed benchmark (nullptr if none).
+const bench_stats_t *bench_last(void);
+
+// =============================================================================
+// Benchmark Case (driven by BENCH_RUN)
+// =============================================================================
+
+/// State of one benchmark while it is calibrated and sampled.
+typedef struct {
+  const char *name;
+  uint64_t iterations; // Operations to run in the current sample
+  uint32_t phase;      // Calibration, warm-up or sampling
+  uint32_t sample;     // Samples taken in the current phase
   uint64_t start_ns;
-  uint64_t end_ns;
-} bench_ctx_t;
-
-// Initialize a benchmark
-static inline void bench_init(bench_ctx_t *ctx, const char *name, uint64_t iterations) {
-  ctx->name = name;
-  ctx->iterations = iterations;
-  ctx->start_ns = 0;
-  ctx->end_ns = 0;
-}
+  uint64_t elapsed_ns;
+  uint64_t counters_start[BENCH_COUNTER_COUNT];
+  uint64_t counters_total[BENCH_COUNTER_COUNT];
+  double *sample_ns; // Per-operation time of each timed sample
+} bench_case_t;
 
-// Start timing
-static inline void bench_start(bench_ctx_t *ctx) { ctx->start_ns = bench_now_ns(); }
+/// Begin a benchmark. Returns false if it is filtered out.
+bool bench_case_begin(bench_case_t *bc, const char *name);
 
-// Stop timing
-static inline void bench_stop(bench_ctx_t *ctx) { ctx->end_ns = bench_now_ns(); }
+/// Advance to the next sample. Returns false when the benchmark is done.
+bool bench_case_next(bench_case_t *bc);
 
-// Get elapsed time in nanoseconds
-static inline uint64_t bench_elapsed_ns(const bench_ctx_t *ctx) {
-  return ctx->end_ns - ctx->start_ns;
-}
-
-// Get time per operation in nanoseconds
-static inline double bench_ns_per_op(const bench_ctx_t *ctx) {
-  return (double)bench_elapsed_ns(ctx) / (double)ctx->iterations;
-}
+/// Start timing a sample.
+void bench_case_start(bench_case_t *bc);
 
-// Print benchmark results
-static inline void bench_print(const bench_ctx_t *ctx) {
-  double ns_per_op = bench_ns_per_op(ctx);
-  double ops_per_sec = 1e9 / ns_per_op;
+/// Stop timing a sample.
+void bench_case_stop(bench_case_t *bc);
 
-  printf("%-40s %10.2f ns/op   %12.0f ops/sec\n", ctx->name, ns_per_op, ops_per_sec);
-}
+/// Compute statistics, print them and record them for output.
+void bench_case_end(bench_case_t *bc);
 
-// Simple macro for running a benchmark
-#define BENCH_RUN(name, iterations, code)                                                          \
+/// Run the body as a benchmark: iterations are auto-calibrated, then sampled.
+/// The body is variadic so it may contain unparenthesized commas.
+#define BENCH_RUN(name, ...)                                                                       \
   do {                                                                                             \
-    bench_ctx_t _bench_ctx;                                                                        \
-    bench_init(&_bench_ctx, name, iterations);                                                     \
-    bench_start(&_bench_ctx);                                                                      \
-    for (uint64_t _bench_i = 0; _bench_i < (iterations); _bench_i++) {                             \
-      code;                                                                                        \
+    bench_case_t _bench_case;                                                                      \
+    if (bench_case_begin(&_bench_case, name)) {                                                    \
+      while (bench_case_next(&_bench_case)) {                                                      \
+        const uint64_t _bench_n = _bench_case.iterations;                                          \
+        bench_case_start(&_bench_case);                                                            \
+        for (uint64_t _bench_i = 0; _bench_i < _bench_n; _bench_i++) {                             \
+          __VA_ARGS__;                                                                             \
+        }                                                                                          \
+        bench_case_stop(&_bench_case);                                                             \
+      }                                                                                            \
+      bench_case_end(&_bench_case);                                                                \
     }                                                                                              \
-    bench_stop(&_bench_ctx);                                                                       \
-    bench_print(&_bench_ctx);                                                                      \
-  } while (0)
-
-// Macro to prevent compiler from optimizing away a value
-#define BENCH_DO_NOT_OPTIMIZE(var)                                                                 \
-  do {                                                                                             \
-    __asm__ volatile("" : : "r,m"(var) : "memory");                                                \
   } while (0)
 
-// Print benchmark section header
-static inline void bench_section(const char *name) {
-  printf("\n=== %s ===\n", name);
-  printf("%-40s %14s   %14s\n", "Benchmark", "Time", "Throughput");
-  printf("--------------------------------------------------------------------------------\n");
-}
-
 #endif // DIV0_BENCH_H
@@ -0,0 +1,167 @@
+// Compare two benchmark result files written with --json
+//
+// Benchmarks are matched by name. A change is reported as a regression when
+// the median slows down by more than the threshold and by more than the noise
+// of the two runs (twice the larger relative standard deviation).
+//
+// Usage: bench_compare BASELINE.json CURRENT.json [--threshold PCT]
+// Exit code: 0 no regressions, 1 regressions found, 2 usage or input error
+
+#include "div0/json/parse.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static constexpr double DEFAULT_THRESHOLD_PCT = 5.0;
+
+/// Load a result file and return its benchmarks array.
+static yyjson_val_t *load_results(const char *path, json_doc_t *doc) {
+  const json_result_t r = json_parse_file(path, doc);
+  if (json_is_err(r)) {
+    (void)fprintf(stderr, "%s: %s\n", path, json_error_name(r.error));
+    return nullptr;
+  }
+  yyjson_val_t *benchmarks = json_obj_get(json_doc_root(doc), "benchmarks");
+  if (!json_is_arr(benchmarks)) {
+    (void)fprintf(stderr, "%s: missing \"benchmarks\" array\n", path);
+    json_doc_free(doc);
+    return nullptr;
+  }
+  return benchmarks;
+}
+
+/// Find a benchmark by name.
+static yyjson_val_t *find_benchmark(yyjson_val_t *benchmarks, const char *name) {
+  json_arr_iter_t iter = json_arr_iter(benchmarks);
+  yyjson_val_t *entry;
+  while (json_arr_iter_next(&iter, &entry)) {
+    const char *entry_name = json_get_str(json_obj_get(entry, "name"));
+    if (entry_name != nullptr && strcmp(entry_name, name) == 0) {
+      return entry;
+    }
+  }
+  return nullptr;
+}
+
+static double get_num(yyjson_val_t *entry, const char *key) {
+  return json_get_f64(json_obj_get(entry, key));
+}
+
+/// Relative standard deviation of a benchmark, in percent.
+static double relative_stddev_pct(yyjson_val_t *entry) {
+  const double mean = get_num(entry, "mean_ns");
+  return mean > 0.0 ? 100.0 * get_num(entry, "stddev_ns") / mean : 0.0;
+}
+
+static void print_usage(const char *prog) {
+  (void)fprintf(stderr, "Usage: %s BASELINE.json CURRENT.json [--threshold PCT]\n", prog);
+}
+
+int main(int argc, char **argv) {
+  const char *paths[2] = {nullptr, nullptr};
+  int path_count = 0;
+  double threshold = DEFAULT_THRESHOLD_PCT;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+      char *end;
+      threshold = strtod(argv[++i], &end);
+      if (*end != '\0' || threshold < 0.0) {
+        print_usage(argv[0]);
+        return 2;
+      }
+    } else if (argv[i][0] != '-' && path_count < 2) {
+      paths[path_count++] = argv[i];
+    } else {
+      print_usage(argv[0]);
+      return 2;
+    }
+  }
+  if (path_count != 2) {
+    print_usage(argv[0]);
+    return 2;
+  }
+
+  json_doc_t base_doc;
+  json_doc_t curr_doc;
+  yyjson_val_t *base = load_results(paths[0], &base_doc);
+  if (base == nullptr) {
+    return 2;
+  }
+  yyjson_val_t *curr = load_results(paths[1], &curr_doc);
+  if (curr == nullptr) {
+    json_doc_free(&base_doc);
+    return 2;
+  }
+
+  printf("%-40s %12s %12s %9s %8s %9s  %s\n", "Benchmark", "Base (ns)", "Curr (ns)", "Change",
+         "Noise", "Instr", "Verdict");
+  printf("%-40s %12s %12s %9s %8s %9s  %s\n", "---------", "---------", "---------", "------",
+         "-----", "-----", "-------");
+
+  uint32_t regressions = 0;
+  uint32_t improvements = 0;
+  uint32_t missing = 0;
+
+  json_arr_iter_t iter = json_arr_iter(curr);
+  yyjson_val_t *entry;
+  while (json_arr_iter_next(&iter, &entry)) {
+    const char *name = json_get_str(json_obj_get(entry, "name"));
+    if (name == nullptr) {
+      continue;
+    }
+    yyjson_val_t *baseline = find_benchmark(base, name);
+    if (baseline == nullptr) {
+      printf("%-40s %12s %12.2f %9s %8s %9s  new\n", name, "-", get_num(entry, "median_ns"), "-",
+             "-", "-");
+      continue;
+    }
+
+    const double base_ns = get_num(baseline, "median_ns");
+    const double curr_ns = get_num(entry, "median_ns");
+    const double change = base_ns > 0.0 ? 100.0 * (curr_ns - base_ns) / base_ns : 0.0;
+    const double noise = 2.0 * fmax(relative_stddev_pct(baseline), relative_stddev_pct(entry));
+    const double limit = fmax(threshold, noise);
+
+    // Instruction counts are far less noisy than time; show them when both runs have them
+    char instr[16] = "-";
+    const double base_instr = get_num(baseline, "instructions");
+    const double curr_instr = get_num(entry, "instructions");
+    if (base_instr > 0.0 && curr_instr > 0.0) {
+      const double delta = 100.0 * (curr_instr - base_instr) / base_instr;
+      (void)snprintf(instr, sizeof(instr), "%+.1f%%", delta);
+    }
+
+    const char *verdict = "";
+    if (change > limit) {
+      verdict = "REGRESSION";
+      regressions++;
+    } else if (change < -limit) {
+      verdict = "improved";
+      improvements++;
+    }
+    printf("%-40s %12.2f %12.2f %+8.1f%% %7.1f%% %9s  %s\n", name, base_ns, curr_ns, change, noise,
+           instr, verdict);
+  }
+
+  // Benchmarks that disappeared are worth noticing but not a failure
+  iter = json_arr_iter(base);
+  while (json_arr_iter_next(&iter, &entry)) {
+    const char *name = json_get_str(json_obj_get(entry, "name"));
+    if (name != nullptr && find_benchmark(curr, name) == nullptr) {
+      printf("%-40s %12.2f %12s %9s %8s %9s  removed\n", name, get_num(entry, "median_ns"), "-",
+             "-", "-", "-");
+      missing++;
+    }
+  }
+
+  printf("\n%u regression(s), %u improvement(s), %u removed (threshold %.1f%%)\n", regressions,
+         improvements, missing, threshold);
+
+  json_doc_free(&base_doc);
+  json_doc_free(&curr_doc);
+  return regressions > 0 ? 1 : 0;
+}
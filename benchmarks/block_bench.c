@@ -0,0 +1,984 @@
+// Block-level t8n replay benchmark
+// Loads alloc/env/txs fixtures once (from files or a synthetic generator) and
+// replays the full t8n pipeline N times, resetting the arena between runs.
+// Reports per-phase timing, throughput, peak arena memory and hash table load.
+//
+// Usage: block_bench [--synthetic NAME] [--count N] [--alloc PATH --env PATH --txs PATH]
+//                    [--runs N] [--fork NAME] [--chain-id N] [--dump DIR] [--json PATH]
+
+#include "bench.h"
+#include "div0/crypto/secp256k1.h"
+#include "div0/ethereum/transaction/signer.h"
+#include "div0/evm/evm.h"
+#include "div0/evm/opcodes.h"
+#include "div0/executor/block_executor.h"
+#include "div0/json/write.h"
+#include "div0/mem/arena.h"
+#include "div0/state/world_state.h"
+#include "div0/t8n/alloc.h"
+#include "div0/t8n/env.h"
+#include "div0/t8n/result.h"
+#include "div0/t8n/txs.h"
+#include "div0/trie/mpt.h"
+
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Bench output uses printf/fprintf; write errors are not recoverable here.
+// NOLINTBEGIN(cert-err33-c)
+
+// Default number of timed replays
+enum { DEFAULT_RUNS = 10 };
+
+// Distinct senders used by the synthetic generators
+enum { SENDER_COUNT = 256 };
+
+// Pools touched by the swap generator
+enum { POOL_COUNT = 16 };
+
+// Maximum path length for --dump
+enum { PATH_CAPACITY = 4096 };
+
+// Fee parameters of every synthetic transaction (base fee is 7 wei)
+static constexpr uint64_t SYNTH_BASE_FEE = 7;
+static constexpr uint64_t SYNTH_MAX_FEE = 1000;
+static constexpr uint64_t SYNTH_PRIORITY_FEE = 1;
+
+// Gas limits of the synthetic transaction kinds
+static constexpr uint64_t TRANSFER_GAS = 21000;
+static constexpr uint64_t DEPLOY_GAS = 200000;
+static constexpr uint64_t SWAP_GAS = 150000;
+
+// =============================================================================
+// Fixtures
+// =============================================================================
+
+/// t8n inputs as JSON text, kept in memory for the whole benchmark.
+typedef struct {
+  const char *name;
+  char *alloc;
+  size_t alloc_len;
+  char *env;
+  size_t env_len;
+  char *txs;
+  size_t txs_len;
+} fixture_t;
+
+static void fixture_free(fixture_t *fixture) {
+  free(fixture->alloc);
+  free(fixture->env);
+  free(fixture->txs);
+}
+
+static char *read_file(const char *path, size_t *out_len) {
+  FILE *file = fopen(path, "rb");
+  if (file == nullptr) {
+    fprintf(stderr, "block_bench: failed to open %s\n", path);
+    return nullptr;
+  }
+  char *data = nullptr;
+  if (fseek(file, 0, SEEK_END) == 0) {
+    const long size = ftell(file);
+    if (size >= 0 && fseek(file, 0, SEEK_SET) == 0) {
+      data = malloc((size_t)size + 1);
+      if (data != nullptr && fread(data, 1, (size_t)size, file) != (size_t)size) {
+        free(data);
+        data = nullptr;
+      } else if (data != nullptr) {
+        data[size] = '\0';
+        *out_len = (size_t)size;
+      }
+    }
+  }
+  fclose(file);
+  if (data == nullptr) {
+    fprintf(stderr, "block_bench: failed to read %s\n", path);
+  }
+  return data;
+}
+
+static bool write_file(const char *dir, const char *name, const char *data, size_t len) {
+  char path[PATH_CAPACITY];
+  const int written = snprintf(path, sizeof(path), "%s/%s", dir, name);
+  if (written < 0 || (size_t)written >= sizeof(path)) {
+    return false;
+  }
+  FILE *file = fopen(path, "wb");
+  if (file == nullptr) {
+    fprintf(stderr, "block_bench: failed to open %s\n", path);
+    return false;
+  }
+  const bool ok = fwrite(data, 1, len, file) == len;
+  return fclose(file) == 0 && ok;
+}
+
+// =============================================================================
+// Synthetic Block Generation
+// =============================================================================
+
+/// Builder for a synthetic pre-state and signed transaction list.
+typedef struct {
+  div0_arena_t *arena;
+  secp256k1_ctx_t *secp;
+  uint64_t chain_id;
+  account_snapshot_t *accounts;
+  size_t account_count;
+  size_t account_capacity;
+  transaction_t *txs;
+  size_t tx_count;
+  uint8_t keys[SENDER_COUNT][32];
+  uint64_t nonces[SENDER_COUNT];
+  size_t sender_count;
+  uint64_t gas_total; // Sum of transaction gas limits (the block gas limit)
+} block_gen_t;
+
+static uint256_t u256_pow10(unsigned exponent) {
+  uint256_t value = uint256_from_u64(1);
+  for (unsigned i = 0; i < exponent; i++) {
+    value = uint256_mul(value, uint256_from_u64(10));
+  }
+  return value;
+}
+
+static address_t indexed_address(uint8_t prefix, uint32_t index) {
+  address_t addr = address_zero();
+  addr.bytes[0] = prefix;
+  addr.bytes[16] = (uint8_t)(index >> 24);
+  addr.bytes[17] = (uint8_t)(index >> 16);
+  addr.bytes[18] = (uint8_t)(index >> 8);
+  addr.bytes[19] = (uint8_t)index;
+  return addr;
+}
+
+static account_snapshot_t *gen_add_account(block_gen_t *gen, const address_t *addr,
+                                           uint256_t balance) {
+  if (gen->account_count == gen->account_capacity) {
+    return nullptr;
+  }
+  account_snapshot_t *acc = &gen->accounts[gen->account_count++];
+  __builtin___memset_chk(acc, 0, sizeof(*acc), __builtin_object_size(acc, 0));
+  acc->address = *addr;
+  acc->balance = balance;
+  return acc;
+}
+
+static bool gen_init(block_gen_t *gen, div0_arena_t *arena, secp256k1_ctx_t *secp,
+                     uint64_t chain_id, size_t tx_count, size_t extra_accounts) {
+  __builtin___memset_chk(gen, 0, sizeof(*gen), __builtin_object_size(gen, 0));
+  gen->arena = arena;
+  gen->secp = secp;
+  gen->chain_id = chain_id;
+  gen->sender_count = tx_count < SENDER_COUNT ? tx_count : SENDER_COUNT;
+  gen->account_capacity = gen->sender_count + extra_accounts;
+  gen->accounts = div0_arena_alloc_array(arena, gen->account_capacity, sizeof(account_snapshot_t),
+                                         alignof(account_snapshot_t));
+  gen->txs = div0_arena_alloc_array(arena, tx_count == 0 ? 1 : tx_count, sizeof(transaction_t),
+                                    alignof(transaction_t));
+  if (gen->accounts == nullptr || gen->txs == nullptr) {
+    return false;
+  }
+
+  // Funded senders with fixed keys, so generated blocks are reproducible
+  for (size_t i = 0; i < gen->sender_count; i++) {
+    __builtin___memset_chk(gen->keys[i], 0, 32, 32);
+    gen->keys[i][0] = 0x42;
+    gen->keys[i][30] = (uint8_t)((i + 1) >> 8);
+    gen->keys[i][31] = (uint8_t)(i + 1);
+    address_t addr;
+    if (!secp256k1_secret_to_address(secp, gen->keys[i], &addr) ||
+        gen_add_account(gen, &addr, u256_pow10(24)) == nullptr) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Append an EIP-1559 transaction from a generator sender and sign it.
+static bool gen_add_tx(block_gen_t *gen, size_t sender, const address_t *to, uint64_t gas,
+                       const uint8_t *data, size_t data_len) {
+  transaction_t *tx = &gen->txs[gen->tx_count];
+  tx->type = TX_TYPE_EIP1559;
+  transaction_clear_cache(tx);
+  eip1559_tx_t *etx = &tx->eip1559;
+  eip1559_tx_init(etx);
+  etx->chain_id = gen->chain_id;
+  etx->nonce = gen->nonces[sender]++;
+  etx->max_priority_fee_per_gas = uint256_from_u64(SYNTH_PRIORITY_FEE);
+  etx->max_fee_per_gas = uint256_from_u64(SYNTH_MAX_FEE);
+  etx->gas_limit = gas;
+  etx->value = to != nullptr && data_len == 0 ? uint256_from_u64(1) : uint256_zero();
+  if (to != nullptr) {
+    etx->to = div0_arena_alloc(gen->arena, sizeof(address_t));
+    if (etx->to == nullptr) {
+      return false;
+    }
+    *etx->to = *to;
+  }
+  if (data_len > 0) {
+    bytes_init_arena(&etx->data, gen->arena);
+    if (!bytes_append(&etx->data, data, data_len)) {
+      return false;
+    }
+  }
+
+  const div0_arena_mark_t mark = div0_arena_mark(gen->arena);
+  const hash_t signing_hash = eip1559_tx_signing_hash(etx, gen->arena);
+  div0_arena_rewind(gen->arena, mark);
+  const ecdsa_sign_result_t sig = secp256k1_sign(gen->secp, signing_hash.bytes, gen->keys[sender]);
+  if (!sig.success) {
+    return false;
+  }
+  etx->y_parity = (uint8_t)sig.recovery_id;
+  etx->r = uint256_from_bytes_be(sig.signature, 32);
+  etx->s = uint256_from_bytes_be(sig.signature + 32, 32);
+
+  gen->tx_count++;
+  gen->gas_total += gas;
+  return true;
+}
+
+/// Constant-product swap: amountIn from calldata, reserves in slots 0 and 1,
+/// output credited to balances[caller] (mapping at slot 2), swap counter in slot 3.
+static const uint8_t SWAP_CODE[] = {
+    // in, r0, r1
+    OP_PUSH1, 0, OP_CALLDATALOAD, OP_PUSH1, 0, OP_SLOAD, OP_PUSH1, 1, OP_SLOAD,
+    // out = in * r1 / (r0 + in)
+    OP_DUP3, OP_DUP3, OP_ADD, OP_DUP4, OP_DUP3, OP_MUL, OP_DIV,
+    // r1 -= out; r0 += in
+    OP_DUP1, OP_DUP3, OP_SUB, OP_PUSH1, 1, OP_SSTORE, OP_DUP4, OP_DUP4, OP_ADD, OP_PUSH1, 0,
+    OP_SSTORE,
+    // balances[caller] += out
+    OP_CALLER, OP_PUSH1, 0, OP_MSTORE, OP_PUSH1, 2, OP_PUSH1, 32, OP_MSTORE, OP_PUSH1, 64,
+    OP_PUSH1, 0, OP_KECCAK256, OP_DUP1, OP_SLOAD, OP_DUP3, OP_ADD, OP_SWAP1, OP_SSTORE,
+    // swaps += 1
+    OP_PUSH1, 3, OP_SLOAD, OP_PUSH1, 1, OP_ADD, OP_PUSH1, 3, OP_SSTORE, OP_STOP};
+
+/// Constructor prefix: store the deployer in slot 0, then return the runtime
+/// that follows this prefix.
+enum { DEPLOY_PREFIX_SIZE = 18, DEPLOY_TAG_SIZE = 4 };
+
+/// Plain value transfers to fresh recipients.
+static bool generate_transfers(block_gen_t *gen, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    const address_t to = indexed_address(0xEE, (uint32_t)i);
+    if (!gen_add_tx(gen, i % gen->sender_count, &to, TRANSFER_GAS, nullptr, 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Contract creations, each deploying a distinct copy of the swap runtime.
+static bool generate_deployments(block_gen_t *gen, size_t count) {
+  constexpr size_t runtime_size = sizeof(SWAP_CODE) + DEPLOY_TAG_SIZE;
+  uint8_t init[DEPLOY_PREFIX_SIZE + runtime_size];
+  const uint8_t prefix[DEPLOY_PREFIX_SIZE] = {
+      OP_CALLER, OP_PUSH1, 0, OP_SSTORE,
+      // codecopy(0, DEPLOY_PREFIX_SIZE, runtime_size)
+      OP_PUSH2, 0, (uint8_t)runtime_size, OP_PUSH1, DEPLOY_PREFIX_SIZE, OP_PUSH1, 0, OP_CODECOPY,
+      // return(0, runtime_size)
+      OP_PUSH2, 0, (uint8_t)runtime_size, OP_PUSH1, 0, OP_RETURN};
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(init, prefix, sizeof(prefix));
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(init + DEPLOY_PREFIX_SIZE, SWAP_CODE, sizeof(SWAP_CODE));
+
+  for (size_t i = 0; i < count; i++) {
+    // Unreachable tag after STOP gives every contract its own code hash
+    uint8_t *tag = init + DEPLOY_PREFIX_SIZE + sizeof(SWAP_CODE);
+    tag[0] = (uint8_t)(i >> 24);
+    tag[1] = (uint8_t)(i >> 16);
+    tag[2] = (uint8_t)(i >> 8);
+    tag[3] = (uint8_t)i;
+    if (!gen_add_tx(gen, i % gen->sender_count, nullptr, DEPLOY_GAS, init, sizeof(init))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Storage-heavy swaps spread over POOL_COUNT constant-product pools.
+static bool generate_swaps(block_gen_t *gen, size_t count) {
+  address_t pools[POOL_COUNT];
+  for (uint32_t p = 0; p < POOL_COUNT; p++) {
+    pools[p] = indexed_address(0xDE, p);
+    account_snapshot_t *pool = gen_add_account(gen, &pools[p], uint256_zero());
+    storage_entry_t *storage =
+        div0_arena_alloc_array(gen->arena, 2, sizeof(storage_entry_t), alignof(storage_entry_t));
+    if (pool == nullptr || storage == nullptr) {
+      return false;
+    }
+    pool->nonce = 1;
+    pool->code.data = (uint8_t *)SWAP_CODE;
+    pool->code.size = sizeof(SWAP_CODE);
+    storage[0] = (storage_entry_t){.slot = uint256_from_u64(0), .value = u256_pow10(24)};
+    storage[1] = (storage_entry_t){.slot = uint256_from_u64(1), .value = u256_pow10(24)};
+    pool->storage = storage;
+    pool->storage_count = 2;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    uint8_t amount[32];
+    uint256_to_bytes_be(uint256_add(u256_pow10(15), uint256_from_u64(i)), amount);
+    if (!gen_add_tx(gen, i % gen->sender_count, &pools[i % POOL_COUNT], SWAP_GAS, amount,
+                    sizeof(amount))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+typedef struct {
+  const char *name;
+  size_t default_count;
+  size_t extra_accounts; // Accounts beyond the senders
+  bool (*generate)(block_gen_t *gen, size_t count);
+} generator_t;
+
+static const generator_t GENERATORS[] = {
+    {"transfers", 10000, 0, generate_transfers},
+    {"deployments", 1000, 0, generate_deployments},
+    {"swaps", 5000, POOL_COUNT, generate_swaps},
+};
+
+enum { GENERATOR_COUNT = sizeof(GENERATORS) / sizeof(GENERATORS[0]) };
+
+static char *write_json_string(const json_writer_t *writer, yyjson_mut_val_t *root,
+                               size_t *out_len) {
+  return root == nullptr ? nullptr : json_write_string(writer, root, JSON_WRITE_COMPACT, out_len);
+}
+
+/// Generate a synthetic block and serialize it as t8n JSON inputs.
+static bool generate_fixture(const generator_t *generator, size_t count, uint64_t chain_id,
+                             fixture_t *out) {
+  div0_arena_t arena;
+  if (!div0_arena_init(&arena)) {
+    return false;
+  }
+  secp256k1_ctx_t *secp = secp256k1_ctx_create();
+  block_gen_t *gen = malloc(sizeof(block_gen_t));
+  json_writer_t writer;
+  bool writer_ok = false;
+  bool ok = secp != nullptr && gen != nullptr &&
+            gen_init(gen, &arena, secp, chain_id, count, generator->extra_accounts) &&
+            generator->generate(gen, count);
+
+  if (ok) {
+    writer_ok = json_writer_init(&writer).error == JSON_OK;
+    ok = writer_ok;
+  }
+  if (ok) {
+    const state_snapshot_t alloc = {.accounts = gen->accounts,
+                                    .account_count = gen->account_count};
+    const t8n_txs_t txs = {.txs = gen->txs, .tx_count = gen->tx_count};
+    out->alloc = write_json_string(&writer, t8n_write_alloc(&alloc, &writer), &out->alloc_len);
+    out->txs = write_json_string(&writer, t8n_write_txs(&txs, &writer), &out->txs_len);
+
+    char env[512];
+    const int len =
+        snprintf(env, sizeof(env),
+                 "{\"currentCoinbase\":\"0x%040x\",\"currentGasLimit\":\"0x%" PRIx64 "\","
+                 "\"currentNumber\":\"0x1\",\"currentTimestamp\":\"0x3e8\","
+                 "\"currentBaseFee\":\"0x%" PRIx64 "\",\"currentRandom\":\"0x%064x\","
+                 "\"currentExcessBlobGas\":\"0x0\",\"withdrawals\":[]}",
+                 0xC01Bu, gen->gas_total, SYNTH_BASE_FEE, 0u);
+    out->env = len > 0 && (size_t)len < sizeof(env) ? malloc((size_t)len + 1) : nullptr;
+    if (out->env != nullptr) {
+      // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+      memcpy(out->env, env, (size_t)len + 1);
+      out->env_len = (size_t)len;
+    }
+    ok = out->alloc != nullptr && out->txs != nullptr && out->env != nullptr;
+  }
+
+  if (writer_ok) {
+    json_writer_free(&writer);
+  }
+  free(gen);
+  secp256k1_ctx_destroy(secp);
+  div0_arena_destroy(&arena);
+  out->name = generator->name;
+  return ok;
+}
+
+// =============================================================================
+// Arena Accounting
+// =============================================================================
+
+/// malloc-backed block provider that tracks live and peak bytes.
+typedef struct {
+  div0_arena_provider_t base;
+  size_t live_bytes;
+  size_t peak_bytes;
+  uint64_t acquires;
+} tracking_provider_t;
+
+static void *tracking_acquire(div0_arena_provider_t *provider, size_t size) {
+  const auto tracker = (tracking_provider_t *)provider;
+  void *ptr = malloc(size);
+  if (ptr != nullptr) {
+    tracker->acquires++;
+    tracker->live_bytes += size;
+    if (tracker->live_bytes > tracker->peak_bytes) {
+      tracker->peak_bytes = tracker->live_bytes;
+    }
+  }
+  return ptr;
+}
+
+static void tracking_release(div0_arena_provider_t *provider, void *ptr, size_t size) {
+  ((tracking_provider_t *)provider)->live_bytes -= size;
+  free(ptr);
+}
+
+// =============================================================================
+// State Root Timing
+// =============================================================================
+
+// block_executor_run computes the state root itself; routing the world
+// state's state_root entry through this hook separates it from execution.
+static const state_access_vtable_t *world_state_vtable;
+static state_access_vtable_t timed_vtable;
+static uint64_t state_root_ns;
+
+static hash_t timed_state_root(state_access_t *state) {
+  const uint64_t start = bench_now_ns();
+  const hash_t root = world_state_vtable->state_root(state);
+  state_root_ns += bench_now_ns() - start;
+  return root;
+}
+
+static void install_root_timer(world_state_t *ws) {
+  if (world_state_vtable == nullptr) {
+    world_state_vtable = ws->base.vtable;
+    timed_vtable = *ws->base.vtable;
+    timed_vtable.state_root = timed_state_root;
+  }
+  ws->base.vtable = &timed_vtable;
+}
+
+// =============================================================================
+// Replay
+// =============================================================================
+
+typedef enum {
+  PHASE_PARSE,
+  PHASE_RECOVER,
+  PHASE_LOAD,
+  PHASE_EXECUTE,
+  PHASE_ROOT,
+  PHASE_WRITE,
+  PHASE_COUNT,
+} phase_t;
+
+static const char *const PHASE_NAMES[PHASE_COUNT] = {
+    "json parse", "sender recovery", "state load", "execution", "state root", "json write",
+};
+
+/// Phase keys in --json output.
+static const char *const PHASE_KEYS[PHASE_COUNT] = {
+    "parse", "recover", "load", "execute", "root", "write",
+};
+
+typedef struct {
+  uint64_t phase_ns[PHASE_COUNT];
+  size_t tx_count;
+  size_t rejected;
+  uint64_t gas_used;
+  hash_t state_root;
+  size_t output_bytes;
+  world_state_stats_t tables;
+} replay_stats_t;
+
+static void build_state(world_state_t *ws, const state_snapshot_t *snapshot) {
+  state_access_t *state = world_state_access(ws);
+  for (size_t i = 0; i < snapshot->account_count; i++) {
+    const account_snapshot_t *acc = &snapshot->accounts[i];
+    state_set_balance(state, &acc->address, acc->balance);
+    if (acc->nonce > 0) {
+      state_set_nonce(state, &acc->address, acc->nonce);
+    }
+    if (acc->code.data != nullptr && acc->code.size > 0) {
+      state_set_code(state, &acc->address, acc->code.data, acc->code.size);
+    }
+    for (size_t j = 0; j < acc->storage_count; j++) {
+      state_set_storage(state, &acc->address, acc->storage[j].slot, acc->storage[j].value);
+    }
+  }
+}
+
+/// Serialize the result and post-state as t8n does.
+/// @return Output bytes, or 0 on failure
+static size_t write_outputs(const block_exec_result_t *exec, const t8n_env_t *env,
+                            world_state_t *ws, div0_arena_t *arena) {
+  t8n_result_t result;
+  t8n_result_init(&result);
+  result.state_root = exec->state_root;
+  result.gas_used = exec->gas_used;
+  result.has_current_base_fee = true;
+  result.current_base_fee = env->has_base_fee ? env->base_fee : uint256_from_u64(SYNTH_BASE_FEE);
+  result.has_withdrawals_root = true;
+  result.withdrawals_root = MPT_EMPTY_ROOT;
+
+  result.receipt_count = exec->receipt_count;
+  result.receipts =
+      div0_arena_alloc_array(arena, exec->receipt_count == 0 ? 1 : exec->receipt_count,
+                             sizeof(t8n_receipt_t), alignof(t8n_receipt_t));
+  result.rejected_count = exec->rejected_count;
+  result.rejected =
+      div0_arena_alloc_array(arena, exec->rejected_count == 0 ? 1 : exec->rejected_count,
+                             sizeof(t8n_rejected_tx_t), alignof(t8n_rejected_tx_t));
+  if (result.receipts == nullptr || result.rejected == nullptr) {
+    return 0;
+  }
+  for (size_t i = 0; i < exec->receipt_count; i++) {
+    const exec_receipt_t *r = &exec->receipts[i];
+    t8n_receipt_t *tr = &result.receipts[i];
+    __builtin___memset_chk(tr, 0, sizeof(*tr), __builtin_object_size(tr, 0));
+    tr->type = r->tx_type;
+    tr->tx_hash = r->tx_hash;
+    tr->transaction_index = i;
+    tr->gas_used = r->gas_used;
+    tr->cumulative_gas = r->cumulative_gas;
+    tr->status = r->success;
+    tr->contract_address = r->created_address;
+  }
+  for (size_t i = 0; i < exec->rejected_count; i++) {
+    result.rejected[i].index = exec->rejected[i].index;
+    result.rejected[i].error = exec->rejected[i].error_message;
+  }
+
+  json_writer_t writer;
+  if (json_writer_init(&writer).error != JSON_OK) {
+    return 0;
+  }
+  size_t result_len = 0;
+  size_t alloc_len = 0;
+  char *result_json = write_json_string(&writer, t8n_write_result(&result, &writer), &result_len);
+  state_snapshot_t post = {};
+  char *alloc_json = world_state_snapshot(ws, arena, &post)
+                         ? write_json_string(&writer, t8n_write_alloc(&post, &writer), &alloc_len)
+                         : nullptr;
+  const bool ok = result_json != nullptr && alloc_json != nullptr;
+  free(result_json);
+  free(alloc_json);
+  json_writer_free(&writer);
+  return ok ? result_len + alloc_len : 0;
+}
+
+/// Replay a fixture once through parse, recovery, state load, execution,
+/// state root and output serialization.
+static bool replay_once(const fixture_t *fixture, fork_t fork, uint64_t chain_id,
+                        secp256k1_ctx_t *secp, div0_arena_t *arena, div0_arena_t *scratch,
+                        replay_stats_t *out) {
+  __builtin___memset_chk(out, 0, sizeof(*out), __builtin_object_size(out, 0));
+
+  // Parse
+  uint64_t start = bench_now_ns();
+  state_snapshot_t pre_state = {};
+  t8n_env_t env;
+  t8n_env_init(&env);
+  t8n_txs_t txs = {};
+  if (t8n_parse_alloc(fixture->alloc, fixture->alloc_len, arena, &pre_state).error != JSON_OK ||
+      t8n_parse_env(fixture->env, fixture->env_len, arena, &env).error != JSON_OK ||
+      t8n_parse_txs(fixture->txs, fixture->txs_len, arena, &txs).error != JSON_OK) {
+    fprintf(stderr, "block_bench: %s: failed to parse inputs\n", fixture->name);
+    return false;
+  }
+  out->phase_ns[PHASE_PARSE] = bench_now_ns() - start;
+  out->tx_count = txs.tx_count;
+
+  // Sender recovery
+  start = bench_now_ns();
+  block_tx_t *block_txs = div0_arena_alloc_array(arena, txs.tx_count == 0 ? 1 : txs.tx_count,
+                                                 sizeof(block_tx_t), alignof(block_tx_t));
+  if (block_txs == nullptr) {
+    return false;
+  }
+  for (size_t i = 0; i < txs.tx_count; i++) {
+    const div0_arena_mark_t mark = div0_arena_mark(arena);
+    const ecrecover_result_t recovered = transaction_recover_sender(secp, &txs.txs[i], arena);
+    div0_arena_rewind(arena, mark);
+    block_txs[i].tx = &txs.txs[i];
+    block_txs[i].original_index = i;
+    block_txs[i].sender = recovered.success ? recovered.address : address_zero();
+    block_txs[i].sender_recovered = recovered.success;
+  }
+  out->phase_ns[PHASE_RECOVER] = bench_now_ns() - start;
+
+  // State load
+  start = bench_now_ns();
+  world_state_t *ws = world_state_create(arena);
+  if (ws == nullptr) {
+    return false;
+  }
+  build_state(ws, &pre_state);
+  install_root_timer(ws);
+  out->phase_ns[PHASE_LOAD] = bench_now_ns() - start;
+
+  // Execution (state root time is split out by the hook)
+  block_context_t block_ctx;
+  block_context_init(&block_ctx);
+  block_ctx.number = env.number;
+  block_ctx.timestamp = env.timestamp;
+  block_ctx.gas_limit = env.gas_limit;
+  block_ctx.chain_id = chain_id;
+  block_ctx.coinbase = env.coinbase;
+  if (env.has_base_fee) {
+    block_ctx.base_fee = env.base_fee;
+  }
+  if (env.has_prev_randao) {
+    block_ctx.prev_randao = env.prev_randao;
+  }
+
+  evm_t *evm = div0_arena_alloc_large(arena, sizeof(evm_t), 64);
+  if (evm == nullptr) {
+    world_state_destroy(ws);
+    return false;
+  }
+  // Per-transaction scratch is rewound after each transaction, as in t8n
+  evm_init(evm, scratch, fork);
+  (void)evm_enable_mapped_memory(evm);
+
+  block_executor_t executor;
+  block_executor_init(&executor, world_state_access(ws), &block_ctx, evm, arena, chain_id);
+  executor.rewind_evm_arena = true;
+  block_exec_result_t exec_result;
+  state_root_ns = 0;
+  start = bench_now_ns();
+  const bool executed = block_executor_run(&executor, block_txs, txs.tx_count, &exec_result);
+  const uint64_t run_ns = bench_now_ns() - start;
+  evm_destroy(evm);
+  if (!executed) {
+    fprintf(stderr, "block_bench: %s: block execution failed\n", fixture->name);
+    world_state_destroy(ws);
+    return false;
+  }
+  out->phase_ns[PHASE_ROOT] = state_root_ns;
+  out->phase_ns[PHASE_EXECUTE] = run_ns - state_root_ns;
+  out->rejected = exec_result.rejected_count;
+  out->gas_used = exec_result.gas_used;
+  out->state_root = exec_result.state_root;
+
+  // Output
+  start = bench_now_ns();
+  out->output_bytes = write_outputs(&exec_result, &env, ws, arena);
+  out->phase_ns[PHASE_WRITE] = bench_now_ns() - start;
+
+  out->tables = world_state_stats(ws);
+  world_state_destroy(ws);
+  return out->output_bytes > 0;
+}
+
+// =============================================================================
+// Reporting
+// =============================================================================
+
+typedef struct {
+  const char *name;
+  size_t runs;
+  size_t tx_count;
+  size_t rejected;
+  uint64_t gas_used;
+  uint64_t min_ns[PHASE_COUNT];
+  uint64_t total_ns[PHASE_COUNT];
+  uint64_t min_run_ns;
+  size_t peak_arena_bytes;
+  uint64_t acquires_per_run;
+  world_state_stats_t tables;
+} bench_report_t;
+
+static uint64_t run_total_ns(const replay_stats_t *stats) {
+  uint64_t total = 0;
+  for (size_t p = 0; p < PHASE_COUNT; p++) {
+    total += stats->phase_ns[p];
+  }
+  return total;
+}
+
+static void print_table_load(const char *name, const world_state_table_stats_t *table) {
+  const double load = table->buckets == 0 ? 0.0 : (double)table->size / (double)table->buckets;
+  printf("  %-20s %10zu / %-10zu load %.2f\n", name, table->size, table->buckets, load);
+}
+
+static void print_report(const bench_report_t *report) {
+  printf("\n=== %s: %zu txs, %zu rejected, %" PRIu64 " gas, %zu runs ===\n", report->name,
+         report->tx_count, report->rejected, report->gas_used, report->runs);
+  printf("%-20s %12s %12s %8s\n", "Phase", "Min ms", "Mean ms", "Share");
+  printf("------------------------------------------------------\n");
+  uint64_t total_ns = 0;
+  for (size_t p = 0; p < PHASE_COUNT; p++) {
+    total_ns += report->total_ns[p];
+  }
+  for (size_t p = 0; p < PHASE_COUNT; p++) {
+    printf("%-20s %12.3f %12.3f %7.1f%%\n", PHASE_NAMES[p], (double)report->min_ns[p] / 1e6,
+           (double)report->total_ns[p] / 1e6 / (double)report->runs,
+           total_ns == 0 ? 0.0 : (double)report->total_ns[p] * 100.0 / (double)total_ns);
+  }
+  printf("%-20s %12.3f %12.3f\n", "total", (double)report->min_run_ns / 1e6,
+         (double)total_ns / 1e6 / (double)report->runs);
+
+  const double best_s = (double)report->min_run_ns / 1e9;
+  const double exec_s =
+      (double)(report->min_ns[PHASE_EXECUTE] + report->min_ns[PHASE_ROOT]) / 1e9;
+  printf("\nThroughput: %.0f tx/s end-to-end, %.1f Mgas/s end-to-end, %.1f Mgas/s execution\n",
+         best_s > 0 ? (double)report->tx_count / best_s : 0.0,
+         best_s > 0 ? (double)report->gas_used / best_s / 1e6 : 0.0,
+         exec_s > 0 ? (double)report->gas_used / exec_s / 1e6 : 0.0);
+  printf("Peak arena: %zu bytes (%" PRIu64 " block acquisitions per run)\n",
+         report->peak_arena_bytes, report->acquires_per_run);
+  printf("Hash tables (entries / buckets):\n");
+  print_table_load("storage_tries", &report->tables.storage_tries);
+  print_table_load("code_store", &report->tables.code_store);
+  print_table_load("code_by_hash", &report->tables.code_by_hash);
+  print_table_load("warm_addresses", &report->tables.warm_addresses);
+  print_table_load("slot_access", &report->tables.slot_access);
+  print_table_load("dirty_storage", &report->tables.dirty_storage);
+  print_table_load("all_accounts", &report->tables.all_accounts);
+  print_table_load("all_storage_slots", &report->tables.all_storage_slots);
+}
+
+static void write_json_report(FILE *out, const bench_report_t *report, bool last) {
+  fprintf(out, "    {\"name\": \"%s\", \"runs\": %zu, \"txs\": %zu, \"rejected\": %zu",
+          report->name, report->runs, report->tx_count, report->rejected);
+  fprintf(out, ", \"gas_used\": %" PRIu64 ", \"min_run_ns\": %" PRIu64, report->gas_used,
+          report->min_run_ns);
+  for (size_t p = 0; p < PHASE_COUNT; p++) {
+    fprintf(out, ", \"%s_min_ns\": %" PRIu64, PHASE_KEYS[p], report->min_ns[p]);
+  }
+  fprintf(out, ", \"peak_arena_bytes\": %zu}%s\n", report->peak_arena_bytes, last ? "" : ",");
+}
+
+/// Replay a fixture `runs` times after one warm-up run.
+static bool run_fixture(const fixture_t *fixture, size_t runs, fork_t fork, uint64_t chain_id,
+                        bench_report_t *report) {
+  tracking_provider_t provider = {
+      .base = {.acquire = tracking_acquire, .release = tracking_release},
+  };
+  div0_arena_t arena;
+  div0_arena_t scratch;
+  const div0_arena_config_t config = {.block_size = 0, .provider = &provider.base};
+  secp256k1_ctx_t *secp = secp256k1_ctx_create();
+  if (secp == nullptr || !div0_arena_init_with(&arena, &config)) {
+    secp256k1_ctx_destroy(secp);
+    return false;
+  }
+  if (!div0_arena_init_with(&scratch, &config)) {
+    div0_arena_destroy(&arena);
+    secp256k1_ctx_destroy(secp);
+    return false;
+  }
+
+  __builtin___memset_chk(report, 0, sizeof(*report), __builtin_object_size(report, 0));
+  report->name = fixture->name;
+  report->runs = runs;
+  report->min_run_ns = UINT64_MAX;
+  for (size_t p = 0; p < PHASE_COUNT; p++) {
+    report->min_ns[p] = UINT64_MAX;
+  }
+
+  // Warm-up run grows the arena to its steady-state size
+  replay_stats_t stats;
+  bool ok = replay_once(fixture, fork, chain_id, secp, &arena, &scratch, &stats);
+  const hash_t expected_root = stats.state_root;
+  div0_arena_reset(&arena);
+  div0_arena_reset(&scratch);
+
+  const uint64_t acquires_before = provider.acquires;
+  for (size_t run = 0; ok && run < runs; run++) {
+    ok = replay_once(fixture, fork, chain_id, secp, &arena, &scratch, &stats);
+    div0_arena_reset(&arena);
+    div0_arena_reset(&scratch);
+    if (ok && !hash_equal(&stats.state_root, &expected_root)) {
+      fprintf(stderr, "block_bench: %s: state root differs between runs\n", fixture->name);
+      ok = false;
+    }
+    if (!ok) {
+      break;
+    }
+    for (size_t p = 0; p < PHASE_COUNT; p++) {
+      report->total_ns[p] += stats.phase_ns[p];
+      if (stats.phase_ns[p] < report->min_ns[p]) {
+        report->min_ns[p] = stats.phase_ns[p];
+      }
+    }
+    const uint64_t total = run_total_ns(&stats);
+    if (total < report->min_run_ns) {
+      report->min_run_ns = total;
+    }
+  }
+
+  report->tx_count = stats.tx_count;
+  report->rejected = stats.rejected;
+  report->gas_used = stats.gas_used;
+  report->tables = stats.tables;
+  report->peak_arena_bytes = provider.peak_bytes;
+  report->acquires_per_run = runs == 0 ? 0 : (provider.acquires - acquires_before) / runs;
+
+  div0_arena_destroy(&scratch);
+  div0_arena_destroy(&arena);
+  secp256k1_ctx_destroy(secp);
+  return ok;
+}
+
+static fork_t parse_fork(const char *name) {
+  if (strcmp(name, "Shanghai") == 0) {
+    return FORK_SHANGHAI;
+  }
+  if (strcmp(name, "Cancun") == 0) {
+    return FORK_CANCUN;
+  }
+  if (strcmp(name, "Prague") == 0) {
+    return FORK_PRAGUE;
+  }
+  return FORK_UNKNOWN;
+}
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [--synthetic transfers|deployments|swaps] [--count N]\n"
+          "       [--alloc PATH --env PATH --txs PATH] [--runs N] [--fork NAME]\n"
+          "       [--chain-id N] [--dump DIR] [--json PATH]\n",
+          argv0);
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char **argv) {
+  const char *synthetic = nullptr;
+  const char *alloc_path = nullptr;
+  const char *env_path = nullptr;
+  const char *txs_path = nullptr;
+  const char *dump_dir = nullptr;
+  const char *json_path = nullptr;
+  const char *fork_name = "Prague";
+  size_t count = 0;
+  size_t runs = DEFAULT_RUNS;
+  uint64_t chain_id = 1;
+
+  for (int i = 1; i < argc; i++) {
+    const bool has_value = i + 1 < argc;
+    if (strcmp(argv[i], "--synthetic") == 0 && has_value) {
+      synthetic = argv[++i];
+    } else if (strcmp(argv[i], "--count") == 0 && has_value) {
+      count = strtoull(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--alloc") == 0 && has_value) {
+      alloc_path = argv[++i];
+    } else if (strcmp(argv[i], "--env") == 0 && has_value) {
+      env_path = argv[++i];
+    } else if (strcmp(argv[i], "--txs") == 0 && has_value) {
+      txs_path = argv[++i];
+    } else if (strcmp(argv[i], "--runs") == 0 && has_value) {
+      runs = strtoull(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--fork") == 0 && has_value) {
+      fork_name = argv[++i];
+    } else if (strcmp(argv[i], "--chain-id") == 0 && has_value) {
+      chain_id = strtoull(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--dump") == 0 && has_value) {
+      dump_dir = argv[++i];
+    } else if (strcmp(argv[i], "--json") == 0 && has_value) {
+      json_path = argv[++i];
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+
+  const fork_t fork = parse_fork(fork_name);
+  const bool from_files = alloc_path != nullptr || env_path != nullptr || txs_path != nullptr;
+  if (fork == FORK_UNKNOWN || runs == 0 ||
+      (from_files && (alloc_path == nullptr || env_path == nullptr || txs_path == nullptr))) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  // Load or generate every fixture up front; only the replays are timed
+  fixture_t fixtures[GENERATOR_COUNT];
+  size_t fixture_count = 0;
+  if (from_files) {
+    fixture_t *fixture = &fixtures[fixture_count++];
+    __builtin___memset_chk(fixture, 0, sizeof(*fixture), __builtin_object_size(fixture, 0));
+    fixture->name = txs_path;
+    fixture->alloc = read_file(alloc_path, &fixture->alloc_len);
+    fixture->env = read_file(env_path, &fixture->env_len);
+    fixture->txs = read_file(txs_path, &fixture->txs_len);
+    if (fixture->alloc == nullptr || fixture->env == nullptr || fixture->txs == nullptr) {
+      fixture_free(fixture);
+      return 1;
+    }
+  } else {
+    for (size_t g = 0; g < GENERATOR_COUNT; g++) {
+      if (synthetic != nullptr && strcmp(GENERATORS[g].name, synthetic) != 0) {
+        continue;
+      }
+      fixture_t *fixture = &fixtures[fixture_count++];
+      __builtin___memset_chk(fixture, 0, sizeof(*fixture), __builtin_object_size(fixture, 0));
+      const size_t tx_count = count != 0 ? count : GENERATORS[g].default_count;
+      if (!generate_fixture(&GENERATORS[g], tx_count, chain_id, fixture)) {
+        fprintf(stderr, "block_bench: failed to generate %s\n", GENERATORS[g].name);
+        fixture_free(fixture);
+        return 1;
+      }
+    }
+    if (fixture_count == 0) {
+      fprintf(stderr, "block_bench: unknown generator %s\n", synthetic);
+      return 2;
+    }
+  }
+
+  // --dump writes the (single) fixture as t8n input files
+  if (dump_dir != nullptr) {
+    if (fixture_count != 1 ||
+        !write_file(dump_dir, "alloc.json", fixtures[0].alloc, fixtures[0].alloc_len) ||
+        !write_file(dump_dir, "env.json", fixtures[0].env, fixtures[0].env_len) ||
+        !write_file(dump_dir, "txs.json", fixtures[0].txs, fixtures[0].txs_len)) {
+      fprintf(stderr, "block_bench: --dump needs one fixture and a writable directory\n");
+      return 1;
+    }
+  }
+
+  FILE *json_out = nullptr;
+  if (json_path != nullptr) {
+    json_out = fopen(json_path, "w");
+    if (json_out == nullptr) {
+      fprintf(stderr, "block_bench: failed to open %s\n", json_path);
+      return 1;
+    }
+    fputs("{\n  \"blocks\": [\n", json_out);
+  }
+
+  int exit_code = 0;
+  for (size_t f = 0; f < fixture_count; f++) {
+    bench_report_t report;
+    if (!run_fixture(&fixtures[f], runs, fork, chain_id, &report)) {
+      exit_code = 1;
+      break;
+    }
+    print_report(&report);
+    if (json_out != nullptr) {
+      write_json_report(json_out, &report, f + 1 == fixture_count);
+    }
+  }
+
+  if (json_out != nullptr) {
+    fputs("  ]\n}\n", json_out);
+    if (fclose(json_out) != 0) {
+      exit_code = 1;
+    }
+  }
+  for (size_t f = 0; f < fixture_count; f++) {
+    fixture_free(&fixtures[f]);
+  }
+  if (exit_code == 0) {
+    printf("\nBenchmarks complete.\n");
+  }
+  return exit_code;
+}
+
+// NOLINTEND(cert-err33-c)
@@ -0,0 +1,525 @@
+// End-to-end interpreter benchmarks
+// Runs bytecode workloads through evm_execute_env and reports Mgas/s, ns/op and
+// allocations. Results can be written as JSON and compared against a baseline.
+//
+// Usage: evm_bench [--filter NAME] [--json PATH] [--baseline PATH] [--threshold PCT]
+
+#include "bench.h"
+#include "div0/crypto/keccak256.h"
+#include "div0/evm/evm.h"
+#include "div0/evm/opcodes.h"
+#include "div0/json/parse.h"
+#include "div0/mem/arena.h"
+#include "div0/state/state_access.h"
+#include "div0/state/world_state.h"
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Bench output uses printf/fprintf; write errors are not recoverable here.
+// NOLINTBEGIN(cert-err33-c)
+
+// Maximum bytecode size of a workload
+enum { CODE_CAPACITY = 4096 };
+
+// Calldata size of the memory copy workload
+enum { COPY_INPUT_SIZE = 1024 };
+
+// Default regression threshold in percent
+enum { DEFAULT_THRESHOLD_PCT = 5 };
+
+// =============================================================================
+// Bytecode Builder
+// =============================================================================
+
+typedef struct {
+  uint8_t code[CODE_CAPACITY];
+  size_t size;
+} code_buf_t;
+
+static void emit(code_buf_t *buf, const uint8_t *bytes, size_t len) {
+  if (buf->size + len > CODE_CAPACITY) {
+    fprintf(stderr, "evm_bench: workload exceeds %d bytes\n", CODE_CAPACITY);
+    exit(1);
+  }
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(buf->code + buf->size, bytes, len);
+  buf->size += len;
+}
+
+#define EMIT(buf, ...)                                                                             \
+  emit(buf, (const uint8_t[]){__VA_ARGS__}, sizeof((const uint8_t[]){__VA_ARGS__}))
+
+static void emit_push2(code_buf_t *buf, uint16_t value) {
+  EMIT(buf, OP_PUSH2, (uint8_t)(value >> 8), (uint8_t)value);
+}
+
+/// Start a loop that runs the following body `iterations` times.
+/// The counter stays on the stack; bodies must leave the stack as they found it.
+/// @return Position of the loop head
+static uint16_t begin_loop(code_buf_t *buf, uint16_t iterations) {
+  emit_push2(buf, iterations);
+  const uint16_t head = (uint16_t)buf->size;
+  EMIT(buf, OP_JUMPDEST);
+  return head;
+}
+
+/// Close a loop opened by begin_loop and stop.
+static void end_loop(code_buf_t *buf, uint16_t head) {
+  EMIT(buf, OP_PUSH1, 1, OP_SWAP1, OP_SUB, OP_DUP1);
+  emit_push2(buf, head);
+  EMIT(buf, OP_JUMPI, OP_POP, OP_STOP);
+}
+
+// =============================================================================
+// Workloads
+// =============================================================================
+
+/// Contract address of every workload.
+static const address_t CONTRACT = {.bytes = {[19] = 0xC0}};
+
+/// Caller of every workload (holds the token balance in the ERC-20 workload).
+static const address_t CALLER = {.bytes = {[19] = 0xCA}};
+
+typedef struct {
+  const char *name;
+  uint64_t executions; // Timed executions
+  uint64_t gas;        // Gas limit per execution
+  bool input;          // Pass COPY_INPUT_SIZE bytes of calldata
+  void (*build)(code_buf_t *buf);
+  void (*prepare)(state_access_t *state, const code_buf_t *code); // Optional pre-state
+} workload_t;
+
+/// Tight arithmetic loop (MUL, ADD, AND, XOR, SHL).
+static void build_arith(code_buf_t *buf) {
+  const uint16_t head = begin_loop(buf, 10000);
+  EMIT(buf, OP_DUP1, OP_DUP1, OP_MUL, OP_DUP2, OP_ADD, OP_PUSH1, 0xFF, OP_AND, OP_DUP2, OP_XOR,
+       OP_PUSH1, 3, OP_SHL, OP_POP);
+  end_loop(buf, head);
+}
+
+/// Hash the counter and the previous hash, 64 bytes per KECCAK256.
+static void build_keccak(code_buf_t *buf) {
+  const uint16_t head = begin_loop(buf, 5000);
+  EMIT(buf, OP_DUP1, OP_PUSH1, 0, OP_MSTORE, OP_PUSH1, 64, OP_PUSH1, 0, OP_KECCAK256, OP_PUSH1,
+       32, OP_MSTORE);
+  end_loop(buf, head);
+}
+
+/// Copy 1KB of calldata into memory, then copy it word by word to another region.
+static void build_memcopy(code_buf_t *buf) {
+  const uint16_t head = begin_loop(buf, 200);
+  emit_push2(buf, COPY_INPUT_SIZE);
+  EMIT(buf, OP_PUSH1, 0, OP_PUSH1, 0, OP_CALLDATACOPY);
+  for (uint16_t offset = 0; offset < COPY_INPUT_SIZE; offset += 32) {
+    emit_push2(buf, offset);
+    EMIT(buf, OP_MLOAD);
+    emit_push2(buf, COPY_INPUT_SIZE + offset);
+    EMIT(buf, OP_MSTORE);
+  }
+  end_loop(buf, head);
+}
+
+/// Push the balance slot of the address on top of the stack: keccak256(addr . 0).
+static void emit_balance_slot(code_buf_t *buf) {
+  EMIT(buf, OP_PUSH1, 0, OP_MSTORE, OP_PUSH1, 0, OP_PUSH1, 32, OP_MSTORE, OP_PUSH1, 64, OP_PUSH1,
+       0, OP_KECCAK256);
+}
+
+/// ERC-20 style transfers: debit the caller, credit a fresh recipient, 100 times.
+static void build_erc20(code_buf_t *buf) {
+  const uint16_t head = begin_loop(buf, 100);
+  // balances[caller] -= 1
+  EMIT(buf, OP_CALLER);
+  emit_balance_slot(buf);
+  EMIT(buf, OP_DUP1, OP_SLOAD, OP_PUSH1, 1, OP_SWAP1, OP_SUB, OP_SWAP1, OP_SSTORE);
+  // balances[counter] += 1
+  EMIT(buf, OP_DUP1);
+  emit_balance_slot(buf);
+  EMIT(buf, OP_DUP1, OP_SLOAD, OP_PUSH1, 1, OP_ADD, OP_SWAP1, OP_SSTORE);
+  end_loop(buf, head);
+}
+
+static void prepare_erc20(state_access_t *state, const code_buf_t *code) {
+  (void)code;
+  uint8_t preimage[64] = {0};
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(preimage + 12, CALLER.bytes, ADDRESS_SIZE);
+  const hash_t slot = keccak256(preimage, sizeof(preimage));
+  state_set_storage(state, &CONTRACT, uint256_from_bytes_be(slot.bytes, HASH_SIZE),
+                    uint256_from_u64(1000000));
+}
+
+/// Reentrancy lock around a per-iteration balance delta, in the style of
+/// flash-accounting contracts. The same bytecode runs on transient storage
+/// (TLOAD/TSTORE) and persistent storage (SLOAD/SSTORE) for comparison.
+static void emit_lock_loop(code_buf_t *buf, uint8_t load, uint8_t store) {
+  const uint16_t head = begin_loop(buf, 500);
+  // Check and take the lock in slot 0
+  EMIT(buf, OP_PUSH1, 0, load, OP_POP, OP_PUSH1, 1, OP_PUSH1, 0, store);
+  // deltas[counter] = 1
+  EMIT(buf, OP_PUSH1, 1, OP_DUP2, store);
+  // Release the lock
+  EMIT(buf, OP_PUSH1, 0, OP_PUSH1, 0, store);
+  end_loop(buf, head);
+}
+
+static void build_transient_lock(code_buf_t *buf) { emit_lock_loop(buf, OP_TLOAD, OP_TSTORE); }
+
+static void build_storage_lock(code_buf_t *buf) { emit_lock_loop(buf, OP_SLOAD, OP_SSTORE); }
+
+/// Contract that calls itself until gas or call depth runs out.
+static void build_recursion(code_buf_t *buf) {
+  EMIT(buf, OP_PUSH1, 0, OP_PUSH1, 0, OP_PUSH1, 0, OP_PUSH1, 0, OP_PUSH1, 0, OP_ADDRESS, OP_GAS,
+       OP_CALL, OP_POP, OP_STOP);
+}
+
+static void prepare_recursion(state_access_t *state, const code_buf_t *code) {
+  state_set_code(state, &CONTRACT, code->code, code->size);
+}
+
+/// Fixed-point math in the style of snailtracer: scaled products, signed
+/// division, modular squaring and sign extension on every iteration.
+static void build_compute(code_buf_t *buf) {
+  const uint16_t head = begin_loop(buf, 5000);
+  // a = n * 1000
+  EMIT(buf, OP_DUP1, OP_PUSH2, 0x03, 0xE8, OP_MUL);
+  // s = a * a / 1e6 + a
+  EMIT(buf, OP_DUP1, OP_DUP1, OP_MUL, OP_PUSH3, 0x0F, 0x42, 0x40, OP_SWAP1, OP_SDIV, OP_DUP2,
+       OP_ADD);
+  // r = signextend(1, s * s % (2^31 - 1)), folded back into the stack
+  EMIT(buf, OP_PUSH4, 0x7F, 0xFF, 0xFF, 0xFF, OP_DUP2, OP_DUP1, OP_MULMOD, OP_PUSH1, 1,
+       OP_SIGNEXTEND, OP_ADD, OP_ADD, OP_POP);
+  end_loop(buf, head);
+}
+
+/// Chains of tiny basic blocks joined by unconditional jumps.
+static void build_jumps(code_buf_t *buf) {
+  const uint16_t head = begin_loop(buf, 5000);
+  for (int i = 0; i < 32; i++) {
+    // PUSH2 target, JUMP, then the target JUMPDEST
+    emit_push2(buf, (uint16_t)(buf->size + 4));
+    EMIT(buf, OP_JUMP, OP_JUMPDEST);
+  }
+  end_loop(buf, head);
+}
+
+static const workload_t WORKLOADS[] = {
+    {"arith_loop", 200, 30000000, false, build_arith, nullptr},
+    {"keccak_loop", 100, 30000000, false, build_keccak, nullptr},
+    {"memory_copy", 200, 30000000, true, build_memcopy, nullptr},
+    {"erc20_transfers", 200, 30000000, false, build_erc20, prepare_erc20},
+    {"transient_lock", 200, 30000000, false, build_transient_lock, nullptr},
+    {"storage_lock", 200, 30000000, false, build_storage_lock, nullptr},
+    {"call_recursion", 200, 30000000, false, build_recursion, prepare_recursion},
+    {"fixed_point_compute", 100, 30000000, false, build_compute, nullptr},
+    {"jump_chain", 100, 30000000, false, build_jumps, nullptr},
+};
+
+enum { WORKLOAD_COUNT = sizeof(WORKLOADS) / sizeof(WORKLOADS[0]) };
+
+// =============================================================================
+// Allocation Counting
+// =============================================================================
+
+/// malloc-backed block provider that counts block acquisitions.
+typedef struct {
+  div0_arena_provider_t base;
+  uint64_t acquires;
+} counting_provider_t;
+
+static void *counting_acquire(div0_arena_provider_t *provider, size_t size) {
+  ((counting_provider_t *)provider)->acquires++;
+  return malloc(size);
+}
+
+static void counting_release(div0_arena_provider_t *provider, void *ptr, size_t size) {
+  (void)provider;
+  (void)size;
+  free(ptr);
+}
+
+/// Bytes handed out from the arena's regular blocks.
+static size_t arena_used_bytes(const div0_arena_t *arena) {
+  size_t used = 0;
+  for (const div0_arena_block_t *block = arena->head; block != nullptr; block = block->next) {
+    used += block->offset;
+  }
+  return used;
+}
+
+// =============================================================================
+// Runner
+// =============================================================================
+
+typedef struct {
+  const char *name;
+  uint64_t executions;
+  uint64_t elapsed_ns;
+  uint64_t gas_per_op;         // Gas used by one execution
+  uint64_t arena_bytes_per_op; // Arena bytes used by one execution
+  double heap_allocs_per_op;   // Provider block acquisitions per execution
+} bench_result_t;
+
+static double result_ns_per_op(const bench_result_t *result) {
+  return (double)result->elapsed_ns / (double)result->executions;
+}
+
+static double result_mgas_per_s(const bench_result_t *result) {
+  return (double)(result->gas_per_op * result->executions) * 1e3 / (double)result->elapsed_ns;
+}
+
+/// Execute a workload once on a fresh EVM and world state.
+/// @return Gas used, or UINT64_MAX if execution failed
+static uint64_t execute_once(const workload_t *workload, const code_buf_t *code,
+                             const uint8_t *input, div0_arena_t *arena, uint64_t *elapsed_ns) {
+  world_state_t *ws = world_state_create(arena);
+  if (ws == nullptr) {
+    return UINT64_MAX;
+  }
+  state_access_t *state = world_state_access(ws);
+  if (workload->prepare != nullptr) {
+    workload->prepare(state, code);
+  }
+
+  evm_t *evm = div0_arena_alloc_large(arena, sizeof(evm_t), 64);
+  if (evm == nullptr) {
+    world_state_destroy(ws);
+    return UINT64_MAX;
+  }
+  evm_init(evm, arena, FORK_PRAGUE);
+  evm_set_state(evm, state);
+
+  execution_env_t env;
+  execution_env_init(&env);
+  env.call.code = code->code;
+  env.call.code_size = code->size;
+  env.call.gas = workload->gas;
+  env.call.caller = CALLER;
+  env.call.address = CONTRACT;
+  if (workload->input) {
+    env.call.input = input;
+    env.call.input_size = COPY_INPUT_SIZE;
+  }
+
+  const uint64_t start = bench_now_ns();
+  const evm_execution_result_t result = evm_execute_env(evm, &env);
+  *elapsed_ns += bench_now_ns() - start;
+
+  world_state_destroy(ws);
+  return result.result == EVM_RESULT_STOP ? result.gas_used : UINT64_MAX;
+}
+
+static bool run_workload(const workload_t *workload, bench_result_t *out) {
+  code_buf_t code = {.size = 0};
+  workload->build(&code);
+
+  uint8_t input[COPY_INPUT_SIZE];
+  for (size_t i = 0; i < sizeof(input); i++) {
+    input[i] = (uint8_t)(i * 31);
+  }
+
+  counting_provider_t provider = {
+      .base = {.acquire = counting_acquire, .release = counting_release},
+      .acquires = 0,
+  };
+  div0_arena_t arena;
+  const div0_arena_config_t config = {.block_size = 0, .provider = &provider.base};
+  if (!div0_arena_init_with(&arena, &config)) {
+    return false;
+  }
+
+  // Warm-up execution grows the arena to its steady-state size
+  uint64_t warmup_ns = 0;
+  const uint64_t gas = execute_once(workload, &code, input, &arena, &warmup_ns);
+  const size_t arena_bytes = arena_used_bytes(&arena);
+  div0_arena_reset(&arena);
+  if (gas == UINT64_MAX) {
+    fprintf(stderr, "evm_bench: %s failed to execute\n", workload->name);
+    div0_arena_destroy(&arena);
+    return false;
+  }
+
+  const uint64_t acquires_before = provider.acquires;
+  uint64_t elapsed_ns = 0;
+  for (uint64_t i = 0; i < workload->executions; i++) {
+    (void)execute_once(workload, &code, input, &arena, &elapsed_ns);
+    div0_arena_reset(&arena);
+  }
+
+  out->name = workload->name;
+  out->executions = workload->executions;
+  out->elapsed_ns = elapsed_ns;
+  out->gas_per_op = gas;
+  out->arena_bytes_per_op = arena_bytes;
+  out->heap_allocs_per_op =
+      (double)(provider.acquires - acquires_before) / (double)workload->executions;
+  div0_arena_destroy(&arena);
+  return true;
+}
+
+// =============================================================================
+// Reporting
+// =============================================================================
+
+static void print_header(void) {
+  printf("\n=== Interpreter Workloads ===\n");
+  printf("%-24s %14s %10s %12s %14s %12s\n", "Benchmark", "Time", "Mgas/s", "Gas/op",
+         "Arena B/op", "Allocs/op");
+  printf("------------------------------------------------------------------------------------"
+         "------\n");
+}
+
+static void print_result(const bench_result_t *result) {
+  printf("%-24s %11.0f ns %10.1f %12" PRIu64 " %14" PRIu64 " %12.2f\n", result->name,
+         result_ns_per_op(result), result_mgas_per_s(result), result->gas_per_op,
+         result->arena_bytes_per_op, result->heap_allocs_per_op);
+}
+
+static bool write_json(const char *path, const bench_result_t *results, size_t count) {
+  FILE *out = fopen(path, "w");
+  if (out == nullptr) {
+    fprintf(stderr, "evm_bench: failed to open %s\n", path);
+    return false;
+  }
+  fputs("{\n  \"benchmarks\": [\n", out);
+  for (size_t i = 0; i < count; i++) {
+    const bench_result_t *r = &results[i];
+    fprintf(out,
+            "    {\"name\": \"%s\", \"executions\": %" PRIu64 ", \"ns_per_op\": %" PRIu64
+            ", \"mgas_per_s\": %.3f, \"gas_per_op\": %" PRIu64 ", \"arena_bytes_per_op\": %" PRIu64
+            ", \"heap_allocs_per_op\": %.3f}%s\n",
+            r->name, r->executions, (uint64_t)(result_ns_per_op(r) + 0.5), result_mgas_per_s(r),
+            r->gas_per_op, r->arena_bytes_per_op, r->heap_allocs_per_op, i + 1 < count ? "," : "");
+  }
+  fputs("  ]\n}\n", out);
+  const bool ok = ferror(out) == 0;
+  return fclose(out) == 0 && ok;
+}
+
+/// Compare results against a baseline written by --json.
+/// @return Number of regressions (slower than threshold, or changed gas)
+static int compare_baseline(const char *path, const bench_result_t *results, size_t count,
+                            double threshold_pct) {
+  json_doc_t doc;
+  const json_result_t parsed = json_parse_file(path, &doc);
+  if (parsed.error != JSON_OK) {
+    fprintf(stderr, "evm_bench: failed to parse baseline %s\n", path);
+    return -1;
+  }
+  yyjson_val_t *benchmarks = json_obj_get(json_doc_root(&doc), "benchmarks");
+  if (!json_is_arr(benchmarks)) {
+    fprintf(stderr, "evm_bench: baseline %s has no benchmarks array\n", path);
+    json_doc_free(&doc);
+    return -1;
+  }
+
+  printf("\n=== Comparison against %s (threshold %.1f%%) ===\n", path, threshold_pct);
+  printf("%-24s %14s %14s %10s\n", "Benchmark", "Baseline", "Current", "Change");
+  printf("------------------------------------------------------------------------------------"
+         "------\n");
+
+  int regressions = 0;
+  for (size_t i = 0; i < count; i++) {
+    const bench_result_t *r = &results[i];
+    yyjson_val_t *base = nullptr;
+    json_arr_iter_t iter = json_arr_iter(benchmarks);
+    yyjson_val_t *entry;
+    while (json_arr_iter_next(&iter, &entry)) {
+      const char *name = json_get_str(json_obj_get(entry, "name"));
+      if (name != nullptr && strcmp(name, r->name) == 0) {
+        base = entry;
+        break;
+      }
+    }
+    if (base == nullptr) {
+      printf("%-24s %14s %11.0f ns %10s\n", r->name, "-", result_ns_per_op(r), "new");
+      continue;
+    }
+
+    const uint64_t base_ns = json_get_u64(json_obj_get(base, "ns_per_op"));
+    const uint64_t base_gas = json_get_u64(json_obj_get(base, "gas_per_op"));
+    const double current_ns = result_ns_per_op(r);
+    const double change_pct =
+        base_ns == 0 ? 0.0 : (current_ns - (double)base_ns) * 100.0 / (double)base_ns;
+    const char *verdict = "";
+    if (base_gas != r->gas_per_op) {
+      verdict = "  GAS CHANGED";
+      regressions++;
+    } else if (change_pct > threshold_pct) {
+      verdict = "  REGRESSION";
+      regressions++;
+    } else if (change_pct < -threshold_pct) {
+      verdict = "  improved";
+    }
+    printf("%-24s %11" PRIu64 " ns %11.0f ns %+9.1f%%%s\n", r->name, base_ns, current_ns,
+           change_pct, verdict);
+  }
+
+  json_doc_free(&doc);
+  return regressions;
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char **argv) {
+  const char *filter = nullptr;
+  const char *json_path = nullptr;
+  const char *baseline_path = nullptr;
+  double threshold_pct = DEFAULT_THRESHOLD_PCT;
+
+  for (int i = 1; i < argc; i++) {
+    const bool has_value = i + 1 < argc;
+    if (strcmp(argv[i], "--filter") == 0 && has_value) {
+      filter = argv[++i];
+    } else if (strcmp(argv[i], "--json") == 0 && has_value) {
+      json_path = argv[++i];
+    } else if (strcmp(argv[i], "--baseline") == 0 && has_value) {
+      baseline_path = argv[++i];
+    } else if (strcmp(argv[i], "--threshold") == 0 && has_value) {
+      threshold_pct = strtod(argv[++i], nullptr);
+    } else {
+      fprintf(stderr,
+              "usage: %s [--filter NAME] [--json PATH] [--baseline PATH] [--threshold PCT]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+
+  bench_result_t results[WORKLOAD_COUNT];
+  size_t count = 0;
+  print_header();
+  for (size_t i = 0; i < WORKLOAD_COUNT; i++) {
+    if (filter != nullptr && strstr(WORKLOADS[i].name, filter) == nullptr) {
+      continue;
+    }
+    if (!run_workload(&WORKLOADS[i], &results[count])) {
+      return 1;
+    }
+    print_result(&results[count]);
+    count++;
+  }
+
+  if (json_path != nullptr && !write_json(json_path, results, count)) {
+    fprintf(stderr, "evm_bench: failed to write %s\n", json_path);
+    return 1;
+  }
+
+  if (baseline_path != nullptr) {
+    const int regressions = compare_baseline(baseline_path, results, count, threshold_pct);
+    if (regressions != 0) {
+      printf("\n%d regression(s)\n", regressions < 0 ? 0 : regressions);
+      return 1;
+    }
+  }
+
+  printf("\nBenchmarks complete.\n");
+  return 0;
+}
+
+// NOLINTEND(cert-err33-c)
@@ -0,0 +1,162 @@
+// Benchmarks for hex encoding and decoding
+// Multi-megabyte code/calldata strings (the bulk of t8n JSON I/O) and the
+// fixed-width values, against a nibble-at-a-time scalar reference
+
+#include "bench.h"
+#include "div0/util/hex.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Sizes in bytes (the hex strings are twice as long)
+enum { CODE_BYTES = 4 << 20, CALLDATA_BYTES = 1 << 20 };
+
+// Fixed seed for reproducibility
+enum { BENCH_SEED = 42 };
+
+static uint64_t prng_state = BENCH_SEED;
+
+static uint64_t xorshift64(void) {
+  uint64_t x = prng_state;
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+  prng_state = x;
+  return x;
+}
+
+/// Nibble-at-a-time decode, as used before the vector kernels.
+static bool reference_decode(const char *const digits, uint8_t *const out, const size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    uint8_t high;
+    uint8_t low;
+    if (!hex_char_to_nibble(digits[i * 2], &high) ||
+        !hex_char_to_nibble(digits[(i * 2) + 1], &low)) {
+      return false;
+    }
+    out[i] = (uint8_t)((high << 4) | low);
+  }
+  return true;
+}
+
+/// Nibble-at-a-time encode, as used before the vector kernels.
+static void reference_encode(const uint8_t *const data, const size_t len, char *const out) {
+  static const char chars[] = "0123456789abcdef";
+  for (size_t i = 0; i < len; i++) {
+    out[i * 2] = chars[data[i] >> 4];
+    out[(i * 2) + 1] = chars[data[i] & 0x0F];
+  }
+}
+
+/// Print throughput of the last benchmark over len input bytes.
+static void print_throughput(const char *const name, const size_t len) {
+  const bench_stats_t *const stats = bench_last();
+  if (stats != nullptr && stats->name == name && stats->median_ns > 0) {
+    printf("    %-40s %8.0f MB/s\n", name, (double)len / stats->median_ns * 1e3);
+  }
+}
+
+static void bench_bulk(const char *const decode_name, const char *const encode_name,
+                       const char *const ref_decode_name, const char *const ref_encode_name,
+                       const uint8_t *const data, const size_t len, char *const hex,
+                       uint8_t *const out) {
+  hex_encode_digits(data, len, hex);
+
+  BENCH_RUN(ref_decode_name, {
+    const bool ok = reference_decode(hex, out, len);
+    BENCH_DO_NOT_OPTIMIZE(ok);
+  });
+  print_throughput(ref_decode_name, len);
+  BENCH_RUN(decode_name, {
+    const bool ok = hex_decode_digits(hex, out, len);
+    BENCH_DO_NOT_OPTIMIZE(ok);
+  });
+  print_throughput(decode_name, len);
+
+  BENCH_RUN(ref_encode_name, {
+    reference_encode(data, len, hex);
+    BENCH_DO_NOT_OPTIMIZE(hex[0]);
+  });
+  print_throughput(ref_encode_name, len);
+  BENCH_RUN(encode_name, {
+    hex_encode_digits(data, len, hex);
+    BENCH_DO_NOT_OPTIMIZE(hex[0]);
+  });
+  print_throughput(encode_name, len);
+}
+
+static void bench_values(void) {
+  uint8_t bytes[32];
+  for (size_t i = 0; i < sizeof(bytes); i++) {
+    bytes[i] = (uint8_t)xorshift64();
+  }
+  char word[67];
+  hex_encode(bytes, sizeof(bytes), word);
+  char addr_hex[43];
+  hex_encode(bytes, ADDRESS_SIZE, addr_hex);
+
+  uint256_t value;
+  address_t address;
+  BENCH_RUN("hex_decode_uint256 (64 digits)", {
+    const bool ok = hex_decode_uint256(word, &value);
+    BENCH_DO_NOT_OPTIMIZE(ok);
+    BENCH_DO_NOT_OPTIMIZE(value);
+  });
+  BENCH_RUN("hex_decode_uint256 (3 digits)", {
+    const bool ok = hex_decode_uint256("0x3e8", &value);
+    BENCH_DO_NOT_OPTIMIZE(ok);
+    BENCH_DO_NOT_OPTIMIZE(value);
+  });
+  BENCH_RUN("address_from_hex", {
+    const bool ok = address_from_hex(addr_hex, &address);
+    BENCH_DO_NOT_OPTIMIZE(ok);
+    BENCH_DO_NOT_OPTIMIZE(address);
+  });
+  BENCH_RUN("hex_encode_uint256_padded", {
+    hex_encode_uint256_padded(&value, word);
+    BENCH_DO_NOT_OPTIMIZE(word[2]);
+  });
+  BENCH_RUN("hex_encode_uint256 (minimal)", {
+    hex_encode_uint256(&value, word);
+    BENCH_DO_NOT_OPTIMIZE(word[2]);
+  });
+}
+
+int main(int argc, char **argv) {
+  if (!bench_begin(argc, argv, "hex")) {
+    return 2;
+  }
+  printf("div0 hex Benchmarks\n");
+  printf("===================\n");
+
+  uint8_t *const data = malloc(CODE_BYTES);
+  uint8_t *const out = malloc(CODE_BYTES);
+  char *const hex = malloc((size_t)CODE_BYTES * 2);
+  if (data == nullptr || out == nullptr || hex == nullptr) {
+    (void)fprintf(stderr, "Failed to allocate buffers\n"); // NOLINT(cert-err33-c)
+    return 1;
+  }
+  for (size_t i = 0; i < CODE_BYTES; i += sizeof(uint64_t)) {
+    const uint64_t r = xorshift64();
+    for (size_t j = 0; j < sizeof(uint64_t); j++) {
+      data[i + j] = (uint8_t)(r >> (j * 8));
+    }
+  }
+
+  bench_section("Code (4 MiB)");
+  bench_bulk("decode 4 MiB", "encode 4 MiB", "decode 4 MiB (scalar reference)",
+             "encode 4 MiB (scalar reference)", data, CODE_BYTES, hex, out);
+
+  bench_section("Calldata (1 MiB)");
+  bench_bulk("decode 1 MiB", "encode 1 MiB", "decode 1 MiB (scalar reference)",
+             "encode 1 MiB (scalar reference)", data, CALLDATA_BYTES, hex, out);
+
+  bench_section("Fixed-width values");
+  bench_values();
+
+  free(hex);
+  free(out);
+  free(data);
+  return bench_end();
+}
@@ -0,0 +1,94 @@
+// Benchmarks for execution tracing overhead
+// Runs a counting loop untraced and under each built-in tracer
+
+#include "bench.h"
+#include "div0/evm/evm.h"
+#include "div0/evm/opcodes.h"
+#include "div0/evm/profiler.h"
+#include "div0/evm/tracer.h"
+#include "div0/mem/arena.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// Loop iterations per execution
+enum { LOOP_ITERATIONS = 10000 };
+
+// Opcodes executed per loop iteration (JUMPDEST, PUSH1, SWAP1, SUB, DUP1, PUSH1, JUMPI)
+enum { OPS_PER_ITERATION = 7 };
+
+// counter = LOOP_ITERATIONS; do { counter -= 1 } while (counter != 0)
+static const uint8_t LOOP_CODE[] = {
+    OP_PUSH2, (LOOP_ITERATIONS >> 8) & 0xFF, LOOP_ITERATIONS & 0xFF,
+    OP_JUMPDEST, // pc = 3
+    OP_PUSH1, 1, OP_SWAP1, OP_SUB, OP_DUP1, OP_PUSH1, 3, OP_JUMPI, OP_POP, OP_STOP,
+};
+
+/// Benchmark one execution of the loop and return its median time in nanoseconds.
+/// The EVM is re-created per execution on a scratch arena (stacks are not pooled).
+static double run_loop(const char *name, evm_tracer_t *tracer, div0_arena_t *scratch) {
+  BENCH_RUN(name, {
+    evm_t evm;
+    evm_init(&evm, scratch, FORK_PRAGUE);
+    evm_set_tracer(&evm, tracer);
+
+    execution_env_t env;
+    memset(&env, 0, sizeof(env));
+    env.call.code = LOOP_CODE;
+    env.call.code_size = sizeof(LOOP_CODE);
+    env.call.gas = 10000000;
+    const evm_execution_result_t result = evm_execute_env(&evm, &env);
+    BENCH_DO_NOT_OPTIMIZE(result.gas_used);
+    div0_arena_reset(scratch);
+  });
+  // Filtered-out benchmarks leave the previous result in place
+  const bench_stats_t *stats = bench_last();
+  return stats != nullptr && stats->name == name ? stats->median_ns : 0.0;
+}
+
+static void print_overhead(const char *name, double execution_ns, double baseline_ns) {
+  const double ops = (double)LOOP_ITERATIONS * OPS_PER_ITERATION;
+  printf("%-40s %10.2f ns/opcode %10.2fx untraced\n", name, execution_ns / ops,
+         baseline_ns > 0 ? execution_ns / baseline_ns : 0.0);
+}
+
+int main(int argc, char **argv) {
+  if (!bench_begin(argc, argv, "profiler")) {
+    return 2;
+  }
+
+  div0_arena_t arena;
+  div0_arena_t scratch;
+  if (!div0_arena_init(&arena) || !div0_arena_init(&scratch)) {
+    (void)fprintf(stderr, "Failed to initialize arena\n"); // NOLINT(cert-err33-c)
+    return 1;
+  }
+
+  evm_opcode_histogram_t hist;
+  evm_opcode_histogram_init(&hist);
+  evm_gas_profiler_t gas_profiler;
+  evm_profiler_t profiler;
+  if (!evm_gas_profiler_init(&gas_profiler, &arena) || !evm_profiler_init(&profiler, &arena)) {
+    (void)fprintf(stderr, "Failed to initialize tracers\n"); // NOLINT(cert-err33-c)
+    return 1;
+  }
+
+  bench_section("Loop Execution (per execution)");
+  const double untraced = run_loop("untraced", nullptr, &scratch);
+  const double histogram = run_loop("opcode histogram", &hist.base, &scratch);
+  const double gas = run_loop("gas profiler", &gas_profiler.base, &scratch);
+  const double timed = run_loop("execution profiler", &profiler.base, &scratch);
+
+  printf("\n=== Tracing Overhead (per opcode, from medians) ===\n");
+  print_overhead("untraced", untraced, untraced);
+  print_overhead("opcode histogram", histogram, untraced);
+  print_overhead("gas profiler", gas, untraced);
+  print_overhead("execution profiler", timed, untraced);
+
+  div0_arena_destroy(&scratch);
+  div0_arena_destroy(&arena);
+
+  printf("\nBenchmarks complete.\n");
+  return bench_end();
+}
@@ -44,7 +44,7 @@ static void bench_pop(div0_arena_t *arena) {
   }
 
   uint256_t result;
-  BENCH_RUN("stack_pop_unsafe", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("stack_pop_unsafe", {
     // Refill if empty
     if (evm_stack_is_empty(&stack)) {
       for (int i = 0; i < 100; i++) {
@@ -67,7 +67,7 @@ static void bench_dup1(div0_arena_t *arena) {
   // Push one value
   (void)evm_stack_push(&stack, random_uint256());
 
-  BENCH_RUN("stack_dup_unsafe (depth=1)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("stack_dup_unsafe (depth=1)", {
     // Reset if stack getting too large
     if (evm_stack_size(&stack) > 500) {
       evm_stack_clear(&stack);
@@ -86,7 +86,7 @@ static void bench_dup8(div0_arena_t *arena) {
     (void)evm_stack_push(&stack, uint256_from_u64(i + 1));
   }
 
-  BENCH_RUN("stack_dup_unsafe (depth=8)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("stack_dup_unsafe (depth=8)", {
     // Reset if stack getting too large
     if (evm_stack_size(&stack) > 500) {
       evm_stack_clear(&stack);
@@ -107,7 +107,7 @@ static void bench_dup16(div0_arena_t *arena) {
     (void)evm_stack_push(&stack, uint256_from_u64(i + 1));
   }
 
-  BENCH_RUN("stack_dup_unsafe (depth=16)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("stack_dup_unsafe (depth=16)", {
     // Reset if stack getting too large
     if (evm_stack_size(&stack) > 500) {
       evm_stack_clear(&stack);
@@ -131,7 +131,7 @@ static void bench_swap1(div0_arena_t *arena) {
   (void)evm_stack_push(&stack, uint256_from_u64(1));
   (void)evm_stack_push(&stack, uint256_from_u64(2));
 
-  BENCH_RUN("stack_swap_unsafe (depth=1)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("stack_swap_unsafe (depth=1)", {
     evm_stack_swap_unsafe(&stack, 1);
   });
 }
@@ -145,7 +145,7 @@ static void bench_swap8(div0_arena_t *arena) {
     (void)evm_stack_push(&stack, uint256_from_u64(i + 1));
   }
 
-  BENCH_RUN("stack_swap_unsafe (depth=8)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("stack_swap_unsafe (depth=8)", {
     evm_stack_swap_unsafe(&stack, 8);
   });
 }
@@ -159,7 +159,7 @@ static void bench_swap16(div0_arena_t *arena) {
     (void)evm_stack_push(&stack, uint256_from_u64(i + 1));
   }
 
-  BENCH_RUN("stack_swap_unsafe (depth=16)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("stack_swap_unsafe (depth=16)", {
     evm_stack_swap_unsafe(&stack, 16);
   });
 }
@@ -175,7 +175,7 @@ static void bench_push_pop_cycle(div0_arena_t *arena) {
   const uint256_t value = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("push_unsafe + pop_unsafe cycle", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("push_unsafe + pop_unsafe cycle", {
     evm_stack_push_unsafe(&stack, value);
     result = evm_stack_pop_unsafe(&stack);
     BENCH_DO_NOT_OPTIMIZE(result);
@@ -189,7 +189,7 @@ static void bench_push_dup_pop_cycle(div0_arena_t *arena) {
   const uint256_t value = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("push + dup1 + pop + pop cycle", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("push + dup1 + pop + pop cycle", {
     evm_stack_push_unsafe(&stack, value);
     evm_stack_dup_unsafe(&stack, 1);
     result = evm_stack_pop_unsafe(&stack);
@@ -202,7 +202,10 @@ static void bench_push_dup_pop_cycle(div0_arena_t *arena) {
 // Main
 // =============================================================================
 
-int main(void) {
+int main(int argc, char **argv) {
+  if (!bench_begin(argc, argv, "stack")) {
+    return 2;
+  }
   printf("Stack Operations Benchmarks\n");
   printf("============================\n\n");
 
@@ -245,5 +248,5 @@ int main(void) {
   div0_arena_destroy(&arena);
 
   printf("\nBenchmarks complete.\n");
-  return 0;
+  return bench_end();
 }
@@ -52,7 +52,7 @@ static void bench_add(void) {
   const uint256_t b = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_add", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_add", {
     result = uint256_add(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -64,7 +64,7 @@ static void bench_add_max_carry(void) {
   const uint256_t b = uint256_from_u64(1);
   uint256_t result;
 
-  BENCH_RUN("uint256_add (max carry)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_add (max carry)", {
     result = uint256_add(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -76,7 +76,7 @@ static void bench_add_small(void) {
   const uint256_t b = uint256_from_u64(random_u64());
   uint256_t result;
 
-  BENCH_RUN("uint256_add (small)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_add (small)", {
     result = uint256_add(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -91,7 +91,7 @@ static void bench_sub(void) {
   const uint256_t b = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_sub", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_sub", {
     result = uint256_sub(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -103,7 +103,7 @@ static void bench_sub_max_borrow(void) {
   const uint256_t b = uint256_from_u64(1);
   uint256_t result;
 
-  BENCH_RUN("uint256_sub (max borrow)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_sub (max borrow)", {
     result = uint256_sub(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -118,7 +118,7 @@ static void bench_mul(void) {
   const uint256_t b = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_mul", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mul", {
     result = uint256_mul(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -130,7 +130,7 @@ static void bench_mul_small(void) {
   const uint256_t b = uint256_from_u64(random_u64());
   uint256_t result;
 
-  BENCH_RUN("uint256_mul (256x64)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mul (256x64)", {
     result = uint256_mul(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -142,7 +142,7 @@ static void bench_mul_single_limb(void) {
   const uint256_t b = uint256_from_u64(random_u64());
   uint256_t result;
 
-  BENCH_RUN("uint256_mul (64x64)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mul (64x64)", {
     result = uint256_mul(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -153,7 +153,7 @@ static void bench_mul_square(void) {
   const uint256_t a = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_mul (square)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mul (square)", {
     result = uint256_mul(a, a);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -168,7 +168,7 @@ static void bench_div(void) {
   const uint256_t b = make_divisor();
   uint256_t result;
 
-  BENCH_RUN("uint256_div", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_div", {
     result = uint256_div(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -180,7 +180,7 @@ static void bench_div_small(void) {
   const uint256_t b = uint256_from_u64(random_u64() | 1);
   uint256_t result;
 
-  BENCH_RUN("uint256_div (256/64)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_div (256/64)", {
     result = uint256_div(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -192,7 +192,7 @@ static void bench_div_both_small(void) {
   const uint256_t b = uint256_from_u64(random_u64() | 1);
   uint256_t result;
 
-  BENCH_RUN("uint256_div (64/64)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_div (64/64)", {
     result = uint256_div(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -204,7 +204,7 @@ static void bench_div_wei_to_ether(void) {
   const uint256_t b = uint256_from_u64(1000000000000000000ULL); // 10^18
   uint256_t result;
 
-  BENCH_RUN("uint256_div (wei->ether)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_div (wei->ether)", {
     result = uint256_div(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -219,7 +219,7 @@ static void bench_mod(void) {
   const uint256_t b = make_divisor();
   uint256_t result;
 
-  BENCH_RUN("uint256_mod", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mod", {
     result = uint256_mod(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -231,7 +231,7 @@ static void bench_mod_small(void) {
   const uint256_t b = uint256_from_u64(random_u64() | 1);
   uint256_t result;
 
-  BENCH_RUN("uint256_mod (256%64)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mod (256%64)", {
     result = uint256_mod(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -243,7 +243,7 @@ static void bench_mod_both_small(void) {
   const uint256_t b = uint256_from_u64(random_u64() | 1);
   uint256_t result;
 
-  BENCH_RUN("uint256_mod (64%64)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mod (64%64)", {
     result = uint256_mod(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -255,7 +255,7 @@ static void bench_mod_power_of_2(void) {
   const uint256_t b = uint256_from_u64(1ULL << 32); // 2^32
   uint256_t result;
 
-  BENCH_RUN("uint256_mod (pow2)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mod (pow2)", {
     result = uint256_mod(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -271,7 +271,7 @@ static void bench_addmod(void) {
   const uint256_t n = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_addmod", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_addmod", {
     result = uint256_addmod(a, b, n);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -284,7 +284,7 @@ static void bench_addmod_overflow(void) {
   const uint256_t n = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_addmod (overflow)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_addmod (overflow)", {
     result = uint256_addmod(a, b, n);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -297,7 +297,7 @@ static void bench_addmod_small_mod(void) {
   const uint256_t n = uint256_from_u64(random_u64() | 1);
   uint256_t result;
 
-  BENCH_RUN("uint256_addmod (small mod)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_addmod (small mod)", {
     result = uint256_addmod(a, b, n);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -313,7 +313,7 @@ static void bench_mulmod(void) {
   const uint256_t n = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_mulmod", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mulmod", {
     result = uint256_mulmod(a, b, n);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -326,7 +326,7 @@ static void bench_mulmod_max(void) {
   const uint256_t n = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_mulmod (max)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mulmod (max)", {
     result = uint256_mulmod(a, b, n);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -339,7 +339,7 @@ static void bench_mulmod_small_product(void) {
   const uint256_t n = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_mulmod (small product)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mulmod (small product)", {
     result = uint256_mulmod(a, b, n);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -352,7 +352,7 @@ static void bench_mulmod_small_mod(void) {
   const uint256_t n = uint256_from_u64(random_u64() | 1);
   uint256_t result;
 
-  BENCH_RUN("uint256_mulmod (small mod)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_mulmod (small mod)", {
     result = uint256_mulmod(a, b, n);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -367,7 +367,7 @@ static void bench_exp_small(void) {
   const uint256_t exp = uint256_from_u64(32);
   uint256_t result;
 
-  BENCH_RUN("uint256_exp (exp=32)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_exp (exp=32)", {
     result = uint256_exp(base, exp);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -378,7 +378,7 @@ static void bench_exp_medium(void) {
   const uint256_t exp = uint256_from_u64(256);
   uint256_t result;
 
-  BENCH_RUN("uint256_exp (base=3, exp=256)", BENCH_DEFAULT_ITERATIONS / 10, {
+  BENCH_RUN("uint256_exp (base=3, exp=256)", {
     result = uint256_exp(base, exp);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -390,7 +390,7 @@ static void bench_exp_large(void) {
   const uint256_t exp = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_exp (large exp)", BENCH_DEFAULT_ITERATIONS / 100, {
+  BENCH_RUN("uint256_exp (large exp)", {
     result = uint256_exp(base, exp);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -401,7 +401,7 @@ static void bench_exp_power_of_2(void) {
   const uint256_t exp = uint256_from_u64(200);
   uint256_t result;
 
-  BENCH_RUN("uint256_exp (base=2, exp=200)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_exp (base=2, exp=200)", {
     result = uint256_exp(base, exp);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -416,7 +416,7 @@ static void bench_lt(void) {
   const uint256_t b = random_uint256();
   bool result;
 
-  BENCH_RUN("uint256_lt", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_lt", {
     result = uint256_lt(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -427,7 +427,7 @@ static void bench_gt(void) {
   const uint256_t b = random_uint256();
   bool result;
 
-  BENCH_RUN("uint256_gt", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_gt", {
     result = uint256_gt(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -438,7 +438,7 @@ static void bench_eq(void) {
   const uint256_t b = random_uint256();
   bool result;
 
-  BENCH_RUN("uint256_eq", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_eq", {
     result = uint256_eq(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -449,7 +449,7 @@ static void bench_slt(void) {
   const uint256_t b = random_uint256();
   bool result;
 
-  BENCH_RUN("uint256_slt", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_slt", {
     result = uint256_slt(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -460,7 +460,7 @@ static void bench_sgt(void) {
   const uint256_t b = random_uint256();
   bool result;
 
-  BENCH_RUN("uint256_sgt", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_sgt", {
     result = uint256_sgt(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -475,7 +475,7 @@ static void bench_and(void) {
   const uint256_t b = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_and", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_and", {
     result = uint256_and(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -486,7 +486,7 @@ static void bench_or(void) {
   const uint256_t b = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_or", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_or", {
     result = uint256_or(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -497,7 +497,7 @@ static void bench_xor(void) {
   const uint256_t b = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_xor", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_xor", {
     result = uint256_xor(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -507,7 +507,7 @@ static void bench_not(void) {
   const uint256_t a = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_not", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_not", {
     result = uint256_not(a);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -518,7 +518,7 @@ static void bench_byte(void) {
   const uint256_t x = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_byte", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_byte", {
     result = uint256_byte(i, x);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -533,7 +533,7 @@ static void bench_shl_small(void) {
   const uint256_t value = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_shl (shift=8)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_shl (shift=8)", {
     result = uint256_shl(shift, value);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -544,7 +544,7 @@ static void bench_shl_large(void) {
   const uint256_t value = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_shl (shift=200)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_shl (shift=200)", {
     result = uint256_shl(shift, value);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -555,7 +555,7 @@ static void bench_shr_small(void) {
   const uint256_t value = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_shr (shift=8)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_shr (shift=8)", {
     result = uint256_shr(shift, value);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -566,7 +566,7 @@ static void bench_shr_large(void) {
   const uint256_t value = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_shr (shift=200)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_shr (shift=200)", {
     result = uint256_shr(shift, value);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -577,7 +577,7 @@ static void bench_sar_positive(void) {
   const uint256_t value = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_sar (positive)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_sar (positive)", {
     result = uint256_sar(shift, value);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -588,7 +588,7 @@ static void bench_sar_negative(void) {
   const uint256_t value = negate(random_uint256());
   uint256_t result;
 
-  BENCH_RUN("uint256_sar (negative)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_sar (negative)", {
     result = uint256_sar(shift, value);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -603,7 +603,7 @@ static void bench_sdiv(void) {
   const uint256_t b = make_divisor();
   uint256_t result;
 
-  BENCH_RUN("uint256_sdiv", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_sdiv", {
     result = uint256_sdiv(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -615,7 +615,7 @@ static void bench_sdiv_negative(void) {
   const uint256_t b = make_divisor();
   uint256_t result;
 
-  BENCH_RUN("uint256_sdiv (neg dividend)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_sdiv (neg dividend)", {
     result = uint256_sdiv(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -627,7 +627,7 @@ static void bench_sdiv_small(void) {
   const uint256_t b = uint256_from_u64((random_u64() >> 1) | 1);
   uint256_t result;
 
-  BENCH_RUN("uint256_sdiv (small pos)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_sdiv (small pos)", {
     result = uint256_sdiv(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -639,7 +639,7 @@ static void bench_sdiv_both_negative(void) {
   const uint256_t b = negate(make_divisor());
   uint256_t result;
 
-  BENCH_RUN("uint256_sdiv (both neg)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_sdiv (both neg)", {
     result = uint256_sdiv(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -651,7 +651,7 @@ static void bench_sdiv_small_negative(void) {
   const uint256_t b = negate(uint256_from_u64((random_u64() >> 1) | 1));
   uint256_t result;
 
-  BENCH_RUN("uint256_sdiv (small neg)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_sdiv (small neg)", {
     result = uint256_sdiv(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -666,7 +666,7 @@ static void bench_smod(void) {
   const uint256_t b = make_divisor();
   uint256_t result;
 
-  BENCH_RUN("uint256_smod", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_smod", {
     result = uint256_smod(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -678,7 +678,7 @@ static void bench_smod_small(void) {
   const uint256_t b = uint256_from_u64((random_u64() >> 1) | 1);
   uint256_t result;
 
-  BENCH_RUN("uint256_smod (small)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_smod (small)", {
     result = uint256_smod(a, b);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -694,7 +694,7 @@ static void bench_signextend_byte0(void) {
   const uint256_t value = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_signextend (byte 0)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_signextend (byte 0)", {
     result = uint256_signextend(byte_pos, value);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -706,7 +706,7 @@ static void bench_signextend_byte15(void) {
   const uint256_t value = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_signextend (byte 15)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_signextend (byte 15)", {
     result = uint256_signextend(byte_pos, value);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -718,7 +718,7 @@ static void bench_signextend_noop(void) {
   const uint256_t value = random_uint256();
   uint256_t result;
 
-  BENCH_RUN("uint256_signextend (noop)", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_signextend (noop)", {
     result = uint256_signextend(byte_pos, value);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -732,7 +732,7 @@ static void bench_byte_length(void) {
   const uint256_t value = random_uint256();
   size_t result;
 
-  BENCH_RUN("uint256_byte_length", BENCH_DEFAULT_ITERATIONS, {
+  BENCH_RUN("uint256_byte_length", {
     result = uint256_byte_length(value);
     BENCH_DO_NOT_OPTIMIZE(result);
   });
@@ -742,10 +742,12 @@ static void bench_byte_length(void) {
 // Main
 // =============================================================================
 
-int main(void) {
+int main(int argc, char **argv) {
+  if (!bench_begin(argc, argv, "uint256")) {
+    return 2;
+  }
   printf("div0 uint256 Benchmarks\n");
   printf("========================\n");
-  printf("Iterations: %d (unless noted)\n", BENCH_DEFAULT_ITERATIONS);
 
   // Addition
   reset_prng();
@@ -863,5 +865,5 @@ int main(void) {
   bench_byte_length();
 
   printf("\nBenchmarks complete.\n");
-  return 0;
+  return bench_end();
 }
@@ -0,0 +1,19 @@
+#ifndef DIV0_CRYPTO_BLAKE2B_H
+#define DIV0_CRYPTO_BLAKE2B_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// BLAKE2b compression function F (EIP-152, BLAKE2F precompile 0x09).
+///
+/// Runs the given number of rounds over one message block and updates the
+/// state in place. Unlike the hash function, the round count is a parameter.
+/// @param h State vector (8 words), updated in place
+/// @param m Message block (16 words)
+/// @param t Offset counter (2 words, low word first)
+/// @param final Final block indicator
+/// @param rounds Number of rounds
+void blake2b_compress(uint64_t h[8], const uint64_t m[16], const uint64_t t[2], bool final,
+                      uint32_t rounds);
+
+#endif // DIV0_CRYPTO_BLAKE2B_H
@@ -0,0 +1,53 @@
+#ifndef DIV0_CRYPTO_BN254_H
+#define DIV0_CRYPTO_BN254_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// @file bn254.h
+/// @brief BN254 (alt_bn128) curve operations for the ECADD, ECMUL and
+/// ECPAIRING precompiles (EIP-196, EIP-197).
+///
+/// All inputs and outputs use the precompile encoding: big-endian 32-byte
+/// field elements, G1 points as (x, y), G2 points as (x, y) with each Fp2
+/// coordinate written imaginary part first. The point at infinity is all
+/// zeros.
+
+/// Encoded G1 point size (x, y).
+static constexpr size_t BN254_G1_SIZE = 64;
+
+/// Encoded G2 point size (x.c1, x.c0, y.c1, y.c0).
+static constexpr size_t BN254_G2_SIZE = 128;
+
+/// Encoded scalar size.
+static constexpr size_t BN254_SCALAR_SIZE = 32;
+
+/// Encoded pairing input element size (G1 point followed by G2 point).
+static constexpr size_t BN254_PAIR_SIZE = BN254_G1_SIZE + BN254_G2_SIZE;
+
+/// Add two G1 points.
+/// @param a First point (64 bytes)
+/// @param b Second point (64 bytes)
+/// @param out Sum (64 bytes)
+/// @return false if either point is not a valid curve point
+bool bn254_g1_add(const uint8_t a[BN254_G1_SIZE], const uint8_t b[BN254_G1_SIZE],
+                  uint8_t out[BN254_G1_SIZE]);
+
+/// Multiply a G1 point by a scalar.
+/// @param point Point (64 bytes)
+/// @param scalar Big-endian scalar (32 bytes, not reduced)
+/// @param out Product (64 bytes)
+/// @return false if the point is not a valid curve point
+bool bn254_g1_mul(const uint8_t point[BN254_G1_SIZE], const uint8_t scalar[BN254_SCALAR_SIZE],
+                  uint8_t out[BN254_G1_SIZE]);
+
+/// Check that the product of the optimal ate pairings of the given pairs is
+/// one. Pairs with a point at infinity contribute one and are skipped.
+/// @param pairs Encoded (G1, G2) pairs, BN254_PAIR_SIZE bytes each
+/// @param count Number of pairs (0 yields true)
+/// @param result Output pairing check result
+/// @return false if any point is invalid (off curve, or G2 not in the subgroup)
+bool bn254_pairing_check(const uint8_t *pairs, size_t count, bool *result);
+
+#endif // DIV0_CRYPTO_BN254_H
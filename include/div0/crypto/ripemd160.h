@@ -0,0 +1,16 @@
+#ifndef DIV0_CRYPTO_RIPEMD160_H
+#define DIV0_CRYPTO_RIPEMD160_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// Size of a RIPEMD-160 digest in bytes.
+static constexpr size_t RIPEMD160_SIZE = 20;
+
+/// Compute RIPEMD-160 hash in a single call (RIPEMD160 precompile, 0x03).
+/// @param data Input data to hash (may be nullptr if len is 0)
+/// @param len Length of data in bytes
+/// @param out Output digest
+void ripemd160(const uint8_t *data, size_t len, uint8_t out[RIPEMD160_SIZE]);
+
+#endif // DIV0_CRYPTO_RIPEMD160_H
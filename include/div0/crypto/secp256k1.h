@@ -67,4 +67,31 @@ typedef struct {
 pubkey_result_t secp256k1_recover_pubkey(const secp256k1_ctx_t *ctx, const uint8_t message_hash[32],
                                          int recovery_id, const uint8_t signature[64]);
 
+/// Result of signing.
+typedef struct {
+  bool success;          ///< true if signing succeeded
+  int recovery_id;       ///< Recovery ID (0 or 1)
+  uint8_t signature[64]; ///< 64-byte compact signature (r || s), low-s normalized
+} ecdsa_sign_result_t;
+
+/// Sign a message hash with a secret key.
+///
+/// Nonces are derived deterministically (RFC 6979), so the same inputs always
+/// produce the same signature. Used to build signed test and benchmark inputs.
+///
+/// @param ctx secp256k1 context
+/// @param message_hash 32-byte message hash
+/// @param secret_key 32-byte secret key
+/// @return Result containing success flag, signature and recovery ID
+ecdsa_sign_result_t secp256k1_sign(const secp256k1_ctx_t *ctx, const uint8_t message_hash[32],
+                                   const uint8_t secret_key[32]);
+
+/// Derive the address of a secret key.
+/// @param ctx secp256k1 context
+/// @param secret_key 32-byte secret key
+/// @param out Output address
+/// @return true on success, false if the key is invalid
+bool secp256k1_secret_to_address(const secp256k1_ctx_t *ctx, const uint8_t secret_key[32],
+                                 address_t *out);
+
 #endif // DIV0_CRYPTO_SECP256K1_H
\ No newline at end of file
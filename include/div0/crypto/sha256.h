@@ -0,0 +1,18 @@
+#ifndef DIV0_CRYPTO_SHA256_H
+#define DIV0_CRYPTO_SHA256_H
+
+#include "div0/types/hash.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// Compute SHA-256 hash in a single call (SHA256 precompile, 0x02).
+///
+/// Hosted x86-64 builds use the SHA extensions when the CPU has them
+/// (checked once at runtime); other targets use the portable implementation.
+/// @param data Input data to hash (may be nullptr if len is 0)
+/// @param len Length of data in bytes
+/// @return 256-bit hash
+hash_t sha256(const uint8_t *data, size_t len);
+
+#endif // DIV0_CRYPTO_SHA256_H
@@ -41,6 +41,22 @@ typedef struct {
 tx_decode_result_t transaction_decode(const uint8_t *data, size_t len, transaction_t *tx,
                                       div0_arena_t *arena);
 
+/// Decodes a transaction without copying its calldata.
+///
+/// Like transaction_decode, but tx's data bytes point into `data`, and the
+/// encoded span is retained in tx->encoded. The transaction hash is memoised
+/// from that span while it is hot, and the signing hash is later derived from
+/// it without re-encoding the fields. Access lists, authorizations and blob hashes are
+/// still decoded into the arena (their fields are converted, not copied).
+///
+/// @param data Input RLP data (must outlive tx and stay unmodified; may be read-only)
+/// @param len Length of input data
+/// @param tx Output transaction
+/// @param arena Arena for access lists, authorizations and blob hashes
+/// @return Decode result with error code
+tx_decode_result_t transaction_decode_view(const uint8_t *data, size_t len, transaction_t *tx,
+                                           div0_arena_t *arena);
+
 /// Decodes a legacy transaction from RLP.
 /// @param data Input RLP data (should start with list prefix)
 /// @param len Length of input data
@@ -148,7 +164,9 @@ bytes_t eip7702_tx_encode(const eip7702_tx_t *tx, div0_arena_t *arena);
 // ============================================================================
 
 /// Computes the transaction hash (keccak256 of RLP encoding).
-/// This is the transaction ID used on-chain.
+/// This is the transaction ID used on-chain. Returns the memoised hash if
+/// tx has one; transactions decoded with transaction_decode_view hash their
+/// retained encoding.
 /// @param tx Transaction to hash
 /// @param arena Arena for temporary allocations
 /// @return Transaction hash
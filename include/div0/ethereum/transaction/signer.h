@@ -46,11 +46,20 @@ hash_t eip4844_tx_signing_hash(const eip4844_tx_t *tx, div0_arena_t *arena);
 hash_t eip7702_tx_signing_hash(const eip7702_tx_t *tx, div0_arena_t *arena);
 
 /// Computes the signing hash for any transaction type.
+/// Returns the memoised signing hash if tx has one; transactions decoded with
+/// transaction_decode_view hash the unsigned prefix of their encoding.
 /// @param tx The transaction
 /// @param arena Arena for RLP encoding
 /// @return Signing hash
 hash_t transaction_signing_hash(const transaction_t *tx, div0_arena_t *arena);
 
+/// Memoises the transaction hash and signing hash in tx, so receipts,
+/// rejections and sender recovery reuse them instead of re-encoding.
+/// Invalidated by transaction_clear_cache.
+/// @param tx The transaction
+/// @param arena Arena for temporary RLP encoding (may be rewound afterwards)
+void transaction_cache_hashes(transaction_t *tx, div0_arena_t *arena);
+
 /// Computes the signing hash for an EIP-7702 authorization tuple.
 /// hash(0x05 || rlp([chain_id, address, nonce]))
 /// @param auth The authorization
@@ -11,6 +11,7 @@
 #include "div0/types/uint256.h"
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /// Transaction type enumeration (EIP-2718).
@@ -33,12 +34,29 @@ typedef struct {
     eip4844_tx_t eip4844;
     eip7702_tx_t eip7702;
   };
+  const uint8_t *encoded;   // Encoding it was decoded from (transaction_decode_view), or nullptr
+  size_t encoded_size;      // Size of encoded
+  hash_t hash;              // Memoised transaction_hash (valid if hash_cached)
+  hash_t signing_hash;      // Memoised transaction_signing_hash (valid if signing_hash_cached)
+  bool hash_cached;         // hash is set
+  bool signing_hash_cached; // signing_hash is set
 } transaction_t;
 
+/// Drops the retained encoding and memoised hashes, so they are recomputed
+/// from the fields. Must be called by code that builds a transaction or
+/// modifies a decoded one.
+static inline void transaction_clear_cache(transaction_t *tx) {
+  tx->encoded = nullptr;
+  tx->encoded_size = 0;
+  tx->hash_cached = false;
+  tx->signing_hash_cached = false;
+}
+
 /// Initializes a transaction as a legacy type with zero values.
 static inline void transaction_init(transaction_t *tx) {
   tx->type = TX_TYPE_LEGACY;
   legacy_tx_init(&tx->legacy);
+  transaction_clear_cache(tx);
 }
 
 /// Returns the nonce of the transaction.
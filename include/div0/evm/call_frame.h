@@ -49,6 +49,12 @@ struct call_frame {
   // Jump destination analysis (lazy, set on first JUMP/JUMPI)
   const uint8_t *jumpdest_bitmap; // 1 bit per code byte, nullptr = not analyzed
   hash_t code_hash;               // For cache lookup (set if known)
+
+  // State snapshot taken before the frame started (CREATE/CREATE2 frames)
+  uint64_t snapshot_id;
+
+  // Transient storage journal position at frame start (undone on revert)
+  size_t transient_checkpoint;
 };
 
 typedef struct call_frame call_frame_t;
@@ -73,6 +79,8 @@ static inline void call_frame_reset(call_frame_t *frame) {
   frame->input_size = 0;
   frame->jumpdest_bitmap = nullptr;
   frame->code_hash = hash_zero();
+  frame->snapshot_id = 0;
+  frame->transient_checkpoint = 0;
 }
 
 /// Returns true if the frame is in a static context.
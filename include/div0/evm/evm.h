@@ -1,17 +1,21 @@
 #ifndef DIV0_EVM_EVM_H
 #define DIV0_EVM_EVM_H
 
+#include "div0/crypto/secp256k1.h"
 #include "div0/evm/block_context.h"
 #include "div0/evm/call_frame.h"
 #include "div0/evm/call_frame_pool.h"
 #include "div0/evm/execution_env.h"
 #include "div0/evm/frame_result.h"
-#include "div0/evm/gas/dynamic_costs.h"
+#include "div0/evm/fork.h"
+#include "div0/evm/initcode_cache.h"
 #include "div0/evm/log_vec.h"
 #include "div0/evm/memory_pool.h"
 #include "div0/evm/stack.h"
 #include "div0/evm/stack_pool.h"
 #include "div0/evm/status.h"
+#include "div0/evm/tracer.h"
+#include "div0/evm/transient_storage.h"
 #include "div0/evm/tx_context.h"
 #include "div0/mem/arena.h"
 #include "div0/state/state_access.h"
@@ -20,21 +24,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
-// ============================================================================
-// Fork Configuration
-// ============================================================================
-
-typedef enum {
-  FORK_SHANGHAI = 0,
-  FORK_CANCUN = 1,
-  FORK_PRAGUE = 2,
-  FORK_UNKNOWN = -1,
-} fork_t;
-
 enum { GAS_TABLE_SIZE = 256 };
 
-typedef uint64_t gas_table_t[GAS_TABLE_SIZE];
-
 // ============================================================================
 // EVM Execution API
 // ============================================================================
@@ -57,11 +48,9 @@ typedef struct evm {
   // Fork configuration
   fork_t fork;
 
-  // Gas cost table (indexed by opcode)
-  gas_table_t gas_table;
-
-  // Dynamic gas cost functions (per fork)
-  gas_schedule_t gas_schedule;
+  // Static gas costs of the fork (indexed by opcode, read-only).
+  // The interpreter uses the same table as compile-time constants.
+  const uint64_t *gas_table;
 
   // Resource pools (pre-allocated for zero-allocation execution)
   call_frame_pool_t frame_pool;
@@ -92,6 +81,18 @@ typedef struct evm {
 
   // Log accumulator (reset per transaction)
   evm_log_vec_t logs;
+
+  // TLOAD/TSTORE slots (reset per transaction)
+  transient_storage_t transient_storage;
+
+  // Execution tracer (optional; selects the traced interpreter when set)
+  evm_tracer_t *tracer;
+
+  // ECRECOVER precompile context (optional; non-owning)
+  const secp256k1_ctx_t *secp_ctx;
+
+  // CREATE/CREATE2 init code analyses (optional; non-owning)
+  initcode_cache_t *initcode_cache;
 } evm_t;
 
 /// Initializes an EVM instance with an arena allocator.
@@ -104,6 +105,29 @@ void evm_init(evm_t *evm, div0_arena_t *arena, fork_t fork);
 /// Clears return data and resets pools, but keeps arena.
 void evm_reset(evm_t *evm);
 
+/// Resets the EVM and rewinds its arena to a mark taken between transactions,
+/// releasing the transaction's scratch: stacks, arena-backed frame memory,
+/// jumpdest bitmaps, precompile outputs, return data, logs and the transient
+/// storage table. Buffers the EVM keeps across transactions are dropped with
+/// it. Only valid when the arena holds nothing else that is still in use
+/// (not the world state or results).
+/// @param evm EVM instance
+/// @param mark Checkpoint of evm->arena taken after evm_init
+void evm_rewind(evm_t *evm, div0_arena_mark_t mark);
+
+/// Releases what the arena does not own (mapped frame memory).
+/// Call before discarding an EVM that enabled mapped memory.
+void evm_destroy(evm_t *evm);
+
+/// Gives frames memory backed by reserved zero pages instead of the arena
+/// (hosted Linux), so expansion neither copies nor zero fills. Each call
+/// depth reached keeps its range until evm_destroy.
+/// @param evm EVM instance
+/// @return false if unsupported in this build (memory stays arena-backed)
+static inline bool evm_enable_mapped_memory(evm_t *evm) {
+  return evm_memory_pool_enable_mapping(&evm->memory_pool);
+}
+
 /// Sets the block context for execution.
 /// Call once per block before executing transactions.
 static inline void evm_set_block_context(evm_t *evm, const block_context_t *block) {
@@ -123,6 +147,38 @@ static inline void evm_set_state(evm_t *evm, state_access_t *state) {
   evm->state = state;
 }
 
+/// Attaches a tracer, or detaches it with nullptr.
+/// Executions with a tracer run a separately compiled interpreter that calls
+/// its hooks; without one, the interpreter has no tracing code at all.
+/// @param evm EVM instance
+/// @param tracer Tracer (not owned, must outlive its executions)
+static inline void evm_set_tracer(evm_t *evm, evm_tracer_t *tracer) {
+  evm->tracer = tracer;
+}
+
+/// Sets the secp256k1 context used by the ECRECOVER precompile.
+/// Without one, ECRECOVER charges its gas and returns no data.
+/// @param evm EVM instance
+/// @param ctx secp256k1 context (not owned, must outlive its executions)
+static inline void evm_set_secp_ctx(evm_t *evm, const secp256k1_ctx_t *ctx) {
+  evm->secp_ctx = ctx;
+}
+
+/// Attaches a cache of init code analyses for CREATE/CREATE2, or detaches it
+/// with nullptr. Without one, every deployment analyses its init code afresh.
+/// @param evm EVM instance
+/// @param cache Cache (not owned, must outlive its executions)
+static inline void evm_set_initcode_cache(evm_t *evm, initcode_cache_t *cache) {
+  evm->initcode_cache = cache;
+}
+
+/// Replaces the return data buffer contents (RETURNDATASIZE, RETURNDATACOPY).
+/// Used for precompiled calls, whose output does not live in frame memory.
+/// @param evm EVM instance
+/// @param data Return data (may alias frame memory, not the buffer itself)
+/// @param size Return data size
+void evm_set_return_data(evm_t *evm, const uint8_t *data, size_t size);
+
 /// Executes bytecode with the new call frame architecture.
 /// @param evm Initialized EVM instance
 /// @param env Execution environment (block, tx, call params)
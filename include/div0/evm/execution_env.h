@@ -4,6 +4,7 @@
 #include "div0/evm/block_context.h"
 #include "div0/evm/tx_context.h"
 #include "div0/types/address.h"
+#include "div0/types/hash.h"
 #include "div0/types/uint256.h"
 
 #include <stdbool.h>
@@ -17,6 +18,7 @@ typedef struct {
   uint64_t gas;         // Available gas for execution
   const uint8_t *code;  // Bytecode to execute
   size_t code_size;     // Length of bytecode
+  hash_t code_hash;     // Keccak256 of code, zero if unknown (jumpdest analysis not cached)
   const uint8_t *input; // Calldata (CALLDATALOAD, CALLDATASIZE, CALLDATACOPY)
   size_t input_size;    // Length of calldata
   address_t caller;     // CALLER opcode (0x33) - msg.sender
@@ -30,6 +32,7 @@ static inline void call_params_init(call_params_t *params) {
   params->gas = 0;
   params->code = nullptr;
   params->code_size = 0;
+  params->code_hash = hash_zero();
   params->input = nullptr;
   params->input_size = 0;
   params->caller = address_zero();
@@ -0,0 +1,14 @@
+#ifndef DIV0_EVM_FORK_H
+#define DIV0_EVM_FORK_H
+
+/// Supported hard forks.
+/// The interpreter is compiled once per fork; evm_execute_env() picks the
+/// instance matching evm_t.fork.
+typedef enum {
+  FORK_SHANGHAI = 0,
+  FORK_CANCUN = 1,
+  FORK_PRAGUE = 2,
+  FORK_UNKNOWN = -1,
+} fork_t;
+
+#endif // DIV0_EVM_FORK_H
@@ -83,6 +83,9 @@ static constexpr uint64_t GAS_SSTORE_CLEAR_REFUND = 4800;
 /// CREATE gas.
 static constexpr uint64_t GAS_CREATE = 32000;
 
+/// Gas per word of init code (EIP-3860).
+static constexpr uint64_t GAS_INITCODE_WORD = 2;
+
 /// Gas per byte for contract code storage.
 static constexpr uint64_t GAS_CODE_DEPOSIT_PER_BYTE = 200;
 
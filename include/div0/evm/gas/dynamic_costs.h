@@ -7,25 +7,6 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-// =============================================================================
-// Gas Cost Function Types
-// =============================================================================
-
-typedef uint64_t (*sload_cost_fn_t)(bool is_cold);
-
-typedef uint64_t (*sstore_cost_fn_t)(bool is_cold, uint256_t current_value,
-                                     uint256_t original_value, uint256_t new_value);
-
-typedef int64_t (*sstore_refund_fn_t)(uint256_t current_value, uint256_t original_value,
-                                      uint256_t new_value);
-
-typedef struct {
-  sload_cost_fn_t sload;
-  sstore_cost_fn_t sstore;
-  sstore_refund_fn_t sstore_refund;
-  uint64_t sstore_min_gas;
-} gas_schedule_t;
-
 // =============================================================================
 // Shanghai Gas Functions (EIP-2929 + EIP-2200)
 // =============================================================================
@@ -90,29 +71,34 @@ static inline int64_t sstore_refund_shanghai(uint256_t current_value, uint256_t
   return refund;
 }
 
-static inline gas_schedule_t gas_schedule_shanghai(void) {
-  return (gas_schedule_t){
-      .sload = sload_cost_shanghai,
-      .sstore = sstore_cost_shanghai,
-      .sstore_refund = sstore_refund_shanghai,
-      .sstore_min_gas = GAS_CALL_STIPEND,
-  };
-}
-
 // =============================================================================
-// Cancun Gas Functions
+// Current Schedule
 // =============================================================================
+//
+// The storage schedule is unchanged from Shanghai through Prague, so opcode
+// handlers call these without a fork. A fork that changes a schedule adds a
+// fork parameter here, which the per-fork interpreters pass as a constant.
+
+/// SLOAD cost.
+static inline uint64_t gas_sload(const bool is_cold) {
+  return sload_cost_shanghai(is_cold);
+}
 
-static inline gas_schedule_t gas_schedule_cancun(void) {
-  return gas_schedule_shanghai();
+/// SSTORE cost.
+static inline uint64_t gas_sstore(const bool is_cold, const uint256_t current_value,
+                                  const uint256_t original_value, const uint256_t new_value) {
+  return sstore_cost_shanghai(is_cold, current_value, original_value, new_value);
 }
 
-// =============================================================================
-// Prague Gas Functions
-// =============================================================================
+/// SSTORE refund delta.
+static inline int64_t gas_sstore_refund(const uint256_t current_value,
+                                        const uint256_t original_value, const uint256_t new_value) {
+  return sstore_refund_shanghai(current_value, original_value, new_value);
+}
 
-static inline gas_schedule_t gas_schedule_prague(void) {
-  return gas_schedule_cancun();
+/// Gas that must remain for SSTORE to proceed (EIP-2200 sentry).
+static inline uint64_t gas_sstore_sentry(void) {
+  return GAS_CALL_STIPEND;
 }
 
 #endif // DIV0_EVM_GAS_DYNAMIC_COSTS_H
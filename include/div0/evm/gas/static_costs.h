@@ -6,154 +6,173 @@
 
 #include <stdint.h>
 
-static inline void gas_table_init_shanghai(gas_table_t table) {
-  for (int i = 0; i < GAS_TABLE_SIZE; i++) {
-    table[i] = 0;
-  }
-
-  // Arithmetic opcodes
-  table[OP_ADD] = 3;
-  table[OP_MUL] = 5;
-  table[OP_SUB] = 3;
-  table[OP_DIV] = 5;
-  table[OP_SDIV] = 5;
-  table[OP_MOD] = 5;
-  table[OP_SMOD] = 5;
-  table[OP_ADDMOD] = 8;
-  table[OP_MULMOD] = 8;
-  table[OP_SIGNEXTEND] = 5;
-
-  // Comparison opcodes
-  table[OP_LT] = 3;
-  table[OP_GT] = 3;
-  table[OP_SLT] = 3;
-  table[OP_SGT] = 3;
-  table[OP_EQ] = 3;
-  table[OP_ISZERO] = 3;
-
-  // Bitwise opcodes
-  table[OP_AND] = 3;
-  table[OP_OR] = 3;
-  table[OP_XOR] = 3;
-  table[OP_NOT] = 3;
-  table[OP_BYTE] = 3;
-  table[OP_SHL] = 3;
-  table[OP_SHR] = 3;
-  table[OP_SAR] = 3;
-
-  // Keccak256 - base cost only, word cost is dynamic
-  table[OP_KECCAK256] = 30;
-
-  // Memory opcodes - static portion only
-  table[OP_MLOAD] = 3;
-  table[OP_MSTORE] = 3;
-  table[OP_MSTORE8] = 3;
-  table[OP_MSIZE] = 2;
-
-  // Context opcodes
-  table[OP_ADDRESS] = 2;
-  table[OP_ORIGIN] = 2;
-  table[OP_CALLER] = 2;
-  table[OP_CALLVALUE] = 2;
-  table[OP_CALLDATALOAD] = 3;
-  table[OP_CALLDATASIZE] = 2;
-  table[OP_CALLDATACOPY] = 3;
-  table[OP_CODESIZE] = 2;
-  table[OP_CODECOPY] = 3;
-  table[OP_GASPRICE] = 2;
-  table[OP_RETURNDATASIZE] = 2;
-  table[OP_RETURNDATACOPY] = 3;
-
-  // Control flow opcodes
-  table[OP_POP] = 2;
-  table[OP_PC] = 2;
-  table[OP_GAS] = 2;
-  table[OP_JUMP] = 8;
-  table[OP_JUMPI] = 10;
-  table[OP_JUMPDEST] = 1;
-
-  // Stack opcodes - PUSH0
-  table[OP_PUSH0] = 2;
-
-  // Stack opcodes - PUSH1-32
-  table[OP_PUSH1] = 3;
-  table[OP_PUSH2] = 3;
-  table[OP_PUSH3] = 3;
-  table[OP_PUSH4] = 3;
-  table[OP_PUSH5] = 3;
-  table[OP_PUSH6] = 3;
-  table[OP_PUSH7] = 3;
-  table[OP_PUSH8] = 3;
-  table[OP_PUSH9] = 3;
-  table[OP_PUSH10] = 3;
-  table[OP_PUSH11] = 3;
-  table[OP_PUSH12] = 3;
-  table[OP_PUSH13] = 3;
-  table[OP_PUSH14] = 3;
-  table[OP_PUSH15] = 3;
-  table[OP_PUSH16] = 3;
-  table[OP_PUSH17] = 3;
-  table[OP_PUSH18] = 3;
-  table[OP_PUSH19] = 3;
-  table[OP_PUSH20] = 3;
-  table[OP_PUSH21] = 3;
-  table[OP_PUSH22] = 3;
-  table[OP_PUSH23] = 3;
-  table[OP_PUSH24] = 3;
-  table[OP_PUSH25] = 3;
-  table[OP_PUSH26] = 3;
-  table[OP_PUSH27] = 3;
-  table[OP_PUSH28] = 3;
-  table[OP_PUSH29] = 3;
-  table[OP_PUSH30] = 3;
-  table[OP_PUSH31] = 3;
-  table[OP_PUSH32] = 3;
-
-  // DUP opcodes
-  table[OP_DUP1] = 3;
-  table[OP_DUP2] = 3;
-  table[OP_DUP3] = 3;
-  table[OP_DUP4] = 3;
-  table[OP_DUP5] = 3;
-  table[OP_DUP6] = 3;
-  table[OP_DUP7] = 3;
-  table[OP_DUP8] = 3;
-  table[OP_DUP9] = 3;
-  table[OP_DUP10] = 3;
-  table[OP_DUP11] = 3;
-  table[OP_DUP12] = 3;
-  table[OP_DUP13] = 3;
-  table[OP_DUP14] = 3;
-  table[OP_DUP15] = 3;
-  table[OP_DUP16] = 3;
-
-  // SWAP opcodes
-  table[OP_SWAP1] = 3;
-  table[OP_SWAP2] = 3;
-  table[OP_SWAP3] = 3;
-  table[OP_SWAP4] = 3;
-  table[OP_SWAP5] = 3;
-  table[OP_SWAP6] = 3;
-  table[OP_SWAP7] = 3;
-  table[OP_SWAP8] = 3;
-  table[OP_SWAP9] = 3;
-  table[OP_SWAP10] = 3;
-  table[OP_SWAP11] = 3;
-  table[OP_SWAP12] = 3;
-  table[OP_SWAP13] = 3;
-  table[OP_SWAP14] = 3;
-  table[OP_SWAP15] = 3;
-  table[OP_SWAP16] = 3;
-}
-
-static inline void gas_table_init_cancun(gas_table_t table) {
-  gas_table_init_shanghai(table);
-  // Cancun-specific changes go here
-}
-
-static inline void gas_table_init_prague(gas_table_t table) {
-  gas_table_init_cancun(table);
-  // Prague-specific changes go here
-}
+/// Static gas costs per fork, indexed by opcode.
+/// These are constexpr so the per-fork interpreters fold every lookup into an
+/// immediate. Opcodes without an entry cost 0 here: they are either invalid in
+/// the fork or charge their full cost dynamically (EXP, SLOAD, CALL, ...).
+
+/// Entries shared by Shanghai and later forks.
+#define GAS_TABLE_SHANGHAI_ENTRIES                                            \
+  /* Arithmetic opcodes */                                                    \
+  [OP_ADD] = 3,                                                               \
+  [OP_MUL] = 5,                                                               \
+  [OP_SUB] = 3,                                                               \
+  [OP_DIV] = 5,                                                               \
+  [OP_SDIV] = 5,                                                              \
+  [OP_MOD] = 5,                                                               \
+  [OP_SMOD] = 5,                                                              \
+  [OP_ADDMOD] = 8,                                                            \
+  [OP_MULMOD] = 8,                                                            \
+  [OP_SIGNEXTEND] = 5,                                                        \
+                                                                              \
+  /* Comparison opcodes */                                                    \
+  [OP_LT] = 3,                                                                \
+  [OP_GT] = 3,                                                                \
+  [OP_SLT] = 3,                                                               \
+  [OP_SGT] = 3,                                                               \
+  [OP_EQ] = 3,                                                                \
+  [OP_ISZERO] = 3,                                                            \
+                                                                              \
+  /* Bitwise opcodes */                                                       \
+  [OP_AND] = 3,                                                               \
+  [OP_OR] = 3,                                                                \
+  [OP_XOR] = 3,                                                               \
+  [OP_NOT] = 3,                                                               \
+  [OP_BYTE] = 3,                                                              \
+  [OP_SHL] = 3,                                                               \
+  [OP_SHR] = 3,                                                               \
+  [OP_SAR] = 3,                                                               \
+                                                                              \
+  /* Keccak256 - base cost only, word cost is dynamic */                      \
+  [OP_KECCAK256] = 30,                                                        \
+                                                                              \
+  /* Memory opcodes - static portion only */                                  \
+  [OP_MLOAD] = 3,                                                             \
+  [OP_MSTORE] = 3,                                                            \
+  [OP_MSTORE8] = 3,                                                           \
+  [OP_MSIZE] = 2,                                                             \
+                                                                              \
+  /* Context opcodes */                                                       \
+  [OP_ADDRESS] = 2,                                                           \
+  [OP_ORIGIN] = 2,                                                            \
+  [OP_CALLER] = 2,                                                            \
+  [OP_CALLVALUE] = 2,                                                         \
+  [OP_CALLDATALOAD] = 3,                                                      \
+  [OP_CALLDATASIZE] = 2,                                                      \
+  [OP_CALLDATACOPY] = 3,                                                      \
+  [OP_CODESIZE] = 2,                                                          \
+  [OP_CODECOPY] = 3,                                                          \
+  [OP_GASPRICE] = 2,                                                          \
+  [OP_RETURNDATASIZE] = 2,                                                    \
+  [OP_RETURNDATACOPY] = 3,                                                    \
+                                                                              \
+  /* Block information opcodes */                                             \
+  [OP_BLOCKHASH] = 20,                                                        \
+  [OP_COINBASE] = 2,                                                          \
+  [OP_TIMESTAMP] = 2,                                                         \
+  [OP_NUMBER] = 2,                                                            \
+  [OP_PREVRANDAO] = 2,                                                        \
+  [OP_GASLIMIT] = 2,                                                          \
+  [OP_CHAINID] = 2,                                                           \
+  [OP_SELFBALANCE] = 5,                                                       \
+  [OP_BASEFEE] = 2,                                                           \
+                                                                              \
+  /* Control flow opcodes */                                                  \
+  [OP_POP] = 2,                                                               \
+  [OP_PC] = 2,                                                                \
+  [OP_GAS] = 2,                                                               \
+  [OP_JUMP] = 8,                                                              \
+  [OP_JUMPI] = 10,                                                            \
+  [OP_JUMPDEST] = 1,                                                          \
+                                                                              \
+  /* Stack opcodes - PUSH0 */                                                 \
+  [OP_PUSH0] = 2,                                                             \
+                                                                              \
+  /* Stack opcodes - PUSH1-32 */                                              \
+  [OP_PUSH1] = 3,                                                             \
+  [OP_PUSH2] = 3,                                                             \
+  [OP_PUSH3] = 3,                                                             \
+  [OP_PUSH4] = 3,                                                             \
+  [OP_PUSH5] = 3,                                                             \
+  [OP_PUSH6] = 3,                                                             \
+  [OP_PUSH7] = 3,                                                             \
+  [OP_PUSH8] = 3,                                                             \
+  [OP_PUSH9] = 3,                                                             \
+  [OP_PUSH10] = 3,                                                            \
+  [OP_PUSH11] = 3,                                                            \
+  [OP_PUSH12] = 3,                                                            \
+  [OP_PUSH13] = 3,                                                            \
+  [OP_PUSH14] = 3,                                                            \
+  [OP_PUSH15] = 3,                                                            \
+  [OP_PUSH16] = 3,                                                            \
+  [OP_PUSH17] = 3,                                                            \
+  [OP_PUSH18] = 3,                                                            \
+  [OP_PUSH19] = 3,                                                            \
+  [OP_PUSH20] = 3,                                                            \
+  [OP_PUSH21] = 3,                                                            \
+  [OP_PUSH22] = 3,                                                            \
+  [OP_PUSH23] = 3,                                                            \
+  [OP_PUSH24] = 3,                                                            \
+  [OP_PUSH25] = 3,                                                            \
+  [OP_PUSH26] = 3,                                                            \
+  [OP_PUSH27] = 3,                                                            \
+  [OP_PUSH28] = 3,                                                            \
+  [OP_PUSH29] = 3,                                                            \
+  [OP_PUSH30] = 3,                                                            \
+  [OP_PUSH31] = 3,                                                            \
+  [OP_PUSH32] = 3,                                                            \
+                                                                              \
+  /* DUP opcodes */                                                           \
+  [OP_DUP1] = 3,                                                              \
+  [OP_DUP2] = 3,                                                              \
+  [OP_DUP3] = 3,                                                              \
+  [OP_DUP4] = 3,                                                              \
+  [OP_DUP5] = 3,                                                              \
+  [OP_DUP6] = 3,                                                              \
+  [OP_DUP7] = 3,                                                              \
+  [OP_DUP8] = 3,                                                              \
+  [OP_DUP9] = 3,                                                              \
+  [OP_DUP10] = 3,                                                             \
+  [OP_DUP11] = 3,                                                             \
+  [OP_DUP12] = 3,                                                             \
+  [OP_DUP13] = 3,                                                             \
+  [OP_DUP14] = 3,                                                             \
+  [OP_DUP15] = 3,                                                             \
+  [OP_DUP16] = 3,                                                             \
+                                                                              \
+  /* SWAP opcodes */                                                          \
+  [OP_SWAP1] = 3,                                                             \
+  [OP_SWAP2] = 3,                                                             \
+  [OP_SWAP3] = 3,                                                             \
+  [OP_SWAP4] = 3,                                                             \
+  [OP_SWAP5] = 3,                                                             \
+  [OP_SWAP6] = 3,                                                             \
+  [OP_SWAP7] = 3,                                                             \
+  [OP_SWAP8] = 3,                                                             \
+  [OP_SWAP9] = 3,                                                             \
+  [OP_SWAP10] = 3,                                                            \
+  [OP_SWAP11] = 3,                                                            \
+  [OP_SWAP12] = 3,                                                            \
+  [OP_SWAP13] = 3,                                                            \
+  [OP_SWAP14] = 3,                                                            \
+  [OP_SWAP15] = 3,                                                            \
+  [OP_SWAP16] = 3
+
+static constexpr uint64_t GAS_TABLE_SHANGHAI[GAS_TABLE_SIZE] = {GAS_TABLE_SHANGHAI_ENTRIES};
+
+/// Cancun adds TLOAD/TSTORE (EIP-1153), MCOPY (EIP-5656), BLOBHASH (EIP-4844) and
+/// BLOBBASEFEE (EIP-7516).
+#define GAS_TABLE_CANCUN_ENTRIES                                              \
+  GAS_TABLE_SHANGHAI_ENTRIES,                                                 \
+  [OP_TLOAD] = 100,                                                           \
+  [OP_TSTORE] = 100,                                                          \
+  [OP_MCOPY] = 3,                                                             \
+  [OP_BLOBHASH] = 3,                                                          \
+  [OP_BLOBBASEFEE] = 2
+
+static constexpr uint64_t GAS_TABLE_CANCUN[GAS_TABLE_SIZE] = {GAS_TABLE_CANCUN_ENTRIES};
+
+/// Prague leaves the static costs of existing opcodes unchanged.
+static constexpr uint64_t GAS_TABLE_PRAGUE[GAS_TABLE_SIZE] = {GAS_TABLE_CANCUN_ENTRIES};
 
 #endif // DIV0_EVM_GAS_STATIC_COSTS_H
@@ -0,0 +1,60 @@
+#ifndef DIV0_EVM_INITCODE_CACHE_H
+#define DIV0_EVM_INITCODE_CACHE_H
+
+#include "div0/mem/arena.h"
+#include "div0/types/hash.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Init code analysis cache for CREATE/CREATE2.
+///
+/// Factories deploy the same init code over and over. Entries are keyed by
+/// the init code bytes themselves (a fast fingerprint, confirmed with a byte
+/// comparison), so a repeated deployment finds its jumpdest bitmap and, for
+/// CREATE2, its Keccak-256 hash without re-analysing or re-hashing the code.
+/// Code and bitmaps are copied into the cache's own arena, so the cache can
+/// outlive individual executions. Attach it with evm_set_initcode_cache().
+
+/// Cache entry (open addressing; a null code pointer marks an empty slot).
+typedef struct {
+  uint64_t fingerprint;           // Fast hash of the init code
+  const uint8_t *code;            // Cached copy of the init code
+  size_t code_size;               // Init code size (non-zero)
+  const uint8_t *jumpdest_bitmap; // Jumpdest analysis of code
+  hash_t code_hash;               // Keccak-256 of code (valid if has_code_hash)
+  bool has_code_hash;             // Set on first CREATE2 of this code
+} initcode_cache_entry_t;
+
+/// Init code analysis cache.
+typedef struct {
+  initcode_cache_entry_t *entries; // Capacity is a power of two
+  size_t capacity;
+  size_t count;
+  size_t size;         // Bytes taken from the arena (tables, code and bitmaps)
+  div0_arena_t *arena; // Backs entries, code copies and bitmaps
+} initcode_cache_t;
+
+/// Initialize an empty cache.
+/// The cache only grows. To bound it, reset its arena once size exceeds a
+/// budget (while no entry from it is in use) and initialize it again.
+/// @param cache Cache to initialize
+/// @param arena Arena for entries, code and bitmaps (must outlive the cache)
+/// @return true on success, false on allocation failure
+[[nodiscard]] bool initcode_cache_init(initcode_cache_t *cache, div0_arena_t *arena);
+
+/// Find the entry for an init code, analysing and inserting it on a miss.
+/// @param cache Cache
+/// @param code Init code (non-empty)
+/// @param code_size Init code size
+/// @return Entry, or nullptr on allocation failure
+[[nodiscard]] initcode_cache_entry_t *initcode_cache_lookup(initcode_cache_t *cache,
+                                                            const uint8_t *code, size_t code_size);
+
+/// Keccak-256 of an entry's init code, computed on first use.
+/// @param entry Entry from initcode_cache_lookup
+/// @return Code hash
+[[nodiscard]] const hash_t *initcode_cache_code_hash(initcode_cache_entry_t *entry);
+
+#endif // DIV0_EVM_INITCODE_CACHE_H
@@ -0,0 +1,45 @@
+#ifndef DIV0_EVM_JSON_TRACER_H
+#define DIV0_EVM_JSON_TRACER_H
+
+/// @file json_tracer.h
+/// @brief EIP-3155 JSON trace streamer.
+///
+/// Writes one JSON object per executed opcode, followed by a summary line with
+/// the output and gas used when the root frame exits. A step is buffered until
+/// its gas cost is known (the next step of the same frame, a call into a child
+/// frame, or the frame's exit), so only one line is held at a time.
+/// Only available in hosted builds.
+
+#ifndef DIV0_FREESTANDING
+
+#include "div0/evm/tracer.h"
+#include "div0/mem/arena.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/// EIP-3155 streaming tracer.
+typedef struct {
+  evm_tracer_t base;     // vtable (must be first for casting)
+  FILE *out;             // Destination stream (not owned)
+  char *line;            // Rendered pending step without its gasCost
+  size_t line_capacity;  // Size of line buffer
+  size_t split;          // Offset in line where gasCost is inserted
+  size_t line_len;       // Length of the rendered pending step
+  uint64_t pending_gas;  // Gas before the pending step
+  bool pending;          // A rendered step awaits its cost
+  uint64_t root_gas;     // Gas the root frame started with
+} evm_json_tracer_t;
+
+/// Initialize a JSON tracer.
+/// @param tracer Tracer to initialize
+/// @param out Destination stream
+/// @param arena Arena for the line buffer (sized for a full stack)
+/// @return true on success, false on allocation failure
+[[nodiscard]] bool evm_json_tracer_init(evm_json_tracer_t *tracer, FILE *out, div0_arena_t *arena);
+
+#endif // DIV0_FREESTANDING
+
+#endif // DIV0_EVM_JSON_TRACER_H
@@ -12,35 +12,92 @@
 /// Initial memory capacity (1 KB).
 static constexpr size_t EVM_MEMORY_INITIAL_CAPACITY = 1024;
 
+/// Copies and zero fills of at least this many bytes bypass the cache with
+/// non-temporal stores (hosted x86-64 only). Smaller ones use memcpy/memset.
+static constexpr size_t EVM_MEMORY_STREAM_THRESHOLD = (size_t)256 * 1024;
+
+// Mapped memory needs anonymous mmap and a 64-bit address space to reserve
+// a large range per frame. Other builds only have the arena path.
+#if !defined(DIV0_FREESTANDING) && defined(__linux__) && SIZE_MAX > UINT32_MAX
+#define EVM_MEMORY_MAPPED 1
+#endif
+
+/// Address range reserved per frame in mapped mode (32 MB). Expanding memory
+/// this far costs over 2 billion gas, so only a gas limit far beyond any block
+/// reaches it; larger memories move to the arena.
+static constexpr size_t EVM_MEMORY_RESERVATION = (size_t)32 * 1024 * 1024;
+
+/// Mapped memories that grew to at least this many bytes give their pages back
+/// with madvise when reset; smaller ones are cleared with memset, which is
+/// cheaper than the syscall and the page faults that follow it.
+static constexpr size_t EVM_MEMORY_RECYCLE_THRESHOLD = (size_t)64 * 1024;
+
 /// EVM linear memory.
 /// Byte-addressable, grows in 32-byte words.
 /// Memory expansion is charged gas according to EIP-150.
+///
+/// Memory is either arena-backed (grown by allocate, copy and zero fill) or
+/// mapped: data points into a reserved range of zero pages, so expansion only
+/// moves size. Bytes of a mapped range past size are always zero.
 typedef struct {
   uint8_t *data;       // Memory buffer
   size_t size;         // Current size (always multiple of 32)
   size_t capacity;     // Allocated capacity
   div0_arena_t *arena; // Backing allocator
+  uint8_t *mapping;    // Reserved range (mapped mode), nullptr for arena-backed memory
 } evm_memory_t;
 
 /// Initializes EVM memory with an arena allocator.
 void evm_memory_init(evm_memory_t *mem, div0_arena_t *arena);
 
 /// Resets memory to empty state (keeps arena reference).
+/// Mapped memory keeps its range and zeroes the bytes that were used.
 void evm_memory_reset(evm_memory_t *mem);
 
+/// Switches empty memory to mapped mode by reserving EVM_MEMORY_RESERVATION
+/// bytes of zero pages (mmap with MAP_NORESERVE: nothing is committed until
+/// touched). The range must be released with evm_memory_unmap.
+/// @param mem Memory, freshly initialized or reset
+/// @return true if mapped, false if unsupported or the reservation failed
+///         (memory stays arena-backed)
+[[nodiscard]] bool evm_memory_map(evm_memory_t *mem);
+
+/// Releases the range reserved by evm_memory_map (no-op for arena-backed memory).
+/// Memory is left empty and arena-backed.
+void evm_memory_unmap(evm_memory_t *mem);
+
 /// Calculates memory expansion gas cost.
 /// @param current_words Current memory size in 32-byte words
 /// @param new_words New required memory size in 32-byte words
-/// @return Gas cost for expansion (0 if no expansion needed)
+/// @return Gas cost for expansion (0 if no expansion needed, UINT64_MAX if it
+///         does not fit in 64 bits)
 uint64_t evm_memory_expansion_cost(size_t current_words, size_t new_words);
 
 /// Ensures memory is expanded to cover [offset, offset + size).
+/// The cost is checked against gas_limit before anything is allocated, so an
+/// unaffordable offset fails without touching memory.
 /// @param mem Memory to expand
 /// @param offset Start offset
 /// @param size Number of bytes needed
+/// @param gas_limit Gas available to pay for the expansion (usually the frame's gas)
+/// @param gas_cost Output gas cost for expansion (0 if no expansion needed)
+/// @return true if successful, false if the cost exceeds gas_limit, on
+///         overflow or on allocation failure
+bool evm_memory_expand(evm_memory_t *mem, size_t offset, size_t size, uint64_t gas_limit,
+                       uint64_t *gas_cost);
+
+/// Like evm_memory_expand, for callers that write every byte of
+/// [offset, offset + size) before memory is next read. Only the new bytes
+/// outside that range are zeroed, so a copy into fresh memory writes it once.
+/// @param mem Memory to expand
+/// @param offset Start offset
+/// @param size Number of bytes the caller will write
+/// @param gas_limit Gas available to pay for the expansion (usually the frame's gas)
 /// @param gas_cost Output gas cost for expansion (0 if no expansion needed)
-/// @return true if successful, false on allocation failure
-bool evm_memory_expand(evm_memory_t *mem, size_t offset, size_t size, uint64_t *gas_cost);
+/// @return true if successful, false if the cost exceeds gas_limit, on
+///         overflow or on allocation failure
+bool evm_memory_expand_for_write(evm_memory_t *mem, size_t offset, size_t size,
+                                 uint64_t gas_limit, uint64_t *gas_cost);
 
 /// Returns current memory size in bytes (MSIZE opcode).
 static inline size_t evm_memory_size(const evm_memory_t *mem) {
@@ -89,9 +146,19 @@ static inline const uint8_t *evm_memory_ptr_unsafe(const evm_memory_t *mem, size
 /// Copies data within memory (for MCOPY opcode, EIP-5656).
 /// Handles overlapping regions correctly.
 /// Caller must ensure memory is already expanded.
-static inline void evm_memory_copy_unsafe(evm_memory_t *mem, size_t dest, size_t src, size_t len) {
-  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
-  memmove(mem->data + dest, mem->data + src, len);
-}
+void evm_memory_copy_unsafe(evm_memory_t *mem, size_t dest, size_t src, size_t len);
+
+/// Copies size bytes of an external buffer into memory, reading zeros past
+/// its end (CALLDATACOPY, CODECOPY, EXTCODECOPY, RETURNDATACOPY).
+/// The available bytes are copied and the remainder zero-filled in one call.
+/// Caller must ensure memory is already expanded.
+/// @param mem Memory
+/// @param dest Destination offset in memory
+/// @param src Source buffer (may be nullptr if src_size is 0)
+/// @param src_size Source buffer size
+/// @param src_offset Offset into the source (any value; past the end reads zeros)
+/// @param size Number of bytes to write
+void evm_memory_copy_padded_unsafe(evm_memory_t *mem, size_t dest, const uint8_t *src,
+                                   size_t src_size, uint64_t src_offset, size_t size);
 
 #endif // DIV0_EVM_MEMORY_H
@@ -5,6 +5,7 @@
 #include "div0/mem/arena.h"
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 
 /// Maximum call depth (matches EVM spec).
@@ -12,19 +13,52 @@
 
 /// Pool of EVM memory buffers for nested calls.
 /// Pre-allocates memory structures to avoid allocation during execution.
+///
+/// With mapping enabled, each depth reserves its range of zero pages the first
+/// time it is borrowed and keeps it for later frames at that depth, so a
+/// frame's memory grows without copying or zero filling. Such a pool must be
+/// released with evm_memory_pool_destroy.
 typedef struct {
   evm_memory_t memories[EVM_MAX_CALL_DEPTH];
   size_t depth;
   div0_arena_t *arena;
+  bool map;      // Reserve mapped memory for newly reached depths
+  size_t mapped; // Depths [0, mapped) hold a mapped memory
 } evm_memory_pool_t;
 
 /// Initializes the memory pool with an arena allocator.
 static inline void evm_memory_pool_init(evm_memory_pool_t *pool, div0_arena_t *arena) {
   pool->depth = 0;
   pool->arena = arena;
+  pool->map = false;
+  pool->mapped = 0;
   // Note: memory structs are initialized lazily when borrowed
 }
 
+/// Enables mapped memory for depths borrowed from now on.
+/// @param pool The memory pool
+/// @return false if this build has no mapped memory (the pool stays arena-backed)
+static inline bool evm_memory_pool_enable_mapping(evm_memory_pool_t *pool) {
+#ifdef EVM_MEMORY_MAPPED
+  pool->map = true;
+  return true;
+#else
+  (void)pool;
+  return false;
+#endif
+}
+
+/// Releases the mapped memories (arena-backed ones need no cleanup).
+/// @param pool The memory pool
+static inline void evm_memory_pool_destroy(evm_memory_pool_t *pool) {
+  for (size_t i = 0; i < pool->mapped; i++) {
+    evm_memory_unmap(&pool->memories[i]);
+  }
+  pool->mapped = 0;
+  pool->map = false;
+  pool->depth = 0;
+}
+
 /// Borrows a memory buffer from the pool.
 /// @param pool The memory pool
 /// @return Pointer to a fresh memory buffer, or nullptr if max depth exceeded
@@ -34,8 +68,18 @@ static inline evm_memory_t *evm_memory_pool_borrow(evm_memory_pool_t *pool) {
     return nullptr;
   }
 
-  evm_memory_t *mem = &pool->memories[pool->depth++];
-  evm_memory_init(mem, pool->arena);
+  evm_memory_t *mem = &pool->memories[pool->depth];
+  if (pool->depth < pool->mapped) {
+    // Keeps its range; also clears a frame abandoned by evm_reset
+    evm_memory_reset(mem);
+  } else {
+    evm_memory_init(mem, pool->arena);
+    // Only the first unmapped depth maps, so mapped depths stay contiguous
+    if (pool->map && pool->depth == pool->mapped && evm_memory_map(mem)) {
+      pool->mapped++;
+    }
+  }
+  pool->depth++;
   return mem;
 }
 
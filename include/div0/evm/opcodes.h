@@ -1,6 +1,8 @@
 #ifndef DIV0_EVM_OPCODES_H
 #define DIV0_EVM_OPCODES_H
 
+#include <stdint.h>
+
 /// EVM Opcodes
 /// See https://www.evm.codes/ for reference
 
@@ -175,4 +177,9 @@ constexpr auto OP_REVERT = 0xFD;
 constexpr auto OP_INVALID = 0xFE;
 constexpr auto OP_SELFDESTRUCT = 0xFF;
 
+/// Mnemonic of an opcode (e.g. "PUSH1"), or "UNKNOWN" for undefined opcodes.
+/// @param opcode Opcode byte
+/// @return Static string
+const char *evm_opcode_name(uint8_t opcode);
+
 #endif // DIV0_EVM_OPCODES_H
\ No newline at end of file
@@ -60,4 +60,18 @@ call_op_result_t op_delegatecall(evm_t *evm, call_frame_t *frame);
 /// @return Call operation result
 call_op_result_t op_callcode(evm_t *evm, call_frame_t *frame);
 
+/// Execute CREATE opcode.
+/// Stack: [value, offset, size] => [address]
+/// @param evm EVM instance
+/// @param frame Current call frame
+/// @return Call operation result (should_call: init code frame ready)
+call_op_result_t op_create(evm_t *evm, call_frame_t *frame);
+
+/// Execute CREATE2 opcode.
+/// Stack: [value, offset, size, salt] => [address]
+/// @param evm EVM instance
+/// @param frame Current call frame
+/// @return Call operation result (should_call: init code frame ready)
+call_op_result_t op_create2(evm_t *evm, call_frame_t *frame);
+
 #endif // DIV0_EVM_OPCODES_CALL_H
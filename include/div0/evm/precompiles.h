@@ -0,0 +1,51 @@
+#ifndef DIV0_EVM_PRECOMPILES_H
+#define DIV0_EVM_PRECOMPILES_H
+
+#include "div0/crypto/secp256k1.h"
+#include "div0/evm/fork.h"
+#include "div0/mem/arena.h"
+#include "div0/types/address.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// =============================================================================
+// Precompiled Contracts
+// =============================================================================
+
+/// Input to a precompiled contract.
+typedef struct {
+  const uint8_t *input;            // Call data
+  size_t input_size;               // Call data size
+  uint64_t gas;                    // Gas available to the call
+  div0_arena_t *arena;             // Output and scratch allocator
+  const secp256k1_ctx_t *secp_ctx; // ECRECOVER context (nullptr: ECRECOVER returns empty)
+} precompile_input_t;
+
+/// Output of a precompiled contract.
+typedef struct {
+  uint64_t gas_used;     // Gas charged
+  const uint8_t *output; // Return data (inline_output, the input, or arena memory)
+  size_t output_size;    // Return data size
+  uint8_t inline_output[64];
+} precompile_output_t;
+
+/// Precompiled contract implementation.
+/// @param in Call input
+/// @param out Output (gas_used and return data on success)
+/// @return false on failure (out of gas or invalid input): all call gas is consumed
+typedef bool (*precompile_fn_t)(const precompile_input_t *in, precompile_output_t *out);
+
+/// Look up the precompile at an address for a fork.
+/// @param fork Active fork
+/// @param addr Call target
+/// @return Implementation, or nullptr if addr is not a precompile in this fork.
+/// Active addresses without a native implementation get one that always fails.
+precompile_fn_t precompile_get(fork_t fork, const address_t *addr);
+
+/// Number of precompile addresses active in a fork (0x01 through this value).
+/// These are warm from the start of every transaction (EIP-2929).
+uint8_t precompile_count(fork_t fork);
+
+#endif // DIV0_EVM_PRECOMPILES_H
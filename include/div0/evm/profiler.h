@@ -0,0 +1,109 @@
+#ifndef DIV0_EVM_PROFILER_H
+#define DIV0_EVM_PROFILER_H
+
+/// @file profiler.h
+/// @brief Per-opcode and per-contract execution profiler.
+///
+/// A tracer that reads the monotonic clock at every opcode and charges the time
+/// and gas until the next opcode of the same frame to the opcode. Child frames
+/// are charged to their own opcodes, so a CALL only carries its own overhead.
+///
+/// Two aggregations are kept:
+/// - per (code hash, opcode): counts, gas and nanoseconds
+/// - per call stack of addresses and opcode, written as collapsed stacks
+///   ("0xaaaa;0xbbbb;SSTORE 1234") for flamegraph tools
+///
+/// The reported time includes the cost of the clock reads themselves; see
+/// benchmarks/profiler_bench.c for the overhead against untraced execution.
+/// Only available in hosted builds.
+
+#ifndef DIV0_FREESTANDING
+
+#include "div0/evm/tracer.h"
+#include "div0/mem/arena.h"
+#include "div0/types/address.h"
+#include "div0/types/hash.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/// Weight of the collapsed-stack output.
+typedef enum {
+  EVM_PROFILE_TIME, // Nanoseconds
+  EVM_PROFILE_GAS,  // Gas
+} evm_profile_metric_t;
+
+/// Totals for one distinct bytecode.
+typedef struct evm_profile_code {
+  struct evm_profile_code *next; // Next entry in the profiler's list
+  const uint8_t *code;           // Bytecode pointer (lookup key)
+  size_t code_size;              // Bytecode length
+  hash_t code_hash;              // keccak256 of the bytecode
+  uint64_t counts[256];          // Executions per opcode
+  uint64_t gas[256];             // Gas per opcode
+  uint64_t ns[256];              // Nanoseconds per opcode
+} evm_profile_code_t;
+
+/// Call tree node: one per distinct stack of executing addresses.
+typedef struct evm_profile_node {
+  struct evm_profile_node *parent;       // Calling node (nullptr for the tree root)
+  struct evm_profile_node *first_child;  // First callee
+  struct evm_profile_node *next_sibling; // Next callee of the parent
+  struct evm_profile_node *next;         // Next node in creation order
+  address_t address;                     // Executing address
+  uint64_t gas[256];                     // Gas per opcode (self)
+  uint64_t ns[256];                      // Nanoseconds per opcode (self)
+} evm_profile_node_t;
+
+/// Per-depth bookkeeping.
+typedef struct {
+  evm_profile_node_t *node; // Call tree node of the frame
+  evm_profile_code_t *code; // Code entry of the frame (nullptr if allocation failed)
+  uint64_t start_ns;        // Time the frame started
+  uint64_t start_gas;       // Gas the frame started with
+  uint64_t step_ns;         // Time of the pending step
+  uint64_t step_gas;        // Gas before the pending step
+  uint64_t child_ns;        // Time spent in child frames since the pending step
+  uint64_t child_gas;       // Gas used by child frames since the pending step
+  uint8_t opcode;           // Pending step's opcode
+  bool pending;             // A step at this depth awaits its cost
+} evm_profile_depth_t;
+
+/// Execution profiler.
+typedef struct {
+  evm_tracer_t base;           // vtable (must be first for casting)
+  div0_arena_t *arena;         // Arena for nodes and code entries
+  evm_profile_node_t *root;    // Tree root (transactions' top frames are its children)
+  evm_profile_node_t *nodes;   // All nodes except the root, newest first
+  evm_profile_code_t *codes;   // All code entries, newest first
+  evm_profile_depth_t *depths; // One entry per call depth
+  uint64_t total_ns;           // Sum of charged nanoseconds
+  uint64_t total_gas;          // Sum of charged gas
+  bool truncated;              // An allocation failed; some frames were merged into their caller
+} evm_profiler_t;
+
+/// Initialize a profiler.
+/// @param profiler Profiler to initialize
+/// @param arena Arena for the profile (must outlive the profiler)
+/// @return true on success, false on allocation failure
+[[nodiscard]] bool evm_profiler_init(evm_profiler_t *profiler, div0_arena_t *arena);
+
+/// Write the call tree as collapsed stacks, one line per (stack, opcode).
+/// @param profiler Profiler
+/// @param out Destination stream
+/// @param metric Weight of each line
+/// @return true on success, false on write error
+bool evm_profiler_write_collapsed(const evm_profiler_t *profiler, FILE *out,
+                                  evm_profile_metric_t metric);
+
+/// Write the per-code table as CSV: code_hash,opcode,name,count,gas,ns.
+/// @param profiler Profiler
+/// @param out Destination stream
+/// @return true on success, false on write error
+bool evm_profiler_write_opcodes(const evm_profiler_t *profiler, FILE *out);
+
+#endif // DIV0_FREESTANDING
+
+#endif // DIV0_EVM_PROFILER_H
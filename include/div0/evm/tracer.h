@@ -0,0 +1,150 @@
+#ifndef DIV0_EVM_TRACER_H
+#define DIV0_EVM_TRACER_H
+
+#include "div0/evm/call_frame.h"
+#include "div0/evm/frame_result.h"
+#include "div0/mem/arena.h"
+#include "div0/types/uint256.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Execution tracing.
+///
+/// A tracer is attached with evm_set_tracer(). The interpreter is compiled a
+/// second time with the hooks in place, and evm_execute_env() only runs that
+/// instance when a tracer is set, so untraced execution has no extra branches
+/// in the opcode loop.
+
+typedef struct evm_tracer evm_tracer_t;
+
+/// Execution step, reported before the opcode executes.
+typedef struct {
+  const call_frame_t *frame; // Executing frame (stack, memory, depth, address)
+  uint64_t pc;               // Position of the opcode
+  uint64_t gas;              // Gas remaining before the opcode
+  uint64_t refund;           // Refund counter
+  uint8_t opcode;            // Opcode about to execute
+} evm_trace_step_t;
+
+/// Tracer hooks. Any hook may be nullptr.
+typedef struct {
+  /// Called before each opcode.
+  void (*step)(evm_tracer_t *tracer, const evm_trace_step_t *step);
+
+  /// Called when a frame starts executing.
+  /// @param parent Calling frame, nullptr for the root (its gas already excludes the child's)
+  /// @param frame New frame
+  void (*call_enter)(evm_tracer_t *tracer, const call_frame_t *parent, const call_frame_t *frame);
+
+  /// Called when a frame finishes, before its resources are released.
+  /// On FRAME_ERROR all of the frame's gas is consumed regardless of frame->gas.
+  void (*call_exit)(evm_tracer_t *tracer, const call_frame_t *frame, const frame_result_t *result);
+
+  /// Called after a successful SLOAD (is_write false) or SSTORE (is_write true).
+  void (*storage_access)(evm_tracer_t *tracer, const call_frame_t *frame, uint256_t slot,
+                         uint256_t value, bool is_write);
+} evm_tracer_vtable_t;
+
+/// Tracer base. Implementations embed this as their first member.
+struct evm_tracer {
+  const evm_tracer_vtable_t *vtable;
+};
+
+// =============================================================================
+// Hook Dispatch (used by the traced interpreter)
+// =============================================================================
+
+static inline void evm_tracer_step(evm_tracer_t *const tracer, const call_frame_t *const frame,
+                                   const uint64_t refund) {
+  if (tracer->vtable->step != nullptr) {
+    const evm_trace_step_t step = {
+        .frame = frame,
+        .pc = frame->pc,
+        .gas = frame->gas,
+        .refund = refund,
+        .opcode = frame->code[frame->pc],
+    };
+    tracer->vtable->step(tracer, &step);
+  }
+}
+
+static inline void evm_tracer_call_enter(evm_tracer_t *const tracer,
+                                         const call_frame_t *const parent,
+                                         const call_frame_t *const frame) {
+  if (tracer->vtable->call_enter != nullptr) {
+    tracer->vtable->call_enter(tracer, parent, frame);
+  }
+}
+
+static inline void evm_tracer_call_exit(evm_tracer_t *const tracer, const call_frame_t *const frame,
+                                        const frame_result_t *const result) {
+  if (tracer->vtable->call_exit != nullptr) {
+    tracer->vtable->call_exit(tracer, frame, result);
+  }
+}
+
+static inline void evm_tracer_storage_access(evm_tracer_t *const tracer,
+                                             const call_frame_t *const frame, const uint256_t slot,
+                                             const uint256_t value, const bool is_write) {
+  if (tracer->vtable->storage_access != nullptr) {
+    tracer->vtable->storage_access(tracer, frame, slot, value, is_write);
+  }
+}
+
+/// Gas a frame has left when it exits (zero on error).
+static inline uint64_t evm_tracer_exit_gas(const call_frame_t *const frame,
+                                           const frame_result_t *const result) {
+  return result->action == FRAME_ERROR ? 0 : frame->gas;
+}
+
+// =============================================================================
+// Opcode Histogram
+// =============================================================================
+
+/// Counts executed opcodes and storage accesses.
+typedef struct {
+  evm_tracer_t base;       // vtable (must be first for casting)
+  uint64_t counts[256];    // Executions per opcode
+  uint64_t steps;          // Total opcodes executed
+  uint64_t storage_reads;  // Successful SLOADs
+  uint64_t storage_writes; // Successful SSTOREs
+} evm_opcode_histogram_t;
+
+/// Initialize a histogram with all counters at zero.
+/// @param hist Histogram to initialize
+void evm_opcode_histogram_init(evm_opcode_histogram_t *hist);
+
+// =============================================================================
+// Gas Profiler
+// =============================================================================
+
+/// Per-depth bookkeeping of the gas profiler.
+typedef struct {
+  uint64_t start_gas; // Gas the frame at this depth started with
+  uint64_t gas;       // Gas before the pending step
+  uint64_t child_gas; // Gas used by child frames since the pending step
+  uint8_t opcode;     // Pending step's opcode
+  bool pending;       // A step at this depth awaits its cost
+} evm_gas_profiler_depth_t;
+
+/// Attributes gas to opcodes.
+/// A step's cost is the drop in gas until the next step of the same frame (or
+/// the frame's exit). Gas used by child frames is charged to their own
+/// opcodes, so a CALL is charged only its own cost.
+typedef struct {
+  evm_tracer_t base;                // vtable (must be first for casting)
+  uint64_t gas[256];                // Gas charged per opcode
+  uint64_t counts[256];             // Executions per opcode
+  uint64_t total_gas;               // Sum of gas[]
+  evm_gas_profiler_depth_t *depths; // One entry per call depth
+} evm_gas_profiler_t;
+
+/// Initialize a gas profiler.
+/// @param profiler Profiler to initialize
+/// @param arena Arena for the per-depth table
+/// @return true on success, false on allocation failure
+[[nodiscard]] bool evm_gas_profiler_init(evm_gas_profiler_t *profiler, div0_arena_t *arena);
+
+#endif // DIV0_EVM_TRACER_H
@@ -0,0 +1,93 @@
+#ifndef DIV0_EVM_TRANSIENT_STORAGE_H
+#define DIV0_EVM_TRANSIENT_STORAGE_H
+
+#include "div0/mem/arena.h"
+#include "div0/types/address.h"
+#include "div0/types/uint256.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Transient storage for TLOAD/TSTORE (EIP-1153).
+///
+/// A flat open-addressing table keyed by (address, slot), owned by the EVM
+/// and discarded at the end of every transaction. Each entry carries the
+/// generation it was written in; clearing bumps the table's generation, so
+/// every older entry reads as empty without touching the table.
+///
+/// Writes are journaled with the previous value. A frame records the journal
+/// size when it starts and, if it reverts, transient_storage_revert() undoes
+/// every write made since.
+
+/// Table entry. An entry belongs to the current transaction only if its
+/// generation matches the table's; any other entry is a free slot.
+typedef struct {
+  address_t address;
+  uint32_t generation;
+  uint256_t slot;
+  uint256_t value;
+} transient_storage_entry_t;
+
+/// Journal entry: the value a slot had before a write.
+typedef struct {
+  address_t address;
+  uint256_t slot;
+  uint256_t previous;
+} transient_storage_journal_t;
+
+/// Transient storage of one EVM instance.
+typedef struct {
+  transient_storage_entry_t *entries; // Capacity is a power of two (nullptr until first write)
+  size_t capacity;
+  size_t count;        // Live entries in the current generation
+  uint32_t generation; // Current transaction's generation (never 0)
+
+  transient_storage_journal_t *journal;
+  size_t journal_size;
+  size_t journal_capacity;
+
+  div0_arena_t *arena; // Backs entries and journal
+} transient_storage_t;
+
+/// Initializes empty transient storage. Nothing is allocated until the first write.
+/// @param ts Transient storage
+/// @param arena Arena for the table and journal
+void transient_storage_init(transient_storage_t *ts, div0_arena_t *arena);
+
+/// Discards all slots and the journal for the next transaction.
+/// Constant time: only the generation changes (the table is rewritten once
+/// every 2^32 transactions, when the generation wraps).
+/// @param ts Transient storage
+void transient_storage_clear(transient_storage_t *ts);
+
+/// Loads a slot (TLOAD). Unset slots read as zero.
+/// @param ts Transient storage
+/// @param addr Contract address
+/// @param slot Slot key
+/// @return Slot value
+[[nodiscard]] uint256_t transient_storage_get(const transient_storage_t *ts,
+                                              const address_t *addr, uint256_t slot);
+
+/// Stores a slot (TSTORE), journaling its previous value.
+/// @param ts Transient storage
+/// @param addr Contract address
+/// @param slot Slot key
+/// @param value Value to store
+/// @return false on allocation failure (nothing is changed)
+[[nodiscard]] bool transient_storage_set(transient_storage_t *ts, const address_t *addr,
+                                         uint256_t slot, uint256_t value);
+
+/// Journal position to revert to if the frame starting now fails.
+/// @param ts Transient storage
+/// @return Checkpoint for transient_storage_revert
+[[nodiscard]] static inline size_t transient_storage_checkpoint(const transient_storage_t *ts) {
+  return ts->journal_size;
+}
+
+/// Undoes every write made after a checkpoint, newest first.
+/// @param ts Transient storage
+/// @param checkpoint Value of transient_storage_checkpoint at frame start
+void transient_storage_revert(transient_storage_t *ts, size_t checkpoint);
+
+#endif // DIV0_EVM_TRANSIENT_STORAGE_H
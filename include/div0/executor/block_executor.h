@@ -116,6 +116,7 @@ typedef struct {
   div0_arena_t *arena;            // Arena for allocations
   uint64_t chain_id;              // Chain ID for validation
   bool skip_signature_validation; // Skip signature recovery (for t8n)
+  bool rewind_evm_arena;          // Rewind the EVM's arena after each tx (see below)
 } block_executor_t;
 
 // =============================================================================
@@ -124,6 +125,11 @@ typedef struct {
 
 /// Initialize a block executor.
 /// The executor does not own any resources - caller manages lifecycle.
+///
+/// Set rewind_evm_arena to bound memory by the largest transaction instead of
+/// the whole block: the EVM's arena is then rewound after each transaction's
+/// receipt and state writes (see evm_rewind). That arena must be used by the
+/// EVM alone, not by the world state or as the executor's arena.
 /// @param exec Executor to initialize
 /// @param state State access interface
 /// @param block Block context
@@ -139,7 +145,8 @@ void block_executor_init(block_executor_t *exec, state_access_t *state,
 /// @param txs Transactions to execute
 /// @param tx_count Number of transactions
 /// @param result Output result (arena-allocated)
-/// @return true on success, false on fatal error
+/// @return true on success, false on fatal error (including a read of state the
+///         state provider does not hold, see state_is_unavailable)
 [[nodiscard]] bool block_executor_run(const block_executor_t *exec, const block_tx_t *txs,
                                       size_t tx_count, block_exec_result_t *result);
 
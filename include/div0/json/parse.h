@@ -142,6 +142,12 @@ uint64_t json_get_u64(yyjson_val_t *val);
 /// @return Int64 value, or 0 if not a number
 int64_t json_get_i64(yyjson_val_t *val);
 
+/// Get numeric value as double (integers are converted).
+///
+/// @param val JSON value
+/// @return Double value, or 0.0 if not a number
+double json_get_f64(yyjson_val_t *val);
+
 // ============================================================================
 // Hex-Encoded Value Parsing
 // ============================================================================
@@ -0,0 +1,211 @@
+#ifndef DIV0_JSON_READER_H
+#define DIV0_JSON_READER_H
+
+/// @file reader.h
+/// @brief Single-pass (pull) JSON reader.
+///
+/// Walks a JSON buffer token by token so callers can decode fields straight
+/// into their own structs, without building a document tree. The buffer is
+/// never modified, so it can be a read-only file mapping (json_file_map).
+///
+/// Strings are returned as raw views into the buffer: escape sequences are
+/// not decoded. The reader is meant for t8n inputs, where keys and values
+/// are field names, hex and decimal numbers.
+///
+/// Errors are sticky: after a syntax error every call returns false and
+/// json_reader_result reports the first error.
+
+#ifndef DIV0_FREESTANDING
+
+#include "div0/json/json.h"
+#include "div0/mem/arena.h"
+#include "div0/types/address.h"
+#include "div0/types/bytes.h"
+#include "div0/types/hash.h"
+#include "div0/types/uint256.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/// Kind of the next value in the input.
+typedef enum {
+  JSON_TOKEN_NONE = 0, ///< End of input or invalid token
+  JSON_TOKEN_OBJ,      ///< '{'
+  JSON_TOKEN_ARR,      ///< '['
+  JSON_TOKEN_STR,      ///< '"'
+  JSON_TOKEN_NUM,      ///< Number
+  JSON_TOKEN_BOOL,     ///< true / false
+  JSON_TOKEN_NULL,     ///< null
+} json_token_t;
+
+/// Reader state.
+typedef struct {
+  const char *pos;   ///< Next unread byte
+  const char *end;   ///< End of input
+  const char *start; ///< Start of input (for error offsets)
+  const char *error; ///< First syntax error (static string), or nullptr
+  size_t error_at;   ///< Input offset of the first error
+  bool first;        ///< No member read yet in the innermost container
+} json_reader_t;
+
+/// Initialize a reader.
+///
+/// @param r Reader to initialize
+/// @param data JSON text (not required to be null-terminated)
+/// @param len Length of data
+void json_reader_init(json_reader_t *r, const char *data, size_t len);
+
+/// Check that the reader has not seen an error.
+static inline bool json_reader_ok(const json_reader_t *r) {
+  return r->error == nullptr;
+}
+
+/// Get the reader status as a result (JSON_ERR_PARSE on syntax errors).
+json_result_t json_reader_result(const json_reader_t *r);
+
+/// Error result for a decoding failure, unless a syntax error came first
+/// (the read failed because of it, so that is what gets reported).
+static inline json_result_t json_reader_err(const json_reader_t *r, json_error_t code,
+                                            const char *detail) {
+  return r->error == nullptr ? json_err(code, detail) : json_err(JSON_ERR_PARSE, r->error);
+}
+
+/// Check that only whitespace remains after the top-level value.
+///
+/// @return Result (JSON_ERR_PARSE on trailing data or an earlier error)
+json_result_t json_reader_finish(json_reader_t *r);
+
+/// Get the kind of the next value without consuming it.
+json_token_t json_reader_peek(json_reader_t *r);
+
+/// Count the members of the object or array that comes next, without
+/// consuming it. Only brackets and string boundaries are scanned, so this is
+/// much cheaper than reading the container.
+///
+/// @return Number of members (0 if the next value is not a container)
+size_t json_reader_count(json_reader_t *r);
+
+/// Compare a key (or other string view) with a null-terminated literal.
+static inline bool json_reader_key_eq(const char *key, size_t key_len, const char *lit) {
+  return strlen(lit) == key_len && memcmp(key, lit, key_len) == 0;
+}
+
+// ============================================================================
+// Containers
+// ============================================================================
+
+/// Consume '{'.
+///
+/// @return false (and an error) if the next value is not an object
+bool json_reader_obj_begin(json_reader_t *r);
+
+/// Advance to the next object member.
+///
+/// On success the key and ':' are consumed and the member value is next.
+///
+/// @param r Reader
+/// @param key Output key (raw view into the buffer, not terminated)
+/// @param key_len Output key length
+/// @return true if a member follows, false at '}' (consumed) or on error
+bool json_reader_obj_next(json_reader_t *r, const char **key, size_t *key_len);
+
+/// Consume '['.
+///
+/// @return false (and an error) if the next value is not an array
+bool json_reader_arr_begin(json_reader_t *r);
+
+/// Advance to the next array element.
+///
+/// @return true if an element follows, false at ']' (consumed) or on error
+bool json_reader_arr_next(json_reader_t *r);
+
+// ============================================================================
+// Values
+// ============================================================================
+
+/// Read a string value.
+///
+/// @param r Reader
+/// @param out Output string (raw view into the buffer, not terminated)
+/// @param len Output length
+/// @return false (and an error) if the next value is not a string
+bool json_reader_str(json_reader_t *r, const char **out, size_t *len);
+
+/// Consume a null value if one comes next.
+///
+/// @return true if null was consumed
+bool json_reader_null(json_reader_t *r);
+
+/// Skip the next value. Skipped containers are only checked for balanced
+/// brackets and terminated strings.
+///
+/// @return false on syntax error
+bool json_reader_skip(json_reader_t *r);
+
+// ============================================================================
+// Hex-Encoded Values
+// ============================================================================
+//
+// Each reads the next value. A value that is not a string is skipped; like
+// the json_val_hex_* accessors, these return false for non-string values
+// and malformed hex without setting a reader error.
+
+/// Read a hex-encoded uint64.
+bool json_reader_hex_u64(json_reader_t *r, uint64_t *out);
+
+/// Read a hex-encoded uint256.
+bool json_reader_hex_uint256(json_reader_t *r, uint256_t *out);
+
+/// Read a hex-encoded address.
+bool json_reader_hex_address(json_reader_t *r, address_t *out);
+
+/// Read a hex-encoded hash.
+bool json_reader_hex_hash(json_reader_t *r, hash_t *out);
+
+/// Read hex-encoded bytes into an arena allocation.
+bool json_reader_hex_bytes(json_reader_t *r, div0_arena_t *arena, bytes_t *out);
+
+/// Copy a short string view into a null-terminated buffer, for decoders that
+/// take C strings (keys holding addresses, slots or block numbers).
+///
+/// @param str String view
+/// @param len View length
+/// @param buf Output buffer
+/// @param buf_size Size of buf
+/// @return false if the view does not fit
+bool json_reader_copy_str(const char *str, size_t len, char *buf, size_t buf_size);
+
+// ============================================================================
+// Mapped Input Files
+// ============================================================================
+
+/// A JSON file mapped read-only for json_reader_t.
+typedef struct {
+  const char *data; ///< Mapped bytes (nullptr for an empty file)
+  size_t size;      ///< File size in bytes
+} json_file_t;
+
+/// Map a file for reading with json_reader_t.
+///
+/// The kernel reads ahead sequentially while the reader walks the pages, so
+/// decoding overlaps with I/O.
+///
+/// @param path File path
+/// @param file Output mapping (release with json_file_unmap)
+/// @return Result (JSON_ERR_IO if the file cannot be opened or mapped)
+json_result_t json_file_map(const char *path, json_file_t *file);
+
+/// Map an open file descriptor (e.g. stdin redirected from a file).
+///
+/// @param fd File descriptor positioned at offset 0 (not closed)
+/// @param file Output mapping
+/// @return Result (JSON_ERR_IO if fd is not a regular file or cannot be mapped)
+json_result_t json_file_map_fd(int fd, json_file_t *file);
+
+/// Release a mapping (no-op if not mapped).
+void json_file_unmap(json_file_t *file);
+
+#endif // DIV0_FREESTANDING
+#endif // DIV0_JSON_READER_H
@@ -0,0 +1,109 @@
+#ifndef DIV0_JSON_STREAM_H
+#define DIV0_JSON_STREAM_H
+
+/// @file stream.h
+/// @brief Streaming JSON writer.
+///
+/// Emits JSON straight into a buffered FILE* while the caller walks its data,
+/// without building a document first. Output is byte-identical to the DOM
+/// writer (write.h) for the same sequence of values and flags: compact, or
+/// pretty-printed with four-space indentation, "{}"/"[]" for empty
+/// containers and no trailing newline. Hex values are formatted in place in
+/// the output buffer.
+///
+/// Errors are sticky: writes after a failure are ignored and the failure is
+/// reported by json_stream_finish.
+
+#ifndef DIV0_FREESTANDING
+
+#include "div0/json/json.h"
+#include "div0/json/write.h"
+#include "div0/types/address.h"
+#include "div0/types/hash.h"
+#include "div0/types/uint256.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/// Maximum container nesting depth.
+#define JSON_STREAM_MAX_DEPTH 63
+
+/// Streaming writer state.
+typedef struct {
+  FILE *fp;          ///< Destination (not owned)
+  char *buf;         ///< Output buffer
+  size_t len;        ///< Bytes buffered
+  size_t cap;        ///< Buffer capacity
+  uint64_t nonempty; ///< Bit d set: the container at depth d has members
+  uint32_t depth;    ///< Current nesting depth (0 = top level)
+  bool pretty;       ///< Pretty-print
+  bool after_key;    ///< Next value completes a key-value pair
+  bool failed;       ///< An allocation, nesting or write error occurred
+} json_stream_t;
+
+/// Initialize a streaming writer.
+///
+/// @param s Stream to initialize
+/// @param fp Destination stream
+/// @param flags Output formatting flags
+/// @return Result (JSON_ERR_ALLOC if the buffer cannot be allocated)
+json_result_t json_stream_init(json_stream_t *s, FILE *fp, json_write_flags_t flags);
+
+/// Flush buffered output and release the writer.
+///
+/// @param s Stream
+/// @return Result (JSON_ERR_IO if any write failed)
+json_result_t json_stream_finish(json_stream_t *s);
+
+// ============================================================================
+// Structure
+// ============================================================================
+
+/// Begin an object.
+void json_stream_obj_begin(json_stream_t *s);
+
+/// End the current object.
+void json_stream_obj_end(json_stream_t *s);
+
+/// Begin an array.
+void json_stream_arr_begin(json_stream_t *s);
+
+/// End the current array.
+void json_stream_arr_end(json_stream_t *s);
+
+/// Write an object key; the next value written is its value.
+void json_stream_key(json_stream_t *s, const char *key);
+
+// ============================================================================
+// Values
+// ============================================================================
+
+/// Write a string value (escaped).
+void json_stream_str(json_stream_t *s, const char *str);
+
+/// Write a uint64 value (decimal).
+void json_stream_u64(json_stream_t *s, uint64_t val);
+
+/// Write hex-encoded uint64 ("0x...", minimal encoding).
+void json_stream_hex_u64(json_stream_t *s, uint64_t val);
+
+/// Write hex-encoded uint256 ("0x...", minimal encoding).
+void json_stream_hex_uint256(json_stream_t *s, const uint256_t *val);
+
+/// Write zero-padded hex uint256 (64 digits).
+void json_stream_hex_uint256_padded(json_stream_t *s, const uint256_t *val);
+
+/// Write hex-encoded address.
+void json_stream_hex_address(json_stream_t *s, const address_t *addr);
+
+/// Write hex-encoded hash.
+void json_stream_hex_hash(json_stream_t *s, const hash_t *hash);
+
+/// Write hex-encoded bytes ("0x" for empty). Large inputs are encoded in
+/// buffer-sized chunks.
+void json_stream_hex_bytes(json_stream_t *s, const uint8_t *data, size_t len);
+
+#endif // DIV0_FREESTANDING
+#endif // DIV0_JSON_STREAM_H
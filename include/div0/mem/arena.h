@@ -10,35 +10,89 @@
 /// Default alignment for arena allocations (8 bytes).
 static constexpr size_t DIV0_ARENA_ALIGNMENT = 8;
 
-/// Block size for arena allocations.
-/// Note: Using #define instead of constexpr because this is used as an array
-/// size in div0_arena_block_t and some compilers (especially with bare-metal
-/// toolchains) may have issues with constexpr in this context.
+/// Default block size for arena allocations, and the minimum for
+/// div0_arena_init_with (callers rely on allocations up to this size succeeding).
+/// A block with its header is 64KB, so it fills a power-of-two provider size
+/// class exactly (see huge_pages.h).
 #ifndef DIV0_ARENA_BLOCK_SIZE
-#define DIV0_ARENA_BLOCK_SIZE ((size_t)64 * 1024)
+#define DIV0_ARENA_BLOCK_SIZE ((size_t)64 * 1024 - sizeof(div0_arena_block_t))
 #endif
 
-/// Arena block - a single 64KB memory region.
+/// Arena block - a single memory region of the arena's block size.
 /// Blocks are chained together when more memory is needed.
 typedef struct div0_arena_block {
   struct div0_arena_block *next;
   size_t offset; // Current allocation offset within data[]
-  uint8_t data[DIV0_ARENA_BLOCK_SIZE];
+  uint8_t data[];
 } div0_arena_block_t;
 
-/// Arena allocator using chained 64KB blocks.
+/// Source of block memory for an arena.
+/// Regular blocks are requested at sizeof(div0_arena_block_t) + block_size,
+/// large blocks at their own size; release is always called with the size
+/// that was acquired.
+typedef struct div0_arena_provider {
+  void *(*acquire)(struct div0_arena_provider *provider, size_t size);
+  void (*release)(struct div0_arena_provider *provider, void *ptr, size_t size);
+} div0_arena_provider_t;
+
+/// Arena allocator using chained blocks (64KB by default).
 /// Fast bump-pointer allocation, bulk reset, reusable between executions.
 typedef struct {
   div0_arena_block_t *head;         // First block in chain
   div0_arena_block_t *current;      // Block currently allocating from
   div0_arena_block_t *large_blocks; // Separate chain for large allocations
+  size_t block_size;                // Data bytes per regular block
+  div0_arena_provider_t *provider;  // Block provider (nullptr: malloc/free)
 } div0_arena_t;
 
-/// Initialize arena with first block.
+/// Arena configuration for div0_arena_init_with.
+typedef struct {
+  size_t block_size;               // Data bytes per block (0: DIV0_ARENA_BLOCK_SIZE)
+  div0_arena_provider_t *provider; // Block provider (nullptr: malloc/free, not owned)
+} div0_arena_config_t;
+
+/// Arena checkpoint taken by div0_arena_mark.
+/// Rewinding to it releases everything allocated after the mark.
+typedef struct {
+  div0_arena_block_t *block;        // Block that was current at mark time
+  size_t offset;                    // Offset within that block at mark time
+  div0_arena_block_t *large_blocks; // Head of the large block chain at mark time
+} div0_arena_mark_t;
+
+/// Acquire block memory from the arena's provider.
+[[nodiscard]] static inline div0_arena_block_t *div0_arena_block_acquire(div0_arena_t *arena,
+                                                                       size_t size) {
+  if (arena->provider) {
+    return (div0_arena_block_t *)arena->provider->acquire(arena->provider, size);
+  }
+  return (div0_arena_block_t *)malloc(size);
+}
+
+/// Return block memory to the arena's provider.
+static inline void div0_arena_block_release(div0_arena_t *arena, div0_arena_block_t *block,
+                                            size_t size) {
+  if (arena->provider) {
+    arena->provider->release(arena->provider, block, size);
+  } else {
+    free(block);
+  }
+}
+
+/// Initialize arena with a block size and block provider.
 /// @param arena Arena to initialize
-/// @return true on success, false on allocation failure
-[[nodiscard]] static inline bool div0_arena_init(div0_arena_t *arena) {
-  div0_arena_block_t *block = (div0_arena_block_t *)malloc(sizeof(div0_arena_block_t));
+/// @param config Configuration (block_size must be 0 or >= DIV0_ARENA_BLOCK_SIZE)
+/// @return true on success, false on invalid configuration or allocation failure
+[[nodiscard]] static inline bool div0_arena_init_with(div0_arena_t *arena,
+                                                      const div0_arena_config_t *config) {
+  size_t block_size = config->block_size == 0 ? DIV0_ARENA_BLOCK_SIZE : config->block_size;
+  if (block_size < DIV0_ARENA_BLOCK_SIZE || block_size > SIZE_MAX - sizeof(div0_arena_block_t)) {
+    return false;
+  }
+  arena->block_size = block_size;
+  arena->provider = config->provider;
+
+  div0_arena_block_t *block =
+      div0_arena_block_acquire(arena, sizeof(div0_arena_block_t) + block_size);
   if (!block) {
     return false;
   }
@@ -50,10 +104,18 @@ typedef struct {
   return true;
 }
 
+/// Initialize arena with first block (default block size, malloc-backed).
+/// @param arena Arena to initialize
+/// @return true on success, false on allocation failure
+[[nodiscard]] static inline bool div0_arena_init(div0_arena_t *arena) {
+  const div0_arena_config_t config = {.block_size = DIV0_ARENA_BLOCK_SIZE, .provider = nullptr};
+  return div0_arena_init_with(arena, &config);
+}
+
 /// Allocate memory from arena with specific alignment.
-/// For allocations larger than DIV0_ARENA_BLOCK_SIZE, use div0_arena_alloc_large.
+/// For allocations larger than the arena's block size, use div0_arena_alloc_large.
 /// @param arena Arena to allocate from
-/// @param size Number of bytes to allocate (must be <= DIV0_ARENA_BLOCK_SIZE)
+/// @param size Number of bytes to allocate (must be <= arena block size)
 /// @param alignment Required alignment (must be power of 2)
 /// @return Pointer to allocated memory, or nullptr if allocation fails
 [[nodiscard]] static inline void *div0_arena_alloc_aligned(div0_arena_t *arena, size_t size,
@@ -71,7 +133,8 @@ typedef struct {
   size_t aligned_size = (size + align_mask) & ~align_mask;
 
   // Reject allocations larger than block size
-  if (aligned_size > DIV0_ARENA_BLOCK_SIZE) {
+  const size_t block_size = arena->block_size;
+  if (aligned_size > block_size) {
     return nullptr;
   }
 
@@ -83,7 +146,7 @@ typedef struct {
   uintptr_t aligned_addr = (current_addr + align_mask) & ~align_mask;
   size_t aligned_offset = aligned_addr - (uintptr_t)block->data;
 
-  if (aligned_offset + aligned_size <= DIV0_ARENA_BLOCK_SIZE) {
+  if (aligned_offset + aligned_size <= block_size) {
     void *ptr = block->data + aligned_offset;
     block->offset = aligned_offset + aligned_size;
     return ptr;
@@ -102,7 +165,8 @@ typedef struct {
   }
 
   // Need new block
-  div0_arena_block_t *new_block = (div0_arena_block_t *)malloc(sizeof(div0_arena_block_t));
+  div0_arena_block_t *new_block =
+      div0_arena_block_acquire(arena, sizeof(div0_arena_block_t) + block_size);
   if (!new_block) {
     return nullptr;
   }
@@ -120,7 +184,7 @@ typedef struct {
 }
 
 /// Allocate a large block of memory from arena.
-/// Use this for allocations larger than DIV0_ARENA_BLOCK_SIZE (64KB).
+/// Use this for allocations larger than the arena's block size.
 /// The block is inserted into the arena chain and freed on arena destruction.
 /// @param arena Arena to allocate from
 /// @param size Number of bytes to allocate
@@ -147,13 +211,13 @@ typedef struct {
   size_t block_data_size = aligned_size + alignment;
 
   // Check for overflow in header + block_data_size
-  size_t header_size = sizeof(div0_arena_block_t) - DIV0_ARENA_BLOCK_SIZE;
+  size_t header_size = sizeof(div0_arena_block_t);
   if (block_data_size > SIZE_MAX - header_size) {
     return nullptr;
   }
   size_t total_size = header_size + block_data_size;
 
-  div0_arena_block_t *large_block = (div0_arena_block_t *)malloc(total_size);
+  div0_arena_block_t *large_block = div0_arena_block_acquire(arena, total_size);
   if (!large_block) {
     return nullptr;
   }
@@ -163,7 +227,7 @@ typedef struct {
   uintptr_t aligned_addr = (data_start + align_mask) & ~align_mask;
   size_t aligned_offset = aligned_addr - data_start;
 
-  large_block->offset = block_data_size; // Store block size (not used for allocation)
+  large_block->offset = block_data_size; // Store data size for release (not used for allocation)
 
   // Prepend to separate large blocks chain (keeps them out of regular block iteration)
   large_block->next = arena->large_blocks;
@@ -172,6 +236,24 @@ typedef struct {
   return large_block->data + aligned_offset;
 }
 
+/// Allocate an array from arena, using a large block when it exceeds the block size.
+/// @param arena Arena to allocate from
+/// @param count Number of elements
+/// @param size Size of each element
+/// @param alignment Required alignment (must be power of 2)
+/// @return Pointer to allocated memory, or nullptr on failure, overflow or count == 0
+[[nodiscard]] static inline void *div0_arena_alloc_array(div0_arena_t *arena, size_t count,
+                                                         size_t size, size_t alignment) {
+  size_t total;
+  if (__builtin_mul_overflow(count, size, &total)) {
+    return nullptr;
+  }
+  if (total > arena->block_size - alignment) {
+    return div0_arena_alloc_large(arena, total, alignment);
+  }
+  return div0_arena_alloc_aligned(arena, total, alignment);
+}
+
 /// Allocate memory from arena (8-byte aligned).
 /// @param arena Arena to allocate from
 /// @param size Number of bytes to allocate
@@ -204,11 +286,16 @@ typedef struct {
 static inline void div0_arena_free([[maybe_unused]] div0_arena_t *arena, [[maybe_unused]] void *ptr,
                                    [[maybe_unused]] size_t size) {}
 
-/// Free a chain of arena blocks.
-static inline void free_block_chain(div0_arena_block_t *head) {
+/// Release a large block (its data size is stored in offset).
+static inline void div0_arena_release_large(div0_arena_t *arena, div0_arena_block_t *block) {
+  div0_arena_block_release(arena, block, sizeof(div0_arena_block_t) + block->offset);
+}
+
+/// Release a chain of large blocks.
+static inline void free_large_chain(div0_arena_t *arena, div0_arena_block_t *head) {
   while (head) {
     div0_arena_block_t *next = head->next;
-    free(head);
+    div0_arena_release_large(arena, head);
     head = next;
   }
 }
@@ -223,14 +310,48 @@ static inline void div0_arena_reset(div0_arena_t *arena) {
   arena->current = arena->head;
 
   // Free large blocks (can't reuse effectively due to variable sizes)
-  free_block_chain(arena->large_blocks);
+  free_large_chain(arena, arena->large_blocks);
   arena->large_blocks = nullptr;
 }
 
+/// Take a checkpoint of the current allocation position.
+/// @param arena Arena to mark
+/// @return Checkpoint for div0_arena_rewind
+[[nodiscard]] static inline div0_arena_mark_t div0_arena_mark(const div0_arena_t *arena) {
+  return (div0_arena_mark_t){
+      .block = arena->current,
+      .offset = arena->current->offset,
+      .large_blocks = arena->large_blocks,
+  };
+}
+
+/// Rewind arena to a checkpoint (keeps regular blocks allocated, frees newer large blocks).
+/// Allocations made after the mark become invalid; earlier ones stay valid.
+/// Marks must be rewound in LIFO order and are invalidated by div0_arena_reset.
+/// @param arena Arena to rewind
+/// @param mark Checkpoint from div0_arena_mark on the same arena
+static inline void div0_arena_rewind(div0_arena_t *arena, const div0_arena_mark_t mark) {
+  // Blocks after mark.block keep stale offsets; they are reset when allocation advances
+  arena->current = mark.block;
+  mark.block->offset = mark.offset;
+
+  // Large blocks are prepended, so the newer ones sit before the marked head
+  while (arena->large_blocks != mark.large_blocks) {
+    div0_arena_block_t *next = arena->large_blocks->next;
+    div0_arena_release_large(arena, arena->large_blocks);
+    arena->large_blocks = next;
+  }
+}
+
 /// Destroy arena and free all blocks.
 static inline void div0_arena_destroy(div0_arena_t *arena) {
-  free_block_chain(arena->head);
-  free_block_chain(arena->large_blocks);
+  const size_t block_bytes = sizeof(div0_arena_block_t) + arena->block_size;
+  for (div0_arena_block_t *block = arena->head; block != nullptr;) {
+    div0_arena_block_t *next = block->next;
+    div0_arena_block_release(arena, block, block_bytes);
+    block = next;
+  }
+  free_large_chain(arena, arena->large_blocks);
   arena->head = nullptr;
   arena->current = nullptr;
   arena->large_blocks = nullptr;
@@ -0,0 +1,97 @@
+#ifndef DIV0_MEM_HUGE_PAGES_H
+#define DIV0_MEM_HUGE_PAGES_H
+
+/// @file huge_pages.h
+/// @brief mmap-backed arena block provider using 2MB huge page regions.
+///
+/// Regions are mapped with MAP_HUGETLB when huge pages are reserved, otherwise
+/// as 2MB-aligned anonymous memory advised for transparent huge pages. Arena
+/// blocks are carved from the regions, so a large state arena touches few TLB
+/// entries. With populate set, each region is pre-faulted when it is mapped.
+/// Only available in hosted builds (bare-metal builds use the default provider).
+
+#ifndef DIV0_FREESTANDING
+
+#include "div0/mem/arena.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Huge page size (2MB on x86-64 and aarch64 with 4KB base pages).
+#define DIV0_HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+
+/// Arena block size that packs four blocks, headers included, into one huge page.
+#define DIV0_HUGE_PAGE_BLOCK_SIZE (DIV0_HUGE_PAGE_SIZE / 4 - sizeof(div0_arena_block_t))
+
+/// Smallest carved block: one cache line (size class 0).
+#define DIV0_HUGE_PAGE_MIN_CLASS_SHIFT 6
+
+/// Number of carved size classes: powers of two from 64 bytes to one huge page.
+#define DIV0_HUGE_PAGE_CLASS_COUNT 16
+
+/// Default bound on released carved bytes kept for reuse (see cache_limit).
+#define DIV0_HUGE_PAGE_CACHE_LIMIT ((size_t)32 * DIV0_HUGE_PAGE_SIZE)
+
+/// Mapped region (tracked outside the mapping so blocks can fill it exactly).
+typedef struct div0_huge_region {
+  struct div0_huge_region *next;
+  uint8_t *base; // Mapping start
+  size_t size;   // Mapping size in bytes
+  size_t live;   // Carved bytes handed out and not yet released
+} div0_huge_region_t;
+
+/// Released carved block, kept for reuse (stored in the block itself).
+typedef struct div0_huge_free_block {
+  struct div0_huge_free_block *next;
+} div0_huge_free_block_t;
+
+/// Huge page block provider. Not thread-safe; use one per arena or per thread.
+///
+/// Blocks up to a huge page are carved in power-of-two size classes. A request
+/// takes a released block of its class, or splits the smallest larger one, so
+/// arenas whose large allocations vary in size keep reusing the same memory.
+/// Classes hold the arena block header too: a block size of a power of two
+/// minus sizeof(div0_arena_block_t), as DIV0_ARENA_BLOCK_SIZE and
+/// DIV0_HUGE_PAGE_BLOCK_SIZE are, fills its class; a power of two takes twice that.
+/// Once more than cache_limit released bytes are cached, regions with nothing
+/// handed out are unmapped.
+typedef struct {
+  div0_arena_provider_t base; // Provider interface (must be first for casting)
+
+  div0_huge_region_t *regions; // Mapped regions, unmapped on destroy
+  div0_huge_region_t *current; // Region blocks are carved from
+  uint8_t *cursor;             // Next free byte in the current region
+  size_t remaining;            // Bytes left in the current region
+  div0_huge_free_block_t *free_lists[DIV0_HUGE_PAGE_CLASS_COUNT]; // Released blocks by class
+  size_t cached_size; // Bytes on the free lists
+  size_t cache_limit; // Cached bytes above which empty regions are unmapped
+
+  bool populate;      // Pre-fault regions when mapping them (MAP_POPULATE)
+  bool hugetlb;       // True if the last region came from MAP_HUGETLB
+  size_t mapped_size; // Total bytes currently mapped
+} div0_huge_page_provider_t;
+
+/// Initialize a huge page provider (cache_limit is DIV0_HUGE_PAGE_CACHE_LIMIT).
+/// @param provider Provider to initialize
+/// @param reserve Bytes to map up front (rounded up to DIV0_HUGE_PAGE_SIZE, 0 for none)
+/// @param populate Pre-fault regions when they are mapped
+/// @return true on success, false if the reservation could not be mapped
+[[nodiscard]] bool div0_huge_page_provider_init(div0_huge_page_provider_t *provider, size_t reserve,
+                                                bool populate);
+
+/// Get the arena provider interface.
+/// @param provider Huge page provider
+/// @return Provider for div0_arena_config_t
+[[nodiscard]] static inline div0_arena_provider_t *
+div0_huge_page_provider(div0_huge_page_provider_t *provider) {
+  return &provider->base;
+}
+
+/// Unmap all regions. Arenas using the provider must be destroyed first.
+/// @param provider Provider to destroy
+void div0_huge_page_provider_destroy(div0_huge_page_provider_t *provider);
+
+#endif // DIV0_FREESTANDING
+
+#endif // DIV0_MEM_HUGE_PAGES_H
@@ -0,0 +1,58 @@
+#ifndef DIV0_STATE_JUMPDEST_CACHE_H
+#define DIV0_STATE_JUMPDEST_CACHE_H
+
+#include "div0/mem/arena.h"
+#include "div0/types/hash.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Jumpdest analysis cache keyed by code hash.
+///
+/// Bitmaps are copied into the cache's own arena, so the cache can outlive
+/// the world states and arenas of individual executions. Attach it to a world
+/// state with world_state_set_jumpdest_cache() to share analyses between
+/// blocks that run the same contracts.
+
+/// Cache entry (open addressing; a null bitmap marks an empty slot).
+typedef struct {
+  hash_t code_hash;
+  const uint8_t *bitmap;
+} jumpdest_cache_entry_t;
+
+/// Jumpdest analysis cache.
+typedef struct {
+  jumpdest_cache_entry_t *entries; // Capacity is a power of two
+  size_t capacity;
+  size_t count;
+  size_t hits;         // Lookups answered by jumpdest_cache_get
+  size_t size;         // Bytes taken from the arena (tables and bitmaps)
+  div0_arena_t *arena; // Backs entries and bitmaps
+} jumpdest_cache_t;
+
+/// Initialize an empty cache.
+/// The cache only grows. To bound it, reset its arena once size exceeds a
+/// budget (while no bitmap from it is in use) and initialize it again.
+/// @param cache Cache to initialize
+/// @param arena Arena for entries and bitmaps (must outlive the cache)
+/// @return true on success, false on allocation failure
+[[nodiscard]] bool jumpdest_cache_init(jumpdest_cache_t *cache, div0_arena_t *arena);
+
+/// Look up the bitmap for a code hash. Counts a hit when it is cached.
+/// @param cache Cache
+/// @param code_hash Keccak256 hash of the bytecode
+/// @return Cached bitmap, or nullptr if not cached
+[[nodiscard]] const uint8_t *jumpdest_cache_get(jumpdest_cache_t *cache,
+                                                const hash_t *code_hash);
+
+/// Store a copy of a bitmap. Existing entries are kept.
+/// @param cache Cache
+/// @param code_hash Keccak256 hash of the bytecode
+/// @param bitmap Bitmap to copy
+/// @param bitmap_size Size of bitmap in bytes
+/// @return true if the bitmap is cached, false on allocation failure
+bool jumpdest_cache_put(jumpdest_cache_t *cache, const hash_t *code_hash, const uint8_t *bitmap,
+                        size_t bitmap_size);
+
+#endif // DIV0_STATE_JUMPDEST_CACHE_H
@@ -13,6 +13,22 @@
 /// Forward declarations
 typedef struct state_access state_access_t;
 
+/// Account fields requested from account_access.
+typedef enum {
+  STATE_ACCOUNT_INFO = 1 << 0, // exists, balance, nonce, code_hash
+  STATE_ACCOUNT_CODE = 1 << 1, // code
+} state_account_fields_t;
+
+/// Account fields resolved by a single account_access call.
+/// Only the fields requested are filled in.
+typedef struct {
+  bool exists;       // Account is present in state (INFO)
+  uint256_t balance; // Balance in wei (INFO, zero if absent)
+  uint64_t nonce;    // Nonce (INFO, zero if absent)
+  hash_t code_hash;  // Code hash (INFO, EMPTY_CODE_HASH if absent or no code)
+  bytes_t code;      // Code bytes, valid until state is modified (CODE, empty if none)
+} state_account_view_t;
+
 /// State access vtable - interface for EVM state operations.
 /// Follows the vtable pattern used by mpt_backend_vtable_t.
 typedef struct {
@@ -154,6 +170,29 @@ typedef struct {
   void (*set_storage)(state_access_t *state, const address_t *addr, uint256_t slot,
                       uint256_t value);
 
+  /// Mark a slot warm and load its current and original values in one lookup.
+  /// Fuses warm_slot, get_storage and get_original_storage for SLOAD/SSTORE.
+  /// @param state State access instance
+  /// @param addr Contract address
+  /// @param slot Storage slot key
+  /// @param current Output: current value
+  /// @param original Output: value at start of transaction (may be nullptr)
+  /// @param was_cold Output: true if the slot was cold (first access this tx)
+  void (*storage_access)(state_access_t *state, const address_t *addr, uint256_t slot,
+                         uint256_t *current, uint256_t *original, bool *was_cold);
+
+  /// Store a slot whose values are already known from storage_access.
+  /// Same effect as set_storage, without reloading the slot to record the
+  /// original value or the value a revert restores.
+  /// @param state State access instance
+  /// @param addr Contract address
+  /// @param slot Storage slot key
+  /// @param current Current value returned by storage_access
+  /// @param original Original value returned by storage_access
+  /// @param value Value to store
+  void (*storage_write)(state_access_t *state, const address_t *addr, uint256_t slot,
+                        uint256_t current, uint256_t original, uint256_t value);
+
   // ===========================================================================
   // EIP-2929 WARM/COLD ACCESS (Shanghai+)
   // ===========================================================================
@@ -184,6 +223,16 @@ typedef struct {
   /// @return true if slot was cold (first access this tx), false if already warm
   bool (*warm_slot)(state_access_t *state, const address_t *addr, uint256_t slot);
 
+  /// Mark address as warm and load the requested account fields in one lookup.
+  /// Fuses warm_address with get_balance, account_exists, get_code_hash or get_code.
+  /// @param state State access instance
+  /// @param addr Address to access
+  /// @param fields Bitmask of state_account_fields_t
+  /// @param out Output: requested fields
+  /// @return true if address was cold (first access this tx), false if already warm
+  bool (*account_access)(state_access_t *state, const address_t *addr, unsigned fields,
+                         state_account_view_t *out);
+
   // ===========================================================================
   // TRANSACTION BOUNDARY
   // ===========================================================================
@@ -255,12 +304,21 @@ typedef struct {
 /// Concrete implementations embed this as first member.
 struct state_access {
   const state_access_vtable_t *vtable;
+  // Set when a read needed state the implementation does not hold (a subtree
+  // missing from a witness). That read returned empty; results computed since
+  // are meaningless. Sticky: never cleared by the implementation.
+  bool unavailable;
 };
 
 // =============================================================================
 // CONVENIENCE INLINE FUNCTIONS
 // =============================================================================
 
+/// Check whether a read has needed state that is not available.
+[[nodiscard]] static inline bool state_is_unavailable(const state_access_t *state) {
+  return state->unavailable;
+}
+
 /// Check if account exists.
 [[nodiscard]] static inline bool state_account_exists(state_access_t *state,
                                                       const address_t *addr) {
@@ -380,6 +438,27 @@ static inline void state_set_code(state_access_t *state, const address_t *addr,
   state->vtable->set_code(state, addr, code, code_len);
 }
 
+/// Warm a slot and load its current and original values.
+static inline void state_storage_access(state_access_t *state, const address_t *addr,
+                                        uint256_t slot, uint256_t *current, uint256_t *original,
+                                        bool *was_cold) {
+  state->vtable->storage_access(state, addr, slot, current, original, was_cold);
+}
+
+/// Store a slot with its current and original values already known.
+static inline void state_storage_write(state_access_t *state, const address_t *addr,
+                                       uint256_t slot, uint256_t current, uint256_t original,
+                                       uint256_t value) {
+  state->vtable->storage_write(state, addr, slot, current, original, value);
+}
+
+/// Warm an address and load the requested account fields.
+[[nodiscard]] static inline bool state_account_access(state_access_t *state,
+                                                      const address_t *addr, unsigned fields,
+                                                      state_account_view_t *out) {
+  return state->vtable->account_access(state, addr, fields, out);
+}
+
 /// Check if address is warm.
 [[nodiscard]] static inline bool state_is_address_warm(state_access_t *state,
                                                        const address_t *addr) {
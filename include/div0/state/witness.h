@@ -0,0 +1,128 @@
+#ifndef DIV0_STATE_WITNESS_H
+#define DIV0_STATE_WITNESS_H
+
+#include "div0/mem/arena.h"
+#include "div0/state/state_access.h"
+#include "div0/state/world_state.h"
+#include "div0/trie/proof.h"
+#include "div0/types/address.h"
+#include "div0/types/bytes.h"
+#include "div0/types/hash.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Execution witness for stateless re-execution.
+///
+/// A witness holds the pre-state trie nodes and contract code a block touched,
+/// so the block can be replayed without the full state (e.g. inside a zk
+/// prover). Recording and replay are two halves:
+///
+///   1. Execute with a witness_recorder_t wrapped around the live state. It
+///      forwards every call and remembers which accounts, slots and code were
+///      accessed.
+///   2. Call witness_build() with the pre-state (the state before execution)
+///      to collect the trie nodes for those accesses.
+///   3. Serialise with witness_encode(); on the other side, witness_decode()
+///      and world_state_from_witness() give a state_access_t to replay with.
+
+/// Execution witness. Nodes of the state trie and all storage tries share one
+/// node list, deduplicated by hash; codes are deduplicated by code hash.
+typedef struct {
+  hash_t pre_state_root; // State root before execution
+  mpt_proof_t nodes;     // RLP-encoded pre-state trie nodes
+  bytes_t *codes;        // Contract code read during execution
+  size_t code_count;     // Number of codes
+  address_t *addresses;  // Accounts accessed during execution
+  size_t address_count;  // Number of addresses
+} witness_t;
+
+// =============================================================================
+// Binary Format
+// =============================================================================
+
+/// Serialise a witness.
+/// Format: "D0WT" | version (1 byte) | pre_state_root (32 bytes) |
+///         node count, then length + bytes per node |
+///         code count, then length + bytes per code |
+///         address count, then 20 bytes per address.
+/// Counts and lengths are unsigned LEB128.
+/// @param witness Witness to encode
+/// @param arena Arena for the output buffer
+/// @return Encoded witness (data is nullptr on allocation failure)
+[[nodiscard]] bytes_t witness_encode(const witness_t *witness, div0_arena_t *arena);
+
+/// Deserialise a witness.
+/// Nodes and codes are views into data, which must outlive the witness.
+/// @param data Encoded witness
+/// @param len Length of data
+/// @param arena Arena for the node, code and address arrays
+/// @param out Output witness
+/// @return true on success, false if data is malformed or truncated
+[[nodiscard]] bool witness_decode(const uint8_t *data, size_t len, div0_arena_t *arena,
+                                  witness_t *out);
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+/// State access wrapper that records accesses for witness generation.
+/// Implements state_access_t by forwarding every call to the wrapped state.
+typedef struct {
+  state_access_t base; // vtable (must be first for casting)
+
+  state_access_t *inner; // Wrapped state (not owned)
+
+  void *addresses;      // Set of accessed addresses
+  void *slots;          // Set of accessed (address, slot) pairs
+  void *code_addresses; // Set of addresses whose code was read
+
+  div0_arena_t *arena; // Arena for recorder allocations
+} witness_recorder_t;
+
+/// Create a recorder wrapping a state.
+/// @param inner State to forward to (not owned, must outlive the recorder)
+/// @param arena Arena for allocations
+/// @return Recorder, or nullptr on failure
+[[nodiscard]] witness_recorder_t *witness_recorder_create(state_access_t *inner,
+                                                          div0_arena_t *arena);
+
+/// Get state access interface for EVM.
+/// @param rec Recorder
+/// @return State access interface (valid while the recorder exists)
+[[nodiscard]] static inline state_access_t *witness_recorder_access(witness_recorder_t *rec) {
+  return &rec->base;
+}
+
+/// Build the witness for everything recorded so far.
+/// @param rec Recorder
+/// @param pre_state World state as it was before execution
+/// @param arena Arena for the witness
+/// @param out Output witness
+/// @return true on success, false on allocation failure
+[[nodiscard]] bool witness_build(const witness_recorder_t *rec, world_state_t *pre_state,
+                                 div0_arena_t *arena, witness_t *out);
+
+/// Destroy the recorder. The wrapped state is not destroyed.
+/// @param rec Recorder
+void witness_recorder_destroy(witness_recorder_t *rec);
+
+// =============================================================================
+// Replay
+// =============================================================================
+
+/// Create a world state backed by a witness.
+/// The state and storage tries are partial tries loaded from the witness nodes,
+/// so accounts, slots and code recorded in the witness behave exactly as in the
+/// full pre-state, and state_root() matches a full re-execution. A read that
+/// reaches a subtree the witness does not cover returns empty and sets
+/// state_is_unavailable(); the EVM then stops with EVM_STATE_UNAVAILABLE.
+/// Witness bytes must outlive the state.
+/// @param witness Witness to load
+/// @param arena Arena for all allocations
+/// @return World state, or nullptr if the witness is inconsistent
+[[nodiscard]] world_state_t *world_state_from_witness(const witness_t *witness,
+                                                      div0_arena_t *arena);
+
+#endif // DIV0_STATE_WITNESS_H
@@ -3,6 +3,7 @@
 
 #include "div0/mem/arena.h"
 #include "div0/state/account.h"
+#include "div0/state/jumpdest_cache.h"
 #include "div0/state/state_access.h"
 #include "div0/trie/mpt.h"
 #include "div0/types/address.h"
@@ -24,13 +25,13 @@ typedef struct {
   // Hash tables for additional account data
   void *storage_tries; // address -> mpt_t* (storage trie)
   void *code_store;    // address -> bytes_t (contract code)
+  void *code_by_hash;  // code hash -> bytes_t (one copy per distinct code, shared by code_store)
 
   // EIP-2929 access tracking
   void *warm_addresses; // Set of warm addresses
-  void *warm_slots;     // Set of warm (address, slot) pairs
 
-  // EIP-2200 original storage values (for gas calculation)
-  void *original_storage; // (address, slot) -> original uint256 value
+  // Per-transaction slot tracking: EIP-2929 warmth and EIP-2200 original values
+  void *slot_access; // (address, slot) -> warm flag and original uint256 value
 
   // Dirty tracking for efficient state root computation
   void *dirty_storage; // Set of addresses with modified storage
@@ -42,7 +43,10 @@ typedef struct {
   void *all_storage_slots; // Map of (address, slot) -> slot for all written slots
 
   // Snapshot support
-  uint64_t snapshot_counter; // Per-instance snapshot ID counter
+  void *journal; // Undo log of changes since the transaction's first snapshot
+
+  // Jumpdest analyses shared across executions (optional, not owned)
+  jumpdest_cache_t *jumpdest_cache;
 
   div0_arena_t *arena; // Arena for all allocations
 } world_state_t;
@@ -97,6 +101,37 @@ void world_state_clear(world_state_t *ws);
 /// @param ws World state
 void world_state_destroy(world_state_t *ws);
 
+/// Serve jumpdest analyses from a cache that outlives this world state.
+/// Without a cache, analyses are recomputed for every call frame.
+/// @param ws World state
+/// @param cache Cache to use (not owned), or nullptr to disable
+static inline void world_state_set_jumpdest_cache(world_state_t *ws, jumpdest_cache_t *cache) {
+  ws->jumpdest_cache = cache;
+}
+
+/// Occupancy of one of the world state's hash tables.
+typedef struct {
+  size_t size;    // Entries
+  size_t buckets; // Allocated buckets (load factor = size / buckets)
+} world_state_table_stats_t;
+
+/// Occupancy of all world state hash tables.
+typedef struct {
+  world_state_table_stats_t storage_tries;
+  world_state_table_stats_t code_store;
+  world_state_table_stats_t code_by_hash;
+  world_state_table_stats_t warm_addresses;
+  world_state_table_stats_t slot_access;
+  world_state_table_stats_t dirty_storage;
+  world_state_table_stats_t all_accounts;
+  world_state_table_stats_t all_storage_slots;
+} world_state_stats_t;
+
+/// Report hash table occupancy (for benchmarks and capacity tuning).
+/// @param ws World state
+/// @return Entry and bucket counts per table
+[[nodiscard]] world_state_stats_t world_state_stats(const world_state_t *ws);
+
 // State snapshot types for post-state export
 #include "div0/state/snapshot.h"
 
@@ -20,6 +20,8 @@
 
 #include "div0/json/json.h"
 #include "div0/json/parse.h"
+#include "div0/json/reader.h"
+#include "div0/json/stream.h"
 #include "div0/json/write.h"
 #include "div0/mem/arena.h"
 
@@ -53,6 +55,25 @@ json_result_t t8n_parse_alloc_file(const char *path, div0_arena_t *arena, state_
 /// @return Parse result
 json_result_t t8n_parse_alloc_value(yyjson_val_t *root, div0_arena_t *arena, state_snapshot_t *out);
 
+/// Read alloc in a single pass, decoding accounts as the reader walks them.
+///
+/// Produces the same snapshot as t8n_parse_alloc_value without building a
+/// document; code is decoded straight from the input buffer.
+///
+/// @param r Reader positioned at the alloc object
+/// @param arena Arena for allocations
+/// @param out Output snapshot structure
+/// @return Parse result
+json_result_t t8n_read_alloc(json_reader_t *r, div0_arena_t *arena, state_snapshot_t *out);
+
+/// Read alloc.json from a memory-mapped file in a single pass.
+///
+/// @param path File path
+/// @param arena Arena for allocations
+/// @param out Output snapshot structure
+/// @return Parse result
+json_result_t t8n_read_alloc_file(const char *path, div0_arena_t *arena, state_snapshot_t *out);
+
 // ============================================================================
 // Serialization
 // ============================================================================
@@ -72,6 +93,20 @@ yyjson_mut_val_t *t8n_write_alloc(const state_snapshot_t *snapshot, const json_w
 yyjson_mut_val_t *t8n_write_alloc_account(const account_snapshot_t *account,
                                           const json_writer_t *w);
 
+/// Stream state snapshot as alloc JSON (same output as t8n_write_alloc).
+///
+/// Accounts are written as the snapshot is walked; no document is built.
+///
+/// @param snapshot State snapshot to serialize
+/// @param s JSON stream
+void t8n_stream_alloc(const state_snapshot_t *snapshot, json_stream_t *s);
+
+/// Stream a single account snapshot as a JSON object.
+///
+/// @param account Account snapshot to serialize
+/// @param s JSON stream
+void t8n_stream_alloc_account(const account_snapshot_t *account, json_stream_t *s);
+
 #endif // DIV0_FREESTANDING
 
 #endif // DIV0_T8N_ALLOC_H
@@ -0,0 +1,95 @@
+#ifndef DIV0_T8N_ALLOC_BIN_H
+#define DIV0_T8N_ALLOC_BIN_H
+
+/// @file alloc_bin.h
+/// @brief Binary alloc snapshot format.
+///
+/// A compact alternative to alloc.json for large pre-states. The file is a
+/// fixed-width image that is mmap'ed and imported without parsing: account
+/// code and storage arrays of the resulting state_snapshot_t point straight
+/// into the mapping.
+///
+/// Layout (all integers little-endian, uint256 values as four 64-bit limbs,
+/// least significant first, so records match the in-memory structs):
+///
+///   header   64 bytes   magic "D0ST", version, section counts
+///   accounts N x 80     balance, address, code index, nonce, storage range;
+///                       sorted by address
+///   codes    C x 48     keccak256(code), blob offset, size;
+///                       one entry per distinct code, sorted by hash
+///   storage  S x 64     slot, value; each account's range sorted by slot
+///   blob     B bytes    concatenated code
+///
+/// Hosted-only (requires the filesystem).
+
+#include "div0/state/snapshot.h"
+
+#ifndef DIV0_FREESTANDING
+
+#include "div0/json/json.h"
+#include "div0/mem/arena.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Current binary snapshot format version.
+#define T8N_ALLOC_BIN_VERSION 1
+
+/// A binary snapshot file mapped into memory.
+typedef struct {
+  uint8_t *data; ///< Mapped bytes (private copy-on-write mapping)
+  size_t size;   ///< File size in bytes
+} t8n_alloc_bin_file_t;
+
+/// Check whether a path names a binary snapshot (ends in ".bin").
+[[nodiscard]] bool t8n_alloc_is_bin_path(const char *path);
+
+/// Encode a snapshot into the binary format.
+///
+/// The snapshot is not modified; accounts, codes and storage are sorted in
+/// the output.
+///
+/// @param snapshot Snapshot to encode
+/// @param arena Arena for the output buffer and scratch space
+/// @param out Output bytes (arena-allocated)
+/// @return Result (JSON_ERR_ALLOC on allocation failure)
+json_result_t t8n_alloc_bin_encode(const state_snapshot_t *snapshot, div0_arena_t *arena,
+                                   bytes_t *out);
+
+/// Import a binary snapshot from memory.
+///
+/// Validates the header and all offsets, then builds the account array in
+/// the arena. Code and storage are views into data, which must stay alive
+/// (and mapped) as long as the snapshot is used. data must be 8-byte aligned.
+///
+/// @param data Snapshot bytes
+/// @param len Length of data
+/// @param arena Arena for the account array
+/// @param out Output snapshot
+/// @return Parse result
+json_result_t t8n_parse_alloc_bin(uint8_t *data, size_t len, div0_arena_t *arena,
+                                  state_snapshot_t *out);
+
+/// Map a binary snapshot file into memory.
+///
+/// @param path File path
+/// @param file Output mapping (release with t8n_alloc_bin_unmap)
+/// @return Result (JSON_ERR_IO if the file cannot be opened or mapped)
+json_result_t t8n_alloc_bin_map(const char *path, t8n_alloc_bin_file_t *file);
+
+/// Release a mapping created by t8n_alloc_bin_map (no-op if not mapped).
+void t8n_alloc_bin_unmap(t8n_alloc_bin_file_t *file);
+
+/// Encode a snapshot and write it to a file.
+///
+/// @param snapshot Snapshot to write
+/// @param arena Arena for the encoded buffer
+/// @param path Output file path
+/// @return Result
+json_result_t t8n_write_alloc_bin_file(const state_snapshot_t *snapshot, div0_arena_t *arena,
+                                       const char *path);
+
+#endif // DIV0_FREESTANDING
+
+#endif // DIV0_T8N_ALLOC_BIN_H
@@ -12,6 +12,7 @@
 
 #include "div0/json/json.h"
 #include "div0/json/parse.h"
+#include "div0/json/reader.h"
 #include "div0/mem/arena.h"
 #include "div0/types/address.h"
 #include "div0/types/hash.h"
@@ -151,5 +152,23 @@ json_result_t t8n_parse_env_file(const char *path, div0_arena_t *arena, t8n_env_
 /// @return Parse result
 json_result_t t8n_parse_env_value(yyjson_val_t *root, div0_arena_t *arena, t8n_env_t *out);
 
+/// Read env in a single pass, without building a document.
+///
+/// Produces the same env as t8n_parse_env_value; fields may come in any order.
+///
+/// @param r Reader positioned at the env object
+/// @param arena Arena for allocations
+/// @param out Output env structure
+/// @return Parse result
+json_result_t t8n_read_env(json_reader_t *r, div0_arena_t *arena, t8n_env_t *out);
+
+/// Read env.json from a memory-mapped file in a single pass.
+///
+/// @param path File path
+/// @param arena Arena for allocations
+/// @param out Output env structure
+/// @return Parse result
+json_result_t t8n_read_env_file(const char *path, div0_arena_t *arena, t8n_env_t *out);
+
 #endif // DIV0_FREESTANDING
 #endif // DIV0_T8N_ENV_H
@@ -10,6 +10,7 @@
 #ifndef DIV0_FREESTANDING
 
 #include "div0/json/json.h"
+#include "div0/json/stream.h"
 #include "div0/json/write.h"
 #include "div0/types/address.h"
 #include "div0/types/bytes.h"
@@ -143,5 +144,21 @@ yyjson_mut_val_t *t8n_write_receipt(const t8n_receipt_t *receipt, const json_wri
 /// @return JSON object value, or nullptr on error
 yyjson_mut_val_t *t8n_write_log(const t8n_log_t *log, const json_writer_t *w);
 
+// ============================================================================
+// Streaming Serialization
+// ============================================================================
+
+/// Stream result as a JSON object (same output as t8n_write_result).
+///
+/// @param result Result to serialize
+/// @param s JSON stream
+void t8n_stream_result(const t8n_result_t *result, json_stream_t *s);
+
+/// Stream a receipt as a JSON object (same output as t8n_write_receipt).
+void t8n_stream_receipt(const t8n_receipt_t *receipt, json_stream_t *s);
+
+/// Stream a log as a JSON object (same output as t8n_write_log).
+void t8n_stream_log(const t8n_log_t *log, json_stream_t *s);
+
 #endif // DIV0_FREESTANDING
 #endif // DIV0_T8N_RESULT_H
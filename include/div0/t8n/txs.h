@@ -13,10 +13,12 @@
 #include "div0/ethereum/transaction/transaction.h"
 #include "div0/json/json.h"
 #include "div0/json/parse.h"
+#include "div0/json/reader.h"
 #include "div0/json/write.h"
 #include "div0/mem/arena.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 // ============================================================================
 // Types
@@ -68,6 +70,70 @@ json_result_t t8n_parse_txs_value(yyjson_val_t *arr, div0_arena_t *arena, t8n_tx
 /// @return Parse result
 json_result_t t8n_parse_tx(yyjson_val_t *obj, div0_arena_t *arena, transaction_t *out);
 
+/// Read transactions in a single pass, without building a document.
+///
+/// Produces the same transactions as t8n_parse_txs_value; calldata is decoded
+/// straight from the input buffer.
+///
+/// @param r Reader positioned at the transactions array
+/// @param arena Arena for allocations
+/// @param out Output transactions
+/// @return Parse result
+json_result_t t8n_read_txs(json_reader_t *r, div0_arena_t *arena, t8n_txs_t *out);
+
+/// Read txs.json from a memory-mapped file in a single pass.
+///
+/// @param path File path
+/// @param arena Arena for allocations
+/// @param out Output transactions
+/// @return Parse result
+json_result_t t8n_read_txs_file(const char *path, div0_arena_t *arena, t8n_txs_t *out);
+
+/// Read a single transaction object in a single pass.
+///
+/// Fields may come in any order, including the type.
+///
+/// @param r Reader positioned at the transaction object
+/// @param arena Arena for allocations
+/// @param out Output transaction
+/// @return Parse result
+json_result_t t8n_read_tx(json_reader_t *r, div0_arena_t *arena, transaction_t *out);
+
+// ============================================================================
+// RLP Input
+// ============================================================================
+
+/// Check whether a path names an RLP-encoded transaction list (ends in ".rlp").
+[[nodiscard]] bool t8n_txs_is_rlp_path(const char *path);
+
+/// Decode an RLP transaction list, encoded as in a block body: legacy
+/// transactions as lists, typed transactions as byte strings.
+///
+/// Transactions are decoded with transaction_decode_view: their calldata and
+/// retained encodings point into data, which must outlive them.
+///
+/// @param data RLP-encoded list
+/// @param len Length of data
+/// @param arena Arena for allocations
+/// @param out Output transactions
+/// @return Parse result
+json_result_t t8n_parse_txs_rlp(const uint8_t *data, size_t len, div0_arena_t *arena,
+                                t8n_txs_t *out);
+
+/// Load a txs.rlp file.
+///
+/// Raw RLP is decoded in place from the mapped file. A JSON string holding
+/// the hex-encoded list (geth's format) is decoded into the arena first.
+///
+/// @param path File path
+/// @param arena Arena for allocations
+/// @param file Mapping the transactions point into; release with
+///             json_file_unmap after the last use of out (also on error)
+/// @param out Output transactions
+/// @return Parse result
+json_result_t t8n_parse_txs_rlp_file(const char *path, div0_arena_t *arena, json_file_t *file,
+                                     t8n_txs_t *out);
+
 // ============================================================================
 // Serialization
 // ============================================================================
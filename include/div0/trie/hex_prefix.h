@@ -38,9 +38,11 @@ typedef struct {
                                         div0_arena_t *arena);
 
 /// Decode hex-prefix encoded data back to nibbles.
+/// The encoded bytes already hold the packed path, so with a nullptr arena the
+/// result is a view into data (valid only as long as data is).
 /// @param data Encoded data
 /// @param len Length of encoded data
-/// @param arena Arena for allocation
+/// @param arena Arena to copy the path into (can be nullptr for view)
 /// @return Decode result containing nibbles and is_leaf flag
 [[nodiscard]] hex_prefix_result_t hex_prefix_decode(const uint8_t *data, size_t len,
                                                     div0_arena_t *arena);
@@ -92,7 +92,24 @@ void mpt_init(mpt_t *mpt, mpt_backend_t *backend, div0_arena_t *work_arena);
 bool mpt_insert(mpt_t *mpt, const uint8_t *key, size_t key_len, const uint8_t *value,
                 size_t value_len);
 
+/// Result of mpt_lookup.
+typedef enum {
+  MPT_LOOKUP_FOUND,      // Key is present
+  MPT_LOOKUP_ABSENT,     // Key is not in the trie
+  MPT_LOOKUP_UNRESOLVED, // Path enters a subtree that is only known by hash (partial trie)
+} mpt_lookup_t;
+
+/// Look up a key, telling absent keys apart from keys in unloaded subtrees.
+/// @param mpt The trie
+/// @param key Key bytes
+/// @param key_len Length of key
+/// @param value_out Value when found, empty otherwise
+/// @return Lookup result
+[[nodiscard]] mpt_lookup_t mpt_lookup(const mpt_t *mpt, const uint8_t *key, size_t key_len,
+                                      bytes_t *value_out);
+
 /// Get value for a key.
+/// Keys in unloaded subtrees read as absent; use mpt_lookup to detect them.
 /// @param mpt The trie
 /// @param key Key bytes
 /// @param key_len Length of key
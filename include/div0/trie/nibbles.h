@@ -7,24 +7,34 @@
 #include <stddef.h>
 #include <stdint.h>
 
-/// Nibble sequence - each element is 0-15 (4 bits stored as uint8_t).
-/// Arena-backed for efficient memory management.
+/// Packed nibble view - a window of 4-bit values over a byte buffer.
+/// Two nibbles per byte, high nibble first. Nibble i lives at absolute
+/// nibble index (offset + i) of data, so slicing only adjusts offset/len.
+/// The view does not own data; it points into key bytes or arena memory.
 typedef struct {
-  uint8_t *data; // Each element is 0-15
-  size_t len;
+  const uint8_t *data; // Packed bytes (high nibble first)
+  size_t offset;       // Absolute index of the first nibble within data
+  size_t len;          // Number of nibbles in the view
 } nibbles_t;
 
 /// Empty nibbles constant.
-static const nibbles_t NIBBLES_EMPTY = {.data = nullptr, .len = 0};
+static const nibbles_t NIBBLES_EMPTY = {.data = nullptr, .offset = 0, .len = 0};
 
-/// Convert bytes to nibbles (2 nibbles per byte, high nibble first).
+/// Create a nibble view over bytes (2 nibbles per byte, high nibble first).
 /// Example: 0xAB -> [0x0A, 0x0B]
-/// @param bytes Source bytes to convert
+/// @param bytes Source bytes
 /// @param len Number of bytes
-/// @param arena Arena for allocation
+/// @param arena Arena to copy bytes into (nullptr for a zero-copy view)
 /// @return Nibble sequence (len * 2 nibbles)
 [[nodiscard]] nibbles_t nibbles_from_bytes(const uint8_t *bytes, size_t len, div0_arena_t *arena);
 
+/// Pack an unpacked nibble array (one nibble per byte, 0-15) into a view.
+/// @param nibbles Source nibbles, one per byte
+/// @param count Number of nibbles
+/// @param arena Arena for allocation
+/// @return Packed nibble sequence
+[[nodiscard]] nibbles_t nibbles_pack(const uint8_t *nibbles, size_t count, div0_arena_t *arena);
+
 /// Convert nibbles to bytes (2 nibbles -> 1 byte).
 /// Requires even number of nibbles.
 /// Example: [0x0A, 0x0B] -> 0xAB
@@ -39,6 +49,7 @@ void nibbles_to_bytes(const nibbles_t *nibbles, uint8_t *out);
 [[nodiscard]] uint8_t *nibbles_to_bytes_alloc(const nibbles_t *nibbles, div0_arena_t *arena);
 
 /// Find the length of the common prefix between two nibble sequences.
+/// Compares 16 nibbles per step using 64-bit XOR + count-leading-zeros.
 /// @param a First nibble sequence
 /// @param b Second nibble sequence
 /// @return Number of matching nibbles from the start
@@ -71,7 +82,7 @@ void nibbles_to_bytes(const nibbles_t *nibbles, uint8_t *out);
 /// @param b Second nibble sequence
 /// @return true if equal, false otherwise
 [[nodiscard]] static inline bool nibbles_equal(const nibbles_t *a, const nibbles_t *b) {
-  return nibbles_cmp(a, b) == 0;
+  return a->len == b->len && nibbles_common_prefix(a, b) == a->len;
 }
 
 /// Check if nibbles is empty.
@@ -102,7 +113,9 @@ void nibbles_to_bytes(const nibbles_t *nibbles, uint8_t *out);
 /// @param index Index
 /// @return Nibble value (0-15)
 [[nodiscard]] static inline uint8_t nibbles_get(const nibbles_t *n, size_t index) {
-  return n->data[index];
+  const size_t pos = n->offset + index;
+  const uint8_t byte = n->data[pos >> 1];
+  return (pos & 1) != 0 ? (byte & 0x0F) : (byte >> 4);
 }
 
 #endif // DIV0_TRIE_NIBBLES_H
@@ -87,6 +87,7 @@ struct mpt_node {
   };
   mpt_node_type_t type;
   bool hash_valid;
+  bool shared; // Referenced by more than one parent: copied before it is modified
 };
 
 /// Empty root hash constant (keccak256 of RLP-encoded empty string: 0x80).
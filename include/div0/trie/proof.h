@@ -0,0 +1,122 @@
+#ifndef DIV0_TRIE_PROOF_H
+#define DIV0_TRIE_PROOF_H
+
+#include "div0/mem/arena.h"
+#include "div0/trie/mpt.h"
+#include "div0/types/bytes.h"
+#include "div0/types/hash.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Merkle proofs for the MPT (eth_getProof-style).
+///
+/// A proof is the list of RLP-encoded nodes a verifier needs to walk from the
+/// root hash to a key. Nodes whose encoding is shorter than 32 bytes are
+/// embedded in their parent and are not listed separately. The verifier looks
+/// nodes up by keccak256 of their encoding, so a single-key proof and a
+/// deduplicated multiproof are verified the same way.
+///
+/// Everything is arena-backed and uses no libc allocation, so verification
+/// also runs in freestanding (RISC-V prover) builds.
+
+/// Proof: RLP-encoded trie nodes.
+/// Single-key proofs are ordered root first along the key path; multiproofs
+/// hold each distinct node once, in first-visit order.
+typedef struct {
+  bytes_t *nodes; // RLP-encoded nodes (arena-backed)
+  size_t count;   // Number of nodes
+} mpt_proof_t;
+
+/// Key for batched proof generation and verification.
+typedef struct {
+  const uint8_t *data; // Key bytes
+  size_t len;          // Key length
+} mpt_proof_key_t;
+
+/// Proof verification outcome.
+typedef enum {
+  MPT_PROOF_FOUND,   // Proof matches the root and the key is present
+  MPT_PROOF_ABSENT,  // Proof matches the root and shows the key is absent
+  MPT_PROOF_INVALID, // Proof is malformed, incomplete, or does not match the root
+} mpt_proof_status_t;
+
+/// Trie and keys for witness collection.
+typedef struct {
+  const mpt_t *mpt;            // Trie to collect from
+  const mpt_proof_key_t *keys; // Keys read or written
+  size_t key_count;            // Number of keys
+} mpt_witness_query_t;
+
+/// Generate a proof for a single key (inclusion or exclusion).
+/// Nodes are encoded into the trie's work arena.
+/// @param mpt The trie
+/// @param key Key bytes
+/// @param key_len Length of key
+/// @param proof_out Output proof (count == 0 for an empty trie)
+/// @return true on success, false on allocation failure
+[[nodiscard]] bool mpt_prove(const mpt_t *mpt, const uint8_t *key, size_t key_len,
+                             mpt_proof_t *proof_out);
+
+/// Generate one proof covering several keys, with shared nodes included once.
+/// @param mpt The trie
+/// @param keys Keys to prove
+/// @param key_count Number of keys
+/// @param proof_out Output proof
+/// @return true on success, false on allocation failure
+[[nodiscard]] bool mpt_prove_multi(const mpt_t *mpt, const mpt_proof_key_t *keys,
+                                   size_t key_count, mpt_proof_t *proof_out);
+
+/// Verify a proof for a single key against a root hash.
+/// @param root Expected root hash
+/// @param key Key bytes
+/// @param key_len Length of key
+/// @param proof Proof nodes (single-key proof or multiproof)
+/// @param arena Arena for temporary allocations (node hash index)
+/// @param value_out Output: value view into the proof nodes when FOUND (may be nullptr)
+/// @return Verification status
+[[nodiscard]] mpt_proof_status_t mpt_verify_proof(const hash_t *root, const uint8_t *key,
+                                                  size_t key_len, const mpt_proof_t *proof,
+                                                  div0_arena_t *arena, bytes_t *value_out);
+
+/// Verify a multiproof for several keys, hashing each proof node only once.
+/// @param root Expected root hash
+/// @param keys Keys to verify
+/// @param key_count Number of keys
+/// @param proof Proof nodes
+/// @param arena Arena for temporary allocations
+/// @param statuses_out Output: one status per key
+/// @param values_out Output: one value view per key (may be nullptr)
+/// @return true if every key verified as FOUND or ABSENT
+[[nodiscard]] bool mpt_verify_multiproof(const hash_t *root, const mpt_proof_key_t *keys,
+                                         size_t key_count, const mpt_proof_t *proof,
+                                         div0_arena_t *arena, mpt_proof_status_t *statuses_out,
+                                         bytes_t *values_out);
+
+/// Collect the nodes needed to replay reads and writes of keys across one or more
+/// tries, deduplicated by hash across all of them. Besides the proof nodes, for
+/// each branch on a path that has exactly one untouched child, that child is
+/// included: deleting the touched keys can collapse the branch into it. The
+/// root of every non-empty trie is included, even for a query without keys.
+/// @param queries Tries and their keys
+/// @param query_count Number of queries
+/// @param arena Arena for node encodings and temporary allocations
+/// @param proof_out Output node set
+/// @return true on success, false on allocation failure
+[[nodiscard]] bool mpt_collect_witness(const mpt_witness_query_t *queries, size_t query_count,
+                                       div0_arena_t *arena, mpt_proof_t *proof_out);
+
+/// Replace the trie contents with the partial trie rooted at root.
+/// Nodes are decoded from the proof; subtrees missing from it stay as unresolved
+/// hash references: the root hash stays correct, and mpt_lookup() reports keys
+/// under them as MPT_LOOKUP_UNRESOLVED. A node referenced from several parents
+/// is loaded once and copied on its first write. Paths and values are views
+/// into the proof nodes, which must outlive the trie.
+/// @param mpt The trie (cleared first)
+/// @param root Root hash to load
+/// @param proof Nodes to load from (may hold nodes of other tries too)
+/// @return true on success, false if the root is missing or a node is malformed
+[[nodiscard]] bool mpt_load_proof(mpt_t *mpt, const hash_t *root, const mpt_proof_t *proof);
+
+#endif // DIV0_TRIE_PROOF_H
@@ -30,6 +30,29 @@
 /// - hex string contains non-hex characters
 bool hex_decode(const char *hex, uint8_t *out, size_t out_len);
 
+/// Decode exactly 2 * out_len hex digits (no prefix, no terminator needed).
+///
+/// The digits are validated and converted with SSE2/AVX2 or NEON where the
+/// build target provides them, and with a scalar loop otherwise. On invalid
+/// input the contents of out are unspecified.
+///
+/// @param digits Hex digits (at least 2 * out_len readable characters)
+/// @param out Output buffer
+/// @param out_len Number of bytes to produce
+/// @return true if all digits are valid hex
+bool hex_decode_digits(const char *digits, uint8_t *out, size_t out_len);
+
+/// Skip an optional "0x"/"0X" prefix.
+///
+/// @param hex Input hex string
+/// @return Pointer to the first hex digit
+static inline const char *hex_skip_prefix(const char *hex) {
+  if (hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X')) {
+    return hex + 2;
+  }
+  return hex;
+}
+
 /// Convert a single hex character to its nibble value.
 ///
 /// @param c Hex character ('0'-'9', 'a'-'f', 'A'-'F')
@@ -63,7 +86,8 @@ bool hex_decode_u64(const char *hex, uint64_t *out);
 
 /// Parse a hex string to uint256 with variable length.
 ///
-/// Accepts optional "0x" prefix. Parses up to 64 hex digits.
+/// Accepts optional "0x" prefix. Parses up to 64 hex digits, decoding each
+/// group of 16 directly into a limb.
 ///
 /// @param hex Input hex string
 /// @param out Output value
@@ -80,6 +104,15 @@ size_t hex_strlen(const char *hex);
 // Hex Encoding
 // ============================================================================
 
+/// Encode a byte buffer as exactly 2 * len hex digits (no prefix, no terminator).
+///
+/// Uses the same vector kernels as hex_decode_digits.
+///
+/// @param data Input bytes
+/// @param len Number of bytes
+/// @param out Output buffer (at least 2 * len bytes)
+void hex_encode_digits(const uint8_t *data, size_t len, char *out);
+
 /// Encode a byte buffer to hex string with "0x" prefix.
 ///
 /// @param data Input bytes
@@ -3,7 +3,10 @@
 #include "cli/version.h"
 #include "crash_handler.h"
 #include "exit_codes.h"
+#include "t8n/alloc_convert.h"
+#include "t8n/t8n_batch.h"
 #include "t8n/t8n_command.h"
+#include "t8n/t8n_server.h"
 
 #include <argparse.h>
 #include <stdio.h>
@@ -20,6 +23,9 @@ struct cmd_struct {
 
 static struct cmd_struct commands[] = {
     {"t8n", cmd_t8n},
+    {"t8n-server", cmd_t8n_server},
+    {"t8n-batch", cmd_t8n_batch},
+    {"alloc-convert", cmd_alloc_convert},
     {nullptr, nullptr},
 };
 
@@ -48,7 +54,10 @@ int main(int argc, const char **argv) {
   struct argparse argparse;
   argparse_init(&argparse, options, usages, ARGPARSE_STOP_AT_NON_OPTION);
   argparse_describe(&argparse, "\ndiv0 - High-performance EVM implementation",
-                    "\nSubcommands:\n  t8n    Execute state transition");
+                    "\nSubcommands:\n  t8n            Execute state transition"
+                    "\n  t8n-server     Execute state transitions from a request stream"
+                    "\n  t8n-batch      Execute fixture directories on a worker pool"
+                    "\n  alloc-convert  Convert an alloc between JSON and binary snapshot");
   argc = argparse_parse(&argparse, argc, argv);
 
   if (show_version) {
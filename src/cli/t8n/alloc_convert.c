@@ -0,0 +1,112 @@
+// alloc_convert.c - Alloc format conversion subcommand implementation
+
+#include "alloc_convert.h"
+
+#include "../exit_codes.h"
+#include "div0/t8n/alloc.h"
+#include "div0/t8n/alloc_bin.h"
+
+#include <argparse.h>
+#include <stdio.h>
+
+// Diagnostic output uses fprintf to stderr. Return values are intentionally
+// ignored as there's no meaningful recovery for stderr write failures.
+// NOLINTBEGIN(cert-err33-c)
+
+static int report_error(const char *const what, const char *const path,
+                        const json_result_t result) {
+  fprintf(stderr, "alloc-convert: failed to %s %s: %s\n", what, path,
+          result.detail ? result.detail : json_error_name(result.error));
+  return result.error == JSON_ERR_IO ? DIV0_EXIT_IO_ERROR : DIV0_EXIT_JSON_ERROR;
+}
+
+static json_result_t write_alloc_json(const state_snapshot_t *const snapshot,
+                                      const char *const path) {
+  FILE *const out = fopen(path, "wb");
+  if (out == nullptr) {
+    return json_err(JSON_ERR_IO, "failed to open file");
+  }
+  json_stream_t s;
+  json_result_t result = json_stream_init(&s, out, JSON_WRITE_PRETTY);
+  if (result.error == JSON_OK) {
+    t8n_stream_alloc(snapshot, &s);
+    result = json_stream_finish(&s);
+  }
+  if (fclose(out) != 0 && result.error == JSON_OK) {
+    result = json_err(JSON_ERR_IO, "failed to close file");
+  }
+  return result;
+}
+
+/// Read input and write it to output in the format chosen by its extension.
+/// A binary input is mapped into file, which the caller unmaps.
+static int convert(const char *const input, const char *const output, div0_arena_t *const arena,
+                   t8n_alloc_bin_file_t *const file, const bool quiet) {
+  state_snapshot_t snapshot = {};
+  json_result_t result;
+  if (t8n_alloc_is_bin_path(input)) {
+    result = t8n_alloc_bin_map(input, file);
+    if (result.error == JSON_OK) {
+      result = t8n_parse_alloc_bin(file->data, file->size, arena, &snapshot);
+    }
+  } else {
+    result = t8n_parse_alloc_file(input, arena, &snapshot);
+  }
+  if (result.error != JSON_OK) {
+    return report_error("read", input, result);
+  }
+
+  result = t8n_alloc_is_bin_path(output) ? t8n_write_alloc_bin_file(&snapshot, arena, output)
+                                         : write_alloc_json(&snapshot, output);
+  if (result.error != JSON_OK) {
+    return report_error("write", output, result);
+  }
+  if (!quiet) {
+    fprintf(stderr, "alloc-convert: %zu accounts, %s -> %s\n", snapshot.account_count, input,
+            output);
+  }
+  return DIV0_EXIT_SUCCESS;
+}
+
+int cmd_alloc_convert(int argc, const char **argv) {
+  // clang-format off
+  static const char *const usages[] = {
+    "div0 alloc-convert [options] INPUT OUTPUT",
+    nullptr,
+  };
+  // clang-format on
+
+  int quiet = 0;
+  // NOLINTBEGIN(bugprone-multi-level-implicit-pointer-conversion)
+  struct argparse_option options[] = {
+      OPT_HELP(),
+      OPT_BOOLEAN('q', "quiet", &quiet, "Suppress the summary", nullptr, 0, 0),
+      OPT_END(),
+  };
+  // NOLINTEND(bugprone-multi-level-implicit-pointer-conversion)
+
+  struct argparse argparse;
+  argparse_init(&argparse, options, usages, 0);
+  argparse_describe(&argparse,
+                    "\nConvert an alloc between JSON and the binary snapshot format.\n"
+                    "Files ending in .bin are binary, anything else is JSON.",
+                    nullptr);
+  argc = argparse_parse(&argparse, argc, argv);
+  if (argc != 2) {
+    argparse_usage(&argparse);
+    return DIV0_EXIT_CONFIG_ERROR;
+  }
+
+  div0_arena_t arena;
+  if (!div0_arena_init(&arena)) {
+    fprintf(stderr, "alloc-convert: failed to create arena\n");
+    return DIV0_EXIT_GENERAL_ERROR;
+  }
+  t8n_alloc_bin_file_t file = {};
+  const int exit_code = convert(argv[0], argv[1], &arena, &file, quiet != 0);
+  t8n_alloc_bin_unmap(&file);
+  div0_arena_destroy(&arena);
+  return exit_code;
+}
+
+// NOLINTEND(cert-err33-c)
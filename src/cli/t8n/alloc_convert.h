@@ -0,0 +1,17 @@
+// alloc_convert.h - Alloc format conversion subcommand
+
+#ifndef DIV0_CLI_ALLOC_CONVERT_H
+#define DIV0_CLI_ALLOC_CONVERT_H
+
+/// Run the alloc-convert subcommand.
+///
+/// Converts an alloc between alloc.json and the binary snapshot format
+/// (see div0/t8n/alloc_bin.h). The format of each side is chosen by file
+/// extension: ".bin" is binary, anything else is JSON.
+///
+/// @param argc Argument count (includes "alloc-convert" as argv[0])
+/// @param argv Argument vector
+/// @return Exit code
+int cmd_alloc_convert(int argc, const char **argv);
+
+#endif // DIV0_CLI_ALLOC_CONVERT_H
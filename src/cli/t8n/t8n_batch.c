@@ -0,0 +1,532 @@
+// t8n_batch.c - Batch state transition subcommand implementation
+
+#include "t8n_batch.h"
+
+#include "t8n_command.h"
+#include "t8n_workspace.h"
+
+#include "../exit_codes.h"
+
+#include <argparse.h>
+#include <dirent.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+static const char *const DEFAULT_OUTPUT_BASEDIR = "t8n-batch-out";
+
+// Maximum path length for fixture files (matches PATH_MAX on Linux)
+static constexpr size_t MAX_PATH_LEN = 4096;
+
+// Fixture not yet executed (or no worker could start)
+static constexpr int EXIT_NOT_RUN = -1;
+
+// ============================================================================
+// Fixtures
+// ============================================================================
+
+/// One fixture and its outcome.
+typedef struct {
+  char *path; // Fixture directory
+  char *name; // Output subdirectory name
+  int exit_code;
+  uint64_t elapsed_ns;
+  uint64_t gas_used;
+  size_t tx_count;
+} batch_fixture_t;
+
+typedef struct {
+  batch_fixture_t *items;
+  size_t count;
+  size_t capacity;
+} fixture_list_t;
+
+static void fixture_list_free(fixture_list_t *list) {
+  for (size_t i = 0; i < list->count; i++) {
+    free(list->items[i].path);
+    free(list->items[i].name);
+  }
+  free(list->items);
+  list->items = nullptr;
+  list->count = 0;
+  list->capacity = 0;
+}
+
+/// Append a fixture, taking ownership of path and name.
+static bool fixture_list_add(fixture_list_t *list, char *path, char *name) {
+  if (list->count == list->capacity) {
+    const size_t capacity = list->capacity == 0 ? 64 : list->capacity * 2;
+    batch_fixture_t *const items = realloc(list->items, capacity * sizeof(batch_fixture_t));
+    if (items == nullptr) {
+      free(path);
+      free(name);
+      return false;
+    }
+    list->items = items;
+    list->capacity = capacity;
+  }
+  list->items[list->count++] = (batch_fixture_t){
+      .path = path,
+      .name = name,
+      .exit_code = EXIT_NOT_RUN,
+  };
+  return true;
+}
+
+/// Join two path components into a malloc'd string.
+static char *path_join(const char *dir, const char *name) {
+  const size_t len = strlen(dir) + 1 + strlen(name) + 1;
+  char *const path = malloc(len);
+  if (path != nullptr) {
+    (void)snprintf(path, len, "%s/%s", dir, name);
+  }
+  return path;
+}
+
+static bool is_regular_file(const char *path) {
+  struct stat st;
+  return stat(path, &st) == 0 && S_ISREG(st.st_mode);
+}
+
+static int compare_fixture_names(const void *a, const void *b) {
+  return strcmp(((const batch_fixture_t *)a)->name, ((const batch_fixture_t *)b)->name);
+}
+
+// Diagnostic output uses fprintf to stderr. Return values are intentionally
+// ignored as there's no meaningful recovery for stderr write failures.
+// NOLINTBEGIN(cert-err33-c,clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+
+/// Collect the subdirectories of dir that contain alloc.json, sorted by name.
+static bool scan_directory(const char *dir, fixture_list_t *list) {
+  DIR *const d = opendir(dir);
+  if (d == nullptr) {
+    fprintf(stderr, "t8n-batch: cannot open %s: %s\n", dir, strerror(errno));
+    return false;
+  }
+
+  bool ok = true;
+  const struct dirent *entry;
+  while (ok && (entry = readdir(d)) != nullptr) {
+    if (entry->d_name[0] == '.') {
+      continue;
+    }
+    char *const path = path_join(dir, entry->d_name);
+    char *const alloc_path = path != nullptr ? path_join(path, "alloc.json") : nullptr;
+    if (alloc_path == nullptr) {
+      free(path);
+      ok = false;
+      break;
+    }
+    if (is_regular_file(alloc_path)) {
+      ok = fixture_list_add(list, path, strdup(entry->d_name)) &&
+           list->items[list->count - 1].name != nullptr;
+    } else {
+      free(path);
+    }
+    free(alloc_path);
+  }
+  closedir(d);
+
+  if (!ok) {
+    fprintf(stderr, "t8n-batch: out of memory while scanning %s\n", dir);
+    return false;
+  }
+  qsort(list->items, list->count, sizeof(batch_fixture_t), compare_fixture_names);
+  return true;
+}
+
+/// Read fixture directories from a manifest, one per line.
+static bool read_manifest(const char *manifest, fixture_list_t *list) {
+  FILE *const in = fopen(manifest, "r");
+  if (in == nullptr) {
+    fprintf(stderr, "t8n-batch: cannot open %s: %s\n", manifest, strerror(errno));
+    return false;
+  }
+
+  bool ok = true;
+  char *line = nullptr;
+  size_t capacity = 0;
+  ssize_t len;
+  while (ok && (len = getline(&line, &capacity, in)) >= 0) {
+    // Trim trailing whitespace and directory separators
+    while (len > 0 && strchr(" \t\r\n/", line[len - 1]) != nullptr) {
+      line[--len] = '\0';
+    }
+    const char *start = line + strspn(line, " \t");
+    if (*start == '\0' || *start == '#') {
+      continue;
+    }
+
+    char *const path = strdup(start);
+    const char *name_start = start;
+    while (name_start[0] == '.' && name_start[1] == '/') {
+      name_start += 2;
+    }
+    char *const name = strdup(name_start);
+    if (path == nullptr || name == nullptr) {
+      free(path);
+      free(name);
+      ok = false;
+      break;
+    }
+    for (char *c = name; *c != '\0'; c++) {
+      if (*c == '/') {
+        *c = '_';
+      }
+    }
+    ok = fixture_list_add(list, path, name);
+  }
+  free(line);
+  fclose(in);
+
+  if (!ok) {
+    fprintf(stderr, "t8n-batch: out of memory while reading %s\n", manifest);
+  }
+  return ok;
+}
+
+/// Reject fixture lists in which two fixtures would share an output directory.
+///
+/// Manifest names flatten '/' to '_', so "a/b" and "a_b" (or the same fixture
+/// listed twice) would overwrite each other's results. Sorts the list by name.
+static bool check_unique_names(fixture_list_t *list) {
+  qsort(list->items, list->count, sizeof(batch_fixture_t), compare_fixture_names);
+  for (size_t i = 1; i < list->count; i++) {
+    if (strcmp(list->items[i - 1].name, list->items[i].name) == 0) {
+      fprintf(stderr, "t8n-batch: %s and %s both write to output directory %s\n",
+              list->items[i - 1].path, list->items[i].path, list->items[i].name);
+      return false;
+    }
+  }
+  return true;
+}
+
+// ============================================================================
+// Workers
+// ============================================================================
+
+/// Work shared by all workers.
+typedef struct {
+  fixture_list_t *fixtures;
+  const t8n_options_t *opts;
+  fork_t fork;
+  const char *output_basedir;
+  atomic_size_t next; // Next fixture to claim
+} batch_job_t;
+
+typedef struct {
+  batch_job_t *job;
+  pthread_t thread;
+  bool started;
+} batch_worker_t;
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/// Parse one input file of a fixture.
+static int parse_fixture_file(const batch_fixture_t *fixture, const char *file,
+                              div0_arena_t *arena, t8n_input_t *input) {
+  char path[MAX_PATH_LEN];
+  const int len = snprintf(path, sizeof(path), "%s/%s", fixture->path, file);
+  if (len < 0 || (size_t)len >= sizeof(path)) {
+    fprintf(stderr, "t8n-batch: %s: path too long\n", fixture->name);
+    return DIV0_EXIT_CONFIG_ERROR;
+  }
+
+  json_result_t result;
+  if (strcmp(file, "alloc.json") == 0) {
+    result = t8n_parse_alloc_file(path, arena, &input->pre_state);
+  } else if (strcmp(file, "env.json") == 0) {
+    result = t8n_parse_env_file(path, arena, &input->env);
+  } else {
+    result = t8n_parse_txs_file(path, arena, &input->txs);
+  }
+  if (result.error != JSON_OK) {
+    fprintf(stderr, "t8n-batch: %s: failed to parse %s: %s\n", fixture->name, file,
+            result.detail ? result.detail : json_error_name(result.error));
+    return DIV0_EXIT_JSON_ERROR;
+  }
+  return DIV0_EXIT_SUCCESS;
+}
+
+/// Execute one fixture and write its outputs.
+static int run_fixture(const batch_job_t *job, t8n_workspace_t *workspace,
+                       batch_fixture_t *fixture) {
+  const t8n_runtime_t runtime = t8n_workspace_begin(workspace);
+
+  t8n_input_t input = {};
+  t8n_env_init(&input.env);
+  static const char *const files[] = {"alloc.json", "env.json", "txs.json"};
+  for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+    const int exit_code = parse_fixture_file(fixture, files[i], runtime.arena, &input);
+    if (exit_code != DIV0_EXIT_SUCCESS) {
+      return exit_code;
+    }
+  }
+  fixture->tx_count = input.txs.tx_count;
+
+  world_state_t *ws = nullptr;
+  t8n_result_t result;
+  int exit_code = t8n_transition(&runtime, job->opts, job->fork, &input, &ws, &result);
+  if (exit_code == DIV0_EXIT_SUCCESS) {
+    fixture->gas_used = result.gas_used;
+
+    char dir[MAX_PATH_LEN];
+    const int len = snprintf(dir, sizeof(dir), "%s/%s", job->output_basedir, fixture->name);
+    if (len < 0 || (size_t)len >= sizeof(dir)) {
+      fprintf(stderr, "t8n-batch: %s: output path too long\n", fixture->name);
+      exit_code = DIV0_EXIT_CONFIG_ERROR;
+    } else if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+      fprintf(stderr, "t8n-batch: cannot create %s: %s\n", dir, strerror(errno));
+      exit_code = DIV0_EXIT_IO_ERROR;
+    } else {
+      exit_code = t8n_write_result_output(dir, "result.json", &result);
+      if (exit_code == DIV0_EXIT_SUCCESS) {
+        exit_code = t8n_write_alloc_output(dir, "alloc.json", ws, runtime.arena);
+      }
+    }
+  }
+  if (ws != nullptr) {
+    world_state_destroy(ws);
+  }
+  return exit_code;
+}
+
+static void *worker_main(void *arg) {
+  batch_worker_t *const worker = arg;
+  batch_job_t *const job = worker->job;
+
+  // A worker that cannot start leaves its share to the others
+  t8n_workspace_t workspace = {};
+  if (t8n_workspace_init(&workspace, "t8n-batch")) {
+    for (;;) {
+      const size_t index = atomic_fetch_add(&job->next, 1);
+      if (index >= job->fixtures->count) {
+        break;
+      }
+      batch_fixture_t *const fixture = &job->fixtures->items[index];
+      const uint64_t start = now_ns();
+      fixture->exit_code = run_fixture(job, &workspace, fixture);
+      fixture->elapsed_ns = now_ns() - start;
+      if (fixture->exit_code != DIV0_EXIT_SUCCESS) {
+        fprintf(stderr, "t8n-batch: FAILED %s (exit code %d)\n", fixture->name,
+                fixture->exit_code);
+      }
+    }
+  }
+  t8n_workspace_destroy(&workspace);
+  return nullptr;
+}
+
+// ============================================================================
+// Summary
+// ============================================================================
+
+static int compare_u64(const void *a, const void *b) {
+  const uint64_t x = *(const uint64_t *)a;
+  const uint64_t y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+/// Print aggregate timing and count failures.
+/// @return Number of fixtures that failed or did not run
+static size_t print_summary(const fixture_list_t *fixtures, const size_t workers,
+                            const uint64_t wall_ns, const bool verbose) {
+  size_t failed = 0;
+  size_t not_run = 0;
+  uint64_t total_gas = 0;
+  size_t total_txs = 0;
+  const batch_fixture_t *slowest = nullptr;
+  uint64_t *const times = malloc((fixtures->count + 1) * sizeof(uint64_t));
+  size_t timed = 0;
+
+  for (size_t i = 0; i < fixtures->count; i++) {
+    const batch_fixture_t *const f = &fixtures->items[i];
+    if (f->exit_code == EXIT_NOT_RUN) {
+      not_run++;
+      continue;
+    }
+    if (f->exit_code != DIV0_EXIT_SUCCESS) {
+      failed++;
+    }
+    total_gas += f->gas_used;
+    total_txs += f->tx_count;
+    if (slowest == nullptr || f->elapsed_ns > slowest->elapsed_ns) {
+      slowest = f;
+    }
+    if (times != nullptr) {
+      times[timed++] = f->elapsed_ns;
+    }
+  }
+
+  if (not_run > 0) {
+    fprintf(stderr, "t8n-batch: %zu fixtures did not run\n", not_run);
+  }
+  if (verbose) {
+    const double wall_s = (double)wall_ns / 1e9;
+    fprintf(stderr, "t8n-batch: %zu fixtures (%zu ok, %zu failed) on %zu workers in %.3f s\n",
+            fixtures->count, fixtures->count - failed - not_run, failed, workers, wall_s);
+    if (wall_s > 0.0) {
+      fprintf(stderr, "  throughput: %.1f fixtures/s, %.1f tx/s, %.2f Mgas/s\n",
+              (double)(fixtures->count - not_run) / wall_s, (double)total_txs / wall_s,
+              (double)total_gas / wall_s / 1e6);
+    }
+    if (timed > 0) {
+      qsort(times, timed, sizeof(uint64_t), compare_u64);
+      fprintf(stderr, "  per fixture: median %.3f ms, p95 %.3f ms, max %.3f ms (%s)\n",
+              (double)times[timed / 2] / 1e6, (double)times[(timed * 95) / 100] / 1e6,
+              (double)slowest->elapsed_ns / 1e6, slowest->name);
+    }
+  }
+  free(times);
+  return failed + not_run;
+}
+
+// ============================================================================
+// Command
+// ============================================================================
+
+int cmd_t8n_batch(int argc, const char **argv) {
+  t8n_options_t opts;
+  t8n_options_init(&opts);
+  opts.output_basedir = DEFAULT_OUTPUT_BASEDIR;
+
+  // clang-format off
+  static const char *const usages[] = {
+    "div0 t8n-batch --input DIR|MANIFEST [options]",
+    nullptr,
+  };
+  // clang-format on
+
+  const char *input = nullptr;
+  int workers = 0;
+  int quiet = 0;
+  int reward = (int)opts.reward;
+  // NOLINTBEGIN(bugprone-multi-level-implicit-pointer-conversion)
+  struct argparse_option options[] = {
+      OPT_HELP(),
+      OPT_BOOLEAN('q', "quiet", &quiet, "Suppress the summary", nullptr, 0, 0),
+      OPT_STRING(0, "input", &input, "Fixture directory or manifest file", nullptr, 0, 0),
+      OPT_STRING(0, "output.basedir", &opts.output_basedir, "Output directory", nullptr, 0, 0),
+      OPT_INTEGER('j', "workers", &workers, "Worker threads (default: online CPUs)", nullptr, 0,
+                  0),
+      OPT_GROUP("State options"),
+      OPT_STRING(0, "state.fork", &opts.fork, "Fork name (Shanghai, Cancun, Prague)", nullptr, 0,
+                 0),
+      OPT_INTEGER(0, "state.chainid", &opts.chain_id, "Chain ID", nullptr, 0, 0),
+      OPT_INTEGER(0, "state.reward", &reward, "Block reward (-1 to disable)", nullptr, 0, 0),
+      OPT_END(),
+  };
+  // NOLINTEND(bugprone-multi-level-implicit-pointer-conversion)
+
+  struct argparse argparse;
+  argparse_init(&argparse, options, usages, 0);
+  argparse_describe(&argparse, "\nExecute many state transition fixtures on a worker pool.",
+                    nullptr);
+  argc = argparse_parse(&argparse, argc, argv);
+  (void)argc; // Remaining argc not used after parsing
+
+  opts.verbose = 0; // Per-fixture progress would interleave between workers
+  opts.reward = reward;
+
+  if (input == nullptr) {
+    fprintf(stderr, "t8n-batch: ERROR: --input is required\n");
+    return DIV0_EXIT_CONFIG_ERROR;
+  }
+  const fork_t fork = t8n_parse_fork(opts.fork);
+  if (fork == FORK_UNKNOWN) {
+    fprintf(stderr, "t8n-batch: ERROR: unknown fork '%s'. Supported: Shanghai, Cancun, Prague\n",
+            opts.fork);
+    return DIV0_EXIT_CONFIG_ERROR;
+  }
+
+  fixture_list_t fixtures = {};
+  struct stat st;
+  if (stat(input, &st) != 0) {
+    fprintf(stderr, "t8n-batch: cannot access %s: %s\n", input, strerror(errno));
+    return DIV0_EXIT_IO_ERROR;
+  }
+  const bool listed = S_ISDIR(st.st_mode) ? scan_directory(input, &fixtures)
+                                          : read_manifest(input, &fixtures);
+  if (!listed) {
+    fixture_list_free(&fixtures);
+    return DIV0_EXIT_IO_ERROR;
+  }
+  if (fixtures.count == 0) {
+    fprintf(stderr, "t8n-batch: no fixtures found in %s\n", input);
+    fixture_list_free(&fixtures);
+    return DIV0_EXIT_CONFIG_ERROR;
+  }
+  if (!check_unique_names(&fixtures)) {
+    fixture_list_free(&fixtures);
+    return DIV0_EXIT_CONFIG_ERROR;
+  }
+
+  if (mkdir(opts.output_basedir, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "t8n-batch: cannot create %s: %s\n", opts.output_basedir, strerror(errno));
+    fixture_list_free(&fixtures);
+    return DIV0_EXIT_IO_ERROR;
+  }
+
+  // One worker per online CPU by default, never more than there are fixtures
+  size_t worker_count = workers > 0 ? (size_t)workers : 0;
+  if (worker_count == 0) {
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    worker_count = cpus > 0 ? (size_t)cpus : 1;
+  }
+  if (worker_count > fixtures.count) {
+    worker_count = fixtures.count;
+  }
+
+  batch_job_t job = {
+      .fixtures = &fixtures,
+      .opts = &opts,
+      .fork = fork,
+      .output_basedir = opts.output_basedir,
+  };
+  atomic_init(&job.next, 0);
+
+  batch_worker_t *const pool = calloc(worker_count, sizeof(batch_worker_t));
+  if (pool == nullptr) {
+    fprintf(stderr, "t8n-batch: out of memory\n");
+    fixture_list_free(&fixtures);
+    return DIV0_EXIT_GENERAL_ERROR;
+  }
+
+  const uint64_t start = now_ns();
+  size_t started = 0;
+  for (size_t i = 0; i < worker_count; i++) {
+    pool[i].job = &job;
+    pool[i].started = pthread_create(&pool[i].thread, nullptr, worker_main, &pool[i]) == 0;
+    started += pool[i].started ? 1 : 0;
+  }
+  if (started == 0) {
+    // No threads available: run the batch on this thread
+    batch_worker_t self = {.job = &job};
+    worker_main(&self);
+    started = 1;
+  }
+  for (size_t i = 0; i < worker_count; i++) {
+    if (pool[i].started) {
+      pthread_join(pool[i].thread, nullptr);
+    }
+  }
+  const uint64_t wall_ns = now_ns() - start;
+  free(pool);
+
+  const size_t failures = print_summary(&fixtures, started, wall_ns, !quiet);
+  fixture_list_free(&fixtures);
+  return failures == 0 ? DIV0_EXIT_SUCCESS : DIV0_EXIT_GENERAL_ERROR;
+}
+
+// NOLINTEND(cert-err33-c,clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
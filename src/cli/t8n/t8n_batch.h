@@ -0,0 +1,28 @@
+// t8n_batch.h - Batch state transition subcommand
+
+#ifndef DIV0_CLI_T8N_BATCH_H
+#define DIV0_CLI_T8N_BATCH_H
+
+/// Run the t8n-batch subcommand.
+///
+/// Executes many independent fixtures in one process on a pool of worker
+/// threads. A fixture is a directory holding alloc.json, env.json and
+/// txs.json. --input is either a directory whose subdirectories are fixtures,
+/// or a manifest file listing one fixture directory per line (blank lines and
+/// lines starting with '#' are ignored).
+///
+/// Results go to <output.basedir>/<fixture>/result.json and alloc.json, where
+/// <fixture> is the subdirectory name (directory input) or the listed path
+/// with '/' replaced by '_' (manifest input). A batch in which two fixtures
+/// map to the same output directory is rejected before anything runs.
+/// Aggregate timing is printed at the end.
+///
+/// Each worker owns its arena, EVM, secp256k1 context and jumpdest cache; world
+/// states are isolated because the STC allocator arena is thread-local.
+///
+/// @param argc Argument count (includes "t8n-batch" as argv[0])
+/// @param argv Argument vector
+/// @return Exit code (DIV0_EXIT_GENERAL_ERROR if any fixture failed)
+int cmd_t8n_batch(int argc, const char **argv);
+
+#endif // DIV0_CLI_T8N_BATCH_H
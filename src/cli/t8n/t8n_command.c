@@ -6,13 +6,17 @@
 #include "div0/ethereum/transaction/signer.h"
 #include "div0/evm/block_context.h"
 #include "div0/evm/evm.h"
+#include "div0/evm/profiler.h"
 #include "div0/executor/block_executor.h"
 #include "div0/json/parse.h"
+#include "div0/json/reader.h"
 #include "div0/json/write.h"
 #include "div0/mem/arena.h"
+#include "div0/mem/huge_pages.h"
 #include "div0/state/state_access.h"
 #include "div0/state/world_state.h"
 #include "div0/t8n/alloc.h"
+#include "div0/t8n/alloc_bin.h"
 #include "div0/t8n/env.h"
 #include "div0/t8n/result.h"
 #include "div0/t8n/txs.h"
@@ -26,6 +30,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 // ============================================================================
 // Default Values
@@ -38,6 +43,7 @@ static const char *const DEFAULT_OUTPUT_BASEDIR = ".";
 static const char *const DEFAULT_OUTPUT_RESULT = "result.json";
 static const char *const DEFAULT_OUTPUT_ALLOC = "alloc.json";
 static const char *const DEFAULT_FORK = "Shanghai";
+static const char *const DEFAULT_PROFILE_METRIC = "time";
 static constexpr int DEFAULT_CHAIN_ID = 1;
 static constexpr long DEFAULT_REWARD = 0;
 static constexpr int DEFAULT_VERBOSE = 1;
@@ -108,21 +114,33 @@ static char *read_stdin(size_t *out_len) {
 
 typedef struct {
   div0_arena_t *arena;
+  div0_arena_t *scratch;                 // EVM scratch, rewound after each transaction
+  div0_huge_page_provider_t *huge_pages; // Block provider backing the arena
   world_state_t *ws;
   secp256k1_ctx_t *secp_ctx;
   char *stdin_buffer;   // malloc'd stdin buffer (needs free)
   json_doc_t stdin_doc; // parsed stdin document
+  json_file_t stdin_file; // mapped stdin (--input.sax with stdin redirected from a file)
+  json_file_t txs_file;   // mapped txs.rlp (transactions point into it)
+  t8n_alloc_bin_file_t alloc_file; // mapped binary pre-state (pre_state points into it)
   bool arena_initialized;
+  bool scratch_initialized;
   bool stdin_doc_valid;
 } t8n_context_t;
 
 static void t8n_context_init(t8n_context_t *ctx) {
   ctx->arena = nullptr;
+  ctx->scratch = nullptr;
+  ctx->huge_pages = nullptr;
   ctx->ws = nullptr;
   ctx->secp_ctx = nullptr;
   ctx->stdin_buffer = nullptr;
   ctx->stdin_doc.doc = nullptr;
+  ctx->stdin_file = (json_file_t){};
+  ctx->txs_file = (json_file_t){};
+  ctx->alloc_file = (t8n_alloc_bin_file_t){};
   ctx->arena_initialized = false;
+  ctx->scratch_initialized = false;
   ctx->stdin_doc_valid = false;
 }
 
@@ -143,18 +161,29 @@ static void t8n_context_cleanup(t8n_context_t *ctx) {
     free(ctx->stdin_buffer);
     ctx->stdin_buffer = nullptr;
   }
-  // arena is stack-allocated, destroy frees all malloc'd blocks
+  json_file_unmap(&ctx->stdin_file);
+  json_file_unmap(&ctx->txs_file);
+  t8n_alloc_bin_unmap(&ctx->alloc_file);
+  // arena is stack-allocated, destroy returns all blocks to the provider
   if (ctx->arena_initialized) {
     div0_arena_destroy(ctx->arena);
     ctx->arena_initialized = false;
   }
+  if (ctx->scratch_initialized) {
+    div0_arena_destroy(ctx->scratch);
+    ctx->scratch_initialized = false;
+  }
+  if (ctx->huge_pages != nullptr) {
+    div0_huge_page_provider_destroy(ctx->huge_pages);
+    ctx->huge_pages = nullptr;
+  }
 }
 
 // ============================================================================
 // Fork Parsing
 // ============================================================================
 
-static fork_t parse_fork(const char *name) {
+fork_t t8n_parse_fork(const char *name) {
   if (strcmp(name, "Shanghai") == 0) {
     return FORK_SHANGHAI;
   }
@@ -251,145 +280,454 @@ static bool build_path(char *const out, const char *const basedir, const char *c
 // ignored as there's no meaningful recovery for stderr write failures.
 // NOLINTBEGIN(cert-err33-c,clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
 
-/// Write JSON to stdout or file. Caller retains ownership of writer.
+/// Callback that streams one JSON document.
+typedef void (*stream_fn_t)(json_stream_t *s, const void *ctx);
+
+/// Stream JSON to an already open FILE*.
+/// @return Result of the stream
+static json_result_t stream_json(FILE *const fp, const stream_fn_t fn, const void *const ctx) {
+  json_stream_t s;
+  const json_result_t init_result = json_stream_init(&s, fp, JSON_WRITE_PRETTY);
+  if (init_result.error != JSON_OK) {
+    return init_result;
+  }
+  fn(&s, ctx);
+  return json_stream_finish(&s);
+}
+
+/// Stream JSON to stdout or a file under basedir.
 /// @param basedir Base directory for file output
 /// @param filename Output filename or "stdout"
-/// @param root JSON value to write
-/// @param writer JSON writer (caller must free)
+/// @param fn Callback writing the document
+/// @param ctx Callback context
 /// @param what Description for error messages (e.g., "result", "alloc")
 /// @return Exit code
-static int write_json_to_output(const char *const basedir, const char *const filename,
-                                yyjson_mut_val_t *const root, const json_writer_t *const writer,
-                                const char *const what) {
-  json_result_t write_result;
+static int stream_json_to_output(const char *const basedir, const char *const filename,
+                                 const stream_fn_t fn, const void *const ctx,
+                                 const char *const what) {
   if (is_stdout(filename)) {
-    write_result = json_write_fp(writer, root, stdout, JSON_WRITE_PRETTY);
+    const json_result_t write_result = stream_json(stdout, fn, ctx);
     if (write_result.error != JSON_OK) {
       fprintf(stderr, "t8n: failed to write %s to stdout: %s\n", what,
               write_result.detail ? write_result.detail : json_error_name(write_result.error));
       return DIV0_EXIT_IO_ERROR;
     }
-  } else {
+    return DIV0_EXIT_SUCCESS;
+  }
+
+  char path[MAX_PATH_LEN];
+  if (!build_path(path, basedir, filename)) {
+    fprintf(stderr, "t8n: output path too long: %s/%s\n", basedir, filename);
+    return DIV0_EXIT_CONFIG_ERROR;
+  }
+  FILE *const out = fopen(path, "wb");
+  if (out == nullptr) {
+    fprintf(stderr, "t8n: failed to open %s\n", path);
+    return DIV0_EXIT_IO_ERROR;
+  }
+  const json_result_t write_result = stream_json(out, fn, ctx);
+  const bool closed = fclose(out) == 0;
+  if (write_result.error != JSON_OK || !closed) {
+    fprintf(stderr, "t8n: failed to write %s: %s\n", path,
+            write_result.detail ? write_result.detail : "failed to close file");
+    return DIV0_EXIT_IO_ERROR;
+  }
+  return DIV0_EXIT_SUCCESS;
+}
+
+static void stream_result_fn(json_stream_t *const s, const void *const ctx) {
+  t8n_stream_result(ctx, s);
+}
+
+static void stream_alloc_fn(json_stream_t *const s, const void *const ctx) {
+  t8n_stream_alloc(ctx, s);
+}
+
+int t8n_write_result_output(const char *basedir, const char *filename,
+                            const t8n_result_t *result) {
+  return stream_json_to_output(basedir, filename, stream_result_fn, result, "result");
+}
+
+/// Write a profiler report to a file under basedir.
+/// @param opcodes true for the per-code opcode CSV, false for collapsed stacks
+static int write_profile_output(const char *const basedir, const char *const filename,
+                                const evm_profiler_t *const profiler,
+                                const evm_profile_metric_t metric, const bool opcodes) {
+  char path[MAX_PATH_LEN];
+  if (!build_path(path, basedir, filename)) {
+    fprintf(stderr, "t8n: output path too long: %s/%s\n", basedir, filename);
+    return DIV0_EXIT_CONFIG_ERROR;
+  }
+  FILE *const out = fopen(path, "w");
+  if (out == nullptr) {
+    fprintf(stderr, "t8n: failed to open %s\n", path);
+    return DIV0_EXIT_IO_ERROR;
+  }
+  const bool ok = opcodes ? evm_profiler_write_opcodes(profiler, out)
+                          : evm_profiler_write_collapsed(profiler, out, metric);
+  if (fclose(out) != 0 || !ok) {
+    fprintf(stderr, "t8n: failed to write %s\n", path);
+    return DIV0_EXIT_IO_ERROR;
+  }
+  return DIV0_EXIT_SUCCESS;
+}
+
+int t8n_write_alloc_output(const char *basedir, const char *filename, world_state_t *ws,
+                           div0_arena_t *arena) {
+  state_snapshot_t snapshot = {};
+  if (!world_state_snapshot(ws, arena, &snapshot)) {
+    fprintf(stderr, "t8n: failed to export post-state\n");
+    return DIV0_EXIT_GENERAL_ERROR;
+  }
+
+  if (!is_stdout(filename) && t8n_alloc_is_bin_path(filename)) {
     char path[MAX_PATH_LEN];
     if (!build_path(path, basedir, filename)) {
       fprintf(stderr, "t8n: output path too long: %s/%s\n", basedir, filename);
       return DIV0_EXIT_CONFIG_ERROR;
     }
-    write_result = json_write_file(writer, root, path, JSON_WRITE_PRETTY);
+    const json_result_t write_result = t8n_write_alloc_bin_file(&snapshot, arena, path);
     if (write_result.error != JSON_OK) {
       fprintf(stderr, "t8n: failed to write %s: %s\n", path,
               write_result.detail ? write_result.detail : json_error_name(write_result.error));
-      return DIV0_EXIT_IO_ERROR;
+      return write_result.error == JSON_ERR_IO ? DIV0_EXIT_IO_ERROR : DIV0_EXIT_GENERAL_ERROR;
     }
-  }
-  return DIV0_EXIT_SUCCESS;
-}
-
-static int write_result_output(const char *basedir, const char *filename,
-                               const t8n_result_t *result) {
-  json_writer_t writer;
-  if (json_writer_init(&writer).error != JSON_OK) {
-    fprintf(stderr, "t8n: failed to init JSON writer\n");
-    return DIV0_EXIT_JSON_ERROR;
+    return DIV0_EXIT_SUCCESS;
   }
 
-  yyjson_mut_val_t *root = t8n_write_result(result, &writer);
-  if (root == nullptr) {
-    fprintf(stderr, "t8n: failed to serialize result\n");
-    json_writer_free(&writer);
-    return DIV0_EXIT_JSON_ERROR;
-  }
-
-  const int exit_code = write_json_to_output(basedir, filename, root, &writer, "result");
-  json_writer_free(&writer);
-  return exit_code;
+  return stream_json_to_output(basedir, filename, stream_alloc_fn, &snapshot, "alloc");
 }
 
-static int write_alloc_output(const char *basedir, const char *filename, world_state_t *ws,
-                              div0_arena_t *arena) {
+int t8n_write_combined(const t8n_result_t *result, world_state_t *ws, div0_arena_t *arena,
+                       FILE *out, const json_write_flags_t flags) {
+  // Export post-state
   state_snapshot_t snapshot = {};
   if (!world_state_snapshot(ws, arena, &snapshot)) {
     fprintf(stderr, "t8n: failed to export post-state\n");
     return DIV0_EXIT_GENERAL_ERROR;
   }
 
-  json_writer_t writer;
-  if (json_writer_init(&writer).error != JSON_OK) {
-    fprintf(stderr, "t8n: failed to init JSON writer\n");
+  json_stream_t s;
+  if (json_stream_init(&s, out, flags).error != JSON_OK) {
+    fprintf(stderr, "t8n: failed to init JSON stream\n");
     return DIV0_EXIT_JSON_ERROR;
   }
 
-  yyjson_mut_val_t *root = t8n_write_alloc(&snapshot, &writer);
-  if (root == nullptr) {
-    fprintf(stderr, "t8n: failed to serialize post-state\n");
-    json_writer_free(&writer);
-    return DIV0_EXIT_JSON_ERROR;
+  json_stream_obj_begin(&s);
+  json_stream_key(&s, "result");
+  t8n_stream_result(result, &s);
+  json_stream_key(&s, "alloc");
+  t8n_stream_alloc(&snapshot, &s);
+
+  // Empty body (RLP encoding not implemented)
+  json_stream_key(&s, "body");
+  json_stream_str(&s, "0x");
+  json_stream_obj_end(&s);
+
+  const json_result_t write_result = json_stream_finish(&s);
+  if (write_result.error != JSON_OK) {
+    fprintf(stderr, "t8n: failed to write combined output: %s\n",
+            write_result.detail ? write_result.detail : json_error_name(write_result.error));
+    return DIV0_EXIT_IO_ERROR;
   }
 
-  const int exit_code = write_json_to_output(basedir, filename, root, &writer, "alloc");
-  json_writer_free(&writer);
-  return exit_code;
+  return DIV0_EXIT_SUCCESS;
 }
 
-/// Write combined result+alloc to stdout in geth stream format.
-///
-/// Format: {"result": {...}, "alloc": {...}, "body": "0x"}
-static int write_combined_stdout(const t8n_result_t *result, world_state_t *ws,
-                                 div0_arena_t *arena) {
-  // Export post-state
-  state_snapshot_t snapshot = {};
-  if (!world_state_snapshot(ws, arena, &snapshot)) {
-    fprintf(stderr, "t8n: failed to export post-state\n");
-    return DIV0_EXIT_GENERAL_ERROR;
+// ============================================================================
+// Transition
+// ============================================================================
+
+int t8n_parse_input_value(yyjson_val_t *root, const char *source, div0_arena_t *arena,
+                          t8n_input_t *input) {
+  if (!json_is_obj(root)) {
+    fprintf(stderr, "t8n: %s must be a JSON object with alloc, env, txs keys\n", source);
+    return DIV0_EXIT_JSON_ERROR;
   }
 
-  json_writer_t writer;
-  const json_result_t init_result = json_writer_init(&writer);
-  if (init_result.error != JSON_OK) {
-    fprintf(stderr, "t8n: failed to init JSON writer\n");
+  // Parse alloc
+  yyjson_val_t *alloc_val = json_obj_get(root, "alloc");
+  if (alloc_val == nullptr) {
+    fprintf(stderr, "t8n: missing 'alloc' key in %s JSON\n", source);
+    return DIV0_EXIT_JSON_ERROR;
+  }
+  json_result_t result = t8n_parse_alloc_value(alloc_val, arena, &input->pre_state);
+  if (result.error != JSON_OK) {
+    fprintf(stderr, "t8n: failed to parse alloc from %s: %s\n", source,
+            result.detail ? result.detail : json_error_name(result.error));
     return DIV0_EXIT_JSON_ERROR;
   }
 
-  // Create combined object
-  yyjson_mut_val_t *root = json_write_obj(&writer);
-  if (root == nullptr) {
-    fprintf(stderr, "t8n: failed to create combined output\n");
-    json_writer_free(&writer);
+  // Parse env
+  yyjson_val_t *env_val = json_obj_get(root, "env");
+  if (env_val == nullptr) {
+    fprintf(stderr, "t8n: missing 'env' key in %s JSON\n", source);
+    return DIV0_EXIT_JSON_ERROR;
+  }
+  result = t8n_parse_env_value(env_val, arena, &input->env);
+  if (result.error != JSON_OK) {
+    fprintf(stderr, "t8n: failed to parse env from %s: %s\n", source,
+            result.detail ? result.detail : json_error_name(result.error));
     return DIV0_EXIT_JSON_ERROR;
   }
 
-  // Add result sub-object
-  yyjson_mut_val_t *result_obj = t8n_write_result(result, &writer);
-  if (result_obj == nullptr) {
-    fprintf(stderr, "t8n: failed to serialize result\n");
-    json_writer_free(&writer);
+  // Parse txs
+  yyjson_val_t *txs_val = json_obj_get(root, "txs");
+  if (txs_val == nullptr) {
+    fprintf(stderr, "t8n: missing 'txs' key in %s JSON\n", source);
+    return DIV0_EXIT_JSON_ERROR;
+  }
+  result = t8n_parse_txs_value(txs_val, arena, &input->txs);
+  if (result.error != JSON_OK) {
+    fprintf(stderr, "t8n: failed to parse txs from %s: %s\n", source,
+            result.detail ? result.detail : json_error_name(result.error));
     return DIV0_EXIT_JSON_ERROR;
   }
-  json_obj_add(&writer, root, "result", result_obj);
+  return DIV0_EXIT_SUCCESS;
+}
+
+int t8n_read_input(json_reader_t *r, const char *source, div0_arena_t *arena,
+                   t8n_input_t *input) {
+  if (json_reader_peek(r) != JSON_TOKEN_OBJ) {
+    fprintf(stderr, "t8n: %s must be a JSON object with alloc, env, txs keys\n", source);
+    return DIV0_EXIT_JSON_ERROR;
+  }
+  (void)json_reader_obj_begin(r);
+
+  bool has_alloc = false;
+  bool has_env = false;
+  bool has_txs = false;
+  const char *key;
+  size_t key_len;
+  while (json_reader_obj_next(r, &key, &key_len)) {
+    json_result_t result = json_ok();
+    const char *what = nullptr;
+    if (json_reader_key_eq(key, key_len, "alloc")) {
+      what = "alloc";
+      has_alloc = true;
+      result = t8n_read_alloc(r, arena, &input->pre_state);
+    } else if (json_reader_key_eq(key, key_len, "env")) {
+      what = "env";
+      has_env = true;
+      result = t8n_read_env(r, arena, &input->env);
+    } else if (json_reader_key_eq(key, key_len, "txs")) {
+      what = "txs";
+      has_txs = true;
+      result = t8n_read_txs(r, arena, &input->txs);
+    } else {
+      (void)json_reader_skip(r);
+    }
+    if (result.error != JSON_OK) {
+      fprintf(stderr, "t8n: failed to parse %s from %s: %s\n", what, source,
+              result.detail ? result.detail : json_error_name(result.error));
+      return DIV0_EXIT_JSON_ERROR;
+    }
+  }
 
-  // Add alloc sub-object
-  yyjson_mut_val_t *alloc_obj = t8n_write_alloc(&snapshot, &writer);
-  if (alloc_obj == nullptr) {
-    fprintf(stderr, "t8n: failed to serialize alloc\n");
-    json_writer_free(&writer);
+  const json_result_t result = json_reader_finish(r);
+  if (result.error != JSON_OK) {
+    fprintf(stderr, "t8n: failed to parse %s: %s\n", source,
+            result.detail ? result.detail : json_error_name(result.error));
+    return DIV0_EXIT_JSON_ERROR;
+  }
+  if (!has_alloc) {
+    fprintf(stderr, "t8n: missing 'alloc' key in %s JSON\n", source);
+    return DIV0_EXIT_JSON_ERROR;
+  }
+  if (!has_env) {
+    fprintf(stderr, "t8n: missing 'env' key in %s JSON\n", source);
+    return DIV0_EXIT_JSON_ERROR;
+  }
+  if (!has_txs) {
+    fprintf(stderr, "t8n: missing 'txs' key in %s JSON\n", source);
     return DIV0_EXIT_JSON_ERROR;
   }
-  // NOLINTNEXTLINE(readability-suspicious-call-argument) - false positive
-  json_obj_add(&writer, root, "alloc", alloc_obj);
+  return DIV0_EXIT_SUCCESS;
+}
 
-  // Add empty body (RLP encoding not implemented)
-  json_obj_add_str(&writer, root, "body", "0x");
+int t8n_transition(const t8n_runtime_t *rt, const t8n_options_t *opts, const fork_t fork,
+                   const t8n_input_t *input, world_state_t **out_ws, t8n_result_t *out_result) {
+  div0_arena_t *const arena = rt->arena;
+  const t8n_env_t *const env = &input->env;
+  const t8n_txs_t *const txs = &input->txs;
+  *out_ws = nullptr;
 
-  // Write to stdout
-  const json_result_t write_result = json_write_fp(&writer, root, stdout, JSON_WRITE_PRETTY);
-  if (write_result.error != JSON_OK) {
-    fprintf(stderr, "t8n: failed to write combined output to stdout: %s\n",
-            write_result.detail ? write_result.detail : json_error_name(write_result.error));
-    json_writer_free(&writer);
-    return DIV0_EXIT_IO_ERROR;
+  // Build initial world state
+  if (opts->verbose) {
+    fprintf(stderr, "t8n: building initial state...\n");
+  }
+  world_state_t *ws = world_state_create(arena);
+  if (ws == nullptr) {
+    fprintf(stderr, "t8n: failed to create world state\n");
+    return DIV0_EXIT_GENERAL_ERROR;
+  }
+  *out_ws = ws;
+  world_state_set_jumpdest_cache(ws, rt->jumpdest_cache);
+  build_state_from_snapshot(ws, &input->pre_state);
+
+  // Build block context from env
+  block_context_t block_ctx;
+  block_context_init(&block_ctx);
+  block_ctx.number = env->number;
+  block_ctx.timestamp = env->timestamp;
+  block_ctx.gas_limit = env->gas_limit;
+  block_ctx.chain_id = (uint64_t)opts->chain_id;
+  block_ctx.coinbase = env->coinbase;
+
+  if (env->has_base_fee) {
+    block_ctx.base_fee = env->base_fee;
+  }
+  if (env->has_prev_randao) {
+    block_ctx.prev_randao = env->prev_randao;
+  }
+
+  // Set up block hash callback
+  block_hash_ctx_t hash_ctx = {.hashes = env->block_hashes, .count = env->block_hash_count};
+  block_ctx.get_block_hash = get_block_hash_cb;
+  block_ctx.block_hash_user_data = &hash_ctx;
+
+  // The EVM's pools live in the transition's arenas, so it is initialized every time
+  evm_t *const evm = rt->evm;
+  evm_init(evm, rt->scratch != nullptr ? rt->scratch : arena, fork);
+  (void)evm_enable_mapped_memory(evm);
+  evm_set_secp_ctx(evm, rt->secp_ctx);
+  evm_set_initcode_cache(evm, rt->initcode_cache);
+  if (rt->tracer != nullptr) {
+    evm_set_tracer(evm, rt->tracer);
+  }
+
+  // Build transaction array with sender recovery
+  if (opts->verbose) {
+    fprintf(stderr, "t8n: executing %zu transactions...\n", txs->tx_count);
+  }
+  block_tx_t *block_txs = div0_arena_alloc(arena, txs->tx_count * sizeof(block_tx_t));
+  for (size_t i = 0; i < txs->tx_count; i++) {
+    block_txs[i].tx = &txs->txs[i];
+    block_txs[i].original_index = i;
+
+    // Memoise both hashes so recovery and the receipt reuse them, then recover
+    // the sender from the signature (the RLP for hashing is scratch, rewound right after)
+    const div0_arena_mark_t recover_mark = div0_arena_mark(arena);
+    transaction_cache_hashes(&txs->txs[i], arena);
+    ecrecover_result_t recover_result =
+        transaction_recover_sender(rt->secp_ctx, &txs->txs[i], arena);
+    div0_arena_rewind(arena, recover_mark);
+    if (recover_result.success) {
+      block_txs[i].sender = recover_result.address;
+      block_txs[i].sender_recovered = true;
+    } else {
+      // Failed to recover sender - will be rejected
+      block_txs[i].sender = address_zero();
+      block_txs[i].sender_recovered = false;
+    }
+  }
+
+  // Execute transactions
+  block_executor_t executor;
+  block_executor_init(&executor, world_state_access(ws), &block_ctx, evm, arena,
+                      (uint64_t)opts->chain_id);
+  executor.rewind_evm_arena = rt->scratch != nullptr;
+
+  block_exec_result_t exec_result;
+  const bool executed = block_executor_run(&executor, block_txs, txs->tx_count, &exec_result);
+  evm_destroy(evm);
+  if (!executed) {
+    fprintf(stderr, "t8n: block execution failed\n");
+    return DIV0_EXIT_EVM_ERROR;
+  }
+
+  // Apply block reward if enabled (reward >= 0)
+  if (opts->reward >= 0) {
+    uint256_t reward = uint256_from_u64((uint64_t)opts->reward);
+    state_access_t *state = world_state_access(ws);
+    uint256_t current_balance = state_get_balance(state, &env->coinbase);
+    uint256_t new_balance = uint256_add(current_balance, reward);
+    state_set_balance(state, &env->coinbase, new_balance);
+    if (opts->verbose && opts->reward > 0) {
+      fprintf(stderr, "  applied block reward: %ld wei to coinbase\n", opts->reward);
+    }
+  }
+
+  if (opts->verbose) {
+    fprintf(stderr, "  executed: %zu successful, %zu rejected, %" PRIu64 " gas used\n",
+            exec_result.receipt_count, exec_result.rejected_count, exec_result.gas_used);
+  }
+
+  // Build t8n result
+  t8n_result_t *const t8n_result = out_result;
+  t8n_result_init(t8n_result);
+
+  t8n_result->state_root = exec_result.state_root;
+  t8n_result->gas_used = exec_result.gas_used;
+
+  // TODO: Compute tx_root, receipts_root, logs_hash, logs_bloom
+  // For now, use empty values
+  t8n_result->tx_root = hash_zero();
+  t8n_result->receipts_root = hash_zero();
+  t8n_result->logs_hash = hash_zero();
+  __builtin___memset_chk(t8n_result->logs_bloom, 0, sizeof(t8n_result->logs_bloom),
+                         sizeof(t8n_result->logs_bloom));
+
+  // Copy receipts
+  t8n_result->receipt_count = exec_result.receipt_count;
+  if (exec_result.receipt_count > 0) {
+    t8n_result->receipts =
+        div0_arena_alloc(arena, exec_result.receipt_count * sizeof(t8n_receipt_t));
+    for (size_t i = 0; i < exec_result.receipt_count; i++) {
+      exec_receipt_t *r = &exec_result.receipts[i];
+      t8n_receipt_t *tr = &t8n_result->receipts[i];
+      tr->type = r->tx_type;
+      tr->tx_hash = r->tx_hash;
+      tr->transaction_index = i;
+      tr->gas_used = r->gas_used;
+      tr->cumulative_gas = r->cumulative_gas;
+      tr->status = r->success;
+      __builtin___memset_chk(tr->bloom, 0, sizeof(tr->bloom), sizeof(tr->bloom));
+      tr->logs = nullptr;
+      tr->log_count = 0;
+      tr->contract_address = r->created_address;
+    }
+  }
+
+  // Copy rejected transactions
+  t8n_result->rejected_count = exec_result.rejected_count;
+  if (exec_result.rejected_count > 0) {
+    t8n_result->rejected =
+        div0_arena_alloc(arena, exec_result.rejected_count * sizeof(t8n_rejected_tx_t));
+    for (size_t i = 0; i < exec_result.rejected_count; i++) {
+      t8n_result->rejected[i].index = exec_result.rejected[i].index;
+      t8n_result->rejected[i].error = exec_result.rejected[i].error_message;
+    }
+  }
+
+  // Set optional fields from env
+  if (env->has_difficulty) {
+    t8n_result->has_current_difficulty = true;
+    t8n_result->current_difficulty = env->difficulty;
+  }
+
+  // Base fee is required for EIP-1559+ forks (London onwards, including Shanghai)
+  // All currently supported forks (Shanghai, Cancun, Prague) require base fee
+  t8n_result->has_current_base_fee = true;
+  if (env->has_base_fee) {
+    t8n_result->current_base_fee = env->base_fee;
+  } else {
+    // Default base fee matching execution-spec-tests framework (0x7 = 7 wei)
+    t8n_result->current_base_fee = uint256_from_u64(7);
+  }
+  if (fork >= FORK_CANCUN && env->has_excess_blob_gas) {
+    t8n_result->has_current_excess_blob_gas = true;
+    t8n_result->current_excess_blob_gas = env->excess_blob_gas;
+    t8n_result->has_blob_gas_used = true;
+    t8n_result->blob_gas_used = exec_result.blob_gas_used;
   }
 
-  json_writer_free(&writer);
+  // Withdrawals root is required for Shanghai+ forks (EIP-4895)
+  // All currently supported forks require withdrawals root
+  // TODO: Compute actual root from withdrawals list when implemented
+  // For now, use empty trie root (keccak256(RLP([])))
+  t8n_result->has_withdrawals_root = true;
+  t8n_result->withdrawals_root = MPT_EMPTY_ROOT;
   return DIV0_EXIT_SUCCESS;
 }
 
@@ -403,6 +741,7 @@ void t8n_options_init(t8n_options_t *opts) {
   opts->input_alloc = DEFAULT_INPUT_ALLOC;
   opts->input_env = DEFAULT_INPUT_ENV;
   opts->input_txs = DEFAULT_INPUT_TXS;
+  opts->input_sax = 0;
   opts->output_basedir = DEFAULT_OUTPUT_BASEDIR;
   opts->output_result = DEFAULT_OUTPUT_RESULT;
   opts->output_alloc = DEFAULT_OUTPUT_ALLOC;
@@ -410,6 +749,9 @@ void t8n_options_init(t8n_options_t *opts) {
   opts->fork = DEFAULT_FORK;
   opts->chain_id = DEFAULT_CHAIN_ID;
   opts->reward = DEFAULT_REWARD;
+  opts->profile = nullptr;
+  opts->profile_metric = DEFAULT_PROFILE_METRIC;
+  opts->profile_opcodes = nullptr;
   opts->verbose = DEFAULT_VERBOSE;
 }
 
@@ -434,13 +776,18 @@ int cmd_t8n(int argc, const char **argv) {
       OPT_HELP(),
       OPT_BOOLEAN('q', "quiet", &quiet, "Suppress progress messages", nullptr, 0, 0),
       OPT_GROUP("Input options"),
-      OPT_STRING(0, "input.alloc", &opts.input_alloc, "Input allocations file", nullptr, 0, 0),
+      OPT_STRING(0, "input.alloc", &opts.input_alloc, "Input allocations file (.bin: binary)",
+                 nullptr, 0, 0),
       OPT_STRING(0, "input.env", &opts.input_env, "Input environment file", nullptr, 0, 0),
-      OPT_STRING(0, "input.txs", &opts.input_txs, "Input transactions file", nullptr, 0, 0),
+      OPT_STRING(0, "input.txs", &opts.input_txs, "Input transactions file (.rlp: RLP list)",
+                 nullptr, 0, 0),
+      OPT_BOOLEAN(0, "input.sax", &opts.input_sax, "Single-pass JSON input parsing (no DOM)",
+                  nullptr, 0, 0),
       OPT_GROUP("Output options"),
       OPT_STRING(0, "output.basedir", &opts.output_basedir, "Output directory", nullptr, 0, 0),
       OPT_STRING(0, "output.result", &opts.output_result, "Result output file", nullptr, 0, 0),
-      OPT_STRING(0, "output.alloc", &opts.output_alloc, "Post-state output file", nullptr, 0, 0),
+      OPT_STRING(0, "output.alloc", &opts.output_alloc, "Post-state output file (.bin: binary)",
+                 nullptr, 0, 0),
       // TODO: --output.body for RLP-encoded transactions is not yet implemented
       OPT_STRING(0, "output.body", &opts.output_body, "RLP transactions output (NOT IMPLEMENTED)",
                  nullptr, 0, 0),
@@ -449,6 +796,13 @@ int cmd_t8n(int argc, const char **argv) {
                  0),
       OPT_INTEGER(0, "state.chainid", &opts.chain_id, "Chain ID", nullptr, 0, 0),
       OPT_INTEGER(0, "state.reward", &opts.reward, "Block reward (-1 to disable)", nullptr, 0, 0),
+      OPT_GROUP("Profiling options"),
+      OPT_STRING(0, "profile", &opts.profile, "Collapsed-stack profile output (flamegraph)",
+                 nullptr, 0, 0),
+      OPT_STRING(0, "profile.metric", &opts.profile_metric, "Profile weight (time, gas)", nullptr,
+                 0, 0),
+      OPT_STRING(0, "profile.opcodes", &opts.profile_opcodes, "Per-contract opcode CSV output",
+                 nullptr, 0, 0),
       OPT_END(),
   };
   // NOLINTEND(bugprone-multi-level-implicit-pointer-conversion)
@@ -463,13 +817,26 @@ int cmd_t8n(int argc, const char **argv) {
   opts.verbose = !quiet;
 
   // Validate fork
-  fork_t fork = parse_fork(opts.fork);
+  fork_t fork = t8n_parse_fork(opts.fork);
   if (fork == FORK_UNKNOWN) {
     fprintf(stderr, "t8n: ERROR: unknown fork '%s'. Supported: Shanghai, Cancun, Prague\n",
             opts.fork);
     return DIV0_EXIT_CONFIG_ERROR;
   }
 
+  // Validate profile metric
+  evm_profile_metric_t profile_metric;
+  if (strcmp(opts.profile_metric, "time") == 0) {
+    profile_metric = EVM_PROFILE_TIME;
+  } else if (strcmp(opts.profile_metric, "gas") == 0) {
+    profile_metric = EVM_PROFILE_GAS;
+  } else {
+    fprintf(stderr, "t8n: ERROR: unknown profile metric '%s'. Supported: time, gas\n",
+            opts.profile_metric);
+    return DIV0_EXIT_CONFIG_ERROR;
+  }
+  const bool profiling = opts.profile != nullptr || opts.profile_opcodes != nullptr;
+
   // Warn if --output.body is specified (not implemented)
   if (opts.output_body != nullptr) {
     fprintf(stderr, "t8n: WARNING: --output.body is not implemented, ignoring\n");
@@ -479,15 +846,38 @@ int cmd_t8n(int argc, const char **argv) {
   t8n_context_t ctx;
   t8n_context_init(&ctx);
 
-  // Create arena for allocations
+  // Create arena for allocations. State loading dominates, so blocks are carved
+  // from pre-faulted huge page regions to cut page faults and TLB misses.
+  div0_huge_page_provider_t huge_pages;
+  if (!div0_huge_page_provider_init(&huge_pages, 0, true)) {
+    fprintf(stderr, "t8n: failed to create block provider\n");
+    return DIV0_EXIT_GENERAL_ERROR;
+  }
+  ctx.huge_pages = &huge_pages;
+
   div0_arena_t arena;
-  if (!div0_arena_init(&arena)) {
+  const div0_arena_config_t arena_config = {
+      .block_size = DIV0_HUGE_PAGE_BLOCK_SIZE,
+      .provider = div0_huge_page_provider(&huge_pages),
+  };
+  if (!div0_arena_init_with(&arena, &arena_config)) {
     fprintf(stderr, "t8n: failed to create arena\n");
+    t8n_context_cleanup(&ctx);
     return DIV0_EXIT_GENERAL_ERROR;
   }
   ctx.arena = &arena;
   ctx.arena_initialized = true;
 
+  // Per-transaction EVM scratch stays out of the state's arena so it can be rewound
+  div0_arena_t scratch;
+  if (!div0_arena_init(&scratch)) {
+    fprintf(stderr, "t8n: failed to create scratch arena\n");
+    t8n_context_cleanup(&ctx);
+    return DIV0_EXIT_GENERAL_ERROR;
+  }
+  ctx.scratch = &scratch;
+  ctx.scratch_initialized = true;
+
   // Parse input files
   if (opts.verbose) {
     fprintf(stderr, "t8n: loading inputs...\n");
@@ -498,17 +888,39 @@ int cmd_t8n(int argc, const char **argv) {
             opts.output_result, opts.output_alloc);
   }
 
-  state_snapshot_t pre_state = {};
-  t8n_env_t env;
-  t8n_env_init(&env);
-  t8n_txs_t txs = {};
+  t8n_input_t input = {};
+  t8n_env_init(&input.env);
   json_result_t result;
 
   // Check if all inputs are from stdin (combined JSON mode)
   bool all_stdin =
       is_stdin(opts.input_alloc) && is_stdin(opts.input_env) && is_stdin(opts.input_txs);
 
-  if (all_stdin) {
+  if (all_stdin && opts.input_sax) {
+    // Single pass over combined JSON; map stdin when it is redirected from a file
+    const char *data;
+    size_t data_len = 0;
+    if (json_file_map_fd(STDIN_FILENO, &ctx.stdin_file).error == JSON_OK) {
+      data = ctx.stdin_file.data;
+      data_len = ctx.stdin_file.size;
+    } else {
+      ctx.stdin_buffer = read_stdin(&data_len);
+      if (ctx.stdin_buffer == nullptr) {
+        fprintf(stderr, "t8n: failed to read stdin\n");
+        t8n_context_cleanup(&ctx);
+        return DIV0_EXIT_IO_ERROR;
+      }
+      data = ctx.stdin_buffer;
+    }
+
+    json_reader_t reader;
+    json_reader_init(&reader, data, data_len);
+    const int exit_code = t8n_read_input(&reader, "stdin", &arena, &input);
+    if (exit_code != DIV0_EXIT_SUCCESS) {
+      t8n_context_cleanup(&ctx);
+      return exit_code;
+    }
+  } else if (all_stdin) {
     // Read combined JSON from stdin: {"alloc": {...}, "env": {...}, "txs": [...]}
     size_t stdin_len = 0;
     ctx.stdin_buffer = read_stdin(&stdin_len);
@@ -528,60 +940,26 @@ int cmd_t8n(int argc, const char **argv) {
     }
     ctx.stdin_doc_valid = true;
 
-    yyjson_val_t *root = json_doc_root(&ctx.stdin_doc);
-    if (!json_is_obj(root)) {
-      fprintf(stderr, "t8n: stdin must be a JSON object with alloc, env, txs keys\n");
-      t8n_context_cleanup(&ctx);
-      return DIV0_EXIT_JSON_ERROR;
-    }
-
-    // Parse alloc from stdin
-    yyjson_val_t *alloc_val = json_obj_get(root, "alloc");
-    if (alloc_val == nullptr) {
-      fprintf(stderr, "t8n: missing 'alloc' key in stdin JSON\n");
-      t8n_context_cleanup(&ctx);
-      return DIV0_EXIT_JSON_ERROR;
-    }
-    result = t8n_parse_alloc_value(alloc_val, &arena, &pre_state);
-    if (result.error != JSON_OK) {
-      fprintf(stderr, "t8n: failed to parse alloc from stdin: %s\n",
-              result.detail ? result.detail : json_error_name(result.error));
-      t8n_context_cleanup(&ctx);
-      return DIV0_EXIT_JSON_ERROR;
-    }
-
-    // Parse env from stdin
-    yyjson_val_t *env_val = json_obj_get(root, "env");
-    if (env_val == nullptr) {
-      fprintf(stderr, "t8n: missing 'env' key in stdin JSON\n");
-      t8n_context_cleanup(&ctx);
-      return DIV0_EXIT_JSON_ERROR;
-    }
-    result = t8n_parse_env_value(env_val, &arena, &env);
-    if (result.error != JSON_OK) {
-      fprintf(stderr, "t8n: failed to parse env from stdin: %s\n",
-              result.detail ? result.detail : json_error_name(result.error));
-      t8n_context_cleanup(&ctx);
-      return DIV0_EXIT_JSON_ERROR;
-    }
-
-    // Parse txs from stdin
-    yyjson_val_t *txs_val = json_obj_get(root, "txs");
-    if (txs_val == nullptr) {
-      fprintf(stderr, "t8n: missing 'txs' key in stdin JSON\n");
-      t8n_context_cleanup(&ctx);
-      return DIV0_EXIT_JSON_ERROR;
-    }
-    result = t8n_parse_txs_value(txs_val, &arena, &txs);
-    if (result.error != JSON_OK) {
-      fprintf(stderr, "t8n: failed to parse txs from stdin: %s\n",
-              result.detail ? result.detail : json_error_name(result.error));
+    const int exit_code =
+        t8n_parse_input_value(json_doc_root(&ctx.stdin_doc), "stdin", &arena, &input);
+    if (exit_code != DIV0_EXIT_SUCCESS) {
       t8n_context_cleanup(&ctx);
-      return DIV0_EXIT_JSON_ERROR;
+      return exit_code;
     }
   } else {
     // Parse from individual files
-    result = t8n_parse_alloc_file(opts.input_alloc, &arena, &pre_state);
+    if (t8n_alloc_is_bin_path(opts.input_alloc)) {
+      // Binary snapshot: map and import in place, no parsing
+      result = t8n_alloc_bin_map(opts.input_alloc, &ctx.alloc_file);
+      if (result.error == JSON_OK) {
+        result = t8n_parse_alloc_bin(ctx.alloc_file.data, ctx.alloc_file.size, &arena,
+                                     &input.pre_state);
+      }
+    } else if (opts.input_sax) {
+      result = t8n_read_alloc_file(opts.input_alloc, &arena, &input.pre_state);
+    } else {
+      result = t8n_parse_alloc_file(opts.input_alloc, &arena, &input.pre_state);
+    }
     if (result.error != JSON_OK) {
       fprintf(stderr, "t8n: failed to parse %s: %s\n", opts.input_alloc,
               result.detail ? result.detail : json_error_name(result.error));
@@ -589,7 +967,8 @@ int cmd_t8n(int argc, const char **argv) {
       return DIV0_EXIT_JSON_ERROR;
     }
 
-    result = t8n_parse_env_file(opts.input_env, &arena, &env);
+    result = opts.input_sax ? t8n_read_env_file(opts.input_env, &arena, &input.env)
+                            : t8n_parse_env_file(opts.input_env, &arena, &input.env);
     if (result.error != JSON_OK) {
       fprintf(stderr, "t8n: failed to parse %s: %s\n", opts.input_env,
               result.detail ? result.detail : json_error_name(result.error));
@@ -597,7 +976,14 @@ int cmd_t8n(int argc, const char **argv) {
       return DIV0_EXIT_JSON_ERROR;
     }
 
-    result = t8n_parse_txs_file(opts.input_txs, &arena, &txs);
+    if (t8n_txs_is_rlp_path(opts.input_txs)) {
+      // Decoded without copying calldata; the mapping lives until cleanup
+      result = t8n_parse_txs_rlp_file(opts.input_txs, &arena, &ctx.txs_file, &input.txs);
+    } else if (opts.input_sax) {
+      result = t8n_read_txs_file(opts.input_txs, &arena, &input.txs);
+    } else {
+      result = t8n_parse_txs_file(opts.input_txs, &arena, &input.txs);
+    }
     if (result.error != JSON_OK) {
       fprintf(stderr, "t8n: failed to parse %s: %s\n", opts.input_txs,
               result.detail ? result.detail : json_error_name(result.error));
@@ -607,44 +993,10 @@ int cmd_t8n(int argc, const char **argv) {
   }
 
   if (opts.verbose) {
-    fprintf(stderr, "  loaded: %zu accounts, %zu transactions\n", pre_state.account_count,
-            txs.tx_count);
+    fprintf(stderr, "  loaded: %zu accounts, %zu transactions\n", input.pre_state.account_count,
+            input.txs.tx_count);
   }
 
-  // Build initial world state
-  if (opts.verbose) {
-    fprintf(stderr, "t8n: building initial state...\n");
-  }
-  world_state_t *ws = world_state_create(&arena);
-  if (ws == nullptr) {
-    fprintf(stderr, "t8n: failed to create world state\n");
-    t8n_context_cleanup(&ctx);
-    return DIV0_EXIT_GENERAL_ERROR;
-  }
-  ctx.ws = ws;
-  build_state_from_snapshot(ws, &pre_state);
-
-  // Build block context from env
-  block_context_t block_ctx;
-  block_context_init(&block_ctx);
-  block_ctx.number = env.number;
-  block_ctx.timestamp = env.timestamp;
-  block_ctx.gas_limit = env.gas_limit;
-  block_ctx.chain_id = (uint64_t)opts.chain_id;
-  block_ctx.coinbase = env.coinbase;
-
-  if (env.has_base_fee) {
-    block_ctx.base_fee = env.base_fee;
-  }
-  if (env.has_prev_randao) {
-    block_ctx.prev_randao = env.prev_randao;
-  }
-
-  // Set up block hash callback
-  block_hash_ctx_t hash_ctx = {.hashes = env.block_hashes, .count = env.block_hash_count};
-  block_ctx.get_block_hash = get_block_hash_cb;
-  block_ctx.block_hash_user_data = &hash_ctx;
-
   // Create EVM (large struct, requires 64-byte alignment for cache-line aligned fields)
   evm_t *evm = div0_arena_alloc_large(&arena, sizeof(evm_t), 64);
   if (evm == nullptr) {
@@ -652,170 +1004,95 @@ int cmd_t8n(int argc, const char **argv) {
     t8n_context_cleanup(&ctx);
     return DIV0_EXIT_GENERAL_ERROR;
   }
-  evm_init(evm, &arena, fork);
 
-  // Initialize secp256k1 context for signature recovery
-  secp256k1_ctx_t *secp_ctx = secp256k1_ctx_create();
-  if (secp_ctx == nullptr) {
-    fprintf(stderr, "t8n: failed to create secp256k1 context\n");
+  // Create the profiler (attached as the tracer, which selects the traced interpreter)
+  evm_profiler_t profiler = {};
+  if (profiling && !evm_profiler_init(&profiler, &arena)) {
+    fprintf(stderr, "t8n: failed to create profiler\n");
     t8n_context_cleanup(&ctx);
     return DIV0_EXIT_GENERAL_ERROR;
   }
-  ctx.secp_ctx = secp_ctx;
 
-  // Build transaction array with sender recovery
-  if (opts.verbose) {
-    fprintf(stderr, "t8n: executing %zu transactions...\n", txs.tx_count);
-  }
-  block_tx_t *block_txs = div0_arena_alloc(&arena, txs.tx_count * sizeof(block_tx_t));
-  for (size_t i = 0; i < txs.tx_count; i++) {
-    block_txs[i].tx = &txs.txs[i];
-    block_txs[i].original_index = i;
-
-    // Recover sender from signature
-    ecrecover_result_t recover_result = transaction_recover_sender(secp_ctx, &txs.txs[i], &arena);
-    if (recover_result.success) {
-      block_txs[i].sender = recover_result.address;
-      block_txs[i].sender_recovered = true;
-    } else {
-      // Failed to recover sender - will be rejected
-      block_txs[i].sender = address_zero();
-      block_txs[i].sender_recovered = false;
-    }
-  }
-
-  // Execute transactions
-  block_executor_t executor;
-  block_executor_init(&executor, world_state_access(ws), &block_ctx, evm, &arena,
-                      (uint64_t)opts.chain_id);
-
-  block_exec_result_t exec_result;
-  if (!block_executor_run(&executor, block_txs, txs.tx_count, &exec_result)) {
-    fprintf(stderr, "t8n: block execution failed\n");
+  // Init code analyses, shared by the deployments of this transition
+  initcode_cache_t initcode_cache;
+  if (!initcode_cache_init(&initcode_cache, &arena)) {
+    fprintf(stderr, "t8n: failed to create init code cache\n");
     t8n_context_cleanup(&ctx);
-    return DIV0_EXIT_EVM_ERROR;
-  }
-
-  // Apply block reward if enabled (reward >= 0)
-  if (opts.reward >= 0) {
-    uint256_t reward = uint256_from_u64((uint64_t)opts.reward);
-    state_access_t *state = world_state_access(ws);
-    uint256_t current_balance = state_get_balance(state, &env.coinbase);
-    uint256_t new_balance = uint256_add(current_balance, reward);
-    state_set_balance(state, &env.coinbase, new_balance);
-    if (opts.verbose && opts.reward > 0) {
-      fprintf(stderr, "  applied block reward: %ld wei to coinbase\n", opts.reward);
-    }
+    return DIV0_EXIT_GENERAL_ERROR;
   }
 
-  if (opts.verbose) {
-    fprintf(stderr, "  executed: %zu successful, %zu rejected, %" PRIu64 " gas used\n",
-            exec_result.receipt_count, exec_result.rejected_count, exec_result.gas_used);
+  // Initialize secp256k1 context for signature recovery
+  ctx.secp_ctx = secp256k1_ctx_create();
+  if (ctx.secp_ctx == nullptr) {
+    fprintf(stderr, "t8n: failed to create secp256k1 context\n");
+    t8n_context_cleanup(&ctx);
+    return DIV0_EXIT_GENERAL_ERROR;
   }
 
-  // Build t8n result
+  const t8n_runtime_t runtime = {
+      .arena = &arena,
+      .scratch = &scratch,
+      .secp_ctx = ctx.secp_ctx,
+      .evm = evm,
+      .jumpdest_cache = nullptr,
+      .initcode_cache = &initcode_cache,
+      .tracer = profiling ? &profiler.base : nullptr,
+  };
   t8n_result_t t8n_result;
-  t8n_result_init(&t8n_result);
-
-  t8n_result.state_root = exec_result.state_root;
-  t8n_result.gas_used = exec_result.gas_used;
-
-  // TODO: Compute tx_root, receipts_root, logs_hash, logs_bloom
-  // For now, use empty values
-  t8n_result.tx_root = hash_zero();
-  t8n_result.receipts_root = hash_zero();
-  t8n_result.logs_hash = hash_zero();
-  __builtin___memset_chk(t8n_result.logs_bloom, 0, sizeof(t8n_result.logs_bloom),
-                         sizeof(t8n_result.logs_bloom));
-
-  // Copy receipts
-  t8n_result.receipt_count = exec_result.receipt_count;
-  if (exec_result.receipt_count > 0) {
-    t8n_result.receipts =
-        div0_arena_alloc(&arena, exec_result.receipt_count * sizeof(t8n_receipt_t));
-    for (size_t i = 0; i < exec_result.receipt_count; i++) {
-      exec_receipt_t *r = &exec_result.receipts[i];
-      t8n_receipt_t *tr = &t8n_result.receipts[i];
-      tr->type = r->tx_type;
-      tr->tx_hash = r->tx_hash;
-      tr->transaction_index = i;
-      tr->gas_used = r->gas_used;
-      tr->cumulative_gas = r->cumulative_gas;
-      tr->status = r->success;
-      __builtin___memset_chk(tr->bloom, 0, sizeof(tr->bloom), sizeof(tr->bloom));
-      tr->logs = nullptr;
-      tr->log_count = 0;
-      tr->contract_address = r->created_address;
-    }
-  }
-
-  // Copy rejected transactions
-  t8n_result.rejected_count = exec_result.rejected_count;
-  if (exec_result.rejected_count > 0) {
-    t8n_result.rejected =
-        div0_arena_alloc(&arena, exec_result.rejected_count * sizeof(t8n_rejected_tx_t));
-    for (size_t i = 0; i < exec_result.rejected_count; i++) {
-      t8n_result.rejected[i].index = exec_result.rejected[i].index;
-      t8n_result.rejected[i].error = exec_result.rejected[i].error_message;
-    }
-  }
-
-  // Set optional fields from env
-  if (env.has_difficulty) {
-    t8n_result.has_current_difficulty = true;
-    t8n_result.current_difficulty = env.difficulty;
-  }
-
-  // Base fee is required for EIP-1559+ forks (London onwards, including Shanghai)
-  // All currently supported forks (Shanghai, Cancun, Prague) require base fee
-  t8n_result.has_current_base_fee = true;
-  if (env.has_base_fee) {
-    t8n_result.current_base_fee = env.base_fee;
-  } else {
-    // Default base fee matching execution-spec-tests framework (0x7 = 7 wei)
-    t8n_result.current_base_fee = uint256_from_u64(7);
-  }
-  if (fork >= FORK_CANCUN && env.has_excess_blob_gas) {
-    t8n_result.has_current_excess_blob_gas = true;
-    t8n_result.current_excess_blob_gas = env.excess_blob_gas;
-    t8n_result.has_blob_gas_used = true;
-    t8n_result.blob_gas_used = exec_result.blob_gas_used;
+  int exit_code = t8n_transition(&runtime, &opts, fork, &input, &ctx.ws, &t8n_result);
+  if (exit_code != DIV0_EXIT_SUCCESS) {
+    t8n_context_cleanup(&ctx);
+    return exit_code;
   }
-
-  // Withdrawals root is required for Shanghai+ forks (EIP-4895)
-  // All currently supported forks require withdrawals root
-  // TODO: Compute actual root from withdrawals list when implemented
-  // For now, use empty trie root (keccak256(RLP([])))
-  t8n_result.has_withdrawals_root = true;
-  t8n_result.withdrawals_root = MPT_EMPTY_ROOT;
+  world_state_t *const ws = ctx.ws;
 
   // Write outputs
   if (opts.verbose) {
     fprintf(stderr, "t8n: writing outputs...\n");
   }
 
-  int exit_code;
   // When both result and alloc go to stdout, write combined JSON
   bool both_stdout = is_stdout(opts.output_result) && is_stdout(opts.output_alloc);
   if (both_stdout) {
-    exit_code = write_combined_stdout(&t8n_result, ws, &arena);
+    exit_code = t8n_write_combined(&t8n_result, ws, &arena, stdout, JSON_WRITE_PRETTY);
     if (exit_code != DIV0_EXIT_SUCCESS) {
       t8n_context_cleanup(&ctx);
       return exit_code;
     }
   } else {
-    exit_code = write_result_output(opts.output_basedir, opts.output_result, &t8n_result);
+    exit_code = t8n_write_result_output(opts.output_basedir, opts.output_result, &t8n_result);
+    if (exit_code != DIV0_EXIT_SUCCESS) {
+      t8n_context_cleanup(&ctx);
+      return exit_code;
+    }
+
+    exit_code = t8n_write_alloc_output(opts.output_basedir, opts.output_alloc, ws, &arena);
     if (exit_code != DIV0_EXIT_SUCCESS) {
       t8n_context_cleanup(&ctx);
       return exit_code;
     }
+  }
 
-    exit_code = write_alloc_output(opts.output_basedir, opts.output_alloc, ws, &arena);
+  if (opts.profile != nullptr) {
+    exit_code =
+        write_profile_output(opts.output_basedir, opts.profile, &profiler, profile_metric, false);
     if (exit_code != DIV0_EXIT_SUCCESS) {
       t8n_context_cleanup(&ctx);
       return exit_code;
     }
   }
+  if (opts.profile_opcodes != nullptr) {
+    exit_code = write_profile_output(opts.output_basedir, opts.profile_opcodes, &profiler,
+                                     profile_metric, true);
+    if (exit_code != DIV0_EXIT_SUCCESS) {
+      t8n_context_cleanup(&ctx);
+      return exit_code;
+    }
+  }
+  if (profiling && opts.verbose) {
+    fprintf(stderr, "  profiled: %" PRIu64 " ns, %" PRIu64 " gas%s\n", profiler.total_ns,
+            profiler.total_gas, profiler.truncated ? " (truncated: out of memory)" : "");
+  }
 
   if (opts.verbose) {
     fprintf(stderr, "t8n: done\n");
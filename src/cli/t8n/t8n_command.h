@@ -3,12 +3,28 @@
 #ifndef DIV0_CLI_T8N_COMMAND_H
 #define DIV0_CLI_T8N_COMMAND_H
 
+#include "div0/crypto/secp256k1.h"
+#include "div0/evm/evm.h"
+#include "div0/evm/fork.h"
+#include "div0/json/parse.h"
+#include "div0/json/write.h"
+#include "div0/mem/arena.h"
+#include "div0/state/jumpdest_cache.h"
+#include "div0/state/world_state.h"
+#include "div0/t8n/alloc.h"
+#include "div0/t8n/env.h"
+#include "div0/t8n/result.h"
+#include "div0/t8n/txs.h"
+
+#include <stdio.h>
+
 /// t8n subcommand options.
 typedef struct {
   // Input files
   const char *input_alloc; // Pre-state allocations (default: "alloc.json")
   const char *input_env;   // Block environment (default: "env.json")
   const char *input_txs;   // Transactions (default: "txs.json")
+  int input_sax;           // Single-pass JSON parsing (default: 0)
 
   // Output files
   const char *output_basedir; // Output directory (default: ".")
@@ -21,6 +37,11 @@ typedef struct {
   int chain_id;     // Chain ID (default: 1)
   long reward;      // Block reward, -1 to disable (default: 0)
 
+  // Profiling (files are written under output_basedir)
+  const char *profile;         // Collapsed-stack profile output (default: none)
+  const char *profile_metric;  // Collapsed-stack weight: "time" or "gas" (default: "time")
+  const char *profile_opcodes; // Per-code opcode CSV output (default: none)
+
   // Verbosity
   int verbose; // Print progress messages to stderr (default: 1)
 } t8n_options_t;
@@ -28,6 +49,79 @@ typedef struct {
 /// Initialize t8n options with default values.
 void t8n_options_init(t8n_options_t *opts);
 
+/// Parsed inputs of one state transition.
+typedef struct {
+  state_snapshot_t pre_state; // Pre-state accounts
+  t8n_env_t env;              // Block environment
+  t8n_txs_t txs;              // Transactions
+} t8n_input_t;
+
+/// Resources a state transition runs on. The t8n-server keeps them across requests.
+typedef struct {
+  div0_arena_t *arena;              // Allocations of the transition (state, results)
+  div0_arena_t *scratch;            // EVM scratch, rewound after each tx (nullptr: use arena)
+  secp256k1_ctx_t *secp_ctx;        // Sender recovery
+  evm_t *evm;                       // EVM storage, re-initialized on the arena per transition
+  jumpdest_cache_t *jumpdest_cache; // Shared jumpdest analyses (nullptr to disable)
+  initcode_cache_t *initcode_cache; // Shared init code analyses (nullptr to disable)
+  evm_tracer_t *tracer;             // Attached tracer (nullptr for none)
+} t8n_runtime_t;
+
+/// Parse a fork name.
+/// @return Fork, or FORK_UNKNOWN if the name is not supported
+fork_t t8n_parse_fork(const char *name);
+
+/// Parse combined input {"alloc": {...}, "env": {...}, "txs": [...]}.
+/// Errors are reported on stderr.
+/// @param root Combined JSON object
+/// @param source Input name for error messages (e.g. "stdin")
+/// @param arena Arena for parsed data
+/// @param input Output inputs (env must be initialized with t8n_env_init)
+/// @return Exit code
+int t8n_parse_input_value(yyjson_val_t *root, const char *source, div0_arena_t *arena,
+                          t8n_input_t *input);
+
+/// Read combined input in a single pass, keys in any order. Errors are reported on stderr.
+/// @param r Reader positioned at the combined JSON object
+/// @param source Input name for error messages (e.g. "stdin")
+/// @param arena Arena for parsed data
+/// @param input Output inputs (env must be initialized with t8n_env_init)
+/// @return Exit code
+int t8n_read_input(json_reader_t *r, const char *source, div0_arena_t *arena,
+                   t8n_input_t *input);
+
+/// Build the pre-state, execute the transactions and fill in the result.
+/// Uses fork, chain_id, reward and verbose from opts. Errors are reported on stderr.
+/// @param rt Runtime resources
+/// @param opts Options
+/// @param fork Fork to execute
+/// @param input Parsed inputs
+/// @param out_ws Post-state (set once created, also on failure; caller destroys it)
+/// @param out_result Result (allocated from rt->arena)
+/// @return Exit code
+int t8n_transition(const t8n_runtime_t *rt, const t8n_options_t *opts, fork_t fork,
+                   const t8n_input_t *input, world_state_t **out_ws, t8n_result_t *out_result);
+
+/// Write the result to basedir/filename, or to stdout if filename is "stdout".
+/// @return Exit code
+int t8n_write_result_output(const char *basedir, const char *filename, const t8n_result_t *result);
+
+/// Write the post-state to basedir/filename, or to stdout if filename is "stdout".
+/// @param arena Arena for the state export
+/// @return Exit code
+int t8n_write_alloc_output(const char *basedir, const char *filename, world_state_t *ws,
+                           div0_arena_t *arena);
+
+/// Write result and post-state as {"result": {...}, "alloc": {...}, "body": "0x"}.
+/// @param result Transition result
+/// @param ws Post-state
+/// @param arena Arena for the state export
+/// @param out Output stream
+/// @param flags Formatting
+/// @return Exit code
+int t8n_write_combined(const t8n_result_t *result, world_state_t *ws, div0_arena_t *arena,
+                       FILE *out, json_write_flags_t flags);
+
 /// Run the t8n subcommand.
 /// @param argc Argument count (includes "t8n" as argv[0])
 /// @param argv Argument vector
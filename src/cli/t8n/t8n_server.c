@@ -0,0 +1,359 @@
+// t8n_server.c - Long-running state transition server subcommand implementation
+
+#include "t8n_server.h"
+
+#include "t8n_command.h"
+#include "t8n_workspace.h"
+
+#include "../exit_codes.h"
+
+#include <argparse.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+// Pending connections queued by listen()
+static constexpr int SOCKET_BACKLOG = 16;
+
+// Set by SIGINT/SIGTERM to stop serving
+static volatile sig_atomic_t stop_requested = 0;
+
+// ============================================================================
+// Server State
+// ============================================================================
+
+typedef struct {
+  t8n_workspace_t workspace; // Contexts and arenas kept across requests
+  t8n_options_t defaults;
+  uint64_t requests;
+} t8n_server_t;
+
+// Diagnostic output uses fprintf to stderr. Return values are intentionally
+// ignored as there's no meaningful recovery for stderr write failures.
+// NOLINTBEGIN(cert-err33-c,clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+
+// ============================================================================
+// Request Handling
+// ============================================================================
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static const char *exit_code_name(const int exit_code) {
+  switch (exit_code) {
+  case DIV0_EXIT_EVM_ERROR:
+    return "evm error";
+  case DIV0_EXIT_CONFIG_ERROR:
+    return "config error";
+  case DIV0_EXIT_MISSING_BLOCK_HASH:
+    return "missing block hash";
+  case DIV0_EXIT_JSON_ERROR:
+    return "json error";
+  case DIV0_EXIT_IO_ERROR:
+    return "io error";
+  case DIV0_EXIT_RLP_ERROR:
+    return "rlp error";
+  default:
+    return "general error";
+  }
+}
+
+/// Apply the optional per-request state options.
+static int apply_request_options(yyjson_val_t *root, t8n_options_t *opts, fork_t *fork) {
+  yyjson_val_t *const fork_val = json_obj_get(root, "fork");
+  if (fork_val != nullptr) {
+    const char *const name = json_get_str(fork_val);
+    *fork = name != nullptr ? t8n_parse_fork(name) : FORK_UNKNOWN;
+    if (*fork == FORK_UNKNOWN) {
+      fprintf(stderr, "t8n-server: unknown fork '%s'\n", name != nullptr ? name : "");
+      return DIV0_EXIT_CONFIG_ERROR;
+    }
+  }
+  yyjson_val_t *const chain_id_val = json_obj_get(root, "chainid");
+  if (chain_id_val != nullptr) {
+    opts->chain_id = (int)json_get_i64(chain_id_val);
+  }
+  yyjson_val_t *const reward_val = json_obj_get(root, "reward");
+  if (reward_val != nullptr) {
+    opts->reward = (long)json_get_i64(reward_val);
+  }
+  return DIV0_EXIT_SUCCESS;
+}
+
+/// Render a response into memory and write it as one line. A failure part way
+/// through leaves nothing on out, so the client reads only the error object.
+static int write_response(const t8n_result_t *result, world_state_t *ws, div0_arena_t *arena,
+                          FILE *out) {
+  char *buffer = nullptr;
+  size_t size = 0;
+  FILE *const mem = open_memstream(&buffer, &size);
+  if (mem == nullptr) {
+    fprintf(stderr, "t8n-server: cannot buffer response: %s\n", strerror(errno));
+    return DIV0_EXIT_IO_ERROR;
+  }
+  int exit_code = t8n_write_combined(result, ws, arena, mem, JSON_WRITE_COMPACT);
+  if (fclose(mem) != 0 && exit_code == DIV0_EXIT_SUCCESS) {
+    fprintf(stderr, "t8n-server: cannot buffer response: %s\n", strerror(errno));
+    exit_code = DIV0_EXIT_IO_ERROR;
+  }
+  if (exit_code == DIV0_EXIT_SUCCESS) {
+    fwrite(buffer, 1, size, out);
+    fputc('\n', out);
+  }
+  free(buffer);
+  return exit_code;
+}
+
+/// Execute one request line and write its response line.
+/// @return false if the response could not be written
+static bool handle_request(t8n_server_t *server, const char *line, const size_t len, FILE *out) {
+  const uint64_t start = now_ns();
+  const t8n_runtime_t runtime = t8n_workspace_begin(&server->workspace);
+
+  t8n_options_t opts = server->defaults;
+  opts.verbose = 0;
+  fork_t fork = t8n_parse_fork(opts.fork);
+
+  t8n_input_t input = {};
+  t8n_env_init(&input.env);
+  t8n_result_t result;
+  world_state_t *ws = nullptr;
+
+  json_doc_t doc;
+  int exit_code = DIV0_EXIT_SUCCESS;
+  const json_result_t parsed = json_parse(line, len, &doc);
+  if (parsed.error != JSON_OK) {
+    fprintf(stderr, "t8n-server: failed to parse request: %s\n",
+            parsed.detail ? parsed.detail : json_error_name(parsed.error));
+    exit_code = DIV0_EXIT_JSON_ERROR;
+  } else {
+    yyjson_val_t *const root = json_doc_root(&doc);
+    exit_code = t8n_parse_input_value(root, "request", runtime.arena, &input);
+    if (exit_code == DIV0_EXIT_SUCCESS) {
+      exit_code = apply_request_options(root, &opts, &fork);
+    }
+    if (exit_code == DIV0_EXIT_SUCCESS) {
+      exit_code = t8n_transition(&runtime, &opts, fork, &input, &ws, &result);
+    }
+    if (exit_code == DIV0_EXIT_SUCCESS) {
+      exit_code = write_response(&result, ws, runtime.arena, out);
+    }
+    if (ws != nullptr) {
+      world_state_destroy(ws);
+    }
+    json_doc_free(&doc);
+  }
+
+  if (exit_code != DIV0_EXIT_SUCCESS) {
+    fprintf(out, "{\"error\":\"%s\",\"exitCode\":%d}\n", exit_code_name(exit_code), exit_code);
+  }
+  server->requests++;
+  if (server->defaults.verbose) {
+    fprintf(stderr, "t8n-server: request %" PRIu64 ": %zu txs, %s, %.3f ms\n", server->requests,
+            input.txs.tx_count, exit_code == DIV0_EXIT_SUCCESS ? "ok" : exit_code_name(exit_code),
+            (double)(now_ns() - start) / 1e6);
+  }
+  return fflush(out) == 0 && !ferror(out);
+}
+
+/// Serve requests from a stream until end of input, a write error or a stop signal.
+static void serve_stream(t8n_server_t *server, FILE *in, FILE *out) {
+  char *line = nullptr;
+  size_t capacity = 0;
+  ssize_t len;
+  while (!stop_requested && (len = getline(&line, &capacity, in)) >= 0) {
+    // Skip blank lines (e.g. keep-alives)
+    if (strspn(line, " \t\r\n") == (size_t)len) {
+      continue;
+    }
+    if (!handle_request(server, line, (size_t)len, out)) {
+      break;
+    }
+  }
+  free(line);
+}
+
+// ============================================================================
+// Unix Socket
+// ============================================================================
+
+static void on_stop_signal(const int sig) {
+  (void)sig;
+  stop_requested = 1;
+}
+
+/// Create a listening Unix socket, replacing a stale socket file.
+/// @return Socket descriptor, or -1 on error
+static int listen_unix(const char *path) {
+  struct sockaddr_un addr = {.sun_family = AF_UNIX};
+  const size_t path_len = strlen(path);
+  if (path_len >= sizeof(addr.sun_path)) {
+    fprintf(stderr, "t8n-server: socket path too long: %s\n", path);
+    return -1;
+  }
+  __builtin___memcpy_chk(addr.sun_path, path, path_len + 1, sizeof(addr.sun_path));
+
+  struct stat st;
+  if (stat(path, &st) == 0) {
+    if (!S_ISSOCK(st.st_mode)) {
+      fprintf(stderr, "t8n-server: %s exists and is not a socket\n", path);
+      return -1;
+    }
+    unlink(path);
+  }
+
+  const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    fprintf(stderr, "t8n-server: socket: %s\n", strerror(errno));
+    return -1;
+  }
+  if (bind(fd, (const struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+      listen(fd, SOCKET_BACKLOG) != 0) {
+    fprintf(stderr, "t8n-server: cannot listen on %s: %s\n", path, strerror(errno));
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/// Accept clients one at a time until a stop signal.
+static int serve_socket(t8n_server_t *server, const char *path) {
+  // Stop signals interrupt accept() and reads (no SA_RESTART); a client that
+  // disconnects early must not kill the server with SIGPIPE
+  struct sigaction stop_action = {.sa_handler = on_stop_signal};
+  sigemptyset(&stop_action.sa_mask);
+  sigaction(SIGINT, &stop_action, nullptr);
+  sigaction(SIGTERM, &stop_action, nullptr);
+  signal(SIGPIPE, SIG_IGN);
+
+  const int listen_fd = listen_unix(path);
+  if (listen_fd < 0) {
+    return DIV0_EXIT_IO_ERROR;
+  }
+  if (server->defaults.verbose) {
+    fprintf(stderr, "t8n-server: listening on %s\n", path);
+  }
+
+  int exit_code = DIV0_EXIT_SUCCESS;
+  while (!stop_requested) {
+    const int conn = accept(listen_fd, nullptr, nullptr);
+    if (conn < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      fprintf(stderr, "t8n-server: accept: %s\n", strerror(errno));
+      exit_code = DIV0_EXIT_IO_ERROR;
+      break;
+    }
+
+    // Separate streams for reading and writing the same connection
+    const int conn_out = dup(conn);
+    FILE *const in = fdopen(conn, "r");
+    FILE *const out = conn_out >= 0 ? fdopen(conn_out, "w") : nullptr;
+    if (in != nullptr && out != nullptr) {
+      serve_stream(server, in, out);
+    } else {
+      fprintf(stderr, "t8n-server: failed to open connection streams\n");
+    }
+    if (in != nullptr) {
+      fclose(in);
+    } else {
+      close(conn);
+    }
+    if (out != nullptr) {
+      fclose(out);
+    } else if (conn_out >= 0) {
+      close(conn_out);
+    }
+  }
+
+  close(listen_fd);
+  unlink(path);
+  return exit_code;
+}
+
+// ============================================================================
+// Command
+// ============================================================================
+
+int cmd_t8n_server(int argc, const char **argv) {
+  t8n_server_t server = {};
+  t8n_options_init(&server.defaults);
+
+  // clang-format off
+  static const char *const usages[] = {
+    "div0 t8n-server [options]",
+    nullptr,
+  };
+  // clang-format on
+
+  const char *socket_path = nullptr;
+  int quiet = 0;
+  int reward = (int)server.defaults.reward;
+  // NOLINTBEGIN(bugprone-multi-level-implicit-pointer-conversion)
+  struct argparse_option options[] = {
+      OPT_HELP(),
+      OPT_BOOLEAN('q', "quiet", &quiet, "Suppress progress messages", nullptr, 0, 0),
+      OPT_STRING(0, "socket", &socket_path, "Serve clients of a Unix socket instead of stdin",
+                 nullptr, 0, 0),
+      OPT_GROUP("Default state options (overridable per request)"),
+      OPT_STRING(0, "state.fork", &server.defaults.fork, "Fork name (Shanghai, Cancun, Prague)",
+                 nullptr, 0, 0),
+      OPT_INTEGER(0, "state.chainid", &server.defaults.chain_id, "Chain ID", nullptr, 0, 0),
+      OPT_INTEGER(0, "state.reward", &reward, "Block reward (-1 to disable)", nullptr, 0, 0),
+      OPT_END(),
+  };
+  // NOLINTEND(bugprone-multi-level-implicit-pointer-conversion)
+
+  struct argparse argparse;
+  argparse_init(&argparse, options, usages, 0);
+  argparse_describe(&argparse,
+                    "\nExecute newline-delimited state transition requests, keeping contexts "
+                    "warm between them.",
+                    nullptr);
+  argc = argparse_parse(&argparse, argc, argv);
+  (void)argc; // Remaining argc not used after parsing
+
+  server.defaults.verbose = !quiet;
+  server.defaults.reward = reward;
+
+  if (t8n_parse_fork(server.defaults.fork) == FORK_UNKNOWN) {
+    fprintf(stderr, "t8n-server: ERROR: unknown fork '%s'. Supported: Shanghai, Cancun, Prague\n",
+            server.defaults.fork);
+    return DIV0_EXIT_CONFIG_ERROR;
+  }
+
+  if (!t8n_workspace_init(&server.workspace, "t8n-server")) {
+    t8n_workspace_destroy(&server.workspace);
+    return DIV0_EXIT_GENERAL_ERROR;
+  }
+
+  int exit_code = DIV0_EXIT_SUCCESS;
+  if (socket_path != nullptr) {
+    exit_code = serve_socket(&server, socket_path);
+  } else {
+    serve_stream(&server, stdin, stdout);
+    if (ferror(stdout)) {
+      exit_code = DIV0_EXIT_IO_ERROR;
+    }
+  }
+
+  if (server.defaults.verbose) {
+    fprintf(stderr, "t8n-server: served %" PRIu64 " requests\n", server.requests);
+  }
+  t8n_workspace_destroy(&server.workspace);
+  return exit_code;
+}
+
+// NOLINTEND(cert-err33-c,clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
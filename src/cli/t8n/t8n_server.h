@@ -0,0 +1,26 @@
+// t8n_server.h - Long-running state transition server subcommand
+
+#ifndef DIV0_CLI_T8N_SERVER_H
+#define DIV0_CLI_T8N_SERVER_H
+
+/// Run the t8n-server subcommand.
+///
+/// Reads newline-delimited JSON requests from stdin (or from clients of a Unix
+/// socket with --socket) and writes one JSON line per request to stdout (or
+/// back to the client). A request is the combined t8n input, optionally with
+/// per-request overrides of the command-line state options:
+///
+///   {"alloc": {...}, "env": {...}, "txs": [...], "fork": "Cancun", "chainid": 1, "reward": 0}
+///
+/// A response is either {"result": {...}, "alloc": {...}, "body": "0x"} or
+/// {"error": "...", "exitCode": N}; details of errors go to stderr.
+///
+/// The secp256k1 context, arena blocks, EVM storage and jumpdest analyses are
+/// kept across requests. Socket clients are served one at a time.
+///
+/// @param argc Argument count (includes "t8n-server" as argv[0])
+/// @param argv Argument vector
+/// @return Exit code
+int cmd_t8n_server(int argc, const char **argv);
+
+#endif // DIV0_CLI_T8N_SERVER_H
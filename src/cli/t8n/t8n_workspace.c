@@ -0,0 +1,123 @@
+// t8n_workspace.c - Long-lived resources for repeated state transitions
+
+#include "t8n_workspace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// EVM storage alignment (cache-line aligned fields)
+static constexpr size_t EVM_ALIGNMENT = 64;
+
+// Bytes of code analyses kept across transitions before the caches start over
+static constexpr size_t T8N_CACHE_BUDGET = (size_t)64 * 1024 * 1024;
+
+// Diagnostic output uses fprintf to stderr. Return values are intentionally
+// ignored as there's no meaningful recovery for stderr write failures.
+// NOLINTBEGIN(cert-err33-c)
+
+bool t8n_workspace_init(t8n_workspace_t *const workspace, const char *const who) {
+  if (!div0_huge_page_provider_init(&workspace->huge_pages, 0, true)) {
+    fprintf(stderr, "%s: failed to create block provider\n", who);
+    return false;
+  }
+  workspace->huge_pages_initialized = true;
+
+  const div0_arena_config_t arena_config = {
+      .block_size = DIV0_HUGE_PAGE_BLOCK_SIZE,
+      .provider = div0_huge_page_provider(&workspace->huge_pages),
+  };
+  if (!div0_arena_init_with(&workspace->arena, &arena_config)) {
+    fprintf(stderr, "%s: failed to create arena\n", who);
+    return false;
+  }
+  workspace->arena_initialized = true;
+
+  if (!div0_arena_init(&workspace->scratch_arena)) {
+    fprintf(stderr, "%s: failed to create scratch arena\n", who);
+    return false;
+  }
+  workspace->scratch_arena_initialized = true;
+
+  if (!div0_arena_init(&workspace->cache_arena)) {
+    fprintf(stderr, "%s: failed to create cache arena\n", who);
+    return false;
+  }
+  workspace->cache_arena_initialized = true;
+  if (!jumpdest_cache_init(&workspace->jumpdest_cache, &workspace->cache_arena)) {
+    fprintf(stderr, "%s: failed to create jumpdest cache\n", who);
+    return false;
+  }
+  if (!initcode_cache_init(&workspace->initcode_cache, &workspace->cache_arena)) {
+    fprintf(stderr, "%s: failed to create init code cache\n", who);
+    return false;
+  }
+
+  workspace->secp_ctx = secp256k1_ctx_create();
+  if (workspace->secp_ctx == nullptr) {
+    fprintf(stderr, "%s: failed to create secp256k1 context\n", who);
+    return false;
+  }
+
+  // aligned_alloc requires the size to be a multiple of the alignment
+  const size_t evm_size = (sizeof(evm_t) + EVM_ALIGNMENT - 1) & ~(EVM_ALIGNMENT - 1);
+  workspace->evm = aligned_alloc(EVM_ALIGNMENT, evm_size);
+  if (workspace->evm == nullptr) {
+    fprintf(stderr, "%s: failed to allocate EVM\n", who);
+    return false;
+  }
+  return true;
+}
+
+// NOLINTEND(cert-err33-c)
+
+void t8n_workspace_destroy(t8n_workspace_t *const workspace) {
+  free(workspace->evm);
+  workspace->evm = nullptr;
+  if (workspace->secp_ctx != nullptr) {
+    secp256k1_ctx_destroy(workspace->secp_ctx);
+    workspace->secp_ctx = nullptr;
+  }
+  if (workspace->cache_arena_initialized) {
+    div0_arena_destroy(&workspace->cache_arena);
+    workspace->cache_arena_initialized = false;
+  }
+  if (workspace->scratch_arena_initialized) {
+    div0_arena_destroy(&workspace->scratch_arena);
+    workspace->scratch_arena_initialized = false;
+  }
+  if (workspace->arena_initialized) {
+    div0_arena_destroy(&workspace->arena);
+    workspace->arena_initialized = false;
+  }
+  if (workspace->huge_pages_initialized) {
+    div0_huge_page_provider_destroy(&workspace->huge_pages);
+    workspace->huge_pages_initialized = false;
+  }
+}
+
+/// Drop all cached analyses once they exceed T8N_CACHE_BUDGET. Only called
+/// between transitions, when nothing refers to cache entries.
+static void trim_caches(t8n_workspace_t *const workspace) {
+  if (workspace->jumpdest_cache.size + workspace->initcode_cache.size <= T8N_CACHE_BUDGET) {
+    return;
+  }
+  div0_arena_reset(&workspace->cache_arena);
+  // The initial tables fit in the first arena block, which the reset keeps
+  (void)jumpdest_cache_init(&workspace->jumpdest_cache, &workspace->cache_arena);
+  (void)initcode_cache_init(&workspace->initcode_cache, &workspace->cache_arena);
+}
+
+t8n_runtime_t t8n_workspace_begin(t8n_workspace_t *const workspace) {
+  div0_arena_reset(&workspace->arena);
+  div0_arena_reset(&workspace->scratch_arena);
+  trim_caches(workspace);
+  return (t8n_runtime_t){
+      .arena = &workspace->arena,
+      .scratch = &workspace->scratch_arena,
+      .secp_ctx = workspace->secp_ctx,
+      .evm = workspace->evm,
+      .jumpdest_cache = &workspace->jumpdest_cache,
+      .initcode_cache = &workspace->initcode_cache,
+      .tracer = nullptr,
+  };
+}
@@ -0,0 +1,44 @@
+// t8n_workspace.h - Long-lived resources for repeated state transitions
+
+#ifndef DIV0_CLI_T8N_WORKSPACE_H
+#define DIV0_CLI_T8N_WORKSPACE_H
+
+#include "t8n_command.h"
+
+#include "div0/mem/huge_pages.h"
+
+#include <stdbool.h>
+
+/// Resources behind a t8n_runtime_t that are kept across transitions.
+/// A workspace is used by one thread at a time; parallel runners create one
+/// per worker (div0_stc_arena is thread-local, so world states stay isolated).
+typedef struct {
+  div0_huge_page_provider_t huge_pages; // Block provider backing arena
+  div0_arena_t arena;                   // Per-transition allocations (reset between them)
+  div0_arena_t scratch_arena;           // EVM scratch (rewound after each transaction)
+  div0_arena_t cache_arena;             // Code analyses (kept until they exceed a budget)
+  jumpdest_cache_t jumpdest_cache;
+  initcode_cache_t initcode_cache;
+  secp256k1_ctx_t *secp_ctx;
+  evm_t *evm; // Reused storage, re-initialized per transition
+  bool huge_pages_initialized;
+  bool arena_initialized;
+  bool scratch_arena_initialized;
+  bool cache_arena_initialized;
+} t8n_workspace_t;
+
+/// Create the workspace's resources. Errors are reported on stderr.
+/// @param workspace Zero-initialized workspace
+/// @param who Prefix for error messages (e.g. "t8n-server")
+/// @return true on success; on failure call t8n_workspace_destroy
+[[nodiscard]] bool t8n_workspace_init(t8n_workspace_t *workspace, const char *who);
+
+/// Release all resources (safe on a partially initialized workspace).
+void t8n_workspace_destroy(t8n_workspace_t *workspace);
+
+/// Start a new transition: resets the arena and returns the runtime to use.
+/// Everything allocated by the previous transition becomes invalid. Cached code
+/// analyses are dropped here once they outgrow their budget.
+[[nodiscard]] t8n_runtime_t t8n_workspace_begin(t8n_workspace_t *workspace);
+
+#endif // DIV0_CLI_T8N_WORKSPACE_H
@@ -0,0 +1,1283 @@
+#include "div0/crypto/bn254.h"
+
+// BN254 arithmetic in Montgomery form (R = 2^256) on 4x64-bit limbs.
+//
+// Tower: Fp2 = Fp[u]/(u^2 + 1), Fp6 = Fp2[v]/(v^3 - xi) with xi = 9 + u,
+// Fp12 = Fp6[w]/(w^2 - v). G2 lives on the D-type twist y^2 = x^3 + 3/xi.
+
+typedef unsigned __int128 uint128_t;
+
+typedef struct {
+  uint64_t v[4];
+} fp_t;
+
+typedef struct {
+  fp_t c0;
+  fp_t c1;
+} fp2_t;
+
+typedef struct {
+  fp2_t c0;
+  fp2_t c1;
+  fp2_t c2;
+} fp6_t;
+
+typedef struct {
+  fp6_t c0;
+  fp6_t c1;
+} fp12_t;
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+static constexpr size_t FP_SIZE = 32;
+
+// Field modulus p
+static const fp_t FP_P = {
+    {0x3c208c16d87cfd47ULL, 0x97816a916871ca8dULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL}};
+
+// -p^-1 mod 2^64
+static constexpr uint64_t FP_PINV = 0x87d20782e4866389ULL;
+
+// R^2 mod p (converts into Montgomery form)
+static const fp_t FP_R2 = {
+    {0xf32cfc5b538afa89ULL, 0xb5e71911d44501fbULL, 0x47ab1eff0a417ff6ULL, 0x06d89f71cab8351fULL}};
+
+// R mod p (one in Montgomery form)
+static const fp_t FP_ONE = {
+    {0xd35d438dc58f0d9dULL, 0x0a78eb28f5c70b3dULL, 0x666ea36f7879462cULL, 0x0e0a77c19a07df2fULL}};
+
+// Curve constant b = 3 (Montgomery form)
+static const fp_t FP_B = {
+    {0x7a17caa950ad28d7ULL, 0x1f6ac17ae15521b9ULL, 0x334bea4e696bd284ULL, 0x2a1f6744ce179d8eULL}};
+
+// Group order r (plain integer, for the G2 subgroup check)
+static const uint64_t BN254_R[4] = {0x43e1f593f0000001ULL, 0x2833e84879b97091ULL,
+                                    0xb85045b68181585dULL, 0x30644e72e131a029ULL};
+
+// Curve parameter u (p and r are polynomials in u)
+static constexpr uint64_t BN254_U = 0x44e992b44a6909f1ULL;
+
+// Twist curve constant b' = 3 / xi
+static const fp2_t TWIST_B = {
+    {{0x3bf938e377b802a8ULL, 0x020b1b273633535dULL, 0x26b7edf049755260ULL, 0x2514c6324384a86dULL}},
+    {{0x38e7ecccd1dcff67ULL, 0x65f0b37d93ce0d3eULL, 0xd749d0dd22ac00aaULL, 0x0141b9ce4a688d4dULL}}};
+
+// Frobenius coefficients FROB[k - 1][i - 1] = xi^(i * (p^k - 1) / 6) for
+// k = 1..3, i = 1..5
+static const fp2_t FROB[3][5] = {
+    {
+        {{{0xaf9ba69633144907ULL, 0xca6b1d7387afb78aULL, 0x11bded5ef08a2087ULL,
+           0x02f34d751a1f3a7cULL}},
+         {{0xa222ae234c492d72ULL, 0xd00f02a4565de15bULL, 0xdc2ff3a253dfc926ULL,
+           0x10a75716b3899551ULL}}},
+        {{{0xb5773b104563ab30ULL, 0x347f91c8a9aa6454ULL, 0x7a007127242e0991ULL,
+           0x1956bcd8118214ecULL}},
+         {{0x6e849f1ea0aa4757ULL, 0xaa1c7b6d89f89141ULL, 0xb6e713cdfae0ca3aULL,
+           0x26694fbb4e82ebc3ULL}}},
+        {{{0xe4bbdd0c2936b629ULL, 0xbb30f162e133bacbULL, 0x31a9d1b6f9645366ULL,
+           0x253570bea500f8ddULL}},
+         {{0xa1d77ce45ffe77c7ULL, 0x07affd117826d1dbULL, 0x6d16bd27bb7edc6bULL,
+           0x2c87200285defeccULL}}},
+        {{{0x7361d77f843abe92ULL, 0xa5bb2bd3273411fbULL, 0x9c941f314b3e2399ULL,
+           0x15df9cddbb9fd3ecULL}},
+         {{0x5dddfd154bd8c949ULL, 0x62cb29a5a4445b60ULL, 0x37bc870a0c7dd2b9ULL,
+           0x24830a9d3171f0fdULL}}},
+        {{{0xc970692f41690fe7ULL, 0xe240342127694b0bULL, 0x32bee66b83c459e8ULL,
+           0x12aabced0ab08841ULL}},
+         {{0x0d485d2340aebfa9ULL, 0x05193418ab2fcc57ULL, 0xd3b0a40b8a4910f5ULL,
+           0x2f21ebb535d2925aULL}}},
+    },
+    {
+        {{{0xca8d800500fa1bf2ULL, 0xf0c5d61468b39769ULL, 0x0e201271ad0d4418ULL,
+           0x04290f65bad856e6ULL}},
+         {{0, 0, 0, 0}}},
+        {{{0x3350c88e13e80b9cULL, 0x7dce557cdb5e56b9ULL, 0x6001b4b8b615564aULL,
+           0x2682e617020217e0ULL}},
+         {{0, 0, 0, 0}}},
+        {{{0x68c3488912edefaaULL, 0x8d087f6872aabf4fULL, 0x51e1a24709081231ULL,
+           0x2259d6b14729c0faULL}},
+         {{0, 0, 0, 0}}},
+        {{{0x71930c11d782e155ULL, 0xa6bb947cffbe3323ULL, 0xaa303344d4741444ULL,
+           0x2c3b3f0d26594943ULL}},
+         {{0, 0, 0, 0}}},
+        {{{0x08cfc388c494f1abULL, 0x19b315148d1373d4ULL, 0x584e90fdcb6c0213ULL,
+           0x09e1685bdf2f8849ULL}},
+         {{0, 0, 0, 0}}},
+    },
+    {
+        {{{0x365316184e46d97dULL, 0x0af7129ed4c96d9fULL, 0x659da72fca1009b5ULL,
+           0x08116d8983a20d23ULL}},
+         {{0xb1df4af7c39c1939ULL, 0x3d9f02878a73bf7fULL, 0x9b2220928caf0ae0ULL,
+           0x26684515eff054a6ULL}}},
+        {{{0xc9af22f716ad6badULL, 0xb311782a4aa662b2ULL, 0x19eeaf64e248c7f4ULL,
+           0x20273e77e3439f82ULL}},
+         {{0xacc02860f7ce93acULL, 0x3933d5817ba76b4cULL, 0x69e6188b446c8467ULL,
+           0x0a46036d4417cc55ULL}}},
+        {{{0x5764af0aaf46471eULL, 0xdc50792e873e0fc1ULL, 0x86a673ff881d04f6ULL,
+           0x0b2eddb43c30a74cULL}},
+         {{0x9a490f32787e8580ULL, 0x8fd16d7ff04af8b1ULL, 0x4b39888ec6027bf2ULL,
+           0x03dd2e705b52a15dULL}}},
+        {{{0x448a93a57b6762dfULL, 0xbfd62df528fdeadfULL, 0xd858f5d00e9bd47aULL,
+           0x06b03d4d3476ec58ULL}},
+         {{0x2b19daf4bcc936d1ULL, 0xa1a54e7a56f4299fULL, 0xb533eee05adeaef1ULL,
+           0x170c812b84dda0b2ULL}}},
+        {{{0xe0bc4b2275cf559fULL, 0xc238b945c154e60fULL, 0x803982a5929a7d5eULL,
+           0x15ce052df7e4a37eULL}},
+         {{0x2d28efbdbf3799a7ULL, 0x9b097e3c1ad60773ULL, 0x982d4113af4a535bULL,
+           0x24e18991e3056063ULL}}},
+    },
+};
+
+// Miller loop count 6u + 2 in non-adjacent form, least significant digit first
+static constexpr size_t ATE_NAF_LEN = 66;
+static const int8_t ATE_NAF[ATE_NAF_LEN] = {
+    0, 0, 0,  1, 0, 1,  0, -1, 0, 0, -1, 0, 0, 0,  1, 0, 0, -1, 0, -1, 0,  0,
+    0, 1, 0,  -1, 0, 0, 0, 0,  -1, 0, 0, 1, 0, -1, 0, 0, 1,  0, 0, 0, 0, 0,
+    -1, 0, 0, -1, 0, 1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0,  1, 0, -1, 0, 1,
+};
+
+// Pairs processed together in one multi-Miller loop (their squarings of f
+// are shared); larger inputs are handled in batches.
+static constexpr size_t PAIRING_BATCH = 8;
+
+// ============================================================================
+// Fp
+// ============================================================================
+
+static inline bool fp_is_zero(const fp_t *a) {
+  return (a->v[0] | a->v[1] | a->v[2] | a->v[3]) == 0;
+}
+
+static inline bool fp_eq(const fp_t *a, const fp_t *b) {
+  return ((a->v[0] ^ b->v[0]) | (a->v[1] ^ b->v[1]) | (a->v[2] ^ b->v[2]) |
+          (a->v[3] ^ b->v[3])) == 0;
+}
+
+/// r = a - p if a >= p (a < 2p).
+static inline void fp_reduce_once(fp_t *r, const fp_t *a, const uint64_t hi) {
+  fp_t t;
+  uint64_t borrow = 0;
+  for (int i = 0; i < 4; i++) {
+    const uint128_t d = (uint128_t)a->v[i] - FP_P.v[i] - borrow;
+    t.v[i] = (uint64_t)d;
+    borrow = (uint64_t)(d >> 64) & 1;
+  }
+  *r = (hi != 0 || borrow == 0) ? t : *a;
+}
+
+static inline void fp_add(fp_t *r, const fp_t *a, const fp_t *b) {
+  fp_t s;
+  uint64_t carry = 0;
+  for (int i = 0; i < 4; i++) {
+    const uint128_t t = (uint128_t)a->v[i] + b->v[i] + carry;
+    s.v[i] = (uint64_t)t;
+    carry = (uint64_t)(t >> 64);
+  }
+  fp_reduce_once(r, &s, carry);
+}
+
+static inline void fp_sub(fp_t *r, const fp_t *a, const fp_t *b) {
+  fp_t d;
+  uint64_t borrow = 0;
+  for (int i = 0; i < 4; i++) {
+    const uint128_t t = (uint128_t)a->v[i] - b->v[i] - borrow;
+    d.v[i] = (uint64_t)t;
+    borrow = (uint64_t)(t >> 64) & 1;
+  }
+  if (borrow != 0) {
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; i++) {
+      const uint128_t t = (uint128_t)d.v[i] + FP_P.v[i] + carry;
+      d.v[i] = (uint64_t)t;
+      carry = (uint64_t)(t >> 64);
+    }
+  }
+  *r = d;
+}
+
+static inline void fp_neg(fp_t *r, const fp_t *a) {
+  const fp_t zero = {{0, 0, 0, 0}};
+  fp_sub(r, &zero, a);
+}
+
+static inline void fp_dbl(fp_t *r, const fp_t *a) {
+  fp_add(r, a, a);
+}
+
+/// Montgomery multiplication (CIOS): r = a * b / R mod p.
+static void fp_mul(fp_t *r, const fp_t *a, const fp_t *b) {
+  uint64_t t[6] = {0, 0, 0, 0, 0, 0};
+  for (int i = 0; i < 4; i++) {
+    uint64_t carry = 0;
+    for (int j = 0; j < 4; j++) {
+      const uint128_t s = (uint128_t)a->v[j] * b->v[i] + t[j] + carry;
+      t[j] = (uint64_t)s;
+      carry = (uint64_t)(s >> 64);
+    }
+    uint128_t s = (uint128_t)t[4] + carry;
+    t[4] = (uint64_t)s;
+    t[5] = (uint64_t)(s >> 64);
+
+    const uint64_t m = t[0] * FP_PINV;
+    s = (uint128_t)m * FP_P.v[0] + t[0];
+    carry = (uint64_t)(s >> 64);
+    for (int j = 1; j < 4; j++) {
+      s = (uint128_t)m * FP_P.v[j] + t[j] + carry;
+      t[j - 1] = (uint64_t)s;
+      carry = (uint64_t)(s >> 64);
+    }
+    s = (uint128_t)t[4] + carry;
+    t[3] = (uint64_t)s;
+    t[4] = t[5] + (uint64_t)(s >> 64);
+  }
+  const fp_t res = {{t[0], t[1], t[2], t[3]}};
+  fp_reduce_once(r, &res, t[4]);
+}
+
+static inline void fp_sqr(fp_t *r, const fp_t *a) {
+  fp_mul(r, a, a);
+}
+
+/// r = a^(p - 2) = a^-1 (Fermat); a must be non-zero.
+static void fp_inv(fp_t *r, const fp_t *a) {
+  fp_t e = FP_P;
+  e.v[0] -= 2;
+  fp_t acc = FP_ONE;
+  for (int i = 255; i >= 0; i--) {
+    fp_sqr(&acc, &acc);
+    if (((e.v[i / 64] >> (i % 64)) & 1) != 0) {
+      fp_mul(&acc, &acc, a);
+    }
+  }
+  *r = acc;
+}
+
+/// Decode a big-endian field element into Montgomery form.
+/// @return false if the value is not below p
+static bool fp_from_bytes(fp_t *r, const uint8_t *in) {
+  fp_t raw;
+  for (int i = 0; i < 4; i++) {
+    uint64_t limb = 0;
+    for (int j = 0; j < 8; j++) {
+      limb = (limb << 8) | in[((3 - i) * 8) + j];
+    }
+    raw.v[i] = limb;
+  }
+  for (int i = 3; i >= 0; i--) {
+    if (raw.v[i] != FP_P.v[i]) {
+      if (raw.v[i] > FP_P.v[i]) {
+        return false;
+      }
+      break;
+    }
+    if (i == 0) {
+      return false; // equal to p
+    }
+  }
+  fp_mul(r, &raw, &FP_R2);
+  return true;
+}
+
+/// Encode a Montgomery-form field element as big-endian bytes.
+static void fp_to_bytes(uint8_t *out, const fp_t *a) {
+  const fp_t one = {{1, 0, 0, 0}};
+  fp_t raw;
+  fp_mul(&raw, a, &one);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 8; j++) {
+      out[((3 - i) * 8) + j] = (uint8_t)(raw.v[i] >> (56 - (8 * j)));
+    }
+  }
+}
+
+// ============================================================================
+// Fp2
+// ============================================================================
+
+static inline bool fp2_is_zero(const fp2_t *a) {
+  return fp_is_zero(&a->c0) && fp_is_zero(&a->c1);
+}
+
+static inline bool fp2_eq(const fp2_t *a, const fp2_t *b) {
+  return fp_eq(&a->c0, &b->c0) && fp_eq(&a->c1, &b->c1);
+}
+
+static inline void fp2_add(fp2_t *r, const fp2_t *a, const fp2_t *b) {
+  fp_add(&r->c0, &a->c0, &b->c0);
+  fp_add(&r->c1, &a->c1, &b->c1);
+}
+
+static inline void fp2_sub(fp2_t *r, const fp2_t *a, const fp2_t *b) {
+  fp_sub(&r->c0, &a->c0, &b->c0);
+  fp_sub(&r->c1, &a->c1, &b->c1);
+}
+
+static inline void fp2_neg(fp2_t *r, const fp2_t *a) {
+  fp_neg(&r->c0, &a->c0);
+  fp_neg(&r->c1, &a->c1);
+}
+
+static inline void fp2_dbl(fp2_t *r, const fp2_t *a) {
+  fp_dbl(&r->c0, &a->c0);
+  fp_dbl(&r->c1, &a->c1);
+}
+
+static inline void fp2_conj(fp2_t *r, const fp2_t *a) {
+  r->c0 = a->c0;
+  fp_neg(&r->c1, &a->c1);
+}
+
+/// Karatsuba: 3 base field multiplications.
+static void fp2_mul(fp2_t *r, const fp2_t *a, const fp2_t *b) {
+  fp_t v0;
+  fp_t v1;
+  fp_t sa;
+  fp_t sb;
+  fp_mul(&v0, &a->c0, &b->c0);
+  fp_mul(&v1, &a->c1, &b->c1);
+  fp_add(&sa, &a->c0, &a->c1);
+  fp_add(&sb, &b->c0, &b->c1);
+  fp_mul(&r->c1, &sa, &sb);
+  fp_sub(&r->c1, &r->c1, &v0);
+  fp_sub(&r->c1, &r->c1, &v1);
+  fp_sub(&r->c0, &v0, &v1);
+}
+
+/// (a0 + a1 u)^2 = (a0 + a1)(a0 - a1) + 2 a0 a1 u.
+static void fp2_sqr(fp2_t *r, const fp2_t *a) {
+  fp_t s;
+  fp_t d;
+  fp_t m;
+  fp_add(&s, &a->c0, &a->c1);
+  fp_sub(&d, &a->c0, &a->c1);
+  fp_mul(&m, &a->c0, &a->c1);
+  fp_mul(&r->c0, &s, &d);
+  fp_dbl(&r->c1, &m);
+}
+
+static inline void fp2_mul_fp(fp2_t *r, const fp2_t *a, const fp_t *b) {
+  fp_mul(&r->c0, &a->c0, b);
+  fp_mul(&r->c1, &a->c1, b);
+}
+
+/// Multiply by xi = 9 + u: (9 a0 - a1) + (9 a1 + a0) u.
+static void fp2_mul_xi(fp2_t *r, const fp2_t *a) {
+  fp2_t t;
+  fp2_dbl(&t, a);
+  fp2_dbl(&t, &t);
+  fp2_dbl(&t, &t);
+  fp2_add(&t, &t, a); // 9a
+  fp2_t res;
+  fp_sub(&res.c0, &t.c0, &a->c1);
+  fp_add(&res.c1, &t.c1, &a->c0);
+  *r = res;
+}
+
+static void fp2_inv(fp2_t *r, const fp2_t *a) {
+  fp_t n;
+  fp_t t;
+  fp_sqr(&n, &a->c0);
+  fp_sqr(&t, &a->c1);
+  fp_add(&n, &n, &t);
+  fp_inv(&n, &n);
+  fp_mul(&r->c0, &a->c0, &n);
+  fp_mul(&t, &a->c1, &n);
+  fp_neg(&r->c1, &t);
+}
+
+static bool fp2_from_bytes(fp2_t *r, const uint8_t *in) {
+  // Imaginary part first
+  return fp_from_bytes(&r->c1, in) && fp_from_bytes(&r->c0, in + FP_SIZE);
+}
+
+// ============================================================================
+// Fp6
+// ============================================================================
+
+static inline void fp6_add(fp6_t *r, const fp6_t *a, const fp6_t *b) {
+  fp2_add(&r->c0, &a->c0, &b->c0);
+  fp2_add(&r->c1, &a->c1, &b->c1);
+  fp2_add(&r->c2, &a->c2, &b->c2);
+}
+
+static inline void fp6_sub(fp6_t *r, const fp6_t *a, const fp6_t *b) {
+  fp2_sub(&r->c0, &a->c0, &b->c0);
+  fp2_sub(&r->c1, &a->c1, &b->c1);
+  fp2_sub(&r->c2, &a->c2, &b->c2);
+}
+
+static inline void fp6_neg(fp6_t *r, const fp6_t *a) {
+  fp2_neg(&r->c0, &a->c0);
+  fp2_neg(&r->c1, &a->c1);
+  fp2_neg(&r->c2, &a->c2);
+}
+
+/// Karatsuba-style: 6 Fp2 multiplications.
+static void fp6_mul(fp6_t *r, const fp6_t *a, const fp6_t *b) {
+  fp2_t t0;
+  fp2_t t1;
+  fp2_t t2;
+  fp2_t sa;
+  fp2_t sb;
+  fp2_t x;
+  fp6_t res;
+  fp2_mul(&t0, &a->c0, &b->c0);
+  fp2_mul(&t1, &a->c1, &b->c1);
+  fp2_mul(&t2, &a->c2, &b->c2);
+
+  // c0 = t0 + xi((a1 + a2)(b1 + b2) - t1 - t2)
+  fp2_add(&sa, &a->c1, &a->c2);
+  fp2_add(&sb, &b->c1, &b->c2);
+  fp2_mul(&x, &sa, &sb);
+  fp2_sub(&x, &x, &t1);
+  fp2_sub(&x, &x, &t2);
+  fp2_mul_xi(&x, &x);
+  fp2_add(&res.c0, &x, &t0);
+
+  // c1 = (a0 + a1)(b0 + b1) - t0 - t1 + xi t2
+  fp2_add(&sa, &a->c0, &a->c1);
+  fp2_add(&sb, &b->c0, &b->c1);
+  fp2_mul(&x, &sa, &sb);
+  fp2_sub(&x, &x, &t0);
+  fp2_sub(&x, &x, &t1);
+  fp2_mul_xi(&res.c1, &t2);
+  fp2_add(&res.c1, &res.c1, &x);
+
+  // c2 = (a0 + a2)(b0 + b2) - t0 - t2 + t1
+  fp2_add(&sa, &a->c0, &a->c2);
+  fp2_add(&sb, &b->c0, &b->c2);
+  fp2_mul(&x, &sa, &sb);
+  fp2_sub(&x, &x, &t0);
+  fp2_sub(&x, &x, &t2);
+  fp2_add(&res.c2, &x, &t1);
+
+  *r = res;
+}
+
+/// Multiply by a sparse element b0 + b1 v.
+static void fp6_mul_01(fp6_t *r, const fp6_t *a, const fp2_t *b0, const fp2_t *b1) {
+  fp2_t t;
+  fp6_t res;
+  // c0 = a0 b0 + xi a2 b1
+  fp2_mul(&t, &a->c2, b1);
+  fp2_mul_xi(&t, &t);
+  fp2_mul(&res.c0, &a->c0, b0);
+  fp2_add(&res.c0, &res.c0, &t);
+  // c1 = a0 b1 + a1 b0
+  fp2_mul(&t, &a->c0, b1);
+  fp2_mul(&res.c1, &a->c1, b0);
+  fp2_add(&res.c1, &res.c1, &t);
+  // c2 = a1 b1 + a2 b0
+  fp2_mul(&t, &a->c1, b1);
+  fp2_mul(&res.c2, &a->c2, b0);
+  fp2_add(&res.c2, &res.c2, &t);
+  *r = res;
+}
+
+static inline void fp6_mul_fp2(fp6_t *r, const fp6_t *a, const fp2_t *b) {
+  fp2_mul(&r->c0, &a->c0, b);
+  fp2_mul(&r->c1, &a->c1, b);
+  fp2_mul(&r->c2, &a->c2, b);
+}
+
+/// Multiply by v: (a0, a1, a2) -> (xi a2, a0, a1).
+static void fp6_mul_v(fp6_t *r, const fp6_t *a) {
+  fp2_t t;
+  fp2_mul_xi(&t, &a->c2);
+  r->c2 = a->c1;
+  r->c1 = a->c0;
+  r->c0 = t;
+}
+
+static void fp6_inv(fp6_t *r, const fp6_t *a) {
+  fp2_t c0;
+  fp2_t c1;
+  fp2_t c2;
+  fp2_t t;
+  // c0 = a0^2 - xi a1 a2
+  fp2_mul(&t, &a->c1, &a->c2);
+  fp2_mul_xi(&t, &t);
+  fp2_sqr(&c0, &a->c0);
+  fp2_sub(&c0, &c0, &t);
+  // c1 = xi a2^2 - a0 a1
+  fp2_sqr(&t, &a->c2);
+  fp2_mul_xi(&c1, &t);
+  fp2_mul(&t, &a->c0, &a->c1);
+  fp2_sub(&c1, &c1, &t);
+  // c2 = a1^2 - a0 a2
+  fp2_sqr(&c2, &a->c1);
+  fp2_mul(&t, &a->c0, &a->c2);
+  fp2_sub(&c2, &c2, &t);
+  // n = a0 c0 + xi(a2 c1 + a1 c2)
+  fp2_t n;
+  fp2_t s;
+  fp2_mul(&n, &a->c2, &c1);
+  fp2_mul(&s, &a->c1, &c2);
+  fp2_add(&n, &n, &s);
+  fp2_mul_xi(&n, &n);
+  fp2_mul(&s, &a->c0, &c0);
+  fp2_add(&n, &n, &s);
+  fp2_inv(&n, &n);
+  fp2_mul(&r->c0, &c0, &n);
+  fp2_mul(&r->c1, &c1, &n);
+  fp2_mul(&r->c2, &c2, &n);
+}
+
+// ============================================================================
+// Fp12
+// ============================================================================
+
+static void fp12_one(fp12_t *r) {
+  const fp2_t zero = {{{0, 0, 0, 0}}, {{0, 0, 0, 0}}};
+  r->c0.c0.c0 = FP_ONE;
+  r->c0.c0.c1 = zero.c1;
+  r->c0.c1 = zero;
+  r->c0.c2 = zero;
+  r->c1.c0 = zero;
+  r->c1.c1 = zero;
+  r->c1.c2 = zero;
+}
+
+static bool fp12_is_one(const fp12_t *a) {
+  const fp2_t zero = {{{0, 0, 0, 0}}, {{0, 0, 0, 0}}};
+  const fp2_t one = {FP_ONE, {{0, 0, 0, 0}}};
+  return fp2_eq(&a->c0.c0, &one) && fp2_eq(&a->c0.c1, &zero) && fp2_eq(&a->c0.c2, &zero) &&
+         fp2_eq(&a->c1.c0, &zero) && fp2_eq(&a->c1.c1, &zero) && fp2_eq(&a->c1.c2, &zero);
+}
+
+static void fp12_mul(fp12_t *r, const fp12_t *a, const fp12_t *b) {
+  fp6_t t0;
+  fp6_t t1;
+  fp6_t sa;
+  fp6_t sb;
+  fp6_mul(&t0, &a->c0, &b->c0);
+  fp6_mul(&t1, &a->c1, &b->c1);
+  fp6_add(&sa, &a->c0, &a->c1);
+  fp6_add(&sb, &b->c0, &b->c1);
+  fp6_mul(&r->c1, &sa, &sb);
+  fp6_sub(&r->c1, &r->c1, &t0);
+  fp6_sub(&r->c1, &r->c1, &t1);
+  fp6_mul_v(&t1, &t1);
+  fp6_add(&r->c0, &t0, &t1);
+}
+
+/// Complex squaring: 2 Fp6 multiplications.
+static void fp12_sqr(fp12_t *r, const fp12_t *a) {
+  fp6_t ab;
+  fp6_t s;
+  fp6_t t;
+  fp6_mul(&ab, &a->c0, &a->c1);
+  fp6_add(&s, &a->c0, &a->c1);
+  fp6_mul_v(&t, &a->c1);
+  fp6_add(&t, &t, &a->c0);
+  fp6_mul(&r->c0, &s, &t);
+  fp6_sub(&r->c0, &r->c0, &ab);
+  fp6_mul_v(&t, &ab);
+  fp6_sub(&r->c0, &r->c0, &t);
+  fp6_add(&r->c1, &ab, &ab);
+}
+
+/// Multiply by a line l0 + l1 w + l3 w^3, i.e. c0 = (l0, 0, 0), c1 = (l1, l3, 0).
+static void fp12_mul_line(fp12_t *f, const fp2_t *l0, const fp2_t *l1, const fp2_t *l3) {
+  fp6_t t0;
+  fp6_t t1;
+  fp6_t s;
+  fp2_t b0;
+  fp6_mul_fp2(&t0, &f->c0, l0);
+  fp6_mul_01(&t1, &f->c1, l1, l3);
+  fp6_add(&s, &f->c0, &f->c1);
+  fp2_add(&b0, l0, l1);
+  fp6_mul_01(&f->c1, &s, &b0, l3);
+  fp6_sub(&f->c1, &f->c1, &t0);
+  fp6_sub(&f->c1, &f->c1, &t1);
+  fp6_mul_v(&t1, &t1);
+  fp6_add(&f->c0, &t0, &t1);
+}
+
+static inline void fp12_conj(fp12_t *r, const fp12_t *a) {
+  r->c0 = a->c0;
+  fp6_neg(&r->c1, &a->c1);
+}
+
+static void fp12_inv(fp12_t *r, const fp12_t *a) {
+  fp6_t t0;
+  fp6_t t1;
+  fp6_mul(&t0, &a->c0, &a->c0);
+  fp6_mul(&t1, &a->c1, &a->c1);
+  fp6_mul_v(&t1, &t1);
+  fp6_sub(&t0, &t0, &t1);
+  fp6_inv(&t0, &t0);
+  fp6_mul(&r->c0, &a->c0, &t0);
+  fp6_mul(&t1, &a->c1, &t0);
+  fp6_neg(&r->c1, &t1);
+}
+
+/// r = a^(p^k) for k = 1..3. The coefficient of w^i is conjugated (odd k) and
+/// scaled by xi^(i (p^k - 1) / 6).
+static void fp12_frobenius(fp12_t *r, const fp12_t *a, const int k) {
+  fp2_t *const out[6] = {&r->c0.c0, &r->c1.c0, &r->c0.c1, &r->c1.c1, &r->c0.c2, &r->c1.c2};
+  const fp2_t *const in[6] = {&a->c0.c0, &a->c1.c0, &a->c0.c1, &a->c1.c1, &a->c0.c2, &a->c1.c2};
+  for (int i = 0; i < 6; i++) {
+    fp2_t c = *in[i];
+    if ((k & 1) != 0) {
+      fp2_conj(&c, &c);
+    }
+    if (i > 0) {
+      fp2_mul(&c, &c, &FROB[k - 1][i - 1]);
+    }
+    *out[i] = c;
+  }
+}
+
+/// r = a^u.
+static void fp12_pow_u(fp12_t *r, const fp12_t *a) {
+  fp12_t acc = *a;
+  for (int i = 61; i >= 0; i--) { // bit 62 is the top bit of u
+    fp12_sqr(&acc, &acc);
+    if (((BN254_U >> i) & 1) != 0) {
+      fp12_mul(&acc, &acc, a);
+    }
+  }
+  *r = acc;
+}
+
+/// Final exponentiation f^((p^12 - 1) / r).
+static void final_exponentiation(fp12_t *r, const fp12_t *f) {
+  // Easy part: f^((p^6 - 1)(p^2 + 1))
+  fp12_t t;
+  fp12_t m;
+  fp12_inv(&t, f);
+  fp12_conj(&m, f);
+  fp12_mul(&m, &m, &t);
+  fp12_frobenius(&t, &m, 2);
+  fp12_mul(&m, &m, &t);
+
+  // Hard part: m^((p^4 - p^2 + 1) / r) = m^(l0 + l1 p + l2 p^2 + l3 p^3) with
+  //   l3 = 1, l2 = 6u^2 + 1, l1 = -36u^3 - 18u^2 - 12u + 1,
+  //   l0 = -36u^3 - 30u^2 - 18u - 2.
+  // m is unitary here, so inversion is conjugation.
+  fp12_t fa;
+  fp12_t fb;
+  fp12_t fc;
+  fp12_pow_u(&fa, &m);
+  fp12_pow_u(&fb, &fa);
+  fp12_pow_u(&fc, &fb);
+
+  fp12_t fa6;
+  fp12_t fa12;
+  fp12_t fa18;
+  fp12_t fb6;
+  fp12_t fb18;
+  fp12_t fb30;
+  fp12_t fc36;
+  fp12_t m2;
+  fp12_sqr(&t, &fa);
+  fp12_mul(&fa6, &t, &fa);
+  fp12_sqr(&fa6, &fa6); // fa^6
+  fp12_sqr(&fa12, &fa6);
+  fp12_mul(&fa18, &fa12, &fa6);
+  fp12_sqr(&t, &fb);
+  fp12_mul(&fb6, &t, &fb);
+  fp12_sqr(&fb6, &fb6); // fb^6
+  fp12_sqr(&t, &fb6);
+  fp12_mul(&fb18, &t, &fb6);
+  fp12_mul(&fb30, &fb18, &t);
+  fp12_sqr(&t, &fc);
+  fp12_mul(&fc36, &t, &fc);
+  fp12_sqr(&fc36, &fc36);
+  fp12_sqr(&t, &fc36);
+  fp12_mul(&fc36, &t, &fc36);
+  fp12_sqr(&fc36, &fc36); // fc^36
+  fp12_sqr(&m2, &m);
+
+  // m^l0
+  fp12_t res;
+  fp12_mul(&res, &fc36, &fb30);
+  fp12_mul(&res, &res, &fa18);
+  fp12_mul(&res, &res, &m2);
+  fp12_conj(&res, &res);
+
+  // (m^l1)^p
+  fp12_mul(&t, &fc36, &fb18);
+  fp12_mul(&t, &t, &fa12);
+  fp12_conj(&t, &t);
+  fp12_mul(&t, &t, &m);
+  fp12_frobenius(&t, &t, 1);
+  fp12_mul(&res, &res, &t);
+
+  // (m^l2)^(p^2)
+  fp12_mul(&t, &fb6, &m);
+  fp12_frobenius(&t, &t, 2);
+  fp12_mul(&res, &res, &t);
+
+  // m^(p^3)
+  fp12_frobenius(&t, &m, 3);
+  fp12_mul(r, &res, &t);
+}
+
+// ============================================================================
+// G1
+// ============================================================================
+
+/// Jacobian point (X / Z^2, Y / Z^3); Z = 0 is the point at infinity.
+typedef struct {
+  fp_t x;
+  fp_t y;
+  fp_t z;
+} g1_t;
+
+/// Decode and validate an affine G1 point (cofactor 1: on-curve suffices).
+static bool g1_from_bytes(g1_t *r, const uint8_t *in) {
+  if (!fp_from_bytes(&r->x, in) || !fp_from_bytes(&r->y, in + FP_SIZE)) {
+    return false;
+  }
+  if (fp_is_zero(&r->x) && fp_is_zero(&r->y)) {
+    r->z = (fp_t){{0, 0, 0, 0}};
+    return true;
+  }
+  r->z = FP_ONE;
+  fp_t lhs;
+  fp_t rhs;
+  fp_sqr(&lhs, &r->y);
+  fp_sqr(&rhs, &r->x);
+  fp_mul(&rhs, &rhs, &r->x);
+  fp_add(&rhs, &rhs, &FP_B);
+  return fp_eq(&lhs, &rhs);
+}
+
+static void g1_to_bytes(uint8_t *out, const g1_t *p) {
+  if (fp_is_zero(&p->z)) {
+    for (size_t i = 0; i < BN254_G1_SIZE; i++) {
+      out[i] = 0;
+    }
+    return;
+  }
+  fp_t zinv;
+  fp_t zinv2;
+  fp_t t;
+  fp_inv(&zinv, &p->z);
+  fp_sqr(&zinv2, &zinv);
+  fp_mul(&t, &p->x, &zinv2);
+  fp_to_bytes(out, &t);
+  fp_mul(&zinv2, &zinv2, &zinv);
+  fp_mul(&t, &p->y, &zinv2);
+  fp_to_bytes(out + FP_SIZE, &t);
+}
+
+/// Doubling (dbl-2009-l, a = 0).
+static void g1_dbl(g1_t *r, const g1_t *p) {
+  if (fp_is_zero(&p->z)) {
+    *r = *p;
+    return;
+  }
+  fp_t a;
+  fp_t b;
+  fp_t c;
+  fp_t d;
+  fp_t e;
+  fp_t f;
+  fp_sqr(&a, &p->x);
+  fp_sqr(&b, &p->y);
+  fp_sqr(&c, &b);
+  fp_add(&d, &p->x, &b);
+  fp_sqr(&d, &d);
+  fp_sub(&d, &d, &a);
+  fp_sub(&d, &d, &c);
+  fp_dbl(&d, &d);
+  fp_dbl(&e, &a);
+  fp_add(&e, &e, &a);
+  fp_sqr(&f, &e);
+
+  fp_t z3;
+  fp_mul(&z3, &p->y, &p->z);
+  fp_dbl(&r->z, &z3);
+  fp_dbl(&a, &d);
+  fp_sub(&r->x, &f, &a);
+  fp_sub(&d, &d, &r->x);
+  fp_mul(&d, &d, &e);
+  fp_dbl(&c, &c);
+  fp_dbl(&c, &c);
+  fp_dbl(&c, &c);
+  fp_sub(&r->y, &d, &c);
+}
+
+/// General addition (add-2007-bl), handling infinity and doubling.
+static void g1_add(g1_t *r, const g1_t *p, const g1_t *q) {
+  if (fp_is_zero(&p->z)) {
+    *r = *q;
+    return;
+  }
+  if (fp_is_zero(&q->z)) {
+    *r = *p;
+    return;
+  }
+  fp_t z1z1;
+  fp_t z2z2;
+  fp_t u1;
+  fp_t u2;
+  fp_t s1;
+  fp_t s2;
+  fp_sqr(&z1z1, &p->z);
+  fp_sqr(&z2z2, &q->z);
+  fp_mul(&u1, &p->x, &z2z2);
+  fp_mul(&u2, &q->x, &z1z1);
+  fp_mul(&s1, &p->y, &q->z);
+  fp_mul(&s1, &s1, &z2z2);
+  fp_mul(&s2, &q->y, &p->z);
+  fp_mul(&s2, &s2, &z1z1);
+
+  fp_t h;
+  fp_t rr;
+  fp_sub(&h, &u2, &u1);
+  fp_sub(&rr, &s2, &s1);
+  if (fp_is_zero(&h)) {
+    if (fp_is_zero(&rr)) {
+      g1_dbl(r, p);
+    } else {
+      r->z = (fp_t){{0, 0, 0, 0}};
+    }
+    return;
+  }
+  fp_dbl(&rr, &rr);
+
+  fp_t i;
+  fp_t j;
+  fp_t v;
+  fp_dbl(&i, &h);
+  fp_sqr(&i, &i);
+  fp_mul(&j, &h, &i);
+  fp_mul(&v, &u1, &i);
+
+  fp_t z3;
+  fp_add(&z3, &p->z, &q->z);
+  fp_sqr(&z3, &z3);
+  fp_sub(&z3, &z3, &z1z1);
+  fp_sub(&z3, &z3, &z2z2);
+  fp_mul(&r->z, &z3, &h);
+
+  fp_t x3;
+  fp_sqr(&x3, &rr);
+  fp_sub(&x3, &x3, &j);
+  fp_sub(&x3, &x3, &v);
+  fp_sub(&x3, &x3, &v);
+
+  fp_t y3;
+  fp_sub(&y3, &v, &x3);
+  fp_mul(&y3, &y3, &rr);
+  fp_mul(&s1, &s1, &j);
+  fp_dbl(&s1, &s1);
+  fp_sub(&r->y, &y3, &s1);
+  r->x = x3;
+}
+
+/// Scalar multiplication with a fixed 4-bit window.
+static void g1_mul(g1_t *r, const g1_t *p, const uint8_t *scalar) {
+  g1_t table[16];
+  table[0].z = (fp_t){{0, 0, 0, 0}};
+  table[0].x = table[0].z;
+  table[0].y = table[0].z;
+  table[1] = *p;
+  for (int i = 2; i < 16; i++) {
+    g1_add(&table[i], &table[i - 1], p);
+  }
+
+  g1_t acc = table[0];
+  for (size_t i = 0; i < BN254_SCALAR_SIZE; i++) {
+    for (int shift = 4; shift >= 0; shift -= 4) {
+      g1_dbl(&acc, &acc);
+      g1_dbl(&acc, &acc);
+      g1_dbl(&acc, &acc);
+      g1_dbl(&acc, &acc);
+      const unsigned nibble = (scalar[i] >> shift) & 0x0F;
+      if (nibble != 0) {
+        g1_add(&acc, &acc, &table[nibble]);
+      }
+    }
+  }
+  *r = acc;
+}
+
+// ============================================================================
+// G2
+// ============================================================================
+
+/// Affine G2 point on the twist.
+typedef struct {
+  fp2_t x;
+  fp2_t y;
+  bool infinity;
+} g2_affine_t;
+
+/// Jacobian G2 point, used for the subgroup check.
+typedef struct {
+  fp2_t x;
+  fp2_t y;
+  fp2_t z;
+} g2_jac_t;
+
+static void g2_dbl(g2_jac_t *r, const g2_jac_t *p) {
+  if (fp2_is_zero(&p->z)) {
+    *r = *p;
+    return;
+  }
+  fp2_t a;
+  fp2_t b;
+  fp2_t c;
+  fp2_t d;
+  fp2_t e;
+  fp2_t f;
+  fp2_sqr(&a, &p->x);
+  fp2_sqr(&b, &p->y);
+  fp2_sqr(&c, &b);
+  fp2_add(&d, &p->x, &b);
+  fp2_sqr(&d, &d);
+  fp2_sub(&d, &d, &a);
+  fp2_sub(&d, &d, &c);
+  fp2_dbl(&d, &d);
+  fp2_dbl(&e, &a);
+  fp2_add(&e, &e, &a);
+  fp2_sqr(&f, &e);
+
+  fp2_t z3;
+  fp2_mul(&z3, &p->y, &p->z);
+  fp2_dbl(&r->z, &z3);
+  fp2_dbl(&a, &d);
+  fp2_sub(&r->x, &f, &a);
+  fp2_sub(&d, &d, &r->x);
+  fp2_mul(&d, &d, &e);
+  fp2_dbl(&c, &c);
+  fp2_dbl(&c, &c);
+  fp2_dbl(&c, &c);
+  fp2_sub(&r->y, &d, &c);
+}
+
+/// Mixed addition with an affine point (madd-2007-bl).
+static void g2_add_affine(g2_jac_t *r, const g2_jac_t *p, const g2_affine_t *q) {
+  if (fp2_is_zero(&p->z)) {
+    r->x = q->x;
+    r->y = q->y;
+    r->z.c0 = FP_ONE;
+    r->z.c1 = (fp_t){{0, 0, 0, 0}};
+    return;
+  }
+  fp2_t z1z1;
+  fp2_t u2;
+  fp2_t s2;
+  fp2_sqr(&z1z1, &p->z);
+  fp2_mul(&u2, &q->x, &z1z1);
+  fp2_mul(&s2, &q->y, &p->z);
+  fp2_mul(&s2, &s2, &z1z1);
+
+  fp2_t h;
+  fp2_t rr;
+  fp2_sub(&h, &u2, &p->x);
+  fp2_sub(&rr, &s2, &p->y);
+  if (fp2_is_zero(&h)) {
+    if (fp2_is_zero(&rr)) {
+      g2_dbl(r, p);
+    } else {
+      r->z = (fp2_t){{{0, 0, 0, 0}}, {{0, 0, 0, 0}}};
+    }
+    return;
+  }
+  fp2_dbl(&rr, &rr);
+
+  fp2_t hh;
+  fp2_t i;
+  fp2_t j;
+  fp2_t v;
+  fp2_sqr(&hh, &h);
+  fp2_dbl(&i, &hh);
+  fp2_dbl(&i, &i);
+  fp2_mul(&j, &h, &i);
+  fp2_mul(&v, &p->x, &i);
+
+  fp2_t z3;
+  fp2_add(&z3, &p->z, &h);
+  fp2_sqr(&z3, &z3);
+  fp2_sub(&z3, &z3, &z1z1);
+  fp2_sub(&z3, &z3, &hh);
+
+  fp2_t x3;
+  fp2_sqr(&x3, &rr);
+  fp2_sub(&x3, &x3, &j);
+  fp2_sub(&x3, &x3, &v);
+  fp2_sub(&x3, &x3, &v);
+
+  fp2_t y3;
+  fp2_t t;
+  fp2_sub(&y3, &v, &x3);
+  fp2_mul(&y3, &y3, &rr);
+  fp2_mul(&t, &p->y, &j);
+  fp2_dbl(&t, &t);
+  fp2_sub(&r->y, &y3, &t);
+  r->x = x3;
+  r->z = z3;
+}
+
+/// Decode and validate a G2 point: on the twist and in the order-r subgroup.
+static bool g2_from_bytes(g2_affine_t *r, const uint8_t *in) {
+  if (!fp2_from_bytes(&r->x, in) || !fp2_from_bytes(&r->y, in + (2 * FP_SIZE))) {
+    return false;
+  }
+  r->infinity = fp2_is_zero(&r->x) && fp2_is_zero(&r->y);
+  if (r->infinity) {
+    return true;
+  }
+
+  fp2_t lhs;
+  fp2_t rhs;
+  fp2_sqr(&lhs, &r->y);
+  fp2_sqr(&rhs, &r->x);
+  fp2_mul(&rhs, &rhs, &r->x);
+  fp2_add(&rhs, &rhs, &TWIST_B);
+  if (!fp2_eq(&lhs, &rhs)) {
+    return false;
+  }
+
+  // r * Q must be the point at infinity
+  g2_jac_t acc = {.z = {{{0, 0, 0, 0}}, {{0, 0, 0, 0}}}};
+  for (int i = 253; i >= 0; i--) {
+    g2_dbl(&acc, &acc);
+    if (((BN254_R[i / 64] >> (i % 64)) & 1) != 0) {
+      g2_add_affine(&acc, &acc, r);
+    }
+  }
+  return fp2_is_zero(&acc.z);
+}
+
+// ============================================================================
+// Miller Loop
+// ============================================================================
+//
+// T is kept in homogeneous projective coordinates (x = X / Z, y = Y / Z).
+// Lines are scaled by Fp2 factors, which the final exponentiation removes.
+
+typedef struct {
+  fp2_t x;
+  fp2_t y;
+  fp2_t z;
+} g2_proj_t;
+
+/// Precomputed G1 point for line evaluation.
+typedef struct {
+  fp_t x;
+  fp_t y;
+} g1_affine_t;
+
+/// T = 2T; multiply f by the tangent line at T evaluated at P.
+static void miller_dbl(fp12_t *f, g2_proj_t *t, const g1_affine_t *p) {
+  fp2_t n;
+  fp2_t d;
+  fp2_t nz;
+  fp2_t dz;
+  fp2_sqr(&n, &t->x);
+  fp2_dbl(&nz, &n);
+  fp2_add(&n, &n, &nz); // N = 3X^2
+  fp2_mul(&d, &t->y, &t->z);
+  fp2_dbl(&d, &d); // D = 2YZ
+  fp2_mul(&nz, &n, &t->z);
+  fp2_mul(&dz, &d, &t->z);
+
+  // l0 = D Z yP, l1 = -N Z xP, l3 = N X - D Y
+  fp2_t l0;
+  fp2_t l1;
+  fp2_t l3;
+  fp2_t tmp;
+  fp2_mul_fp(&l0, &dz, &p->y);
+  fp2_mul_fp(&l1, &nz, &p->x);
+  fp2_neg(&l1, &l1);
+  fp2_mul(&l3, &n, &t->x);
+  fp2_mul(&tmp, &d, &t->y);
+  fp2_sub(&l3, &l3, &tmp);
+  fp12_mul_line(f, &l0, &l1, &l3);
+
+  // X3 = D(N^2 Z - 2 X D^2), Y3 = N(3 X D^2 - N^2 Z) - Y D^3, Z3 = D^3 Z
+  fp2_t d2;
+  fp2_t d3;
+  fp2_t xd2;
+  fp2_t n2z;
+  fp2_sqr(&d2, &d);
+  fp2_mul(&d3, &d2, &d);
+  fp2_mul(&xd2, &t->x, &d2);
+  fp2_mul(&n2z, &nz, &n);
+
+  fp2_t x3;
+  fp2_dbl(&tmp, &xd2);
+  fp2_sub(&x3, &n2z, &tmp);
+  fp2_mul(&x3, &x3, &d);
+
+  fp2_t y3;
+  fp2_add(&y3, &tmp, &xd2);
+  fp2_sub(&y3, &y3, &n2z);
+  fp2_mul(&y3, &y3, &n);
+  fp2_mul(&tmp, &t->y, &d3);
+  fp2_sub(&t->y, &y3, &tmp);
+
+  fp2_mul(&t->z, &d3, &t->z);
+  t->x = x3;
+}
+
+/// T = T + Q; multiply f by the line through T and Q evaluated at P.
+static void miller_add(fp12_t *f, g2_proj_t *t, const fp2_t *qx, const fp2_t *qy,
+                       const g1_affine_t *p) {
+  fp2_t n;
+  fp2_t d;
+  fp2_mul(&n, qy, &t->z);
+  fp2_sub(&n, &n, &t->y); // N = yq Z - Y
+  fp2_mul(&d, qx, &t->z);
+  fp2_sub(&d, &d, &t->x); // D = xq Z - X
+
+  // l0 = D yP, l1 = -N xP, l3 = N xq - D yq
+  fp2_t l0;
+  fp2_t l1;
+  fp2_t l3;
+  fp2_t tmp;
+  fp2_mul_fp(&l0, &d, &p->y);
+  fp2_mul_fp(&l1, &n, &p->x);
+  fp2_neg(&l1, &l1);
+  fp2_mul(&l3, &n, qx);
+  fp2_mul(&tmp, &d, qy);
+  fp2_sub(&l3, &l3, &tmp);
+  fp12_mul_line(f, &l0, &l1, &l3);
+
+  // X3 = D(N^2 Z - 2 X D^2 - D^3), Y3 = N(3 X D^2 + D^3 - N^2 Z) - Y D^3,
+  // Z3 = D^3 Z
+  fp2_t d2;
+  fp2_t d3;
+  fp2_t xd2;
+  fp2_t n2z;
+  fp2_sqr(&d2, &d);
+  fp2_mul(&d3, &d2, &d);
+  fp2_mul(&xd2, &t->x, &d2);
+  fp2_sqr(&n2z, &n);
+  fp2_mul(&n2z, &n2z, &t->z);
+
+  fp2_t x3;
+  fp2_dbl(&tmp, &xd2);
+  fp2_add(&tmp, &tmp, &d3);
+  fp2_sub(&x3, &n2z, &tmp);
+  fp2_mul(&x3, &x3, &d);
+
+  fp2_t y3;
+  fp2_add(&y3, &tmp, &xd2);
+  fp2_sub(&y3, &y3, &n2z);
+  fp2_mul(&y3, &y3, &n);
+  fp2_mul(&tmp, &t->y, &d3);
+  fp2_sub(&t->y, &y3, &tmp);
+
+  fp2_mul(&t->z, &d3, &t->z);
+  t->x = x3;
+}
+
+/// Multi-Miller loop over up to PAIRING_BATCH pairs; multiplies the result
+/// into f.
+static void miller_loop(fp12_t *f, const g1_affine_t *ps, const g2_affine_t *qs,
+                        const size_t count) {
+  g2_proj_t ts[PAIRING_BATCH];
+  fp2_t neg_qy[PAIRING_BATCH];
+  for (size_t j = 0; j < count; j++) {
+    ts[j].x = qs[j].x;
+    ts[j].y = qs[j].y;
+    ts[j].z.c0 = FP_ONE;
+    ts[j].z.c1 = (fp_t){{0, 0, 0, 0}};
+    fp2_neg(&neg_qy[j], &qs[j].y);
+  }
+
+  fp12_t acc;
+  fp12_one(&acc);
+  for (int i = (int)ATE_NAF_LEN - 2; i >= 0; i--) {
+    if (i != (int)ATE_NAF_LEN - 2) {
+      fp12_sqr(&acc, &acc);
+    }
+    for (size_t j = 0; j < count; j++) {
+      miller_dbl(&acc, &ts[j], &ps[j]);
+      if (ATE_NAF[i] == 1) {
+        miller_add(&acc, &ts[j], &qs[j].x, &qs[j].y, &ps[j]);
+      } else if (ATE_NAF[i] == -1) {
+        miller_add(&acc, &ts[j], &qs[j].x, &neg_qy[j], &ps[j]);
+      }
+    }
+  }
+
+  // Lines through pi(Q) and -pi^2(Q)
+  for (size_t j = 0; j < count; j++) {
+    fp2_t x;
+    fp2_t y;
+    fp2_conj(&x, &qs[j].x);
+    fp2_mul(&x, &x, &FROB[0][1]);
+    fp2_conj(&y, &qs[j].y);
+    fp2_mul(&y, &y, &FROB[0][2]);
+    miller_add(&acc, &ts[j], &x, &y, &ps[j]);
+
+    fp2_mul(&x, &qs[j].x, &FROB[1][1]);
+    fp2_mul(&y, &qs[j].y, &FROB[1][2]);
+    fp2_neg(&y, &y);
+    miller_add(&acc, &ts[j], &x, &y, &ps[j]);
+  }
+
+  fp12_mul(f, f, &acc);
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+bool bn254_g1_add(const uint8_t a[BN254_G1_SIZE], const uint8_t b[BN254_G1_SIZE],
+                  uint8_t out[BN254_G1_SIZE]) {
+  g1_t p;
+  g1_t q;
+  if (!g1_from_bytes(&p, a) || !g1_from_bytes(&q, b)) {
+    return false;
+  }
+  g1_add(&p, &p, &q);
+  g1_to_bytes(out, &p);
+  return true;
+}
+
+bool bn254_g1_mul(const uint8_t point[BN254_G1_SIZE], const uint8_t scalar[BN254_SCALAR_SIZE],
+                  uint8_t out[BN254_G1_SIZE]) {
+  g1_t p;
+  if (!g1_from_bytes(&p, point)) {
+    return false;
+  }
+  g1_mul(&p, &p, scalar);
+  g1_to_bytes(out, &p);
+  return true;
+}
+
+bool bn254_pairing_check(const uint8_t *const pairs, const size_t count, bool *const result) {
+  g1_affine_t ps[PAIRING_BATCH];
+  g2_affine_t qs[PAIRING_BATCH];
+  size_t batch = 0;
+  fp12_t f;
+  fp12_one(&f);
+
+  for (size_t i = 0; i < count; i++) {
+    const uint8_t *const in = pairs + (i * BN254_PAIR_SIZE);
+    g1_t p;
+    if (!g1_from_bytes(&p, in) || !g2_from_bytes(&qs[batch], in + BN254_G1_SIZE)) {
+      return false;
+    }
+    if (fp_is_zero(&p.z) || qs[batch].infinity) {
+      continue;
+    }
+    ps[batch].x = p.x;
+    ps[batch].y = p.y;
+    batch++;
+    if (batch == PAIRING_BATCH) {
+      miller_loop(&f, ps, qs, batch);
+      batch = 0;
+    }
+  }
+  if (batch > 0) {
+    miller_loop(&f, ps, qs, batch);
+  }
+
+  fp12_t e;
+  final_exponentiation(&e, &f);
+  *result = fp12_is_one(&e);
+  return true;
+}
@@ -0,0 +1,131 @@
+#include "div0/crypto/ripemd160.h"
+
+static constexpr size_t RIPEMD160_BLOCK_SIZE = 64;
+
+// Message word selection for the left and right lines (5 rounds of 16 steps)
+static const uint8_t RL[80] = {
+    0, 1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 7,  4,  13, 1,
+    10, 6, 15, 3,  12, 0,  9,  5,  2,  14, 11, 8,  3,  10, 14, 4,  9,  15, 8,  1,
+    2, 7,  0,  6,  13, 11, 5,  12, 1,  9,  11, 10, 0,  8,  12, 4,  13, 3,  7,  15,
+    14, 5, 6,  2,  4,  0,  5,  9,  7,  12, 2,  10, 14, 1,  3,  8,  11, 6,  15, 13,
+};
+static const uint8_t RR[80] = {
+    5,  14, 7,  0,  9, 2,  11, 4,  13, 6,  15, 8,  1,  10, 3,  12, 6,  11, 3,  7,
+    0,  13, 5,  10, 14, 15, 8, 12, 4,  9,  1,  2,  15, 5,  1,  3,  7,  14, 6,  9,
+    11, 8,  12, 2,  10, 0,  4, 13, 8,  6,  4,  1,  3,  11, 15, 0,  5,  12, 2,  13,
+    9,  7,  10, 14, 12, 15, 10, 4, 1,  5,  8,  7,  6,  2,  13, 14, 0,  3,  9,  11,
+};
+
+// Rotation amounts for the left and right lines
+static const uint8_t SL[80] = {
+    11, 14, 15, 12, 5,  8,  7,  9,  11, 13, 14, 15, 6,  7,  9,  8,  7,  6,  8,  13,
+    11, 9,  7,  15, 7,  12, 15, 9,  11, 7,  13, 12, 11, 13, 6,  7,  14, 9,  13, 15,
+    14, 8,  13, 6,  5,  12, 7,  5,  11, 12, 14, 15, 14, 15, 9,  8,  9,  14, 5,  6,
+    8,  6,  5,  12, 9,  15, 5,  11, 6,  8,  13, 12, 5,  12, 13, 14, 11, 8,  5,  6,
+};
+static const uint8_t SR[80] = {
+    8,  9,  9,  11, 13, 15, 15, 5,  7,  7,  8,  11, 14, 14, 12, 6,  9,  13, 15, 7,
+    12, 8,  9,  11, 7,  7,  12, 7,  6,  15, 13, 11, 9,  7,  15, 11, 8,  6,  6,  14,
+    12, 13, 5,  14, 13, 13, 7,  5,  15, 5,  8,  11, 14, 14, 6,  14, 6,  9,  12, 9,
+    12, 5,  15, 8,  8,  5,  12, 9,  12, 5,  14, 6,  8,  13, 6,  5,  15, 13, 11, 11,
+};
+
+static const uint32_t KL[5] = {0x00000000, 0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xA953FD4E};
+static const uint32_t KR[5] = {0x50A28BE6, 0x5C4DD124, 0x6D703EF3, 0x7A6D76E9, 0x00000000};
+
+static inline uint32_t rol32(const uint32_t x, const unsigned n) {
+  return (x << n) | (x >> (32 - n));
+}
+
+/// Round function j (0-4); the right line uses them in reverse order.
+static inline uint32_t ripemd_f(const unsigned j, const uint32_t x, const uint32_t y,
+                                const uint32_t z) {
+  switch (j) {
+  case 0:
+    return x ^ y ^ z;
+  case 1:
+    return (x & y) | (~x & z);
+  case 2:
+    return (x | ~y) ^ z;
+  case 3:
+    return (x & z) | (y & ~z);
+  default:
+    return x ^ (y | ~z);
+  }
+}
+
+static void ripemd160_compress(uint32_t h[5], const uint8_t *block) {
+  uint32_t x[16];
+  for (size_t i = 0; i < 16; i++) {
+    const uint8_t *const p = block + (4 * i);
+    x[i] = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+  }
+
+  uint32_t al = h[0];
+  uint32_t bl = h[1];
+  uint32_t cl = h[2];
+  uint32_t dl = h[3];
+  uint32_t el = h[4];
+  uint32_t ar = al;
+  uint32_t br = bl;
+  uint32_t cr = cl;
+  uint32_t dr = dl;
+  uint32_t er = el;
+
+  for (unsigned i = 0; i < 80; i++) {
+    const unsigned round = i / 16;
+    uint32_t t = rol32(al + ripemd_f(round, bl, cl, dl) + x[RL[i]] + KL[round], SL[i]) + el;
+    al = el;
+    el = dl;
+    dl = rol32(cl, 10);
+    cl = bl;
+    bl = t;
+
+    t = rol32(ar + ripemd_f(4 - round, br, cr, dr) + x[RR[i]] + KR[round], SR[i]) + er;
+    ar = er;
+    er = dr;
+    dr = rol32(cr, 10);
+    cr = br;
+    br = t;
+  }
+
+  const uint32_t t = h[1] + cl + dr;
+  h[1] = h[2] + dl + er;
+  h[2] = h[3] + el + ar;
+  h[3] = h[4] + al + br;
+  h[4] = h[0] + bl + cr;
+  h[0] = t;
+}
+
+void ripemd160(const uint8_t *const data, const size_t len, uint8_t out[RIPEMD160_SIZE]) {
+  uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+
+  const size_t full_blocks = len / RIPEMD160_BLOCK_SIZE;
+  for (size_t i = 0; i < full_blocks; i++) {
+    ripemd160_compress(h, data + (i * RIPEMD160_BLOCK_SIZE));
+  }
+
+  // Padding: 0x80, zeros, then the bit length (little-endian) in the last 8 bytes
+  uint8_t tail[2 * RIPEMD160_BLOCK_SIZE] = {0};
+  const size_t rem = len % RIPEMD160_BLOCK_SIZE;
+  for (size_t i = 0; i < rem; i++) {
+    tail[i] = data[(full_blocks * RIPEMD160_BLOCK_SIZE) + i];
+  }
+  tail[rem] = 0x80;
+  const size_t tail_size =
+      rem < RIPEMD160_BLOCK_SIZE - 8 ? RIPEMD160_BLOCK_SIZE : 2 * RIPEMD160_BLOCK_SIZE;
+  const uint64_t bit_len = (uint64_t)len * 8;
+  for (size_t i = 0; i < 8; i++) {
+    tail[tail_size - 8 + i] = (uint8_t)(bit_len >> (8 * i));
+  }
+  for (size_t offset = 0; offset < tail_size; offset += RIPEMD160_BLOCK_SIZE) {
+    ripemd160_compress(h, tail + offset);
+  }
+
+  for (size_t i = 0; i < 5; i++) {
+    out[(4 * i) + 0] = (uint8_t)h[i];
+    out[(4 * i) + 1] = (uint8_t)(h[i] >> 8);
+    out[(4 * i) + 2] = (uint8_t)(h[i] >> 16);
+    out[(4 * i) + 3] = (uint8_t)(h[i] >> 24);
+  }
+}
@@ -75,6 +75,58 @@ pubkey_result_t secp256k1_recover_pubkey(const secp256k1_ctx_t *const ctx,
   return result;
 }
 
+/// Address of a public key: last 20 bytes of keccak256(pubkey without 0x04 prefix).
+static address_t pubkey_to_address(const uint8_t pubkey[64]) {
+  const hash_t pubkey_hash = keccak256(pubkey, 64);
+  address_t addr;
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(addr.bytes, pubkey_hash.bytes + 12, ADDRESS_SIZE);
+  return addr;
+}
+
+ecdsa_sign_result_t secp256k1_sign(const secp256k1_ctx_t *const ctx,
+                                   const uint8_t message_hash[32], const uint8_t secret_key[32]) {
+  ecdsa_sign_result_t result = {.success = false, .recovery_id = 0, .signature = {0}};
+
+  if (ctx == nullptr || ctx->ctx == nullptr) {
+    return result;
+  }
+  if (message_hash == nullptr || secret_key == nullptr) {
+    return result;
+  }
+
+  // Default nonce function is RFC 6979; signatures come out low-s normalized
+  secp256k1_ecdsa_recoverable_signature sig;
+  if (secp256k1_ecdsa_sign_recoverable(ctx->ctx, &sig, message_hash, secret_key, nullptr,
+                                       nullptr) == 0) {
+    return result;
+  }
+
+  secp256k1_ecdsa_recoverable_signature_serialize_compact(ctx->ctx, result.signature,
+                                                          &result.recovery_id, &sig);
+  result.success = true;
+  return result;
+}
+
+bool secp256k1_secret_to_address(const secp256k1_ctx_t *const ctx, const uint8_t secret_key[32],
+                                 address_t *const out) {
+  if (ctx == nullptr || ctx->ctx == nullptr || secret_key == nullptr) {
+    return false;
+  }
+
+  secp256k1_pubkey pubkey;
+  if (secp256k1_ec_pubkey_create(ctx->ctx, &pubkey, secret_key) == 0) {
+    return false;
+  }
+
+  uint8_t serialized[65];
+  size_t output_len = 65;
+  secp256k1_ec_pubkey_serialize(ctx->ctx, serialized, &output_len, &pubkey,
+                                SECP256K1_EC_UNCOMPRESSED);
+  *out = pubkey_to_address(serialized + 1);
+  return true;
+}
+
 ecrecover_result_t secp256k1_ecrecover(const secp256k1_ctx_t *const ctx,
                                        const uint256_t *const message_hash, const uint64_t v,
                                        const uint256_t *const r, const uint256_t *const s,
@@ -135,12 +187,7 @@ ecrecover_result_t secp256k1_ecrecover(const secp256k1_ctx_t *const ctx,
     return result;
   }
 
-  // Address = last 20 bytes of keccak256(public_key)
-  const hash_t pubkey_hash = keccak256(pk.pubkey, 64);
-
-  // Extract last 20 bytes from the 32-byte hash (bytes 12-31)
-  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
-  memcpy(result.address.bytes, pubkey_hash.bytes + 12, ADDRESS_SIZE);
+  result.address = pubkey_to_address(pk.pubkey);
   result.success = true;
   return result;
 }
\ No newline at end of file
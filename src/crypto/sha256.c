@@ -0,0 +1,201 @@
+#include "div0/crypto/sha256.h"
+
+#include <stdbool.h>
+
+// The SHA extensions kernel is compiled for hosted x86-64 with a target
+// attribute and picked at runtime, so default builds (no -march) use it too.
+// Freestanding builds and other targets only have the portable kernel.
+#if !defined(DIV0_FREESTANDING) && defined(__x86_64__)
+#define SHA256_SHA_NI 1
+#include <immintrin.h>
+#endif
+
+static constexpr size_t SHA256_BLOCK_SIZE = 64;
+
+static const uint32_t SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+    0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+    0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+    0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+    0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+    0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+    0xc67178f2,
+};
+
+static const uint32_t SHA256_IV[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+// ============================================================================
+// Portable Kernel
+// ============================================================================
+
+static inline uint32_t ror32(const uint32_t x, const unsigned n) {
+  return (x >> n) | (x << (32 - n));
+}
+
+static inline uint32_t load_be32(const uint8_t *const p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void sha256_compress_generic(uint32_t state[8], const uint8_t *data, size_t blocks) {
+  while (blocks-- > 0) {
+    uint32_t w[64];
+    for (size_t i = 0; i < 16; i++) {
+      w[i] = load_be32(data + (4 * i));
+    }
+    for (size_t i = 16; i < 64; i++) {
+      const uint32_t s0 = ror32(w[i - 15], 7) ^ ror32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+      const uint32_t s1 = ror32(w[i - 2], 17) ^ ror32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state[0];
+    uint32_t b = state[1];
+    uint32_t c = state[2];
+    uint32_t d = state[3];
+    uint32_t e = state[4];
+    uint32_t f = state[5];
+    uint32_t g = state[6];
+    uint32_t h = state[7];
+    for (size_t i = 0; i < 64; i++) {
+      const uint32_t s1 = ror32(e, 6) ^ ror32(e, 11) ^ ror32(e, 25);
+      const uint32_t ch = (e & f) ^ (~e & g);
+      const uint32_t t1 = h + s1 + ch + SHA256_K[i] + w[i];
+      const uint32_t s0 = ror32(a, 2) ^ ror32(a, 13) ^ ror32(a, 22);
+      const uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+      const uint32_t t2 = s0 + maj;
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+    data += SHA256_BLOCK_SIZE;
+  }
+}
+
+// ============================================================================
+// SHA Extensions Kernel
+// ============================================================================
+//
+// The state is kept as ABEF/CDGH halves for sha256rnds2. Each group of four
+// rounds consumes one message vector; the schedule for later groups is
+// computed from the four most recent vectors with sha256msg1/msg2.
+
+#ifdef SHA256_SHA_NI
+
+__attribute__((target("sha,sse4.1"))) static void
+sha256_compress_shani(uint32_t state[8], const uint8_t *data, size_t blocks) {
+  const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+  __m128i tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+  __m128i state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+  tmp = _mm_shuffle_epi32(tmp, 0xB1);                 // CDAB
+  state1 = _mm_shuffle_epi32(state1, 0x1B);           // EFGH
+  __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);   // ABEF
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0);        // CDGH
+
+  while (blocks-- > 0) {
+    const __m128i abef_save = state0;
+    const __m128i cdgh_save = state1;
+    __m128i msgs[4];
+
+#pragma GCC unroll 16
+    for (int i = 0; i < 16; i++) {
+      if (i < 4) {
+        msgs[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + (16 * i))), byte_swap);
+      }
+      const __m128i k = _mm_loadu_si128((const __m128i *)&SHA256_K[4 * i]);
+      __m128i msg = _mm_add_epi32(msgs[i % 4], k);
+      state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+      if (i >= 3 && i <= 14) {
+        const __m128i next = _mm_alignr_epi8(msgs[i % 4], msgs[(i + 3) % 4], 4);
+        msgs[(i + 1) % 4] = _mm_add_epi32(msgs[(i + 1) % 4], next);
+        msgs[(i + 1) % 4] = _mm_sha256msg2_epu32(msgs[(i + 1) % 4], msgs[i % 4]);
+      }
+      msg = _mm_shuffle_epi32(msg, 0x0E);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+      if (i >= 1 && i <= 12) {
+        msgs[(i + 3) % 4] = _mm_sha256msg1_epu32(msgs[(i + 3) % 4], msgs[i % 4]);
+      }
+    }
+
+    state0 = _mm_add_epi32(state0, abef_save);
+    state1 = _mm_add_epi32(state1, cdgh_save);
+    data += SHA256_BLOCK_SIZE;
+  }
+
+  tmp = _mm_shuffle_epi32(state0, 0x1B);       // FEBA
+  state1 = _mm_shuffle_epi32(state1, 0xB1);    // DCHG
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0); // DCBA
+  state1 = _mm_alignr_epi8(state1, tmp, 8);    // HGFE
+  _mm_storeu_si128((__m128i *)&state[0], state0);
+  _mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+#endif // SHA256_SHA_NI
+
+static void sha256_compress(uint32_t state[8], const uint8_t *data, size_t blocks) {
+#ifdef SHA256_SHA_NI
+  if (__builtin_cpu_supports("sha")) {
+    sha256_compress_shani(state, data, blocks);
+    return;
+  }
+#endif
+  sha256_compress_generic(state, data, blocks);
+}
+
+// ============================================================================
+// One-Shot API
+// ============================================================================
+
+hash_t sha256(const uint8_t *const data, const size_t len) {
+  uint32_t state[8];
+  for (size_t i = 0; i < 8; i++) {
+    state[i] = SHA256_IV[i];
+  }
+
+  const size_t full_blocks = len / SHA256_BLOCK_SIZE;
+  if (full_blocks > 0) {
+    sha256_compress(state, data, full_blocks);
+  }
+
+  // Padding: 0x80, zeros, then the bit length (big-endian) in the last 8 bytes
+  uint8_t tail[2 * SHA256_BLOCK_SIZE] = {0};
+  const size_t rem = len % SHA256_BLOCK_SIZE;
+  for (size_t i = 0; i < rem; i++) {
+    tail[i] = data[(full_blocks * SHA256_BLOCK_SIZE) + i];
+  }
+  tail[rem] = 0x80;
+  const size_t tail_size = rem < SHA256_BLOCK_SIZE - 8 ? SHA256_BLOCK_SIZE : 2 * SHA256_BLOCK_SIZE;
+  const uint64_t bit_len = (uint64_t)len * 8;
+  for (size_t i = 0; i < 8; i++) {
+    tail[tail_size - 1 - i] = (uint8_t)(bit_len >> (8 * i));
+  }
+  sha256_compress(state, tail, tail_size / SHA256_BLOCK_SIZE);
+
+  hash_t out;
+  for (size_t i = 0; i < 8; i++) {
+    out.bytes[(4 * i) + 0] = (uint8_t)(state[i] >> 24);
+    out.bytes[(4 * i) + 1] = (uint8_t)(state[i] >> 16);
+    out.bytes[(4 * i) + 2] = (uint8_t)(state[i] >> 8);
+    out.bytes[(4 * i) + 3] = (uint8_t)state[i];
+  }
+  return out;
+}
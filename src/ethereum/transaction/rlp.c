@@ -127,13 +127,21 @@ static tx_decode_error_t decode_required_address(rlp_decoder_t *const dec, addre
   return TX_DECODE_OK;
 }
 
+/// Decode calldata. With copy == false the bytes point into the input, which
+/// the caller keeps alive and unmodified (arena-backed, so bytes_free is a no-op).
 static tx_decode_error_t decode_tx_data(rlp_decoder_t *const dec, bytes_t *const out,
-                                        div0_arena_t *const arena) {
+                                        div0_arena_t *const arena, const bool copy) {
   const rlp_bytes_result_t result = rlp_decode_bytes(dec);
   if (result.error != RLP_SUCCESS) {
     return TX_DECODE_INVALID_RLP;
   }
   bytes_init_arena(out, arena);
+  if (!copy) {
+    out->data = (uint8_t *)result.data;
+    out->size = result.len;
+    out->capacity = result.len;
+    return TX_DECODE_OK;
+  }
   if (result.len > 0) {
     if (!bytes_reserve(out, result.len)) {
       return TX_DECODE_ALLOC_FAILED;
@@ -332,8 +340,9 @@ static tx_decode_error_t decode_blob_hashes(rlp_decoder_t *const dec, eip4844_tx
 // Transaction Decoding
 // ============================================================================
 
-tx_decode_result_t legacy_tx_decode(const uint8_t *const data, const size_t len,
-                                    legacy_tx_t *const tx, div0_arena_t *const arena) {
+static tx_decode_result_t legacy_decode(const uint8_t *const data, const size_t len,
+                                        legacy_tx_t *const tx, div0_arena_t *const arena,
+                                        const bool copy) {
   if (len == 0) {
     return (tx_decode_result_t){.error = TX_DECODE_EMPTY_INPUT, .bytes_consumed = 0};
   }
@@ -349,7 +358,7 @@ tx_decode_result_t legacy_tx_decode(const uint8_t *const data, const size_t len,
   DECODE_U64(&dec, tx->gas_limit);
   CHECK_HELPER(decode_optional_address(&dec, &tx->to, arena));
   DECODE_UINT256(&dec, tx->value);
-  CHECK_HELPER(decode_tx_data(&dec, &tx->data, arena));
+  CHECK_HELPER(decode_tx_data(&dec, &tx->data, arena, copy));
   DECODE_U64(&dec, tx->v);
   DECODE_UINT256(&dec, tx->r);
   DECODE_UINT256(&dec, tx->s);
@@ -357,8 +366,9 @@ tx_decode_result_t legacy_tx_decode(const uint8_t *const data, const size_t len,
   RETURN_SUCCESS(list_header);
 }
 
-tx_decode_result_t eip2930_tx_decode(const uint8_t *const data, const size_t len,
-                                     eip2930_tx_t *const tx, div0_arena_t *const arena) {
+static tx_decode_result_t eip2930_decode(const uint8_t *const data, const size_t len,
+                                         eip2930_tx_t *const tx, div0_arena_t *const arena,
+                                         const bool copy) {
   if (len == 0) {
     return (tx_decode_result_t){.error = TX_DECODE_EMPTY_INPUT, .bytes_consumed = 0};
   }
@@ -375,7 +385,7 @@ tx_decode_result_t eip2930_tx_decode(const uint8_t *const data, const size_t len
   DECODE_U64(&dec, tx->gas_limit);
   CHECK_HELPER(decode_optional_address(&dec, &tx->to, arena));
   DECODE_UINT256(&dec, tx->value);
-  CHECK_HELPER(decode_tx_data(&dec, &tx->data, arena));
+  CHECK_HELPER(decode_tx_data(&dec, &tx->data, arena, copy));
   CHECK_HELPER(decode_access_list(&dec, &tx->access_list, arena));
   DECODE_YPARITY(&dec, tx->y_parity);
   DECODE_UINT256(&dec, tx->r);
@@ -384,8 +394,9 @@ tx_decode_result_t eip2930_tx_decode(const uint8_t *const data, const size_t len
   RETURN_SUCCESS(list_header);
 }
 
-tx_decode_result_t eip1559_tx_decode(const uint8_t *const data, const size_t len,
-                                     eip1559_tx_t *const tx, div0_arena_t *const arena) {
+static tx_decode_result_t eip1559_decode(const uint8_t *const data, const size_t len,
+                                         eip1559_tx_t *const tx, div0_arena_t *const arena,
+                                         const bool copy) {
   if (len == 0) {
     return (tx_decode_result_t){.error = TX_DECODE_EMPTY_INPUT, .bytes_consumed = 0};
   }
@@ -403,7 +414,7 @@ tx_decode_result_t eip1559_tx_decode(const uint8_t *const data, const size_t len
   DECODE_U64(&dec, tx->gas_limit);
   CHECK_HELPER(decode_optional_address(&dec, &tx->to, arena));
   DECODE_UINT256(&dec, tx->value);
-  CHECK_HELPER(decode_tx_data(&dec, &tx->data, arena));
+  CHECK_HELPER(decode_tx_data(&dec, &tx->data, arena, copy));
   CHECK_HELPER(decode_access_list(&dec, &tx->access_list, arena));
   DECODE_YPARITY(&dec, tx->y_parity);
   DECODE_UINT256(&dec, tx->r);
@@ -412,8 +423,9 @@ tx_decode_result_t eip1559_tx_decode(const uint8_t *const data, const size_t len
   RETURN_SUCCESS(list_header);
 }
 
-tx_decode_result_t eip4844_tx_decode(const uint8_t *const data, const size_t len,
-                                     eip4844_tx_t *const tx, div0_arena_t *const arena) {
+static tx_decode_result_t eip4844_decode(const uint8_t *const data, const size_t len,
+                                         eip4844_tx_t *const tx, div0_arena_t *const arena,
+                                         const bool copy) {
   if (len == 0) {
     return (tx_decode_result_t){.error = TX_DECODE_EMPTY_INPUT, .bytes_consumed = 0};
   }
@@ -431,7 +443,7 @@ tx_decode_result_t eip4844_tx_decode(const uint8_t *const data, const size_t len
   DECODE_U64(&dec, tx->gas_limit);
   CHECK_HELPER(decode_required_address(&dec, &tx->to));
   DECODE_UINT256(&dec, tx->value);
-  CHECK_HELPER(decode_tx_data(&dec, &tx->data, arena));
+  CHECK_HELPER(decode_tx_data(&dec, &tx->data, arena, copy));
   CHECK_HELPER(decode_access_list(&dec, &tx->access_list, arena));
   DECODE_UINT256(&dec, tx->max_fee_per_blob_gas);
   CHECK_HELPER(decode_blob_hashes(&dec, tx, arena));
@@ -442,8 +454,9 @@ tx_decode_result_t eip4844_tx_decode(const uint8_t *const data, const size_t len
   RETURN_SUCCESS(list_header);
 }
 
-tx_decode_result_t eip7702_tx_decode(const uint8_t *const data, const size_t len,
-                                     eip7702_tx_t *const tx, div0_arena_t *const arena) {
+static tx_decode_result_t eip7702_decode(const uint8_t *const data, const size_t len,
+                                         eip7702_tx_t *const tx, div0_arena_t *const arena,
+                                         const bool copy) {
   if (len == 0) {
     return (tx_decode_result_t){.error = TX_DECODE_EMPTY_INPUT, .bytes_consumed = 0};
   }
@@ -461,7 +474,7 @@ tx_decode_result_t eip7702_tx_decode(const uint8_t *const data, const size_t len
   DECODE_U64(&dec, tx->gas_limit);
   CHECK_HELPER(decode_required_address(&dec, &tx->to));
   DECODE_UINT256(&dec, tx->value);
-  CHECK_HELPER(decode_tx_data(&dec, &tx->data, arena));
+  CHECK_HELPER(decode_tx_data(&dec, &tx->data, arena, copy));
   CHECK_HELPER(decode_access_list(&dec, &tx->access_list, arena));
   CHECK_HELPER(decode_authorization_list(&dec, &tx->authorization_list, arena));
   DECODE_YPARITY(&dec, tx->y_parity);
@@ -471,8 +484,34 @@ tx_decode_result_t eip7702_tx_decode(const uint8_t *const data, const size_t len
   RETURN_SUCCESS(list_header);
 }
 
-tx_decode_result_t transaction_decode(const uint8_t *const data, const size_t len,
-                                      transaction_t *const tx, div0_arena_t *const arena) {
+tx_decode_result_t legacy_tx_decode(const uint8_t *const data, const size_t len,
+                                    legacy_tx_t *const tx, div0_arena_t *const arena) {
+  return legacy_decode(data, len, tx, arena, true);
+}
+
+tx_decode_result_t eip2930_tx_decode(const uint8_t *const data, const size_t len,
+                                     eip2930_tx_t *const tx, div0_arena_t *const arena) {
+  return eip2930_decode(data, len, tx, arena, true);
+}
+
+tx_decode_result_t eip1559_tx_decode(const uint8_t *const data, const size_t len,
+                                     eip1559_tx_t *const tx, div0_arena_t *const arena) {
+  return eip1559_decode(data, len, tx, arena, true);
+}
+
+tx_decode_result_t eip4844_tx_decode(const uint8_t *const data, const size_t len,
+                                     eip4844_tx_t *const tx, div0_arena_t *const arena) {
+  return eip4844_decode(data, len, tx, arena, true);
+}
+
+tx_decode_result_t eip7702_tx_decode(const uint8_t *const data, const size_t len,
+                                     eip7702_tx_t *const tx, div0_arena_t *const arena) {
+  return eip7702_decode(data, len, tx, arena, true);
+}
+
+static tx_decode_result_t decode_any(const uint8_t *const data, const size_t len,
+                                     transaction_t *const tx, div0_arena_t *const arena,
+                                     const bool copy) {
   if (len == 0) {
     return (tx_decode_result_t){.error = TX_DECODE_EMPTY_INPUT, .bytes_consumed = 0};
   }
@@ -481,7 +520,7 @@ tx_decode_result_t transaction_decode(const uint8_t *const data, const size_t le
 
   if (first_byte >= 0xc0) {
     tx->type = TX_TYPE_LEGACY;
-    return legacy_tx_decode(data, len, &tx->legacy, arena);
+    return legacy_decode(data, len, &tx->legacy, arena, copy);
   }
 
   // Per EIP-2718, type byte 0x00 is reserved for distinguishing legacy RLP
@@ -495,19 +534,19 @@ tx_decode_result_t transaction_decode(const uint8_t *const data, const size_t le
   switch (first_byte) {
   case 0x01:
     tx->type = TX_TYPE_EIP2930;
-    result = eip2930_tx_decode(data + 1, len - 1, &tx->eip2930, arena);
+    result = eip2930_decode(data + 1, len - 1, &tx->eip2930, arena, copy);
     break;
   case 0x02:
     tx->type = TX_TYPE_EIP1559;
-    result = eip1559_tx_decode(data + 1, len - 1, &tx->eip1559, arena);
+    result = eip1559_decode(data + 1, len - 1, &tx->eip1559, arena, copy);
     break;
   case 0x03:
     tx->type = TX_TYPE_EIP4844;
-    result = eip4844_tx_decode(data + 1, len - 1, &tx->eip4844, arena);
+    result = eip4844_decode(data + 1, len - 1, &tx->eip4844, arena, copy);
     break;
   case 0x04:
     tx->type = TX_TYPE_EIP7702;
-    result = eip7702_tx_decode(data + 1, len - 1, &tx->eip7702, arena);
+    result = eip7702_decode(data + 1, len - 1, &tx->eip7702, arena, copy);
     break;
   default:
     return (tx_decode_result_t){.error = TX_DECODE_INVALID_TYPE, .bytes_consumed = 0};
@@ -519,6 +558,25 @@ tx_decode_result_t transaction_decode(const uint8_t *const data, const size_t le
   return result;
 }
 
+tx_decode_result_t transaction_decode(const uint8_t *const data, const size_t len,
+                                      transaction_t *const tx, div0_arena_t *const arena) {
+  transaction_clear_cache(tx);
+  return decode_any(data, len, tx, arena, true);
+}
+
+tx_decode_result_t transaction_decode_view(const uint8_t *const data, const size_t len,
+                                           transaction_t *const tx, div0_arena_t *const arena) {
+  transaction_clear_cache(tx);
+  const tx_decode_result_t result = decode_any(data, len, tx, arena, false);
+  if (result.error == TX_DECODE_OK) {
+    tx->encoded = data;
+    tx->encoded_size = result.bytes_consumed;
+    tx->hash = keccak256(data, result.bytes_consumed);
+    tx->hash_cached = true;
+  }
+  return result;
+}
+
 // ============================================================================
 // Encoding Helpers (public, used by signer.c as well)
 // ============================================================================
@@ -863,6 +921,12 @@ bytes_t transaction_encode(const transaction_t *const tx, div0_arena_t *const ar
 // ============================================================================
 
 hash_t transaction_hash(const transaction_t *const tx, div0_arena_t *const arena) {
+  if (tx->hash_cached) {
+    return tx->hash;
+  }
+  if (tx->encoded != nullptr) {
+    return keccak256(tx->encoded, tx->encoded_size);
+  }
   const bytes_t encoded = transaction_encode(tx, arena);
   return keccak256(encoded.data, encoded.size);
 }
@@ -2,7 +2,9 @@
 
 #include "div0/crypto/keccak256.h"
 #include "div0/ethereum/transaction/rlp.h"
+#include "div0/rlp/decode.h"
 #include "div0/rlp/encode.h"
+#include "div0/rlp/helpers.h"
 
 hash_t legacy_tx_signing_hash(const legacy_tx_t *const tx, div0_arena_t *const arena) {
   bytes_t output;
@@ -232,7 +234,103 @@ hash_t eip7702_tx_signing_hash(const eip7702_tx_t *const tx, div0_arena_t *const
   return keccak256(output.data, output.size);
 }
 
+// ============================================================================
+// Signing Hash From Retained Encoding
+// ============================================================================
+
+/// Number of fields in front of the signature (v/y_parity, r, s).
+static size_t unsigned_field_count(const tx_type_t type) {
+  switch (type) {
+  case TX_TYPE_LEGACY:
+    return 6;
+  case TX_TYPE_EIP2930:
+    return 8;
+  case TX_TYPE_EIP1559:
+    return 9;
+  case TX_TYPE_EIP4844:
+    return 11;
+  case TX_TYPE_EIP7702:
+    return 10;
+  }
+  return 0;
+}
+
+/// Write an RLP list header for payload_len (at most 9 bytes).
+static size_t write_list_header(uint8_t *const out, const size_t payload_len) {
+  if (payload_len < RLP_SMALL_PREFIX_BARRIER) {
+    out[0] = (uint8_t)(RLP_EMPTY_LIST_BYTE + payload_len);
+    return 1;
+  }
+  const int len_bytes = rlp_length_of_length(payload_len);
+  out[0] = (uint8_t)(RLP_SHORT_LIST_MAX + len_bytes);
+  for (int i = 0; i < len_bytes; i++) {
+    out[1 + i] = (uint8_t)(payload_len >> (8 * (len_bytes - 1 - i)));
+  }
+  return 1 + (size_t)len_bytes;
+}
+
+/// Signing hash of a transaction from the encoding it was decoded from.
+///
+/// The unsigned fields are a prefix of the signed list, so the signing
+/// payload is hashed straight from the encoding: only the type byte, a new
+/// list header and (for EIP-155 legacy transactions) [chain_id, 0, 0] are
+/// hashed around them, without copying or re-encoding the calldata.
+static bool signing_hash_from_encoding(const transaction_t *const tx, div0_arena_t *const arena,
+                                       hash_t *const out) {
+  const size_t type_len = tx->type == TX_TYPE_LEGACY ? 0 : 1;
+  if (tx->encoded_size <= type_len) {
+    return false;
+  }
+
+  rlp_decoder_t decoder;
+  rlp_decoder_init(&decoder, tx->encoded + type_len, tx->encoded_size - type_len);
+  const rlp_list_result_t list = rlp_decode_list_header(&decoder);
+  if (list.error != RLP_SUCCESS) {
+    return false;
+  }
+  const size_t fields_start = rlp_decoder_position(&decoder);
+  const size_t field_count = unsigned_field_count(tx->type);
+  for (size_t i = 0; i < field_count; i++) {
+    rlp_skip_item(&decoder);
+  }
+  const size_t fields_len = rlp_decoder_position(&decoder) - fields_start;
+
+  // EIP-155: append [chain_id, 0, 0]
+  static const uint8_t zeros_rlp[2] = {RLP_EMPTY_STRING_BYTE, RLP_EMPTY_STRING_BYTE};
+  bytes_t chain_id_rlp;
+  bytes_init_arena(&chain_id_rlp, arena);
+  size_t suffix_len = 0;
+  uint64_t chain_id = 0;
+  if (tx->type == TX_TYPE_LEGACY && legacy_tx_chain_id(&tx->legacy, &chain_id)) {
+    chain_id_rlp = rlp_encode_u64(arena, chain_id);
+    suffix_len = chain_id_rlp.size + sizeof(zeros_rlp);
+  }
+
+  uint8_t header[9];
+  const size_t header_len = write_list_header(header, fields_len + suffix_len);
+
+  keccak256_hasher_t hasher;
+  keccak256_init(&hasher);
+  keccak256_update(&hasher, tx->encoded, type_len);
+  keccak256_update(&hasher, header, header_len);
+  keccak256_update(&hasher, tx->encoded + type_len + fields_start, fields_len);
+  if (suffix_len > 0) {
+    keccak256_update(&hasher, chain_id_rlp.data, chain_id_rlp.size);
+    keccak256_update(&hasher, zeros_rlp, sizeof(zeros_rlp));
+  }
+  *out = keccak256_finalize(&hasher);
+  keccak256_destroy(&hasher);
+  return true;
+}
+
 hash_t transaction_signing_hash(const transaction_t *const tx, div0_arena_t *const arena) {
+  if (tx->signing_hash_cached) {
+    return tx->signing_hash;
+  }
+  hash_t from_encoding;
+  if (tx->encoded != nullptr && signing_hash_from_encoding(tx, arena, &from_encoding)) {
+    return from_encoding;
+  }
   switch (tx->type) {
   case TX_TYPE_LEGACY:
     return legacy_tx_signing_hash(&tx->legacy, arena);
@@ -249,6 +347,17 @@ hash_t transaction_signing_hash(const transaction_t *const tx, div0_arena_t *con
   }
 }
 
+void transaction_cache_hashes(transaction_t *const tx, div0_arena_t *const arena) {
+  if (!tx->hash_cached) {
+    tx->hash = transaction_hash(tx, arena);
+    tx->hash_cached = true;
+  }
+  if (!tx->signing_hash_cached) {
+    tx->signing_hash = transaction_signing_hash(tx, arena);
+    tx->signing_hash_cached = true;
+  }
+}
+
 hash_t authorization_signing_hash(const authorization_t *const auth, div0_arena_t *const arena) {
   bytes_t output;
   bytes_init_arena(&output, arena);
@@ -86,6 +86,9 @@ static bool calculate_call_gas(uint64_t *const parent_gas, const call_setup_t *c
                         setup->ret_size, &mem_cost)) {
     return false;
   }
+  if (mem_cost > UINT64_MAX - call_gas_cost) {
+    return false;
+  }
   call_gas_cost += mem_cost;
 
   // Deduct call overhead from parent
@@ -132,8 +135,9 @@ static void expand_call_memory(evm_memory_t *memory, const call_setup_t *setup)
     }
   }
   if (max_end > evm_memory_size(memory)) {
+    // Already charged by calculate_call_gas
     uint64_t dummy_cost = 0;
-    (void)evm_memory_expand(memory, 0, max_end, &dummy_cost);
+    (void)evm_memory_expand(memory, 0, max_end, UINT64_MAX, &dummy_cost);
   }
 }
 
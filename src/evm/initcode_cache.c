@@ -0,0 +1,130 @@
+#include "div0/evm/initcode_cache.h"
+
+#include "div0/crypto/keccak256.h"
+
+#include "jumpdest.h"
+
+#include <stdalign.h>
+#include <string.h>
+
+// Initial number of slots (power of two)
+static constexpr size_t INITCODE_CACHE_INITIAL_CAPACITY = 64;
+
+// Fingerprint mixing constants (64-bit golden ratio and a MurmurHash3 multiplier)
+static constexpr uint64_t FINGERPRINT_SEED = 0x9e3779b97f4a7c15ULL;
+static constexpr uint64_t FINGERPRINT_MUL = 0xff51afd7ed558ccdULL;
+
+/// Fast non-cryptographic hash of the init code, eight bytes per step.
+/// Hits are confirmed with memcmp, so collisions only cost a comparison.
+static uint64_t fingerprint(const uint8_t *const code, const size_t code_size) {
+  uint64_t h = FINGERPRINT_SEED ^ code_size;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= code_size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+    memcpy(&word, code + i, sizeof(word));
+    h = (h ^ word) * FINGERPRINT_MUL;
+    h ^= h >> 32;
+  }
+  for (; i < code_size; i++) {
+    h = (h ^ code[i]) * FINGERPRINT_MUL;
+  }
+  return h ^ (h >> 29);
+}
+
+static initcode_cache_entry_t *alloc_entries(div0_arena_t *const arena, const size_t capacity) {
+  initcode_cache_entry_t *const entries = div0_arena_alloc_array(
+      arena, capacity, sizeof(initcode_cache_entry_t), alignof(initcode_cache_entry_t));
+  if (entries != nullptr) {
+    __builtin___memset_chk(entries, 0, capacity * sizeof(initcode_cache_entry_t),
+                           capacity * sizeof(initcode_cache_entry_t));
+  }
+  return entries;
+}
+
+/// Free slot for a fingerprint in a table known to have one.
+static initcode_cache_entry_t *free_slot(initcode_cache_entry_t *const entries,
+                                         const size_t capacity, const uint64_t fp) {
+  size_t i = (size_t)fp & (capacity - 1);
+  while (entries[i].code != nullptr) {
+    i = (i + 1) & (capacity - 1);
+  }
+  return &entries[i];
+}
+
+/// Double the table. The old table stays in the arena until it is destroyed.
+static bool grow(initcode_cache_t *const cache) {
+  const size_t capacity = cache->capacity * 2;
+  initcode_cache_entry_t *const entries = alloc_entries(cache->arena, capacity);
+  if (entries == nullptr) {
+    return false;
+  }
+  for (size_t i = 0; i < cache->capacity; i++) {
+    if (cache->entries[i].code != nullptr) {
+      *free_slot(entries, capacity, cache->entries[i].fingerprint) = cache->entries[i];
+    }
+  }
+  cache->entries = entries;
+  cache->capacity = capacity;
+  cache->size += capacity * sizeof(initcode_cache_entry_t);
+  return true;
+}
+
+bool initcode_cache_init(initcode_cache_t *const cache, div0_arena_t *const arena) {
+  cache->arena = arena;
+  cache->count = 0;
+  cache->capacity = INITCODE_CACHE_INITIAL_CAPACITY;
+  cache->size = cache->capacity * sizeof(initcode_cache_entry_t);
+  cache->entries = alloc_entries(arena, cache->capacity);
+  return cache->entries != nullptr;
+}
+
+initcode_cache_entry_t *initcode_cache_lookup(initcode_cache_t *const cache,
+                                              const uint8_t *const code, const size_t code_size) {
+  const uint64_t fp = fingerprint(code, code_size);
+  size_t i = (size_t)fp & (cache->capacity - 1);
+  while (cache->entries[i].code != nullptr) {
+    initcode_cache_entry_t *const entry = &cache->entries[i];
+    if (entry->fingerprint == fp && entry->code_size == code_size &&
+        memcmp(entry->code, code, code_size) == 0) {
+      return entry;
+    }
+    i = (i + 1) & (cache->capacity - 1);
+  }
+
+  // Keep the load factor at or below 3/4
+  if ((cache->count + 1) * 4 > cache->capacity * 3 && !grow(cache)) {
+    return nullptr;
+  }
+
+  uint8_t *const copy = div0_arena_alloc_array(cache->arena, code_size, 1, DIV0_ARENA_ALIGNMENT);
+  if (copy == nullptr) {
+    return nullptr;
+  }
+  __builtin___memcpy_chk(copy, code, code_size, code_size);
+  const uint8_t *const bitmap = jumpdest_compute_bitmap(copy, code_size, cache->arena);
+  if (bitmap == nullptr) {
+    return nullptr;
+  }
+
+  initcode_cache_entry_t *const entry = free_slot(cache->entries, cache->capacity, fp);
+  *entry = (initcode_cache_entry_t){
+      .fingerprint = fp,
+      .code = copy,
+      .code_size = code_size,
+      .jumpdest_bitmap = bitmap,
+      .code_hash = hash_zero(),
+      .has_code_hash = false,
+  };
+  cache->count++;
+  cache->size += code_size + jumpdest_bitmap_size(code_size);
+  return entry;
+}
+
+const hash_t *initcode_cache_code_hash(initcode_cache_entry_t *const entry) {
+  if (!entry->has_code_hash) {
+    entry->code_hash = keccak256(entry->code, entry->code_size);
+    entry->has_code_hash = true;
+  }
+  return &entry->code_hash;
+}
@@ -0,0 +1,993 @@
+// Interpreter template: included by evm.c once per fork, with no include guard.
+//
+// The including file defines:
+//   INTERP_FN              Name of the generated frame executor
+//   INTERP_GAS_TABLE       constexpr static gas table of the fork
+//   INTERP_CANCUN_OPCODES  1 if Cancun opcodes are valid (preprocessor-visible)
+//   INTERP_TRACING         1 to call evm->tracer hooks (which must be non-null)
+//
+// Every gas lookup and fork check is a compile-time constant inside the
+// generated function, and opcodes the fork does not have stay on op_invalid in
+// its dispatch table. All four macros are undefined again at the end.
+
+/// Executes a single frame until it returns, calls, or errors.
+/// Uses computed gotos for efficient opcode dispatch.
+// NOLINTBEGIN(readability-function-size)
+static frame_result_t INTERP_FN(evm_t *evm, call_frame_t *frame) {
+  // Dispatch table using computed gotos (GCC/Clang extension)
+  static void *dispatch_table[OPCODE_TABLE_SIZE] = {
+      [0x00 ... OPCODE_MAX] = &&op_invalid,
+      [OP_STOP] = &&op_stop,
+      [OP_ADD] = &&op_add,
+      [OP_MUL] = &&op_mul,
+      [OP_SUB] = &&op_sub,
+      [OP_DIV] = &&op_div,
+      [OP_SDIV] = &&op_sdiv,
+      [OP_MOD] = &&op_mod,
+      [OP_SMOD] = &&op_smod,
+      [OP_ADDMOD] = &&op_addmod,
+      [OP_MULMOD] = &&op_mulmod,
+      [OP_EXP] = &&op_exp,
+      [OP_SIGNEXTEND] = &&op_signextend,
+      // Comparison opcodes
+      [OP_LT] = &&op_lt,
+      [OP_GT] = &&op_gt,
+      [OP_SLT] = &&op_slt,
+      [OP_SGT] = &&op_sgt,
+      [OP_EQ] = &&op_eq,
+      [OP_ISZERO] = &&op_iszero,
+      // Bitwise opcodes
+      [OP_AND] = &&op_and,
+      [OP_OR] = &&op_or,
+      [OP_XOR] = &&op_xor,
+      [OP_NOT] = &&op_not,
+      [OP_BYTE] = &&op_byte,
+      [OP_SHL] = &&op_shl,
+      [OP_SHR] = &&op_shr,
+      [OP_SAR] = &&op_sar,
+      [OP_PUSH0] = &&op_push0,
+      [OP_PUSH1] = &&op_push1,
+      [OP_PUSH2] = &&op_push2,
+      [OP_PUSH3] = &&op_push3,
+      [OP_PUSH4] = &&op_push4,
+      [OP_PUSH5] = &&op_push5,
+      [OP_PUSH6] = &&op_push6,
+      [OP_PUSH7] = &&op_push7,
+      [OP_PUSH8] = &&op_push8,
+      [OP_PUSH9] = &&op_push9,
+      [OP_PUSH10] = &&op_push10,
+      [OP_PUSH11] = &&op_push11,
+      [OP_PUSH12] = &&op_push12,
+      [OP_PUSH13] = &&op_push13,
+      [OP_PUSH14] = &&op_push14,
+      [OP_PUSH15] = &&op_push15,
+      [OP_PUSH16] = &&op_push16,
+      [OP_PUSH17] = &&op_push17,
+      [OP_PUSH18] = &&op_push18,
+      [OP_PUSH19] = &&op_push19,
+      [OP_PUSH20] = &&op_push20,
+      [OP_PUSH21] = &&op_push21,
+      [OP_PUSH22] = &&op_push22,
+      [OP_PUSH23] = &&op_push23,
+      [OP_PUSH24] = &&op_push24,
+      [OP_PUSH25] = &&op_push25,
+      [OP_PUSH26] = &&op_push26,
+      [OP_PUSH27] = &&op_push27,
+      [OP_PUSH28] = &&op_push28,
+      [OP_PUSH29] = &&op_push29,
+      [OP_PUSH30] = &&op_push30,
+      [OP_PUSH31] = &&op_push31,
+      [OP_PUSH32] = &&op_push32,
+      [OP_MLOAD] = &&op_mload,
+      [OP_MSTORE] = &&op_mstore,
+      [OP_MSTORE8] = &&op_mstore8,
+      [OP_MSIZE] = &&op_msize,
+      [OP_KECCAK256] = &&op_keccak256,
+      // Control flow opcodes
+      [OP_JUMP] = &&op_jump,
+      [OP_JUMPI] = &&op_jumpi,
+      [OP_JUMPDEST] = &&op_jumpdest,
+      [OP_PC] = &&op_pc,
+      [OP_GAS] = &&op_gas,
+      [OP_SLOAD] = &&op_sload,
+      [OP_SSTORE] = &&op_sstore,
+#if INTERP_CANCUN_OPCODES
+      [OP_TLOAD] = &&op_tload,
+      [OP_TSTORE] = &&op_tstore,
+      [OP_MCOPY] = &&op_mcopy,
+#endif
+      // Environmental information opcodes
+      [OP_ADDRESS] = &&op_address,
+      [OP_BALANCE] = &&op_balance,
+      [OP_ORIGIN] = &&op_origin,
+      [OP_CALLER] = &&op_caller,
+      [OP_CALLVALUE] = &&op_callvalue,
+      [OP_CALLDATALOAD] = &&op_calldataload,
+      [OP_CALLDATASIZE] = &&op_calldatasize,
+      [OP_CALLDATACOPY] = &&op_calldatacopy,
+      [OP_CODESIZE] = &&op_codesize,
+      [OP_CODECOPY] = &&op_codecopy,
+      [OP_GASPRICE] = &&op_gasprice,
+      [OP_EXTCODESIZE] = &&op_extcodesize,
+      [OP_EXTCODECOPY] = &&op_extcodecopy,
+      [OP_RETURNDATASIZE] = &&op_returndatasize,
+      [OP_RETURNDATACOPY] = &&op_returndatacopy,
+      [OP_EXTCODEHASH] = &&op_extcodehash,
+      // Block information opcodes
+      [OP_BLOCKHASH] = &&op_blockhash,
+      [OP_COINBASE] = &&op_coinbase,
+      [OP_TIMESTAMP] = &&op_timestamp,
+      [OP_NUMBER] = &&op_number,
+      [OP_PREVRANDAO] = &&op_prevrandao,
+      [OP_GASLIMIT] = &&op_gaslimit,
+      [OP_CHAINID] = &&op_chainid,
+      [OP_SELFBALANCE] = &&op_selfbalance,
+      [OP_BASEFEE] = &&op_basefee,
+#if INTERP_CANCUN_OPCODES
+      [OP_BLOBHASH] = &&op_blobhash,
+      [OP_BLOBBASEFEE] = &&op_blobbasefee,
+#endif
+      [OP_POP] = &&op_pop,
+      [OP_DUP1] = &&op_dup1,
+      [OP_DUP2] = &&op_dup2,
+      [OP_DUP3] = &&op_dup3,
+      [OP_DUP4] = &&op_dup4,
+      [OP_DUP5] = &&op_dup5,
+      [OP_DUP6] = &&op_dup6,
+      [OP_DUP7] = &&op_dup7,
+      [OP_DUP8] = &&op_dup8,
+      [OP_DUP9] = &&op_dup9,
+      [OP_DUP10] = &&op_dup10,
+      [OP_DUP11] = &&op_dup11,
+      [OP_DUP12] = &&op_dup12,
+      [OP_DUP13] = &&op_dup13,
+      [OP_DUP14] = &&op_dup14,
+      [OP_DUP15] = &&op_dup15,
+      [OP_DUP16] = &&op_dup16,
+      [OP_SWAP1] = &&op_swap1,
+      [OP_SWAP2] = &&op_swap2,
+      [OP_SWAP3] = &&op_swap3,
+      [OP_SWAP4] = &&op_swap4,
+      [OP_SWAP5] = &&op_swap5,
+      [OP_SWAP6] = &&op_swap6,
+      [OP_SWAP7] = &&op_swap7,
+      [OP_SWAP8] = &&op_swap8,
+      [OP_SWAP9] = &&op_swap9,
+      [OP_SWAP10] = &&op_swap10,
+      [OP_SWAP11] = &&op_swap11,
+      [OP_SWAP12] = &&op_swap12,
+      [OP_SWAP13] = &&op_swap13,
+      [OP_SWAP14] = &&op_swap14,
+      [OP_SWAP15] = &&op_swap15,
+      [OP_SWAP16] = &&op_swap16,
+      [OP_CALL] = &&op_call,
+      [OP_STATICCALL] = &&op_staticcall,
+      [OP_DELEGATECALL] = &&op_delegatecall,
+      [OP_CALLCODE] = &&op_callcode,
+      [OP_CREATE] = &&op_create,
+      [OP_CREATE2] = &&op_create2,
+      [OP_RETURN] = &&op_return,
+      [OP_REVERT] = &&op_revert,
+      // Logging opcodes
+      [OP_LOG0] = &&op_log0,
+      [OP_LOG1] = &&op_log1,
+      [OP_LOG2] = &&op_log2,
+      [OP_LOG3] = &&op_log3,
+      [OP_LOG4] = &&op_log4,
+  };
+
+#if INTERP_TRACING
+#define DISPATCH()                                      \
+  if (frame->pc >= frame->code_size)                    \
+    goto done;                                          \
+  evm_tracer_step(evm->tracer, frame, evm->gas_refund); \
+  goto *dispatch_table[frame->code[frame->pc++]]
+#else
+#define DISPATCH()                   \
+  if (frame->pc >= frame->code_size) \
+    goto done;                       \
+  goto *dispatch_table[frame->code[frame->pc++]]
+#endif
+
+  // Start execution
+  DISPATCH();
+
+op_stop:
+  return frame_result_stop();
+
+op_add:
+  if (!evm_stack_has_items(frame->stack, 2)) {
+    return frame_result_error(EVM_STACK_UNDERFLOW);
+  }
+  {
+    const uint256_t a = evm_stack_pop_unsafe(frame->stack);
+    const uint256_t b = evm_stack_pop_unsafe(frame->stack);
+    evm_stack_push_unsafe(frame->stack, uint256_add(a, b));
+  }
+  DISPATCH();
+
+op_mul: {
+  const evm_status_t status = op_mul(frame, INTERP_GAS_TABLE[OP_MUL]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_sub: {
+  const evm_status_t status = op_sub(frame, INTERP_GAS_TABLE[OP_SUB]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_div: {
+  const evm_status_t status = op_div(frame, INTERP_GAS_TABLE[OP_DIV]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_sdiv: {
+  const evm_status_t status = op_sdiv(frame, INTERP_GAS_TABLE[OP_SDIV]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_mod: {
+  const evm_status_t status = op_mod(frame, INTERP_GAS_TABLE[OP_MOD]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_smod: {
+  const evm_status_t status = op_smod(frame, INTERP_GAS_TABLE[OP_SMOD]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_addmod: {
+  const evm_status_t status = op_addmod(frame, INTERP_GAS_TABLE[OP_ADDMOD]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_mulmod: {
+  const evm_status_t status = op_mulmod(frame, INTERP_GAS_TABLE[OP_MULMOD]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_exp: {
+  const evm_status_t status = op_exp(frame);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_signextend: {
+  const evm_status_t status = op_signextend(frame, INTERP_GAS_TABLE[OP_SIGNEXTEND]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+  // =========================================================================
+  // Comparison opcodes
+  // =========================================================================
+
+op_lt: {
+  const evm_status_t status = op_lt(frame, INTERP_GAS_TABLE[OP_LT]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_gt: {
+  const evm_status_t status = op_gt(frame, INTERP_GAS_TABLE[OP_GT]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_slt: {
+  const evm_status_t status = op_slt(frame, INTERP_GAS_TABLE[OP_SLT]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_sgt: {
+  const evm_status_t status = op_sgt(frame, INTERP_GAS_TABLE[OP_SGT]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_eq: {
+  const evm_status_t status = op_eq(frame, INTERP_GAS_TABLE[OP_EQ]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_iszero: {
+  const evm_status_t status = op_iszero(frame, INTERP_GAS_TABLE[OP_ISZERO]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+  // =========================================================================
+  // Bitwise opcodes
+  // =========================================================================
+
+op_and: {
+  const evm_status_t status = op_and(frame, INTERP_GAS_TABLE[OP_AND]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_or: {
+  const evm_status_t status = op_or(frame, INTERP_GAS_TABLE[OP_OR]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_xor: {
+  const evm_status_t status = op_xor(frame, INTERP_GAS_TABLE[OP_XOR]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_not: {
+  const evm_status_t status = op_not(frame, INTERP_GAS_TABLE[OP_NOT]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_byte: {
+  const evm_status_t status = op_byte(frame, INTERP_GAS_TABLE[OP_BYTE]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_shl: {
+  const evm_status_t status = op_shl(frame, INTERP_GAS_TABLE[OP_SHL]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_shr: {
+  const evm_status_t status = op_shr(frame, INTERP_GAS_TABLE[OP_SHR]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_sar: {
+  const evm_status_t status = op_sar(frame, INTERP_GAS_TABLE[OP_SAR]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_push0: {
+  const evm_status_t status = op_push0(frame, INTERP_GAS_TABLE[OP_PUSH0]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+#define PUSH_N_HANDLER(n)                                                  \
+  op_push##n : {                                                           \
+    evm_status_t status = op_push_n(frame, n, INTERP_GAS_TABLE[OP_PUSH##n]); \
+    if (status != EVM_OK) {                                                \
+      return frame_result_error(status);                                   \
+    }                                                                      \
+    DISPATCH();                                                            \
+  }
+
+  PUSH_N_HANDLER(1)
+  PUSH_N_HANDLER(2)
+  PUSH_N_HANDLER(3)
+  PUSH_N_HANDLER(4)
+  PUSH_N_HANDLER(5)
+  PUSH_N_HANDLER(6)
+  PUSH_N_HANDLER(7)
+  PUSH_N_HANDLER(8)
+  PUSH_N_HANDLER(9)
+  PUSH_N_HANDLER(10)
+  PUSH_N_HANDLER(11)
+  PUSH_N_HANDLER(12)
+  PUSH_N_HANDLER(13)
+  PUSH_N_HANDLER(14)
+  PUSH_N_HANDLER(15)
+  PUSH_N_HANDLER(16)
+  PUSH_N_HANDLER(17)
+  PUSH_N_HANDLER(18)
+  PUSH_N_HANDLER(19)
+  PUSH_N_HANDLER(20)
+  PUSH_N_HANDLER(21)
+  PUSH_N_HANDLER(22)
+  PUSH_N_HANDLER(23)
+  PUSH_N_HANDLER(24)
+  PUSH_N_HANDLER(25)
+  PUSH_N_HANDLER(26)
+  PUSH_N_HANDLER(27)
+  PUSH_N_HANDLER(28)
+  PUSH_N_HANDLER(29)
+  PUSH_N_HANDLER(30)
+  PUSH_N_HANDLER(31)
+  PUSH_N_HANDLER(32)
+
+#undef PUSH_N_HANDLER
+
+  // =============================================================================
+  // Environmental Information Opcodes (0x30-0x3F)
+  // =============================================================================
+
+// Macro for simple context opcodes that only need frame and gas_table
+#define CONTEXT_OP_HANDLER(name, opcode)                            \
+  op_##name : {                                                     \
+    evm_status_t status = op_##name(frame, INTERP_GAS_TABLE[opcode]); \
+    if (status != EVM_OK) {                                         \
+      return frame_result_error(status);                            \
+    }                                                               \
+    DISPATCH();                                                     \
+  }
+
+// Macro for state-dependent opcodes (BALANCE, EXTCODESIZE, etc.)
+// Returns EVM_STATE_UNAVAILABLE if state is not available
+#define STATE_OP_HANDLER(name, opcode)                  \
+  op_##name : {                                         \
+    if (evm->state == nullptr) {                        \
+      return frame_result_error(EVM_STATE_UNAVAILABLE); \
+    }                                                   \
+    evm_status_t status = op_##name(frame, evm->state); \
+    if (status != EVM_OK) {                             \
+      return frame_result_error(status);                \
+    }                                                   \
+    DISPATCH();                                         \
+  }
+
+  CONTEXT_OP_HANDLER(address, OP_ADDRESS)
+  STATE_OP_HANDLER(balance, OP_BALANCE)
+
+op_origin: {
+  // ORIGIN needs access to evm->tx, so inline here
+  if (!evm_stack_ensure_space(frame->stack, 1)) {
+    return frame_result_error(EVM_STACK_OVERFLOW);
+  }
+  if (frame->gas < INTERP_GAS_TABLE[OP_ORIGIN]) {
+    return frame_result_error(EVM_OUT_OF_GAS);
+  }
+  frame->gas -= INTERP_GAS_TABLE[OP_ORIGIN];
+  evm_stack_push_unsafe(frame->stack, address_to_uint256(&evm->tx->origin));
+  DISPATCH();
+}
+
+  CONTEXT_OP_HANDLER(caller, OP_CALLER)
+  CONTEXT_OP_HANDLER(callvalue, OP_CALLVALUE)
+  CONTEXT_OP_HANDLER(calldataload, OP_CALLDATALOAD)
+  CONTEXT_OP_HANDLER(calldatasize, OP_CALLDATASIZE)
+  CONTEXT_OP_HANDLER(calldatacopy, OP_CALLDATACOPY)
+  CONTEXT_OP_HANDLER(codesize, OP_CODESIZE)
+  CONTEXT_OP_HANDLER(codecopy, OP_CODECOPY)
+  STATE_OP_HANDLER(extcodesize, OP_EXTCODESIZE)
+  STATE_OP_HANDLER(extcodecopy, OP_EXTCODECOPY)
+
+op_gasprice: {
+  // GASPRICE needs access to evm->tx, so inline here
+  if (!evm_stack_ensure_space(frame->stack, 1)) {
+    return frame_result_error(EVM_STACK_OVERFLOW);
+  }
+  if (frame->gas < INTERP_GAS_TABLE[OP_GASPRICE]) {
+    return frame_result_error(EVM_OUT_OF_GAS);
+  }
+  frame->gas -= INTERP_GAS_TABLE[OP_GASPRICE];
+  evm_stack_push_unsafe(frame->stack, evm->tx->gas_price);
+  DISPATCH();
+}
+
+op_returndatasize: {
+  // RETURNDATASIZE needs access to evm->return_data_size, so inline here
+  if (!evm_stack_ensure_space(frame->stack, 1)) {
+    return frame_result_error(EVM_STACK_OVERFLOW);
+  }
+  if (frame->gas < INTERP_GAS_TABLE[OP_RETURNDATASIZE]) {
+    return frame_result_error(EVM_OUT_OF_GAS);
+  }
+  frame->gas -= INTERP_GAS_TABLE[OP_RETURNDATASIZE];
+  evm_stack_push_unsafe(frame->stack, uint256_from_u64(evm->return_data_size));
+  DISPATCH();
+}
+
+op_returndatacopy: {
+  const evm_status_t status = op_returndatacopy(frame, INTERP_GAS_TABLE[OP_RETURNDATACOPY],
+                                                evm->return_data, evm->return_data_size);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+  STATE_OP_HANDLER(extcodehash, OP_EXTCODEHASH)
+
+#undef CONTEXT_OP_HANDLER
+#undef STATE_OP_HANDLER
+
+  // =============================================================================
+  // Block Information Opcodes (0x40-0x4A)
+  // =============================================================================
+
+// Macro for block opcodes that need block context
+#define BLOCK_OP_HANDLER(name, opcode)                                          \
+  op_##name : {                                                                 \
+    evm_status_t status = op_##name(frame, evm->block, INTERP_GAS_TABLE[opcode]); \
+    if (status != EVM_OK) {                                                     \
+      return frame_result_error(status);                                        \
+    }                                                                           \
+    DISPATCH();                                                                 \
+  }
+
+  BLOCK_OP_HANDLER(blockhash, OP_BLOCKHASH)
+  BLOCK_OP_HANDLER(coinbase, OP_COINBASE)
+  BLOCK_OP_HANDLER(timestamp, OP_TIMESTAMP)
+  BLOCK_OP_HANDLER(number, OP_NUMBER)
+  BLOCK_OP_HANDLER(prevrandao, OP_PREVRANDAO)
+  BLOCK_OP_HANDLER(gaslimit, OP_GASLIMIT)
+  BLOCK_OP_HANDLER(chainid, OP_CHAINID)
+  BLOCK_OP_HANDLER(basefee, OP_BASEFEE)
+#if INTERP_CANCUN_OPCODES
+  BLOCK_OP_HANDLER(blobbasefee, OP_BLOBBASEFEE)
+#endif
+
+#undef BLOCK_OP_HANDLER
+
+op_selfbalance: {
+  if (evm->state == nullptr) {
+    return frame_result_error(EVM_STATE_UNAVAILABLE);
+  }
+  const evm_status_t status = op_selfbalance(frame, evm->state, INTERP_GAS_TABLE[OP_SELFBALANCE]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+#if INTERP_CANCUN_OPCODES
+op_blobhash: {
+  const evm_status_t status = op_blobhash(frame, evm->tx, INTERP_GAS_TABLE[OP_BLOBHASH]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+#endif
+
+  // =============================================================================
+  // Stack Manipulation Opcodes (POP, DUP, SWAP)
+  // =============================================================================
+
+op_pop: {
+  const evm_status_t status = op_pop(frame, INTERP_GAS_TABLE[OP_POP]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+#define DUP_N_HANDLER(n)                                               \
+  op_dup##n : {                                                        \
+    evm_status_t status = op_dup(frame, n, INTERP_GAS_TABLE[OP_DUP##n]); \
+    if (status != EVM_OK) {                                            \
+      return frame_result_error(status);                               \
+    }                                                                  \
+    DISPATCH();                                                        \
+  }
+
+  DUP_N_HANDLER(1)
+  DUP_N_HANDLER(2)
+  DUP_N_HANDLER(3)
+  DUP_N_HANDLER(4)
+  DUP_N_HANDLER(5)
+  DUP_N_HANDLER(6)
+  DUP_N_HANDLER(7)
+  DUP_N_HANDLER(8)
+  DUP_N_HANDLER(9)
+  DUP_N_HANDLER(10)
+  DUP_N_HANDLER(11)
+  DUP_N_HANDLER(12)
+  DUP_N_HANDLER(13)
+  DUP_N_HANDLER(14)
+  DUP_N_HANDLER(15)
+  DUP_N_HANDLER(16)
+
+#undef DUP_N_HANDLER
+
+#define SWAP_N_HANDLER(n)                                                \
+  op_swap##n : {                                                         \
+    evm_status_t status = op_swap(frame, n, INTERP_GAS_TABLE[OP_SWAP##n]); \
+    if (status != EVM_OK) {                                              \
+      return frame_result_error(status);                                 \
+    }                                                                    \
+    DISPATCH();                                                          \
+  }
+
+  SWAP_N_HANDLER(1)
+  SWAP_N_HANDLER(2)
+  SWAP_N_HANDLER(3)
+  SWAP_N_HANDLER(4)
+  SWAP_N_HANDLER(5)
+  SWAP_N_HANDLER(6)
+  SWAP_N_HANDLER(7)
+  SWAP_N_HANDLER(8)
+  SWAP_N_HANDLER(9)
+  SWAP_N_HANDLER(10)
+  SWAP_N_HANDLER(11)
+  SWAP_N_HANDLER(12)
+  SWAP_N_HANDLER(13)
+  SWAP_N_HANDLER(14)
+  SWAP_N_HANDLER(15)
+  SWAP_N_HANDLER(16)
+
+#undef SWAP_N_HANDLER
+
+op_mload: {
+  const evm_status_t status = op_mload(frame, INTERP_GAS_TABLE[OP_MLOAD]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_mstore: {
+  const evm_status_t status = op_mstore(frame, INTERP_GAS_TABLE[OP_MSTORE]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_mstore8: {
+  const evm_status_t status = op_mstore8(frame, INTERP_GAS_TABLE[OP_MSTORE8]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+#if INTERP_CANCUN_OPCODES
+op_mcopy: {
+  const evm_status_t status = op_mcopy(frame, INTERP_GAS_TABLE[OP_MCOPY]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+#endif
+
+op_keccak256: {
+  const evm_status_t status = op_keccak256(frame, INTERP_GAS_TABLE[OP_KECCAK256]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_msize: {
+  const evm_status_t status = op_msize(frame, INTERP_GAS_TABLE[OP_MSIZE]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+  // =============================================================================
+  // Control Flow Opcodes (JUMP, JUMPI, JUMPDEST, PC, GAS)
+  // =============================================================================
+
+op_jump: {
+  const uint8_t *bitmap = get_jumpdest_bitmap(evm, frame);
+  if (bitmap == nullptr) {
+    return frame_result_error(EVM_OUT_OF_GAS); // Allocation failure
+  }
+  const evm_status_t status = op_jump(frame, bitmap, INTERP_GAS_TABLE[OP_JUMP]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_jumpi: {
+  const uint8_t *bitmap = get_jumpdest_bitmap(evm, frame);
+  if (bitmap == nullptr) {
+    return frame_result_error(EVM_OUT_OF_GAS);
+  }
+  const evm_status_t status = op_jumpi(frame, bitmap, INTERP_GAS_TABLE[OP_JUMPI]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_jumpdest: {
+  const evm_status_t status = op_jumpdest(frame, INTERP_GAS_TABLE[OP_JUMPDEST]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_pc: {
+  // PC pushes the position of THIS instruction, frame->pc was already incremented by DISPATCH
+  const evm_status_t status = op_pc(frame, frame->pc - 1, INTERP_GAS_TABLE[OP_PC]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_gas: {
+  const evm_status_t status = op_gas(frame, INTERP_GAS_TABLE[OP_GAS]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_sload: {
+  if (evm->state == nullptr) {
+    return frame_result_error(EVM_INVALID_OPCODE);
+  }
+#if INTERP_TRACING
+  const bool has_slot = evm_stack_has_items(frame->stack, 1);
+  const uint256_t slot = has_slot ? evm_stack_peek_unsafe(frame->stack, 0) : uint256_zero();
+#endif
+  const evm_status_t status = op_sload(frame, evm->state);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+#if INTERP_TRACING
+  evm_tracer_storage_access(evm->tracer, frame, slot, evm_stack_peek_unsafe(frame->stack, 0),
+                            false);
+#endif
+  DISPATCH();
+}
+
+op_sstore: {
+  if (evm->state == nullptr) {
+    return frame_result_error(EVM_INVALID_OPCODE);
+  }
+#if INTERP_TRACING
+  const bool has_args = evm_stack_has_items(frame->stack, 2);
+  const uint256_t slot = has_args ? evm_stack_peek_unsafe(frame->stack, 0) : uint256_zero();
+  const uint256_t value = has_args ? evm_stack_peek_unsafe(frame->stack, 1) : uint256_zero();
+#endif
+  const evm_status_t status = op_sstore(frame, evm->state, &evm->gas_refund);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+#if INTERP_TRACING
+  evm_tracer_storage_access(evm->tracer, frame, slot, value, true);
+#endif
+  DISPATCH();
+}
+
+#if INTERP_CANCUN_OPCODES
+op_tload: {
+  const evm_status_t status =
+      op_tload(frame, &evm->transient_storage, INTERP_GAS_TABLE[OP_TLOAD]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+
+op_tstore: {
+  const evm_status_t status =
+      op_tstore(frame, &evm->transient_storage, INTERP_GAS_TABLE[OP_TSTORE]);
+  if (status != EVM_OK) {
+    return frame_result_error(status);
+  }
+  DISPATCH();
+}
+#endif
+
+op_call: {
+  const call_op_result_t result = op_call(evm, frame);
+  if (result.has_error) {
+    return frame_result_error(result.error);
+  }
+  if (result.should_call) {
+    return frame_result_call();
+  }
+  DISPATCH();
+}
+
+op_staticcall: {
+  const call_op_result_t result = op_staticcall(evm, frame);
+  if (result.has_error) {
+    return frame_result_error(result.error);
+  }
+  if (result.should_call) {
+    return frame_result_call();
+  }
+  DISPATCH();
+}
+
+op_delegatecall: {
+  const call_op_result_t result = op_delegatecall(evm, frame);
+  if (result.has_error) {
+    return frame_result_error(result.error);
+  }
+  if (result.should_call) {
+    return frame_result_call();
+  }
+  DISPATCH();
+}
+
+op_callcode: {
+  const call_op_result_t result = op_callcode(evm, frame);
+  if (result.has_error) {
+    return frame_result_error(result.error);
+  }
+  if (result.should_call) {
+    return frame_result_call();
+  }
+  DISPATCH();
+}
+
+op_create: {
+  const call_op_result_t result = op_create(evm, frame);
+  if (result.has_error) {
+    return frame_result_error(result.error);
+  }
+  if (result.should_call) {
+    return frame_result_create();
+  }
+  DISPATCH();
+}
+
+op_create2: {
+  const call_op_result_t result = op_create2(evm, frame);
+  if (result.has_error) {
+    return frame_result_error(result.error);
+  }
+  if (result.should_call) {
+    return frame_result_create();
+  }
+  DISPATCH();
+}
+
+op_return: {
+  // Stack: [offset, size] => []
+  if (!evm_stack_has_items(frame->stack, 2)) {
+    return frame_result_error(EVM_STACK_UNDERFLOW);
+  }
+  const uint256_t offset_u256 = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t size_u256 = evm_stack_pop_unsafe(frame->stack);
+
+  // Validate offset and size fit in uint64
+  if (!uint256_fits_u64(offset_u256) || !uint256_fits_u64(size_u256)) {
+    return frame_result_error(EVM_OUT_OF_GAS);
+  }
+  const uint64_t offset = uint256_to_u64_unsafe(offset_u256);
+  const uint64_t size = uint256_to_u64_unsafe(size_u256);
+
+  // Expand memory if needed
+  if (size > 0) {
+    uint64_t mem_cost = 0;
+    if (!evm_memory_expand(frame->memory, offset, size, frame->gas, &mem_cost)) {
+      return frame_result_error(EVM_OUT_OF_GAS);
+    }
+    if (frame->gas < mem_cost) {
+      return frame_result_error(EVM_OUT_OF_GAS);
+    }
+    frame->gas -= mem_cost;
+  }
+
+  return frame_result_return(offset, size);
+}
+
+op_revert: {
+  // Stack: [offset, size] => []
+  if (!evm_stack_has_items(frame->stack, 2)) {
+    return frame_result_error(EVM_STACK_UNDERFLOW);
+  }
+  const uint256_t offset_u256 = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t size_u256 = evm_stack_pop_unsafe(frame->stack);
+
+  // Validate offset and size fit in uint64
+  if (!uint256_fits_u64(offset_u256) || !uint256_fits_u64(size_u256)) {
+    return frame_result_error(EVM_OUT_OF_GAS);
+  }
+  const uint64_t offset = uint256_to_u64_unsafe(offset_u256);
+  const uint64_t size = uint256_to_u64_unsafe(size_u256);
+
+  // Expand memory if needed
+  if (size > 0) {
+    uint64_t mem_cost = 0;
+    if (!evm_memory_expand(frame->memory, offset, size, frame->gas, &mem_cost)) {
+      return frame_result_error(EVM_OUT_OF_GAS);
+    }
+    if (frame->gas < mem_cost) {
+      return frame_result_error(EVM_OUT_OF_GAS);
+    }
+    frame->gas -= mem_cost;
+  }
+
+  return frame_result_revert(offset, size);
+}
+
+// =============================================================================
+// Logging Opcodes (LOG0-LOG4)
+// =============================================================================
+
+#define LOG_N_HANDLER(n)                                              \
+  op_log##n : {                                                       \
+    evm_status_t status = op_log_n(&evm->logs, evm->arena, frame, n); \
+    if (status != EVM_OK) {                                           \
+      return frame_result_error(status);                              \
+    }                                                                 \
+    DISPATCH();                                                       \
+  }
+
+  LOG_N_HANDLER(0)
+  LOG_N_HANDLER(1)
+  LOG_N_HANDLER(2)
+  LOG_N_HANDLER(3)
+  LOG_N_HANDLER(4)
+
+#undef LOG_N_HANDLER
+
+op_invalid:
+  return frame_result_error(EVM_INVALID_OPCODE);
+
+done:
+  return frame_result_stop();
+
+#undef DISPATCH
+}
+// NOLINTEND(readability-function-size)
+
+#undef INTERP_FN
+#undef INTERP_GAS_TABLE
+#undef INTERP_CANCUN_OPCODES
+#undef INTERP_TRACING
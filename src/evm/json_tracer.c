@@ -0,0 +1,168 @@
+#include "div0/evm/json_tracer.h"
+
+#ifndef DIV0_FREESTANDING
+
+#include "div0/evm/memory.h"
+#include "div0/evm/opcodes.h"
+#include "div0/evm/stack.h"
+#include "div0/util/hex.h"
+
+#include <inttypes.h>
+#include <stdalign.h>
+#include <string.h>
+
+/// Fixed part of a line: pc, op, gas, memSize, depth, refund, opName and keys.
+static constexpr size_t LINE_FIXED_SIZE = 256;
+
+/// Rendered stack item: quotes, comma and "0x" + 64 digits.
+static constexpr size_t LINE_STACK_ITEM_SIZE = 70;
+
+/// Output bytes hex-encoded per write.
+static constexpr size_t OUTPUT_CHUNK_SIZE = 64;
+
+/// Error string for a failed frame (geth wording where one exists).
+static const char *status_message(const evm_status_t status) {
+  switch (status) {
+  case EVM_OK:
+    return "";
+  case EVM_STACK_OVERFLOW:
+    return "stack limit reached";
+  case EVM_STACK_UNDERFLOW:
+    return "stack underflow";
+  case EVM_INVALID_OPCODE:
+    return "invalid opcode";
+  case EVM_OUT_OF_GAS:
+    return "out of gas";
+  case EVM_INVALID_JUMP:
+    return "invalid jump destination";
+  case EVM_WRITE_PROTECTION:
+    return "write protection";
+  case EVM_CALL_DEPTH_EXCEEDED:
+    return "max call depth exceeded";
+  case EVM_INSUFFICIENT_BALANCE:
+    return "insufficient balance for transfer";
+  case EVM_STATE_UNAVAILABLE:
+    return "state unavailable";
+  }
+  return "unknown error";
+}
+
+/// Append formatted text to the pending line (the buffer is sized so it cannot overflow).
+static void line_append(evm_json_tracer_t *const tracer, const char *const text) {
+  const size_t len = strlen(text);
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(tracer->line + tracer->line_len, text, len);
+  tracer->line_len += len;
+}
+
+/// Write the pending step with its now known cost.
+static void flush_pending(evm_json_tracer_t *const tracer, const uint64_t gas_after) {
+  if (!tracer->pending) {
+    return;
+  }
+  const uint64_t cost = tracer->pending_gas > gas_after ? tracer->pending_gas - gas_after : 0;
+  char cost_hex[19];
+  hex_encode_u64(cost, cost_hex);
+  fwrite(tracer->line, 1, tracer->split, tracer->out);
+  fprintf(tracer->out, "\"gasCost\":\"%s\",", cost_hex);
+  fwrite(tracer->line + tracer->split, 1, tracer->line_len - tracer->split, tracer->out);
+  tracer->pending = false;
+}
+
+static void json_step(evm_tracer_t *const base, const evm_trace_step_t *const step) {
+  const auto tracer = (evm_json_tracer_t *)base;
+  flush_pending(tracer, step->gas);
+
+  char text[LINE_FIXED_SIZE];
+  char gas_hex[19];
+  hex_encode_u64(step->gas, gas_hex);
+  tracer->line_len = 0;
+  snprintf(text, sizeof(text), "{\"pc\":%" PRIu64 ",\"op\":%u,\"gas\":\"%s\",", step->pc,
+           (unsigned)step->opcode, gas_hex);
+  line_append(tracer, text);
+  tracer->split = tracer->line_len;
+
+  snprintf(text, sizeof(text), "\"memSize\":%zu,\"stack\":[",
+           evm_memory_size(step->frame->memory));
+  line_append(tracer, text);
+  const evm_stack_t *const stack = step->frame->stack;
+  const uint16_t size = evm_stack_size(stack);
+  for (uint16_t i = 0; i < size; i++) {
+    char item[67];
+    // Bottom to top
+    hex_encode_uint256(&stack->items[i], item);
+    snprintf(text, sizeof(text), "%s\"%s\"", i == 0 ? "" : ",", item);
+    line_append(tracer, text);
+  }
+  snprintf(text, sizeof(text), "],\"depth\":%u,\"refund\":%" PRIu64 ",\"opName\":\"%s\"}\n",
+           (unsigned)step->frame->depth + 1, step->refund, evm_opcode_name(step->opcode));
+  line_append(tracer, text);
+
+  tracer->pending_gas = step->gas;
+  tracer->pending = true;
+}
+
+static void json_call_enter(evm_tracer_t *const base, const call_frame_t *const parent,
+                            const call_frame_t *const frame) {
+  const auto tracer = (evm_json_tracer_t *)base;
+  if (parent == nullptr) {
+    tracer->root_gas = frame->gas;
+    return;
+  }
+  // The calling opcode's cost includes the gas forwarded to the child
+  flush_pending(tracer, parent->gas);
+}
+
+/// Write the summary line for the root frame.
+static void write_summary(evm_json_tracer_t *const tracer, const call_frame_t *const frame,
+                          const frame_result_t *const result, const uint64_t gas_left) {
+  fputs("{\"output\":\"0x", tracer->out);
+  if (result->action == FRAME_RETURN || result->action == FRAME_REVERT) {
+    const uint8_t *const data = evm_memory_ptr_unsafe(frame->memory, result->return_offset);
+    for (uint64_t offset = 0; offset < result->return_size; offset += OUTPUT_CHUNK_SIZE) {
+      const uint64_t remaining = result->return_size - offset;
+      const size_t len = remaining < OUTPUT_CHUNK_SIZE ? (size_t)remaining : OUTPUT_CHUNK_SIZE;
+      char chunk[2 + (OUTPUT_CHUNK_SIZE * 2) + 1];
+      hex_encode(data + offset, len, chunk);
+      fputs(chunk + 2, tracer->out);
+    }
+  }
+  char gas_hex[19];
+  hex_encode_u64(tracer->root_gas > gas_left ? tracer->root_gas - gas_left : 0, gas_hex);
+  fprintf(tracer->out, "\",\"gasUsed\":\"%s\"", gas_hex);
+  if (result->action == FRAME_REVERT) {
+    fputs(",\"error\":\"execution reverted\"", tracer->out);
+  } else if (result->action == FRAME_ERROR) {
+    fprintf(tracer->out, ",\"error\":\"%s\"", status_message(result->error));
+  }
+  fputs("}\n", tracer->out);
+}
+
+static void json_call_exit(evm_tracer_t *const base, const call_frame_t *const frame,
+                           const frame_result_t *const result) {
+  const auto tracer = (evm_json_tracer_t *)base;
+  const uint64_t gas_left = evm_tracer_exit_gas(frame, result);
+  flush_pending(tracer, gas_left);
+  if (frame->depth == 0) {
+    write_summary(tracer, frame, result, gas_left);
+  }
+}
+
+static const evm_tracer_vtable_t JSON_TRACER_VTABLE = {
+    .step = json_step,
+    .call_enter = json_call_enter,
+    .call_exit = json_call_exit,
+    .storage_access = nullptr,
+};
+
+bool evm_json_tracer_init(evm_json_tracer_t *const tracer, FILE *const out,
+                          div0_arena_t *const arena) {
+  __builtin___memset_chk(tracer, 0, sizeof(*tracer), __builtin_object_size(tracer, 0));
+  tracer->base.vtable = &JSON_TRACER_VTABLE;
+  tracer->out = out;
+  tracer->line_capacity = LINE_FIXED_SIZE + ((size_t)EVM_STACK_MAX_DEPTH * LINE_STACK_ITEM_SIZE);
+  tracer->line = div0_arena_alloc_array(arena, tracer->line_capacity, sizeof(char), alignof(char));
+  return tracer->line != nullptr;
+}
+
+#endif // DIV0_FREESTANDING
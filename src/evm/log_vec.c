@@ -1,5 +1,7 @@
 #include "div0/evm/log_vec.h"
 
+#include <stdalign.h>
+
 void evm_log_vec_init(evm_log_vec_t *vec, div0_arena_t *arena) {
   vec->data = nullptr;
   vec->size = 0;
@@ -15,7 +17,8 @@ bool evm_log_vec_push(evm_log_vec_t *vec, const evm_log_t *log) {
   if (vec->size >= vec->capacity) {
     // Double capacity (or start with 16)
     const size_t new_cap = vec->capacity == 0 ? 16 : vec->capacity * 2;
-    const auto new_data = (evm_log_t *)div0_arena_alloc(vec->arena, new_cap * sizeof(evm_log_t));
+    const auto new_data = (evm_log_t *)div0_arena_alloc_array(
+        vec->arena, new_cap, sizeof(evm_log_t), alignof(evm_log_t));
     if (new_data == nullptr) {
       return false;
     }
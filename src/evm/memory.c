@@ -2,6 +2,17 @@
 
 #include <string.h>
 
+// Streaming stores are SSE2, which every x86-64 CPU has. Freestanding builds
+// and other targets use memcpy/memset for every size.
+#if !defined(DIV0_FREESTANDING) && defined(__x86_64__)
+#define EVM_MEMORY_STREAM 1
+#include <emmintrin.h>
+#endif
+
+#ifdef EVM_MEMORY_MAPPED
+#include <sys/mman.h>
+#endif
+
 /// Rounds up to the nearest multiple of 32.
 static size_t round_up_32(const size_t n) {
   return (n + 31) & ~((size_t)31);
@@ -12,19 +23,84 @@ void evm_memory_init(evm_memory_t *const mem, div0_arena_t *const arena) {
   mem->size = 0;
   mem->capacity = 0;
   mem->arena = arena;
+  mem->mapping = nullptr;
+}
+
+/// True if data is the mapped range (not an arena buffer it outgrew into).
+static inline bool is_mapped(const evm_memory_t *const mem) {
+  return mem->mapping != nullptr && mem->data == mem->mapping;
+}
+
+/// Zeroes the first used bytes of a mapping. Large ranges are handed back to
+/// the kernel instead, which maps fresh zero pages on the next touch.
+static void recycle(uint8_t *const mapping, const size_t used) {
+#ifdef EVM_MEMORY_MAPPED
+  if (used >= EVM_MEMORY_RECYCLE_THRESHOLD && madvise(mapping, used, MADV_DONTNEED) == 0) {
+    return;
+  }
+#endif
+  __builtin___memset_chk(mapping, 0, used, used);
 }
 
 void evm_memory_reset(evm_memory_t *const mem) {
+  if (mem->mapping != nullptr) {
+    // Restore the all-zero range (memory that moved to the arena did so on the way out)
+    if (mem->data == mem->mapping) {
+      recycle(mem->mapping, mem->size);
+    }
+    mem->data = mem->mapping;
+    mem->size = 0;
+    mem->capacity = EVM_MEMORY_RESERVATION;
+    return;
+  }
+
   // Don't free - arena handles deallocation
   mem->data = nullptr;
   mem->size = 0;
   mem->capacity = 0;
 }
 
+bool evm_memory_map(evm_memory_t *const mem) {
+#ifdef EVM_MEMORY_MAPPED
+  if (mem->mapping != nullptr) {
+    return true;
+  }
+  void *const range = mmap(nullptr, EVM_MEMORY_RESERVATION, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (range == MAP_FAILED) {
+    return false;
+  }
+  mem->mapping = range;
+  mem->data = range;
+  mem->size = 0;
+  mem->capacity = EVM_MEMORY_RESERVATION;
+  return true;
+#else
+  (void)mem;
+  return false;
+#endif
+}
+
+void evm_memory_unmap(evm_memory_t *const mem) {
+#ifdef EVM_MEMORY_MAPPED
+  if (mem->mapping != nullptr) {
+    munmap(mem->mapping, EVM_MEMORY_RESERVATION);
+  }
+#endif
+  mem->mapping = nullptr;
+  mem->data = nullptr;
+  mem->size = 0;
+  mem->capacity = 0;
+}
+
 uint64_t evm_memory_expansion_cost(const size_t current_words, const size_t new_words) {
   if (new_words <= current_words) {
     return 0;
   }
+  // Past 2^32 words a^2 no longer fits; the cost is over 2^55 gas either way
+  if (new_words > UINT32_MAX) {
+    return UINT64_MAX;
+  }
 
   // Memory cost formula from Yellow Paper:
   // G_memory * a + a^2 / 512
@@ -38,15 +114,104 @@ uint64_t evm_memory_expansion_cost(const size_t current_words, const size_t new_
   return new_cost - old_cost;
 }
 
-bool evm_memory_expand(evm_memory_t *const mem, const size_t offset, const size_t size,
-                       uint64_t *const gas_cost) {
+// ============================================================================
+// Copy Kernels
+// ============================================================================
+
+#ifdef EVM_MEMORY_STREAM
+
+static constexpr size_t STREAM_ALIGN = 16;
+
+/// Bytes before dest reaches a 16-byte boundary.
+static inline size_t stream_head(const uint8_t *const dest) {
+  return (STREAM_ALIGN - ((uintptr_t)dest & (STREAM_ALIGN - 1))) & (STREAM_ALIGN - 1);
+}
+
+/// Copy with non-temporal stores: large copies would otherwise evict the
+/// working set to make room for bytes the frame may never read back.
+static void stream_copy(uint8_t *dest, const uint8_t *src, size_t len) {
+  const size_t head = stream_head(dest);
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(dest, src, head);
+  dest += head;
+  src += head;
+  len -= head;
+  for (; len >= 4 * STREAM_ALIGN; len -= 4 * STREAM_ALIGN) {
+    const __m128i a = _mm_loadu_si128((const __m128i *)src);
+    const __m128i b = _mm_loadu_si128((const __m128i *)(src + STREAM_ALIGN));
+    const __m128i c = _mm_loadu_si128((const __m128i *)(src + (2 * STREAM_ALIGN)));
+    const __m128i d = _mm_loadu_si128((const __m128i *)(src + (3 * STREAM_ALIGN)));
+    _mm_stream_si128((__m128i *)dest, a);
+    _mm_stream_si128((__m128i *)(dest + STREAM_ALIGN), b);
+    _mm_stream_si128((__m128i *)(dest + (2 * STREAM_ALIGN)), c);
+    _mm_stream_si128((__m128i *)(dest + (3 * STREAM_ALIGN)), d);
+    dest += 4 * STREAM_ALIGN;
+    src += 4 * STREAM_ALIGN;
+  }
+  _mm_sfence();
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(dest, src, len);
+}
+
+/// Zero fill with non-temporal stores.
+static void stream_zero(uint8_t *dest, size_t len) {
+  const size_t head = stream_head(dest);
+  __builtin___memset_chk(dest, 0, head, head);
+  dest += head;
+  len -= head;
+  const __m128i zero = _mm_setzero_si128();
+  for (; len >= 4 * STREAM_ALIGN; len -= 4 * STREAM_ALIGN) {
+    _mm_stream_si128((__m128i *)dest, zero);
+    _mm_stream_si128((__m128i *)(dest + STREAM_ALIGN), zero);
+    _mm_stream_si128((__m128i *)(dest + (2 * STREAM_ALIGN)), zero);
+    _mm_stream_si128((__m128i *)(dest + (3 * STREAM_ALIGN)), zero);
+    dest += 4 * STREAM_ALIGN;
+  }
+  _mm_sfence();
+  __builtin___memset_chk(dest, 0, len, len);
+}
+
+#endif // EVM_MEMORY_STREAM
+
+/// Copy between non-overlapping ranges.
+static void copy_bytes(uint8_t *const dest, const uint8_t *const src, const size_t len) {
+#ifdef EVM_MEMORY_STREAM
+  if (len >= EVM_MEMORY_STREAM_THRESHOLD) {
+    stream_copy(dest, src, len);
+    return;
+  }
+#endif
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(dest, src, len);
+}
+
+static void zero_bytes(uint8_t *const dest, const size_t len) {
+#ifdef EVM_MEMORY_STREAM
+  if (len >= EVM_MEMORY_STREAM_THRESHOLD) {
+    stream_zero(dest, len);
+    return;
+  }
+#endif
+  __builtin___memset_chk(dest, 0, len, len);
+}
+
+// ============================================================================
+// Expansion
+// ============================================================================
+
+/// Grows memory to cover [offset, offset + size), charging gas for it.
+/// Fails before allocating if the cost exceeds gas_limit, so memory never
+/// grows past what the frame can pay for.
+/// With skip_written, new bytes inside that range are left for the caller.
+static bool expand(evm_memory_t *const mem, const size_t offset, const size_t size,
+                   const uint64_t gas_limit, uint64_t *const gas_cost, const bool skip_written) {
   if (size == 0) {
     *gas_cost = 0;
     return true;
   }
 
-  // Check for overflow
-  if (offset > SIZE_MAX - size) {
+  // Check for overflow (including rounding up to a word)
+  if (offset > SIZE_MAX - size || offset + size > SIZE_MAX - 31) {
     return false;
   }
 
@@ -57,6 +222,9 @@ bool evm_memory_expand(evm_memory_t *const mem, const size_t offset, const size_
   const size_t current_words = mem->size / 32;
   const size_t new_words = new_size / 32;
   *gas_cost = evm_memory_expansion_cost(current_words, new_words);
+  if (*gas_cost > gas_limit) {
+    return false;
+  }
 
   // No expansion needed
   if (new_size <= mem->size) {
@@ -70,10 +238,16 @@ bool evm_memory_expand(evm_memory_t *const mem, const size_t offset, const size_
       new_capacity = EVM_MEMORY_INITIAL_CAPACITY;
     }
     while (new_capacity < new_size) {
+      if (new_capacity > SIZE_MAX / 2) {
+        new_capacity = new_size;
+        break;
+      }
       new_capacity *= 2;
     }
 
-    uint8_t *const new_data = div0_arena_alloc(mem->arena, new_capacity);
+    // Memories past the arena block size get a dedicated large block
+    uint8_t *const new_data =
+        div0_arena_alloc_array(mem->arena, new_capacity, 1, DIV0_ARENA_ALIGNMENT);
     if (new_data == nullptr) {
       return false;
     }
@@ -84,18 +258,74 @@ bool evm_memory_expand(evm_memory_t *const mem, const size_t offset, const size_
       memcpy(new_data, mem->data, mem->size);
     }
 
+    // Mapped memory that outgrew its range continues in the arena
+    if (is_mapped(mem)) {
+      recycle(mem->mapping, mem->size);
+    }
+
     mem->data = new_data;
     mem->capacity = new_capacity;
   }
 
-  // Zero-fill new memory
-  __builtin___memset_chk(mem->data + mem->size, 0, new_size - mem->size,
-                         __builtin_object_size(mem->data + mem->size, 0));
+  // Fresh bytes of a mapped range are already zero
+  if (is_mapped(mem)) {
+    mem->size = new_size;
+    return true;
+  }
+
+  // Zero-fill new memory, except bytes the caller is about to write
+  if (skip_written) {
+    const size_t gap_end = offset > mem->size ? offset : mem->size;
+    zero_bytes(mem->data + mem->size, gap_end - mem->size);
+    const size_t tail_start = required > mem->size ? required : mem->size;
+    zero_bytes(mem->data + tail_start, new_size - tail_start);
+  } else {
+    zero_bytes(mem->data + mem->size, new_size - mem->size);
+  }
   mem->size = new_size;
 
   return true;
 }
 
+bool evm_memory_expand(evm_memory_t *const mem, const size_t offset, const size_t size,
+                       const uint64_t gas_limit, uint64_t *const gas_cost) {
+  return expand(mem, offset, size, gas_limit, gas_cost, false);
+}
+
+bool evm_memory_expand_for_write(evm_memory_t *const mem, const size_t offset, const size_t size,
+                                 const uint64_t gas_limit, uint64_t *const gas_cost) {
+  return expand(mem, offset, size, gas_limit, gas_cost, true);
+}
+
+// ============================================================================
+// Bulk Copies
+// ============================================================================
+
+void evm_memory_copy_unsafe(evm_memory_t *const mem, const size_t dest, const size_t src,
+                            const size_t len) {
+  const size_t distance = dest > src ? dest - src : src - dest;
+  if (distance >= len) {
+    copy_bytes(mem->data + dest, mem->data + src, len);
+    return;
+  }
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memmove(mem->data + dest, mem->data + src, len);
+}
+
+void evm_memory_copy_padded_unsafe(evm_memory_t *const mem, const size_t dest,
+                                   const uint8_t *const src, const size_t src_size,
+                                   const uint64_t src_offset, const size_t size) {
+  uint8_t *const out = mem->data + dest;
+  const size_t available = src_offset < src_size ? src_size - (size_t)src_offset : 0;
+  const size_t copied = available < size ? available : size;
+  if (copied > 0) {
+    copy_bytes(out, src + src_offset, copied);
+  }
+  if (copied < size) {
+    zero_bytes(out + copied, size - copied);
+  }
+}
+
 // NOLINTNEXTLINE(CppParameterMayBeConstPtrOrRef) - writes to mem->data through memcpy
 void evm_memory_store32_unsafe(evm_memory_t *const mem, const size_t offset,
                                const uint256_t value) {
@@ -0,0 +1,388 @@
+#include "modexp.h"
+
+#include "div0/types/uint256.h"
+
+typedef unsigned __int128 uint128_t;
+
+static constexpr size_t LIMB_BYTES = 8;
+static constexpr unsigned WINDOW_BITS = 4;
+static constexpr size_t WINDOW_SIZE = 1U << WINDOW_BITS;
+
+// =============================================================================
+// Exponent Scanning
+// =============================================================================
+
+/// Index of the first non-zero exponent byte (exp->len if the exponent is zero).
+static size_t exp_first_byte(const modexp_operand_t *const exp) {
+  for (size_t i = 0; i < exp->avail && i < exp->len; i++) {
+    if (exp->data[i] != 0) {
+      return i;
+    }
+  }
+  return exp->len;
+}
+
+// =============================================================================
+// Small Moduli (<= 32 bytes)
+// =============================================================================
+
+/// Load up to 32 operand bytes [offset, offset + len) as a big-endian value.
+static uint256_t operand_word(const modexp_operand_t *const op, const size_t offset,
+                              const size_t len) {
+  uint8_t buf[UINT256_SIZE_BYTES];
+  for (size_t i = 0; i < len; i++) {
+    buf[i] = modexp_operand_byte(op, offset + i);
+  }
+  return uint256_from_bytes_be(buf, len);
+}
+
+static void modexp_small(const modexp_operand_t *const base, const modexp_operand_t *const exp,
+                         const uint256_t m, uint8_t *const out, const size_t out_len) {
+  // Reduce the base one 32-byte word at a time: b = b * 2^256 + w (mod m)
+  const uint256_t r256 = uint256_mod(uint256_sub(uint256_zero(), m), m);
+  const size_t head = base->len % UINT256_SIZE_BYTES;
+  uint256_t b = uint256_zero();
+  size_t offset = 0;
+  if (head > 0) {
+    b = uint256_mod(operand_word(base, 0, head), m);
+    offset = head;
+  }
+  for (; offset < base->len; offset += UINT256_SIZE_BYTES) {
+    const uint256_t w = uint256_mod(operand_word(base, offset, UINT256_SIZE_BYTES), m);
+    b = uint256_addmod(uint256_mulmod(b, r256, m), w, m);
+  }
+
+  uint256_t table[WINDOW_SIZE];
+  table[0] = uint256_mod(uint256_from_u64(1), m);
+  for (size_t i = 1; i < WINDOW_SIZE; i++) {
+    table[i] = uint256_mulmod(table[i - 1], b, m);
+  }
+
+  uint256_t acc = table[0];
+  for (size_t i = exp_first_byte(exp); i < exp->len; i++) {
+    const uint8_t byte = modexp_operand_byte(exp, i);
+    for (int shift = 4; shift >= 0; shift -= (int)WINDOW_BITS) {
+      for (unsigned k = 0; k < WINDOW_BITS; k++) {
+        acc = uint256_mulmod(acc, acc, m);
+      }
+      const unsigned digit = (byte >> shift) & 0x0F;
+      if (digit != 0) {
+        acc = uint256_mulmod(acc, table[digit], m);
+      }
+    }
+  }
+
+  uint8_t word[UINT256_SIZE_BYTES];
+  uint256_to_bytes_be(acc, word);
+  for (size_t i = 0; i < out_len; i++) {
+    out[out_len - 1 - i] = i < UINT256_SIZE_BYTES ? word[UINT256_SIZE_BYTES - 1 - i] : 0;
+  }
+}
+
+// =============================================================================
+// Large Moduli (limb bignum)
+// =============================================================================
+
+/// Modulus context for limb arithmetic. Numbers are little-endian limb arrays
+/// of n limbs, reduced modulo m.
+typedef struct {
+  size_t n;         // Modulus limbs (top limb non-zero)
+  uint64_t *m;      // Modulus
+  uint64_t *mn;     // Modulus shifted left so its top bit is set (Knuth D)
+  unsigned shift;   // Normalization shift
+  bool mont;        // Odd modulus: Montgomery multiplication
+  uint64_t minv;    // -m^-1 mod 2^64 (Montgomery)
+  uint64_t *prod;   // Scratch: 2n + 2 limbs
+  uint64_t *rem;    // Scratch: 2n + 1 limbs
+} big_ctx_t;
+
+/// Load operand bytes as little-endian limbs (count limbs, high limbs zero).
+static void operand_limbs(uint64_t *const out, const size_t count,
+                          const modexp_operand_t *const op, const size_t offset,
+                          const size_t len) {
+  for (size_t i = 0; i < count; i++) {
+    out[i] = 0;
+  }
+  for (size_t i = 0; i < len; i++) {
+    const size_t bit = (len - 1 - i) * 8;
+    out[bit / 64] |= (uint64_t)modexp_operand_byte(op, offset + i) << (bit % 64);
+  }
+}
+
+/// r = u mod m (Knuth algorithm D). r has n limbs; un needs ulen + 1 limbs.
+static void big_rem(const big_ctx_t *const c, uint64_t *const r, const uint64_t *const u,
+                    const size_t ulen, uint64_t *const un) {
+  const size_t n = c->n;
+  if (ulen < n) {
+    for (size_t i = 0; i < n; i++) {
+      r[i] = i < ulen ? u[i] : 0;
+    }
+    return;
+  }
+
+  const unsigned s = c->shift;
+  un[ulen] = s != 0 ? u[ulen - 1] >> (64 - s) : 0;
+  for (size_t i = ulen - 1; i > 0; i--) {
+    un[i] = s != 0 ? (u[i] << s) | (u[i - 1] >> (64 - s)) : u[i];
+  }
+  un[0] = u[0] << s;
+
+  const uint64_t *const vn = c->mn;
+  const uint64_t vtop = vn[n - 1];
+  const uint64_t vsec = n > 1 ? vn[n - 2] : 0;
+  for (size_t j = ulen - n + 1; j-- > 0;) {
+    const uint128_t num = ((uint128_t)un[j + n] << 64) | un[j + n - 1];
+    uint128_t qhat = num / vtop;
+    uint128_t rhat = num % vtop;
+    while ((qhat >> 64) != 0 ||
+           (n > 1 && qhat * vsec > ((rhat << 64) | un[j + n - 2]))) {
+      qhat--;
+      rhat += vtop;
+      if ((rhat >> 64) != 0) {
+        break;
+      }
+    }
+
+    // un[j .. j + n] -= qhat * vn
+    uint64_t carry = 0;
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < n; i++) {
+      const uint128_t p = (qhat * vn[i]) + carry;
+      carry = (uint64_t)(p >> 64);
+      const uint128_t t = (uint128_t)un[i + j] - (uint64_t)p - borrow;
+      un[i + j] = (uint64_t)t;
+      borrow = (t >> 64) != 0 ? 1 : 0;
+    }
+    const uint128_t t = (uint128_t)un[j + n] - carry - borrow;
+    un[j + n] = (uint64_t)t;
+
+    // qhat was one too large: add the divisor back
+    if ((t >> 64) != 0) {
+      uint64_t add_carry = 0;
+      for (size_t i = 0; i < n; i++) {
+        const uint128_t sum = (uint128_t)un[i + j] + vn[i] + add_carry;
+        un[i + j] = (uint64_t)sum;
+        add_carry = (uint64_t)(sum >> 64);
+      }
+      un[j + n] += add_carry;
+    }
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    r[i] = s != 0 ? (un[i] >> s) | (un[i + 1] << (64 - s)) : un[i];
+  }
+}
+
+/// Montgomery multiplication (CIOS): r = a * b / 2^(64n) mod m.
+static void big_mont_mul(const big_ctx_t *const c, uint64_t *const r, const uint64_t *const a,
+                         const uint64_t *const b) {
+  const size_t n = c->n;
+  const uint64_t *const m = c->m;
+  uint64_t *const t = c->prod;
+  for (size_t i = 0; i < n + 2; i++) {
+    t[i] = 0;
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    uint64_t carry = 0;
+    for (size_t j = 0; j < n; j++) {
+      const uint128_t s = ((uint128_t)a[j] * b[i]) + t[j] + carry;
+      t[j] = (uint64_t)s;
+      carry = (uint64_t)(s >> 64);
+    }
+    uint128_t s = (uint128_t)t[n] + carry;
+    t[n] = (uint64_t)s;
+    t[n + 1] = (uint64_t)(s >> 64);
+
+    const uint64_t q = t[0] * c->minv;
+    s = ((uint128_t)q * m[0]) + t[0];
+    carry = (uint64_t)(s >> 64);
+    for (size_t j = 1; j < n; j++) {
+      s = ((uint128_t)q * m[j]) + t[j] + carry;
+      t[j - 1] = (uint64_t)s;
+      carry = (uint64_t)(s >> 64);
+    }
+    s = (uint128_t)t[n] + carry;
+    t[n - 1] = (uint64_t)s;
+    t[n] = t[n + 1] + (uint64_t)(s >> 64);
+  }
+
+  // t < 2m: subtract m once if t >= m
+  bool ge = t[n] != 0;
+  if (!ge) {
+    ge = true;
+    for (size_t i = n; i-- > 0;) {
+      if (t[i] != m[i]) {
+        ge = t[i] > m[i];
+        break;
+      }
+    }
+  }
+  uint64_t borrow = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (ge) {
+      const uint128_t d = (uint128_t)t[i] - m[i] - borrow;
+      r[i] = (uint64_t)d;
+      borrow = (d >> 64) != 0 ? 1 : 0;
+    } else {
+      r[i] = t[i];
+    }
+  }
+}
+
+/// r = a * b mod m in the context's representation.
+static void big_mulmod(const big_ctx_t *const c, uint64_t *const r, const uint64_t *const a,
+                       const uint64_t *const b) {
+  if (c->mont) {
+    big_mont_mul(c, r, a, b);
+    return;
+  }
+  const size_t n = c->n;
+  uint64_t *const p = c->prod;
+  for (size_t i = 0; i < 2 * n; i++) {
+    p[i] = 0;
+  }
+  for (size_t i = 0; i < n; i++) {
+    uint64_t carry = 0;
+    for (size_t j = 0; j < n; j++) {
+      const uint128_t s = ((uint128_t)a[j] * b[i]) + p[i + j] + carry;
+      p[i + j] = (uint64_t)s;
+      carry = (uint64_t)(s >> 64);
+    }
+    p[i + n] = carry;
+  }
+  big_rem(c, r, p, 2 * n, c->rem);
+}
+
+static bool modexp_big(const modexp_operand_t *const base, const modexp_operand_t *const exp,
+                       const modexp_operand_t *const mod, const size_t mod_start,
+                       uint8_t *const out, div0_arena_t *const arena) {
+  const size_t mod_len = mod->len - mod_start;
+  const size_t n = (mod_len + LIMB_BYTES - 1) / LIMB_BYTES;
+  const size_t base_limbs = (base->len + LIMB_BYTES - 1) / LIMB_BYTES;
+  const size_t un_limbs = (base_limbs > 2 * n ? base_limbs : 2 * n) + 1;
+
+  // m, mn, prod, rem, table, acc, b and the base/un buffers
+  const size_t total = (n * (3 + WINDOW_SIZE)) + (2 * n) + 2 + (2 * n) + 1 + base_limbs + un_limbs;
+  uint64_t *const buf = div0_arena_alloc_array(arena, total, sizeof(uint64_t), alignof(uint64_t));
+  if (buf == nullptr) {
+    return false;
+  }
+  big_ctx_t c = {.n = n};
+  c.m = buf;
+  c.mn = c.m + n;
+  c.prod = c.mn + n;
+  c.rem = c.prod + (2 * n) + 2;
+  uint64_t *const table = c.rem + (2 * n) + 1;
+  uint64_t *const acc = table + (n * WINDOW_SIZE);
+  uint64_t *const base_buf = acc + n;
+  uint64_t *const un = base_buf + base_limbs;
+
+  operand_limbs(c.m, n, mod, mod_start, mod_len);
+  c.shift = (unsigned)__builtin_clzll(c.m[n - 1]);
+  for (size_t i = n; i-- > 0;) {
+    c.mn[i] = c.shift != 0 && i > 0 ? (c.m[i] << c.shift) | (c.m[i - 1] >> (64 - c.shift))
+                                    : c.m[i] << c.shift;
+  }
+  c.mont = (c.m[0] & 1) != 0;
+
+  // b = base mod m
+  uint64_t *const b = table + n;
+  if (base_limbs > 0) {
+    operand_limbs(base_buf, base_limbs, base, 0, base->len);
+  }
+  big_rem(&c, b, base_buf, base_limbs, un);
+
+  // table[0] = 1 and b in the working representation
+  for (size_t i = 0; i < n; i++) {
+    table[i] = 0;
+  }
+  if (c.mont) {
+    // -m^-1 mod 2^64 by Newton iteration
+    uint64_t inv = 1;
+    for (int i = 0; i < 6; i++) {
+      inv *= 2 - (c.m[0] * inv);
+    }
+    c.minv = (uint64_t)0 - inv;
+
+    // R mod m and b * R mod m, with R = 2^(64n)
+    for (size_t i = 0; i < 2 * n; i++) {
+      un[i] = 0;
+    }
+    un[n] = 1;
+    big_rem(&c, table, un, n + 1, c.rem);
+    for (size_t i = 0; i < n; i++) {
+      un[i] = 0;
+      un[n + i] = b[i];
+    }
+    big_rem(&c, b, un, 2 * n, c.rem);
+  } else {
+    table[0] = 1;
+    big_rem(&c, table, table, n, un);
+  }
+  for (size_t i = 2; i < WINDOW_SIZE; i++) {
+    big_mulmod(&c, table + (i * n), table + ((i - 1) * n), b);
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    acc[i] = table[i];
+  }
+  for (size_t i = exp_first_byte(exp); i < exp->len; i++) {
+    const uint8_t byte = modexp_operand_byte(exp, i);
+    for (int shift = 4; shift >= 0; shift -= (int)WINDOW_BITS) {
+      for (unsigned k = 0; k < WINDOW_BITS; k++) {
+        big_mulmod(&c, acc, acc, acc);
+      }
+      const unsigned digit = (byte >> shift) & 0x0F;
+      if (digit != 0) {
+        big_mulmod(&c, acc, acc, table + (digit * n));
+      }
+    }
+  }
+
+  if (c.mont) {
+    // Leave Montgomery form: acc * 1 / R
+    uint64_t *const one = un;
+    for (size_t i = 0; i < n; i++) {
+      one[i] = 0;
+    }
+    one[0] = 1;
+    big_mont_mul(&c, acc, acc, one);
+  }
+
+  for (size_t i = 0; i < mod->len; i++) {
+    const size_t bit = i * 8;
+    out[mod->len - 1 - i] = bit / 64 < n ? (uint8_t)(acc[bit / 64] >> (bit % 64)) : 0;
+  }
+  return true;
+}
+
+// =============================================================================
+// Entry Point
+// =============================================================================
+
+bool modexp(const modexp_operand_t *const base, const modexp_operand_t *const exp,
+            const modexp_operand_t *const mod, uint8_t *const out, div0_arena_t *const arena) {
+  // Skip leading zero bytes of the modulus
+  size_t mod_start = 0;
+  while (mod_start < mod->len && modexp_operand_byte(mod, mod_start) == 0) {
+    mod_start++;
+  }
+  if (mod_start == mod->len) {
+    for (size_t i = 0; i < mod->len; i++) {
+      out[i] = 0;
+    }
+    return true;
+  }
+
+  const size_t mod_len = mod->len - mod_start;
+  if (mod_len <= UINT256_SIZE_BYTES) {
+    modexp_small(base, exp, operand_word(mod, mod_start, mod_len), out, mod->len);
+    return true;
+  }
+
+  const div0_arena_mark_t mark = div0_arena_mark(arena);
+  const bool ok = modexp_big(base, exp, mod, mod_start, out, arena);
+  div0_arena_rewind(arena, mark);
+  return ok;
+}
@@ -0,0 +1,43 @@
+#ifndef DIV0_EVM_MODEXP_H
+#define DIV0_EVM_MODEXP_H
+
+#include "div0/mem/arena.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// =============================================================================
+// Modular Exponentiation (MODEXP precompile, 0x05)
+// =============================================================================
+
+/// Big-endian operand of len bytes whose first avail bytes are in memory.
+/// The remaining bytes are zeros (the precompile input is right-padded), so
+/// long operands past the end of the call data are never materialized.
+typedef struct {
+  const uint8_t *data;
+  size_t avail;
+  size_t len;
+} modexp_operand_t;
+
+/// Byte i of an operand (zero past the available data).
+static inline uint8_t modexp_operand_byte(const modexp_operand_t *op, const size_t i) {
+  return i < op->avail ? op->data[i] : 0;
+}
+
+/// Compute base^exp mod mod.
+///
+/// Moduli up to 32 bytes use uint256 mulmod; larger ones use a limb bignum
+/// with Montgomery multiplication (odd moduli) or Knuth division (even
+/// moduli). Both paths use a fixed 4-bit exponent window. Scratch memory is
+/// taken from the arena and released before returning.
+/// @param base Base operand
+/// @param exp Exponent operand
+/// @param mod Modulus operand
+/// @param out Output buffer of mod->len bytes (big-endian, zero when mod is 0)
+/// @param arena Scratch allocator
+/// @return false on allocation failure
+bool modexp(const modexp_operand_t *base, const modexp_operand_t *exp,
+            const modexp_operand_t *mod, uint8_t *out, div0_arena_t *arena);
+
+#endif // DIV0_EVM_MODEXP_H
@@ -0,0 +1,159 @@
+#include "div0/evm/opcodes.h"
+
+/// Mnemonics indexed by opcode (nullptr for undefined opcodes).
+static const char *const OPCODE_NAMES[256] = {
+    [OP_STOP] = "STOP",
+    [OP_ADD] = "ADD",
+    [OP_MUL] = "MUL",
+    [OP_SUB] = "SUB",
+    [OP_DIV] = "DIV",
+    [OP_SDIV] = "SDIV",
+    [OP_MOD] = "MOD",
+    [OP_SMOD] = "SMOD",
+    [OP_ADDMOD] = "ADDMOD",
+    [OP_MULMOD] = "MULMOD",
+    [OP_EXP] = "EXP",
+    [OP_SIGNEXTEND] = "SIGNEXTEND",
+    [OP_LT] = "LT",
+    [OP_GT] = "GT",
+    [OP_SLT] = "SLT",
+    [OP_SGT] = "SGT",
+    [OP_EQ] = "EQ",
+    [OP_ISZERO] = "ISZERO",
+    [OP_AND] = "AND",
+    [OP_OR] = "OR",
+    [OP_XOR] = "XOR",
+    [OP_NOT] = "NOT",
+    [OP_BYTE] = "BYTE",
+    [OP_SHL] = "SHL",
+    [OP_SHR] = "SHR",
+    [OP_SAR] = "SAR",
+    [OP_KECCAK256] = "KECCAK256",
+    [OP_ADDRESS] = "ADDRESS",
+    [OP_BALANCE] = "BALANCE",
+    [OP_ORIGIN] = "ORIGIN",
+    [OP_CALLER] = "CALLER",
+    [OP_CALLVALUE] = "CALLVALUE",
+    [OP_CALLDATALOAD] = "CALLDATALOAD",
+    [OP_CALLDATASIZE] = "CALLDATASIZE",
+    [OP_CALLDATACOPY] = "CALLDATACOPY",
+    [OP_CODESIZE] = "CODESIZE",
+    [OP_CODECOPY] = "CODECOPY",
+    [OP_GASPRICE] = "GASPRICE",
+    [OP_EXTCODESIZE] = "EXTCODESIZE",
+    [OP_EXTCODECOPY] = "EXTCODECOPY",
+    [OP_RETURNDATASIZE] = "RETURNDATASIZE",
+    [OP_RETURNDATACOPY] = "RETURNDATACOPY",
+    [OP_EXTCODEHASH] = "EXTCODEHASH",
+    [OP_BLOCKHASH] = "BLOCKHASH",
+    [OP_COINBASE] = "COINBASE",
+    [OP_TIMESTAMP] = "TIMESTAMP",
+    [OP_NUMBER] = "NUMBER",
+    [OP_PREVRANDAO] = "PREVRANDAO",
+    [OP_GASLIMIT] = "GASLIMIT",
+    [OP_CHAINID] = "CHAINID",
+    [OP_SELFBALANCE] = "SELFBALANCE",
+    [OP_BASEFEE] = "BASEFEE",
+    [OP_BLOBHASH] = "BLOBHASH",
+    [OP_BLOBBASEFEE] = "BLOBBASEFEE",
+    [OP_POP] = "POP",
+    [OP_MLOAD] = "MLOAD",
+    [OP_MSTORE] = "MSTORE",
+    [OP_MSTORE8] = "MSTORE8",
+    [OP_SLOAD] = "SLOAD",
+    [OP_SSTORE] = "SSTORE",
+    [OP_JUMP] = "JUMP",
+    [OP_JUMPI] = "JUMPI",
+    [OP_PC] = "PC",
+    [OP_MSIZE] = "MSIZE",
+    [OP_GAS] = "GAS",
+    [OP_JUMPDEST] = "JUMPDEST",
+    [OP_TLOAD] = "TLOAD",
+    [OP_TSTORE] = "TSTORE",
+    [OP_MCOPY] = "MCOPY",
+    [OP_PUSH0] = "PUSH0",
+    [OP_PUSH1] = "PUSH1",
+    [OP_PUSH2] = "PUSH2",
+    [OP_PUSH3] = "PUSH3",
+    [OP_PUSH4] = "PUSH4",
+    [OP_PUSH5] = "PUSH5",
+    [OP_PUSH6] = "PUSH6",
+    [OP_PUSH7] = "PUSH7",
+    [OP_PUSH8] = "PUSH8",
+    [OP_PUSH9] = "PUSH9",
+    [OP_PUSH10] = "PUSH10",
+    [OP_PUSH11] = "PUSH11",
+    [OP_PUSH12] = "PUSH12",
+    [OP_PUSH13] = "PUSH13",
+    [OP_PUSH14] = "PUSH14",
+    [OP_PUSH15] = "PUSH15",
+    [OP_PUSH16] = "PUSH16",
+    [OP_PUSH17] = "PUSH17",
+    [OP_PUSH18] = "PUSH18",
+    [OP_PUSH19] = "PUSH19",
+    [OP_PUSH20] = "PUSH20",
+    [OP_PUSH21] = "PUSH21",
+    [OP_PUSH22] = "PUSH22",
+    [OP_PUSH23] = "PUSH23",
+    [OP_PUSH24] = "PUSH24",
+    [OP_PUSH25] = "PUSH25",
+    [OP_PUSH26] = "PUSH26",
+    [OP_PUSH27] = "PUSH27",
+    [OP_PUSH28] = "PUSH28",
+    [OP_PUSH29] = "PUSH29",
+    [OP_PUSH30] = "PUSH30",
+    [OP_PUSH31] = "PUSH31",
+    [OP_PUSH32] = "PUSH32",
+    [OP_DUP1] = "DUP1",
+    [OP_DUP2] = "DUP2",
+    [OP_DUP3] = "DUP3",
+    [OP_DUP4] = "DUP4",
+    [OP_DUP5] = "DUP5",
+    [OP_DUP6] = "DUP6",
+    [OP_DUP7] = "DUP7",
+    [OP_DUP8] = "DUP8",
+    [OP_DUP9] = "DUP9",
+    [OP_DUP10] = "DUP10",
+    [OP_DUP11] = "DUP11",
+    [OP_DUP12] = "DUP12",
+    [OP_DUP13] = "DUP13",
+    [OP_DUP14] = "DUP14",
+    [OP_DUP15] = "DUP15",
+    [OP_DUP16] = "DUP16",
+    [OP_SWAP1] = "SWAP1",
+    [OP_SWAP2] = "SWAP2",
+    [OP_SWAP3] = "SWAP3",
+    [OP_SWAP4] = "SWAP4",
+    [OP_SWAP5] = "SWAP5",
+    [OP_SWAP6] = "SWAP6",
+    [OP_SWAP7] = "SWAP7",
+    [OP_SWAP8] = "SWAP8",
+    [OP_SWAP9] = "SWAP9",
+    [OP_SWAP10] = "SWAP10",
+    [OP_SWAP11] = "SWAP11",
+    [OP_SWAP12] = "SWAP12",
+    [OP_SWAP13] = "SWAP13",
+    [OP_SWAP14] = "SWAP14",
+    [OP_SWAP15] = "SWAP15",
+    [OP_SWAP16] = "SWAP16",
+    [OP_LOG0] = "LOG0",
+    [OP_LOG1] = "LOG1",
+    [OP_LOG2] = "LOG2",
+    [OP_LOG3] = "LOG3",
+    [OP_LOG4] = "LOG4",
+    [OP_CREATE] = "CREATE",
+    [OP_CALL] = "CALL",
+    [OP_CALLCODE] = "CALLCODE",
+    [OP_RETURN] = "RETURN",
+    [OP_DELEGATECALL] = "DELEGATECALL",
+    [OP_CREATE2] = "CREATE2",
+    [OP_STATICCALL] = "STATICCALL",
+    [OP_REVERT] = "REVERT",
+    [OP_INVALID] = "INVALID",
+    [OP_SELFDESTRUCT] = "SELFDESTRUCT",
+};
+
+const char *evm_opcode_name(const uint8_t opcode) {
+  const char *const name = OPCODE_NAMES[opcode];
+  return name != nullptr ? name : "UNKNOWN";
+}
@@ -1,10 +1,14 @@
 #include "div0/evm/opcodes/call.h"
 
+#include "div0/crypto/keccak256.h"
 #include "div0/evm/call_frame_pool.h"
 #include "div0/evm/call_op.h"
 #include "div0/evm/evm.h"
+#include "div0/evm/gas.h"
+#include "div0/evm/initcode_cache.h"
 #include "div0/evm/memory.h"
 #include "div0/evm/memory_pool.h"
+#include "div0/evm/precompiles.h"
 #include "div0/evm/stack.h"
 #include "div0/evm/stack_pool.h"
 #include "div0/state/state_access.h"
@@ -22,17 +26,20 @@ typedef struct {
   address_t caller;
   address_t address;
   uint256_t value;
+  hash_t code_hash; // Keccak256 of the code, zero if unknown (no jumpdest caching)
 } child_frame_params_t;
 
 /// Allocates and initializes a child frame with common settings.
 /// @param evm EVM instance
 /// @param parent Parent frame
 /// @param setup Call setup from prepare_* function
-/// @param code Target contract code
+/// @param code Code to run (target contract code, or init code)
+/// @param code_size Code size
 /// @param params Opcode-specific parameters
 /// @return Initialized child frame, or nullptr if pool exhausted
 static call_frame_t *init_child_frame(evm_t *const evm, call_frame_t *const parent,
-                                      const call_setup_t *const setup, const bytes_t *const code,
+                                      const call_setup_t *const setup, const uint8_t *const code,
+                                      const size_t code_size,
                                       const child_frame_params_t *const params) {
   call_frame_t *const child = call_frame_pool_rent(&evm->frame_pool);
   if (child == nullptr) {
@@ -44,8 +51,8 @@ static call_frame_t *init_child_frame(evm_t *const evm, call_frame_t *const pare
   child->gas = setup->child_gas;
   child->stack = evm_stack_pool_borrow(&evm->stack_pool);
   child->memory = evm_memory_pool_borrow(&evm->memory_pool);
-  child->code = code->data;
-  child->code_size = code->size;
+  child->code = code;
+  child->code_size = code_size;
   child->output_offset = setup->ret_offset;
   child->output_size = (uint32_t)setup->ret_size;
   child->depth = (uint16_t)(parent->depth + 1);
@@ -62,7 +69,10 @@ static call_frame_t *init_child_frame(evm_t *const evm, call_frame_t *const pare
 
   // Jump destination analysis (lazy: computed on first JUMP/JUMPI)
   child->jumpdest_bitmap = nullptr;
-  child->code_hash = hash_zero(); // TODO: set from state if code hash is known
+  child->code_hash = params->code_hash;
+
+  // Transient writes made from here on are undone if the child fails
+  child->transient_checkpoint = transient_storage_checkpoint(&evm->transient_storage);
 
   // Store parent's output location
   parent->output_offset = setup->ret_offset;
@@ -71,6 +81,56 @@ static call_frame_t *init_child_frame(evm_t *const evm, call_frame_t *const pare
   return child;
 }
 
+/// Loads the code a call runs together with its hash, so that the jumpdest
+/// analysis can be shared through the state's cache. The target is already
+/// warm, so this is a single account lookup.
+static state_account_view_t load_call_code(state_access_t *const state,
+                                           const address_t *const target) {
+  state_account_view_t account;
+  (void)state_account_access(state, target, STATE_ACCOUNT_INFO | STATE_ACCOUNT_CODE, &account);
+  return account;
+}
+
+// =============================================================================
+// Precompiled Contracts
+// =============================================================================
+
+/// Runs a precompiled contract in place of a child frame.
+/// Success returns unused gas, sets the return data and pushes 1; failure
+/// consumes the call gas, clears the return data and pushes 0.
+/// @param evm EVM instance
+/// @param frame Calling frame
+/// @param setup Call setup from prepare_* function
+/// @param precompile Implementation from precompile_get
+/// @return true if the precompile succeeded
+static bool run_precompile(evm_t *const evm, call_frame_t *const frame,
+                           const call_setup_t *const setup, const precompile_fn_t precompile) {
+  const precompile_input_t in = {
+      .input =
+          setup->args_size > 0 ? evm_memory_ptr_unsafe(frame->memory, setup->args_offset) : nullptr,
+      .input_size = (size_t)setup->args_size,
+      .gas = setup->child_gas,
+      .arena = evm->arena,
+      .secp_ctx = evm->secp_ctx,
+  };
+  precompile_output_t out;
+  if (!precompile(&in, &out)) {
+    evm_set_return_data(evm, nullptr, 0);
+    evm_stack_push_unsafe(frame->stack, uint256_zero());
+    return false;
+  }
+
+  evm_set_return_data(evm, out.output, out.output_size);
+  const size_t copy_size =
+      setup->ret_size < evm->return_data_size ? (size_t)setup->ret_size : evm->return_data_size;
+  if (copy_size > 0) {
+    evm_memory_store_unsafe(frame->memory, setup->ret_offset, evm->return_data, copy_size);
+  }
+  frame->gas += setup->child_gas - out.gas_used;
+  evm_stack_push_unsafe(frame->stack, uint256_from_u64(1));
+  return true;
+}
+
 // =============================================================================
 // CALL Opcode Implementations
 // =============================================================================
@@ -104,16 +164,28 @@ call_op_result_t op_call(evm_t *const evm, call_frame_t *const frame) {
     (void)state_add_balance(state, &setup.target, setup.value);
   }
 
-  const bytes_t code = state_get_code(state, &setup.target);
+  const precompile_fn_t precompile = precompile_get(evm->fork, &setup.target);
+  if (precompile != nullptr) {
+    if (!run_precompile(evm, frame, &setup, precompile) && !uint256_is_zero(setup.value)) {
+      // Failed call: undo the value transfer
+      (void)state_sub_balance(state, &setup.target, setup.value);
+      (void)state_add_balance(state, &frame->address, setup.value);
+    }
+    return call_op_continue();
+  }
+
+  const state_account_view_t target = load_call_code(state, &setup.target);
   const child_frame_params_t params = {
       .exec_type = EXEC_CALL,
       .is_static = frame->is_static,
       .caller = frame->address,
       .address = setup.target,
       .value = setup.value,
+      .code_hash = target.code_hash,
   };
 
-  call_frame_t *const child = init_child_frame(evm, frame, &setup, &code, &params);
+  call_frame_t *const child =
+      init_child_frame(evm, frame, &setup, target.code.data, target.code.size, &params);
   if (child == nullptr) {
     evm_stack_push_unsafe(frame->stack, uint256_zero());
     return call_op_continue();
@@ -140,16 +212,24 @@ call_op_result_t op_staticcall(evm_t *const evm, call_frame_t *const frame) {
     return call_op_error(setup.status);
   }
 
-  const bytes_t code = state_get_code(state, &setup.target);
+  const precompile_fn_t precompile = precompile_get(evm->fork, &setup.target);
+  if (precompile != nullptr) {
+    (void)run_precompile(evm, frame, &setup, precompile);
+    return call_op_continue();
+  }
+
+  const state_account_view_t target = load_call_code(state, &setup.target);
   const child_frame_params_t params = {
       .exec_type = EXEC_STATICCALL,
       .is_static = true, // STATICCALL always sets static context
       .caller = frame->address,
       .address = setup.target,
       .value = uint256_zero(),
+      .code_hash = target.code_hash,
   };
 
-  call_frame_t *const child = init_child_frame(evm, frame, &setup, &code, &params);
+  call_frame_t *const child =
+      init_child_frame(evm, frame, &setup, target.code.data, target.code.size, &params);
   if (child == nullptr) {
     evm_stack_push_unsafe(frame->stack, uint256_zero());
     return call_op_continue();
@@ -176,17 +256,25 @@ call_op_result_t op_delegatecall(evm_t *const evm, call_frame_t *const frame) {
     return call_op_error(setup.status);
   }
 
+  const precompile_fn_t precompile = precompile_get(evm->fork, &setup.target);
+  if (precompile != nullptr) {
+    (void)run_precompile(evm, frame, &setup, precompile);
+    return call_op_continue();
+  }
+
   // DELEGATECALL: get code from target, but run in current context
-  const bytes_t code = state_get_code(state, &setup.target);
+  const state_account_view_t target = load_call_code(state, &setup.target);
   const child_frame_params_t params = {
       .exec_type = EXEC_DELEGATECALL,
       .is_static = frame->is_static, // Inherit static context
       .caller = frame->caller,       // Keep original caller
       .address = frame->address,     // Keep current address (storage context)
       .value = frame->value,         // Inherit value
+      .code_hash = target.code_hash,
   };
 
-  call_frame_t *const child = init_child_frame(evm, frame, &setup, &code, &params);
+  call_frame_t *const child =
+      init_child_frame(evm, frame, &setup, target.code.data, target.code.size, &params);
   if (child == nullptr) {
     evm_stack_push_unsafe(frame->stack, uint256_zero());
     return call_op_continue();
@@ -223,17 +311,25 @@ call_op_result_t op_callcode(evm_t *const evm, call_frame_t *const frame) {
     // Note: CALLCODE doesn't actually transfer value, it's just for gas calculation
   }
 
+  const precompile_fn_t precompile = precompile_get(evm->fork, &setup.target);
+  if (precompile != nullptr) {
+    (void)run_precompile(evm, frame, &setup, precompile);
+    return call_op_continue();
+  }
+
   // CALLCODE: get code from target, but run at current address
-  const bytes_t code = state_get_code(state, &setup.target);
+  const state_account_view_t target = load_call_code(state, &setup.target);
   const child_frame_params_t params = {
       .exec_type = EXEC_CALLCODE,
       .is_static = frame->is_static,
       .caller = frame->address,  // Caller is current address
       .address = frame->address, // Execute at current address
       .value = setup.value,
+      .code_hash = target.code_hash,
   };
 
-  call_frame_t *const child = init_child_frame(evm, frame, &setup, &code, &params);
+  call_frame_t *const child =
+      init_child_frame(evm, frame, &setup, target.code.data, target.code.size, &params);
   if (child == nullptr) {
     evm_stack_push_unsafe(frame->stack, uint256_zero());
     return call_op_continue();
@@ -242,3 +338,201 @@ call_op_result_t op_callcode(evm_t *const evm, call_frame_t *const frame) {
   evm->pending_frame = child;
   return call_op_call();
 }
+
+// =============================================================================
+// CREATE Opcode Implementations
+// =============================================================================
+
+// RLP prefixes for the CREATE address preimage
+static constexpr uint8_t RLP_STRING_PREFIX = 0x80;
+static constexpr uint8_t RLP_LIST_PREFIX = 0xc0;
+
+// CREATE2 preimage prefix (EIP-1014)
+static constexpr uint8_t CREATE2_PREFIX = 0xff;
+
+/// CREATE address: keccak256(rlp([sender, nonce]))[12:].
+/// Same derivation as compute_create_address in the executor, encoded on the
+/// stack: the list payload is at most 30 bytes, so its header is one byte.
+static address_t create_address(const address_t *const sender, const uint64_t nonce) {
+  uint8_t buf[2 + ADDRESS_SIZE + 1 + sizeof(uint64_t)];
+  size_t pos = 1;
+  buf[pos++] = RLP_STRING_PREFIX + ADDRESS_SIZE;
+  __builtin___memcpy_chk(buf + pos, sender->bytes, ADDRESS_SIZE, sizeof(buf) - pos);
+  pos += ADDRESS_SIZE;
+  if (nonce == 0) {
+    buf[pos++] = RLP_STRING_PREFIX;
+  } else if (nonce < RLP_STRING_PREFIX) {
+    buf[pos++] = (uint8_t)nonce;
+  } else {
+    const size_t len = sizeof(uint64_t) - ((size_t)__builtin_clzll(nonce) / 8);
+    buf[pos++] = (uint8_t)(RLP_STRING_PREFIX + len);
+    for (size_t i = len; i > 0; i--) {
+      buf[pos++] = (uint8_t)(nonce >> (8 * (i - 1)));
+    }
+  }
+  buf[0] = (uint8_t)(RLP_LIST_PREFIX + (pos - 1));
+
+  const hash_t hash = keccak256(buf, pos);
+  return address_from_bytes(hash.bytes + (HASH_SIZE - ADDRESS_SIZE));
+}
+
+/// CREATE2 address: keccak256(0xff ++ sender ++ salt ++ keccak256(init_code))[12:].
+static address_t create2_address(const address_t *const sender, const uint256_t salt,
+                                 const hash_t *const init_code_hash) {
+  uint8_t preimage[1 + ADDRESS_SIZE + 32 + HASH_SIZE];
+  preimage[0] = CREATE2_PREFIX;
+  __builtin___memcpy_chk(preimage + 1, sender->bytes, ADDRESS_SIZE, sizeof(preimage) - 1);
+  uint256_to_bytes_be(salt, preimage + 1 + ADDRESS_SIZE);
+  __builtin___memcpy_chk(preimage + 1 + ADDRESS_SIZE + 32, init_code_hash->bytes, HASH_SIZE,
+                         HASH_SIZE);
+
+  const hash_t hash = keccak256(preimage, sizeof(preimage));
+  return address_from_bytes(hash.bytes + (HASH_SIZE - ADDRESS_SIZE));
+}
+
+/// Shared CREATE/CREATE2 implementation.
+/// Charges the creation cost, derives the address and starts an init code frame.
+/// With an init code cache attached, the frame runs the cached copy of the
+/// code with its jumpdest bitmap already set, and CREATE2 reuses its hash.
+/// @param evm EVM instance
+/// @param frame Current call frame
+/// @param is_create2 true for CREATE2 (salted address, hashing cost)
+/// @return Call operation result
+static call_op_result_t create(evm_t *const evm, call_frame_t *const frame, const bool is_create2) {
+  state_access_t *const state = evm->state;
+  if (state == nullptr) {
+    return call_op_error(EVM_INVALID_OPCODE);
+  }
+  if (!evm_stack_has_items(frame->stack, is_create2 ? 4 : 3)) {
+    return call_op_error(EVM_STACK_UNDERFLOW);
+  }
+  if (frame->is_static) {
+    return call_op_error(EVM_WRITE_PROTECTION);
+  }
+
+  const uint256_t value = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t offset_u256 = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t size_u256 = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t salt = is_create2 ? evm_stack_pop_unsafe(frame->stack) : uint256_zero();
+
+  // Init code region (EIP-3860 caps its size)
+  uint64_t offset = 0;
+  uint64_t size = 0;
+  if (!uint256_is_zero(size_u256)) {
+    if (!uint256_fits_u64(offset_u256) || !uint256_fits_u64(size_u256)) {
+      return call_op_error(EVM_OUT_OF_GAS);
+    }
+    offset = uint256_to_u64_unsafe(offset_u256);
+    size = uint256_to_u64_unsafe(size_u256);
+    if (size > MAX_INITCODE_SIZE || offset > UINT64_MAX - size) {
+      return call_op_error(EVM_OUT_OF_GAS);
+    }
+  }
+
+  // Base cost, per-word init code (and CREATE2 hashing) cost, memory expansion
+  uint64_t mem_cost = 0;
+  if (size > 0 && !evm_memory_expand(frame->memory, offset, size, frame->gas, &mem_cost)) {
+    return call_op_error(EVM_OUT_OF_GAS);
+  }
+  const uint64_t word_cost = GAS_INITCODE_WORD + (is_create2 ? GAS_KECCAK256_WORD : 0);
+  const uint64_t cost = GAS_CREATE + (((size + 31) / 32) * word_cost);
+  if (mem_cost > UINT64_MAX - cost || frame->gas < cost + mem_cost) {
+    return call_op_error(EVM_OUT_OF_GAS);
+  }
+  frame->gas -= cost + mem_cost;
+
+  // Return data is empty after any CREATE, unless the init code reverts
+  evm->return_data_size = 0;
+
+  // EIP-150: all but one 64th of the remaining gas goes to the init code
+  const uint64_t child_gas = gas_cap_call(frame->gas);
+  frame->gas -= child_gas;
+
+  // Failures before the creator's nonce changes keep the child gas
+  const uint64_t nonce = state_get_nonce(state, &frame->address);
+  if (frame->depth >= MAX_CALL_DEPTH || nonce == UINT64_MAX ||
+      (!uint256_is_zero(value) &&
+       uint256_lt(state_get_balance(state, &frame->address), value))) {
+    frame->gas += child_gas;
+    evm_stack_push_unsafe(frame->stack, uint256_zero());
+    return call_op_continue();
+  }
+
+  const uint8_t *code = size > 0 ? evm_memory_ptr_unsafe(frame->memory, offset) : nullptr;
+  initcode_cache_entry_t *entry = nullptr;
+  if (size > 0 && evm->initcode_cache != nullptr) {
+    entry = initcode_cache_lookup(evm->initcode_cache, code, (size_t)size);
+    if (entry != nullptr) {
+      code = entry->code;
+    }
+  }
+
+  hash_t code_hash = hash_zero();
+  address_t address;
+  if (is_create2) {
+    code_hash = entry != nullptr ? *initcode_cache_code_hash(entry) : keccak256(code, (size_t)size);
+    address = create2_address(&frame->address, salt, &code_hash);
+  } else {
+    address = create_address(&frame->address, nonce);
+  }
+
+  // EIP-2929: the address is warm even if creation fails. The same lookup
+  // checks for a collision with an account that has code or a nonce.
+  state_account_view_t existing;
+  (void)state_account_access(state, &address, STATE_ACCOUNT_INFO | STATE_ACCOUNT_CODE, &existing);
+  (void)state_increment_nonce(state, &frame->address);
+  if (existing.nonce != 0 || existing.code.size > 0) {
+    // Collision: the child gas is consumed
+    evm_stack_push_unsafe(frame->stack, uint256_zero());
+    return call_op_continue();
+  }
+
+  // New account (nonce 1 per EIP-161) and value transfer, undone with the snapshot if the
+  // init code fails
+  const uint64_t snapshot = state_snapshot(state);
+  state_set_nonce(state, &address, 1);
+  if (!uint256_is_zero(value)) {
+    (void)state_sub_balance(state, &frame->address, value);
+    (void)state_add_balance(state, &address, value);
+  }
+
+  const call_setup_t setup = {
+      .status = EVM_OK,
+      .target = address,
+      .value = value,
+      .child_gas = child_gas,
+      .args_offset = 0,
+      .args_size = 0,
+      .ret_offset = 0,
+      .ret_size = 0,
+  };
+  const child_frame_params_t params = {
+      .exec_type = is_create2 ? EXEC_CREATE2 : EXEC_CREATE,
+      .is_static = false,
+      .caller = frame->address,
+      .address = address,
+      .value = value,
+      .code_hash = code_hash,
+  };
+
+  call_frame_t *const child = init_child_frame(evm, frame, &setup, code, (size_t)size, &params);
+  if (child == nullptr) {
+    state_revert_to_snapshot(state, snapshot);
+    frame->gas += child_gas;
+    evm_stack_push_unsafe(frame->stack, uint256_zero());
+    return call_op_continue();
+  }
+  child->jumpdest_bitmap = entry != nullptr ? entry->jumpdest_bitmap : nullptr;
+  child->snapshot_id = snapshot;
+
+  evm->pending_frame = child;
+  return call_op_call();
+}
+
+call_op_result_t op_create(evm_t *const evm, call_frame_t *const frame) {
+  return create(evm, frame, false);
+}
+
+call_op_result_t op_create2(evm_t *const evm, call_frame_t *const frame) {
+  return create(evm, frame, true);
+}
@@ -9,6 +9,8 @@
 #include "div0/types/address.h"
 #include "div0/types/uint256.h"
 
+#include "copy.h"
+
 #include <stdint.h>
 #include <string.h>
 
@@ -143,81 +145,11 @@ static inline evm_status_t op_calldatacopy(call_frame_t *frame, const uint64_t g
     return EVM_STACK_UNDERFLOW;
   }
 
-  const uint256_t dest_offset_u256 = evm_stack_pop_unsafe(frame->stack);
-  const uint256_t src_offset_u256 = evm_stack_pop_unsafe(frame->stack);
-  const uint256_t size_u256 = evm_stack_pop_unsafe(frame->stack);
-
-  // Zero-size copy: only charge base gas, no memory expansion
-  if (uint256_is_zero(size_u256)) {
-    if (frame->gas < gas_cost) {
-      return EVM_OUT_OF_GAS;
-    }
-    frame->gas -= gas_cost;
-    return EVM_OK;
-  }
-
-  // Size must fit in uint64
-  if (!uint256_fits_u64(size_u256)) {
-    return EVM_OUT_OF_GAS;
-  }
-  const uint64_t size = uint256_to_u64_unsafe(size_u256);
-
-  // Destination offset must fit in uint64
-  if (!uint256_fits_u64(dest_offset_u256)) {
-    return EVM_OUT_OF_GAS;
-  }
-  const uint64_t dest_offset = uint256_to_u64_unsafe(dest_offset_u256);
-
-  // Check for overflow in dest_offset + size
-  if (dest_offset > UINT64_MAX - size) {
-    return EVM_OUT_OF_GAS;
-  }
-
-  // Calculate memory expansion cost
-  uint64_t mem_cost = 0;
-  if (!evm_memory_expand(frame->memory, dest_offset, size, &mem_cost)) {
-    return EVM_OUT_OF_GAS;
-  }
-
-  // Calculate word cost: GAS_COPY * ceil(size/32)
-  const uint64_t word_cost = GAS_COPY * ((size + 31) / 32);
-
-  // Total cost
-  const uint64_t total_cost = gas_cost + word_cost + mem_cost;
-  if (frame->gas < total_cost) {
-    return EVM_OUT_OF_GAS;
-  }
-  frame->gas -= total_cost;
-
-  // Get destination pointer
-  uint8_t *dest = (uint8_t *)evm_memory_ptr_unsafe(frame->memory, dest_offset);
-
-  // Source offset handling
-  uint64_t src_offset = 0;
-  bool src_in_bounds = false;
-  if (uint256_fits_u64(src_offset_u256)) {
-    src_offset = uint256_to_u64_unsafe(src_offset_u256);
-    src_in_bounds = src_offset < frame->input_size;
-  }
-
-  if (src_in_bounds) {
-    // Copy what we can from calldata
-    const size_t bytes_available = frame->input_size - src_offset;
-    const size_t bytes_to_copy = bytes_available < size ? bytes_available : size;
-    __builtin___memcpy_chk(dest, frame->input + src_offset, bytes_to_copy,
-                           __builtin_object_size(dest, 0));
-
-    // Zero-fill the rest
-    if (bytes_to_copy < size) {
-      __builtin___memset_chk(dest + bytes_to_copy, 0, size - bytes_to_copy,
-                             __builtin_object_size(dest + bytes_to_copy, 0));
-    }
-  } else {
-    // Source is entirely out of bounds, fill with zeros
-    __builtin___memset_chk(dest, 0, size, __builtin_object_size(dest, 0));
-  }
-
-  return EVM_OK;
+  const uint256_t dest_offset = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t src_offset = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t size = evm_stack_pop_unsafe(frame->stack);
+  return copy_to_memory(frame, gas_cost, dest_offset, src_offset, size, frame->input,
+                        frame->input_size);
 }
 
 /// CODECOPY opcode (0x39): Copy code to memory
@@ -229,81 +161,11 @@ static inline evm_status_t op_codecopy(call_frame_t *frame, const uint64_t gas_c
     return EVM_STACK_UNDERFLOW;
   }
 
-  const uint256_t dest_offset_u256 = evm_stack_pop_unsafe(frame->stack);
-  const uint256_t src_offset_u256 = evm_stack_pop_unsafe(frame->stack);
-  const uint256_t size_u256 = evm_stack_pop_unsafe(frame->stack);
-
-  // Zero-size copy: only charge base gas, no memory expansion
-  if (uint256_is_zero(size_u256)) {
-    if (frame->gas < gas_cost) {
-      return EVM_OUT_OF_GAS;
-    }
-    frame->gas -= gas_cost;
-    return EVM_OK;
-  }
-
-  // Size must fit in uint64
-  if (!uint256_fits_u64(size_u256)) {
-    return EVM_OUT_OF_GAS;
-  }
-  const uint64_t size = uint256_to_u64_unsafe(size_u256);
-
-  // Destination offset must fit in uint64
-  if (!uint256_fits_u64(dest_offset_u256)) {
-    return EVM_OUT_OF_GAS;
-  }
-  const uint64_t dest_offset = uint256_to_u64_unsafe(dest_offset_u256);
-
-  // Check for overflow in dest_offset + size
-  if (dest_offset > UINT64_MAX - size) {
-    return EVM_OUT_OF_GAS;
-  }
-
-  // Calculate memory expansion cost
-  uint64_t mem_cost = 0;
-  if (!evm_memory_expand(frame->memory, dest_offset, size, &mem_cost)) {
-    return EVM_OUT_OF_GAS;
-  }
-
-  // Calculate word cost: GAS_COPY * ceil(size/32)
-  const uint64_t word_cost = GAS_COPY * ((size + 31) / 32);
-
-  // Total cost
-  const uint64_t total_cost = gas_cost + word_cost + mem_cost;
-  if (frame->gas < total_cost) {
-    return EVM_OUT_OF_GAS;
-  }
-  frame->gas -= total_cost;
-
-  // Get destination pointer
-  uint8_t *dest = (uint8_t *)evm_memory_ptr_unsafe(frame->memory, dest_offset);
-
-  // Source offset handling
-  uint64_t src_offset = 0;
-  bool src_in_bounds = false;
-  if (uint256_fits_u64(src_offset_u256)) {
-    src_offset = uint256_to_u64_unsafe(src_offset_u256);
-    src_in_bounds = src_offset < frame->code_size;
-  }
-
-  if (src_in_bounds) {
-    // Copy what we can from code
-    const size_t bytes_available = frame->code_size - src_offset;
-    const size_t bytes_to_copy = bytes_available < size ? bytes_available : size;
-    __builtin___memcpy_chk(dest, frame->code + src_offset, bytes_to_copy,
-                           __builtin_object_size(dest, 0));
-
-    // Zero-fill the rest
-    if (bytes_to_copy < size) {
-      __builtin___memset_chk(dest + bytes_to_copy, 0, size - bytes_to_copy,
-                             __builtin_object_size(dest + bytes_to_copy, 0));
-    }
-  } else {
-    // Source is entirely out of bounds, fill with zeros
-    __builtin___memset_chk(dest, 0, size, __builtin_object_size(dest, 0));
-  }
-
-  return EVM_OK;
+  const uint256_t dest_offset = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t src_offset = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t size = evm_stack_pop_unsafe(frame->stack);
+  return copy_to_memory(frame, gas_cost, dest_offset, src_offset, size, frame->code,
+                        frame->code_size);
 }
 
 // =============================================================================
@@ -353,38 +215,8 @@ static inline evm_status_t op_returndatacopy(call_frame_t *frame, const uint64_t
     return EVM_OUT_OF_GAS;
   }
 
-  // Destination offset must fit in uint64
-  if (!uint256_fits_u64(dest_offset_u256)) {
-    return EVM_OUT_OF_GAS;
-  }
-  const uint64_t dest_offset = uint256_to_u64_unsafe(dest_offset_u256);
-
-  // Check for overflow in dest_offset + size
-  if (dest_offset > UINT64_MAX - size) {
-    return EVM_OUT_OF_GAS;
-  }
-
-  // Calculate memory expansion cost
-  uint64_t mem_cost = 0;
-  if (!evm_memory_expand(frame->memory, dest_offset, size, &mem_cost)) {
-    return EVM_OUT_OF_GAS;
-  }
-
-  // Calculate word cost: GAS_COPY * ceil(size/32)
-  const uint64_t word_cost = GAS_COPY * ((size + 31) / 32);
-
-  // Total cost
-  const uint64_t total_cost = gas_cost + word_cost + mem_cost;
-  if (frame->gas < total_cost) {
-    return EVM_OUT_OF_GAS;
-  }
-  frame->gas -= total_cost;
-
-  // Copy return data to memory
-  uint8_t *dest = (uint8_t *)evm_memory_ptr_unsafe(frame->memory, dest_offset);
-  __builtin___memcpy_chk(dest, return_data + src_offset, size, __builtin_object_size(dest, 0));
-
-  return EVM_OK;
+  return copy_to_memory(frame, gas_cost, dest_offset_u256, src_offset_u256, size_u256,
+                        return_data, return_data_size);
 }
 
 #endif // DIV0_EVM_OPCODES_CONTEXT_IMPL_H
@@ -0,0 +1,78 @@
+#ifndef DIV0_EVM_OPCODES_COPY_H
+#define DIV0_EVM_OPCODES_COPY_H
+
+#include "div0/evm/call_frame.h"
+#include "div0/evm/gas.h"
+#include "div0/evm/memory.h"
+#include "div0/evm/status.h"
+#include "div0/types/uint256.h"
+
+#include <stdint.h>
+
+// =============================================================================
+// Copy Engine
+// =============================================================================
+//
+// Shared by CALLDATACOPY, CODECOPY, EXTCODECOPY and RETURNDATACOPY: gas for
+// the words copied and the memory expansion, then one fused copy-and-pad
+// into memory. Expansion skips zeroing the destination range, since the copy
+// writes every byte of it.
+
+/// Charges base_cost + GAS_COPY per word + memory expansion, then copies
+/// src[src_offset, src_offset + size) to memory, reading zeros past src_size.
+/// A zero-size copy only charges base_cost and does not touch memory.
+/// @param frame Current frame
+/// @param base_cost Static or access cost of the opcode
+/// @param dest_offset_u256 Destination offset (stack operand)
+/// @param src_offset_u256 Source offset (stack operand)
+/// @param size_u256 Size (stack operand)
+/// @param src Source buffer (may be nullptr if src_size is 0)
+/// @param src_size Source buffer size
+/// @return EVM_OK or EVM_OUT_OF_GAS
+static inline evm_status_t copy_to_memory(call_frame_t *frame, const uint64_t base_cost,
+                                          const uint256_t dest_offset_u256,
+                                          const uint256_t src_offset_u256,
+                                          const uint256_t size_u256, const uint8_t *src,
+                                          const size_t src_size) {
+  // Zero-size copy: only charge base gas, no memory expansion
+  if (uint256_is_zero(size_u256)) {
+    if (frame->gas < base_cost) {
+      return EVM_OUT_OF_GAS;
+    }
+    frame->gas -= base_cost;
+    return EVM_OK;
+  }
+
+  // Size and destination offset must fit in uint64 without overflowing
+  if (!uint256_fits_u64(size_u256) || !uint256_fits_u64(dest_offset_u256)) {
+    return EVM_OUT_OF_GAS;
+  }
+  const uint64_t size = uint256_to_u64_unsafe(size_u256);
+  const uint64_t dest_offset = uint256_to_u64_unsafe(dest_offset_u256);
+  if (dest_offset > UINT64_MAX - size) {
+    return EVM_OUT_OF_GAS;
+  }
+
+  // Calculate memory expansion cost (the copy overwrites the whole range)
+  uint64_t mem_cost = 0;
+  if (!evm_memory_expand_for_write(frame->memory, dest_offset, size, frame->gas, &mem_cost)) {
+    return EVM_OUT_OF_GAS;
+  }
+
+  // Calculate word cost: GAS_COPY * ceil(size/32)
+  const uint64_t word_cost = GAS_COPY * ((size + 31) / 32);
+
+  const uint64_t total_cost = base_cost + word_cost + mem_cost;
+  if (frame->gas < total_cost) {
+    return EVM_OUT_OF_GAS;
+  }
+  frame->gas -= total_cost;
+
+  // Offsets beyond uint64 are past the end of any source
+  const uint64_t src_offset =
+      uint256_fits_u64(src_offset_u256) ? uint256_to_u64_unsafe(src_offset_u256) : UINT64_MAX;
+  evm_memory_copy_padded_unsafe(frame->memory, dest_offset, src, src_size, src_offset, size);
+  return EVM_OK;
+}
+
+#endif // DIV0_EVM_OPCODES_COPY_H
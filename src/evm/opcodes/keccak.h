@@ -51,7 +51,7 @@ static inline evm_status_t op_keccak256(call_frame_t *frame, const uint64_t gas_
 
   // Memory expansion
   uint64_t mem_cost = 0;
-  if (!evm_memory_expand(frame->memory, offset, size, &mem_cost)) {
+  if (!evm_memory_expand(frame->memory, offset, size, frame->gas, &mem_cost)) {
     return EVM_OUT_OF_GAS;
   }
 
@@ -80,7 +80,7 @@ static inline evm_status_t op_log_n(evm_log_vec_t *logs, div0_arena_t *arena, ca
   // Memory expansion cost
   uint64_t mem_cost = 0;
   if (size > 0) {
-    if (!evm_memory_expand(frame->memory, offset, size, &mem_cost)) {
+    if (!evm_memory_expand(frame->memory, offset, size, frame->gas, &mem_cost)) {
       return EVM_OUT_OF_GAS;
     }
     if (gas_cost > UINT64_MAX - mem_cost) {
@@ -2,6 +2,7 @@
 #define DIV0_EVM_OPCODES_MEMORY_H
 
 #include "div0/evm/call_frame.h"
+#include "div0/evm/gas.h"
 #include "div0/evm/memory.h"
 #include "div0/evm/stack.h"
 #include "div0/evm/status.h"
@@ -34,7 +35,7 @@ static inline evm_status_t op_mload(call_frame_t *frame, const uint64_t gas_cost
 
   // Calculate memory expansion cost
   uint64_t mem_cost = 0;
-  if (!evm_memory_expand(frame->memory, offset, 32, &mem_cost)) {
+  if (!evm_memory_expand(frame->memory, offset, 32, frame->gas, &mem_cost)) {
     return EVM_OUT_OF_GAS;
   }
 
@@ -75,7 +76,7 @@ static inline evm_status_t op_mstore(call_frame_t *frame, const uint64_t gas_cos
 
   // Calculate memory expansion cost
   uint64_t mem_cost = 0;
-  if (!evm_memory_expand(frame->memory, offset, 32, &mem_cost)) {
+  if (!evm_memory_expand(frame->memory, offset, 32, frame->gas, &mem_cost)) {
     return EVM_OUT_OF_GAS;
   }
 
@@ -115,7 +116,7 @@ static inline evm_status_t op_mstore8(call_frame_t *frame, const uint64_t gas_co
 
   // Calculate memory expansion cost
   uint64_t mem_cost = 0;
-  if (!evm_memory_expand(frame->memory, offset, 1, &mem_cost)) {
+  if (!evm_memory_expand(frame->memory, offset, 1, frame->gas, &mem_cost)) {
     return EVM_OUT_OF_GAS;
   }
 
@@ -149,4 +150,59 @@ static inline evm_status_t op_msize(call_frame_t *frame, const uint64_t gas_cost
   return EVM_OK;
 }
 
+/// MCOPY opcode (0x5E, EIP-5656): Copy memory to memory
+/// Stack: [destOffset, srcOffset, size] => []
+/// Gas: 3 + 3 * ceil(size/32) + memory_expansion_cost (over both ranges)
+static inline evm_status_t op_mcopy(call_frame_t *frame, const uint64_t gas_cost) {
+  if (!evm_stack_has_items(frame->stack, 3)) {
+    return EVM_STACK_UNDERFLOW;
+  }
+  const uint256_t dest_offset_u256 = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t src_offset_u256 = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t size_u256 = evm_stack_pop_unsafe(frame->stack);
+
+  // Zero-size copy: only charge base gas, offsets are not checked
+  if (uint256_is_zero(size_u256)) {
+    if (frame->gas < gas_cost) {
+      return EVM_OUT_OF_GAS;
+    }
+    frame->gas -= gas_cost;
+    return EVM_OK;
+  }
+
+  if (!uint256_fits_u64(size_u256) || !uint256_fits_u64(dest_offset_u256) ||
+      !uint256_fits_u64(src_offset_u256)) {
+    return EVM_OUT_OF_GAS;
+  }
+  const uint64_t size = uint256_to_u64_unsafe(size_u256);
+  const uint64_t dest_offset = uint256_to_u64_unsafe(dest_offset_u256);
+  const uint64_t src_offset = uint256_to_u64_unsafe(src_offset_u256);
+  const uint64_t high = dest_offset > src_offset ? dest_offset : src_offset;
+  if (high > UINT64_MAX - size) {
+    return EVM_OUT_OF_GAS;
+  }
+
+  // Memory must cover both ranges. If the source is already in memory, the
+  // only new bytes in range are the destination, which the copy overwrites.
+  uint64_t mem_cost = 0;
+  const bool src_in_memory = src_offset + size <= evm_memory_size(frame->memory);
+  const bool expanded =
+      src_in_memory
+          ? evm_memory_expand_for_write(frame->memory, dest_offset, size, frame->gas, &mem_cost)
+          : evm_memory_expand(frame->memory, high, size, frame->gas, &mem_cost);
+  if (!expanded) {
+    return EVM_OUT_OF_GAS;
+  }
+
+  const uint64_t word_cost = GAS_COPY * ((size + 31) / 32);
+  const uint64_t total_cost = gas_cost + word_cost + mem_cost;
+  if (frame->gas < total_cost) {
+    return EVM_OUT_OF_GAS;
+  }
+  frame->gas -= total_cost;
+
+  evm_memory_copy_unsafe(frame->memory, dest_offset, src_offset, size);
+  return EVM_OK;
+}
+
 #endif // DIV0_EVM_OPCODES_MEMORY_H
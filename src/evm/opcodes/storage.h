@@ -5,31 +5,30 @@
 #include "div0/evm/gas/dynamic_costs.h"
 #include "div0/evm/stack.h"
 #include "div0/evm/status.h"
+#include "div0/evm/transient_storage.h"
 #include "div0/state/state_access.h"
 #include "div0/types/uint256.h"
 
 /// SLOAD - Load from storage (0x54)
 /// Stack: [slot] => [value]
-static inline evm_status_t op_sload(call_frame_t *frame, state_access_t *state,
-                                    const gas_schedule_t *gas) {
+static inline evm_status_t op_sload(call_frame_t *frame, state_access_t *state) {
   if (!evm_stack_has_items(frame->stack, 1)) {
     return EVM_STACK_UNDERFLOW;
   }
 
   uint256_t slot = evm_stack_pop_unsafe(frame->stack);
 
-  // Mark slot as warm and check if it was cold (first access).
-  // Returns true if slot was cold, false if already warm.
-  bool is_cold = state_warm_slot(state, &frame->address, slot);
-  uint64_t gas_cost = gas->sload(is_cold);
+  // Mark slot as warm and load its value in one state lookup
+  uint256_t value;
+  bool is_cold;
+  state_storage_access(state, &frame->address, slot, &value, nullptr, &is_cold);
+  uint64_t gas_cost = gas_sload(is_cold);
 
   if (frame->gas < gas_cost) {
     return EVM_OUT_OF_GAS;
   }
   frame->gas -= gas_cost;
 
-  uint256_t value = state_get_storage(state, &frame->address, slot);
-
   if (!evm_stack_ensure_space(frame->stack, 1)) {
     return EVM_STACK_OVERFLOW;
   }
@@ -41,7 +40,7 @@ static inline evm_status_t op_sload(call_frame_t *frame, state_access_t *state,
 /// SSTORE - Store to storage (0x55)
 /// Stack: [slot, value] => []
 static inline evm_status_t op_sstore(call_frame_t *frame, state_access_t *state,
-                                     const gas_schedule_t *gas, uint64_t *gas_refund) {
+                                     uint64_t *gas_refund) {
   if (frame->is_static) {
     return EVM_WRITE_PROTECTION;
   }
@@ -53,16 +52,15 @@ static inline evm_status_t op_sstore(call_frame_t *frame, state_access_t *state,
   uint256_t slot = evm_stack_pop_unsafe(frame->stack);
   uint256_t new_value = evm_stack_pop_unsafe(frame->stack);
 
-  uint256_t current_value = state_get_storage(state, &frame->address, slot);
-  uint256_t original_value = state_get_original_storage(state, &frame->address, slot);
-
-  // Mark slot as warm and check if it was cold (first access).
-  // Returns true if slot was cold, false if already warm.
-  bool is_cold = state_warm_slot(state, &frame->address, slot);
+  // Mark slot as warm and load current and original values in one state lookup
+  uint256_t current_value;
+  uint256_t original_value;
+  bool is_cold;
+  state_storage_access(state, &frame->address, slot, &current_value, &original_value, &is_cold);
 
-  uint64_t gas_cost = gas->sstore(is_cold, current_value, original_value, new_value);
+  uint64_t gas_cost = gas_sstore(is_cold, current_value, original_value, new_value);
 
-  if (frame->gas <= gas->sstore_min_gas) {
+  if (frame->gas <= gas_sstore_sentry()) {
     return EVM_OUT_OF_GAS;
   }
 
@@ -71,7 +69,7 @@ static inline evm_status_t op_sstore(call_frame_t *frame, state_access_t *state,
   }
   frame->gas -= gas_cost;
 
-  int64_t refund = gas->sstore_refund(current_value, original_value, new_value);
+  int64_t refund = gas_sstore_refund(current_value, original_value, new_value);
   if (refund >= 0) {
     *gas_refund += (uint64_t)refund;
   } else {
@@ -83,8 +81,51 @@ static inline evm_status_t op_sstore(call_frame_t *frame, state_access_t *state,
     }
   }
 
-  state_set_storage(state, &frame->address, slot, new_value);
+  state_storage_write(state, &frame->address, slot, current_value, original_value, new_value);
+
+  return EVM_OK;
+}
+
+/// TLOAD - Load from transient storage (0x5C, EIP-1153)
+/// Stack: [slot] => [value]
+/// @param gas_cost Static gas cost of the fork (warm storage read)
+static inline evm_status_t op_tload(call_frame_t *frame, const transient_storage_t *ts,
+                                    const uint64_t gas_cost) {
+  if (!evm_stack_has_items(frame->stack, 1)) {
+    return EVM_STACK_UNDERFLOW;
+  }
+  if (frame->gas < gas_cost) {
+    return EVM_OUT_OF_GAS;
+  }
+  frame->gas -= gas_cost;
 
+  // Replace the slot with its value in place
+  const uint256_t slot = evm_stack_pop_unsafe(frame->stack);
+  evm_stack_push_unsafe(frame->stack, transient_storage_get(ts, &frame->address, slot));
+  return EVM_OK;
+}
+
+/// TSTORE - Store to transient storage (0x5D, EIP-1153)
+/// Stack: [slot, value] => []
+/// @param gas_cost Static gas cost of the fork (warm storage read)
+static inline evm_status_t op_tstore(call_frame_t *frame, transient_storage_t *ts,
+                                     const uint64_t gas_cost) {
+  if (frame->is_static) {
+    return EVM_WRITE_PROTECTION;
+  }
+  if (!evm_stack_has_items(frame->stack, 2)) {
+    return EVM_STACK_UNDERFLOW;
+  }
+  if (frame->gas < gas_cost) {
+    return EVM_OUT_OF_GAS;
+  }
+  frame->gas -= gas_cost;
+
+  const uint256_t slot = evm_stack_pop_unsafe(frame->stack);
+  const uint256_t value = evm_stack_pop_unsafe(frame->stack);
+  if (!transient_storage_set(ts, &frame->address, slot, value)) {
+    return EVM_OUT_OF_GAS;
+  }
   return EVM_OK;
 }
 
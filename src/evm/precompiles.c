@@ -0,0 +1,411 @@
+#include "div0/evm/precompiles.h"
+
+#include "div0/crypto/blake2b.h"
+#include "div0/crypto/bn254.h"
+#include "div0/crypto/ripemd160.h"
+#include "div0/crypto/sha256.h"
+#include "div0/types/uint256.h"
+
+#include "modexp.h"
+
+typedef unsigned __int128 uint128_t;
+
+// =============================================================================
+// Gas Costs
+// =============================================================================
+
+static constexpr uint64_t GAS_ECRECOVER = 3000;
+static constexpr uint64_t GAS_SHA256_BASE = 60;
+static constexpr uint64_t GAS_SHA256_WORD = 12;
+static constexpr uint64_t GAS_RIPEMD160_BASE = 600;
+static constexpr uint64_t GAS_RIPEMD160_WORD = 120;
+static constexpr uint64_t GAS_IDENTITY_BASE = 15;
+static constexpr uint64_t GAS_IDENTITY_WORD = 3;
+static constexpr uint64_t GAS_MODEXP_MIN = 200;
+static constexpr uint64_t GAS_ECADD = 150;
+static constexpr uint64_t GAS_ECMUL = 6000;
+static constexpr uint64_t GAS_ECPAIRING_BASE = 45000;
+static constexpr uint64_t GAS_ECPAIRING_PAIR = 34000;
+
+static constexpr size_t WORD_SIZE = 32;
+
+// Number of active precompile addresses per fork
+static constexpr uint8_t PRECOMPILE_COUNT_SHANGHAI = 0x09; // through BLAKE2F
+static constexpr uint8_t PRECOMPILE_COUNT_CANCUN = 0x0a;   // + point evaluation (EIP-4844)
+static constexpr uint8_t PRECOMPILE_COUNT_PRAGUE = 0x11;   // + BLS12-381 (EIP-2537)
+
+/// Charge base + per_word * ceil(size / 32).
+/// @return false if the cost exceeds the available gas
+static bool charge_words(const precompile_input_t *const in, precompile_output_t *const out,
+                         const uint64_t base, const uint64_t per_word) {
+  const uint128_t words = ((uint128_t)in->input_size + WORD_SIZE - 1) / WORD_SIZE;
+  const uint128_t cost = base + (words * per_word);
+  if (cost > in->gas) {
+    return false;
+  }
+  out->gas_used = (uint64_t)cost;
+  return true;
+}
+
+/// Charge a fixed cost.
+static bool charge(const precompile_input_t *const in, precompile_output_t *const out,
+                   const uint64_t cost) {
+  if (cost > in->gas) {
+    return false;
+  }
+  out->gas_used = cost;
+  return true;
+}
+
+/// Copy input bytes [offset, offset + len) into dst, zero-filling past the
+/// end of the input (precompile inputs are implicitly right-padded).
+static void read_padded(const precompile_input_t *const in, const size_t offset, uint8_t *const dst,
+                        const size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    const size_t pos = offset + i;
+    dst[i] = pos < in->input_size ? in->input[pos] : 0;
+  }
+}
+
+// =============================================================================
+// 0x01 - 0x04: ECRECOVER, SHA256, RIPEMD160, IDENTITY
+// =============================================================================
+
+static bool precompile_ecrecover(const precompile_input_t *const in,
+                                 precompile_output_t *const out) {
+  if (!charge(in, out, GAS_ECRECOVER)) {
+    return false;
+  }
+  out->output = out->inline_output;
+  out->output_size = 0;
+
+  uint8_t buf[4 * WORD_SIZE];
+  read_padded(in, 0, buf, sizeof(buf));
+
+  // v must be exactly 27 or 28 as a 32-byte word; invalid signatures return
+  // empty output (not a failure)
+  for (size_t i = WORD_SIZE; i < (2 * WORD_SIZE) - 1; i++) {
+    if (buf[i] != 0) {
+      return true;
+    }
+  }
+  const uint8_t v = buf[(2 * WORD_SIZE) - 1];
+  if ((v != 27 && v != 28) || in->secp_ctx == nullptr) {
+    return true;
+  }
+
+  const uint256_t hash = uint256_from_bytes_be(buf, WORD_SIZE);
+  const uint256_t r = uint256_from_bytes_be(buf + (2 * WORD_SIZE), WORD_SIZE);
+  const uint256_t s = uint256_from_bytes_be(buf + (3 * WORD_SIZE), WORD_SIZE);
+  const ecrecover_result_t rec = secp256k1_ecrecover(in->secp_ctx, &hash, v, &r, &s, 0);
+  if (!rec.success) {
+    return true;
+  }
+
+  __builtin___memset_chk(out->inline_output, 0, WORD_SIZE - ADDRESS_SIZE,
+                         sizeof(out->inline_output));
+  __builtin___memcpy_chk(out->inline_output + (WORD_SIZE - ADDRESS_SIZE), rec.address.bytes,
+                         ADDRESS_SIZE, sizeof(out->inline_output) - (WORD_SIZE - ADDRESS_SIZE));
+  out->output_size = WORD_SIZE;
+  return true;
+}
+
+static bool precompile_sha256(const precompile_input_t *const in,
+                              precompile_output_t *const out) {
+  if (!charge_words(in, out, GAS_SHA256_BASE, GAS_SHA256_WORD)) {
+    return false;
+  }
+  const hash_t digest = sha256(in->input, in->input_size);
+  __builtin___memcpy_chk(out->inline_output, digest.bytes, HASH_SIZE, sizeof(out->inline_output));
+  out->output = out->inline_output;
+  out->output_size = HASH_SIZE;
+  return true;
+}
+
+static bool precompile_ripemd160(const precompile_input_t *const in,
+                                 precompile_output_t *const out) {
+  if (!charge_words(in, out, GAS_RIPEMD160_BASE, GAS_RIPEMD160_WORD)) {
+    return false;
+  }
+  // 20-byte digest, left-padded to a word
+  __builtin___memset_chk(out->inline_output, 0, WORD_SIZE - RIPEMD160_SIZE,
+                         sizeof(out->inline_output));
+  ripemd160(in->input, in->input_size, out->inline_output + (WORD_SIZE - RIPEMD160_SIZE));
+  out->output = out->inline_output;
+  out->output_size = WORD_SIZE;
+  return true;
+}
+
+static bool precompile_identity(const precompile_input_t *const in,
+                                precompile_output_t *const out) {
+  if (!charge_words(in, out, GAS_IDENTITY_BASE, GAS_IDENTITY_WORD)) {
+    return false;
+  }
+  // The caller copies the return data before the input can change
+  out->output = in->input;
+  out->output_size = in->input_size;
+  return true;
+}
+
+// =============================================================================
+// 0x05: MODEXP (EIP-198, EIP-2565)
+// =============================================================================
+
+// Operand sizes above this always exceed any gas limit (unless both base and
+// modulus are empty, which costs the minimum)
+static constexpr uint64_t MODEXP_MAX_SIZE = UINT32_MAX;
+
+/// Read a 32-byte length word, saturating to UINT64_MAX.
+static uint64_t read_length(const precompile_input_t *const in, const size_t offset) {
+  uint8_t buf[WORD_SIZE];
+  read_padded(in, offset, buf, WORD_SIZE);
+  const uint256_t v = uint256_from_bytes_be(buf, WORD_SIZE);
+  return uint256_fits_u64(v) ? uint256_to_u64_unsafe(v) : UINT64_MAX;
+}
+
+/// Operand view over the input, [offset, offset + len) with implicit padding.
+static modexp_operand_t operand_at(const precompile_input_t *const in, const size_t offset,
+                                   const size_t len) {
+  size_t avail = 0;
+  if (offset < in->input_size) {
+    avail = in->input_size - offset;
+    if (avail > len) {
+      avail = len;
+    }
+  }
+  return (modexp_operand_t){
+      .data = in->input + (avail > 0 ? offset : 0),
+      .avail = avail,
+      .len = len,
+  };
+}
+
+/// EIP-2565 gas: max(200, ceil(max(Bsize, Msize) / 8)^2 * max(iterations, 1) / 3).
+static uint128_t modexp_gas(const uint64_t bsize, const uint64_t esize, const uint64_t msize,
+                            const modexp_operand_t *const exp) {
+  const uint128_t max_len = bsize > msize ? bsize : msize;
+  const uint128_t words = (max_len + 7) / 8;
+  const uint128_t complexity = words * words;
+
+  // Bit length of the exponent's first (up to) 32 bytes
+  const size_t head_len = esize < WORD_SIZE ? (size_t)esize : WORD_SIZE;
+  uint64_t head_bits = 0;
+  for (size_t i = 0; i < head_len; i++) {
+    const uint8_t byte = modexp_operand_byte(exp, i);
+    if (byte != 0) {
+      head_bits = ((head_len - i) * 8) - (uint64_t)__builtin_clz(byte) + 24;
+      break;
+    }
+  }
+  uint128_t iterations = head_bits > 0 ? head_bits - 1 : 0;
+  if (esize > WORD_SIZE) {
+    iterations += (uint128_t)8 * (esize - WORD_SIZE);
+  }
+  if (iterations == 0) {
+    iterations = 1;
+  }
+
+  const uint128_t gas = complexity * iterations / 3;
+  return gas > GAS_MODEXP_MIN ? gas : GAS_MODEXP_MIN;
+}
+
+static bool precompile_modexp(const precompile_input_t *const in,
+                              precompile_output_t *const out) {
+  const uint64_t bsize = read_length(in, 0);
+  const uint64_t esize = read_length(in, WORD_SIZE);
+  const uint64_t msize = read_length(in, 2 * WORD_SIZE);
+
+  out->output = out->inline_output;
+  out->output_size = 0;
+  if (bsize == 0 && msize == 0) {
+    return charge(in, out, GAS_MODEXP_MIN);
+  }
+  if (bsize > MODEXP_MAX_SIZE || esize > MODEXP_MAX_SIZE || msize > MODEXP_MAX_SIZE) {
+    return false;
+  }
+
+  const size_t header = 3 * WORD_SIZE;
+  const modexp_operand_t base = operand_at(in, header, (size_t)bsize);
+  const modexp_operand_t exp = operand_at(in, header + (size_t)bsize, (size_t)esize);
+  const modexp_operand_t mod = operand_at(in, header + (size_t)(bsize + esize), (size_t)msize);
+
+  const uint128_t gas = modexp_gas(bsize, esize, msize, &exp);
+  if (gas > in->gas) {
+    return false;
+  }
+  out->gas_used = (uint64_t)gas;
+  if (msize == 0) {
+    return true;
+  }
+
+  uint8_t *const result = div0_arena_alloc_array(in->arena, (size_t)msize, 1, 1);
+  if (result == nullptr || !modexp(&base, &exp, &mod, result, in->arena)) {
+    return false;
+  }
+  out->output = result;
+  out->output_size = (size_t)msize;
+  return true;
+}
+
+// =============================================================================
+// 0x06 - 0x08: BN254 ECADD, ECMUL, ECPAIRING (EIP-196, EIP-197, EIP-1108)
+// =============================================================================
+
+static bool precompile_ecadd(const precompile_input_t *const in,
+                             precompile_output_t *const out) {
+  if (!charge(in, out, GAS_ECADD)) {
+    return false;
+  }
+  uint8_t buf[2 * BN254_G1_SIZE];
+  read_padded(in, 0, buf, sizeof(buf));
+  if (!bn254_g1_add(buf, buf + BN254_G1_SIZE, out->inline_output)) {
+    return false;
+  }
+  out->output = out->inline_output;
+  out->output_size = BN254_G1_SIZE;
+  return true;
+}
+
+static bool precompile_ecmul(const precompile_input_t *const in,
+                             precompile_output_t *const out) {
+  if (!charge(in, out, GAS_ECMUL)) {
+    return false;
+  }
+  uint8_t buf[BN254_G1_SIZE + BN254_SCALAR_SIZE];
+  read_padded(in, 0, buf, sizeof(buf));
+  if (!bn254_g1_mul(buf, buf + BN254_G1_SIZE, out->inline_output)) {
+    return false;
+  }
+  out->output = out->inline_output;
+  out->output_size = BN254_G1_SIZE;
+  return true;
+}
+
+static bool precompile_ecpairing(const precompile_input_t *const in,
+                                 precompile_output_t *const out) {
+  if (in->input_size % BN254_PAIR_SIZE != 0) {
+    return false;
+  }
+  const size_t pairs = in->input_size / BN254_PAIR_SIZE;
+  const uint128_t cost = GAS_ECPAIRING_BASE + ((uint128_t)GAS_ECPAIRING_PAIR * pairs);
+  if (cost > in->gas) {
+    return false;
+  }
+  out->gas_used = (uint64_t)cost;
+
+  bool result = false;
+  if (!bn254_pairing_check(in->input, pairs, &result)) {
+    return false;
+  }
+  __builtin___memset_chk(out->inline_output, 0, WORD_SIZE, sizeof(out->inline_output));
+  out->inline_output[WORD_SIZE - 1] = result ? 1 : 0;
+  out->output = out->inline_output;
+  out->output_size = WORD_SIZE;
+  return true;
+}
+
+// =============================================================================
+// 0x09: BLAKE2F (EIP-152)
+// =============================================================================
+
+static constexpr size_t BLAKE2F_INPUT_SIZE = 213;
+
+static uint64_t load_le64(const uint8_t *const p) {
+  uint64_t v = 0;
+  for (size_t i = 0; i < 8; i++) {
+    v |= (uint64_t)p[i] << (8 * i);
+  }
+  return v;
+}
+
+static bool precompile_blake2f(const precompile_input_t *const in,
+                               precompile_output_t *const out) {
+  if (in->input_size != BLAKE2F_INPUT_SIZE) {
+    return false;
+  }
+  const uint8_t *const p = in->input;
+  const uint32_t rounds =
+      ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+  const uint8_t final = p[BLAKE2F_INPUT_SIZE - 1];
+  if (final > 1 || !charge(in, out, rounds)) {
+    return false;
+  }
+
+  uint64_t h[8];
+  uint64_t m[16];
+  uint64_t t[2];
+  for (size_t i = 0; i < 8; i++) {
+    h[i] = load_le64(p + 4 + (8 * i));
+  }
+  for (size_t i = 0; i < 16; i++) {
+    m[i] = load_le64(p + 68 + (8 * i));
+  }
+  t[0] = load_le64(p + 196);
+  t[1] = load_le64(p + 204);
+
+  blake2b_compress(h, m, t, final == 1, rounds);
+
+  for (size_t i = 0; i < 8; i++) {
+    for (size_t j = 0; j < 8; j++) {
+      out->inline_output[(8 * i) + j] = (uint8_t)(h[i] >> (8 * j));
+    }
+  }
+  out->output = out->inline_output;
+  out->output_size = sizeof(out->inline_output);
+  return true;
+}
+
+// =============================================================================
+// Registry
+// =============================================================================
+
+/// Active addresses without a native implementation (0x0a point evaluation,
+/// BLS12-381). Calls fail and consume their gas rather than succeeding as
+/// calls to empty accounts.
+static bool precompile_unavailable([[maybe_unused]] const precompile_input_t *const in,
+                                   [[maybe_unused]] precompile_output_t *const out) {
+  return false;
+}
+
+// Implementations indexed by address - 1
+static const precompile_fn_t PRECOMPILES[] = {
+    precompile_ecrecover, // 0x01
+    precompile_sha256,    // 0x02
+    precompile_ripemd160, // 0x03
+    precompile_identity,  // 0x04
+    precompile_modexp,    // 0x05
+    precompile_ecadd,     // 0x06
+    precompile_ecmul,     // 0x07
+    precompile_ecpairing, // 0x08
+    precompile_blake2f,   // 0x09
+};
+
+static constexpr size_t PRECOMPILES_IMPLEMENTED = sizeof(PRECOMPILES) / sizeof(PRECOMPILES[0]);
+
+uint8_t precompile_count(const fork_t fork) {
+  switch (fork) {
+  case FORK_SHANGHAI:
+    return PRECOMPILE_COUNT_SHANGHAI;
+  case FORK_CANCUN:
+    return PRECOMPILE_COUNT_CANCUN;
+  case FORK_PRAGUE:
+  case FORK_UNKNOWN:
+    break;
+  }
+  // FORK_UNKNOWN defaults to latest known fork (Prague)
+  return PRECOMPILE_COUNT_PRAGUE;
+}
+
+precompile_fn_t precompile_get(const fork_t fork, const address_t *const addr) {
+  // Precompile addresses are 0x00..00NN: reject on the last byte first
+  const uint8_t last = addr->bytes[ADDRESS_SIZE - 1];
+  if (last == 0 || last > precompile_count(fork)) {
+    return nullptr;
+  }
+  for (size_t i = 0; i < ADDRESS_SIZE - 1; i++) {
+    if (addr->bytes[i] != 0) {
+      return nullptr;
+    }
+  }
+  return last <= PRECOMPILES_IMPLEMENTED ? PRECOMPILES[last - 1] : precompile_unavailable;
+}
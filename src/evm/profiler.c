@@ -0,0 +1,236 @@
+#include "div0/evm/profiler.h"
+
+#ifndef DIV0_FREESTANDING
+
+#include "div0/crypto/keccak256.h"
+#include "div0/evm/memory_pool.h"
+#include "div0/evm/opcodes.h"
+#include "div0/util/hex.h"
+
+#include <inttypes.h>
+#include <stdalign.h>
+#include <time.h>
+
+/// Monotonic time in nanoseconds (vDSO, no syscall on Linux).
+static inline uint64_t profiler_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+static inline uint64_t saturating_sub(const uint64_t a, const uint64_t b) {
+  return a > b ? a - b : 0;
+}
+
+// =============================================================================
+// Lookup
+// =============================================================================
+
+/// Find or create the child of parent executing at address.
+/// Falls back to parent (merging the frame into its caller) on allocation failure.
+static evm_profile_node_t *child_node(evm_profiler_t *const profiler,
+                                      evm_profile_node_t *const parent,
+                                      const address_t *const address) {
+  for (evm_profile_node_t *node = parent->first_child; node != nullptr;
+       node = node->next_sibling) {
+    if (address_equal(&node->address, address)) {
+      return node;
+    }
+  }
+
+  evm_profile_node_t *const node =
+      div0_arena_alloc_array(profiler->arena, 1, sizeof(*node), alignof(evm_profile_node_t));
+  if (node == nullptr) {
+    profiler->truncated = true;
+    return parent;
+  }
+  __builtin___memset_chk(node, 0, sizeof(*node), __builtin_object_size(node, 0));
+  node->parent = parent;
+  node->address = *address;
+  node->next_sibling = parent->first_child;
+  parent->first_child = node;
+  node->next = profiler->nodes;
+  profiler->nodes = node;
+  return node;
+}
+
+/// Find or create the entry for a bytecode (hashed once, on first sight).
+static evm_profile_code_t *code_entry(evm_profiler_t *const profiler, const uint8_t *const code,
+                                      const size_t code_size) {
+  for (evm_profile_code_t *entry = profiler->codes; entry != nullptr; entry = entry->next) {
+    if (entry->code == code && entry->code_size == code_size) {
+      return entry;
+    }
+  }
+
+  evm_profile_code_t *const entry =
+      div0_arena_alloc_array(profiler->arena, 1, sizeof(*entry), alignof(evm_profile_code_t));
+  if (entry == nullptr) {
+    profiler->truncated = true;
+    return nullptr;
+  }
+  __builtin___memset_chk(entry, 0, sizeof(*entry), __builtin_object_size(entry, 0));
+  entry->code = code;
+  entry->code_size = code_size;
+  entry->code_hash = keccak256(code, code_size);
+  entry->next = profiler->codes;
+  profiler->codes = entry;
+  return entry;
+}
+
+// =============================================================================
+// Hooks
+// =============================================================================
+
+/// Charge the pending step at a depth, given the time and gas after it.
+static void profiler_settle(evm_profiler_t *const profiler, evm_profile_depth_t *const entry,
+                            const uint64_t now, const uint64_t gas_after) {
+  if (!entry->pending) {
+    return;
+  }
+  // Inclusive cost minus what child frames used (charged to their own opcodes)
+  const uint64_t ns = saturating_sub(saturating_sub(now, entry->step_ns), entry->child_ns);
+  const uint64_t gas =
+      saturating_sub(saturating_sub(entry->step_gas, gas_after), entry->child_gas);
+  entry->node->ns[entry->opcode] += ns;
+  entry->node->gas[entry->opcode] += gas;
+  if (entry->code != nullptr) {
+    entry->code->ns[entry->opcode] += ns;
+    entry->code->gas[entry->opcode] += gas;
+  }
+  profiler->total_ns += ns;
+  profiler->total_gas += gas;
+  entry->pending = false;
+}
+
+static void profiler_step(evm_tracer_t *const tracer, const evm_trace_step_t *const step) {
+  const uint64_t now = profiler_now_ns();
+  const auto profiler = (evm_profiler_t *)tracer;
+  evm_profile_depth_t *const entry = &profiler->depths[step->frame->depth];
+  profiler_settle(profiler, entry, now, step->gas);
+
+  entry->step_ns = now;
+  entry->step_gas = step->gas;
+  entry->child_ns = 0;
+  entry->child_gas = 0;
+  entry->opcode = step->opcode;
+  entry->pending = true;
+  if (entry->code != nullptr) {
+    entry->code->counts[step->opcode]++;
+  }
+}
+
+static void profiler_call_enter(evm_tracer_t *const tracer, const call_frame_t *const parent,
+                                const call_frame_t *const frame) {
+  const auto profiler = (evm_profiler_t *)tracer;
+  evm_profile_node_t *const parent_node =
+      parent == nullptr ? profiler->root : profiler->depths[parent->depth].node;
+
+  evm_profile_depth_t *const entry = &profiler->depths[frame->depth];
+  entry->node = child_node(profiler, parent_node, &frame->address);
+  entry->code = code_entry(profiler, frame->code, frame->code_size);
+  entry->start_gas = frame->gas;
+  entry->pending = false;
+  // Read last, so lookups and hashing are charged to the caller's CALL
+  entry->start_ns = profiler_now_ns();
+}
+
+static void profiler_call_exit(evm_tracer_t *const tracer, const call_frame_t *const frame,
+                               const frame_result_t *const result) {
+  const uint64_t now = profiler_now_ns();
+  const auto profiler = (evm_profiler_t *)tracer;
+  const uint64_t gas_left = evm_tracer_exit_gas(frame, result);
+  evm_profile_depth_t *const entry = &profiler->depths[frame->depth];
+  profiler_settle(profiler, entry, now, gas_left);
+
+  // The caller's pending CALL is charged only what the child did not use
+  if (frame->depth > 0) {
+    evm_profile_depth_t *const parent = &profiler->depths[frame->depth - 1];
+    parent->child_ns += saturating_sub(now, entry->start_ns);
+    parent->child_gas += saturating_sub(entry->start_gas, gas_left);
+  }
+}
+
+static const evm_tracer_vtable_t PROFILER_VTABLE = {
+    .step = profiler_step,
+    .call_enter = profiler_call_enter,
+    .call_exit = profiler_call_exit,
+    .storage_access = nullptr,
+};
+
+bool evm_profiler_init(evm_profiler_t *const profiler, div0_arena_t *const arena) {
+  __builtin___memset_chk(profiler, 0, sizeof(*profiler), __builtin_object_size(profiler, 0));
+  profiler->base.vtable = &PROFILER_VTABLE;
+  profiler->arena = arena;
+
+  profiler->root =
+      div0_arena_alloc_array(arena, 1, sizeof(evm_profile_node_t), alignof(evm_profile_node_t));
+  profiler->depths = div0_arena_alloc_array(arena, EVM_MAX_CALL_DEPTH, sizeof(evm_profile_depth_t),
+                                            alignof(evm_profile_depth_t));
+  if (profiler->root == nullptr || profiler->depths == nullptr) {
+    return false;
+  }
+  __builtin___memset_chk(profiler->root, 0, sizeof(evm_profile_node_t),
+                         sizeof(evm_profile_node_t));
+  const size_t size = EVM_MAX_CALL_DEPTH * sizeof(evm_profile_depth_t);
+  __builtin___memset_chk(profiler->depths, 0, size, size);
+  return true;
+}
+
+// =============================================================================
+// Output
+// =============================================================================
+
+// Report output uses fprintf; errors are checked once with ferror at the end.
+// NOLINTBEGIN(cert-err33-c)
+
+/// Write a node's address stack, outermost caller first, separated by ';'.
+static void write_stack(const evm_profile_node_t *const node, FILE *const out) {
+  const evm_profile_node_t *path[EVM_MAX_CALL_DEPTH];
+  size_t len = 0;
+  for (const evm_profile_node_t *n = node; n->parent != nullptr && len < EVM_MAX_CALL_DEPTH;
+       n = n->parent) {
+    path[len++] = n;
+  }
+  char hex[43];
+  while (len > 0) {
+    hex_encode_address(&path[--len]->address, hex);
+    fputs(hex, out);
+    fputc(';', out);
+  }
+}
+
+bool evm_profiler_write_collapsed(const evm_profiler_t *const profiler, FILE *const out,
+                                  const evm_profile_metric_t metric) {
+  for (const evm_profile_node_t *node = profiler->nodes; node != nullptr; node = node->next) {
+    const uint64_t *const values = metric == EVM_PROFILE_GAS ? node->gas : node->ns;
+    for (size_t op = 0; op < 256; op++) {
+      if (values[op] == 0) {
+        continue;
+      }
+      write_stack(node, out);
+      fprintf(out, "%s %" PRIu64 "\n", evm_opcode_name((uint8_t)op), values[op]);
+    }
+  }
+  return ferror(out) == 0;
+}
+
+bool evm_profiler_write_opcodes(const evm_profiler_t *const profiler, FILE *const out) {
+  fputs("code_hash,opcode,name,count,gas,ns\n", out);
+  char hex[67];
+  for (const evm_profile_code_t *entry = profiler->codes; entry != nullptr; entry = entry->next) {
+    hex_encode_hash(&entry->code_hash, hex);
+    for (size_t op = 0; op < 256; op++) {
+      if (entry->counts[op] == 0) {
+        continue;
+      }
+      fprintf(out, "%s,0x%02zx,%s,%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n", hex, op,
+              evm_opcode_name((uint8_t)op), entry->counts[op], entry->gas[op], entry->ns[op]);
+    }
+  }
+  return ferror(out) == 0;
+}
+
+// NOLINTEND(cert-err33-c)
+
+#endif // DIV0_FREESTANDING
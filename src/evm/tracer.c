@@ -0,0 +1,119 @@
+#include "div0/evm/tracer.h"
+
+#include "div0/evm/memory_pool.h"
+
+#include <stdalign.h>
+
+// =============================================================================
+// Opcode Histogram
+// =============================================================================
+
+static void histogram_step(evm_tracer_t *const tracer, const evm_trace_step_t *const step) {
+  const auto hist = (evm_opcode_histogram_t *)tracer;
+  hist->counts[step->opcode]++;
+  hist->steps++;
+}
+
+static void histogram_storage_access(evm_tracer_t *const tracer, const call_frame_t *const frame,
+                                     const uint256_t slot, const uint256_t value,
+                                     const bool is_write) {
+  (void)frame;
+  (void)slot;
+  (void)value;
+  const auto hist = (evm_opcode_histogram_t *)tracer;
+  if (is_write) {
+    hist->storage_writes++;
+  } else {
+    hist->storage_reads++;
+  }
+}
+
+static const evm_tracer_vtable_t HISTOGRAM_VTABLE = {
+    .step = histogram_step,
+    .call_enter = nullptr,
+    .call_exit = nullptr,
+    .storage_access = histogram_storage_access,
+};
+
+void evm_opcode_histogram_init(evm_opcode_histogram_t *const hist) {
+  __builtin___memset_chk(hist, 0, sizeof(*hist), __builtin_object_size(hist, 0));
+  hist->base.vtable = &HISTOGRAM_VTABLE;
+}
+
+// =============================================================================
+// Gas Profiler
+// =============================================================================
+
+/// Charge the pending step at a depth, given the gas left after it.
+static void profiler_settle(evm_gas_profiler_t *const profiler, const uint16_t depth,
+                            const uint64_t gas_after) {
+  evm_gas_profiler_depth_t *const entry = &profiler->depths[depth];
+  if (!entry->pending) {
+    return;
+  }
+  // Inclusive cost minus what child frames used (charged to their own opcodes)
+  const uint64_t inclusive = entry->gas > gas_after ? entry->gas - gas_after : 0;
+  const uint64_t cost = inclusive > entry->child_gas ? inclusive - entry->child_gas : 0;
+  profiler->gas[entry->opcode] += cost;
+  profiler->total_gas += cost;
+  entry->pending = false;
+  entry->child_gas = 0;
+}
+
+static void profiler_step(evm_tracer_t *const tracer, const evm_trace_step_t *const step) {
+  const auto profiler = (evm_gas_profiler_t *)tracer;
+  const uint16_t depth = step->frame->depth;
+  profiler_settle(profiler, depth, step->gas);
+
+  evm_gas_profiler_depth_t *const entry = &profiler->depths[depth];
+  entry->gas = step->gas;
+  entry->child_gas = 0;
+  entry->opcode = step->opcode;
+  entry->pending = true;
+  profiler->counts[step->opcode]++;
+}
+
+static void profiler_call_enter(evm_tracer_t *const tracer, const call_frame_t *const parent,
+                                const call_frame_t *const frame) {
+  (void)parent;
+  const auto profiler = (evm_gas_profiler_t *)tracer;
+  evm_gas_profiler_depth_t *const entry = &profiler->depths[frame->depth];
+  entry->start_gas = frame->gas;
+  entry->child_gas = 0;
+  entry->pending = false;
+}
+
+static void profiler_call_exit(evm_tracer_t *const tracer, const call_frame_t *const frame,
+                               const frame_result_t *const result) {
+  const auto profiler = (evm_gas_profiler_t *)tracer;
+  const uint64_t gas_left = evm_tracer_exit_gas(frame, result);
+  profiler_settle(profiler, frame->depth, gas_left);
+
+  // The caller's pending CALL is charged only what the child did not use
+  if (frame->depth > 0) {
+    evm_gas_profiler_depth_t *const parent = &profiler->depths[frame->depth - 1];
+    const uint64_t start_gas = profiler->depths[frame->depth].start_gas;
+    parent->child_gas += start_gas > gas_left ? start_gas - gas_left : 0;
+  }
+}
+
+static const evm_tracer_vtable_t GAS_PROFILER_VTABLE = {
+    .step = profiler_step,
+    .call_enter = profiler_call_enter,
+    .call_exit = profiler_call_exit,
+    .storage_access = nullptr,
+};
+
+bool evm_gas_profiler_init(evm_gas_profiler_t *const profiler, div0_arena_t *const arena) {
+  __builtin___memset_chk(profiler, 0, sizeof(*profiler), __builtin_object_size(profiler, 0));
+  profiler->base.vtable = &GAS_PROFILER_VTABLE;
+  profiler->depths =
+      div0_arena_alloc_array(arena, EVM_MAX_CALL_DEPTH, sizeof(evm_gas_profiler_depth_t),
+                             alignof(evm_gas_profiler_depth_t));
+  if (profiler->depths == nullptr) {
+    return false;
+  }
+  const size_t size = EVM_MAX_CALL_DEPTH * sizeof(evm_gas_profiler_depth_t);
+  __builtin___memset_chk(profiler->depths, 0, size, size);
+  return true;
+}
@@ -0,0 +1,187 @@
+#include "div0/evm/transient_storage.h"
+
+#include <stdalign.h>
+#include <string.h>
+
+// Initial number of table slots (power of two)
+static constexpr size_t TRANSIENT_INITIAL_CAPACITY = 64;
+
+// Initial number of journal entries
+static constexpr size_t TRANSIENT_INITIAL_JOURNAL = 64;
+
+// Key mixing multiplier (MurmurHash3 finalizer constant)
+static constexpr uint64_t KEY_MUL = 0xff51afd7ed558ccdULL;
+
+/// Hash of an (address, slot) key. Slots are usually small integers or
+/// keccak outputs, so every limb is folded in.
+static uint64_t key_hash(const address_t *const addr, const uint256_t *const slot) {
+  uint64_t a0;
+  uint64_t a1;
+  uint32_t a2;
+  // NOLINTBEGIN(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(&a0, addr->bytes, sizeof(a0));
+  memcpy(&a1, addr->bytes + 8, sizeof(a1));
+  memcpy(&a2, addr->bytes + 16, sizeof(a2));
+  // NOLINTEND(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  uint64_t h = a0 ^ (a1 * KEY_MUL) ^ a2;
+  for (size_t i = 0; i < 4; i++) {
+    h = (h ^ slot->limbs[i]) * KEY_MUL;
+    h ^= h >> 32;
+  }
+  return h;
+}
+
+static inline bool entry_matches(const transient_storage_entry_t *const entry,
+                                 const uint32_t generation, const address_t *const addr,
+                                 const uint256_t *const slot) {
+  return entry->generation == generation && uint256_eq(entry->slot, *slot) &&
+         address_equal(&entry->address, addr);
+}
+
+/// Slot holding the key, or the free slot where it would be inserted.
+/// The table must have at least one free slot.
+static transient_storage_entry_t *probe(const transient_storage_t *const ts,
+                                        const address_t *const addr, const uint256_t *const slot) {
+  const size_t mask = ts->capacity - 1;
+  size_t i = (size_t)key_hash(addr, slot) & mask;
+  while (true) {
+    transient_storage_entry_t *const entry = &ts->entries[i];
+    if (entry->generation != ts->generation || entry_matches(entry, ts->generation, addr, slot)) {
+      return entry;
+    }
+    i = (i + 1) & mask;
+  }
+}
+
+static transient_storage_entry_t *alloc_entries(div0_arena_t *const arena, const size_t capacity) {
+  transient_storage_entry_t *const entries =
+      div0_arena_alloc_array(arena, capacity, sizeof(transient_storage_entry_t),
+                             alignof(transient_storage_entry_t));
+  if (entries != nullptr) {
+    // Generation 0 is never current, so zeroed entries are free
+    __builtin___memset_chk(entries, 0, capacity * sizeof(transient_storage_entry_t),
+                           capacity * sizeof(transient_storage_entry_t));
+  }
+  return entries;
+}
+
+/// Move the current generation's entries into a table of twice the size.
+/// The old table stays in the arena until it is reset.
+static bool grow(transient_storage_t *const ts) {
+  const size_t capacity = ts->capacity == 0 ? TRANSIENT_INITIAL_CAPACITY : ts->capacity * 2;
+  transient_storage_entry_t *const entries = alloc_entries(ts->arena, capacity);
+  if (entries == nullptr) {
+    return false;
+  }
+  const transient_storage_entry_t *const old = ts->entries;
+  const size_t old_capacity = ts->capacity;
+  ts->entries = entries;
+  ts->capacity = capacity;
+  for (size_t i = 0; i < old_capacity; i++) {
+    if (old[i].generation == ts->generation) {
+      *probe(ts, &old[i].address, &old[i].slot) = old[i];
+    }
+  }
+  return true;
+}
+
+static bool reserve_journal(transient_storage_t *const ts) {
+  if (ts->journal_size < ts->journal_capacity) {
+    return true;
+  }
+  const size_t capacity =
+      ts->journal_capacity == 0 ? TRANSIENT_INITIAL_JOURNAL : ts->journal_capacity * 2;
+  transient_storage_journal_t *const journal =
+      div0_arena_alloc_array(ts->arena, capacity, sizeof(transient_storage_journal_t),
+                             alignof(transient_storage_journal_t));
+  if (journal == nullptr) {
+    return false;
+  }
+  if (ts->journal_size > 0) {
+    __builtin___memcpy_chk(journal, ts->journal,
+                           ts->journal_size * sizeof(transient_storage_journal_t),
+                           capacity * sizeof(transient_storage_journal_t));
+  }
+  ts->journal = journal;
+  ts->journal_capacity = capacity;
+  return true;
+}
+
+void transient_storage_init(transient_storage_t *const ts, div0_arena_t *const arena) {
+  ts->entries = nullptr;
+  ts->capacity = 0;
+  ts->count = 0;
+  ts->generation = 1;
+  ts->journal = nullptr;
+  ts->journal_size = 0;
+  ts->journal_capacity = 0;
+  ts->arena = arena;
+}
+
+void transient_storage_clear(transient_storage_t *const ts) {
+  ts->count = 0;
+  ts->journal_size = 0;
+  if (++ts->generation == 0) {
+    // Wrapped: entries from 2^32 transactions ago would look current again
+    if (ts->entries != nullptr) {
+      __builtin___memset_chk(ts->entries, 0, ts->capacity * sizeof(transient_storage_entry_t),
+                             ts->capacity * sizeof(transient_storage_entry_t));
+    }
+    ts->generation = 1;
+  }
+}
+
+uint256_t transient_storage_get(const transient_storage_t *const ts, const address_t *const addr,
+                                const uint256_t slot) {
+  if (ts->count == 0) {
+    return uint256_zero();
+  }
+  const transient_storage_entry_t *const entry = probe(ts, addr, &slot);
+  return entry->generation == ts->generation ? entry->value : uint256_zero();
+}
+
+bool transient_storage_set(transient_storage_t *const ts, const address_t *const addr,
+                           const uint256_t slot, const uint256_t value) {
+  if (ts->entries == nullptr && !grow(ts)) {
+    return false;
+  }
+  transient_storage_entry_t *entry = probe(ts, addr, &slot);
+  const bool present = entry->generation == ts->generation;
+  const uint256_t previous = present ? entry->value : uint256_zero();
+  if (uint256_eq(previous, value)) {
+    return true; // Nothing to change or undo
+  }
+
+  if (!reserve_journal(ts)) {
+    return false;
+  }
+  if (!present) {
+    // Keep the load factor at or below 3/4
+    if ((ts->count + 1) * 4 > ts->capacity * 3) {
+      if (!grow(ts)) {
+        return false;
+      }
+      entry = probe(ts, addr, &slot);
+    }
+    entry->address = *addr;
+    entry->generation = ts->generation;
+    entry->slot = slot;
+    ts->count++;
+  }
+  entry->value = value;
+
+  ts->journal[ts->journal_size++] = (transient_storage_journal_t){
+      .address = *addr,
+      .slot = slot,
+      .previous = previous,
+  };
+  return true;
+}
+
+void transient_storage_revert(transient_storage_t *const ts, const size_t checkpoint) {
+  // Written slots stay in the table; restoring zero makes them read as unset
+  while (ts->journal_size > checkpoint) {
+    const transient_storage_journal_t *const undo = &ts->journal[--ts->journal_size];
+    probe(ts, &undo->address, &undo->slot)->value = undo->previous;
+  }
+}
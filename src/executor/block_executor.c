@@ -3,8 +3,10 @@
 #include "div0/ethereum/transaction/access_list.h"
 #include "div0/ethereum/transaction/rlp.h"
 #include "div0/evm/execution_env.h"
+#include "div0/evm/precompiles.h"
 #include "div0/types/address.h"
 
+#include <stdalign.h>
 #include <stdint.h>
 
 void block_executor_init(block_executor_t *const exec, state_access_t *const state,
@@ -16,6 +18,17 @@ void block_executor_init(block_executor_t *const exec, state_access_t *const sta
   exec->arena = arena;
   exec->chain_id = chain_id;
   exec->skip_signature_validation = false;
+  exec->rewind_evm_arena = false;
+}
+
+/// Warm the fork's precompile addresses (EIP-2929).
+static void warm_precompiles(state_access_t *const state, const fork_t fork) {
+  const uint8_t count = precompile_count(fork);
+  address_t addr = address_zero();
+  for (uint8_t i = 1; i <= count; i++) {
+    addr.bytes[ADDRESS_SIZE - 1] = i;
+    (void)state_warm_address(state, &addr);
+  }
 }
 
 /// Warm access list addresses and storage slots (EIP-2930).
@@ -58,8 +71,10 @@ static bool execute_transaction(const block_executor_t *const exec, const block_
                                 uint64_t *const cumulative_gas, exec_receipt_t *const receipt) {
   const transaction_t *const tx = btx->tx;
 
-  // Set transaction metadata in receipt
+  // Set transaction metadata in receipt (unless memoised, the RLP encoding is scratch)
+  const div0_arena_mark_t encode_mark = div0_arena_mark(exec->arena);
   receipt->tx_hash = transaction_hash(tx, exec->arena);
+  div0_arena_rewind(exec->arena, encode_mark);
   receipt->tx_type = (uint8_t)tx->type;
 
   // Get transaction parameters
@@ -93,6 +108,7 @@ static bool execute_transaction(const block_executor_t *const exec, const block_
   } else if (to) {
     (void)state_warm_address(exec->state, to);
   }
+  warm_precompiles(exec->state, exec->evm->fork);
 
   // 5. Warm access list addresses/slots (EIP-2930)
   warm_access_list(exec->state, transaction_access_list(tx));
@@ -145,9 +161,13 @@ static bool execute_transaction(const block_executor_t *const exec, const block_
     // Message call
     // NOLINTNEXTLINE(CppDFANullDereference) - guarded by if (to != nullptr)
     env.call.address = *to;
-    const bytes_t code = state_get_code(exec->state, to);
-    env.call.code = code.data;
-    env.call.code_size = code.size;
+    // The recipient is warm already; the hash lets the jumpdest analysis be cached
+    state_account_view_t recipient;
+    (void)state_account_access(exec->state, to, STATE_ACCOUNT_INFO | STATE_ACCOUNT_CODE,
+                               &recipient);
+    env.call.code = recipient.code.data;
+    env.call.code_size = recipient.code.size;
+    env.call.code_hash = recipient.code_hash;
     env.call.input = data ? data->data : nullptr;
     env.call.input_size = data ? data->size : 0;
   } else {
@@ -245,8 +265,10 @@ bool block_executor_run(const block_executor_t *const exec, const block_tx_t *co
     return false;
   }
   // NOLINTEND(CppDFAConstantConditions)
-  result->receipts = div0_arena_alloc(exec->arena, tx_count * sizeof(exec_receipt_t));
-  result->rejected = div0_arena_alloc(exec->arena, tx_count * sizeof(exec_rejected_t));
+  result->receipts = div0_arena_alloc_array(exec->arena, tx_count, sizeof(exec_receipt_t),
+                                            alignof(exec_receipt_t));
+  result->rejected = div0_arena_alloc_array(exec->arena, tx_count, sizeof(exec_rejected_t),
+                                            alignof(exec_rejected_t));
   if (!result->receipts || !result->rejected) {
     return false;
   }
@@ -262,6 +284,9 @@ bool block_executor_run(const block_executor_t *const exec, const block_tx_t *co
 
     // Validate transaction
     const tx_validation_error_t err = block_executor_validate_tx(exec, btx, cumulative_gas);
+    if (state_is_unavailable(exec->state)) {
+      return false;
+    }
     if (err != TX_VALID) {
       // Add to rejected list
       exec_rejected_t *rej = &result->rejected[result->rejected_count++];
@@ -275,7 +300,14 @@ bool block_executor_run(const block_executor_t *const exec, const block_tx_t *co
     exec_receipt_t *receipt = &result->receipts[result->receipt_count];
     __builtin___memset_chk(receipt, 0, sizeof(*receipt), sizeof(*receipt));
 
-    if (!execute_transaction(exec, btx, &cumulative_gas, receipt)) {
+    // Stacks, frame memory, return data and the like only live until the
+    // receipt and the state writes are in place
+    const div0_arena_mark_t evm_mark = div0_arena_mark(exec->evm->arena);
+    const bool executed = execute_transaction(exec, btx, &cumulative_gas, receipt);
+    if (exec->rewind_evm_arena) {
+      evm_rewind(exec->evm, evm_mark);
+    }
+    if (!executed) {
       // Fatal error during execution (balance deduction failed unexpectedly)
       exec_rejected_t *rej = &result->rejected[result->rejected_count++];
       rej->index = btx->original_index;
@@ -286,6 +318,12 @@ bool block_executor_run(const block_executor_t *const exec, const block_tx_t *co
 
     result->receipt_count++;
 
+    // A read needed state missing from a partial (witness) state: the block
+    // cannot be executed, and the receipts so far do not describe it
+    if (state_is_unavailable(exec->state)) {
+      return false;
+    }
+
     // Track blob gas (saturating add to prevent overflow)
     const uint64_t tx_blob_gas = get_blob_gas(btx->tx);
     if (blob_gas_used <= UINT64_MAX - tx_blob_gas) {
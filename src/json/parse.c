@@ -125,6 +125,10 @@ int64_t json_get_i64(yyjson_val_t *val) {
   return yyjson_get_sint(val);
 }
 
+double json_get_f64(yyjson_val_t *val) {
+  return yyjson_get_num(val);
+}
+
 // ============================================================================
 // Hex-Encoded Value Parsing (from fields)
 // ============================================================================
@@ -170,8 +174,10 @@ bool json_get_hex_bytes(yyjson_val_t *obj, const char *key, div0_arena_t *arena,
   if (val == nullptr || !yyjson_is_str(val)) {
     return false;
   }
+  // yyjson knows the length; only the prefix needs inspecting
   const char *const str = yyjson_get_str(val);
-  const size_t hex_len = hex_strlen(str);
+  const char *const digits = hex_skip_prefix(str);
+  const size_t hex_len = yyjson_get_len(val) - (size_t)(digits - str);
 
   // Empty bytes
   if (hex_len == 0) {
@@ -185,13 +191,14 @@ bool json_get_hex_bytes(yyjson_val_t *obj, const char *key, div0_arena_t *arena,
     return false;
   }
 
+  // Code and calldata can exceed the arena block size
   const size_t byte_len = hex_len / 2;
-  uint8_t *const data = div0_arena_alloc(arena, byte_len);
+  uint8_t *const data = div0_arena_alloc_array(arena, byte_len, 1, 1);
   if (data == nullptr) {
     return false;
   }
 
-  if (!hex_decode(str, data, byte_len)) {
+  if (!hex_decode_digits(digits, data, byte_len)) {
     return false;
   }
 
@@ -240,8 +247,10 @@ bool json_val_hex_bytes(yyjson_val_t *val, div0_arena_t *arena, bytes_t *out) {
   if (val == nullptr || !yyjson_is_str(val)) {
     return false;
   }
+  // yyjson knows the length; only the prefix needs inspecting
   const char *const str = yyjson_get_str(val);
-  const size_t hex_len = hex_strlen(str);
+  const char *const digits = hex_skip_prefix(str);
+  const size_t hex_len = yyjson_get_len(val) - (size_t)(digits - str);
 
   // Empty bytes
   if (hex_len == 0) {
@@ -255,13 +264,14 @@ bool json_val_hex_bytes(yyjson_val_t *val, div0_arena_t *arena, bytes_t *out) {
     return false;
   }
 
+  // Code and calldata can exceed the arena block size
   const size_t byte_len = hex_len / 2;
-  uint8_t *const data = div0_arena_alloc(arena, byte_len);
+  uint8_t *const data = div0_arena_alloc_array(arena, byte_len, 1, 1);
   if (data == nullptr) {
     return false;
   }
 
-  if (!hex_decode(str, data, byte_len)) {
+  if (!hex_decode_digits(digits, data, byte_len)) {
     return false;
   }
 
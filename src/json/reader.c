@@ -0,0 +1,442 @@
+#include "div0/json/reader.h"
+
+#ifndef DIV0_FREESTANDING
+
+#include "div0/util/hex.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Longest hex string a fixed-size value can have: "0x" + 64 digits
+static constexpr size_t HEX_VALUE_MAX = 66;
+
+// ============================================================================
+// Scanning Helpers
+// ============================================================================
+
+static bool reader_fail(json_reader_t *const r, const char *const msg) {
+  if (r->error == nullptr) {
+    r->error = msg;
+    r->error_at = (size_t)(r->pos - r->start);
+  }
+  return false;
+}
+
+static inline bool is_ws(const char c) {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static inline void skip_ws(json_reader_t *const r) {
+  const char *p = r->pos;
+  while (p < r->end && is_ws(*p)) {
+    p++;
+  }
+  r->pos = p;
+}
+
+/// Find the closing quote of a string whose content starts at p.
+/// @return Pointer to the closing quote, or nullptr if unterminated
+static const char *string_end(const char *const p, const char *const end) {
+  const char *from = p;
+  for (;;) {
+    const char *const q = memchr(from, '"', (size_t)(end - from));
+    if (q == nullptr) {
+      return nullptr;
+    }
+    // The quote is escaped if an odd number of backslashes precede it
+    size_t backslashes = 0;
+    while (q - backslashes > p && q[-(ptrdiff_t)backslashes - 1] == '\\') {
+      backslashes++;
+    }
+    if (backslashes % 2 == 0) {
+      return q;
+    }
+    from = q + 1;
+  }
+}
+
+/// Scan the container starting at p ('{' or '[').
+/// @param count Output member count (optional)
+/// @return Pointer past the closing bracket, or nullptr if unbalanced
+static const char *container_end(const char *p, const char *const end, size_t *const count) {
+  size_t depth = 0;
+  size_t commas = 0;
+  bool any = false;
+  for (; p < end; p++) {
+    const char c = *p;
+    if (c == '"') {
+      p = string_end(p + 1, end);
+      if (p == nullptr) {
+        return nullptr;
+      }
+      any = true;
+    } else if (c == '{' || c == '[') {
+      any = any || depth > 0;
+      depth++;
+    } else if (c == '}' || c == ']') {
+      depth--;
+      if (depth == 0) {
+        if (count != nullptr) {
+          *count = any ? commas + 1 : 0;
+        }
+        return p + 1;
+      }
+    } else if (depth == 1 && c == ',') {
+      commas++;
+    } else if (!is_ws(c)) {
+      any = true;
+    }
+  }
+  return nullptr;
+}
+
+static inline bool is_num_char(const char c) {
+  return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+static bool match_literal(json_reader_t *const r, const char *const lit, const size_t len) {
+  if ((size_t)(r->end - r->pos) < len || memcmp(r->pos, lit, len) != 0) {
+    return reader_fail(r, "invalid literal");
+  }
+  r->pos += len;
+  return true;
+}
+
+// ============================================================================
+// Reader State
+// ============================================================================
+
+void json_reader_init(json_reader_t *const r, const char *const data, const size_t len) {
+  r->pos = data;
+  r->end = data + len;
+  r->start = data;
+  r->error = nullptr;
+  r->error_at = 0;
+  r->first = true;
+}
+
+json_result_t json_reader_result(const json_reader_t *const r) {
+  return r->error == nullptr ? json_ok() : json_err(JSON_ERR_PARSE, r->error);
+}
+
+json_result_t json_reader_finish(json_reader_t *const r) {
+  if (json_reader_ok(r)) {
+    skip_ws(r);
+    if (r->pos != r->end) {
+      reader_fail(r, "unexpected data after JSON value");
+    }
+  }
+  return json_reader_result(r);
+}
+
+json_token_t json_reader_peek(json_reader_t *const r) {
+  if (!json_reader_ok(r)) {
+    return JSON_TOKEN_NONE;
+  }
+  skip_ws(r);
+  if (r->pos >= r->end) {
+    return JSON_TOKEN_NONE;
+  }
+  switch (*r->pos) {
+  case '{':
+    return JSON_TOKEN_OBJ;
+  case '[':
+    return JSON_TOKEN_ARR;
+  case '"':
+    return JSON_TOKEN_STR;
+  case 't':
+  case 'f':
+    return JSON_TOKEN_BOOL;
+  case 'n':
+    return JSON_TOKEN_NULL;
+  case '-':
+  case '0':
+  case '1':
+  case '2':
+  case '3':
+  case '4':
+  case '5':
+  case '6':
+  case '7':
+  case '8':
+  case '9':
+    return JSON_TOKEN_NUM;
+  default:
+    return JSON_TOKEN_NONE;
+  }
+}
+
+size_t json_reader_count(json_reader_t *const r) {
+  const json_token_t token = json_reader_peek(r);
+  if (token != JSON_TOKEN_OBJ && token != JSON_TOKEN_ARR) {
+    return 0;
+  }
+  size_t count = 0;
+  return container_end(r->pos, r->end, &count) != nullptr ? count : 0;
+}
+
+// ============================================================================
+// Containers
+// ============================================================================
+
+static bool open_container(json_reader_t *const r, const json_token_t token,
+                           const char *const msg) {
+  if (json_reader_peek(r) != token) {
+    return reader_fail(r, msg);
+  }
+  r->pos++;
+  r->first = true;
+  return true;
+}
+
+/// Handle the separator before the next member.
+/// @return true if a member follows, false at the closing bracket or on error
+static bool next_member(json_reader_t *const r, const char close, const char *const msg) {
+  if (!json_reader_ok(r)) {
+    return false;
+  }
+  skip_ws(r);
+  if (r->pos < r->end && *r->pos == close) {
+    r->pos++;
+    r->first = false; // The parent now has this container as a member
+    return false;
+  }
+  if (!r->first) {
+    if (r->pos >= r->end || *r->pos != ',') {
+      return reader_fail(r, msg);
+    }
+    r->pos++;
+  }
+  r->first = false;
+  return true;
+}
+
+bool json_reader_obj_begin(json_reader_t *const r) {
+  return open_container(r, JSON_TOKEN_OBJ, "expected object");
+}
+
+bool json_reader_obj_next(json_reader_t *const r, const char **const key, size_t *const key_len) {
+  if (!next_member(r, '}', "expected ',' or '}'")) {
+    return false;
+  }
+  if (!json_reader_str(r, key, key_len)) {
+    return false;
+  }
+  skip_ws(r);
+  if (r->pos >= r->end || *r->pos != ':') {
+    return reader_fail(r, "expected ':'");
+  }
+  r->pos++;
+  return true;
+}
+
+bool json_reader_arr_begin(json_reader_t *const r) {
+  return open_container(r, JSON_TOKEN_ARR, "expected array");
+}
+
+bool json_reader_arr_next(json_reader_t *const r) {
+  return next_member(r, ']', "expected ',' or ']'");
+}
+
+// ============================================================================
+// Values
+// ============================================================================
+
+bool json_reader_str(json_reader_t *const r, const char **const out, size_t *const len) {
+  if (json_reader_peek(r) != JSON_TOKEN_STR) {
+    return reader_fail(r, "expected string");
+  }
+  const char *const content = r->pos + 1;
+  const char *const quote = string_end(content, r->end);
+  if (quote == nullptr) {
+    return reader_fail(r, "unterminated string");
+  }
+  *out = content;
+  *len = (size_t)(quote - content);
+  r->pos = quote + 1;
+  return true;
+}
+
+bool json_reader_null(json_reader_t *const r) {
+  if (json_reader_peek(r) != JSON_TOKEN_NULL) {
+    return false;
+  }
+  return match_literal(r, "null", 4);
+}
+
+bool json_reader_skip(json_reader_t *const r) {
+  const char *str;
+  size_t len;
+  switch (json_reader_peek(r)) {
+  case JSON_TOKEN_OBJ:
+  case JSON_TOKEN_ARR: {
+    const char *const after = container_end(r->pos, r->end, nullptr);
+    if (after == nullptr) {
+      return reader_fail(r, "unterminated container");
+    }
+    r->pos = after;
+    return true;
+  }
+  case JSON_TOKEN_STR:
+    return json_reader_str(r, &str, &len);
+  case JSON_TOKEN_NUM:
+    while (r->pos < r->end && is_num_char(*r->pos)) {
+      r->pos++;
+    }
+    return true;
+  case JSON_TOKEN_BOOL:
+    return *r->pos == 't' ? match_literal(r, "true", 4) : match_literal(r, "false", 5);
+  case JSON_TOKEN_NULL:
+    return match_literal(r, "null", 4);
+  case JSON_TOKEN_NONE:
+    break;
+  }
+  return json_reader_ok(r) ? reader_fail(r, "expected value") : false;
+}
+
+// ============================================================================
+// Hex-Encoded Values
+// ============================================================================
+
+bool json_reader_copy_str(const char *const str, const size_t len, char *const buf,
+                          const size_t buf_size) {
+  if (len >= buf_size) {
+    return false;
+  }
+  __builtin___memcpy_chk(buf, str, len, buf_size);
+  buf[len] = '\0';
+  return true;
+}
+
+/// Read a string value into a terminated buffer for the hex decoders.
+/// Values that are not strings are skipped.
+static bool read_hex_value(json_reader_t *const r, char *const buf, const size_t buf_size) {
+  if (json_reader_peek(r) != JSON_TOKEN_STR) {
+    (void)json_reader_skip(r);
+    return false;
+  }
+  const char *str;
+  size_t len;
+  return json_reader_str(r, &str, &len) && json_reader_copy_str(str, len, buf, buf_size);
+}
+
+bool json_reader_hex_u64(json_reader_t *const r, uint64_t *const out) {
+  char buf[HEX_VALUE_MAX + 1];
+  return read_hex_value(r, buf, sizeof(buf)) && hex_decode_u64(buf, out);
+}
+
+bool json_reader_hex_uint256(json_reader_t *const r, uint256_t *const out) {
+  char buf[HEX_VALUE_MAX + 1];
+  return read_hex_value(r, buf, sizeof(buf)) && hex_decode_uint256(buf, out);
+}
+
+bool json_reader_hex_address(json_reader_t *const r, address_t *const out) {
+  char buf[HEX_VALUE_MAX + 1];
+  return read_hex_value(r, buf, sizeof(buf)) && hex_decode(buf, out->bytes, ADDRESS_SIZE);
+}
+
+bool json_reader_hex_hash(json_reader_t *const r, hash_t *const out) {
+  char buf[HEX_VALUE_MAX + 1];
+  return read_hex_value(r, buf, sizeof(buf)) && hex_decode(buf, out->bytes, HASH_SIZE);
+}
+
+bool json_reader_hex_bytes(json_reader_t *const r, div0_arena_t *const arena,
+                           bytes_t *const out) {
+  if (json_reader_peek(r) != JSON_TOKEN_STR) {
+    (void)json_reader_skip(r);
+    return false;
+  }
+  const char *str;
+  size_t len;
+  if (!json_reader_str(r, &str, &len)) {
+    return false;
+  }
+
+  // Decoded straight from the input buffer
+  size_t prefix = 0;
+  if (len >= 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X')) {
+    prefix = 2;
+  }
+  const size_t hex_len = len - prefix;
+
+  // Empty bytes
+  if (hex_len == 0) {
+    out->data = nullptr;
+    out->size = 0;
+    return true;
+  }
+
+  // Must have even number of hex chars
+  if (hex_len % 2 != 0) {
+    return false;
+  }
+
+  // Code and calldata can exceed the arena block size
+  const size_t byte_len = hex_len / 2;
+  uint8_t *const data = div0_arena_alloc_array(arena, byte_len, 1, 1);
+  if (data == nullptr) {
+    return false;
+  }
+
+  if (!hex_decode_digits(str + prefix, data, byte_len)) {
+    return false;
+  }
+
+  out->data = data;
+  out->size = byte_len;
+  return true;
+}
+
+// ============================================================================
+// Mapped Input Files
+// ============================================================================
+
+json_result_t json_file_map_fd(const int fd, json_file_t *const file) {
+  file->data = nullptr;
+  file->size = 0;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || lseek(fd, 0, SEEK_CUR) != 0) {
+    return json_err(JSON_ERR_IO, "not a regular file at offset 0");
+  }
+  if (st.st_size == 0) {
+    return json_ok();
+  }
+
+  const size_t size = (size_t)st.st_size;
+  void *const data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (data == MAP_FAILED) {
+    return json_err(JSON_ERR_IO, "failed to map file");
+  }
+  // The reader walks the file front to back
+  (void)madvise(data, size, MADV_SEQUENTIAL);
+
+  file->data = data;
+  file->size = size;
+  return json_ok();
+}
+
+json_result_t json_file_map(const char *const path, json_file_t *const file) {
+  file->data = nullptr;
+  file->size = 0;
+
+  const int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return json_err(JSON_ERR_IO, "failed to open file");
+  }
+  const json_result_t result = json_file_map_fd(fd, file);
+  close(fd);
+  return result;
+}
+
+void json_file_unmap(json_file_t *const file) {
+  if (file->data != nullptr) {
+    munmap((void *)file->data, file->size);
+  }
+  file->data = nullptr;
+  file->size = 0;
+}
+
+#endif // DIV0_FREESTANDING
@@ -0,0 +1,293 @@
+#include "div0/json/stream.h"
+
+#ifndef DIV0_FREESTANDING
+
+#include "div0/util/hex.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Output buffer size; flushed to the FILE* when full
+static constexpr size_t STREAM_BUFFER_SIZE = 64 * 1024;
+
+// Spaces per nesting level in pretty output (matches yyjson)
+static constexpr size_t INDENT_WIDTH = 4;
+
+// Longest fixed-size item written without a capacity check in between:
+// indentation for the deepest level plus a quoted 64-digit hex value
+static constexpr size_t MAX_FIXED_ITEM = (JSON_STREAM_MAX_DEPTH * INDENT_WIDTH) + 72;
+
+static_assert(STREAM_BUFFER_SIZE >= 2 * MAX_FIXED_ITEM, "stream buffer too small");
+
+// ============================================================================
+// Buffer Management
+// ============================================================================
+
+static void stream_flush(json_stream_t *const s) {
+  if (s->len > 0 && !s->failed) {
+    if (fwrite(s->buf, 1, s->len, s->fp) != s->len) {
+      s->failed = true;
+    }
+  }
+  s->len = 0;
+}
+
+/// Make room for n bytes (n <= MAX_FIXED_ITEM).
+static inline char *stream_reserve(json_stream_t *const s, const size_t n) {
+  if (s->len + n > s->cap) {
+    stream_flush(s);
+  }
+  return s->buf + s->len;
+}
+
+static inline void stream_put(json_stream_t *const s, const char c) {
+  *stream_reserve(s, 1) = c;
+  s->len++;
+}
+
+/// Separator and indentation before a value or key.
+static void stream_begin_item(json_stream_t *const s) {
+  if (s->after_key) {
+    s->after_key = false;
+    return;
+  }
+  if (s->depth == 0) {
+    return;
+  }
+  const uint64_t bit = 1ULL << s->depth;
+  const bool first = (s->nonempty & bit) == 0;
+  s->nonempty |= bit;
+
+  const size_t indent = s->pretty ? s->depth * INDENT_WIDTH : 0;
+  char *p = stream_reserve(s, indent + 2);
+  if (!first) {
+    *p++ = ',';
+  }
+  if (s->pretty) {
+    *p++ = '\n';
+    __builtin___memset_chk(p, ' ', indent, s->cap - (size_t)(p - s->buf));
+    p += indent;
+  }
+  s->len = (size_t)(p - s->buf);
+}
+
+static void stream_open(json_stream_t *const s, const char c) {
+  stream_begin_item(s);
+  if (s->depth >= JSON_STREAM_MAX_DEPTH) {
+    s->failed = true;
+    return;
+  }
+  stream_put(s, c);
+  s->depth++;
+  s->nonempty &= ~(1ULL << s->depth);
+}
+
+static void stream_close(json_stream_t *const s, const char c) {
+  if (s->depth == 0) {
+    s->failed = true;
+    return;
+  }
+  const bool empty = (s->nonempty & (1ULL << s->depth)) == 0;
+  s->depth--;
+  if (!empty && s->pretty) {
+    const size_t indent = s->depth * INDENT_WIDTH;
+    char *const p = stream_reserve(s, indent + 1);
+    p[0] = '\n';
+    __builtin___memset_chk(p + 1, ' ', indent, s->cap - s->len - 1);
+    s->len += indent + 1;
+  }
+  stream_put(s, c);
+}
+
+/// Write a quoted, escaped string (escaping matches yyjson's defaults).
+static void stream_quoted(json_stream_t *const s, const char *const str) {
+  stream_put(s, '"');
+  for (const unsigned char *p = (const unsigned char *)str; *p != '\0'; p++) {
+    const unsigned char c = *p;
+    char *const out = stream_reserve(s, 6);
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      out[0] = (char)c;
+      s->len++;
+      continue;
+    }
+    out[0] = '\\';
+    switch (c) {
+    case '"':
+    case '\\':
+      out[1] = (char)c;
+      break;
+    case '\b':
+      out[1] = 'b';
+      break;
+    case '\f':
+      out[1] = 'f';
+      break;
+    case '\n':
+      out[1] = 'n';
+      break;
+    case '\r':
+      out[1] = 'r';
+      break;
+    case '\t':
+      out[1] = 't';
+      break;
+    default: {
+      static const char digits[] = "0123456789ABCDEF";
+      out[1] = 'u';
+      out[2] = '0';
+      out[3] = '0';
+      out[4] = digits[c >> 4];
+      out[5] = digits[c & 0x0F];
+      s->len += 6;
+      continue;
+    }
+    }
+    s->len += 2;
+  }
+  stream_put(s, '"');
+}
+
+/// Start a quoted hex value: returns where the encoder writes "0x..." and its
+/// terminator (at most 67 bytes), directly in the output buffer.
+static char *stream_hex_begin(json_stream_t *const s) {
+  stream_begin_item(s);
+  char *const out = stream_reserve(s, 69);
+  out[0] = '"';
+  return out + 1;
+}
+
+/// Close the value started by stream_hex_begin, replacing the terminator.
+static void stream_hex_end(json_stream_t *const s, char *const hex) {
+  const size_t len = strlen(hex);
+  hex[len] = '"';
+  s->len += len + 2;
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+json_result_t json_stream_init(json_stream_t *const s, FILE *const fp,
+                               const json_write_flags_t flags) {
+  __builtin___memset_chk(s, 0, sizeof(*s), __builtin_object_size(s, 0));
+  s->buf = malloc(STREAM_BUFFER_SIZE);
+  if (s->buf == nullptr) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate stream buffer");
+  }
+  s->fp = fp;
+  s->cap = STREAM_BUFFER_SIZE;
+  s->pretty = (flags & JSON_WRITE_PRETTY) != 0;
+  return json_ok();
+}
+
+json_result_t json_stream_finish(json_stream_t *const s) {
+  stream_flush(s);
+  free(s->buf);
+  s->buf = nullptr;
+  s->cap = 0;
+  if (s->failed || s->depth != 0) {
+    return json_err(JSON_ERR_IO, "failed to write JSON stream");
+  }
+  return json_ok();
+}
+
+// ============================================================================
+// Structure
+// ============================================================================
+
+void json_stream_obj_begin(json_stream_t *const s) { stream_open(s, '{'); }
+
+void json_stream_obj_end(json_stream_t *const s) { stream_close(s, '}'); }
+
+void json_stream_arr_begin(json_stream_t *const s) { stream_open(s, '['); }
+
+void json_stream_arr_end(json_stream_t *const s) { stream_close(s, ']'); }
+
+void json_stream_key(json_stream_t *const s, const char *const key) {
+  stream_begin_item(s);
+  stream_quoted(s, key);
+  stream_put(s, ':');
+  if (s->pretty) {
+    stream_put(s, ' ');
+  }
+  s->after_key = true;
+}
+
+// ============================================================================
+// Values
+// ============================================================================
+
+void json_stream_str(json_stream_t *const s, const char *const str) {
+  stream_begin_item(s);
+  stream_quoted(s, str);
+}
+
+void json_stream_u64(json_stream_t *const s, uint64_t val) {
+  stream_begin_item(s);
+  char digits[20];
+  size_t count = 0;
+  do {
+    digits[count++] = (char)('0' + (val % 10));
+    val /= 10;
+  } while (val != 0);
+  char *const out = stream_reserve(s, count);
+  for (size_t i = 0; i < count; i++) {
+    out[i] = digits[count - 1 - i];
+  }
+  s->len += count;
+}
+
+void json_stream_hex_u64(json_stream_t *const s, const uint64_t val) {
+  char *const out = stream_hex_begin(s);
+  hex_encode_u64(val, out);
+  stream_hex_end(s, out);
+}
+
+void json_stream_hex_uint256(json_stream_t *const s, const uint256_t *const val) {
+  char *const out = stream_hex_begin(s);
+  hex_encode_uint256(val, out);
+  stream_hex_end(s, out);
+}
+
+void json_stream_hex_uint256_padded(json_stream_t *const s, const uint256_t *const val) {
+  char *const out = stream_hex_begin(s);
+  hex_encode_uint256_padded(val, out);
+  stream_hex_end(s, out);
+}
+
+void json_stream_hex_address(json_stream_t *const s, const address_t *const addr) {
+  char *const out = stream_hex_begin(s);
+  hex_encode(addr->bytes, ADDRESS_SIZE, out);
+  stream_hex_end(s, out);
+}
+
+void json_stream_hex_hash(json_stream_t *const s, const hash_t *const hash) {
+  char *const out = stream_hex_begin(s);
+  hex_encode(hash->bytes, HASH_SIZE, out);
+  stream_hex_end(s, out);
+}
+
+void json_stream_hex_bytes(json_stream_t *const s, const uint8_t *const data, const size_t len) {
+  stream_begin_item(s);
+  char *const prefix = stream_reserve(s, 3);
+  prefix[0] = '"';
+  prefix[1] = '0';
+  prefix[2] = 'x';
+  s->len += 3;
+
+  // Encode in chunks that fit the remaining buffer space
+  size_t done = 0;
+  while (done < len) {
+    if (s->cap - s->len < 2) {
+      stream_flush(s);
+    }
+    const size_t room = (s->cap - s->len) / 2;
+    const size_t chunk = len - done < room ? len - done : room;
+    hex_encode_digits(data + done, chunk, s->buf + s->len);
+    s->len += chunk * 2;
+    done += chunk;
+  }
+  stream_put(s, '"');
+}
+
+#endif // DIV0_FREESTANDING
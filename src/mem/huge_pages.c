@@ -0,0 +1,333 @@
+#include "div0/mem/huge_pages.h"
+
+#include <stdlib.h>
+#include <sys/mman.h>
+
+// Linux-only flags; elsewhere regions are plain anonymous mappings
+#ifndef MAP_HUGETLB
+#define MAP_HUGETLB 0
+#endif
+#ifndef MAP_POPULATE
+#define MAP_POPULATE 0
+#endif
+
+/// Size of the smallest carved block (cache line).
+static constexpr size_t MIN_CLASS_SIZE = (size_t)1 << DIV0_HUGE_PAGE_MIN_CLASS_SHIFT;
+
+/// Base page size used to pre-fault regions without MAP_POPULATE.
+static constexpr size_t BASE_PAGE_SIZE = 4096;
+
+static size_t round_up(const size_t size, const size_t alignment) {
+  return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/// Pre-fault a mapping that was not created with MAP_POPULATE.
+static void prefault(uint8_t *const base, const size_t size) {
+#ifdef MADV_POPULATE_WRITE
+  if (madvise(base, size, MADV_POPULATE_WRITE) == 0) {
+    return;
+  }
+#endif
+  for (size_t off = 0; off < size; off += BASE_PAGE_SIZE) {
+    base[off] = 0;
+  }
+}
+
+/// Map a 2MB-aligned anonymous region, preferring explicit huge pages.
+static uint8_t *map_aligned(div0_huge_page_provider_t *const provider, const size_t size) {
+  const int prot = PROT_READ | PROT_WRITE;
+  const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+  const int populate = provider->populate ? MAP_POPULATE : 0;
+
+  // Reserved huge pages (vm.nr_hugepages) are always 2MB-aligned
+  if (MAP_HUGETLB != 0) {
+    void *const ptr = mmap(nullptr, size, prot, flags | MAP_HUGETLB | populate, -1, 0);
+    if (ptr != MAP_FAILED) {
+      provider->hugetlb = true;
+      return ptr;
+    }
+  }
+  provider->hugetlb = false;
+
+  // Over-map by one huge page and trim to a 2MB boundary so THP can back it
+  if (size > SIZE_MAX - DIV0_HUGE_PAGE_SIZE) {
+    return nullptr;
+  }
+  void *const raw = mmap(nullptr, size + DIV0_HUGE_PAGE_SIZE, prot, flags, -1, 0);
+  if (raw == MAP_FAILED) {
+    return nullptr;
+  }
+  const uintptr_t start = (uintptr_t)raw;
+  const uintptr_t aligned = round_up(start, DIV0_HUGE_PAGE_SIZE);
+  const size_t head = aligned - start;
+  const size_t tail = DIV0_HUGE_PAGE_SIZE - head;
+  if (head > 0) {
+    (void)munmap(raw, head);
+  }
+  if (tail > 0) {
+    (void)munmap((uint8_t *)aligned + size, tail);
+  }
+
+  uint8_t *const base = (uint8_t *)aligned;
+#ifdef MADV_HUGEPAGE
+  (void)madvise(base, size, MADV_HUGEPAGE);
+#endif
+  if (provider->populate) {
+    prefault(base, size);
+  }
+  return base;
+}
+
+/// Map a region of size bytes (multiple of DIV0_HUGE_PAGE_SIZE) and track it.
+static div0_huge_region_t *map_region(div0_huge_page_provider_t *const provider,
+                                      const size_t size) {
+  div0_huge_region_t *const region = malloc(sizeof(div0_huge_region_t));
+  if (region == nullptr) {
+    return nullptr;
+  }
+  region->base = map_aligned(provider, size);
+  if (region->base == nullptr) {
+    free(region);
+    return nullptr;
+  }
+  region->size = size;
+  region->live = 0;
+  region->next = provider->regions;
+  provider->regions = region;
+  provider->mapped_size += size;
+  return region;
+}
+
+/// Unmap a region and stop tracking it.
+/// @param link Link pointing at the region in the region list
+static void drop_region(div0_huge_page_provider_t *const provider,
+                        div0_huge_region_t **const link) {
+  div0_huge_region_t *const region = *link;
+  if (region == provider->current) {
+    provider->current = nullptr;
+    provider->cursor = nullptr;
+    provider->remaining = 0;
+  }
+  *link = region->next;
+  provider->mapped_size -= region->size;
+  (void)munmap(region->base, region->size);
+  free(region);
+}
+
+/// Unmap the region starting at base and stop tracking it.
+static void unmap_region(div0_huge_page_provider_t *const provider, const uint8_t *const base) {
+  for (div0_huge_region_t **link = &provider->regions; *link != nullptr; link = &(*link)->next) {
+    if ((*link)->base == base) {
+      drop_region(provider, link);
+      return;
+    }
+  }
+}
+
+/// Find the region holding a carved block.
+static div0_huge_region_t *find_region(const div0_huge_page_provider_t *const provider,
+                                       const uint8_t *const ptr) {
+  for (div0_huge_region_t *region = provider->regions; region != nullptr; region = region->next) {
+    if (ptr >= region->base && ptr < region->base + region->size) {
+      return region;
+    }
+  }
+  return nullptr;
+}
+
+/// Make a fresh region the carve source.
+static bool start_region(div0_huge_page_provider_t *const provider, const size_t size) {
+  div0_huge_region_t *const region = map_region(provider, size);
+  if (region == nullptr) {
+    return false;
+  }
+  provider->current = region;
+  provider->cursor = region->base;
+  provider->remaining = region->size;
+  return true;
+}
+
+// =============================================================================
+// Size Classes
+// =============================================================================
+
+/// Smallest class whose blocks hold size bytes (size <= DIV0_HUGE_PAGE_SIZE).
+static size_t size_class(const size_t size) {
+  size_t cls = 0;
+  while ((MIN_CLASS_SIZE << cls) < size) {
+    cls++;
+  }
+  return cls;
+}
+
+static size_t class_size(const size_t cls) {
+  return MIN_CLASS_SIZE << cls;
+}
+
+static void push_free(div0_huge_page_provider_t *const provider, uint8_t *const ptr,
+                      const size_t cls) {
+  div0_huge_free_block_t *const block = (div0_huge_free_block_t *)ptr;
+  block->next = provider->free_lists[cls];
+  provider->free_lists[cls] = block;
+  provider->cached_size += class_size(cls);
+}
+
+/// Take a released block of class cls, splitting a larger one if needed.
+/// @return Block, or nullptr if no released block is large enough
+static uint8_t *take_free(div0_huge_page_provider_t *const provider, const size_t cls) {
+  for (size_t from = cls; from < DIV0_HUGE_PAGE_CLASS_COUNT; from++) {
+    div0_huge_free_block_t *const block = provider->free_lists[from];
+    if (block == nullptr) {
+      continue;
+    }
+    provider->free_lists[from] = block->next;
+    provider->cached_size -= class_size(from);
+    // Keep the front, release the upper halves: one block per class in between
+    uint8_t *const ptr = (uint8_t *)block;
+    while (from > cls) {
+      from--;
+      push_free(provider, ptr + class_size(from), from);
+    }
+    return ptr;
+  }
+  return nullptr;
+}
+
+/// Move what is left of the current region onto the free lists.
+static void retire_tail(div0_huge_page_provider_t *const provider) {
+  size_t cls = DIV0_HUGE_PAGE_CLASS_COUNT;
+  while (cls-- > 0) {
+    while (provider->remaining >= class_size(cls)) {
+      push_free(provider, provider->cursor, cls);
+      provider->cursor += class_size(cls);
+      provider->remaining -= class_size(cls);
+    }
+  }
+}
+
+/// Drop the cached blocks that lie inside a region.
+static void forget_blocks(div0_huge_page_provider_t *const provider,
+                          const div0_huge_region_t *const region) {
+  for (size_t cls = 0; cls < DIV0_HUGE_PAGE_CLASS_COUNT; cls++) {
+    div0_huge_free_block_t **link = &provider->free_lists[cls];
+    while (*link != nullptr) {
+      const uint8_t *const ptr = (const uint8_t *)*link;
+      if (ptr >= region->base && ptr < region->base + region->size) {
+        *link = (*link)->next;
+        provider->cached_size -= class_size(cls);
+      } else {
+        link = &(*link)->next;
+      }
+    }
+  }
+}
+
+/// Unmap regions with nothing handed out until the cache is back under its limit.
+static void trim_cache(div0_huge_page_provider_t *const provider) {
+  div0_huge_region_t **link = &provider->regions;
+  while (*link != nullptr && provider->cached_size > provider->cache_limit) {
+    if ((*link)->live != 0) {
+      link = &(*link)->next;
+      continue;
+    }
+    forget_blocks(provider, *link);
+    drop_region(provider, link);
+  }
+}
+
+// =============================================================================
+// Provider Interface
+// =============================================================================
+
+static void *huge_acquire(div0_arena_provider_t *const base, const size_t size) {
+  const auto provider = (div0_huge_page_provider_t *)base;
+  if (size > SIZE_MAX - DIV0_HUGE_PAGE_SIZE) {
+    return nullptr;
+  }
+
+  // Larger than a huge page: map it on its own
+  if (size > DIV0_HUGE_PAGE_SIZE) {
+    div0_huge_region_t *const region = map_region(provider, round_up(size, DIV0_HUGE_PAGE_SIZE));
+    if (region == nullptr) {
+      return nullptr;
+    }
+    region->live = region->size; // Never trimmed: released by unmapping
+    return region->base;
+  }
+
+  const size_t cls = size_class(size);
+  uint8_t *ptr = take_free(provider, cls);
+  if (ptr == nullptr) {
+    const size_t carved = class_size(cls);
+    if (carved > provider->remaining) {
+      retire_tail(provider);
+      if (!start_region(provider, DIV0_HUGE_PAGE_SIZE)) {
+        return nullptr;
+      }
+    }
+    ptr = provider->cursor;
+    provider->cursor += carved;
+    provider->remaining -= carved;
+  }
+  find_region(provider, ptr)->live += class_size(cls);
+  return ptr;
+}
+
+static void huge_release(div0_arena_provider_t *const base, void *const ptr, const size_t size) {
+  const auto provider = (div0_huge_page_provider_t *)base;
+  if (size > DIV0_HUGE_PAGE_SIZE) {
+    unmap_region(provider, ptr);
+    return;
+  }
+  const size_t cls = size_class(size);
+  find_region(provider, ptr)->live -= class_size(cls);
+  push_free(provider, ptr, cls);
+  if (provider->cached_size > provider->cache_limit) {
+    trim_cache(provider);
+  }
+}
+
+bool div0_huge_page_provider_init(div0_huge_page_provider_t *const provider, const size_t reserve,
+                                  const bool populate) {
+  provider->base.acquire = huge_acquire;
+  provider->base.release = huge_release;
+  provider->regions = nullptr;
+  provider->current = nullptr;
+  provider->cursor = nullptr;
+  provider->remaining = 0;
+  for (size_t cls = 0; cls < DIV0_HUGE_PAGE_CLASS_COUNT; cls++) {
+    provider->free_lists[cls] = nullptr;
+  }
+  provider->cached_size = 0;
+  provider->cache_limit = DIV0_HUGE_PAGE_CACHE_LIMIT;
+  provider->populate = populate;
+  provider->hugetlb = false;
+  provider->mapped_size = 0;
+
+  if (reserve == 0) {
+    return true;
+  }
+  if (reserve > SIZE_MAX - DIV0_HUGE_PAGE_SIZE) {
+    return false;
+  }
+  return start_region(provider, round_up(reserve, DIV0_HUGE_PAGE_SIZE));
+}
+
+void div0_huge_page_provider_destroy(div0_huge_page_provider_t *const provider) {
+  div0_huge_region_t *region = provider->regions;
+  while (region != nullptr) {
+    div0_huge_region_t *const next = region->next;
+    (void)munmap(region->base, region->size);
+    free(region);
+    region = next;
+  }
+  provider->regions = nullptr;
+  provider->current = nullptr;
+  provider->cursor = nullptr;
+  provider->remaining = 0;
+  for (size_t cls = 0; cls < DIV0_HUGE_PAGE_CLASS_COUNT; cls++) {
+    provider->free_lists[cls] = nullptr;
+  }
+  provider->cached_size = 0;
+  provider->mapped_size = 0;
+}
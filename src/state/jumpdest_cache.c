@@ -0,0 +1,106 @@
+#include "div0/state/jumpdest_cache.h"
+
+#include <stdalign.h>
+#include <string.h>
+
+// Initial number of slots (power of two)
+static constexpr size_t JUMPDEST_CACHE_INITIAL_CAPACITY = 256;
+
+/// Slot index for a code hash: the low bits of its first word.
+static size_t slot_index(const hash_t *const code_hash, const size_t capacity) {
+  uint64_t h;
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(&h, code_hash->bytes, sizeof(h));
+  return (size_t)h & (capacity - 1);
+}
+
+static jumpdest_cache_entry_t *alloc_entries(div0_arena_t *const arena, const size_t capacity) {
+  jumpdest_cache_entry_t *const entries = div0_arena_alloc_array(
+      arena, capacity, sizeof(jumpdest_cache_entry_t), alignof(jumpdest_cache_entry_t));
+  if (entries != nullptr) {
+    __builtin___memset_chk(entries, 0, capacity * sizeof(jumpdest_cache_entry_t),
+                           capacity * sizeof(jumpdest_cache_entry_t));
+  }
+  return entries;
+}
+
+/// Insert into a table known to have a free slot.
+static void insert_entry(jumpdest_cache_entry_t *const entries, const size_t capacity,
+                         const hash_t *const code_hash, const uint8_t *const bitmap) {
+  size_t i = slot_index(code_hash, capacity);
+  while (entries[i].bitmap != nullptr) {
+    i = (i + 1) & (capacity - 1);
+  }
+  entries[i].code_hash = *code_hash;
+  entries[i].bitmap = bitmap;
+}
+
+/// Double the table. The old table stays in the arena until it is destroyed.
+static bool grow(jumpdest_cache_t *const cache) {
+  const size_t capacity = cache->capacity * 2;
+  jumpdest_cache_entry_t *const entries = alloc_entries(cache->arena, capacity);
+  if (entries == nullptr) {
+    return false;
+  }
+  for (size_t i = 0; i < cache->capacity; i++) {
+    if (cache->entries[i].bitmap != nullptr) {
+      insert_entry(entries, capacity, &cache->entries[i].code_hash, cache->entries[i].bitmap);
+    }
+  }
+  cache->entries = entries;
+  cache->capacity = capacity;
+  cache->size += capacity * sizeof(jumpdest_cache_entry_t);
+  return true;
+}
+
+bool jumpdest_cache_init(jumpdest_cache_t *const cache, div0_arena_t *const arena) {
+  cache->arena = arena;
+  cache->count = 0;
+  cache->hits = 0;
+  cache->capacity = JUMPDEST_CACHE_INITIAL_CAPACITY;
+  cache->size = cache->capacity * sizeof(jumpdest_cache_entry_t);
+  cache->entries = alloc_entries(arena, cache->capacity);
+  return cache->entries != nullptr;
+}
+
+/// Bitmap stored for a code hash, or nullptr.
+static const uint8_t *find(const jumpdest_cache_t *const cache, const hash_t *const code_hash) {
+  size_t i = slot_index(code_hash, cache->capacity);
+  while (cache->entries[i].bitmap != nullptr) {
+    if (hash_equal(&cache->entries[i].code_hash, code_hash)) {
+      return cache->entries[i].bitmap;
+    }
+    i = (i + 1) & (cache->capacity - 1);
+  }
+  return nullptr;
+}
+
+const uint8_t *jumpdest_cache_get(jumpdest_cache_t *const cache, const hash_t *const code_hash) {
+  const uint8_t *const bitmap = find(cache, code_hash);
+  if (bitmap != nullptr) {
+    cache->hits++;
+  }
+  return bitmap;
+}
+
+bool jumpdest_cache_put(jumpdest_cache_t *const cache, const hash_t *const code_hash,
+                        const uint8_t *const bitmap, const size_t bitmap_size) {
+  if (find(cache, code_hash) != nullptr) {
+    return true;
+  }
+  // Keep the load factor at or below 3/4
+  if ((cache->count + 1) * 4 > cache->capacity * 3 && !grow(cache)) {
+    return false;
+  }
+
+  uint8_t *const copy = div0_arena_alloc_array(cache->arena, bitmap_size, 1, DIV0_ARENA_ALIGNMENT);
+  if (copy == nullptr) {
+    return false;
+  }
+  __builtin___memcpy_chk(copy, bitmap, bitmap_size, bitmap_size);
+
+  insert_entry(cache->entries, cache->capacity, code_hash, copy);
+  cache->count++;
+  cache->size += bitmap_size;
+  return true;
+}
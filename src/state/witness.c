@@ -0,0 +1,195 @@
+#include "div0/state/witness.h"
+
+#include <stdalign.h>
+#include <string.h>
+
+/// Format magic: "D0WT".
+static const uint8_t WITNESS_MAGIC[4] = {'D', '0', 'W', 'T'};
+
+/// Current format version.
+static constexpr uint8_t WITNESS_VERSION = 1;
+
+/// Maximum encoded size of a 64-bit LEB128 value.
+static constexpr size_t LEB128_MAX_SIZE = 10;
+
+// =============================================================================
+// Encoding
+// =============================================================================
+
+/// Append an unsigned LEB128 value.
+static bool append_uleb128(bytes_t *const out, uint64_t value) {
+  uint8_t buf[LEB128_MAX_SIZE];
+  size_t len = 0;
+  do {
+    uint8_t byte = value & 0x7F;
+    value >>= 7;
+    if (value != 0) {
+      byte |= 0x80;
+    }
+    buf[len++] = byte;
+  } while (value != 0);
+  return bytes_append(out, buf, len);
+}
+
+/// Append a length-prefixed blob.
+static bool append_blob(bytes_t *const out, const bytes_t *const blob) {
+  return append_uleb128(out, blob->size) && bytes_append(out, blob->data, blob->size);
+}
+
+bytes_t witness_encode(const witness_t *const witness, div0_arena_t *const arena) {
+  bytes_t out;
+  bytes_init_arena(&out, arena);
+
+  // Upper bound on the encoded size, so the buffer is allocated once
+  size_t estimate = sizeof(WITNESS_MAGIC) + 1 + HASH_SIZE + (3 * LEB128_MAX_SIZE);
+  for (size_t i = 0; i < witness->nodes.count; i++) {
+    estimate += LEB128_MAX_SIZE + witness->nodes.nodes[i].size;
+  }
+  for (size_t i = 0; i < witness->code_count; i++) {
+    estimate += LEB128_MAX_SIZE + witness->codes[i].size;
+  }
+  estimate += witness->address_count * ADDRESS_SIZE;
+
+  bool ok = bytes_reserve(&out, estimate) &&
+            bytes_append(&out, WITNESS_MAGIC, sizeof(WITNESS_MAGIC)) &&
+            bytes_append_byte(&out, WITNESS_VERSION) &&
+            bytes_append(&out, witness->pre_state_root.bytes, HASH_SIZE);
+
+  ok = ok && append_uleb128(&out, witness->nodes.count);
+  for (size_t i = 0; ok && i < witness->nodes.count; i++) {
+    ok = append_blob(&out, &witness->nodes.nodes[i]);
+  }
+
+  ok = ok && append_uleb128(&out, witness->code_count);
+  for (size_t i = 0; ok && i < witness->code_count; i++) {
+    ok = append_blob(&out, &witness->codes[i]);
+  }
+
+  ok = ok && append_uleb128(&out, witness->address_count);
+  for (size_t i = 0; ok && i < witness->address_count; i++) {
+    ok = bytes_append(&out, witness->addresses[i].bytes, ADDRESS_SIZE);
+  }
+
+  if (!ok) {
+    out.data = nullptr;
+    out.size = 0;
+  }
+  return out;
+}
+
+// =============================================================================
+// Decoding
+// =============================================================================
+
+/// Bounds-checked reader over the encoded witness.
+typedef struct {
+  const uint8_t *data;
+  size_t len;
+  size_t pos;
+} witness_reader_t;
+
+static bool read_uleb128(witness_reader_t *const reader, uint64_t *const out) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < LEB128_MAX_SIZE; i++) {
+    if (reader->pos >= reader->len) {
+      return false;
+    }
+    const uint8_t byte = reader->data[reader->pos++];
+    value |= (uint64_t)(byte & 0x7F) << (7 * i);
+    if ((byte & 0x80) == 0) {
+      *out = value;
+      return true;
+    }
+  }
+  return false;
+}
+
+/// Read a count and check that at least count * min_item_size bytes remain,
+/// which bounds the array allocation by the input size.
+static bool read_count(witness_reader_t *const reader, const size_t min_item_size,
+                       size_t *const out) {
+  uint64_t count;
+  if (!read_uleb128(reader, &count) || count > (reader->len - reader->pos) / min_item_size) {
+    return false;
+  }
+  *out = (size_t)count;
+  return true;
+}
+
+/// Read a length-prefixed blob as a view into the input.
+static bool read_blob(witness_reader_t *const reader, bytes_t *const out) {
+  uint64_t len;
+  if (!read_uleb128(reader, &len) || len > reader->len - reader->pos) {
+    return false;
+  }
+  out->data = (uint8_t *)(reader->data + reader->pos);
+  out->size = (size_t)len;
+  out->capacity = 0;
+  out->arena = nullptr;
+  reader->pos += (size_t)len;
+  return true;
+}
+
+/// Allocate an array of count blobs (nullptr when count == 0).
+static bytes_t *alloc_blobs(div0_arena_t *const arena, const size_t count) {
+  return count == 0 ? nullptr
+                    : div0_arena_alloc_array(arena, count, sizeof(bytes_t), alignof(bytes_t));
+}
+
+bool witness_decode(const uint8_t *const data, const size_t len, div0_arena_t *const arena,
+                    witness_t *const out) {
+  witness_reader_t reader = {.data = data, .len = len, .pos = 0};
+  const size_t header_size = sizeof(WITNESS_MAGIC) + 1 + HASH_SIZE;
+  if (data == nullptr || len < header_size ||
+      memcmp(data, WITNESS_MAGIC, sizeof(WITNESS_MAGIC)) != 0 ||
+      data[sizeof(WITNESS_MAGIC)] != WITNESS_VERSION) {
+    return false;
+  }
+  out->pre_state_root = hash_from_bytes(data + sizeof(WITNESS_MAGIC) + 1);
+  reader.pos = header_size;
+
+  // Every blob takes at least its one-byte length prefix
+  if (!read_count(&reader, 1, &out->nodes.count)) {
+    return false;
+  }
+  out->nodes.nodes = alloc_blobs(arena, out->nodes.count);
+  if (out->nodes.count > 0 && out->nodes.nodes == nullptr) {
+    return false;
+  }
+  for (size_t i = 0; i < out->nodes.count; i++) {
+    if (!read_blob(&reader, &out->nodes.nodes[i])) {
+      return false;
+    }
+  }
+
+  if (!read_count(&reader, 1, &out->code_count)) {
+    return false;
+  }
+  out->codes = alloc_blobs(arena, out->code_count);
+  if (out->code_count > 0 && out->codes == nullptr) {
+    return false;
+  }
+  for (size_t i = 0; i < out->code_count; i++) {
+    if (!read_blob(&reader, &out->codes[i])) {
+      return false;
+    }
+  }
+
+  if (!read_count(&reader, ADDRESS_SIZE, &out->address_count)) {
+    return false;
+  }
+  out->addresses = nullptr;
+  if (out->address_count > 0) {
+    out->addresses =
+        div0_arena_alloc_array(arena, out->address_count, sizeof(address_t), alignof(address_t));
+    if (out->addresses == nullptr) {
+      return false;
+    }
+    const size_t size = out->address_count * ADDRESS_SIZE;
+    // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+    memcpy(out->addresses, data + reader.pos, size);
+    reader.pos += size;
+  }
+
+  return reader.pos == len;
+}
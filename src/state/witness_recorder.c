@@ -0,0 +1,503 @@
+#include "div0/state/witness.h"
+
+#include "div0/crypto/keccak256.h"
+#include "div0/mem/stc_allocator.h"
+
+#include <stdalign.h>
+
+// =============================================================================
+// STC Container Definitions
+// =============================================================================
+
+// NOLINTBEGIN(readability-identifier-naming) - STC requires specific macro names
+
+/// Multiplier for mixing 64-bit words (golden ratio).
+#define WITNESS_HASH_MIX 0x9E3779B97F4A7C15ULL
+
+// FNV-1a hash constants
+#define FNV1A_OFFSET_BASIS 14695981039346656037ULL
+#define FNV1A_PRIME 1099511628211ULL
+
+/// FNV-1a over all 20 address bytes. Precompile and system addresses differ
+/// only in their trailing bytes, so a prefix alone would collide.
+static uint64_t witness_address_hash(const address_t *const addr) {
+  uint64_t hash = FNV1A_OFFSET_BASIS;
+  for (size_t i = 0; i < ADDRESS_SIZE; i++) {
+    hash ^= addr->bytes[i];
+    hash *= FNV1A_PRIME;
+  }
+  return hash;
+}
+
+/// Recorded storage access.
+typedef struct {
+  address_t addr;
+  uint256_t slot;
+} witness_slot_t;
+
+/// Slots are often small integers, so each limb is mixed in.
+static uint64_t witness_slot_hash(const witness_slot_t *const key) {
+  uint64_t hash = witness_address_hash(&key->addr);
+  for (size_t i = 0; i < 4; i++) {
+    hash = (hash ^ key->slot.limbs[i]) * WITNESS_HASH_MIX;
+  }
+  return hash;
+}
+
+static bool witness_slot_eq(const witness_slot_t *const a, const witness_slot_t *const b) {
+  return address_equal(&a->addr, &b->addr) && uint256_eq(a->slot, b->slot);
+}
+
+// Address set (accessed accounts, code reads)
+#define i_TYPE witness_addr_set, address_t
+#define i_hash(p) witness_address_hash(p)
+#define i_eq(a, b) address_equal(a, b)
+#include "stc/hset.h"
+
+// Storage slot set
+#define i_TYPE witness_slot_set, witness_slot_t
+#define i_hash(p) witness_slot_hash(p)
+#define i_eq(a, b) witness_slot_eq(a, b)
+#include "stc/hset.h"
+
+// NOLINTEND(readability-identifier-naming)
+
+// =============================================================================
+// Recording Helpers
+// =============================================================================
+
+static void record_address(const witness_recorder_t *const rec, const address_t *const addr) {
+  witness_addr_set_insert((witness_addr_set *)rec->addresses, *addr);
+}
+
+static void record_slot(const witness_recorder_t *const rec, const address_t *const addr,
+                        const uint256_t slot) {
+  record_address(rec, addr);
+  const witness_slot_t key = {.addr = *addr, .slot = slot};
+  witness_slot_set_insert((witness_slot_set *)rec->slots, key);
+}
+
+static void record_code(const witness_recorder_t *const rec, const address_t *const addr) {
+  record_address(rec, addr);
+  witness_addr_set_insert((witness_addr_set *)rec->code_addresses, *addr);
+}
+
+// =============================================================================
+// Vtable Function Implementations
+// =============================================================================
+
+static bool rec_account_exists(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  return rec->inner->vtable->account_exists(rec->inner, addr);
+}
+
+static bool rec_account_is_empty(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  return rec->inner->vtable->account_is_empty(rec->inner, addr);
+}
+
+static void rec_create_contract(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  rec->inner->vtable->create_contract(rec->inner, addr);
+}
+
+static void rec_delete_account(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  rec->inner->vtable->delete_account(rec->inner, addr);
+}
+
+static uint256_t rec_get_balance(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  return rec->inner->vtable->get_balance(rec->inner, addr);
+}
+
+static void rec_set_balance(state_access_t *state, const address_t *addr, const uint256_t balance) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  rec->inner->vtable->set_balance(rec->inner, addr, balance);
+}
+
+static bool rec_add_balance(state_access_t *state, const address_t *addr, const uint256_t amount) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  return rec->inner->vtable->add_balance(rec->inner, addr, amount);
+}
+
+static bool rec_sub_balance(state_access_t *state, const address_t *addr, const uint256_t amount) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  return rec->inner->vtable->sub_balance(rec->inner, addr, amount);
+}
+
+static uint64_t rec_get_nonce(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  return rec->inner->vtable->get_nonce(rec->inner, addr);
+}
+
+static void rec_set_nonce(state_access_t *state, const address_t *addr, const uint64_t nonce) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  rec->inner->vtable->set_nonce(rec->inner, addr, nonce);
+}
+
+static uint64_t rec_increment_nonce(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  return rec->inner->vtable->increment_nonce(rec->inner, addr);
+}
+
+static bytes_t rec_get_code(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  record_code(rec, addr);
+  return rec->inner->vtable->get_code(rec->inner, addr);
+}
+
+static size_t rec_get_code_size(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  record_code(rec, addr);
+  return rec->inner->vtable->get_code_size(rec->inner, addr);
+}
+
+static hash_t rec_get_code_hash(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  return rec->inner->vtable->get_code_hash(rec->inner, addr);
+}
+
+static void rec_set_code(state_access_t *state, const address_t *addr, const uint8_t *code,
+                         const size_t code_len) {
+  const auto rec = (witness_recorder_t *)state;
+  record_address(rec, addr);
+  rec->inner->vtable->set_code(rec->inner, addr, code, code_len);
+}
+
+static uint256_t rec_get_storage(state_access_t *const state, const address_t *const addr,
+                                 const uint256_t slot) {
+  const auto rec = (witness_recorder_t *)state;
+  record_slot(rec, addr, slot);
+  return rec->inner->vtable->get_storage(rec->inner, addr, slot);
+}
+
+static uint256_t rec_get_original_storage(state_access_t *const state, const address_t *const addr,
+                                          const uint256_t slot) {
+  const auto rec = (witness_recorder_t *)state;
+  record_slot(rec, addr, slot);
+  return rec->inner->vtable->get_original_storage(rec->inner, addr, slot);
+}
+
+static void rec_set_storage(state_access_t *const state, const address_t *const addr,
+                            const uint256_t slot, const uint256_t value) {
+  const auto rec = (witness_recorder_t *)state;
+  record_slot(rec, addr, slot);
+  rec->inner->vtable->set_storage(rec->inner, addr, slot, value);
+}
+
+static void rec_storage_access(state_access_t *const state, const address_t *const addr,
+                               const uint256_t slot, uint256_t *const current,
+                               uint256_t *const original, bool *const was_cold) {
+  const auto rec = (witness_recorder_t *)state;
+  record_slot(rec, addr, slot);
+  rec->inner->vtable->storage_access(rec->inner, addr, slot, current, original, was_cold);
+}
+
+static void rec_storage_write(state_access_t *const state, const address_t *const addr,
+                              const uint256_t slot, const uint256_t current,
+                              const uint256_t original, const uint256_t value) {
+  const auto rec = (witness_recorder_t *)state;
+  record_slot(rec, addr, slot);
+  rec->inner->vtable->storage_write(rec->inner, addr, slot, current, original, value);
+}
+
+static bool rec_account_access(state_access_t *const state, const address_t *const addr,
+                               const unsigned fields, state_account_view_t *const out) {
+  const auto rec = (witness_recorder_t *)state;
+  if ((fields & STATE_ACCOUNT_CODE) != 0) {
+    record_code(rec, addr);
+  } else {
+    record_address(rec, addr);
+  }
+  return rec->inner->vtable->account_access(rec->inner, addr, fields, out);
+}
+
+// Access lists, snapshots and the state root do not read pre-state, so they
+// are forwarded without recording.
+
+static bool rec_is_address_warm(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  return rec->inner->vtable->is_address_warm(rec->inner, addr);
+}
+
+static bool rec_warm_address(state_access_t *state, const address_t *addr) {
+  const auto rec = (witness_recorder_t *)state;
+  return rec->inner->vtable->warm_address(rec->inner, addr);
+}
+
+static bool rec_is_slot_warm(state_access_t *const state, const address_t *const addr,
+                             const uint256_t slot) {
+  const auto rec = (witness_recorder_t *)state;
+  return rec->inner->vtable->is_slot_warm(rec->inner, addr, slot);
+}
+
+static bool rec_warm_slot(state_access_t *const state, const address_t *const addr,
+                          const uint256_t slot) {
+  const auto rec = (witness_recorder_t *)state;
+  return rec->inner->vtable->warm_slot(rec->inner, addr, slot);
+}
+
+static void rec_begin_transaction(state_access_t *state) {
+  const auto rec = (witness_recorder_t *)state;
+  rec->inner->vtable->begin_transaction(rec->inner);
+}
+
+static uint64_t rec_snapshot(state_access_t *state) {
+  const auto rec = (witness_recorder_t *)state;
+  return rec->inner->vtable->snapshot(rec->inner);
+}
+
+// NOLINTNEXTLINE(CppParameterMayBeConstPtrOrRef) - vtable semantic contract: revert modifies state
+static void rec_revert_to_snapshot(state_access_t *const state, const uint64_t snapshot_id) {
+  const auto rec = (witness_recorder_t *)state;
+  rec->inner->vtable->revert_to_snapshot(rec->inner, snapshot_id);
+}
+
+// NOLINTNEXTLINE(CppParameterMayBeConstPtrOrRef) - vtable semantic contract: commit modifies state
+static void rec_commit_snapshot(state_access_t *const state, const uint64_t snapshot_id) {
+  const auto rec = (witness_recorder_t *)state;
+  rec->inner->vtable->commit_snapshot(rec->inner, snapshot_id);
+}
+
+static hash_t rec_state_root(state_access_t *state) {
+  const auto rec = (witness_recorder_t *)state;
+  return rec->inner->vtable->state_root(rec->inner);
+}
+
+static const uint8_t *rec_get_jumpdest_analysis(state_access_t *state, const hash_t *code_hash) {
+  const auto rec = (witness_recorder_t *)state;
+  if (rec->inner->vtable->get_jumpdest_analysis == nullptr) {
+    return nullptr;
+  }
+  return rec->inner->vtable->get_jumpdest_analysis(rec->inner, code_hash);
+}
+
+static void rec_set_jumpdest_analysis(state_access_t *state, const hash_t *code_hash,
+                                      const uint8_t *bitmap, const size_t bitmap_size) {
+  const auto rec = (witness_recorder_t *)state;
+  if (rec->inner->vtable->set_jumpdest_analysis != nullptr) {
+    rec->inner->vtable->set_jumpdest_analysis(rec->inner, code_hash, bitmap, bitmap_size);
+  }
+}
+
+static void rec_destroy(state_access_t *state) {
+  const auto rec = (witness_recorder_t *)state;
+  witness_recorder_destroy(rec);
+}
+
+// =============================================================================
+// Vtable Definition
+// =============================================================================
+
+static const state_access_vtable_t WITNESS_RECORDER_VTABLE = {
+    .account_exists = rec_account_exists,
+    .account_is_empty = rec_account_is_empty,
+    .create_contract = rec_create_contract,
+    .delete_account = rec_delete_account,
+
+    .get_balance = rec_get_balance,
+    .set_balance = rec_set_balance,
+    .add_balance = rec_add_balance,
+    .sub_balance = rec_sub_balance,
+
+    .get_nonce = rec_get_nonce,
+    .set_nonce = rec_set_nonce,
+    .increment_nonce = rec_increment_nonce,
+
+    .get_code = rec_get_code,
+    .get_code_size = rec_get_code_size,
+    .get_code_hash = rec_get_code_hash,
+    .set_code = rec_set_code,
+
+    .get_storage = rec_get_storage,
+    .get_original_storage = rec_get_original_storage,
+    .set_storage = rec_set_storage,
+    .storage_access = rec_storage_access,
+    .storage_write = rec_storage_write,
+
+    .is_address_warm = rec_is_address_warm,
+    .warm_address = rec_warm_address,
+    .is_slot_warm = rec_is_slot_warm,
+    .warm_slot = rec_warm_slot,
+    .account_access = rec_account_access,
+
+    .begin_transaction = rec_begin_transaction,
+
+    .snapshot = rec_snapshot,
+    .revert_to_snapshot = rec_revert_to_snapshot,
+    .commit_snapshot = rec_commit_snapshot,
+
+    .state_root = rec_state_root,
+
+    .get_jumpdest_analysis = rec_get_jumpdest_analysis,
+    .set_jumpdest_analysis = rec_set_jumpdest_analysis,
+
+    .destroy = rec_destroy,
+};
+
+// =============================================================================
+// Public API Implementation
+// =============================================================================
+
+witness_recorder_t *witness_recorder_create(state_access_t *const inner,
+                                            div0_arena_t *const arena) {
+  if (inner == nullptr || arena == nullptr) {
+    return nullptr;
+  }
+
+  // Set thread-local arena for STC containers
+  div0_stc_arena = arena;
+
+  witness_recorder_t *const rec = div0_arena_alloc(arena, sizeof(witness_recorder_t));
+  witness_addr_set *const addresses = div0_arena_alloc(arena, sizeof(witness_addr_set));
+  witness_slot_set *const slots = div0_arena_alloc(arena, sizeof(witness_slot_set));
+  witness_addr_set *const code_addresses = div0_arena_alloc(arena, sizeof(witness_addr_set));
+  if (rec == nullptr || addresses == nullptr || slots == nullptr || code_addresses == nullptr) {
+    return nullptr;
+  }
+
+  // STC _init() doesn't allocate, so nothing needs cleanup on the failure path above
+  *addresses = witness_addr_set_init();
+  *slots = witness_slot_set_init();
+  *code_addresses = witness_addr_set_init();
+
+  rec->base.vtable = &WITNESS_RECORDER_VTABLE;
+  rec->base.unavailable = false;
+  rec->inner = inner;
+  rec->addresses = addresses;
+  rec->slots = slots;
+  rec->code_addresses = code_addresses;
+  rec->arena = arena;
+  return rec;
+}
+
+/// Collect code for every address whose code was read, deduplicated by code hash.
+static bool collect_codes(const witness_recorder_t *const rec, world_state_t *const pre_state,
+                          div0_arena_t *const arena, witness_t *const out) {
+  const auto code_addresses = (witness_addr_set *)rec->code_addresses;
+  const size_t max_count = (size_t)witness_addr_set_size(code_addresses);
+  if (max_count == 0) {
+    return true;
+  }
+
+  out->codes = div0_arena_alloc_array(arena, max_count, sizeof(bytes_t), alignof(bytes_t));
+  hash_t *const code_hashes =
+      div0_arena_alloc_array(arena, max_count, sizeof(hash_t), alignof(hash_t));
+  if (out->codes == nullptr || code_hashes == nullptr) {
+    return false;
+  }
+
+  // Contracts per block are few, so a linear duplicate scan is cheap
+  for (witness_addr_set_iter it = witness_addr_set_begin(code_addresses);
+       it.ref != witness_addr_set_end(code_addresses).ref; witness_addr_set_next(&it)) {
+    account_t acc;
+    if (!world_state_get_account(pre_state, it.ref, &acc) ||
+        hash_equal(&acc.code_hash, &EMPTY_CODE_HASH)) {
+      continue;
+    }
+    bool seen = false;
+    for (size_t i = 0; i < out->code_count && !seen; i++) {
+      seen = hash_equal(&code_hashes[i], &acc.code_hash);
+    }
+    if (!seen) {
+      code_hashes[out->code_count] = acc.code_hash;
+      out->codes[out->code_count] = state_get_code(world_state_access(pre_state), it.ref);
+      out->code_count++;
+    }
+  }
+  return true;
+}
+
+bool witness_build(const witness_recorder_t *const rec, world_state_t *const pre_state,
+                   div0_arena_t *const arena, witness_t *const out) {
+  const auto addresses = (witness_addr_set *)rec->addresses;
+  const auto slots = (witness_slot_set *)rec->slots;
+
+  *out = (witness_t){.pre_state_root = world_state_root(pre_state)};
+
+  const size_t address_count = (size_t)witness_addr_set_size(addresses);
+  const size_t slot_count = (size_t)witness_slot_set_size(slots);
+  if (address_count == 0) {
+    return true;
+  }
+
+  // Query 0 is the state trie; the rest are storage tries of accounts with
+  // storage. Trie keys are hashed, so keep the hashes alive here.
+  out->addresses =
+      div0_arena_alloc_array(arena, address_count, sizeof(address_t), alignof(address_t));
+  hash_t *const key_hashes = div0_arena_alloc_array(arena, address_count + slot_count,
+                                                    sizeof(hash_t), alignof(hash_t));
+  mpt_proof_key_t *const keys = div0_arena_alloc_array(
+      arena, address_count + slot_count, sizeof(mpt_proof_key_t), alignof(mpt_proof_key_t));
+  mpt_witness_query_t *const queries = div0_arena_alloc_array(
+      arena, address_count + 1, sizeof(mpt_witness_query_t), alignof(mpt_witness_query_t));
+  if (out->addresses == nullptr || key_hashes == nullptr || keys == nullptr ||
+      queries == nullptr) {
+    return false;
+  }
+
+  size_t key_count = 0;
+  for (witness_addr_set_iter it = witness_addr_set_begin(addresses);
+       it.ref != witness_addr_set_end(addresses).ref; witness_addr_set_next(&it)) {
+    out->addresses[out->address_count++] = *it.ref;
+    key_hashes[key_count] = keccak256(it.ref->bytes, ADDRESS_SIZE);
+    keys[key_count] = (mpt_proof_key_t){.data = key_hashes[key_count].bytes, .len = HASH_SIZE};
+    key_count++;
+  }
+  queries[0] = (mpt_witness_query_t){
+      .mpt = &pre_state->state_trie, .keys = keys, .key_count = address_count};
+  size_t query_count = 1;
+
+  // Group slots by account. Like world_state_snapshot, this scans the slot set
+  // once per account, which is fine for the account counts of a block.
+  for (size_t a = 0; a < address_count; a++) {
+    account_t acc;
+    if (!world_state_get_account(pre_state, &out->addresses[a], &acc) ||
+        hash_equal(&acc.storage_root, &MPT_EMPTY_ROOT)) {
+      continue;
+    }
+    const size_t first = key_count;
+    for (witness_slot_set_iter it = witness_slot_set_begin(slots);
+         it.ref != witness_slot_set_end(slots).ref; witness_slot_set_next(&it)) {
+      if (!address_equal(&it.ref->addr, &out->addresses[a])) {
+        continue;
+      }
+      uint8_t slot_bytes[32];
+      uint256_to_bytes_be(it.ref->slot, slot_bytes);
+      key_hashes[key_count] = keccak256(slot_bytes, sizeof(slot_bytes));
+      keys[key_count] = (mpt_proof_key_t){.data = key_hashes[key_count].bytes, .len = HASH_SIZE};
+      key_count++;
+    }
+    // Queried even with no slot read: the witness then holds the root, so the
+    // replay can load the trie and unread slots report the state unavailable
+    queries[query_count++] = (mpt_witness_query_t){
+        .mpt = world_state_get_storage_trie(pre_state, &out->addresses[a]),
+        .keys = keys + first,
+        .key_count = key_count - first,
+    };
+  }
+
+  return mpt_collect_witness(queries, query_count, arena, &out->nodes) &&
+         collect_codes(rec, pre_state, arena, out);
+}
+
+// NOLINTNEXTLINE(CppParameterMayBeConstPtrOrRef) - modifies rec members through casts
+void witness_recorder_destroy(witness_recorder_t *const rec) {
+  witness_addr_set_drop((witness_addr_set *)rec->addresses);
+  witness_slot_set_drop((witness_slot_set *)rec->slots);
+  witness_addr_set_drop((witness_addr_set *)rec->code_addresses);
+  // Note: The wrapped state and arena are not freed (owned by caller)
+}
@@ -2,6 +2,10 @@
 
 #include "div0/crypto/keccak256.h"
 #include "div0/mem/stc_allocator.h"
+#include "div0/state/witness.h"
+#include "div0/trie/proof.h"
+
+#include <stdalign.h>
 
 // =============================================================================
 // STC Container Definitions
@@ -53,6 +57,20 @@ static uint64_t address_hash(const address_t *const addr) {
 #define i_eq(a, b) address_equal(a, b)
 #include "stc/hmap.h"
 
+// Shared code bytes: code hash -> bytes_t, keyed by the hash's leading bytes
+static uint64_t code_hash_key(const hash_t *const code_hash) {
+  uint64_t h = 0;
+  for (size_t i = 0; i < sizeof(h); i++) {
+    h = (h << 8) | code_hash->bytes[i];
+  }
+  return h;
+}
+
+#define i_TYPE code_by_hash_map, hash_t, bytes_t
+#define i_hash(p) code_hash_key(p)
+#define i_eq(a, b) hash_equal(a, b)
+#include "stc/hmap.h"
+
 // Warm address set
 #define i_TYPE warm_addr_set, address_t
 #define i_hash(p) address_hash(p)
@@ -94,15 +112,16 @@ static bool warm_slot_key_eq(const warm_slot_key_t *const a, const warm_slot_key
   return uint256_eq(a->slot, b->slot);
 }
 
-// Warm slot set
-#define i_TYPE warm_slot_set, warm_slot_key_t
-#define i_hash(p) warm_slot_key_hash(p)
-#define i_eq(a, b) warm_slot_key_eq(a, b)
-#include "stc/hset.h"
+// Per-transaction slot access state. Warmth (EIP-2929) and the original value
+// (EIP-2200/EIP-3529 gas calculation) share one entry so SLOAD/SSTORE probe once.
+typedef struct {
+  uint256_t original; // Value before the first write this tx (valid if written)
+  bool warm;          // Slot accessed this tx
+  bool written;       // Slot written this tx (original recorded)
+} slot_access_t;
 
-// Original storage map: (address, slot) -> original uint256 value
-// Used for EIP-2200/EIP-3529 gas calculation
-#define i_TYPE original_storage_map, warm_slot_key_t, uint256_t
+// Slot access map: (address, slot) -> slot_access_t
+#define i_TYPE slot_access_map, warm_slot_key_t, slot_access_t
 #define i_hash(p) warm_slot_key_hash(p)
 #define i_eq(a, b) warm_slot_key_eq(a, b)
 #include "stc/hmap.h"
@@ -134,6 +153,114 @@ static hash_t slot_to_key(const uint256_t slot) { // NOLINT(performance-unnecess
   return keccak256(slot_bytes, 32);
 }
 
+/// Look up a trie key. A key in a subtree the trie does not hold (a partial
+/// trie loaded from a witness) reads as absent and marks the state unavailable.
+static bytes_t trie_get(const world_state_t *const ws, const mpt_t *const trie,
+                        const hash_t *const key) {
+  bytes_t value;
+  if (mpt_lookup(trie, key->bytes, HASH_SIZE, &value) == MPT_LOOKUP_UNRESOLVED) {
+    // The flag records a failed read, not state: safe to set through a const view
+    ((world_state_t *)ws)->base.unavailable = true;
+  }
+  return value;
+}
+
+// =============================================================================
+// Journal
+// =============================================================================
+
+/// Kind of change recorded in the journal.
+typedef enum {
+  JOURNAL_ACCOUNT,      // Account trie value before a write
+  JOURNAL_CODE,         // Code store entry before set_code or delete_account
+  JOURNAL_STORAGE,      // Slot value before a write
+  JOURNAL_STORAGE_TRIE, // Storage trie dropped by delete_account
+} journal_kind_t;
+
+/// Undo record for one change. Byte values point at trie values and code,
+/// which are copied on every write and never modified in place.
+typedef struct {
+  journal_kind_t kind;
+  address_t addr;
+  union {
+    bytes_t account; // Encoded account (data == nullptr: absent)
+    struct {
+      bytes_t bytes;
+      bool present;
+    } code;
+    struct {
+      uint256_t slot;
+      uint256_t value;
+    } storage;
+    mpt_t *storage_trie;
+  };
+} journal_entry_t;
+
+/// Changes since the first snapshot of the transaction. Snapshot IDs are
+/// journal positions; nothing is recorded until a snapshot is taken, since no
+/// revert can reach further back.
+typedef struct {
+  journal_entry_t *entries;
+  size_t size;
+  size_t capacity;
+  bool active; // A snapshot was taken this transaction
+} journal_t;
+
+/// Record a change if a snapshot is open.
+static void journal_push(const world_state_t *const ws, const journal_entry_t *const entry) {
+  const auto journal = (journal_t *)ws->journal;
+  if (!journal->active) {
+    return;
+  }
+  if (journal->size == journal->capacity) {
+    const size_t capacity = journal->capacity == 0 ? 64 : journal->capacity * 2;
+    journal_entry_t *const grown =
+        div0_arena_realloc(ws->arena, journal->entries, journal->size * sizeof(journal_entry_t),
+                           capacity * sizeof(journal_entry_t));
+    if (grown == nullptr) {
+      return;
+    }
+    journal->entries = grown;
+    journal->capacity = capacity;
+  }
+  journal->entries[journal->size++] = *entry;
+}
+
+/// Load an account that is about to be written, journaling its current value.
+/// @return true if the account exists (out is the empty account otherwise)
+static bool load_account_for_write(world_state_t *const ws, const address_t *const addr,
+                                   account_t *const out) {
+  const hash_t key = address_to_key(addr);
+  const bytes_t value = trie_get(ws, &ws->state_trie, &key);
+  journal_push(ws, &(journal_entry_t){.kind = JOURNAL_ACCOUNT, .addr = *addr, .account = value});
+  if (value.data == nullptr || !account_rlp_decode(value.data, value.size, out)) {
+    *out = account_empty();
+    return false;
+  }
+  return true;
+}
+
+/// Journal the code store entry of an address before it changes.
+static void journal_code(const world_state_t *const ws, const address_t *const addr) {
+  const auto c_map = (code_map *)ws->code_store;
+  const code_map_value *const entry = code_map_get(c_map, *addr);
+  journal_entry_t record = {.kind = JOURNAL_CODE, .addr = *addr};
+  record.code.present = entry != nullptr;
+  if (entry != nullptr) {
+    record.code.bytes = entry->second;
+  }
+  journal_push(ws, &record);
+}
+
+/// Journal a slot value before it changes.
+static void journal_storage(const world_state_t *const ws, const address_t *const addr,
+                            const uint256_t slot, const uint256_t value) {
+  journal_entry_t record = {.kind = JOURNAL_STORAGE, .addr = *addr};
+  record.storage.slot = slot;
+  record.storage.value = value;
+  journal_push(ws, &record);
+}
+
 // =============================================================================
 // Vtable Function Implementations
 // =============================================================================
@@ -141,7 +268,7 @@ static hash_t slot_to_key(const uint256_t slot) { // NOLINT(performance-unnecess
 static bool ws_account_exists(state_access_t *state, const address_t *addr) {
   const auto ws = (world_state_t *)state;
   const hash_t key = address_to_key(addr);
-  const bytes_t value = mpt_get(&ws->state_trie, key.bytes, HASH_SIZE);
+  const bytes_t value = trie_get(ws, &ws->state_trie, &key);
   return value.data != nullptr;
 }
 
@@ -156,11 +283,11 @@ static bool ws_account_is_empty(state_access_t *state, const address_t *addr) {
 
 static void ws_create_contract(state_access_t *const state, const address_t *const addr) {
   const auto ws = (world_state_t *)state;
-  if (ws_account_exists(state, addr)) {
+  account_t acc;
+  if (load_account_for_write(ws, addr, &acc)) {
     return; // Already exists
   }
   // Create with nonce=1 per EIP-161 (ensures non-empty account)
-  account_t acc = account_empty(); // Modified below
   acc.nonce = 1;
   world_state_set_account(ws, addr, &acc);
 }
@@ -168,12 +295,22 @@ static void ws_create_contract(state_access_t *const state, const address_t *con
 static void ws_delete_account(state_access_t *state, const address_t *addr) {
   const auto ws = (world_state_t *)state;
   const hash_t key = address_to_key(addr);
+  journal_push(ws, &(journal_entry_t){.kind = JOURNAL_ACCOUNT,
+                                      .addr = *addr,
+                                      .account = trie_get(ws, &ws->state_trie, &key)});
   mpt_delete(&ws->state_trie, key.bytes, HASH_SIZE);
 
   // Also remove from code store and storage tries
   const auto st_map = (storage_trie_map *)ws->storage_tries;
+  const storage_trie_map_value *const storage = storage_trie_map_get(st_map, *addr);
+  journal_push(ws, &(journal_entry_t){.kind = JOURNAL_STORAGE_TRIE,
+                                      .addr = *addr,
+                                      .storage_trie = storage != nullptr ? storage->second
+                                                                         : nullptr});
   storage_trie_map_erase(st_map, *addr);
 
+  journal_code(ws, addr);
+
   const auto c_map = (code_map *)ws->code_store;
   code_map_erase(c_map, *addr);
 }
@@ -190,9 +327,7 @@ static uint256_t ws_get_balance(state_access_t *state, const address_t *addr) {
 static void ws_set_balance(state_access_t *state, const address_t *addr, const uint256_t balance) {
   const auto ws = (world_state_t *)state;
   account_t acc;
-  if (!world_state_get_account(ws, addr, &acc)) {
-    acc = account_empty();
-  }
+  (void)load_account_for_write(ws, addr, &acc);
   acc.balance = balance;
   world_state_set_account(ws, addr, &acc);
 }
@@ -200,9 +335,7 @@ static void ws_set_balance(state_access_t *state, const address_t *addr, const u
 static bool ws_add_balance(state_access_t *state, const address_t *addr, const uint256_t amount) {
   const auto ws = (world_state_t *)state;
   account_t acc;
-  if (!world_state_get_account(ws, addr, &acc)) {
-    acc = account_empty();
-  }
+  (void)load_account_for_write(ws, addr, &acc);
 
   // Check for overflow
   const uint256_t new_balance = uint256_add(acc.balance, amount);
@@ -218,7 +351,7 @@ static bool ws_add_balance(state_access_t *state, const address_t *addr, const u
 static bool ws_sub_balance(state_access_t *state, const address_t *addr, const uint256_t amount) {
   const auto ws = (world_state_t *)state;
   account_t acc;
-  if (!world_state_get_account(ws, addr, &acc)) {
+  if (!load_account_for_write(ws, addr, &acc)) {
     return uint256_is_zero(amount); // Can only subtract 0 from non-existent
   }
 
@@ -244,9 +377,7 @@ static uint64_t ws_get_nonce(state_access_t *state, const address_t *addr) {
 static void ws_set_nonce(state_access_t *state, const address_t *addr, const uint64_t nonce) {
   const auto ws = (world_state_t *)state;
   account_t acc;
-  if (!world_state_get_account(ws, addr, &acc)) {
-    acc = account_empty();
-  }
+  (void)load_account_for_write(ws, addr, &acc);
   acc.nonce = nonce;
   world_state_set_account(ws, addr, &acc);
 }
@@ -254,9 +385,7 @@ static void ws_set_nonce(state_access_t *state, const address_t *addr, const uin
 static uint64_t ws_increment_nonce(state_access_t *state, const address_t *addr) {
   const auto ws = (world_state_t *)state;
   account_t acc;
-  if (!world_state_get_account(ws, addr, &acc)) {
-    acc = account_empty();
-  }
+  (void)load_account_for_write(ws, addr, &acc);
   const uint64_t old_nonce = acc.nonce;
 
   // Check for nonce overflow (EIP-2681 limits nonce to 2^64-2)
@@ -300,27 +429,30 @@ static hash_t ws_get_code_hash(state_access_t *state, const address_t *addr) {
 static void ws_set_code(state_access_t *state, const address_t *addr, const uint8_t *code,
                         const size_t code_len) {
   const auto ws = (world_state_t *)state;
+  const hash_t code_hash = code_len == 0 ? EMPTY_CODE_HASH : keccak256(code, code_len);
 
-  // Store code in code map
+  // Store code in code map. Accounts with identical code (e.g. clones deployed
+  // by one factory) share a single copy, so only the first deployment copies.
   const auto c_map = (code_map *)ws->code_store;
+  journal_code(ws, addr);
   bytes_t code_bytes;
   bytes_init_arena(&code_bytes, ws->arena);
   if (code_len > 0) {
-    bytes_from_data(&code_bytes, code, code_len);
+    const auto shared_map = (code_by_hash_map *)ws->code_by_hash;
+    const code_by_hash_map_value *const shared = code_by_hash_map_get(shared_map, code_hash);
+    if (shared != nullptr) {
+      code_bytes = shared->second;
+    } else {
+      bytes_from_data(&code_bytes, code, code_len);
+      code_by_hash_map_insert(shared_map, code_hash, code_bytes);
+    }
   }
   code_map_insert(c_map, *addr, code_bytes);
 
   // Update account code_hash
   account_t acc;
-  if (!world_state_get_account(ws, addr, &acc)) {
-    acc = account_empty();
-  }
-
-  if (code_len == 0) {
-    acc.code_hash = EMPTY_CODE_HASH;
-  } else {
-    acc.code_hash = keccak256(code, code_len);
-  }
+  (void)load_account_for_write(ws, addr, &acc);
+  acc.code_hash = code_hash;
 
   world_state_set_account(ws, addr, &acc);
 }
@@ -337,7 +469,7 @@ static uint256_t ws_get_storage(state_access_t *const state, const address_t *co
 
   const mpt_t *const storage = entry->second;
   const hash_t key = slot_to_key(slot);
-  const bytes_t value = mpt_get(storage, key.bytes, HASH_SIZE);
+  const bytes_t value = trie_get(ws, storage, &key);
   if (value.data == nullptr || value.size == 0) {
     return uint256_zero();
   }
@@ -349,30 +481,31 @@ static uint256_t ws_get_storage(state_access_t *const state, const address_t *co
 static uint256_t ws_get_original_storage(state_access_t *const state, const address_t *const addr,
                                          const uint256_t slot) {
   const auto ws = (world_state_t *)state;
-  const auto orig_map = (original_storage_map *)ws->original_storage;
+  const auto access_map = (slot_access_map *)ws->slot_access;
 
   const warm_slot_key_t key = {.addr = *addr, .slot = slot};
-  const original_storage_map_value *const entry = original_storage_map_get(orig_map, key);
+  const slot_access_map_value *const entry = slot_access_map_get(access_map, key);
 
-  if (entry != nullptr) {
-    return entry->second;
+  if (entry != nullptr && entry->second.written) {
+    return entry->second.original;
   }
 
-  // Not yet tracked - return current value (no writes yet this tx)
+  // Not yet written - return current value (no writes yet this tx)
   return ws_get_storage(state, addr, slot);
 }
 
-static void ws_set_storage(state_access_t *const state, const address_t *const addr,
-                           const uint256_t slot, const uint256_t value) {
-  const auto ws = (world_state_t *)state;
+/// Find or create the access entry for a slot (a single hash probe).
+static slot_access_t *slot_access_entry(const world_state_t *const ws,
+                                        const warm_slot_key_t *const key) {
+  const auto access_map = (slot_access_map *)ws->slot_access;
+  const slot_access_t fresh = {.original = uint256_zero(), .warm = false, .written = false};
+  return &slot_access_map_insert(access_map, *key, fresh).ref->second;
+}
 
-  // Record original value on first write (for EIP-2200 gas calculation)
-  const auto orig_map = (original_storage_map *)ws->original_storage;
-  const warm_slot_key_t slot_key = {.addr = *addr, .slot = slot};
-  if (!original_storage_map_contains(orig_map, slot_key)) {
-    const uint256_t original = ws_get_storage(state, addr, slot);
-    original_storage_map_insert(orig_map, slot_key, original);
-  }
+/// Write a slot value to the storage trie and the tracking sets.
+static void write_storage_value(world_state_t *const ws, const warm_slot_key_t *const slot_key,
+                                const uint256_t value) {
+  const address_t *const addr = &slot_key->addr;
 
   // Mark address as having dirty storage for efficient state root computation
   const auto dirty = (dirty_addr_set *)ws->dirty_storage;
@@ -382,14 +515,14 @@ static void ws_set_storage(state_access_t *const state, const address_t *const a
   const auto all_slots = (all_slots_set *)ws->all_storage_slots;
   if (uint256_is_zero(value)) {
     // Remove slot from tracking on deletion
-    all_slots_set_erase(all_slots, slot_key);
+    all_slots_set_erase(all_slots, *slot_key);
   } else {
     // Track non-zero slots
-    all_slots_set_insert(all_slots, slot_key);
+    all_slots_set_insert(all_slots, *slot_key);
   }
 
   mpt_t *const storage = world_state_get_storage_trie(ws, addr);
-  const hash_t key = slot_to_key(slot);
+  const hash_t key = slot_to_key(slot_key->slot);
 
   if (uint256_is_zero(value)) {
     // Delete the slot
@@ -408,6 +541,55 @@ static void ws_set_storage(state_access_t *const state, const address_t *const a
   }
 }
 
+static void ws_set_storage(state_access_t *const state, const address_t *const addr,
+                           const uint256_t slot, const uint256_t value) {
+  const auto ws = (world_state_t *)state;
+  const warm_slot_key_t slot_key = {.addr = *addr, .slot = slot};
+
+  // Record original value on first write (for EIP-2200 gas calculation)
+  const uint256_t current = ws_get_storage(state, addr, slot);
+  slot_access_t *const entry = slot_access_entry(ws, &slot_key);
+  if (!entry->written) {
+    entry->original = current;
+    entry->written = true;
+  }
+
+  journal_storage(ws, addr, slot, current);
+  write_storage_value(ws, &slot_key, value);
+}
+
+static void ws_storage_access(state_access_t *const state, const address_t *const addr,
+                              const uint256_t slot, uint256_t *const current,
+                              uint256_t *const original, bool *const was_cold) {
+  const auto ws = (world_state_t *)state;
+  const warm_slot_key_t slot_key = {.addr = *addr, .slot = slot};
+
+  slot_access_t *const entry = slot_access_entry(ws, &slot_key);
+  *was_cold = !entry->warm;
+  entry->warm = true;
+
+  *current = ws_get_storage(state, addr, slot);
+  if (original != nullptr) {
+    *original = entry->written ? entry->original : *current;
+  }
+}
+
+static void ws_storage_write(state_access_t *const state, const address_t *const addr,
+                             const uint256_t slot, const uint256_t current,
+                             const uint256_t original, const uint256_t value) {
+  const auto ws = (world_state_t *)state;
+  const warm_slot_key_t slot_key = {.addr = *addr, .slot = slot};
+
+  slot_access_t *const entry = slot_access_entry(ws, &slot_key);
+  if (!entry->written) {
+    entry->original = original;
+    entry->written = true;
+  }
+
+  journal_storage(ws, addr, slot, current);
+  write_storage_value(ws, &slot_key, value);
+}
+
 static bool ws_is_address_warm(state_access_t *state, const address_t *addr) {
   const auto ws = (world_state_t *)state;
   const auto set = (warm_addr_set *)ws->warm_addresses;
@@ -418,34 +600,47 @@ static bool ws_warm_address(state_access_t *state, const address_t *addr) {
   const auto ws = (world_state_t *)state;
   const auto set = (warm_addr_set *)ws->warm_addresses;
 
-  if (warm_addr_set_contains(set, *addr)) {
-    return false; // Already warm, not cold
-  }
+  // Inserted means it was cold (first access)
+  return warm_addr_set_insert(set, *addr).inserted;
+}
+
+static bool ws_account_access(state_access_t *const state, const address_t *const addr,
+                              const unsigned fields, state_account_view_t *const out) {
+  const auto ws = (world_state_t *)state;
+  const bool was_cold = ws_warm_address(state, addr);
 
-  warm_addr_set_insert(set, *addr);
-  return true; // Was cold (first access)
+  if ((fields & STATE_ACCOUNT_INFO) != 0) {
+    // One trie lookup and decode serves every account field
+    account_t acc;
+    out->exists = world_state_get_account(ws, addr, &acc);
+    out->balance = acc.balance;
+    out->nonce = acc.nonce;
+    out->code_hash = acc.code_hash;
+  }
+  if ((fields & STATE_ACCOUNT_CODE) != 0) {
+    out->code = ws_get_code(state, addr);
+  }
+  return was_cold;
 }
 
 static bool ws_is_slot_warm(state_access_t *const state, const address_t *const addr,
                             const uint256_t slot) {
   const auto ws = (world_state_t *)state;
-  const auto set = (warm_slot_set *)ws->warm_slots;
+  const auto access_map = (slot_access_map *)ws->slot_access;
   const warm_slot_key_t key = {.addr = *addr, .slot = slot};
-  return warm_slot_set_contains(set, key);
+  const slot_access_map_value *const entry = slot_access_map_get(access_map, key);
+  return entry != nullptr && entry->second.warm;
 }
 
 static bool ws_warm_slot(state_access_t *const state, const address_t *const addr,
                          const uint256_t slot) {
   const auto ws = (world_state_t *)state;
-  const auto set = (warm_slot_set *)ws->warm_slots;
   const warm_slot_key_t key = {.addr = *addr, .slot = slot};
 
-  if (warm_slot_set_contains(set, key)) {
-    return false; // Already warm, not cold
-  }
-
-  warm_slot_set_insert(set, key);
-  return true; // Was cold (first access)
+  slot_access_t *const entry = slot_access_entry(ws, &key);
+  const bool was_cold = !entry->warm;
+  entry->warm = true;
+  return was_cold;
 }
 
 static void ws_begin_transaction(state_access_t *state) {
@@ -455,37 +650,83 @@ static void ws_begin_transaction(state_access_t *state) {
   const auto addr_set = (warm_addr_set *)ws->warm_addresses;
   warm_addr_set_clear(addr_set);
 
-  const auto slot_set = (warm_slot_set *)ws->warm_slots;
-  warm_slot_set_clear(slot_set);
+  // Clear slot warmth and original storage tracking
+  const auto access_map = (slot_access_map *)ws->slot_access;
+  slot_access_map_clear(access_map);
 
-  // Clear original storage tracking
-  const auto orig_map = (original_storage_map *)ws->original_storage;
-  original_storage_map_clear(orig_map);
+  // Snapshots do not span transactions
+  const auto journal = (journal_t *)ws->journal;
+  journal->size = 0;
+  journal->active = false;
 }
 
-// FIXME: Snapshot/revert is not yet implemented. These are stubs that return
-// valid IDs but do NOT actually track or revert state changes. Full journaling
-// support is required for proper CALL/CREATE revert semantics.
-// See: https://github.com/daniellehrner/div0/issues/XX
+/// Undo one journaled change. Writes go straight to the tries and maps, so
+/// nothing is journaled again.
+static void journal_undo(world_state_t *const ws, const journal_entry_t *const entry) {
+  const address_t *const addr = &entry->addr;
+  switch (entry->kind) {
+  case JOURNAL_ACCOUNT: {
+    const hash_t key = address_to_key(addr);
+    const auto all_accts = (all_accounts_set *)ws->all_accounts;
+    if (entry->account.data == nullptr) {
+      mpt_delete(&ws->state_trie, key.bytes, HASH_SIZE);
+      all_accounts_set_erase(all_accts, *addr);
+    } else {
+      mpt_insert(&ws->state_trie, key.bytes, HASH_SIZE, entry->account.data, entry->account.size);
+      all_accounts_set_insert(all_accts, *addr);
+    }
+    // The restored storage root may be stale: recompute it from the storage trie
+    dirty_addr_set_insert((dirty_addr_set *)ws->dirty_storage, *addr);
+    break;
+  }
+  case JOURNAL_CODE: {
+    const auto c_map = (code_map *)ws->code_store;
+    if (entry->code.present) {
+      code_map_insert(c_map, *addr, entry->code.bytes).ref->second = entry->code.bytes;
+    } else {
+      code_map_erase(c_map, *addr);
+    }
+    break;
+  }
+  case JOURNAL_STORAGE: {
+    const warm_slot_key_t slot_key = {.addr = *addr, .slot = entry->storage.slot};
+    write_storage_value(ws, &slot_key, entry->storage.value);
+    break;
+  }
+  case JOURNAL_STORAGE_TRIE: {
+    const auto st_map = (storage_trie_map *)ws->storage_tries;
+    if (entry->storage_trie != nullptr) {
+      storage_trie_map_insert(st_map, *addr, entry->storage_trie).ref->second =
+          entry->storage_trie;
+    } else {
+      storage_trie_map_erase(st_map, *addr);
+    }
+    dirty_addr_set_insert((dirty_addr_set *)ws->dirty_storage, *addr);
+    break;
+  }
+  }
+}
 
 static uint64_t ws_snapshot(state_access_t *state) {
   const auto ws = (world_state_t *)state;
-  // Returns incrementing ID for API compatibility, but no journaling occurs
-  return ++ws->snapshot_counter;
+  const auto journal = (journal_t *)ws->journal;
+  journal->active = true;
+  return journal->size;
 }
 
-// NOLINTNEXTLINE(CppParameterMayBeConstPtrOrRef) - vtable semantic contract: revert modifies state
 static void ws_revert_to_snapshot(state_access_t *const state, const uint64_t snapshot_id) {
-  (void)state;
-  (void)snapshot_id;
-  // FIXME: No-op - requires journaling all state changes since snapshot
+  const auto ws = (world_state_t *)state;
+  const auto journal = (journal_t *)ws->journal;
+  while (journal->size > snapshot_id) {
+    journal_undo(ws, &journal->entries[--journal->size]);
+  }
 }
 
 // NOLINTNEXTLINE(CppParameterMayBeConstPtrOrRef) - vtable semantic contract: commit modifies state
 static void ws_commit_snapshot(state_access_t *const state, const uint64_t snapshot_id) {
+  // Entries stay: an enclosing snapshot may still be reverted
   (void)state;
   (void)snapshot_id;
-  // FIXME: No-op - would discard journal entries for the snapshot
 }
 
 static hash_t ws_state_root(state_access_t *state) {
@@ -493,6 +734,20 @@ static hash_t ws_state_root(state_access_t *state) {
   return world_state_root(ws);
 }
 
+static const uint8_t *ws_get_jumpdest_analysis(state_access_t *state, const hash_t *code_hash) {
+  const auto ws = (world_state_t *)state;
+  return ws->jumpdest_cache != nullptr ? jumpdest_cache_get(ws->jumpdest_cache, code_hash)
+                                       : nullptr;
+}
+
+static void ws_set_jumpdest_analysis(state_access_t *state, const hash_t *code_hash,
+                                     const uint8_t *bitmap, const size_t bitmap_size) {
+  const auto ws = (world_state_t *)state;
+  if (ws->jumpdest_cache != nullptr) {
+    (void)jumpdest_cache_put(ws->jumpdest_cache, code_hash, bitmap, bitmap_size);
+  }
+}
+
 static void ws_destroy(state_access_t *state) {
   const auto ws = (world_state_t *)state;
   world_state_destroy(ws);
@@ -525,11 +780,14 @@ static const state_access_vtable_t WORLD_STATE_VTABLE = {
     .get_storage = ws_get_storage,
     .get_original_storage = ws_get_original_storage,
     .set_storage = ws_set_storage,
+    .storage_access = ws_storage_access,
+    .storage_write = ws_storage_write,
 
     .is_address_warm = ws_is_address_warm,
     .warm_address = ws_warm_address,
     .is_slot_warm = ws_is_slot_warm,
     .warm_slot = ws_warm_slot,
+    .account_access = ws_account_access,
 
     .begin_transaction = ws_begin_transaction,
 
@@ -539,6 +797,9 @@ static const state_access_vtable_t WORLD_STATE_VTABLE = {
 
     .state_root = ws_state_root,
 
+    .get_jumpdest_analysis = ws_get_jumpdest_analysis,
+    .set_jumpdest_analysis = ws_set_jumpdest_analysis,
+
     .destroy = ws_destroy,
 };
 
@@ -590,6 +851,13 @@ world_state_t *world_state_create(div0_arena_t *const arena) {
   *c_map = code_map_init();
   ws->code_store = c_map;
 
+  code_by_hash_map *shared_map = div0_arena_alloc(arena, sizeof(code_by_hash_map));
+  if (shared_map == nullptr) {
+    goto fail;
+  }
+  *shared_map = code_by_hash_map_init();
+  ws->code_by_hash = shared_map;
+
   warm_addr_set *wa_set = div0_arena_alloc(arena, sizeof(warm_addr_set));
   if (wa_set == nullptr) {
     goto fail;
@@ -597,19 +865,12 @@ world_state_t *world_state_create(div0_arena_t *const arena) {
   *wa_set = warm_addr_set_init();
   ws->warm_addresses = wa_set;
 
-  warm_slot_set *wslot_set = div0_arena_alloc(arena, sizeof(warm_slot_set));
-  if (wslot_set == nullptr) {
+  slot_access_map *access_map = div0_arena_alloc(arena, sizeof(slot_access_map));
+  if (access_map == nullptr) {
     goto fail;
   }
-  *wslot_set = warm_slot_set_init();
-  ws->warm_slots = wslot_set;
-
-  original_storage_map *orig_map = div0_arena_alloc(arena, sizeof(original_storage_map));
-  if (orig_map == nullptr) {
-    goto fail;
-  }
-  *orig_map = original_storage_map_init();
-  ws->original_storage = orig_map;
+  *access_map = slot_access_map_init();
+  ws->slot_access = access_map;
 
   dirty_addr_set *dirty = div0_arena_alloc(arena, sizeof(dirty_addr_set));
   if (dirty == nullptr) {
@@ -632,8 +893,12 @@ world_state_t *world_state_create(div0_arena_t *const arena) {
   *all_slots = all_slots_set_init();
   ws->all_storage_slots = all_slots;
 
-  // Initialize snapshot counter
-  ws->snapshot_counter = 0;
+  journal_t *journal = div0_arena_alloc(arena, sizeof(journal_t));
+  if (journal == nullptr) {
+    goto fail;
+  }
+  *journal = (journal_t){.entries = nullptr, .size = 0, .capacity = 0, .active = false};
+  ws->journal = journal;
 
   return ws;
 
@@ -646,14 +911,14 @@ fail:
   if (ws->code_store != nullptr) {
     code_map_drop(ws->code_store);
   }
+  if (ws->code_by_hash != nullptr) {
+    code_by_hash_map_drop(ws->code_by_hash);
+  }
   if (ws->warm_addresses != nullptr) {
     warm_addr_set_drop(ws->warm_addresses);
   }
-  if (ws->warm_slots != nullptr) {
-    warm_slot_set_drop(ws->warm_slots);
-  }
-  if (ws->original_storage != nullptr) {
-    original_storage_map_drop(ws->original_storage);
+  if (ws->slot_access != nullptr) {
+    slot_access_map_drop(ws->slot_access);
   }
   if (ws->dirty_storage != nullptr) {
     dirty_addr_set_drop(ws->dirty_storage);
@@ -671,7 +936,7 @@ fail:
 bool world_state_get_account(const world_state_t *const ws, const address_t *const addr,
                              account_t *const out) {
   const hash_t key = address_to_key(addr);
-  const bytes_t value = mpt_get(&ws->state_trie, key.bytes, HASH_SIZE);
+  const bytes_t value = trie_get(ws, &ws->state_trie, &key);
 
   if (value.data == nullptr) {
     *out = account_empty();
@@ -789,14 +1054,14 @@ void world_state_clear(world_state_t *const ws) {
   const auto c_map = (code_map *)ws->code_store;
   code_map_clear(c_map);
 
+  const auto shared_map = (code_by_hash_map *)ws->code_by_hash;
+  code_by_hash_map_clear(shared_map);
+
   const auto wa_set = (warm_addr_set *)ws->warm_addresses;
   warm_addr_set_clear(wa_set);
 
-  const auto ws_set = (warm_slot_set *)ws->warm_slots;
-  warm_slot_set_clear(ws_set);
-
-  const auto orig_map = (original_storage_map *)ws->original_storage;
-  original_storage_map_clear(orig_map);
+  const auto access_map = (slot_access_map *)ws->slot_access;
+  slot_access_map_clear(access_map);
 
   const auto dirty = (dirty_addr_set *)ws->dirty_storage;
   dirty_addr_set_clear(dirty);
@@ -806,6 +1071,10 @@ void world_state_clear(world_state_t *const ws) {
 
   const auto all_slots = (all_slots_set *)ws->all_storage_slots;
   all_slots_set_clear(all_slots);
+
+  const auto journal = (journal_t *)ws->journal;
+  journal->size = 0;
+  journal->active = false;
 }
 
 // NOLINTNEXTLINE(CppParameterMayBeConstPtrOrRef) - modifies ws members through casts
@@ -817,14 +1086,14 @@ void world_state_destroy(world_state_t *const ws) {
   const auto c_map = (code_map *)ws->code_store;
   code_map_drop(c_map);
 
+  const auto shared_map = (code_by_hash_map *)ws->code_by_hash;
+  code_by_hash_map_drop(shared_map);
+
   const auto wa_set = (warm_addr_set *)ws->warm_addresses;
   warm_addr_set_drop(wa_set);
 
-  const auto ws_set = (warm_slot_set *)ws->warm_slots;
-  warm_slot_set_drop(ws_set);
-
-  const auto orig_map = (original_storage_map *)ws->original_storage;
-  original_storage_map_drop(orig_map);
+  const auto access_map = (slot_access_map *)ws->slot_access;
+  slot_access_map_drop(access_map);
 
   const auto dirty = (dirty_addr_set *)ws->dirty_storage;
   dirty_addr_set_drop(dirty);
@@ -838,6 +1107,98 @@ void world_state_destroy(world_state_t *const ws) {
   // Note: Arena memory is not freed here (owned by caller)
 }
 
+// =============================================================================
+// Statistics
+// =============================================================================
+
+world_state_stats_t world_state_stats(const world_state_t *const ws) {
+  // Sizes and bucket counts are plain field reads; the casts only satisfy STC's signatures
+#define WS_TABLE_STATS(type, field)                                                               \
+  ((world_state_table_stats_t){.size = (size_t)type##_size((type *)ws->field),                    \
+                               .buckets = (size_t)type##_bucket_count((type *)ws->field)})
+  return (world_state_stats_t){
+      .storage_tries = WS_TABLE_STATS(storage_trie_map, storage_tries),
+      .code_store = WS_TABLE_STATS(code_map, code_store),
+      .code_by_hash = WS_TABLE_STATS(code_by_hash_map, code_by_hash),
+      .warm_addresses = WS_TABLE_STATS(warm_addr_set, warm_addresses),
+      .slot_access = WS_TABLE_STATS(slot_access_map, slot_access),
+      .dirty_storage = WS_TABLE_STATS(dirty_addr_set, dirty_storage),
+      .all_accounts = WS_TABLE_STATS(all_accounts_set, all_accounts),
+      .all_storage_slots = WS_TABLE_STATS(all_slots_set, all_storage_slots),
+  };
+#undef WS_TABLE_STATS
+}
+
+// =============================================================================
+// Witness Replay
+// =============================================================================
+
+/// Find a witness code by hash. Returns nullptr if the witness does not carry it.
+static const bytes_t *find_witness_code(const witness_t *const witness,
+                                        const hash_t *const code_hashes,
+                                        const hash_t *const code_hash) {
+  for (size_t i = 0; i < witness->code_count; i++) {
+    if (hash_equal(&code_hashes[i], code_hash)) {
+      return &witness->codes[i];
+    }
+  }
+  return nullptr;
+}
+
+world_state_t *world_state_from_witness(const witness_t *const witness,
+                                        div0_arena_t *const arena) {
+  world_state_t *const ws = world_state_create(arena);
+  if (ws == nullptr) {
+    return nullptr;
+  }
+  if (!mpt_load_proof(&ws->state_trie, &witness->pre_state_root, &witness->nodes)) {
+    goto fail;
+  }
+
+  hash_t *code_hashes = nullptr;
+  if (witness->code_count > 0) {
+    code_hashes =
+        div0_arena_alloc_array(arena, witness->code_count, sizeof(hash_t), alignof(hash_t));
+    if (code_hashes == nullptr) {
+      goto fail;
+    }
+    for (size_t i = 0; i < witness->code_count; i++) {
+      code_hashes[i] = keccak256(witness->codes[i].data, witness->codes[i].size);
+    }
+  }
+
+  const auto all_accts = (all_accounts_set *)ws->all_accounts;
+  const auto c_map = (code_map *)ws->code_store;
+
+  for (size_t i = 0; i < witness->address_count; i++) {
+    const address_t *const addr = &witness->addresses[i];
+    account_t acc;
+    if (!world_state_get_account(ws, addr, &acc)) {
+      continue; // Absent in the pre-state (proven by the witness nodes)
+    }
+    all_accounts_set_insert(all_accts, *addr);
+
+    if (!hash_equal(&acc.storage_root, &MPT_EMPTY_ROOT)) {
+      mpt_t *const storage = world_state_get_storage_trie(ws, addr);
+      if (storage == nullptr || !mpt_load_proof(storage, &acc.storage_root, &witness->nodes)) {
+        goto fail;
+      }
+    }
+
+    // Code is only carried for accounts whose code was read
+    const bytes_t *const code = find_witness_code(witness, code_hashes, &acc.code_hash);
+    if (code != nullptr) {
+      code_map_insert(c_map, *addr, *code);
+    }
+  }
+
+  return ws;
+
+fail:
+  world_state_destroy(ws);
+  return nullptr;
+}
+
 // =============================================================================
 // Post-State Export
 // =============================================================================
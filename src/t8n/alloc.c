@@ -4,6 +4,8 @@
 
 #include "div0/util/hex.h"
 
+#include <stdlib.h>
+
 // ============================================================================
 // Parsing Implementation
 // ============================================================================
@@ -130,6 +132,179 @@ json_result_t t8n_parse_alloc_file(const char *const path, div0_arena_t *const a
   return result;
 }
 
+// ============================================================================
+// Single-Pass Parsing Implementation
+// ============================================================================
+
+// Initial capacity of the scratch account array (doubled as needed)
+static constexpr size_t READ_INITIAL_ACCOUNTS = 256;
+
+static json_result_t read_storage(json_reader_t *const r, div0_arena_t *const arena,
+                                  account_snapshot_t *const account) {
+  // Storage that is not an object is ignored, as in t8n_parse_alloc_value
+  if (json_reader_peek(r) != JSON_TOKEN_OBJ) {
+    (void)json_reader_skip(r);
+    return json_reader_result(r);
+  }
+
+  const size_t count = json_reader_count(r);
+  if (count > 0) {
+    account->storage =
+        div0_arena_alloc_array(arena, count, sizeof(storage_entry_t), alignof(storage_entry_t));
+    if (account->storage == nullptr) {
+      return json_err(JSON_ERR_ALLOC, "failed to allocate storage");
+    }
+  }
+
+  (void)json_reader_obj_begin(r);
+  const char *key;
+  size_t key_len;
+  size_t idx = 0;
+  while (json_reader_obj_next(r, &key, &key_len)) {
+    if (idx == count) {
+      return json_err(JSON_ERR_PARSE, "malformed storage object");
+    }
+    storage_entry_t *const entry = &account->storage[idx];
+
+    char slot_hex[67];
+    if (!json_reader_copy_str(key, key_len, slot_hex, sizeof(slot_hex)) ||
+        !hex_decode_uint256(slot_hex, &entry->slot)) {
+      return json_err(JSON_ERR_INVALID_HEX, "invalid storage slot key");
+    }
+
+    if (!json_reader_hex_uint256(r, &entry->value)) {
+      return json_reader_err(r, JSON_ERR_INVALID_HEX, "invalid storage value");
+    }
+
+    // Skip zero values (they represent deleted slots)
+    if (!uint256_is_zero(entry->value)) {
+      idx++;
+    }
+  }
+  account->storage_count = idx;
+  return json_reader_result(r);
+}
+
+static json_result_t read_account(json_reader_t *const r, div0_arena_t *const arena,
+                                  account_snapshot_t *const account) {
+  if (json_reader_peek(r) != JSON_TOKEN_OBJ) {
+    return json_reader_err(r, JSON_ERR_INVALID_TYPE, "account must be an object");
+  }
+  (void)json_reader_obj_begin(r);
+
+  bool has_balance = false;
+  const char *key;
+  size_t key_len;
+  while (json_reader_obj_next(r, &key, &key_len)) {
+    if (json_reader_key_eq(key, key_len, "balance")) {
+      has_balance = json_reader_hex_uint256(r, &account->balance);
+    } else if (json_reader_key_eq(key, key_len, "nonce")) {
+      (void)json_reader_hex_u64(r, &account->nonce);
+    } else if (json_reader_key_eq(key, key_len, "code")) {
+      (void)json_reader_hex_bytes(r, arena, &account->code);
+    } else if (json_reader_key_eq(key, key_len, "storage")) {
+      const json_result_t result = read_storage(r, arena, account);
+      if (json_is_err(result)) {
+        return result;
+      }
+    } else {
+      (void)json_reader_skip(r);
+    }
+  }
+
+  if (!json_reader_ok(r)) {
+    return json_reader_result(r);
+  }
+  if (!has_balance) {
+    return json_err(JSON_ERR_MISSING_FIELD, "missing balance field");
+  }
+  return json_ok();
+}
+
+json_result_t t8n_read_alloc(json_reader_t *const r, div0_arena_t *const arena,
+                             state_snapshot_t *const out) {
+  out->accounts = nullptr;
+  out->account_count = 0;
+  if (json_reader_peek(r) != JSON_TOKEN_OBJ) {
+    return json_reader_err(r, JSON_ERR_INVALID_TYPE, "alloc must be an object");
+  }
+  (void)json_reader_obj_begin(r);
+
+  // Accounts are collected in a growing scratch array and copied to the arena
+  // once: counting them up front would scan the whole input twice.
+  account_snapshot_t *accounts = nullptr;
+  size_t count = 0;
+  size_t capacity = 0;
+  json_result_t result = json_ok();
+
+  const char *key;
+  size_t key_len;
+  while (json_reader_obj_next(r, &key, &key_len)) {
+    if (count == capacity) {
+      capacity = capacity == 0 ? READ_INITIAL_ACCOUNTS : capacity * 2;
+      account_snapshot_t *const grown = realloc(accounts, capacity * sizeof(*accounts));
+      if (grown == nullptr) {
+        result = json_err(JSON_ERR_ALLOC, "failed to allocate accounts");
+        break;
+      }
+      accounts = grown;
+    }
+
+    account_snapshot_t *const account = &accounts[count];
+    __builtin___memset_chk(account, 0, sizeof(*account), __builtin_object_size(account, 0));
+
+    // Parse address from key
+    char addr_hex[43];
+    if (!json_reader_copy_str(key, key_len, addr_hex, sizeof(addr_hex)) ||
+        !hex_decode(addr_hex, account->address.bytes, ADDRESS_SIZE)) {
+      result = json_err(JSON_ERR_INVALID_HEX, "invalid address key");
+      break;
+    }
+
+    result = read_account(r, arena, account);
+    if (json_is_err(result)) {
+      break;
+    }
+    count++;
+  }
+
+  if (json_is_ok(result)) {
+    result = json_reader_result(r);
+  }
+  if (json_is_ok(result) && count > 0) {
+    out->accounts = div0_arena_alloc_array(arena, count, sizeof(account_snapshot_t),
+                                           alignof(account_snapshot_t));
+    if (out->accounts == nullptr) {
+      result = json_err(JSON_ERR_ALLOC, "failed to allocate accounts");
+    } else {
+      __builtin___memcpy_chk(out->accounts, accounts, count * sizeof(*accounts),
+                             count * sizeof(*accounts));
+      out->account_count = count;
+    }
+  }
+  free(accounts);
+  return result;
+}
+
+json_result_t t8n_read_alloc_file(const char *const path, div0_arena_t *const arena,
+                                  state_snapshot_t *const out) {
+  json_file_t file;
+  json_result_t result = json_file_map(path, &file);
+  if (json_is_err(result)) {
+    return result;
+  }
+
+  json_reader_t r;
+  json_reader_init(&r, file.data, file.size);
+  result = t8n_read_alloc(&r, arena, out);
+  if (json_is_ok(result)) {
+    result = json_reader_finish(&r);
+  }
+
+  json_file_unmap(&file);
+  return result;
+}
+
 // ============================================================================
 // Serialization Implementation
 // ============================================================================
@@ -201,4 +376,61 @@ yyjson_mut_val_t *t8n_write_alloc(const state_snapshot_t *const snapshot,
   return root;
 }
 
+// ============================================================================
+// Streaming Serialization
+// ============================================================================
+
+void t8n_stream_alloc_account(const account_snapshot_t *const account, json_stream_t *const s) {
+  json_stream_obj_begin(s);
+
+  // Balance (always present)
+  json_stream_key(s, "balance");
+  json_stream_hex_uint256(s, &account->balance);
+
+  // Nonce (only if non-zero)
+  if (account->nonce != 0) {
+    json_stream_key(s, "nonce");
+    json_stream_hex_u64(s, account->nonce);
+  }
+
+  // Code (only if non-empty)
+  if (account->code.size > 0) {
+    json_stream_key(s, "code");
+    json_stream_hex_bytes(s, account->code.data, account->code.size);
+  }
+
+  // Storage (only if non-empty; zero values are skipped inside)
+  if (account->storage_count > 0) {
+    json_stream_key(s, "storage");
+    json_stream_obj_begin(s);
+    for (size_t i = 0; i < account->storage_count; i++) {
+      const storage_entry_t *const entry = &account->storage[i];
+      if (uint256_is_zero(entry->value)) {
+        continue;
+      }
+
+      char slot_hex[67];
+      hex_encode_uint256_padded(&entry->slot, slot_hex);
+      json_stream_key(s, slot_hex);
+      json_stream_hex_uint256_padded(s, &entry->value);
+    }
+    json_stream_obj_end(s);
+  }
+
+  json_stream_obj_end(s);
+}
+
+void t8n_stream_alloc(const state_snapshot_t *const snapshot, json_stream_t *const s) {
+  json_stream_obj_begin(s);
+  for (size_t i = 0; i < snapshot->account_count; i++) {
+    const account_snapshot_t *const account = &snapshot->accounts[i];
+
+    char addr_hex[43];
+    hex_encode(account->address.bytes, ADDRESS_SIZE, addr_hex);
+    json_stream_key(s, addr_hex);
+    t8n_stream_alloc_account(account, s);
+  }
+  json_stream_obj_end(s);
+}
+
 #endif // DIV0_FREESTANDING
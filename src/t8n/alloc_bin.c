@@ -0,0 +1,379 @@
+#include "div0/t8n/alloc_bin.h"
+
+#ifndef DIV0_FREESTANDING
+
+#include "div0/crypto/keccak256.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Records are the in-memory representation, so the format is only defined for
+// little-endian hosts (all supported hosted targets).
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+              "binary alloc snapshots require a little-endian host");
+
+static const uint8_t BIN_MAGIC[4] = {'D', '0', 'S', 'T'};
+static constexpr uint32_t NO_CODE = UINT32_MAX;
+static constexpr size_t BIN_ALIGNMENT = 8;
+
+// ============================================================================
+// On-disk Records
+// ============================================================================
+
+typedef struct {
+  uint8_t magic[4];
+  uint32_t version;
+  uint64_t account_count;
+  uint64_t code_count;
+  uint64_t storage_count;
+  uint64_t code_bytes;
+  uint8_t reserved[24];
+} bin_header_t;
+
+typedef struct {
+  uint256_t balance;
+  address_t address;
+  uint32_t code_index; // NO_CODE if the account has no code
+  uint64_t nonce;
+  uint64_t storage_offset; // First entry in the storage section
+  uint64_t storage_count;
+} bin_account_t;
+
+typedef struct {
+  uint8_t hash[HASH_SIZE];
+  uint64_t offset; // Offset into the code blob
+  uint64_t size;
+} bin_code_t;
+
+static_assert(sizeof(bin_header_t) == 64, "bin_header_t layout");
+static_assert(sizeof(bin_account_t) == 80, "bin_account_t layout");
+static_assert(offsetof(bin_account_t, code_index) == 52, "bin_account_t layout");
+static_assert(sizeof(bin_code_t) == 48, "bin_code_t layout");
+static_assert(sizeof(storage_entry_t) == 64, "storage entries are stored as-is");
+
+/// Section offsets derived from the header counts.
+typedef struct {
+  size_t accounts;
+  size_t codes;
+  size_t storage;
+  size_t blob;
+  size_t total;
+} bin_layout_t;
+
+static bool bin_layout(const uint64_t account_count, const uint64_t code_count,
+                       const uint64_t storage_count, const uint64_t code_bytes,
+                       bin_layout_t *const out) {
+  size_t accounts_size;
+  size_t codes_size;
+  size_t storage_size;
+  if (__builtin_mul_overflow(account_count, sizeof(bin_account_t), &accounts_size) ||
+      __builtin_mul_overflow(code_count, sizeof(bin_code_t), &codes_size) ||
+      __builtin_mul_overflow(storage_count, sizeof(storage_entry_t), &storage_size)) {
+    return false;
+  }
+  out->accounts = sizeof(bin_header_t);
+  out->codes = out->accounts + accounts_size; // cannot overflow: both terms checked above
+  return !__builtin_add_overflow(out->codes, codes_size, &out->storage) &&
+         !__builtin_add_overflow(out->storage, storage_size, &out->blob) &&
+         !__builtin_add_overflow(out->blob, code_bytes, &out->total);
+}
+
+bool t8n_alloc_is_bin_path(const char *const path) {
+  const size_t len = strlen(path);
+  return len >= 4 && strcmp(path + len - 4, ".bin") == 0;
+}
+
+// ============================================================================
+// Encoding
+// ============================================================================
+
+/// Distinct code candidate: hash of one account's code.
+typedef struct {
+  uint8_t hash[HASH_SIZE];
+  size_t account; // Index into the sorted account order
+} code_ref_t;
+
+static int compare_accounts(const void *const a, const void *const b) {
+  const account_snapshot_t *const lhs = *(const account_snapshot_t *const *)a;
+  const account_snapshot_t *const rhs = *(const account_snapshot_t *const *)b;
+  return memcmp(lhs->address.bytes, rhs->address.bytes, ADDRESS_SIZE);
+}
+
+static int compare_code_refs(const void *const a, const void *const b) {
+  return memcmp(((const code_ref_t *)a)->hash, ((const code_ref_t *)b)->hash, HASH_SIZE);
+}
+
+static int compare_slots(const void *const a, const void *const b) {
+  const uint256_t lhs = ((const storage_entry_t *)a)->slot;
+  const uint256_t rhs = ((const storage_entry_t *)b)->slot;
+  if (uint256_lt(lhs, rhs)) {
+    return -1;
+  }
+  return uint256_lt(rhs, lhs) ? 1 : 0;
+}
+
+json_result_t t8n_alloc_bin_encode(const state_snapshot_t *const snapshot,
+                                   div0_arena_t *const arena, bytes_t *const out) {
+  const size_t account_count = snapshot->account_count;
+
+  // Sort accounts by address (through pointers; the snapshot stays untouched)
+  const account_snapshot_t **sorted = nullptr;
+  uint32_t *code_index = nullptr;
+  code_ref_t *refs = nullptr;
+  if (account_count > 0) {
+    sorted = div0_arena_alloc_array(arena, account_count, sizeof(*sorted), alignof(void *));
+    code_index = div0_arena_alloc_array(arena, account_count, sizeof(*code_index),
+                                        alignof(uint32_t));
+    refs = div0_arena_alloc_array(arena, account_count, sizeof(*refs), alignof(code_ref_t));
+    if (sorted == nullptr || code_index == nullptr || refs == nullptr) {
+      return json_err(JSON_ERR_ALLOC, "failed to allocate encoder scratch");
+    }
+  }
+  size_t storage_count = 0;
+  for (size_t i = 0; i < account_count; i++) {
+    sorted[i] = &snapshot->accounts[i];
+    storage_count += snapshot->accounts[i].storage_count;
+  }
+  if (account_count > 1) {
+    qsort((void *)sorted, account_count, sizeof(*sorted), compare_accounts);
+  }
+
+  // Hash all code, then group identical hashes into one code entry each
+  size_t ref_count = 0;
+  for (size_t i = 0; i < account_count; i++) {
+    code_index[i] = NO_CODE;
+    if (sorted[i]->code.size > 0) {
+      const hash_t hash = keccak256(sorted[i]->code.data, sorted[i]->code.size);
+      __builtin___memcpy_chk(refs[ref_count].hash, hash.bytes, HASH_SIZE, HASH_SIZE);
+      refs[ref_count].account = i;
+      ref_count++;
+    }
+  }
+  if (ref_count > 1) {
+    qsort(refs, ref_count, sizeof(*refs), compare_code_refs);
+  }
+  size_t code_count = 0;
+  size_t code_bytes = 0;
+  for (size_t i = 0; i < ref_count; i++) {
+    if (i == 0 || memcmp(refs[i].hash, refs[i - 1].hash, HASH_SIZE) != 0) {
+      code_count++;
+      code_bytes += sorted[refs[i].account]->code.size;
+    }
+    code_index[refs[i].account] = (uint32_t)(code_count - 1);
+  }
+  if (code_count >= NO_CODE) {
+    return json_err(JSON_ERR_OVERFLOW, "too many distinct codes");
+  }
+
+  bin_layout_t layout;
+  if (!bin_layout(account_count, code_count, storage_count, code_bytes, &layout)) {
+    return json_err(JSON_ERR_OVERFLOW, "snapshot too large");
+  }
+  uint8_t *const data = div0_arena_alloc_array(arena, layout.total, 1, BIN_ALIGNMENT);
+  if (data == nullptr) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate snapshot buffer");
+  }
+
+  bin_header_t *const header = (bin_header_t *)data;
+  __builtin___memset_chk(header, 0, sizeof(*header), sizeof(*header));
+  __builtin___memcpy_chk(header->magic, BIN_MAGIC, sizeof(BIN_MAGIC), sizeof(header->magic));
+  header->version = T8N_ALLOC_BIN_VERSION;
+  header->account_count = account_count;
+  header->code_count = code_count;
+  header->storage_count = storage_count;
+  header->code_bytes = code_bytes;
+
+  // Code table and blob, in hash order
+  bin_code_t *const codes = (bin_code_t *)(data + layout.codes);
+  uint8_t *const blob = data + layout.blob;
+  size_t blob_offset = 0;
+  for (size_t i = 0; i < ref_count; i++) {
+    if (i > 0 && memcmp(refs[i].hash, refs[i - 1].hash, HASH_SIZE) == 0) {
+      continue;
+    }
+    const bytes_t *const code = &sorted[refs[i].account]->code;
+    bin_code_t *const entry = &codes[code_index[refs[i].account]];
+    __builtin___memcpy_chk(entry->hash, refs[i].hash, HASH_SIZE, sizeof(entry->hash));
+    entry->offset = blob_offset;
+    entry->size = code->size;
+    __builtin___memcpy_chk(blob + blob_offset, code->data, code->size, code_bytes - blob_offset);
+    blob_offset += code->size;
+  }
+
+  // Accounts and their storage ranges, in address order
+  bin_account_t *const accounts = (bin_account_t *)(data + layout.accounts);
+  storage_entry_t *const storage = (storage_entry_t *)(data + layout.storage);
+  size_t storage_offset = 0;
+  for (size_t i = 0; i < account_count; i++) {
+    const account_snapshot_t *const account = sorted[i];
+    bin_account_t *const record = &accounts[i];
+    __builtin___memset_chk(record, 0, sizeof(*record), sizeof(*record));
+    record->balance = account->balance;
+    record->address = account->address;
+    record->code_index = code_index[i];
+    record->nonce = account->nonce;
+    record->storage_offset = storage_offset;
+    record->storage_count = account->storage_count;
+
+    storage_entry_t *const range = storage + storage_offset;
+    for (size_t j = 0; j < account->storage_count; j++) {
+      range[j] = account->storage[j];
+    }
+    if (account->storage_count > 1) {
+      qsort(range, account->storage_count, sizeof(*range), compare_slots);
+    }
+    storage_offset += account->storage_count;
+  }
+
+  out->data = data;
+  out->size = layout.total;
+  out->capacity = layout.total;
+  out->arena = arena;
+  return json_ok();
+}
+
+// ============================================================================
+// Import
+// ============================================================================
+
+json_result_t t8n_parse_alloc_bin(uint8_t *const data, const size_t len,
+                                  div0_arena_t *const arena, state_snapshot_t *const out) {
+  if (len < sizeof(bin_header_t)) {
+    return json_err(JSON_ERR_PARSE, "snapshot shorter than header");
+  }
+  if (((uintptr_t)data & (BIN_ALIGNMENT - 1)) != 0) {
+    return json_err(JSON_ERR_PARSE, "snapshot buffer is not 8-byte aligned");
+  }
+  const bin_header_t *const header = (const bin_header_t *)data;
+  if (memcmp(header->magic, BIN_MAGIC, sizeof(BIN_MAGIC)) != 0) {
+    return json_err(JSON_ERR_PARSE, "not a binary alloc snapshot");
+  }
+  if (header->version != T8N_ALLOC_BIN_VERSION) {
+    return json_err(JSON_ERR_PARSE, "unsupported snapshot version");
+  }
+
+  bin_layout_t layout;
+  if (!bin_layout(header->account_count, header->code_count, header->storage_count,
+                  header->code_bytes, &layout) ||
+      layout.total != len) {
+    return json_err(JSON_ERR_PARSE, "snapshot size does not match header");
+  }
+
+  const bin_code_t *const codes = (const bin_code_t *)(data + layout.codes);
+  for (uint64_t i = 0; i < header->code_count; i++) {
+    if (codes[i].offset > header->code_bytes ||
+        codes[i].size > header->code_bytes - codes[i].offset) {
+      return json_err(JSON_ERR_PARSE, "code entry out of range");
+    }
+  }
+
+  out->accounts = nullptr;
+  out->account_count = header->account_count;
+  if (header->account_count == 0) {
+    return json_ok();
+  }
+  out->accounts = div0_arena_alloc_array(arena, header->account_count, sizeof(account_snapshot_t),
+                                         alignof(account_snapshot_t));
+  if (out->accounts == nullptr) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate accounts");
+  }
+
+  const bin_account_t *const records = (const bin_account_t *)(data + layout.accounts);
+  storage_entry_t *const storage = (storage_entry_t *)(data + layout.storage);
+  uint8_t *const blob = data + layout.blob;
+  for (uint64_t i = 0; i < header->account_count; i++) {
+    const bin_account_t *const record = &records[i];
+    account_snapshot_t *const account = &out->accounts[i];
+    account->address = record->address;
+    account->balance = record->balance;
+    account->nonce = record->nonce;
+
+    if (record->storage_offset > header->storage_count ||
+        record->storage_count > header->storage_count - record->storage_offset) {
+      return json_err(JSON_ERR_PARSE, "storage range out of range");
+    }
+    account->storage = record->storage_count > 0 ? storage + record->storage_offset : nullptr;
+    account->storage_count = record->storage_count;
+
+    // Arena-tagged view: bytes_free is a no-op, the mapping owns the bytes
+    account->code = (bytes_t){.data = nullptr, .size = 0, .capacity = 0, .arena = arena};
+    if (record->code_index != NO_CODE) {
+      if (record->code_index >= header->code_count) {
+        return json_err(JSON_ERR_PARSE, "code index out of range");
+      }
+      const bin_code_t *const code = &codes[record->code_index];
+      account->code.data = blob + code->offset;
+      account->code.size = code->size;
+      account->code.capacity = code->size;
+    }
+  }
+  return json_ok();
+}
+
+// ============================================================================
+// Files
+// ============================================================================
+
+json_result_t t8n_alloc_bin_map(const char *const path, t8n_alloc_bin_file_t *const file) {
+  file->data = nullptr;
+  file->size = 0;
+
+  const int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return json_err(JSON_ERR_IO, "failed to open file");
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    return json_err(JSON_ERR_IO, "failed to stat file or file is empty");
+  }
+
+  // Private writable mapping: storage arrays are exposed as mutable pointers,
+  // any write stays in this process and never reaches the file.
+  const size_t size = (size_t)st.st_size;
+  void *const data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return json_err(JSON_ERR_IO, "failed to map file");
+  }
+  // Import touches every account record right away
+  (void)madvise(data, size, MADV_WILLNEED);
+
+  file->data = data;
+  file->size = size;
+  return json_ok();
+}
+
+void t8n_alloc_bin_unmap(t8n_alloc_bin_file_t *const file) {
+  if (file->data != nullptr) {
+    (void)munmap(file->data, file->size);
+    file->data = nullptr;
+    file->size = 0;
+  }
+}
+
+json_result_t t8n_write_alloc_bin_file(const state_snapshot_t *const snapshot,
+                                       div0_arena_t *const arena, const char *const path) {
+  bytes_t encoded;
+  const json_result_t result = t8n_alloc_bin_encode(snapshot, arena, &encoded);
+  if (result.error != JSON_OK) {
+    return result;
+  }
+
+  FILE *const fp = fopen(path, "wb");
+  if (fp == nullptr) {
+    return json_err(JSON_ERR_IO, "failed to open file for writing");
+  }
+  const bool written = fwrite(encoded.data, 1, encoded.size, fp) == encoded.size;
+  if (fclose(fp) != 0 || !written) {
+    return json_err(JSON_ERR_IO, "failed to write file");
+  }
+  return json_ok();
+}
+
+#endif // DIV0_FREESTANDING
@@ -267,4 +267,300 @@ json_result_t t8n_parse_env_file(const char *const path, div0_arena_t *const are
   return result;
 }
 
+// ============================================================================
+// Single-Pass Parsing Helpers
+// ============================================================================
+
+static json_result_t read_block_hashes(json_reader_t *const r, div0_arena_t *const arena,
+                                       t8n_env_t *const out) {
+  // Anything but an object is ignored, as in parse_block_hashes
+  const size_t count = json_reader_count(r);
+  if (json_reader_peek(r) != JSON_TOKEN_OBJ || count == 0) {
+    (void)json_reader_skip(r);
+    return json_reader_result(r);
+  }
+
+  out->block_hashes = div0_arena_alloc(arena, count * sizeof(t8n_block_hash_t));
+  if (out->block_hashes == nullptr) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate block hashes");
+  }
+
+  (void)json_reader_obj_begin(r);
+  const char *key;
+  size_t key_len;
+  size_t idx = 0;
+  while (json_reader_obj_next(r, &key, &key_len)) {
+    if (idx == count) {
+      return json_err(JSON_ERR_PARSE, "malformed blockHashes object");
+    }
+    t8n_block_hash_t *const entry = &out->block_hashes[idx];
+
+    // Parse block number from key (can be decimal or hex)
+    char num_str[32];
+    if (!json_reader_copy_str(key, key_len, num_str, sizeof(num_str))) {
+      return json_err(JSON_ERR_INVALID_HEX, "invalid block number key");
+    }
+    if (!hex_decode_u64(num_str, &entry->number)) {
+      // Try decimal
+      char *end;
+      entry->number = strtoull(num_str, &end, 10);
+      if (*end != '\0') {
+        return json_err(JSON_ERR_INVALID_HEX, "invalid block number key");
+      }
+    }
+
+    if (!json_reader_hex_hash(r, &entry->hash)) {
+      return json_reader_err(r, JSON_ERR_INVALID_HEX, "invalid block hash value");
+    }
+    idx++;
+  }
+  out->block_hash_count = idx;
+  return json_reader_result(r);
+}
+
+static json_result_t read_withdrawals(json_reader_t *const r, div0_arena_t *const arena,
+                                      t8n_env_t *const out) {
+  const size_t count = json_reader_count(r);
+  if (json_reader_peek(r) != JSON_TOKEN_ARR || count == 0) {
+    (void)json_reader_skip(r);
+    return json_reader_result(r);
+  }
+
+  out->withdrawals = div0_arena_alloc(arena, count * sizeof(t8n_withdrawal_t));
+  if (out->withdrawals == nullptr) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate withdrawals");
+  }
+
+  (void)json_reader_arr_begin(r);
+  size_t idx = 0;
+  while (json_reader_arr_next(r)) {
+    if (idx == count) {
+      return json_err(JSON_ERR_PARSE, "malformed withdrawals array");
+    }
+    if (json_reader_peek(r) != JSON_TOKEN_OBJ) {
+      return json_reader_err(r, JSON_ERR_INVALID_TYPE, "withdrawal must be an object");
+    }
+
+    t8n_withdrawal_t *const w = &out->withdrawals[idx];
+    bool has_index = false;
+    bool has_validator_index = false;
+    bool has_address = false;
+    bool has_amount = false;
+
+    (void)json_reader_obj_begin(r);
+    const char *key;
+    size_t key_len;
+    while (json_reader_obj_next(r, &key, &key_len)) {
+      if (json_reader_key_eq(key, key_len, "index")) {
+        has_index = json_reader_hex_u64(r, &w->index);
+      } else if (json_reader_key_eq(key, key_len, "validatorIndex")) {
+        has_validator_index = json_reader_hex_u64(r, &w->validator_index);
+      } else if (json_reader_key_eq(key, key_len, "address")) {
+        has_address = json_reader_hex_address(r, &w->address);
+      } else if (json_reader_key_eq(key, key_len, "amount")) {
+        has_amount = json_reader_hex_u64(r, &w->amount);
+      } else {
+        (void)json_reader_skip(r);
+      }
+    }
+
+    if (!json_reader_ok(r)) {
+      return json_reader_result(r);
+    }
+    if (!has_index) {
+      return json_err(JSON_ERR_MISSING_FIELD, "missing withdrawal index");
+    }
+    if (!has_validator_index) {
+      return json_err(JSON_ERR_MISSING_FIELD, "missing withdrawal validatorIndex");
+    }
+    if (!has_address) {
+      return json_err(JSON_ERR_MISSING_FIELD, "missing withdrawal address");
+    }
+    if (!has_amount) {
+      return json_err(JSON_ERR_MISSING_FIELD, "missing withdrawal amount");
+    }
+    idx++;
+  }
+  out->withdrawal_count = idx;
+  return json_reader_result(r);
+}
+
+static json_result_t read_ommers(json_reader_t *const r, div0_arena_t *const arena,
+                                 t8n_env_t *const out) {
+  const size_t count = json_reader_count(r);
+  if (json_reader_peek(r) != JSON_TOKEN_ARR || count == 0) {
+    (void)json_reader_skip(r);
+    return json_reader_result(r);
+  }
+
+  out->ommers = div0_arena_alloc(arena, count * sizeof(t8n_ommer_t));
+  if (out->ommers == nullptr) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate ommers");
+  }
+
+  (void)json_reader_arr_begin(r);
+  size_t idx = 0;
+  while (json_reader_arr_next(r)) {
+    if (idx == count) {
+      return json_err(JSON_ERR_PARSE, "malformed ommers array");
+    }
+    if (json_reader_peek(r) != JSON_TOKEN_OBJ) {
+      return json_reader_err(r, JSON_ERR_INVALID_TYPE, "ommer must be an object");
+    }
+
+    t8n_ommer_t *const o = &out->ommers[idx];
+    bool has_address = false;
+    bool has_delta = false;
+
+    (void)json_reader_obj_begin(r);
+    const char *key;
+    size_t key_len;
+    while (json_reader_obj_next(r, &key, &key_len)) {
+      if (json_reader_key_eq(key, key_len, "address")) {
+        has_address = json_reader_hex_address(r, &o->coinbase);
+      } else if (json_reader_key_eq(key, key_len, "delta")) {
+        has_delta = json_reader_hex_u64(r, &o->delta);
+      } else {
+        (void)json_reader_skip(r);
+      }
+    }
+
+    if (!json_reader_ok(r)) {
+      return json_reader_result(r);
+    }
+    if (!has_address) {
+      return json_err(JSON_ERR_MISSING_FIELD, "missing ommer address");
+    }
+    if (!has_delta) {
+      return json_err(JSON_ERR_MISSING_FIELD, "missing ommer delta");
+    }
+    idx++;
+  }
+  out->ommer_count = idx;
+  return json_reader_result(r);
+}
+
+// ============================================================================
+// Single-Pass Parsing Implementation
+// ============================================================================
+
+json_result_t t8n_read_env(json_reader_t *const r, div0_arena_t *const arena,
+                           t8n_env_t *const out) {
+  if (json_reader_peek(r) != JSON_TOKEN_OBJ) {
+    return json_reader_err(r, JSON_ERR_INVALID_TYPE, "env must be an object");
+  }
+
+  t8n_env_init(out);
+
+  bool has_coinbase = false;
+  bool has_gas_limit = false;
+  bool has_number = false;
+  bool has_timestamp = false;
+  bool has_current_random = false; // currentRandom takes precedence over prevRandao
+  uint256_t randao;
+  json_result_t result = json_ok();
+
+  (void)json_reader_obj_begin(r);
+  const char *key;
+  size_t key_len;
+  while (json_is_ok(result) && json_reader_obj_next(r, &key, &key_len)) {
+    // Required fields
+    if (json_reader_key_eq(key, key_len, "currentCoinbase")) {
+      has_coinbase = json_reader_hex_address(r, &out->coinbase);
+    } else if (json_reader_key_eq(key, key_len, "currentGasLimit")) {
+      has_gas_limit = json_reader_hex_u64(r, &out->gas_limit);
+    } else if (json_reader_key_eq(key, key_len, "currentNumber")) {
+      has_number = json_reader_hex_u64(r, &out->number);
+    } else if (json_reader_key_eq(key, key_len, "currentTimestamp")) {
+      has_timestamp = json_reader_hex_u64(r, &out->timestamp);
+    }
+    // Optional fields - difficulty/randao
+    else if (json_reader_key_eq(key, key_len, "currentDifficulty")) {
+      out->has_difficulty = json_reader_hex_uint256(r, &out->difficulty);
+    } else if (json_reader_key_eq(key, key_len, "currentRandom")) {
+      has_current_random = json_reader_hex_uint256(r, &randao);
+      if (has_current_random) {
+        out->prev_randao = randao;
+        out->has_prev_randao = true;
+      }
+    } else if (json_reader_key_eq(key, key_len, "prevRandao")) {
+      if (json_reader_hex_uint256(r, &randao) && !has_current_random) {
+        out->prev_randao = randao;
+        out->has_prev_randao = true;
+      }
+    }
+    // Optional fields - EIP-1559, EIP-4844, EIP-4788
+    else if (json_reader_key_eq(key, key_len, "currentBaseFee")) {
+      out->has_base_fee = json_reader_hex_uint256(r, &out->base_fee);
+    } else if (json_reader_key_eq(key, key_len, "currentExcessBlobGas")) {
+      out->has_excess_blob_gas = json_reader_hex_u64(r, &out->excess_blob_gas);
+    } else if (json_reader_key_eq(key, key_len, "currentBlobGasUsed")) {
+      out->has_blob_gas_used = json_reader_hex_u64(r, &out->blob_gas_used);
+    } else if (json_reader_key_eq(key, key_len, "parentBeaconBlockRoot")) {
+      out->has_parent_beacon_root = json_reader_hex_hash(r, &out->parent_beacon_root);
+    }
+    // Parent fields for base fee calculation
+    else if (json_reader_key_eq(key, key_len, "parentBaseFee")) {
+      out->has_parent_base_fee = json_reader_hex_uint256(r, &out->parent_base_fee);
+    } else if (json_reader_key_eq(key, key_len, "parentGasUsed")) {
+      out->has_parent_gas_used = json_reader_hex_u64(r, &out->parent_gas_used);
+    } else if (json_reader_key_eq(key, key_len, "parentGasLimit")) {
+      out->has_parent_gas_limit = json_reader_hex_u64(r, &out->parent_gas_limit);
+    } else if (json_reader_key_eq(key, key_len, "parentExcessBlobGas")) {
+      out->has_parent_excess_blob_gas = json_reader_hex_u64(r, &out->parent_excess_blob_gas);
+    } else if (json_reader_key_eq(key, key_len, "parentBlobGasUsed")) {
+      out->has_parent_blob_gas_used = json_reader_hex_u64(r, &out->parent_blob_gas_used);
+    }
+    // Arrays
+    else if (json_reader_key_eq(key, key_len, "blockHashes")) {
+      result = read_block_hashes(r, arena, out);
+    } else if (json_reader_key_eq(key, key_len, "withdrawals")) {
+      result = read_withdrawals(r, arena, out);
+    } else if (json_reader_key_eq(key, key_len, "ommers")) {
+      result = read_ommers(r, arena, out);
+    } else {
+      (void)json_reader_skip(r);
+    }
+  }
+
+  if (json_is_err(result)) {
+    return result;
+  }
+  if (!json_reader_ok(r)) {
+    return json_reader_result(r);
+  }
+  if (!has_coinbase) {
+    return json_err(JSON_ERR_MISSING_FIELD, "missing currentCoinbase");
+  }
+  if (!has_gas_limit) {
+    return json_err(JSON_ERR_MISSING_FIELD, "missing currentGasLimit");
+  }
+  if (!has_number) {
+    return json_err(JSON_ERR_MISSING_FIELD, "missing currentNumber");
+  }
+  if (!has_timestamp) {
+    return json_err(JSON_ERR_MISSING_FIELD, "missing currentTimestamp");
+  }
+  return json_ok();
+}
+
+json_result_t t8n_read_env_file(const char *const path, div0_arena_t *const arena,
+                                t8n_env_t *const out) {
+  json_file_t file;
+  json_result_t result = json_file_map(path, &file);
+  if (json_is_err(result)) {
+    return result;
+  }
+
+  json_reader_t r;
+  json_reader_init(&r, file.data, file.size);
+  result = t8n_read_env(&r, arena, out);
+  if (json_is_ok(result)) {
+    result = json_reader_finish(&r);
+  }
+
+  json_file_unmap(&file);
+  return result;
+}
+
 #endif // DIV0_FREESTANDING
@@ -136,4 +136,131 @@ yyjson_mut_val_t *t8n_write_result(const t8n_result_t *const result, const json_
   return obj;
 }
 
+// ============================================================================
+// Streaming Serialization
+// ============================================================================
+
+void t8n_stream_log(const t8n_log_t *const log, json_stream_t *const s) {
+  json_stream_obj_begin(s);
+
+  json_stream_key(s, "address");
+  json_stream_hex_address(s, &log->address);
+
+  json_stream_key(s, "topics");
+  json_stream_arr_begin(s);
+  for (size_t i = 0; i < log->topic_count; i++) {
+    json_stream_hex_hash(s, &log->topics[i]);
+  }
+  json_stream_arr_end(s);
+
+  json_stream_key(s, "data");
+  json_stream_hex_bytes(s, log->data.data, log->data.size);
+
+  json_stream_obj_end(s);
+}
+
+void t8n_stream_receipt(const t8n_receipt_t *const receipt, json_stream_t *const s) {
+  json_stream_obj_begin(s);
+
+  json_stream_key(s, "type");
+  json_stream_hex_u64(s, receipt->type);
+  json_stream_key(s, "transactionHash");
+  json_stream_hex_hash(s, &receipt->tx_hash);
+  json_stream_key(s, "transactionIndex");
+  json_stream_hex_u64(s, receipt->transaction_index);
+  json_stream_key(s, "gasUsed");
+  json_stream_hex_u64(s, receipt->gas_used);
+  json_stream_key(s, "cumulativeGasUsed");
+  json_stream_hex_u64(s, receipt->cumulative_gas);
+  json_stream_key(s, "status");
+  json_stream_hex_u64(s, receipt->status ? 1 : 0);
+  json_stream_key(s, "logsBloom");
+  json_stream_hex_bytes(s, receipt->bloom, 256);
+
+  json_stream_key(s, "logs");
+  json_stream_arr_begin(s);
+  for (size_t i = 0; i < receipt->log_count; i++) {
+    t8n_stream_log(&receipt->logs[i], s);
+  }
+  json_stream_arr_end(s);
+
+  if (receipt->contract_address != nullptr) {
+    json_stream_key(s, "contractAddress");
+    json_stream_hex_address(s, receipt->contract_address);
+  }
+
+  json_stream_obj_end(s);
+}
+
+void t8n_stream_result(const t8n_result_t *const result, json_stream_t *const s) {
+  json_stream_obj_begin(s);
+
+  // Roots
+  json_stream_key(s, "stateRoot");
+  json_stream_hex_hash(s, &result->state_root);
+  json_stream_key(s, "txRoot");
+  json_stream_hex_hash(s, &result->tx_root);
+  json_stream_key(s, "receiptsRoot");
+  json_stream_hex_hash(s, &result->receipts_root);
+  json_stream_key(s, "logsHash");
+  json_stream_hex_hash(s, &result->logs_hash);
+  json_stream_key(s, "logsBloom");
+  json_stream_hex_bytes(s, result->logs_bloom, 256);
+
+  // Gas
+  json_stream_key(s, "gasUsed");
+  json_stream_hex_u64(s, result->gas_used);
+  if (result->has_blob_gas_used) {
+    json_stream_key(s, "blobGasUsed");
+    json_stream_hex_u64(s, result->blob_gas_used);
+  }
+
+  json_stream_key(s, "receipts");
+  json_stream_arr_begin(s);
+  for (size_t i = 0; i < result->receipt_count; i++) {
+    t8n_stream_receipt(&result->receipts[i], s);
+  }
+  json_stream_arr_end(s);
+
+  if (result->rejected_count > 0) {
+    json_stream_key(s, "rejected");
+    json_stream_arr_begin(s);
+    for (size_t i = 0; i < result->rejected_count; i++) {
+      json_stream_obj_begin(s);
+      json_stream_key(s, "index");
+      json_stream_u64(s, result->rejected[i].index);
+      if (result->rejected[i].error != nullptr) {
+        json_stream_key(s, "error");
+        json_stream_str(s, result->rejected[i].error);
+      }
+      json_stream_obj_end(s);
+    }
+    json_stream_arr_end(s);
+  }
+
+  // Optional fork-specific fields
+  if (result->has_current_difficulty) {
+    json_stream_key(s, "currentDifficulty");
+    json_stream_hex_uint256(s, &result->current_difficulty);
+  }
+  if (result->has_current_base_fee) {
+    json_stream_key(s, "currentBaseFee");
+    json_stream_hex_uint256(s, &result->current_base_fee);
+  }
+  if (result->has_withdrawals_root) {
+    json_stream_key(s, "withdrawalsRoot");
+    json_stream_hex_hash(s, &result->withdrawals_root);
+  }
+  if (result->has_current_excess_blob_gas) {
+    json_stream_key(s, "currentExcessBlobGas");
+    json_stream_hex_u64(s, result->current_excess_blob_gas);
+  }
+  if (result->has_requests_hash) {
+    json_stream_key(s, "requestsHash");
+    json_stream_hex_hash(s, &result->requests_hash);
+  }
+
+  json_stream_obj_end(s);
+}
+
 #endif // DIV0_FREESTANDING
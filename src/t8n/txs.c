@@ -2,6 +2,12 @@
 
 #ifndef DIV0_FREESTANDING
 
+#include "div0/ethereum/transaction/rlp.h"
+#include "div0/rlp/decode.h"
+#include "div0/util/hex.h"
+
+#include <string.h>
+
 // ============================================================================
 // Access List Parsing
 // ============================================================================
@@ -178,6 +184,7 @@ json_result_t t8n_parse_tx(yyjson_val_t *const obj, div0_arena_t *const arena,
   if (obj == nullptr || !json_is_obj(obj)) {
     return json_err(JSON_ERR_INVALID_TYPE, "transaction must be an object");
   }
+  transaction_clear_cache(out);
 
   // Determine transaction type
   uint64_t tx_type = 0;
@@ -505,6 +512,626 @@ json_result_t t8n_parse_txs_file(const char *const path, div0_arena_t *const are
   return result;
 }
 
+// ============================================================================
+// Single-Pass Parsing Helpers
+// ============================================================================
+
+static json_result_t read_access_list(json_reader_t *const r, div0_arena_t *const arena,
+                                      access_list_t *const out) {
+  access_list_init(out);
+
+  const size_t count = json_reader_count(r);
+  if (json_reader_peek(r) != JSON_TOKEN_ARR || count == 0) {
+    (void)json_reader_skip(r);
+    return json_reader_result(r);
+  }
+
+  if (!access_list_alloc_entries(out, count, arena)) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate access list");
+  }
+
+  (void)json_reader_arr_begin(r);
+  size_t idx = 0;
+  while (json_reader_arr_next(r)) {
+    if (idx == count) {
+      return json_err(JSON_ERR_PARSE, "malformed access list");
+    }
+    if (json_reader_peek(r) != JSON_TOKEN_OBJ) {
+      return json_reader_err(r, JSON_ERR_INVALID_TYPE, "access list entry must be an object");
+    }
+
+    access_list_entry_t *const entry = &out->entries[idx];
+    entry->storage_keys = nullptr;
+    entry->storage_keys_count = 0;
+    bool has_address = false;
+
+    (void)json_reader_obj_begin(r);
+    const char *key;
+    size_t key_len;
+    while (json_reader_obj_next(r, &key, &key_len)) {
+      if (json_reader_key_eq(key, key_len, "address")) {
+        has_address = json_reader_hex_address(r, &entry->address);
+      } else if (json_reader_key_eq(key, key_len, "storageKeys") &&
+                 json_reader_peek(r) == JSON_TOKEN_ARR) {
+        const size_t key_count = json_reader_count(r);
+        if (!access_list_entry_alloc_keys(entry, key_count, arena)) {
+          return json_err(JSON_ERR_ALLOC, "failed to allocate storage keys");
+        }
+        (void)json_reader_arr_begin(r);
+        size_t key_idx = 0;
+        while (json_reader_arr_next(r)) {
+          if (key_idx == key_count ||
+              !json_reader_hex_uint256(r, &entry->storage_keys[key_idx])) {
+            return json_reader_err(r, JSON_ERR_INVALID_HEX, "invalid storage key");
+          }
+          key_idx++;
+        }
+      } else {
+        (void)json_reader_skip(r);
+      }
+    }
+
+    if (!json_reader_ok(r)) {
+      return json_reader_result(r);
+    }
+    if (!has_address) {
+      return json_err(JSON_ERR_MISSING_FIELD, "missing access list entry address");
+    }
+    idx++;
+  }
+
+  return json_reader_result(r);
+}
+
+static json_result_t read_authorization_list(json_reader_t *const r, div0_arena_t *const arena,
+                                             authorization_list_t *const out) {
+  authorization_list_init(out);
+
+  const size_t count = json_reader_count(r);
+  if (json_reader_peek(r) != JSON_TOKEN_ARR || count == 0) {
+    (void)json_reader_skip(r);
+    return json_reader_result(r);
+  }
+
+  if (!authorization_list_alloc(out, count, arena)) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate authorization list");
+  }
+
+  (void)json_reader_arr_begin(r);
+  size_t idx = 0;
+  while (json_reader_arr_next(r)) {
+    if (idx == count) {
+      return json_err(JSON_ERR_PARSE, "malformed authorization list");
+    }
+    if (json_reader_peek(r) != JSON_TOKEN_OBJ) {
+      return json_reader_err(r, JSON_ERR_INVALID_TYPE, "authorization must be an object");
+    }
+
+    authorization_t *const auth = &out->entries[idx];
+    auth->chain_id = 0; // 0 = valid on any chain
+    auth->y_parity = 0;
+    bool has_address = false;
+    bool has_nonce = false;
+    bool has_y_parity = false;
+    bool has_r = false;
+    bool has_s = false;
+    uint64_t y;
+
+    (void)json_reader_obj_begin(r);
+    const char *key;
+    size_t key_len;
+    while (json_reader_obj_next(r, &key, &key_len)) {
+      if (json_reader_key_eq(key, key_len, "chainId")) {
+        if (!json_reader_hex_u64(r, &auth->chain_id)) {
+          auth->chain_id = 0;
+        }
+      } else if (json_reader_key_eq(key, key_len, "address")) {
+        has_address = json_reader_hex_address(r, &auth->address);
+      } else if (json_reader_key_eq(key, key_len, "nonce")) {
+        has_nonce = json_reader_hex_u64(r, &auth->nonce);
+      } else if (json_reader_key_eq(key, key_len, "yParity")) {
+        // yParity takes precedence over v
+        if (json_reader_hex_u64(r, &y)) {
+          auth->y_parity = (uint8_t)y;
+          has_y_parity = true;
+        }
+      } else if (json_reader_key_eq(key, key_len, "v")) {
+        if (json_reader_hex_u64(r, &y) && !has_y_parity) {
+          auth->y_parity = (uint8_t)(y & 1);
+        }
+      } else if (json_reader_key_eq(key, key_len, "r")) {
+        has_r = json_reader_hex_uint256(r, &auth->r);
+      } else if (json_reader_key_eq(key, key_len, "s")) {
+        has_s = json_reader_hex_uint256(r, &auth->s);
+      } else {
+        (void)json_reader_skip(r);
+      }
+    }
+
+    if (!json_reader_ok(r)) {
+      return json_reader_result(r);
+    }
+    if (!has_address) {
+      return json_err(JSON_ERR_MISSING_FIELD, "missing authorization address");
+    }
+    if (!has_nonce) {
+      return json_err(JSON_ERR_MISSING_FIELD, "missing authorization nonce");
+    }
+    if (!has_r) {
+      return json_err(JSON_ERR_MISSING_FIELD, "missing authorization r");
+    }
+    if (!has_s) {
+      return json_err(JSON_ERR_MISSING_FIELD, "missing authorization s");
+    }
+    idx++;
+  }
+
+  return json_reader_result(r);
+}
+
+static json_result_t read_blob_hashes(json_reader_t *const r, div0_arena_t *const arena,
+                                      hash_t **const out, size_t *const out_count) {
+  *out = nullptr;
+  *out_count = 0;
+
+  const size_t count = json_reader_count(r);
+  if (json_reader_peek(r) != JSON_TOKEN_ARR || count == 0) {
+    (void)json_reader_skip(r);
+    return json_reader_result(r);
+  }
+
+  *out = div0_arena_alloc(arena, count * sizeof(hash_t));
+  if (*out == nullptr) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate blob hashes");
+  }
+
+  (void)json_reader_arr_begin(r);
+  size_t idx = 0;
+  while (json_reader_arr_next(r)) {
+    if (idx == count || !json_reader_hex_hash(r, &(*out)[idx])) {
+      return json_reader_err(r, JSON_ERR_INVALID_HEX, "invalid blob hash");
+    }
+    idx++;
+  }
+
+  *out_count = idx;
+  return json_reader_result(r);
+}
+
+/// Fields of a transaction object. The type can come after any other field,
+/// so everything is collected first and assigned to the typed struct at the
+/// end of the object.
+typedef struct {
+  uint64_t type;
+  uint64_t chain_id;
+  uint64_t nonce;
+  uint64_t gas_limit;
+  uint64_t v;
+  uint64_t y_parity;
+  uint256_t gas_price;
+  uint256_t max_priority_fee_per_gas;
+  uint256_t max_fee_per_gas;
+  uint256_t max_fee_per_blob_gas;
+  uint256_t value;
+  uint256_t r;
+  uint256_t s;
+  bytes_t input;
+  bytes_t data;
+  address_t to;
+  access_list_t access_list;
+  authorization_list_t authorization_list;
+  hash_t *blob_hashes;
+  size_t blob_hash_count;
+  bool has_gas;      // "gas" takes precedence over "gasLimit"
+  bool has_v;        // "v" was valid
+  bool has_y_parity; // "yParity" was valid (takes precedence over v)
+  bool has_to;       // "to" present and not null
+  bool to_valid;     // "to" decoded
+} tx_fields_t;
+
+static json_result_t read_tx_fields(json_reader_t *const r, div0_arena_t *const arena,
+                                    tx_fields_t *const f) {
+  const char *key;
+  size_t key_len;
+  uint64_t u64;
+  while (json_reader_obj_next(r, &key, &key_len)) {
+    json_result_t result = json_ok();
+    if (json_reader_key_eq(key, key_len, "type")) {
+      if (!json_reader_hex_u64(r, &f->type)) {
+        f->type = 0;
+      }
+    } else if (json_reader_key_eq(key, key_len, "chainId")) {
+      (void)json_reader_hex_u64(r, &f->chain_id);
+    } else if (json_reader_key_eq(key, key_len, "nonce")) {
+      (void)json_reader_hex_u64(r, &f->nonce);
+    } else if (json_reader_key_eq(key, key_len, "gas")) {
+      if (json_reader_hex_u64(r, &u64)) {
+        f->gas_limit = u64;
+        f->has_gas = true;
+      }
+    } else if (json_reader_key_eq(key, key_len, "gasLimit")) {
+      if (json_reader_hex_u64(r, &u64) && !f->has_gas) {
+        f->gas_limit = u64;
+      }
+    } else if (json_reader_key_eq(key, key_len, "gasPrice")) {
+      (void)json_reader_hex_uint256(r, &f->gas_price);
+    } else if (json_reader_key_eq(key, key_len, "maxPriorityFeePerGas")) {
+      (void)json_reader_hex_uint256(r, &f->max_priority_fee_per_gas);
+    } else if (json_reader_key_eq(key, key_len, "maxFeePerGas")) {
+      (void)json_reader_hex_uint256(r, &f->max_fee_per_gas);
+    } else if (json_reader_key_eq(key, key_len, "maxFeePerBlobGas")) {
+      (void)json_reader_hex_uint256(r, &f->max_fee_per_blob_gas);
+    } else if (json_reader_key_eq(key, key_len, "value")) {
+      (void)json_reader_hex_uint256(r, &f->value);
+    } else if (json_reader_key_eq(key, key_len, "input")) {
+      (void)json_reader_hex_bytes(r, arena, &f->input);
+    } else if (json_reader_key_eq(key, key_len, "data")) {
+      (void)json_reader_hex_bytes(r, arena, &f->data);
+    } else if (json_reader_key_eq(key, key_len, "to")) {
+      f->has_to = !json_reader_null(r);
+      f->to_valid = f->has_to && json_reader_hex_address(r, &f->to);
+    } else if (json_reader_key_eq(key, key_len, "v")) {
+      f->has_v = json_reader_hex_u64(r, &f->v);
+    } else if (json_reader_key_eq(key, key_len, "yParity")) {
+      f->has_y_parity = json_reader_hex_u64(r, &f->y_parity);
+    } else if (json_reader_key_eq(key, key_len, "r")) {
+      (void)json_reader_hex_uint256(r, &f->r);
+    } else if (json_reader_key_eq(key, key_len, "s")) {
+      (void)json_reader_hex_uint256(r, &f->s);
+    } else if (json_reader_key_eq(key, key_len, "accessList")) {
+      result = read_access_list(r, arena, &f->access_list);
+    } else if (json_reader_key_eq(key, key_len, "authorizationList")) {
+      result = read_authorization_list(r, arena, &f->authorization_list);
+    } else if (json_reader_key_eq(key, key_len, "blobVersionedHashes")) {
+      result = read_blob_hashes(r, arena, &f->blob_hashes, &f->blob_hash_count);
+    } else {
+      (void)json_reader_skip(r);
+    }
+    if (json_is_err(result)) {
+      return result;
+    }
+  }
+  return json_reader_result(r);
+}
+
+/// Allocate the optional to address of a legacy, EIP-2930 or EIP-1559 tx.
+static json_result_t tx_optional_to(const tx_fields_t *const f, div0_arena_t *const arena,
+                                    address_t **const out) {
+  *out = nullptr;
+  if (!f->has_to) {
+    return json_ok();
+  }
+  if (!f->to_valid) {
+    return json_err(JSON_ERR_INVALID_HEX, "invalid to address");
+  }
+  *out = div0_arena_alloc(arena, sizeof(address_t));
+  if (*out == nullptr) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate to address");
+  }
+  **out = f->to;
+  return json_ok();
+}
+
+/// Signature parity of a typed transaction: yParity, else the low bit of v.
+static uint8_t tx_y_parity(const tx_fields_t *const f) {
+  if (f->has_y_parity) {
+    return (uint8_t)f->y_parity;
+  }
+  return f->has_v ? (uint8_t)(f->v & 1) : 0;
+}
+
+// ============================================================================
+// Single-Pass Parsing
+// ============================================================================
+
+json_result_t t8n_read_tx(json_reader_t *const r, div0_arena_t *const arena,
+                          transaction_t *const out) {
+  if (json_reader_peek(r) != JSON_TOKEN_OBJ) {
+    return json_reader_err(r, JSON_ERR_INVALID_TYPE, "transaction must be an object");
+  }
+  (void)json_reader_obj_begin(r);
+  transaction_clear_cache(out);
+
+  tx_fields_t f;
+  __builtin___memset_chk(&f, 0, sizeof(f), sizeof(f));
+  access_list_init(&f.access_list);
+  authorization_list_init(&f.authorization_list);
+
+  json_result_t result = read_tx_fields(r, arena, &f);
+  if (json_is_err(result)) {
+    return result;
+  }
+  const bytes_t data = f.input.size > 0 ? f.input : f.data;
+
+  switch (f.type) {
+  case 0: {
+    out->type = TX_TYPE_LEGACY;
+    legacy_tx_t *const tx = &out->legacy;
+    legacy_tx_init(tx);
+    tx->nonce = f.nonce;
+    tx->gas_price = f.gas_price;
+    tx->gas_limit = f.gas_limit;
+    tx->value = f.value;
+    tx->data = data;
+    tx->v = f.v;
+    tx->r = f.r;
+    tx->s = f.s;
+    return tx_optional_to(&f, arena, &tx->to);
+  }
+
+  case 1: {
+    out->type = TX_TYPE_EIP2930;
+    eip2930_tx_t *const tx = &out->eip2930;
+    eip2930_tx_init(tx);
+    tx->chain_id = f.chain_id;
+    tx->nonce = f.nonce;
+    tx->gas_price = f.gas_price;
+    tx->gas_limit = f.gas_limit;
+    tx->value = f.value;
+    tx->data = data;
+    tx->access_list = f.access_list;
+    tx->y_parity = tx_y_parity(&f);
+    tx->r = f.r;
+    tx->s = f.s;
+    return tx_optional_to(&f, arena, &tx->to);
+  }
+
+  case 2: {
+    out->type = TX_TYPE_EIP1559;
+    eip1559_tx_t *const tx = &out->eip1559;
+    eip1559_tx_init(tx);
+    tx->chain_id = f.chain_id;
+    tx->nonce = f.nonce;
+    tx->max_priority_fee_per_gas = f.max_priority_fee_per_gas;
+    tx->max_fee_per_gas = f.max_fee_per_gas;
+    tx->gas_limit = f.gas_limit;
+    tx->value = f.value;
+    tx->data = data;
+    tx->access_list = f.access_list;
+    tx->y_parity = tx_y_parity(&f);
+    tx->r = f.r;
+    tx->s = f.s;
+    return tx_optional_to(&f, arena, &tx->to);
+  }
+
+  case 3: {
+    if (!f.to_valid) {
+      return json_err(JSON_ERR_MISSING_FIELD, "blob transaction requires to address");
+    }
+    out->type = TX_TYPE_EIP4844;
+    eip4844_tx_t *const tx = &out->eip4844;
+    eip4844_tx_init(tx);
+    tx->chain_id = f.chain_id;
+    tx->nonce = f.nonce;
+    tx->max_priority_fee_per_gas = f.max_priority_fee_per_gas;
+    tx->max_fee_per_gas = f.max_fee_per_gas;
+    tx->gas_limit = f.gas_limit;
+    tx->to = f.to;
+    tx->value = f.value;
+    tx->data = data;
+    tx->access_list = f.access_list;
+    tx->max_fee_per_blob_gas = f.max_fee_per_blob_gas;
+    tx->blob_versioned_hashes = f.blob_hashes;
+    tx->blob_hashes_count = f.blob_hash_count;
+    tx->y_parity = tx_y_parity(&f);
+    tx->r = f.r;
+    tx->s = f.s;
+    return json_ok();
+  }
+
+  case 4: {
+    if (!f.to_valid) {
+      return json_err(JSON_ERR_MISSING_FIELD, "EIP-7702 transaction requires to address");
+    }
+    out->type = TX_TYPE_EIP7702;
+    eip7702_tx_t *const tx = &out->eip7702;
+    eip7702_tx_init(tx);
+    tx->chain_id = f.chain_id;
+    tx->nonce = f.nonce;
+    tx->max_priority_fee_per_gas = f.max_priority_fee_per_gas;
+    tx->max_fee_per_gas = f.max_fee_per_gas;
+    tx->gas_limit = f.gas_limit;
+    tx->to = f.to;
+    tx->value = f.value;
+    tx->data = data;
+    tx->access_list = f.access_list;
+    tx->authorization_list = f.authorization_list;
+    tx->y_parity = tx_y_parity(&f);
+    tx->r = f.r;
+    tx->s = f.s;
+    return json_ok();
+  }
+
+  default:
+    return json_err(JSON_ERR_INVALID_TYPE, "unsupported transaction type");
+  }
+}
+
+json_result_t t8n_read_txs(json_reader_t *const r, div0_arena_t *const arena,
+                           t8n_txs_t *const out) {
+  out->txs = nullptr;
+  out->tx_count = 0;
+  if (json_reader_peek(r) != JSON_TOKEN_ARR) {
+    return json_reader_err(r, JSON_ERR_INVALID_TYPE, "txs must be an array");
+  }
+
+  const size_t count = json_reader_count(r);
+  if (count > 0) {
+    out->txs = div0_arena_alloc(arena, count * sizeof(transaction_t));
+    if (out->txs == nullptr) {
+      return json_err(JSON_ERR_ALLOC, "failed to allocate transactions");
+    }
+  }
+
+  (void)json_reader_arr_begin(r);
+  size_t idx = 0;
+  while (json_reader_arr_next(r)) {
+    if (idx == count) {
+      return json_err(JSON_ERR_PARSE, "malformed txs array");
+    }
+    const json_result_t result = t8n_read_tx(r, arena, &out->txs[idx]);
+    if (json_is_err(result)) {
+      return result;
+    }
+    idx++;
+  }
+
+  out->tx_count = idx;
+  return json_reader_result(r);
+}
+
+json_result_t t8n_read_txs_file(const char *const path, div0_arena_t *const arena,
+                                t8n_txs_t *const out) {
+  json_file_t file;
+  json_result_t result = json_file_map(path, &file);
+  if (json_is_err(result)) {
+    return result;
+  }
+
+  json_reader_t r;
+  json_reader_init(&r, file.data, file.size);
+  result = t8n_read_txs(&r, arena, out);
+  if (json_is_ok(result)) {
+    result = json_reader_finish(&r);
+  }
+
+  json_file_unmap(&file);
+  return result;
+}
+
+// ============================================================================
+// RLP Input
+// ============================================================================
+
+bool t8n_txs_is_rlp_path(const char *const path) {
+  const size_t len = strlen(path);
+  return len >= 4 && strcmp(path + len - 4, ".rlp") == 0;
+}
+
+json_result_t t8n_parse_txs_rlp(const uint8_t *const data, const size_t len,
+                                div0_arena_t *const arena, t8n_txs_t *const out) {
+  out->txs = nullptr;
+  out->tx_count = 0;
+
+  rlp_decoder_t dec;
+  rlp_decoder_init(&dec, data, len);
+  const rlp_list_result_t header = rlp_decode_list_header(&dec);
+  if (header.error != RLP_SUCCESS || header.payload_length != rlp_decoder_remaining(&dec)) {
+    return json_err(JSON_ERR_PARSE, "transactions must be a single RLP list");
+  }
+
+  // Count first, so the transactions are a single allocation
+  const size_t start = dec.pos;
+  size_t count = 0;
+  while (rlp_decoder_has_more(&dec)) {
+    rlp_skip_item(&dec);
+    count++;
+  }
+  if (count == 0) {
+    return json_ok();
+  }
+  out->txs = div0_arena_alloc_array(arena, count, sizeof(transaction_t), alignof(transaction_t));
+  if (out->txs == nullptr) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate transactions");
+  }
+
+  dec.pos = start;
+  for (size_t i = 0; i < count; i++) {
+    // Legacy transactions are lists, typed ones byte strings holding type || payload
+    const uint8_t *tx_data = data + dec.pos;
+    size_t tx_len;
+    if (rlp_decoder_next_is_list(&dec)) {
+      rlp_skip_item(&dec);
+      tx_len = (size_t)(data + dec.pos - tx_data);
+    } else {
+      const rlp_bytes_result_t bytes = rlp_decode_bytes(&dec);
+      if (bytes.error != RLP_SUCCESS) {
+        return json_err(JSON_ERR_PARSE, "invalid RLP transaction envelope");
+      }
+      tx_data = bytes.data;
+      tx_len = bytes.len;
+    }
+
+    const tx_decode_result_t result = transaction_decode_view(tx_data, tx_len, &out->txs[i], arena);
+    if (result.error != TX_DECODE_OK) {
+      return json_err(JSON_ERR_PARSE, tx_decode_error_string(result.error));
+    }
+    if (result.bytes_consumed != tx_len) {
+      return json_err(JSON_ERR_PARSE, "trailing data after RLP transaction");
+    }
+  }
+
+  out->tx_count = count;
+  return json_ok();
+}
+
+/// Decode hex text (geth's txs.rlp: a JSON string holding the hex-encoded
+/// list) into an arena buffer.
+static json_result_t decode_rlp_hex(const char *text, size_t len, div0_arena_t *const arena,
+                                    const uint8_t **const out, size_t *const out_len) {
+  while (len > 0 && (text[len - 1] == '\n' || text[len - 1] == '\r' || text[len - 1] == ' ' ||
+                     text[len - 1] == '\t')) {
+    len--;
+  }
+  if (text[0] == '"') {
+    if (len < 2 || text[len - 1] != '"') {
+      return json_err(JSON_ERR_PARSE, "unterminated RLP hex string");
+    }
+    text++;
+    len -= 2;
+  }
+  if (len >= 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+    text += 2;
+    len -= 2;
+  }
+  if (len == 0 || len % 2 != 0) {
+    return json_err(JSON_ERR_INVALID_HEX, "invalid RLP hex string");
+  }
+
+  uint8_t *const bytes = div0_arena_alloc_array(arena, len / 2, 1, 1);
+  if (bytes == nullptr) {
+    return json_err(JSON_ERR_ALLOC, "failed to allocate RLP buffer");
+  }
+  if (!hex_decode_digits(text, bytes, len / 2)) {
+    return json_err(JSON_ERR_INVALID_HEX, "invalid RLP hex string");
+  }
+  *out = bytes;
+  *out_len = len / 2;
+  return json_ok();
+}
+
+json_result_t t8n_parse_txs_rlp_file(const char *const path, div0_arena_t *const arena,
+                                     json_file_t *const file, t8n_txs_t *const out) {
+  json_result_t result = json_file_map(path, file);
+  if (json_is_err(result)) {
+    return result;
+  }
+
+  const char *text = file->data;
+  size_t size = file->size;
+  while (size > 0 && (*text == ' ' || *text == '\n' || *text == '\r' || *text == '\t')) {
+    text++;
+    size--;
+  }
+  if (size == 0) {
+    return json_err(JSON_ERR_PARSE, "empty RLP input");
+  }
+
+  // A binary RLP list starts with a byte >= 0xc0, never with '"' or a digit
+  if (*text != '"' && *text != '0') {
+    return t8n_parse_txs_rlp((const uint8_t *)text, size, arena, out);
+  }
+
+  const uint8_t *data;
+  size_t len;
+  result = decode_rlp_hex(text, size, arena, &data, &len);
+  json_file_unmap(file); // The transactions point into the decoded copy
+  if (json_is_err(result)) {
+    return result;
+  }
+  return t8n_parse_txs_rlp(data, len, arena, out);
+}
+
 // ============================================================================
 // Serialization Helpers
 // ============================================================================
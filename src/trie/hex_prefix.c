@@ -17,7 +17,7 @@ bytes_t hex_prefix_encode(const nibbles_t *const nibbles, const bool is_leaf,
   // - 1 byte for prefix (contains flags + optional first nibble if odd)
   // - (nibbles->len / 2) bytes for remaining nibble pairs
   // - If even, we have an extra padding nibble in the first byte
-  const size_t encoded_len = 1 + ((nibbles->len + 1) / 2);
+  const size_t encoded_len = 1 + (nibbles->len / 2);
 
   if (!bytes_reserve(&result, encoded_len)) {
     return result; // Empty on allocation failure
@@ -32,24 +32,26 @@ bytes_t hex_prefix_encode(const nibbles_t *const nibbles, const bool is_leaf,
     flags |= HP_FLAG_ODD;
   }
 
+  // Odd: flags in high nibble, first nibble in low nibble
+  // Even: flags in high nibble, zero padding in low nibble
+  size_t next = 0;
+  uint8_t first_byte = (uint8_t)(flags << 4);
   if (is_odd) {
-    // Odd: flags in high nibble, first nibble in low nibble
-    const uint8_t first_byte = (uint8_t)((flags << 4) | nibbles->data[0]);
-    bytes_append_byte(&result, first_byte);
+    first_byte |= nibbles_get(nibbles, 0);
+    next = 1;
+  }
+  bytes_append_byte(&result, first_byte);
 
-    // Remaining nibbles as pairs
-    for (size_t i = 1; i < nibbles->len; i += 2) {
-      const uint8_t byte = (uint8_t)((nibbles->data[i] << 4) | nibbles->data[i + 1]);
-      bytes_append_byte(&result, byte);
-    }
+  // Remaining nibbles as pairs; byte-aligned views are copied directly
+  const size_t pair_bytes = (nibbles->len - next) / 2;
+  if (pair_bytes == 0) {
+    return result;
+  }
+  if (((nibbles->offset + next) & 1) == 0) {
+    bytes_append(&result, nibbles->data + ((nibbles->offset + next) >> 1), pair_bytes);
   } else {
-    // Even: flags in high nibble, zero padding in low nibble
-    const uint8_t first_byte = (uint8_t)(flags << 4);
-    bytes_append_byte(&result, first_byte);
-
-    // All nibbles as pairs
-    for (size_t i = 0; i < nibbles->len; i += 2) {
-      const uint8_t byte = (uint8_t)((nibbles->data[i] << 4) | nibbles->data[i + 1]);
+    for (size_t i = next; i < nibbles->len; i += 2) {
+      const uint8_t byte = (uint8_t)((nibbles_get(nibbles, i) << 4) | nibbles_get(nibbles, i + 1));
       bytes_append_byte(&result, byte);
     }
   }
@@ -92,27 +94,17 @@ hex_prefix_result_t hex_prefix_decode(const uint8_t *const data, const size_t le
     return result;
   }
 
-  // Allocate nibbles
-  uint8_t *const nibble_data = div0_arena_alloc(arena, nibble_count);
-  if (nibble_data == nullptr) {
-    return result;
-  }
-
-  size_t nibble_idx = 0;
-
-  if (is_odd) {
-    // First nibble from low nibble of first byte
-    nibble_data[nibble_idx++] = first_byte & 0x0F;
-  }
-
-  // Remaining bytes as nibble pairs
-  for (size_t i = 1; i < len; i++) {
-    nibble_data[nibble_idx++] = (data[i] >> 4) & 0x0F;
-    nibble_data[nibble_idx++] = data[i] & 0x0F;
+  // The encoded bytes already hold the packed path: view it in place, skipping
+  // the flag nibble (and the padding nibble when even).
+  const nibbles_t view = {.data = data, .offset = is_odd ? 1 : 2, .len = nibble_count};
+  if (arena == nullptr) {
+    result.nibbles = view;
+  } else {
+    result.nibbles = nibbles_copy(&view, arena);
+    if (result.nibbles.data == nullptr) {
+      return result;
+    }
   }
-
-  result.nibbles.data = nibble_data;
-  result.nibbles.len = nibble_count;
   result.success = true;
 
   return result;
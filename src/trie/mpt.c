@@ -35,17 +35,17 @@ void mpt_init(mpt_t *const mpt, mpt_backend_t *const backend, div0_arena_t *cons
 // Helper Functions
 // =============================================================================
 
-/// Find the position where two nibble sequences diverge.
+/// Find the position where a node path and the key (from offset) diverge.
 static size_t find_divergence(const nibbles_t *const path, const nibbles_t *const key,
                               const size_t offset) {
-  size_t i = 0;
-  while (i < path->len && (offset + i) < key->len) {
-    if (path->data[i] != key->data[offset + i]) {
-      break;
-    }
-    i++;
-  }
-  return i;
+  const nibbles_t rest = nibbles_slice(key, offset, SIZE_MAX, nullptr);
+  return nibbles_common_prefix(path, &rest);
+}
+
+/// Check whether the key (from offset) is exactly the given node path.
+static bool key_matches_path(const nibbles_t *const path, const nibbles_t *const key,
+                             const size_t offset) {
+  return key->len - offset == path->len && find_divergence(path, key, offset) == path->len;
 }
 
 /// Create a value copy in the backend's arena.
@@ -78,6 +78,36 @@ typedef enum {
   DELETE_REMOVED    // Node was completely removed
 } delete_result_t;
 
+// =============================================================================
+// Copy on Write
+// =============================================================================
+
+/// Return a node that can be modified in place. A shared node (one loaded
+/// once for several parents) is copied; its children gain the copy as a
+/// second parent, so they are shared from then on.
+/// @return The node itself, its copy, or nullptr if the copy fails
+static mpt_node_t *unshare(mpt_backend_t *const backend, mpt_node_t *const node) {
+  if (!node->shared) {
+    return node;
+  }
+  mpt_node_t *const copy = backend->vtable->alloc_node(backend);
+  if (copy == nullptr) {
+    return nullptr;
+  }
+  *copy = *node;
+  copy->shared = false;
+  if (node->type == MPT_NODE_EXTENSION && node->extension.child.node != nullptr) {
+    node->extension.child.node->shared = true;
+  } else if (node->type == MPT_NODE_BRANCH) {
+    for (size_t i = 0; i < 16; i++) {
+      if (node->branch.children[i].node != nullptr) {
+        node->branch.children[i].node->shared = true;
+      }
+    }
+  }
+  return copy;
+}
+
 // =============================================================================
 // Recursive Insert Implementation
 // =============================================================================
@@ -97,12 +127,17 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
     if (offset >= key->len) {
       *new_node = mpt_node_leaf(NIBBLES_EMPTY, copy_value(backend, value, value_len, arena));
     } else {
-      const nibbles_t remaining = nibbles_slice(key, offset, SIZE_MAX, arena);
+      const nibbles_t remaining = nibbles_slice(key, offset, SIZE_MAX, nullptr);
       *new_node = mpt_node_leaf(remaining, copy_value(backend, value, value_len, arena));
     }
     return new_node;
   }
 
+  node = unshare(backend, node);
+  if (node == nullptr) {
+    return nullptr;
+  }
+
   // If we've consumed the entire key but have an existing node, handle by type
   if (offset >= key->len) {
     switch (node->type) {
@@ -121,12 +156,12 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
       *branch = mpt_node_branch();
       branch->branch.value = copy_value(backend, value, value_len, arena);
 
-      const uint8_t old_nibble = node->leaf.path.data[0];
+      const uint8_t old_nibble = nibbles_get(&node->leaf.path, 0);
       mpt_node_t *const old_leaf = backend->vtable->alloc_node(backend);
       if (old_leaf == nullptr) {
         return nullptr;
       }
-      const nibbles_t old_remaining = nibbles_slice(&node->leaf.path, 1, SIZE_MAX, arena);
+      const nibbles_t old_remaining = nibbles_slice(&node->leaf.path, 1, SIZE_MAX, nullptr);
       *old_leaf = mpt_node_leaf(old_remaining, node->leaf.value);
       branch->branch.children[old_nibble] = mpt_node_ref(old_leaf, arena);
 
@@ -146,14 +181,14 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
       *branch = mpt_node_branch();
       branch->branch.value = copy_value(backend, value, value_len, arena);
 
-      const uint8_t ext_nibble = node->extension.path.data[0];
+      const uint8_t ext_nibble = nibbles_get(&node->extension.path, 0);
       if (node->extension.path.len > 1) {
         // Create shortened extension
         mpt_node_t *const new_ext = backend->vtable->alloc_node(backend);
         if (new_ext == nullptr) {
           return nullptr;
         }
-        const nibbles_t new_ext_path = nibbles_slice(&node->extension.path, 1, SIZE_MAX, arena);
+        const nibbles_t new_ext_path = nibbles_slice(&node->extension.path, 1, SIZE_MAX, nullptr);
         *new_ext = mpt_node_extension(new_ext_path, node->extension.child);
         branch->branch.children[ext_nibble] = mpt_node_ref(new_ext, arena);
       } else {
@@ -193,18 +228,18 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
       if (ext == nullptr) {
         return nullptr;
       }
-      const nibbles_t common_path = nibbles_slice(&node->leaf.path, 0, match_len, arena);
+      const nibbles_t common_path = nibbles_slice(&node->leaf.path, 0, match_len, nullptr);
 
       // Build the branch first
       if (match_len < node->leaf.path.len) {
         // Existing leaf becomes child of branch
-        const uint8_t old_nibble = node->leaf.path.data[match_len];
+        const uint8_t old_nibble = nibbles_get(&node->leaf.path, match_len);
         mpt_node_t *const old_leaf = backend->vtable->alloc_node(backend);
         if (old_leaf == nullptr) {
           return nullptr;
         }
         const nibbles_t old_remaining =
-            nibbles_slice(&node->leaf.path, match_len + 1, SIZE_MAX, arena);
+            nibbles_slice(&node->leaf.path, match_len + 1, SIZE_MAX, nullptr);
         *old_leaf = mpt_node_leaf(old_remaining, node->leaf.value);
         branch->branch.children[old_nibble] = mpt_node_ref(old_leaf, arena);
       } else {
@@ -214,8 +249,9 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
 
       if ((offset + match_len) < key->len) {
         // New key continues - add as child
-        const uint8_t new_nibble = key->data[offset + match_len];
-        const nibbles_t new_remaining = nibbles_slice(key, offset + match_len + 1, SIZE_MAX, arena);
+        const uint8_t new_nibble = nibbles_get(key, offset + match_len);
+        const nibbles_t new_remaining =
+            nibbles_slice(key, offset + match_len + 1, SIZE_MAX, nullptr);
         mpt_node_t *const new_leaf = backend->vtable->alloc_node(backend);
         if (new_leaf == nullptr) {
           return nullptr;
@@ -234,12 +270,12 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
     // No common prefix - branch at current position
     if (node->leaf.path.len > 0) {
       // Existing leaf has remaining path - add as child
-      const uint8_t old_nibble = node->leaf.path.data[0];
+      const uint8_t old_nibble = nibbles_get(&node->leaf.path, 0);
       mpt_node_t *const old_leaf = backend->vtable->alloc_node(backend);
       if (old_leaf == nullptr) {
         return nullptr;
       }
-      const nibbles_t old_remaining = nibbles_slice(&node->leaf.path, 1, SIZE_MAX, arena);
+      const nibbles_t old_remaining = nibbles_slice(&node->leaf.path, 1, SIZE_MAX, nullptr);
       *old_leaf = mpt_node_leaf(old_remaining, node->leaf.value);
       branch->branch.children[old_nibble] = mpt_node_ref(old_leaf, arena);
     } else {
@@ -247,8 +283,8 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
       branch->branch.value = node->leaf.value;
     }
 
-    const uint8_t new_nibble = key->data[offset];
-    const nibbles_t new_remaining = nibbles_slice(key, offset + 1, SIZE_MAX, arena);
+    const uint8_t new_nibble = nibbles_get(key, offset);
+    const nibbles_t new_remaining = nibbles_slice(key, offset + 1, SIZE_MAX, nullptr);
     mpt_node_t *const new_leaf = backend->vtable->alloc_node(backend);
     if (new_leaf == nullptr) {
       return nullptr;
@@ -289,7 +325,7 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
 
     if (match_len < node->extension.path.len) {
       // Existing extension continues after branch
-      const uint8_t ext_nibble = node->extension.path.data[match_len];
+      const uint8_t ext_nibble = nibbles_get(&node->extension.path, match_len);
       if (match_len + 1 < node->extension.path.len) {
         // Create shortened extension
         mpt_node_t *const new_ext = backend->vtable->alloc_node(backend);
@@ -297,7 +333,7 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
           return nullptr;
         }
         const nibbles_t new_ext_path =
-            nibbles_slice(&node->extension.path, match_len + 1, SIZE_MAX, arena);
+            nibbles_slice(&node->extension.path, match_len + 1, SIZE_MAX, nullptr);
         *new_ext = mpt_node_extension(new_ext_path, node->extension.child);
         branch->branch.children[ext_nibble] = mpt_node_ref(new_ext, arena);
       } else {
@@ -308,8 +344,8 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
 
     // Add new key
     if ((offset + match_len) < key->len) {
-      const uint8_t new_nibble = key->data[offset + match_len];
-      const nibbles_t new_remaining = nibbles_slice(key, offset + match_len + 1, SIZE_MAX, arena);
+      const uint8_t new_nibble = nibbles_get(key, offset + match_len);
+      const nibbles_t new_remaining = nibbles_slice(key, offset + match_len + 1, SIZE_MAX, nullptr);
       mpt_node_t *const new_leaf = backend->vtable->alloc_node(backend);
       if (new_leaf == nullptr) {
         return nullptr;
@@ -326,7 +362,7 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
       if (new_ext == nullptr) {
         return nullptr;
       }
-      const nibbles_t common_path = nibbles_slice(&node->extension.path, 0, match_len, arena);
+      const nibbles_t common_path = nibbles_slice(&node->extension.path, 0, match_len, nullptr);
       *new_ext = mpt_node_extension(common_path, mpt_node_ref(branch, arena));
       return new_ext;
     }
@@ -343,7 +379,7 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
     }
 
     // Continue down the appropriate child
-    const uint8_t nibble = key->data[offset];
+    const uint8_t nibble = nibbles_get(key, offset);
 
     if (node_ref_is_null(&node->branch.children[nibble])) {
       // No child - create new leaf
@@ -351,7 +387,7 @@ static mpt_node_t *insert_recursive(mpt_backend_t *const backend, mpt_node_t *no
       if (new_leaf == nullptr) {
         return nullptr;
       }
-      const nibbles_t remaining = nibbles_slice(key, offset + 1, SIZE_MAX, arena);
+      const nibbles_t remaining = nibbles_slice(key, offset + 1, SIZE_MAX, nullptr);
       *new_leaf = mpt_node_leaf(remaining, copy_value(backend, value, value_len, arena));
       node->branch.children[nibble] = mpt_node_ref(new_leaf, arena);
     } else if (node->branch.children[nibble].node != nullptr) {
@@ -456,17 +492,17 @@ static mpt_node_t *collapse_branch(mpt_backend_t *const backend, mpt_node_t *con
       return branch;
     }
     *new_ext = mpt_node_extension(new_path, child->extension.child);
+    if (child->shared && child->extension.child.node != nullptr) {
+      child->extension.child.node->shared = true; // Still reachable through child
+    }
     return new_ext;
   }
 
   // Child is a branch - create extension pointing to it
-  nibbles_t path;
-  path.len = 1;
-  path.data = (uint8_t *)div0_arena_alloc(arena, 1);
+  const nibbles_t path = nibbles_concat3(&NIBBLES_EMPTY, nibble, &NIBBLES_EMPTY, arena);
   if (path.data == nullptr) {
     return branch;
   }
-  path.data[0] = nibble;
 
   mpt_node_t *const new_ext = backend->vtable->alloc_node(backend);
   if (new_ext == nullptr) {
@@ -488,24 +524,21 @@ static mpt_node_t *collapse_branch(mpt_backend_t *const backend, mpt_node_t *con
 static delete_result_t delete_recursive(mpt_backend_t *const backend, mpt_node_t *node,
                                         const nibbles_t *const key, const size_t offset,
                                         mpt_node_t **const out_node, div0_arena_t *const arena) {
-  *out_node = node;
-
   if (node == nullptr || node->type == MPT_NODE_EMPTY) {
+    *out_node = node;
     return DELETE_NOT_FOUND;
   }
 
+  // Nodes are unshared only once the key is known to be below them, so a miss
+  // copies nothing
+  *out_node = node;
+
   switch (node->type) {
   case MPT_NODE_LEAF: {
     // Check if the remaining key matches the leaf path
-    const size_t remaining_len = key->len - offset;
-    if (remaining_len != node->leaf.path.len) {
+    if (!key_matches_path(&node->leaf.path, key, offset)) {
       return DELETE_NOT_FOUND;
     }
-    for (size_t i = 0; i < node->leaf.path.len; i++) {
-      if (node->leaf.path.data[i] != key->data[offset + i]) {
-        return DELETE_NOT_FOUND;
-      }
-    }
     // Found it - remove this leaf
     *out_node = nullptr;
     return DELETE_REMOVED;
@@ -518,10 +551,15 @@ static delete_result_t delete_recursive(mpt_backend_t *const backend, mpt_node_t
       return DELETE_NOT_FOUND;
     }
 
-    // Recurse into child
+    // Recurse into child. Below a shared node the child is reachable from
+    // several parents too, so it must not be modified in place.
+    mpt_node_t *const child = node->extension.child.node;
+    if (node->shared && child != nullptr) {
+      child->shared = true;
+    }
     mpt_node_t *new_child = nullptr;
-    const delete_result_t result = delete_recursive(backend, node->extension.child.node, key,
-                                                    offset + match_len, &new_child, arena);
+    const delete_result_t result =
+        delete_recursive(backend, child, key, offset + match_len, &new_child, arena);
     if (result == DELETE_NOT_FOUND) {
       return DELETE_NOT_FOUND;
     }
@@ -565,6 +603,10 @@ static delete_result_t delete_recursive(mpt_backend_t *const backend, mpt_node_t
     }
 
     // Child is a branch - just update reference
+    node = unshare(backend, node);
+    if (node == nullptr) {
+      return DELETE_NOT_FOUND; // Allocation failed
+    }
     node->extension.child = mpt_node_ref(new_child, arena);
     mpt_node_invalidate_hash(node);
     *out_node = node;
@@ -577,6 +619,10 @@ static delete_result_t delete_recursive(mpt_backend_t *const backend, mpt_node_t
       if (node->branch.value.data == nullptr) {
         return DELETE_NOT_FOUND; // No value to remove
       }
+      node = unshare(backend, node);
+      if (node == nullptr) {
+        return DELETE_NOT_FOUND; // Allocation failed
+      }
       node->branch.value = (bytes_t){.data = nullptr, .size = 0};
 
       // Check if branch should collapse
@@ -584,7 +630,7 @@ static delete_result_t delete_recursive(mpt_backend_t *const backend, mpt_node_t
       return DELETE_UPDATED;
     }
 
-    const uint8_t nibble = key->data[offset];
+    const uint8_t nibble = nibbles_get(key, offset);
     if (node_ref_is_null(&node->branch.children[nibble])) {
       return DELETE_NOT_FOUND;
     }
@@ -594,6 +640,9 @@ static delete_result_t delete_recursive(mpt_backend_t *const backend, mpt_node_t
       return DELETE_NOT_FOUND; // Can't traverse (shouldn't happen for in-memory)
     }
 
+    if (node->shared) {
+      child->shared = true;
+    }
     mpt_node_t *new_child = nullptr;
     const delete_result_t result =
         delete_recursive(backend, child, key, offset + 1, &new_child, arena);
@@ -601,6 +650,11 @@ static delete_result_t delete_recursive(mpt_backend_t *const backend, mpt_node_t
       return DELETE_NOT_FOUND;
     }
 
+    node = unshare(backend, node);
+    if (node == nullptr) {
+      return DELETE_NOT_FOUND; // Allocation failed
+    }
+
     if (result == DELETE_REMOVED || new_child == nullptr) {
       // Child was removed
       node->branch.children[nibble] = node_ref_null();
@@ -630,6 +684,7 @@ bool mpt_insert(mpt_t *const mpt, const uint8_t *const key, const size_t key_len
     return false;
   }
 
+  // Copy the packed key once; new leaf paths are views into this copy
   const nibbles_t key_nibbles = nibbles_from_bytes(key, key_len, mpt->work_arena);
 
   mpt_node_t *const root = mpt->backend->vtable->get_root(mpt->backend);
@@ -644,13 +699,15 @@ bool mpt_insert(mpt_t *const mpt, const uint8_t *const key, const size_t key_len
   return true;
 }
 
-bytes_t mpt_get(const mpt_t *const mpt, const uint8_t *const key, const size_t key_len) {
-  const bytes_t empty = {.data = nullptr, .size = 0};
+mpt_lookup_t mpt_lookup(const mpt_t *const mpt, const uint8_t *const key, const size_t key_len,
+                        bytes_t *const value_out) {
+  *value_out = (bytes_t){.data = nullptr, .size = 0};
   if (mpt == nullptr || mpt->backend == nullptr) {
-    return empty;
+    return MPT_LOOKUP_ABSENT;
   }
 
-  const nibbles_t key_nibbles = nibbles_from_bytes(key, key_len, mpt->work_arena);
+  // Lookups only read the key: view it in place without copying
+  const nibbles_t key_nibbles = nibbles_from_bytes(key, key_len, nullptr);
   const mpt_node_t *node = mpt->backend->vtable->get_root(mpt->backend);
   size_t offset = 0;
 
@@ -658,26 +715,18 @@ bytes_t mpt_get(const mpt_t *const mpt, const uint8_t *const key, const size_t k
     switch (node->type) {
     case MPT_NODE_LEAF: {
       // Check if remaining key matches
-      if (key_nibbles.len - offset == node->leaf.path.len) {
-        bool match = true;
-        // NOLINTNEXTLINE(readability-implicit-bool-conversion)
-        for (size_t i = 0; i < node->leaf.path.len && match; i++) {
-          if (node->leaf.path.data[i] != key_nibbles.data[offset + i]) {
-            match = false;
-          }
-        }
-        if (match) {
-          return node->leaf.value;
-        }
+      if (key_matches_path(&node->leaf.path, &key_nibbles, offset)) {
+        *value_out = node->leaf.value;
+        return MPT_LOOKUP_FOUND;
       }
-      return empty;
+      return MPT_LOOKUP_ABSENT;
     }
 
     case MPT_NODE_EXTENSION: {
       // Check if path matches
       const size_t match_len = find_divergence(&node->extension.path, &key_nibbles, offset);
       if (match_len != node->extension.path.len) {
-        return empty;
+        return MPT_LOOKUP_ABSENT;
       }
       offset += match_len;
       // Use node pointer for in-memory traversal
@@ -685,16 +734,17 @@ bytes_t mpt_get(const mpt_t *const mpt, const uint8_t *const key, const size_t k
         node = node->extension.child.node;
         continue;
       }
-      return empty;
+      return MPT_LOOKUP_UNRESOLVED;
     }
 
     case MPT_NODE_BRANCH: {
       if (offset >= key_nibbles.len) {
-        return node->branch.value;
+        *value_out = node->branch.value;
+        return node->branch.value.data != nullptr ? MPT_LOOKUP_FOUND : MPT_LOOKUP_ABSENT;
       }
-      const uint8_t nibble = key_nibbles.data[offset];
+      const uint8_t nibble = nibbles_get(&key_nibbles, offset);
       if (node_ref_is_null(&node->branch.children[nibble])) {
-        return empty;
+        return MPT_LOOKUP_ABSENT;
       }
       offset++;
       // Use node pointer for in-memory traversal
@@ -702,15 +752,23 @@ bytes_t mpt_get(const mpt_t *const mpt, const uint8_t *const key, const size_t k
         node = node->branch.children[nibble].node;
         continue;
       }
-      return empty;
+      return MPT_LOOKUP_UNRESOLVED;
     }
 
     default:
-      return empty;
+      return MPT_LOOKUP_ABSENT;
     }
   }
 
-  return empty;
+  return MPT_LOOKUP_ABSENT;
+}
+
+bytes_t mpt_get(const mpt_t *const mpt, const uint8_t *const key, const size_t key_len) {
+  bytes_t value;
+  if (mpt_lookup(mpt, key, key_len, &value) != MPT_LOOKUP_FOUND) {
+    return (bytes_t){.data = nullptr, .size = 0};
+  }
+  return value;
 }
 
 bool mpt_contains(const mpt_t *const mpt, const uint8_t *const key, const size_t key_len) {
@@ -718,24 +776,16 @@ bool mpt_contains(const mpt_t *const mpt, const uint8_t *const key, const size_t
     return false;
   }
 
-  const nibbles_t key_nibbles = nibbles_from_bytes(key, key_len, mpt->work_arena);
+  // Lookups only read the key: view it in place without copying
+  const nibbles_t key_nibbles = nibbles_from_bytes(key, key_len, nullptr);
   const mpt_node_t *node = mpt->backend->vtable->get_root(mpt->backend);
   size_t offset = 0;
 
   while (node != nullptr && node->type != MPT_NODE_EMPTY) {
     switch (node->type) {
     case MPT_NODE_LEAF: {
-      // Check if remaining key matches the leaf path
-      const size_t remaining = key_nibbles.len - offset;
-      if (remaining != node->leaf.path.len) {
-        return false;
-      }
-      for (size_t i = 0; i < node->leaf.path.len; i++) {
-        if (node->leaf.path.data[i] != key_nibbles.data[offset + i]) {
-          return false;
-        }
-      }
-      return true; // Found - even if value is empty
+      // Check if remaining key matches the leaf path (found even if value is empty)
+      return key_matches_path(&node->leaf.path, &key_nibbles, offset);
     }
 
     case MPT_NODE_EXTENSION: {
@@ -757,7 +807,7 @@ bool mpt_contains(const mpt_t *const mpt, const uint8_t *const key, const size_t
         // data != nullptr means a value was explicitly set (even if empty)
         return node->branch.value.data != nullptr;
       }
-      const uint8_t nibble = key_nibbles.data[offset];
+      const uint8_t nibble = nibbles_get(&key_nibbles, offset);
       if (node_ref_is_null(&node->branch.children[nibble])) {
         return false;
       }
@@ -788,7 +838,7 @@ bool mpt_delete(mpt_t *const mpt, const uint8_t *const key, const size_t key_len
     return false; // Empty trie, nothing to delete
   }
 
-  const nibbles_t key_nibbles = nibbles_from_bytes(key, key_len, mpt->work_arena);
+  const nibbles_t key_nibbles = nibbles_from_bytes(key, key_len, nullptr);
 
   mpt_node_t *new_root = nullptr;
   const delete_result_t result =
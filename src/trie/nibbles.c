@@ -2,24 +2,98 @@
 
 #include <string.h>
 
+/// Number of nibbles compared per step in nibbles_common_prefix.
+static constexpr size_t NIBBLES_PER_WORD = 16;
+
+/// Load 16 nibbles starting at absolute nibble index pos as a big-endian word
+/// (first nibble in the top 4 bits). Caller guarantees 16 nibbles are readable.
+static inline uint64_t load_nibble_word(const uint8_t *const data, const size_t pos) {
+  const uint8_t *const p = data + (pos >> 1);
+  uint64_t word;
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(&word, p, sizeof(word));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  word = __builtin_bswap64(word);
+#endif
+  if ((pos & 1) != 0) {
+    // Odd start: drop the leading half-byte and pull in the next one
+    word = (word << 4) | (uint64_t)(p[8] >> 4);
+  }
+  return word;
+}
+
+/// Set nibble at absolute index pos in a zero-initialized buffer.
+static inline void set_nibble(uint8_t *const dst, const size_t pos, const uint8_t nibble) {
+  dst[pos >> 1] |= (pos & 1) != 0 ? nibble : (uint8_t)(nibble << 4);
+}
+
+/// Allocate a zeroed buffer large enough for count nibbles.
+static uint8_t *alloc_nibbles(const size_t count, div0_arena_t *const arena) {
+  const size_t byte_len = (count + 1) / 2;
+  uint8_t *const data = div0_arena_alloc(arena, byte_len);
+  if (data != nullptr) {
+    memset(data, 0, byte_len);
+  }
+  return data;
+}
+
+/// Copy all nibbles of src into a zero-initialized dst starting at dst_pos.
+/// When source and destination share nibble parity, whole bytes are memcpy'd.
+static void copy_nibbles(uint8_t *const dst, size_t dst_pos, const nibbles_t *const src) {
+  size_t i = 0;
+  if (((dst_pos ^ src->offset) & 1) == 0) {
+    if ((dst_pos & 1) != 0 && i < src->len) {
+      set_nibble(dst, dst_pos++, nibbles_get(src, i++));
+    }
+    const size_t whole = (src->len - i) / 2;
+    if (whole > 0) {
+      // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+      memcpy(dst + (dst_pos >> 1), src->data + ((src->offset + i) >> 1), whole);
+      dst_pos += whole * 2;
+      i += whole * 2;
+    }
+  }
+  for (; i < src->len; i++) {
+    set_nibble(dst, dst_pos++, nibbles_get(src, i));
+  }
+}
+
 nibbles_t nibbles_from_bytes(const uint8_t *const bytes, const size_t len,
                              div0_arena_t *const arena) {
   if (len == 0 || bytes == nullptr) {
     return NIBBLES_EMPTY;
   }
 
-  const size_t nibble_len = len * 2;
-  uint8_t *const data = div0_arena_alloc(arena, nibble_len);
+  // Without an arena, return a view directly over the caller's bytes
+  if (arena == nullptr) {
+    return (nibbles_t){.data = bytes, .offset = 0, .len = len * 2};
+  }
+
+  uint8_t *const data = div0_arena_alloc(arena, len);
   if (data == nullptr) {
     return NIBBLES_EMPTY;
   }
 
-  for (size_t i = 0; i < len; i++) {
-    data[i * 2] = (bytes[i] >> 4) & 0x0F; // High nibble
-    data[(i * 2) + 1] = bytes[i] & 0x0F;  // Low nibble
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(data, bytes, len);
+  return (nibbles_t){.data = data, .offset = 0, .len = len * 2};
+}
+
+nibbles_t nibbles_pack(const uint8_t *const nibbles, const size_t count,
+                       div0_arena_t *const arena) {
+  if (count == 0 || nibbles == nullptr) {
+    return NIBBLES_EMPTY;
   }
 
-  return (nibbles_t){.data = data, .len = nibble_len};
+  uint8_t *const data = alloc_nibbles(count, arena);
+  if (data == nullptr) {
+    return NIBBLES_EMPTY;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    set_nibble(data, i, nibbles[i] & 0x0F);
+  }
+  return (nibbles_t){.data = data, .offset = 0, .len = count};
 }
 
 void nibbles_to_bytes(const nibbles_t *const nibbles, uint8_t *const out) {
@@ -28,8 +102,15 @@ void nibbles_to_bytes(const nibbles_t *const nibbles, uint8_t *const out) {
   }
 
   const size_t byte_len = nibbles->len / 2;
+  if ((nibbles->offset & 1) == 0) {
+    // Byte-aligned view: the packed bytes are the output
+    // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+    memcpy(out, nibbles->data + (nibbles->offset >> 1), byte_len);
+    return;
+  }
+
   for (size_t i = 0; i < byte_len; i++) {
-    out[i] = (uint8_t)((nibbles->data[i * 2] << 4) | nibbles->data[(i * 2) + 1]);
+    out[i] = (uint8_t)((nibbles_get(nibbles, i * 2) << 4) | nibbles_get(nibbles, (i * 2) + 1));
   }
 }
 
@@ -52,7 +133,17 @@ size_t nibbles_common_prefix(const nibbles_t *const a, const nibbles_t *const b)
   const size_t min_len = a->len < b->len ? a->len : b->len;
   size_t i = 0;
 
-  while (i < min_len && a->data[i] == b->data[i]) {
+  // Word-at-a-time: the first differing nibble is the leading zero count / 4
+  while (i + NIBBLES_PER_WORD <= min_len) {
+    const uint64_t diff =
+        load_nibble_word(a->data, a->offset + i) ^ load_nibble_word(b->data, b->offset + i);
+    if (diff != 0) {
+      return i + ((size_t)__builtin_clzll(diff) >> 2);
+    }
+    i += NIBBLES_PER_WORD;
+  }
+
+  while (i < min_len && nibbles_get(a, i) == nibbles_get(b, i)) {
     i++;
   }
 
@@ -75,20 +166,14 @@ nibbles_t nibbles_slice(const nibbles_t *const src, const size_t start, size_t l
     return NIBBLES_EMPTY;
   }
 
+  const nibbles_t view = {.data = src->data, .offset = src->offset + start, .len = len};
+
   // If no arena provided, return a view into the original data
   if (arena == nullptr) {
-    return (nibbles_t){.data = src->data + start, .len = len};
+    return view;
   }
 
-  // Allocate and copy
-  uint8_t *const data = div0_arena_alloc(arena, len);
-  if (data == nullptr) {
-    return NIBBLES_EMPTY;
-  }
-
-  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
-  memcpy(data, src->data + start, len);
-  return (nibbles_t){.data = data, .len = len};
+  return nibbles_copy(&view, arena);
 }
 
 nibbles_t nibbles_copy(const nibbles_t *const src, div0_arena_t *const arena) {
@@ -96,26 +181,21 @@ nibbles_t nibbles_copy(const nibbles_t *const src, div0_arena_t *const arena) {
     return NIBBLES_EMPTY;
   }
 
-  uint8_t *const data = div0_arena_alloc(arena, src->len);
+  uint8_t *const data = alloc_nibbles(src->len, arena);
   if (data == nullptr) {
     return NIBBLES_EMPTY;
   }
 
-  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
-  memcpy(data, src->data, src->len);
-  return (nibbles_t){.data = data, .len = src->len};
+  copy_nibbles(data, 0, src);
+  return (nibbles_t){.data = data, .offset = 0, .len = src->len};
 }
 
 int nibbles_cmp(const nibbles_t *const a, const nibbles_t *const b) {
   const size_t min_len = a->len < b->len ? a->len : b->len;
+  const size_t common = nibbles_common_prefix(a, b);
 
-  for (size_t i = 0; i < min_len; i++) {
-    if (a->data[i] < b->data[i]) {
-      return -1;
-    }
-    if (a->data[i] > b->data[i]) {
-      return 1;
-    }
+  if (common < min_len) {
+    return nibbles_get(a, common) < nibbles_get(b, common) ? -1 : 1;
   }
 
   // Prefixes match - shorter sequence comes first
@@ -138,34 +218,24 @@ nibbles_t nibbles_concat(const nibbles_t *const a, const nibbles_t *const b,
     return nibbles_copy(a, arena);
   }
   const size_t total = a->len + b->len;
-  uint8_t *const data = div0_arena_alloc(arena, total);
+  uint8_t *const data = alloc_nibbles(total, arena);
   if (data == nullptr) {
     return NIBBLES_EMPTY;
   }
-  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
-  memcpy(data, a->data, a->len);
-  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
-  memcpy(data + a->len, b->data, b->len);
-  return (nibbles_t){.data = data, .len = total};
+  copy_nibbles(data, 0, a);
+  copy_nibbles(data, a->len, b);
+  return (nibbles_t){.data = data, .offset = 0, .len = total};
 }
 
 nibbles_t nibbles_concat3(const nibbles_t *const prefix, const uint8_t middle,
                           const nibbles_t *const suffix, div0_arena_t *const arena) {
   const size_t total = prefix->len + 1 + suffix->len;
-  uint8_t *const data = div0_arena_alloc(arena, total);
+  uint8_t *const data = alloc_nibbles(total, arena);
   if (data == nullptr) {
     return NIBBLES_EMPTY;
   }
-  size_t pos = 0;
-  if (prefix->len > 0) {
-    // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
-    memcpy(data + pos, prefix->data, prefix->len);
-    pos += prefix->len;
-  }
-  data[pos++] = middle;
-  if (suffix->len > 0) {
-    // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
-    memcpy(data + pos, suffix->data, suffix->len);
-  }
-  return (nibbles_t){.data = data, .len = total};
+  copy_nibbles(data, 0, prefix);
+  set_nibble(data, prefix->len, middle & 0x0F);
+  copy_nibbles(data, prefix->len + 1, suffix);
+  return (nibbles_t){.data = data, .offset = 0, .len = total};
 }
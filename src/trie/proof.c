@@ -0,0 +1,710 @@
+#include "div0/trie/proof.h"
+
+#include "div0/crypto/keccak256.h"
+#include "div0/rlp/decode.h"
+#include "div0/trie/hex_prefix.h"
+#include "div0/trie/nibbles.h"
+
+#include <stdalign.h>
+#include <string.h>
+
+/// Number of items in an RLP-encoded branch node (16 children + value).
+static constexpr size_t BRANCH_ITEMS = 17;
+
+/// Size of a hash reference to a child node.
+static constexpr size_t HASH_REF_SIZE = 32;
+
+// =============================================================================
+// Node Hash Index
+// =============================================================================
+
+/// Open-addressing index from node hash to position in a hash array.
+/// Sized to at least twice the capacity, so lookups stay short.
+typedef struct {
+  const hash_t *hashes; // Hash array the index refers to
+  uint32_t *slots;      // Position + 1 into hashes (0 = empty)
+  size_t mask;          // Slot count - 1 (power of two)
+} node_index_t;
+
+static bool node_index_init(node_index_t *const index, const hash_t *const hashes,
+                            const size_t capacity, div0_arena_t *const arena) {
+  size_t slot_count = 16;
+  while (slot_count < capacity * 2) {
+    slot_count <<= 1;
+  }
+  index->slots =
+      div0_arena_alloc_array(arena, slot_count, sizeof(uint32_t), alignof(uint32_t));
+  if (index->slots == nullptr) {
+    return false;
+  }
+  memset(index->slots, 0, slot_count * sizeof(uint32_t));
+  index->hashes = hashes;
+  index->mask = slot_count - 1;
+  return true;
+}
+
+/// Find the slot holding hash, or the empty slot where it would go.
+static size_t node_index_probe(const node_index_t *const index, const hash_t *const hash) {
+  uint64_t start;
+  // Node hashes are Keccak digests and need no further mixing
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(&start, hash->bytes, sizeof(start));
+  size_t slot = (size_t)start & index->mask;
+  while (index->slots[slot] != 0 &&
+         !hash_equal(&index->hashes[index->slots[slot] - 1], hash)) {
+    slot = (slot + 1) & index->mask;
+  }
+  return slot;
+}
+
+/// Look up a hash. Returns the position in hashes, or SIZE_MAX if absent.
+static size_t node_index_find(const node_index_t *const index, const hash_t *const hash) {
+  const size_t slot = node_index_probe(index, hash);
+  return index->slots[slot] == 0 ? SIZE_MAX : index->slots[slot] - 1;
+}
+
+/// Insert hashes[pos] unless an equal hash is present.
+/// @return Position of the equal hash if present, otherwise pos
+static size_t node_index_insert(const node_index_t *const index, const size_t pos) {
+  const size_t slot = node_index_probe(index, &index->hashes[pos]);
+  if (index->slots[slot] != 0) {
+    return index->slots[slot] - 1;
+  }
+  index->slots[slot] = (uint32_t)(pos + 1);
+  return pos;
+}
+
+// =============================================================================
+// Proof Generation
+// =============================================================================
+
+/// Marks a path entry that did not descend through a branch slot.
+static constexpr uint8_t NO_BRANCH_SLOT = 16;
+
+/// Node on a key path, with the branch slot the key descended through.
+typedef struct {
+  mpt_node_t *node;
+  uint8_t slot; // Branch child index taken, or NO_BRANCH_SLOT
+} path_entry_t;
+
+/// Upper bound on proof nodes for a key: every step consumes at least one
+/// nibble, and an extension is always followed by a branch.
+static size_t max_path_nodes(const size_t key_len) {
+  return (key_len * 4) + 2;
+}
+
+/// Collect the nodes a verifier needs for one key, root first.
+/// Embedded children travel inside their parent's encoding and are skipped.
+/// @return Number of entries written to out
+static size_t collect_path(mpt_node_t *const root, const nibbles_t *const key,
+                           path_entry_t *const out) {
+  size_t count = 0;
+  size_t offset = 0;
+  mpt_node_t *node = root;
+  bool listed = true; // Whether node is out[count - 1]
+  out[count++] = (path_entry_t){.node = root, .slot = NO_BRANCH_SLOT};
+
+  while (true) {
+    const node_ref_t *ref = nullptr;
+    switch (node->type) {
+    case MPT_NODE_EXTENSION: {
+      const nibbles_t rest = nibbles_slice(key, offset, SIZE_MAX, nullptr);
+      if (nibbles_common_prefix(&node->extension.path, &rest) != node->extension.path.len) {
+        return count;
+      }
+      offset += node->extension.path.len;
+      ref = &node->extension.child;
+      break;
+    }
+    case MPT_NODE_BRANCH: {
+      if (offset >= key->len) {
+        return count;
+      }
+      const uint8_t slot = nibbles_get(key, offset);
+      if (listed) {
+        out[count - 1].slot = slot;
+      }
+      ref = &node->branch.children[slot];
+      offset++;
+      break;
+    }
+    default:
+      // Leaf (or empty): path ends here, match or not
+      return count;
+    }
+
+    if (node_ref_is_null(ref) || ref->node == nullptr) {
+      return count;
+    }
+    listed = ref->is_hash;
+    if (listed) {
+      out[count++] = (path_entry_t){.node = ref->node, .slot = NO_BRANCH_SLOT};
+    }
+    node = ref->node;
+  }
+}
+
+/// Deduplicated node set under construction.
+typedef struct {
+  mpt_node_t **nodes; // Distinct nodes in first-visit order
+  uint16_t *slots;    // Per node: mask of branch slots some key descended through
+  hash_t *hashes;     // Per node: hash of its encoding
+  node_index_t index; // Hash -> position in nodes
+  size_t count;       // Number of distinct nodes
+} node_set_t;
+
+/// Add node unless an equal node (by hash) is present.
+/// @return Position of the node in the set
+static size_t node_set_add(node_set_t *const set, mpt_node_t *const node,
+                           div0_arena_t *const arena) {
+  set->hashes[set->count] = mpt_node_hash(node, arena);
+  const size_t pos = node_index_insert(&set->index, set->count);
+  if (pos == set->count) {
+    set->nodes[pos] = node;
+    set->slots[pos] = 0;
+    set->count++;
+  }
+  return pos;
+}
+
+/// Add the one untouched child of each branch in the set, if there is exactly one.
+/// Deleting the touched keys can collapse such a branch, and the collapse merges
+/// the remaining child into its parent, so a stateless replay needs its contents.
+static void add_collapse_siblings(node_set_t *const set, div0_arena_t *const arena) {
+  const size_t count = set->count;
+  for (size_t i = 0; i < count; i++) {
+    const mpt_node_t *const node = set->nodes[i];
+    if (node->type != MPT_NODE_BRANCH || set->slots[i] == 0) {
+      continue;
+    }
+    const node_ref_t *sibling = nullptr;
+    size_t untouched = 0;
+    for (uint8_t slot = 0; slot < 16; slot++) {
+      const node_ref_t *const ref = &node->branch.children[slot];
+      if (!node_ref_is_null(ref) && (set->slots[i] & (1U << slot)) == 0) {
+        sibling = ref;
+        untouched++;
+      }
+    }
+    if (untouched == 1 && sibling->is_hash && sibling->node != nullptr) {
+      (void)node_set_add(set, sibling->node, arena);
+    }
+  }
+}
+
+/// Collect, deduplicate and encode the nodes for a set of trie queries.
+static bool collect_nodes(const mpt_witness_query_t *const queries, const size_t query_count,
+                          const bool with_siblings, div0_arena_t *const arena,
+                          mpt_proof_t *const proof_out) {
+  proof_out->nodes = nullptr;
+  proof_out->count = 0;
+
+  size_t capacity = 0;
+  for (size_t q = 0; q < query_count; q++) {
+    capacity++; // Root
+    for (size_t i = 0; i < queries[q].key_count; i++) {
+      capacity += max_path_nodes(queries[q].keys[i].len);
+    }
+  }
+  if (capacity == 0) {
+    return true;
+  }
+
+  path_entry_t *const path =
+      div0_arena_alloc_array(arena, capacity, sizeof(path_entry_t), alignof(path_entry_t));
+  if (path == nullptr) {
+    return false;
+  }
+
+  size_t total = 0;
+  for (size_t q = 0; q < query_count; q++) {
+    const mpt_t *const mpt = queries[q].mpt;
+    if (mpt == nullptr || mpt->backend == nullptr) {
+      return false;
+    }
+    mpt_node_t *const root = mpt->backend->vtable->get_root(mpt->backend);
+    if (root == nullptr || root->type == MPT_NODE_EMPTY) {
+      continue; // Empty trie: the root hash alone proves absence
+    }
+    // The root is listed even for a query without keys, so the trie can be loaded
+    path[total++] = (path_entry_t){.node = root, .slot = NO_BRANCH_SLOT};
+    for (size_t i = 0; i < queries[q].key_count; i++) {
+      const mpt_proof_key_t *const key = &queries[q].keys[i];
+      const nibbles_t nibbles = nibbles_from_bytes(key->data, key->len, nullptr);
+      total += collect_path(root, &nibbles, path + total);
+    }
+  }
+  if (total == 0) {
+    return true;
+  }
+
+  // Each listed branch adds at most one collapse sibling
+  const size_t set_capacity = with_siblings ? total * 2 : total;
+  node_set_t set = {.count = 0};
+  set.nodes =
+      div0_arena_alloc_array(arena, set_capacity, sizeof(mpt_node_t *), alignof(mpt_node_t *));
+  set.slots = div0_arena_alloc_array(arena, set_capacity, sizeof(uint16_t), alignof(uint16_t));
+  set.hashes = div0_arena_alloc_array(arena, set_capacity, sizeof(hash_t), alignof(hash_t));
+  if (set.nodes == nullptr || set.slots == nullptr || set.hashes == nullptr ||
+      !node_index_init(&set.index, set.hashes, set_capacity, arena)) {
+    return false;
+  }
+
+  // Keys sharing a prefix share every node above their divergence point
+  for (size_t i = 0; i < total; i++) {
+    const size_t pos = node_set_add(&set, path[i].node, arena);
+    if (path[i].slot != NO_BRANCH_SLOT) {
+      set.slots[pos] |= (uint16_t)(1U << path[i].slot);
+    }
+  }
+
+  if (with_siblings) {
+    add_collapse_siblings(&set, arena);
+  }
+
+  bytes_t *const nodes =
+      div0_arena_alloc_array(arena, set.count, sizeof(bytes_t), alignof(bytes_t));
+  if (nodes == nullptr) {
+    return false;
+  }
+  for (size_t i = 0; i < set.count; i++) {
+    nodes[i] = mpt_node_encode(set.nodes[i], arena);
+    if (nodes[i].data == nullptr) {
+      return false;
+    }
+  }
+
+  proof_out->nodes = nodes;
+  proof_out->count = set.count;
+  return true;
+}
+
+bool mpt_prove(const mpt_t *const mpt, const uint8_t *const key, const size_t key_len,
+               mpt_proof_t *const proof_out) {
+  const mpt_proof_key_t single = {.data = key, .len = key_len};
+  return mpt_prove_multi(mpt, &single, 1, proof_out);
+}
+
+bool mpt_prove_multi(const mpt_t *const mpt, const mpt_proof_key_t *const keys,
+                     const size_t key_count, mpt_proof_t *const proof_out) {
+  if (mpt == nullptr || mpt->backend == nullptr) {
+    proof_out->nodes = nullptr;
+    proof_out->count = 0;
+    return false;
+  }
+  const mpt_witness_query_t query = {.mpt = mpt, .keys = keys, .key_count = key_count};
+  return collect_nodes(&query, 1, false, mpt->work_arena, proof_out);
+}
+
+bool mpt_collect_witness(const mpt_witness_query_t *const queries, const size_t query_count,
+                         div0_arena_t *const arena, mpt_proof_t *const proof_out) {
+  return collect_nodes(queries, query_count, true, arena, proof_out);
+}
+
+// =============================================================================
+// Proof Verification
+// =============================================================================
+
+/// Raw span of one RLP item (prefix included).
+typedef struct {
+  const uint8_t *data;
+  size_t len;
+} rlp_span_t;
+
+/// Split an RLP list into the raw spans of its items.
+/// @return Number of items, or 0 if malformed or more than max_items
+static size_t split_list(const rlp_span_t *const node, rlp_span_t *const items,
+                         const size_t max_items) {
+  rlp_decoder_t decoder;
+  rlp_decoder_init(&decoder, node->data, node->len);
+  const rlp_list_result_t header = rlp_decode_list_header(&decoder);
+  if (header.error != RLP_SUCCESS ||
+      header.bytes_consumed + header.payload_length != node->len) {
+    return 0;
+  }
+
+  rlp_decoder_t payload;
+  rlp_decoder_init(&payload, node->data + header.bytes_consumed, header.payload_length);
+
+  size_t count = 0;
+  while (rlp_decoder_has_more(&payload)) {
+    if (count == max_items) {
+      return 0;
+    }
+    const size_t start = rlp_decoder_position(&payload);
+    rlp_skip_item(&payload);
+    items[count].data = payload.input + start;
+    items[count].len = rlp_decoder_position(&payload) - start;
+    count++;
+  }
+  return count;
+}
+
+/// Decode a string item into a view.
+static bool decode_string(const rlp_span_t *const item, rlp_span_t *const out) {
+  rlp_decoder_t decoder;
+  rlp_decoder_init(&decoder, item->data, item->len);
+  const rlp_bytes_result_t result = rlp_decode_bytes(&decoder);
+  if (result.error != RLP_SUCCESS || result.bytes_consumed != item->len) {
+    return false;
+  }
+  out->data = result.data;
+  out->len = result.len;
+  return true;
+}
+
+/// Child reference kinds inside a node encoding.
+typedef enum {
+  CHILD_NONE,     // Empty slot
+  CHILD_HASH,     // 32-byte hash of the child encoding
+  CHILD_EMBEDDED, // Child encoding inlined (< 32 bytes)
+  CHILD_INVALID,  // Anything else
+} child_kind_t;
+
+static child_kind_t decode_child(const rlp_span_t *const item, rlp_span_t *const out) {
+  if (item->len > 0 && rlp_is_list_prefix(item->data[0])) {
+    *out = *item;
+    return item->len < HASH_REF_SIZE ? CHILD_EMBEDDED : CHILD_INVALID;
+  }
+  if (!decode_string(item, out)) {
+    return CHILD_INVALID;
+  }
+  if (out->len == 0) {
+    return CHILD_NONE;
+  }
+  return out->len == HASH_REF_SIZE ? CHILD_HASH : CHILD_INVALID;
+}
+
+static mpt_proof_status_t found(const rlp_span_t *const value, bytes_t *const value_out) {
+  if (value->len == 0) {
+    return MPT_PROOF_ABSENT;
+  }
+  if (value_out != nullptr) {
+    // View into the proof node; the proof owns the bytes
+    value_out->data = (uint8_t *)value->data;
+    value_out->size = value->len;
+    value_out->capacity = 0;
+    value_out->arena = nullptr;
+  }
+  return MPT_PROOF_FOUND;
+}
+
+/// Walk one key from the root through indexed proof nodes.
+static mpt_proof_status_t verify_key(const hash_t *const root, const mpt_proof_key_t *const key,
+                                     const mpt_proof_t *const proof,
+                                     const node_index_t *const index, bytes_t *const value_out) {
+  if (hash_equal(root, &MPT_EMPTY_ROOT)) {
+    return MPT_PROOF_ABSENT;
+  }
+
+  size_t pos = node_index_find(index, root);
+  if (pos == SIZE_MAX) {
+    return MPT_PROOF_INVALID;
+  }
+  rlp_span_t node = {.data = proof->nodes[pos].data, .len = proof->nodes[pos].size};
+
+  const nibbles_t key_nibbles = nibbles_from_bytes(key->data, key->len, nullptr);
+  size_t offset = 0;
+
+  while (true) {
+    rlp_span_t items[BRANCH_ITEMS];
+    const size_t item_count = split_list(&node, items, BRANCH_ITEMS);
+    rlp_span_t next;
+    child_kind_t kind;
+
+    if (item_count == 2) {
+      // Leaf or extension: [hex_prefix(path), value | child]
+      rlp_span_t encoded_path;
+      if (!decode_string(&items[0], &encoded_path)) {
+        return MPT_PROOF_INVALID;
+      }
+      const hex_prefix_result_t hp =
+          hex_prefix_decode(encoded_path.data, encoded_path.len, nullptr);
+      if (!hp.success) {
+        return MPT_PROOF_INVALID;
+      }
+      const nibbles_t rest = nibbles_slice(&key_nibbles, offset, SIZE_MAX, nullptr);
+      const size_t match = nibbles_common_prefix(&hp.nibbles, &rest);
+
+      if (hp.is_leaf) {
+        if (match != hp.nibbles.len || rest.len != hp.nibbles.len) {
+          return MPT_PROOF_ABSENT;
+        }
+        rlp_span_t value;
+        if (!decode_string(&items[1], &value)) {
+          return MPT_PROOF_INVALID;
+        }
+        return found(&value, value_out);
+      }
+
+      if (hp.nibbles.len == 0) {
+        return MPT_PROOF_INVALID; // Extensions always consume at least one nibble
+      }
+      if (match != hp.nibbles.len) {
+        return MPT_PROOF_ABSENT;
+      }
+      offset += hp.nibbles.len;
+      kind = decode_child(&items[1], &next);
+      if (kind == CHILD_NONE) {
+        return MPT_PROOF_INVALID; // Extensions must have a child
+      }
+    } else if (item_count == BRANCH_ITEMS) {
+      if (offset >= key_nibbles.len) {
+        rlp_span_t value;
+        if (!decode_string(&items[16], &value)) {
+          return MPT_PROOF_INVALID;
+        }
+        return found(&value, value_out);
+      }
+      kind = decode_child(&items[nibbles_get(&key_nibbles, offset)], &next);
+      offset++;
+      if (kind == CHILD_NONE) {
+        return MPT_PROOF_ABSENT;
+      }
+    } else {
+      return MPT_PROOF_INVALID;
+    }
+
+    switch (kind) {
+    case CHILD_EMBEDDED:
+      node = next;
+      break;
+    case CHILD_HASH: {
+      const hash_t child_hash = hash_from_bytes(next.data);
+      pos = node_index_find(index, &child_hash);
+      if (pos == SIZE_MAX) {
+        return MPT_PROOF_INVALID; // Proof is missing a node on the path
+      }
+      node.data = proof->nodes[pos].data;
+      node.len = proof->nodes[pos].size;
+      break;
+    }
+    default:
+      return MPT_PROOF_INVALID;
+    }
+  }
+}
+
+/// Hash every proof node once and index them by hash.
+static bool index_proof(const mpt_proof_t *const proof, node_index_t *const index,
+                        div0_arena_t *const arena) {
+  const size_t count = proof->count > 0 ? proof->count : 1;
+  hash_t *const hashes = div0_arena_alloc_array(arena, count, sizeof(hash_t), alignof(hash_t));
+  if (hashes == nullptr || !node_index_init(index, hashes, proof->count, arena)) {
+    return false;
+  }
+  for (size_t i = 0; i < proof->count; i++) {
+    hashes[i] = keccak256(proof->nodes[i].data, proof->nodes[i].size);
+    (void)node_index_insert(index, i);
+  }
+  return true;
+}
+
+mpt_proof_status_t mpt_verify_proof(const hash_t *const root, const uint8_t *const key,
+                                    const size_t key_len, const mpt_proof_t *const proof,
+                                    div0_arena_t *const arena, bytes_t *const value_out) {
+  const mpt_proof_key_t single = {.data = key, .len = key_len};
+  mpt_proof_status_t status = MPT_PROOF_INVALID;
+  (void)mpt_verify_multiproof(root, &single, 1, proof, arena, &status, value_out);
+  return status;
+}
+
+bool mpt_verify_multiproof(const hash_t *const root, const mpt_proof_key_t *const keys,
+                           const size_t key_count, const mpt_proof_t *const proof,
+                           div0_arena_t *const arena, mpt_proof_status_t *const statuses_out,
+                           bytes_t *const values_out) {
+  node_index_t index;
+  if (!index_proof(proof, &index, arena)) {
+    for (size_t i = 0; i < key_count; i++) {
+      statuses_out[i] = MPT_PROOF_INVALID;
+    }
+    return false;
+  }
+
+  bool all_valid = true;
+  for (size_t i = 0; i < key_count; i++) {
+    bytes_t *const value_out = values_out != nullptr ? &values_out[i] : nullptr;
+    statuses_out[i] = verify_key(root, &keys[i], proof, &index, value_out);
+    if (statuses_out[i] == MPT_PROOF_INVALID) {
+      all_valid = false;
+    }
+  }
+  return all_valid;
+}
+
+// =============================================================================
+// Partial Trie Loading
+// =============================================================================
+
+/// View a decoded RLP string as bytes (data is nullptr when empty).
+static bytes_t span_to_bytes(const rlp_span_t *const span) {
+  bytes_t out = {.data = nullptr, .size = 0, .capacity = 0, .arena = nullptr};
+  if (span->len > 0) {
+    out.data = (uint8_t *)span->data;
+    out.size = span->len;
+  }
+  return out;
+}
+
+/// State of one mpt_load_proof call.
+typedef struct {
+  const mpt_t *mpt;
+  const mpt_proof_t *proof;
+  const node_index_t *index;
+  mpt_node_t **loaded; // Node decoded from each proof entry, nullptr until first reference
+} load_ctx_t;
+
+static mpt_node_t *load_node(const load_ctx_t *ctx, const rlp_span_t *encoded);
+
+/// Decode a child reference, loading the child if the proof contains it.
+/// Hash references to nodes missing from the proof stay unresolved (node == nullptr);
+/// lookups through them report MPT_LOOKUP_UNRESOLVED.
+static bool load_ref(const load_ctx_t *const ctx, const rlp_span_t *const item,
+                     node_ref_t *const out) {
+  rlp_span_t child;
+  switch (decode_child(item, &child)) {
+  case CHILD_NONE:
+    *out = node_ref_null();
+    return true;
+
+  case CHILD_HASH: {
+    out->is_hash = true;
+    out->hash = hash_from_bytes(child.data);
+    out->node = nullptr;
+    const size_t pos = node_index_find(ctx->index, &out->hash);
+    if (pos == SIZE_MAX) {
+      return true; // Not needed by the recorded accesses
+    }
+    if (ctx->loaded[pos] != nullptr) {
+      // Same subtree under another parent: share it instead of decoding it again
+      out->node = ctx->loaded[pos];
+      out->node->shared = true;
+      return true;
+    }
+    const rlp_span_t encoded = {.data = ctx->proof->nodes[pos].data,
+                                .len = ctx->proof->nodes[pos].size};
+    out->node = load_node(ctx, &encoded);
+    if (out->node == nullptr) {
+      return false;
+    }
+    out->node->cached_hash = out->hash;
+    out->node->hash_valid = true;
+    ctx->loaded[pos] = out->node;
+    return true;
+  }
+
+  case CHILD_EMBEDDED:
+    out->is_hash = false;
+    out->embedded = span_to_bytes(&child);
+    out->node = load_node(ctx, &child);
+    return out->node != nullptr;
+
+  default:
+    return false;
+  }
+}
+
+/// Decode one node encoding into a backend node, recursing into its children.
+/// Each proof node is decoded once: a subtree referenced by several parents is
+/// shared and marked so, and the trie copies it before modifying it. A witness
+/// whose nodes form a DAG therefore loads in time linear in its size.
+static mpt_node_t *load_node(const load_ctx_t *const ctx, const rlp_span_t *const encoded) {
+  rlp_span_t items[BRANCH_ITEMS];
+  const size_t item_count = split_list(encoded, items, BRANCH_ITEMS);
+  mpt_backend_t *const backend = ctx->mpt->backend;
+
+  if (item_count == 2) {
+    rlp_span_t encoded_path;
+    if (!decode_string(&items[0], &encoded_path)) {
+      return nullptr;
+    }
+    const hex_prefix_result_t hp = hex_prefix_decode(encoded_path.data, encoded_path.len, nullptr);
+    if (!hp.success) {
+      return nullptr;
+    }
+
+    if (hp.is_leaf) {
+      rlp_span_t value;
+      if (!decode_string(&items[1], &value)) {
+        return nullptr;
+      }
+      mpt_node_t *const node = backend->vtable->alloc_node(backend);
+      if (node != nullptr) {
+        *node = mpt_node_leaf(hp.nibbles, span_to_bytes(&value));
+      }
+      return node;
+    }
+
+    node_ref_t child;
+    if (hp.nibbles.len == 0 || !load_ref(ctx, &items[1], &child) ||
+        node_ref_is_null(&child)) {
+      return nullptr;
+    }
+    mpt_node_t *const node = backend->vtable->alloc_node(backend);
+    if (node != nullptr) {
+      *node = mpt_node_extension(hp.nibbles, child);
+    }
+    return node;
+  }
+
+  if (item_count != BRANCH_ITEMS) {
+    return nullptr;
+  }
+
+  mpt_node_t *const node = backend->vtable->alloc_node(backend);
+  if (node == nullptr) {
+    return nullptr;
+  }
+  *node = mpt_node_branch();
+  for (size_t i = 0; i < 16; i++) {
+    if (!load_ref(ctx, &items[i], &node->branch.children[i])) {
+      return nullptr;
+    }
+  }
+  rlp_span_t value;
+  if (!decode_string(&items[16], &value)) {
+    return nullptr;
+  }
+  node->branch.value = span_to_bytes(&value);
+  return node;
+}
+
+bool mpt_load_proof(mpt_t *const mpt, const hash_t *const root, const mpt_proof_t *const proof) {
+  if (mpt == nullptr || mpt->backend == nullptr) {
+    return false;
+  }
+
+  mpt_clear(mpt);
+  if (hash_equal(root, &MPT_EMPTY_ROOT)) {
+    return true;
+  }
+
+  node_index_t index;
+  if (!index_proof(proof, &index, mpt->work_arena)) {
+    return false;
+  }
+  const size_t pos = node_index_find(&index, root);
+  if (pos == SIZE_MAX) {
+    return false;
+  }
+
+  mpt_node_t **const loaded = div0_arena_alloc_array(mpt->work_arena, proof->count,
+                                                     sizeof(mpt_node_t *), alignof(mpt_node_t *));
+  if (loaded == nullptr) {
+    return false;
+  }
+  __builtin___memset_chk(loaded, 0, proof->count * sizeof(mpt_node_t *),
+                         proof->count * sizeof(mpt_node_t *));
+  const load_ctx_t ctx = {.mpt = mpt, .proof = proof, .index = &index, .loaded = loaded};
+
+  const rlp_span_t encoded = {.data = proof->nodes[pos].data, .len = proof->nodes[pos].size};
+  mpt_node_t *const node = load_node(&ctx, &encoded);
+  if (node == nullptr) {
+    mpt_clear(mpt);
+    return false;
+  }
+  node->cached_hash = *root;
+  node->hash_valid = true;
+  mpt->backend->vtable->set_root(mpt->backend, node);
+  return true;
+}
@@ -425,13 +425,11 @@ bool uint256_from_hex(const char *hex, uint256_t *out) {
   }
   *out = uint256_zero();
 
-  uint8_t bytes[UINT256_BYTES];
-  if (!hex_decode(hex, bytes, UINT256_BYTES)) {
+  // Exactly 64 digits, decoded straight into the limbs
+  if (hex == nullptr || hex_strlen(hex) != UINT256_BYTES * 2) {
     return false;
   }
-
-  *out = uint256_from_bytes_be(bytes, UINT256_BYTES);
-  return true;
+  return hex_decode_uint256(hex, out);
 }
 
 // =============================================================================
@@ -2,48 +2,223 @@
 
 #include <string.h>
 
+// Vector kernels: SSE2 is the x86-64 baseline (AVX2 widens it when enabled at
+// compile time), NEON the AArch64 baseline. Freestanding builds and other
+// targets use the scalar loops, which also handle the tails.
+#if !defined(DIV0_FREESTANDING) && defined(__SSE2__)
+#define HEX_SIMD_SSE2 1
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define HEX_SIMD_AVX2 1
+#include <immintrin.h>
+#endif
+#elif !defined(DIV0_FREESTANDING) && defined(__aarch64__) && defined(__ARM_NEON)
+#define HEX_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
 // Lookup table for nibble to hex char conversion
 static constexpr char HEX_CHARS[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
                                        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
 
 // ============================================================================
-// Helper to skip 0x prefix
+// Vector Kernels
+// ============================================================================
+//
+// Decoding maps every character to a nibble with range checks instead of a
+// table: c - '0' <= 9 for digits, (c | 0x20) - 'a' <= 5 for letters (the OR
+// folds 'A'-'F' onto 'a'-'f'). Characters passing neither check mark the
+// input invalid; validity is accumulated and checked once at the end.
+// Encoding turns a nibble n into '0' + n, plus 'a' - '0' - 10 when n > 9.
+
+#ifdef HEX_SIMD_SSE2
+
+static inline __m128i sse2_nibbles(const __m128i chars, __m128i *const valid) {
+  const __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+  const __m128i alpha =
+      _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+  const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+  const __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+  *valid = _mm_and_si128(*valid, _mm_or_si128(is_digit, is_alpha));
+  return _mm_or_si128(_mm_and_si128(is_digit, digit),
+                      _mm_and_si128(is_alpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+}
+
+/// Decode 16 characters into 8 bytes.
+static inline void sse2_decode_8(const char *const hex, uint8_t *const out, __m128i *const valid) {
+  const __m128i nibbles = sse2_nibbles(_mm_loadu_si128((const __m128i *)hex), valid);
+  // 16-bit lane = hi | lo << 8 -> (hi << 4 | lo) in the low byte
+  const __m128i pairs = _mm_or_si128(_mm_slli_epi16(nibbles, 4), _mm_srli_epi16(nibbles, 8));
+  const __m128i bytes = _mm_and_si128(pairs, _mm_set1_epi16(0x00FF));
+  _mm_storel_epi64((__m128i *)out, _mm_packus_epi16(bytes, bytes));
+}
+
+static inline __m128i sse2_hex_chars(const __m128i nibbles) {
+  const __m128i letter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+  return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')),
+                      _mm_and_si128(letter, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+/// Encode 16 bytes into 32 characters.
+static inline void sse2_encode_16(const uint8_t *const data, char *const out) {
+  const __m128i bytes = _mm_loadu_si128((const __m128i *)data);
+  const __m128i mask = _mm_set1_epi8(0x0F);
+  const __m128i hi = sse2_hex_chars(_mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+  const __m128i lo = sse2_hex_chars(_mm_and_si128(bytes, mask));
+  _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi8(hi, lo));
+  _mm_storeu_si128((__m128i *)(out + 16), _mm_unpackhi_epi8(hi, lo));
+}
+
+#endif // HEX_SIMD_SSE2
+
+#ifdef HEX_SIMD_AVX2
+
+static inline __m256i avx2_nibbles(const __m256i chars, __m256i *const valid) {
+  const __m256i digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+  const __m256i alpha =
+      _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+  const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+  const __m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+  *valid = _mm256_and_si256(*valid, _mm256_or_si256(is_digit, is_alpha));
+  return _mm256_or_si256(_mm256_and_si256(is_digit, digit),
+                         _mm256_and_si256(is_alpha, _mm256_add_epi8(alpha, _mm256_set1_epi8(10))));
+}
+
+/// Decode 32 characters into 16 bytes.
+static inline void avx2_decode_16(const char *const hex, uint8_t *const out, __m256i *const valid) {
+  const __m256i nibbles = avx2_nibbles(_mm256_loadu_si256((const __m256i *)hex), valid);
+  // hi * 16 + lo per 16-bit lane, then pack and gather the two 64-bit halves
+  const __m256i pairs = _mm256_maddubs_epi16(nibbles, _mm256_set1_epi16(0x0110));
+  const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(pairs, pairs), 0x08);
+  _mm_storeu_si128((__m128i *)out, _mm256_castsi256_si128(packed));
+}
+
+static inline __m256i avx2_hex_chars(const __m256i nibbles) {
+  const __m256i letter = _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9));
+  return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')),
+                         _mm256_and_si256(letter, _mm256_set1_epi8('a' - '0' - 10)));
+}
+
+/// Encode 32 bytes into 64 characters.
+static inline void avx2_encode_32(const uint8_t *const data, char *const out) {
+  const __m256i bytes = _mm256_loadu_si256((const __m256i *)data);
+  const __m256i mask = _mm256_set1_epi8(0x0F);
+  const __m256i hi = avx2_hex_chars(_mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+  const __m256i lo = avx2_hex_chars(_mm256_and_si256(bytes, mask));
+  // unpack works within 128-bit lanes: {0-7, 16-23} and {8-15, 24-31}
+  const __m256i first = _mm256_unpacklo_epi8(hi, lo);
+  const __m256i second = _mm256_unpackhi_epi8(hi, lo);
+  _mm256_storeu_si256((__m256i *)out, _mm256_permute2x128_si256(first, second, 0x20));
+  _mm256_storeu_si256((__m256i *)(out + 32), _mm256_permute2x128_si256(first, second, 0x31));
+}
+
+#endif // HEX_SIMD_AVX2
+
+#ifdef HEX_SIMD_NEON
+
+static inline uint8x16_t neon_nibbles(const uint8x16_t chars, uint8x16_t *const valid) {
+  const uint8x16_t digit = vsubq_u8(chars, vdupq_n_u8('0'));
+  const uint8x16_t alpha = vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+  const uint8x16_t is_digit = vcleq_u8(digit, vdupq_n_u8(9));
+  const uint8x16_t is_alpha = vcleq_u8(alpha, vdupq_n_u8(5));
+  *valid = vandq_u8(*valid, vorrq_u8(is_digit, is_alpha));
+  return vbslq_u8(is_digit, digit, vaddq_u8(alpha, vdupq_n_u8(10)));
+}
+
+/// Decode 32 characters into 16 bytes.
+static inline void neon_decode_16(const char *const hex, uint8_t *const out,
+                                  uint8x16_t *const valid) {
+  // De-interleaving load: val[0] holds the high nibble characters
+  const uint8x16x2_t chars = vld2q_u8((const uint8_t *)hex);
+  const uint8x16_t hi = neon_nibbles(chars.val[0], valid);
+  const uint8x16_t lo = neon_nibbles(chars.val[1], valid);
+  vst1q_u8(out, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+}
+
+/// Encode 16 bytes into 32 characters.
+static inline void neon_encode_16(const uint8_t *const data, char *const out) {
+  const uint8x16_t table = vld1q_u8((const uint8_t *)HEX_CHARS);
+  const uint8x16_t bytes = vld1q_u8(data);
+  uint8x16x2_t chars;
+  chars.val[0] = vqtbl1q_u8(table, vshrq_n_u8(bytes, 4));
+  chars.val[1] = vqtbl1q_u8(table, vandq_u8(bytes, vdupq_n_u8(0x0F)));
+  vst2q_u8((uint8_t *)out, chars);
+}
+
+#endif // HEX_SIMD_NEON
+
+// ============================================================================
+// Helpers
 // ============================================================================
 
-static const char *skip_0x_prefix(const char *const hex) {
-  if (hex[0] == '0' && hex[1] != '\0' && (hex[1] == 'x' || hex[1] == 'X')) {
-    return hex + 2;
+/// Parse 1-16 hex digits (most significant first) into a u64.
+static bool decode_be_u64(const char *const digits, const size_t count, uint64_t *const out) {
+  uint64_t value = 0;
+  if (count == 16) {
+    uint8_t bytes[8];
+    if (!hex_decode_digits(digits, bytes, sizeof(bytes))) {
+      return false;
+    }
+    for (size_t i = 0; i < sizeof(bytes); i++) {
+      value = (value << 8) | bytes[i];
+    }
+    *out = value;
+    return true;
+  }
+  for (size_t i = 0; i < count; i++) {
+    uint8_t nibble;
+    if (!hex_char_to_nibble(digits[i], &nibble)) {
+      return false;
+    }
+    value = (value << 4) | nibble;
   }
-  return hex;
+  *out = value;
+  return true;
 }
 
 // ============================================================================
 // Hex Decoding
 // ============================================================================
 
-bool hex_decode(const char *hex, uint8_t *const out, const size_t out_len) {
-  if (hex == nullptr || out == nullptr) {
+bool hex_decode_digits(const char *const digits, uint8_t *const out, const size_t out_len) {
+  size_t i = 0;
+#ifdef HEX_SIMD_AVX2
+  __m256i valid_wide = _mm256_set1_epi8(-1);
+  for (; out_len - i >= 16; i += 16) {
+    avx2_decode_16(digits + (i * 2), out + i, &valid_wide);
+  }
+  if (_mm256_movemask_epi8(valid_wide) != -1) {
     return false;
   }
-
-  // Skip optional 0x prefix
-  hex = skip_0x_prefix(hex);
-
-  // Validate length
-  const size_t hex_len = strlen(hex);
-  if (hex_len != out_len * 2) {
+#endif
+#ifdef HEX_SIMD_SSE2
+  __m128i valid = _mm_set1_epi8(-1);
+  for (; out_len - i >= 8; i += 8) {
+    sse2_decode_8(digits + (i * 2), out + i, &valid);
+  }
+  if (_mm_movemask_epi8(valid) != 0xFFFF) {
     return false;
   }
+#endif
+#ifdef HEX_SIMD_NEON
+  uint8x16_t valid = vdupq_n_u8(0xFF);
+  for (; out_len - i >= 16; i += 16) {
+    neon_decode_16(digits + (i * 2), out + i, &valid);
+  }
+  if (vminvq_u8(valid) != 0xFF) {
+    return false;
+  }
+#endif
 
-  // Parse hex pairs
-  for (size_t i = 0; i < out_len; i++) {
+  // Scalar tail (the whole input without vector support)
+  for (; i < out_len; i++) {
     uint8_t high;
     uint8_t low;
 
-    if (!hex_char_to_nibble(hex[i * 2], &high)) {
+    if (!hex_char_to_nibble(digits[i * 2], &high)) {
       return false;
     }
-    if (!hex_char_to_nibble(hex[(i * 2) + 1], &low)) {
+    if (!hex_char_to_nibble(digits[(i * 2) + 1], &low)) {
       return false;
     }
 
@@ -53,12 +228,29 @@ bool hex_decode(const char *hex, uint8_t *const out, const size_t out_len) {
   return true;
 }
 
+bool hex_decode(const char *hex, uint8_t *const out, const size_t out_len) {
+  if (hex == nullptr || out == nullptr) {
+    return false;
+  }
+
+  // Skip optional 0x prefix
+  hex = hex_skip_prefix(hex);
+
+  // Validate length
+  const size_t hex_len = strlen(hex);
+  if (hex_len != out_len * 2) {
+    return false;
+  }
+
+  return hex_decode_digits(hex, out, out_len);
+}
+
 bool hex_decode_u64(const char *hex, uint64_t *const out) {
   if (hex == nullptr || out == nullptr) {
     return false;
   }
 
-  hex = skip_0x_prefix(hex);
+  hex = hex_skip_prefix(hex);
   const size_t len = strlen(hex);
 
   // Empty string or too long (max 16 hex digits = 64 bits)
@@ -66,17 +258,7 @@ bool hex_decode_u64(const char *hex, uint64_t *const out) {
     return false;
   }
 
-  uint64_t value = 0;
-  for (size_t i = 0; i < len; i++) {
-    uint8_t nibble;
-    if (!hex_char_to_nibble(hex[i], &nibble)) {
-      return false;
-    }
-    value = (value << 4) | nibble;
-  }
-
-  *out = value;
-  return true;
+  return decode_be_u64(hex, len, out);
 }
 
 bool hex_decode_uint256(const char *hex, uint256_t *const out) {
@@ -84,7 +266,7 @@ bool hex_decode_uint256(const char *hex, uint256_t *const out) {
     return false;
   }
 
-  hex = skip_0x_prefix(hex);
+  hex = hex_skip_prefix(hex);
   const size_t len = strlen(hex);
 
   // Empty string or too long (max 64 hex digits = 256 bits)
@@ -92,26 +274,16 @@ bool hex_decode_uint256(const char *hex, uint256_t *const out) {
     return false;
   }
 
-  // Zero-initialize output
+  // Decode straight into the little-endian limbs: the last 16 digits are
+  // limb 0, the 16 before them limb 1, and so on
   *out = uint256_zero();
-
-  // Parse nibbles from most significant to least significant
-  // uint256 is stored in little-endian limb order
-  for (size_t i = 0; i < len; i++) {
-    uint8_t nibble;
-    if (!hex_char_to_nibble(hex[i], &nibble)) {
+  size_t remaining = len;
+  for (size_t limb = 0; remaining > 0; limb++) {
+    const size_t count = remaining < 16 ? remaining : 16;
+    remaining -= count;
+    if (!decode_be_u64(hex + remaining, count, &out->limbs[limb])) {
       return false;
     }
-
-    // Shift left by 4 bits and add nibble
-    // We need to shift the entire uint256 left by 4 bits
-    uint64_t carry = 0;
-    for (size_t limb = 0; limb < 4; limb++) {
-      const uint64_t new_carry = out->limbs[limb] >> 60;
-      out->limbs[limb] = (out->limbs[limb] << 4) | carry;
-      carry = new_carry;
-    }
-    out->limbs[0] |= nibble;
   }
 
   return true;
@@ -121,7 +293,7 @@ size_t hex_strlen(const char *hex) {
   if (hex == nullptr) {
     return 0;
   }
-  hex = skip_0x_prefix(hex);
+  hex = hex_skip_prefix(hex);
   return strlen(hex);
 }
 
@@ -129,15 +301,34 @@ size_t hex_strlen(const char *hex) {
 // Hex Encoding
 // ============================================================================
 
-void hex_encode(const uint8_t *const data, const size_t len, char *const out) {
-  out[0] = '0';
-  out[1] = 'x';
+void hex_encode_digits(const uint8_t *const data, const size_t len, char *const out) {
+  size_t i = 0;
+#ifdef HEX_SIMD_AVX2
+  for (; len - i >= 32; i += 32) {
+    avx2_encode_32(data + i, out + (i * 2));
+  }
+#endif
+#ifdef HEX_SIMD_SSE2
+  for (; len - i >= 16; i += 16) {
+    sse2_encode_16(data + i, out + (i * 2));
+  }
+#endif
+#ifdef HEX_SIMD_NEON
+  for (; len - i >= 16; i += 16) {
+    neon_encode_16(data + i, out + (i * 2));
+  }
+#endif
 
-  for (size_t i = 0; i < len; i++) {
-    out[2 + (i * 2)] = HEX_CHARS[(data[i] >> 4) & 0x0F];
-    out[2 + (i * 2) + 1] = HEX_CHARS[data[i] & 0x0F];
+  for (; i < len; i++) {
+    out[i * 2] = HEX_CHARS[(data[i] >> 4) & 0x0F];
+    out[(i * 2) + 1] = HEX_CHARS[data[i] & 0x0F];
   }
+}
 
+void hex_encode(const uint8_t *const data, const size_t len, char *const out) {
+  out[0] = '0';
+  out[1] = 'x';
+  hex_encode_digits(data, len, out + 2);
   out[2 + (len * 2)] = '\0';
 }
 
@@ -188,62 +379,31 @@ void hex_encode_uint256(const uint256_t *const value, char *const out) {
     start++;
   }
 
-  // Check if first nibble is zero (for minimal encoding)
-  const bool skip_first_nibble = (bytes[start] < 0x10);
-
+  // Minimal encoding: a leading zero nibble is dropped
   size_t pos = 2;
-  for (size_t i = start; i < 32; i++) {
-    if (i == start && skip_first_nibble) {
-      // Only write low nibble for first byte if high nibble is zero
-      out[pos++] = HEX_CHARS[bytes[i] & 0x0F];
-    } else {
-      out[pos++] = HEX_CHARS[(bytes[i] >> 4) & 0x0F];
-      out[pos++] = HEX_CHARS[bytes[i] & 0x0F];
-    }
+  if (bytes[start] < 0x10) {
+    out[pos++] = HEX_CHARS[bytes[start]];
+    start++;
   }
+  hex_encode_digits(bytes + start, 32 - start, out + pos);
+  pos += (32 - start) * 2;
 
   out[pos] = '\0';
 }
 
 void hex_encode_uint256_padded(const uint256_t *const value, char *const out) {
-  out[0] = '0';
-  out[1] = 'x';
-
-  // Convert to big-endian bytes
+  // Convert to big-endian bytes, then write all 32 bytes (64 hex chars)
   uint8_t bytes[32];
   uint256_to_bytes_be(*value, bytes);
-
-  // Write all 32 bytes (64 hex chars)
-  for (size_t i = 0; i < 32; i++) {
-    out[2 + (i * 2)] = HEX_CHARS[(bytes[i] >> 4) & 0x0F];
-    out[2 + (i * 2) + 1] = HEX_CHARS[bytes[i] & 0x0F];
-  }
-
-  out[66] = '\0';
+  hex_encode(bytes, sizeof(bytes), out);
 }
 
 void hex_encode_address(const address_t *const addr, char *const out) {
-  out[0] = '0';
-  out[1] = 'x';
-
-  // Write all 20 bytes (40 hex chars)
-  for (size_t i = 0; i < ADDRESS_SIZE; i++) {
-    out[2 + (i * 2)] = HEX_CHARS[(addr->bytes[i] >> 4) & 0x0F];
-    out[2 + (i * 2) + 1] = HEX_CHARS[addr->bytes[i] & 0x0F];
-  }
-
-  out[42] = '\0';
+  // Always 20 bytes (40 hex chars)
+  hex_encode(addr->bytes, ADDRESS_SIZE, out);
 }
 
 void hex_encode_hash(const hash_t *const hash, char *const out) {
-  out[0] = '0';
-  out[1] = 'x';
-
-  // Write all 32 bytes (64 hex chars)
-  for (size_t i = 0; i < HASH_SIZE; i++) {
-    out[2 + (i * 2)] = HEX_CHARS[(hash->bytes[i] >> 4) & 0x0F];
-    out[2 + (i * 2) + 1] = HEX_CHARS[hash->bytes[i] & 0x0F];
-  }
-
-  out[66] = '\0';
+  // Always 32 bytes (64 hex chars)
+  hex_encode(hash->bytes, HASH_SIZE, out);
 }
@@ -0,0 +1,116 @@
+// Unit tests for BN254 (alt_bn128) curve operations
+// Expected values computed with py_ecc (bn128)
+
+#include "crypto/test_bn254.h"
+
+#include "div0/crypto/bn254.h"
+#include "div0/util/hex.h"
+
+#include "unity.h"
+
+#include <string.h>
+
+// G1 generator (1, 2)
+static const char *const G1_HEX =
+    "0000000000000000000000000000000000000000000000000000000000000001"
+    "0000000000000000000000000000000000000000000000000000000000000002";
+
+// 2 * G1
+static const char *const G1_DOUBLE_HEX =
+    "030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd3"
+    "15ed738c0e0a7c92e7845f96b2ae9c0a68a6a449e3538fc7ff3ebf7a5a18a2c4";
+
+// -G1
+static const char *const G1_NEG_HEX =
+    "0000000000000000000000000000000000000000000000000000000000000001"
+    "30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd45";
+
+// G2 generator (x.c1, x.c0, y.c1, y.c0)
+static const char *const G2_HEX =
+    "198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2"
+    "1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed"
+    "090689d0585ff075ec9e99ad690c3395bc4b313370b38ef355acdadcd122975b"
+    "12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa";
+
+static void decode(const char *const hex, uint8_t *const out, const size_t len) {
+  TEST_ASSERT_TRUE_MESSAGE(hex_decode(hex, out, len), "Failed to decode test vector");
+}
+
+// =============================================================================
+// G1 Arithmetic
+// =============================================================================
+
+void test_bn254_g1_add_doubles_generator(void) {
+  uint8_t g[BN254_G1_SIZE];
+  uint8_t expected[BN254_G1_SIZE];
+  uint8_t out[BN254_G1_SIZE];
+  decode(G1_HEX, g, sizeof(g));
+  decode(G1_DOUBLE_HEX, expected, sizeof(expected));
+
+  TEST_ASSERT_TRUE(bn254_g1_add(g, g, out));
+  TEST_ASSERT_EQUAL_MEMORY(expected, out, BN254_G1_SIZE);
+}
+
+void test_bn254_g1_mul_matches_add(void) {
+  uint8_t g[BN254_G1_SIZE];
+  uint8_t expected[BN254_G1_SIZE];
+  uint8_t out[BN254_G1_SIZE];
+  uint8_t scalar[BN254_SCALAR_SIZE] = {0};
+  decode(G1_HEX, g, sizeof(g));
+  decode(G1_DOUBLE_HEX, expected, sizeof(expected));
+  scalar[BN254_SCALAR_SIZE - 1] = 2;
+
+  TEST_ASSERT_TRUE(bn254_g1_mul(g, scalar, out));
+  TEST_ASSERT_EQUAL_MEMORY(expected, out, BN254_G1_SIZE);
+
+  // G + (-G) is the point at infinity
+  uint8_t neg[BN254_G1_SIZE];
+  const uint8_t zero[BN254_G1_SIZE] = {0};
+  decode(G1_NEG_HEX, neg, sizeof(neg));
+  TEST_ASSERT_TRUE(bn254_g1_add(g, neg, out));
+  TEST_ASSERT_EQUAL_MEMORY(zero, out, BN254_G1_SIZE);
+}
+
+void test_bn254_g1_rejects_off_curve(void) {
+  uint8_t g[BN254_G1_SIZE];
+  uint8_t bad[BN254_G1_SIZE];
+  uint8_t out[BN254_G1_SIZE];
+  decode(G1_HEX, g, sizeof(g));
+  decode(G1_HEX, bad, sizeof(bad));
+  bad[BN254_G1_SIZE - 1] = 3; // (1, 3) is not on y^2 = x^3 + 3
+
+  TEST_ASSERT_FALSE(bn254_g1_add(g, bad, out));
+}
+
+// =============================================================================
+// Pairing
+// =============================================================================
+
+void test_bn254_pairing_empty_is_true(void) {
+  bool result = false;
+  TEST_ASSERT_TRUE(bn254_pairing_check(nullptr, 0, &result));
+  TEST_ASSERT_TRUE(result);
+}
+
+void test_bn254_pairing_inverse_pair_is_true(void) {
+  // e(G1, G2) * e(-G1, G2) == 1
+  uint8_t pairs[2 * BN254_PAIR_SIZE];
+  decode(G1_HEX, pairs, BN254_G1_SIZE);
+  decode(G2_HEX, pairs + BN254_G1_SIZE, BN254_G2_SIZE);
+  decode(G1_NEG_HEX, pairs + BN254_PAIR_SIZE, BN254_G1_SIZE);
+  decode(G2_HEX, pairs + BN254_PAIR_SIZE + BN254_G1_SIZE, BN254_G2_SIZE);
+
+  bool result = false;
+  TEST_ASSERT_TRUE(bn254_pairing_check(pairs, 2, &result));
+  TEST_ASSERT_TRUE(result);
+}
+
+void test_bn254_pairing_single_pair_is_false(void) {
+  uint8_t pair[BN254_PAIR_SIZE];
+  decode(G1_HEX, pair, BN254_G1_SIZE);
+  decode(G2_HEX, pair + BN254_G1_SIZE, BN254_G2_SIZE);
+
+  bool result = true;
+  TEST_ASSERT_TRUE(bn254_pairing_check(pair, 1, &result));
+  TEST_ASSERT_FALSE(result);
+}
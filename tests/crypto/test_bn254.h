@@ -0,0 +1,14 @@
+#ifndef TEST_BN254_H
+#define TEST_BN254_H
+
+// G1 arithmetic
+void test_bn254_g1_add_doubles_generator(void);
+void test_bn254_g1_mul_matches_add(void);
+void test_bn254_g1_rejects_off_curve(void);
+
+// Pairing
+void test_bn254_pairing_empty_is_true(void);
+void test_bn254_pairing_inverse_pair_is_true(void);
+void test_bn254_pairing_single_pair_is_false(void);
+
+#endif // TEST_BN254_H
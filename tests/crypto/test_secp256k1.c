@@ -202,4 +202,62 @@ void test_secp256k1_recover_pubkey_invalid_recovery_id(void) {
   TEST_ASSERT_FALSE(secp256k1_recover_pubkey(ctx, hash, 4, sig).success);
 
   secp256k1_ctx_destroy(ctx);
-}
\ No newline at end of file
+}
+// =============================================================================
+// Signing Tests
+// =============================================================================
+
+void test_secp256k1_secret_to_address(void) {
+  secp256k1_ctx_t *ctx = secp256k1_ctx_create();
+  TEST_ASSERT_NOT_NULL(ctx);
+
+  // Secret key 1 -> 0x7e5f4552091a69125d5dfcb7b8c2659029395bdf
+  uint8_t secret[32] = {0};
+  secret[31] = 1;
+  address_t expected;
+  TEST_ASSERT_TRUE(address_from_hex("7e5f4552091a69125d5dfcb7b8c2659029395bdf", &expected));
+
+  address_t addr;
+  TEST_ASSERT_TRUE(secp256k1_secret_to_address(ctx, secret, &addr));
+  TEST_ASSERT_EQUAL_MEMORY(expected.bytes, addr.bytes, ADDRESS_SIZE);
+
+  // Zero is not a valid secret key
+  uint8_t zero[32] = {0};
+  TEST_ASSERT_FALSE(secp256k1_secret_to_address(ctx, zero, &addr));
+
+  secp256k1_ctx_destroy(ctx);
+}
+
+void test_secp256k1_sign_recover_roundtrip(void) {
+  secp256k1_ctx_t *ctx = secp256k1_ctx_create();
+  TEST_ASSERT_NOT_NULL(ctx);
+
+  uint8_t secret[32];
+  for (int i = 0; i < 32; i++) {
+    secret[i] = (uint8_t)(i + 1);
+  }
+  address_t signer;
+  TEST_ASSERT_TRUE(secp256k1_secret_to_address(ctx, secret, &signer));
+
+  const uint256_t hash = get_test_hash();
+  uint8_t hash_be[32];
+  uint256_to_bytes_be(hash, hash_be);
+
+  const ecdsa_sign_result_t sig = secp256k1_sign(ctx, hash_be, secret);
+  TEST_ASSERT_TRUE(sig.success);
+  TEST_ASSERT_TRUE(sig.recovery_id == 0 || sig.recovery_id == 1);
+
+  // Deterministic nonces: signing again gives the same signature
+  const ecdsa_sign_result_t again = secp256k1_sign(ctx, hash_be, secret);
+  TEST_ASSERT_EQUAL_MEMORY(sig.signature, again.signature, 64);
+
+  // EIP-155 encoded v recovers the signer
+  const uint256_t r = uint256_from_bytes_be(sig.signature, 32);
+  const uint256_t s = uint256_from_bytes_be(sig.signature + 32, 32);
+  const uint64_t v = (1 * 2) + 35 + (uint64_t)sig.recovery_id;
+  const ecrecover_result_t recovered = secp256k1_ecrecover(ctx, &hash, v, &r, &s, 1);
+  TEST_ASSERT_TRUE(recovered.success);
+  TEST_ASSERT_EQUAL_MEMORY(signer.bytes, recovered.address.bytes, ADDRESS_SIZE);
+
+  secp256k1_ctx_destroy(ctx);
+}
@@ -19,4 +19,8 @@ void test_secp256k1_ecrecover_zero_signature(void);
 // recover_public_key tests
 void test_secp256k1_recover_pubkey_invalid_recovery_id(void);
 
+// Signing tests
+void test_secp256k1_secret_to_address(void);
+void test_secp256k1_sign_recover_roundtrip(void);
+
 #endif // TEST_SECP256K1_H
\ No newline at end of file
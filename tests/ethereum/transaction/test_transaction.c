@@ -219,6 +219,7 @@ void test_transaction_accessors(void) {
   transaction_t tx;
   tx.type = TX_TYPE_EIP1559;
   eip1559_tx_init(&tx.eip1559);
+  transaction_clear_cache(&tx);
 
   tx.eip1559.nonce = 42;
   tx.eip1559.gas_limit = 100000;
@@ -297,6 +298,7 @@ void test_transaction_recover_sender_legacy(void) {
   transaction_t unified_tx;
   unified_tx.type = TX_TYPE_LEGACY;
   unified_tx.legacy = tx;
+  transaction_clear_cache(&unified_tx);
 
   ecrecover_result_t result = transaction_recover_sender(ctx, &unified_tx, &test_arena);
   // With zero signature, recovery should fail
@@ -577,6 +579,7 @@ void test_roundtrip_constructed_legacy(void) {
   transaction_t tx;
   tx.type = TX_TYPE_LEGACY;
   legacy_tx_init(&tx.legacy);
+  transaction_clear_cache(&tx);
 
   tx.legacy.nonce = 42;
   tx.legacy.gas_price = uint256_from_u64(20000000000ULL);
@@ -616,6 +619,7 @@ void test_roundtrip_constructed_eip1559(void) {
   transaction_t tx;
   tx.type = TX_TYPE_EIP1559;
   eip1559_tx_init(&tx.eip1559);
+  transaction_clear_cache(&tx);
 
   tx.eip1559.chain_id = 1;
   tx.eip1559.nonce = 100;
@@ -651,3 +655,119 @@ void test_roundtrip_constructed_eip1559(void) {
       uint256_eq(tx.eip1559.max_priority_fee_per_gas, decoded.eip1559.max_priority_fee_per_gas));
   TEST_ASSERT_TRUE(uint256_eq(tx.eip1559.max_fee_per_gas, decoded.eip1559.max_fee_per_gas));
 }
+
+void test_decode_view_zero_copy(void) {
+  transaction_t tx;
+  tx.type = TX_TYPE_EIP1559;
+  eip1559_tx_init(&tx.eip1559);
+  transaction_clear_cache(&tx);
+  tx.eip1559.chain_id = 1;
+  tx.eip1559.gas_limit = 50000;
+  tx.eip1559.to = (address_t *)div0_arena_alloc(&test_arena, sizeof(address_t));
+  memset(tx.eip1559.to->bytes, 0xCD, 20);
+  static const uint8_t calldata[] = {0xa9, 0x05, 0x9c, 0xbb, 0x00, 0x01};
+  bytes_init_arena(&tx.eip1559.data, &test_arena);
+  TEST_ASSERT_TRUE(bytes_from_data(&tx.eip1559.data, calldata, sizeof(calldata)));
+  tx.eip1559.r = uint256_from_u64(1);
+  tx.eip1559.s = uint256_from_u64(2);
+  const hash_t expected = transaction_hash(&tx, &test_arena);
+
+  bytes_t encoded = transaction_encode(&tx, &test_arena);
+  transaction_t decoded;
+  tx_decode_result_t result =
+      transaction_decode_view(encoded.data, encoded.size, &decoded, &test_arena);
+  TEST_ASSERT_EQUAL_INT(TX_DECODE_OK, result.error);
+
+  // Calldata and the retained encoding point into the input
+  TEST_ASSERT_EQUAL(sizeof(calldata), decoded.eip1559.data.size);
+  TEST_ASSERT_TRUE(decoded.eip1559.data.data > encoded.data &&
+                   decoded.eip1559.data.data < encoded.data + encoded.size);
+  TEST_ASSERT_EQUAL_PTR(encoded.data, decoded.encoded);
+  TEST_ASSERT_EQUAL(encoded.size, decoded.encoded_size);
+
+  // Hashing the retained encoding matches re-encoding
+  TEST_ASSERT_EQUAL_MEMORY(expected.bytes, transaction_hash(&decoded, &test_arena).bytes,
+                           HASH_SIZE);
+
+  // The copying decoder does not retain the input
+  result = transaction_decode(encoded.data, encoded.size, &decoded, &test_arena);
+  TEST_ASSERT_EQUAL_INT(TX_DECODE_OK, result.error);
+  TEST_ASSERT_NULL(decoded.encoded);
+}
+
+void test_signing_hash_from_encoding(void) {
+  // EIP-155 legacy tx with calldata long enough for a multi-byte list header
+  transaction_t tx;
+  transaction_init(&tx);
+  tx.legacy.nonce = 7;
+  tx.legacy.gas_price = uint256_from_u64(1000000000);
+  tx.legacy.gas_limit = 90000;
+  uint8_t calldata[100];
+  memset(calldata, 0x5A, sizeof(calldata));
+  bytes_init_arena(&tx.legacy.data, &test_arena);
+  TEST_ASSERT_TRUE(bytes_from_data(&tx.legacy.data, calldata, sizeof(calldata)));
+  tx.legacy.v = 37; // chain_id 1
+  tx.legacy.r = uint256_from_u64(3);
+  tx.legacy.s = uint256_from_u64(4);
+
+  const hash_t expected = transaction_signing_hash(&tx, &test_arena);
+  bytes_t encoded = transaction_encode(&tx, &test_arena);
+  transaction_t decoded;
+  tx_decode_result_t result =
+      transaction_decode_view(encoded.data, encoded.size, &decoded, &test_arena);
+  TEST_ASSERT_EQUAL_INT(TX_DECODE_OK, result.error);
+  TEST_ASSERT_TRUE(decoded.hash_cached);
+  TEST_ASSERT_EQUAL_MEMORY(expected.bytes, transaction_signing_hash(&decoded, &test_arena).bytes,
+                           HASH_SIZE);
+
+  // Pre-EIP-155 legacy: no [chain_id, 0, 0] suffix
+  tx.legacy.v = 27;
+  const hash_t expected_pre155 = transaction_signing_hash(&tx, &test_arena);
+  encoded = transaction_encode(&tx, &test_arena);
+  result = transaction_decode_view(encoded.data, encoded.size, &decoded, &test_arena);
+  TEST_ASSERT_EQUAL_INT(TX_DECODE_OK, result.error);
+  TEST_ASSERT_EQUAL_MEMORY(expected_pre155.bytes,
+                           transaction_signing_hash(&decoded, &test_arena).bytes, HASH_SIZE);
+
+  // Typed tx: the type byte is hashed ahead of the new list header
+  tx.type = TX_TYPE_EIP1559;
+  eip1559_tx_init(&tx.eip1559);
+  tx.eip1559.chain_id = 1;
+  tx.eip1559.gas_limit = 50000;
+  bytes_init_arena(&tx.eip1559.data, &test_arena);
+  TEST_ASSERT_TRUE(bytes_from_data(&tx.eip1559.data, calldata, sizeof(calldata)));
+  tx.eip1559.y_parity = 1;
+  tx.eip1559.r = uint256_from_u64(5);
+  tx.eip1559.s = uint256_from_u64(6);
+  const hash_t expected_typed = transaction_signing_hash(&tx, &test_arena);
+  encoded = transaction_encode(&tx, &test_arena);
+  result = transaction_decode_view(encoded.data, encoded.size, &decoded, &test_arena);
+  TEST_ASSERT_EQUAL_INT(TX_DECODE_OK, result.error);
+  TEST_ASSERT_EQUAL_MEMORY(expected_typed.bytes,
+                           transaction_signing_hash(&decoded, &test_arena).bytes, HASH_SIZE);
+}
+
+void test_cache_hashes(void) {
+  transaction_t tx;
+  transaction_init(&tx);
+  tx.legacy.gas_limit = 21000;
+  bytes_init_arena(&tx.legacy.data, &test_arena);
+  tx.legacy.v = 27;
+  tx.legacy.r = uint256_from_u64(1);
+  tx.legacy.s = uint256_from_u64(2);
+
+  const hash_t hash = transaction_hash(&tx, &test_arena);
+  const hash_t signing_hash = transaction_signing_hash(&tx, &test_arena);
+  transaction_cache_hashes(&tx, &test_arena);
+  TEST_ASSERT_TRUE(tx.hash_cached);
+  TEST_ASSERT_TRUE(tx.signing_hash_cached);
+
+  // Memoised values are returned until the cache is cleared
+  tx.legacy.nonce = 1;
+  TEST_ASSERT_EQUAL_MEMORY(hash.bytes, transaction_hash(&tx, &test_arena).bytes, HASH_SIZE);
+  TEST_ASSERT_EQUAL_MEMORY(signing_hash.bytes, transaction_signing_hash(&tx, &test_arena).bytes,
+                           HASH_SIZE);
+  transaction_clear_cache(&tx);
+  const hash_t rehashed = transaction_hash(&tx, &test_arena);
+  TEST_ASSERT_FALSE(hash_equal(&hash, &rehashed));
+}
@@ -44,5 +44,8 @@ void test_roundtrip_legacy_tx(void);
 void test_roundtrip_eip2930_tx(void);
 void test_roundtrip_constructed_legacy(void);
 void test_roundtrip_constructed_eip1559(void);
+void test_decode_view_zero_copy(void);
+void test_signing_hash_from_encoding(void);
+void test_cache_hashes(void);
 
 #endif // TEST_TRANSACTION_H
@@ -510,6 +510,28 @@ void test_evm_sstore_and_sload(void) {
   world_state_destroy(ws);
 }
 
+void test_evm_state_unavailable_aborts(void) {
+  // PUSH1 0 (slot), SLOAD, STOP - on a state that has already failed a read
+  uint8_t code[] = {OP_PUSH1, 0, OP_SLOAD, OP_STOP};
+
+  world_state_t *ws = world_state_create(&test_arena);
+  TEST_ASSERT_NOT_NULL(ws);
+  world_state_access(ws)->unavailable = true; // As after a read outside a witness
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  evm_set_state(&evm, world_state_access(ws));
+
+  execution_env_t env = make_test_env(code, sizeof(code), 100000);
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_ERROR, result.result);
+  TEST_ASSERT_EQUAL(EVM_STATE_UNAVAILABLE, result.error);
+  TEST_ASSERT_EQUAL_UINT64(100000, result.gas_used);
+
+  world_state_destroy(ws);
+}
+
 void test_evm_sstore_multiple_slots(void) {
   // Store different values in different slots, then load them back
   // PUSH1 0xAA, PUSH1 0, SSTORE  (store 0xAA at slot 0)
@@ -598,6 +620,413 @@ void test_evm_sstore_without_state(void) {
   TEST_ASSERT_EQUAL(EVM_INVALID_OPCODE, result.error);
 }
 
+// =============================================================================
+// CREATE/CREATE2 tests
+// =============================================================================
+
+// Init code that deploys the single byte 0x42:
+// PUSH1 0x42, PUSH1 0, MSTORE8, PUSH1 1, PUSH1 0, RETURN
+#define TEST_INITCODE                                                                              \
+  0x60, 0x42, 0x60, 0x00, 0x53, 0x60, 0x01, 0x60, 0x00, 0xF3
+static constexpr uint8_t TEST_INITCODE_SIZE = 10;
+static constexpr uint8_t TEST_INITCODE_OFFSET = 32 - TEST_INITCODE_SIZE;
+
+void test_evm_create_deploys_code(void) {
+  // PUSH10 initcode, PUSH1 0, MSTORE, then CREATE(value=0, offset=22, size=10)
+  uint8_t code[] = {OP_PUSH10,
+                    TEST_INITCODE,
+                    OP_PUSH1,
+                    0,
+                    OP_MSTORE,
+                    OP_PUSH1,
+                    TEST_INITCODE_SIZE,
+                    OP_PUSH1,
+                    TEST_INITCODE_OFFSET,
+                    OP_PUSH1,
+                    0,
+                    OP_CREATE,
+                    OP_STOP};
+
+  world_state_t *ws = world_state_create(&test_arena);
+  TEST_ASSERT_NOT_NULL(ws);
+  state_access_t *state = world_state_access(ws);
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  evm_set_state(&evm, state);
+
+  // Known vector: 0x6ac7...dbf0 with nonce 0 creates 0xcd23...cd8d
+  const uint8_t creator[20] = {0x6a, 0xc7, 0xea, 0x33, 0xf8, 0x83, 0x1e, 0xa9, 0xdc, 0xc5,
+                               0x33, 0x93, 0xaa, 0xa8, 0x8b, 0x25, 0xa7, 0x85, 0xdb, 0xf0};
+  const uint8_t expected[20] = {0xcd, 0x23, 0x4a, 0x47, 0x1b, 0x72, 0xba, 0x2f, 0x1c, 0xcf,
+                                0x0a, 0x70, 0xfc, 0xab, 0xa6, 0x48, 0xa5, 0xee, 0xcd, 0x8d};
+
+  execution_env_t env = make_test_env(code, sizeof(code), 1000000);
+  memcpy(env.call.address.bytes, creator, sizeof(creator));
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_EQUAL(EVM_OK, result.error);
+  TEST_ASSERT_EQUAL_UINT16(1, evm_stack_size(evm.current_frame->stack));
+
+  const uint256_t pushed = evm_stack_peek_unsafe(evm.current_frame->stack, 0);
+  const address_t created = address_from_uint256(&pushed);
+  TEST_ASSERT_EQUAL_MEMORY(expected, created.bytes, sizeof(expected));
+
+  TEST_ASSERT_EQUAL_UINT64(1, state_get_nonce(state, &env.call.address));
+  TEST_ASSERT_EQUAL_UINT64(1, state_get_nonce(state, &created));
+  const bytes_t deployed = state_get_code(state, &created);
+  TEST_ASSERT_EQUAL(1, deployed.size);
+  TEST_ASSERT_EQUAL_UINT8(0x42, deployed.data[0]);
+
+  world_state_destroy(ws);
+}
+
+void test_evm_create_failure_reverts_state(void) {
+  // Init code writes slot 0, then reverts or halts on an invalid opcode:
+  // PUSH1 0x2A, PUSH1 0, SSTORE, then PUSH1 0, PUSH1 0, REVERT or INVALID
+  const uint8_t init_codes[2][10] = {
+      {0x60, 0x2A, 0x60, 0x00, 0x55, 0x60, 0x00, 0x60, 0x00, OP_REVERT},
+      {0x60, 0x2A, 0x60, 0x00, 0x55, OP_INVALID, 0x00, 0x00, 0x00, 0x00},
+  };
+  address_t creator = address_zero();
+  creator.bytes[ADDRESS_SIZE - 1] = 0xAA;
+
+  // Expected: only the creator's nonce moves
+  world_state_t *expected_ws = world_state_create(&test_arena);
+  TEST_ASSERT_NOT_NULL(expected_ws);
+  state_access_t *const expected = world_state_access(expected_ws);
+  state_set_balance(expected, &creator, uint256_from_u64(100));
+  state_set_nonce(expected, &creator, 1);
+  const hash_t expected_root = world_state_root(expected_ws);
+
+  for (size_t i = 0; i < 2; i++) {
+    // PUSH10 initcode, PUSH1 0, MSTORE, then CREATE(value=5, offset=22, size=10)
+    uint8_t code[] = {OP_PUSH10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // Init code, copied in below
+                      OP_PUSH1,  0, OP_MSTORE, OP_PUSH1, 10, OP_PUSH1, 22, OP_PUSH1, 5, OP_CREATE,
+                      OP_STOP};
+    memcpy(&code[1], init_codes[i], sizeof(init_codes[i]));
+
+    world_state_t *ws = world_state_create(&test_arena);
+    TEST_ASSERT_NOT_NULL(ws);
+    state_access_t *const state = world_state_access(ws);
+    state_set_balance(state, &creator, uint256_from_u64(100));
+
+    evm_t evm;
+    evm_init(&evm, &test_arena, FORK_SHANGHAI);
+    evm_set_state(&evm, state);
+
+    execution_env_t env = make_test_env(code, sizeof(code), 1000000);
+    env.call.address = creator;
+    evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+    TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+    TEST_ASSERT_TRUE(uint256_is_zero(evm_stack_peek_unsafe(evm.current_frame->stack, 0)));
+
+    // No new account, value transfer or storage write survives
+    TEST_ASSERT_TRUE(uint256_eq(state_get_balance(state, &creator), uint256_from_u64(100)));
+    TEST_ASSERT_EQUAL_UINT64(1, state_get_nonce(state, &creator));
+    const hash_t root = world_state_root(ws);
+    TEST_ASSERT_TRUE(hash_equal(&expected_root, &root));
+
+    world_state_destroy(ws);
+  }
+
+  world_state_destroy(expected_ws);
+}
+
+void test_evm_call_unimplemented_precompile(void) {
+  // CALL(10000, 0x0a, 0, 0, 0, 0, 0): point evaluation is active in Cancun but
+  // has no native implementation, so the call fails and keeps the gas
+  uint8_t code[] = {OP_PUSH1, 0, OP_PUSH1, 0,    OP_PUSH1, 0,    OP_PUSH1, 0,       OP_PUSH1,
+                    0,        OP_PUSH1, 0x0a, OP_PUSH2, 0x27, 0x10, OP_CALL, OP_STOP};
+
+  world_state_t *ws = world_state_create(&test_arena);
+  TEST_ASSERT_NOT_NULL(ws);
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_CANCUN);
+  evm_set_state(&evm, world_state_access(ws));
+
+  execution_env_t env = make_test_env(code, sizeof(code), 1000000);
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_EQUAL_UINT16(1, evm_stack_size(evm.current_frame->stack));
+  TEST_ASSERT_TRUE(uint256_is_zero(evm_stack_peek_unsafe(evm.current_frame->stack, 0)));
+  TEST_ASSERT_TRUE(result.gas_used > 10000);
+
+  world_state_destroy(ws);
+}
+
+void test_evm_create_clears_return_data(void) {
+  // Init code: STATICCALL(gas, 0x04, 0, 1, 0, 0) to the identity precompile, which
+  // leaves 1 byte of return data, then POP and STOP
+  uint8_t code[] = {OP_PUSH14, 0x60, 0x00, 0x60, 0x00, 0x60, 0x01, 0x60,     0x00,
+                    0x60,      0x04, 0x5A, 0xFA, 0x50, 0x00,                 // PUSH14 init code
+                    OP_PUSH1,  0,    OP_MSTORE,                              // mem[18..32]
+                    OP_PUSH1,  14,   OP_PUSH1, 18, OP_PUSH1, 0, OP_CREATE,   // CREATE(0, 18, 14)
+                    OP_RETURNDATASIZE, OP_STOP};
+
+  world_state_t *ws = world_state_create(&test_arena);
+  TEST_ASSERT_NOT_NULL(ws);
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  evm_set_state(&evm, world_state_access(ws));
+
+  execution_env_t env = make_test_env(code, sizeof(code), 1000000);
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_EQUAL_UINT16(2, evm_stack_size(evm.current_frame->stack));
+  const uint256_t address = evm_stack_peek_unsafe(evm.current_frame->stack, 1);
+  TEST_ASSERT_FALSE(uint256_is_zero(address));
+  const uint256_t size = evm_stack_peek_unsafe(evm.current_frame->stack, 0);
+  TEST_ASSERT_TRUE(uint256_is_zero(size));
+
+  world_state_destroy(ws);
+}
+
+void test_evm_create2_collision(void) {
+  // Two CREATE2 calls with the same salt and init code: the second address
+  // already has code, so it fails and pushes zero.
+  uint8_t code[] = {OP_PUSH10,
+                    TEST_INITCODE,
+                    OP_PUSH1,
+                    0,
+                    OP_MSTORE,
+                    // CREATE2(value=0, offset=22, size=10, salt=7)
+                    OP_PUSH1,
+                    7,
+                    OP_PUSH1,
+                    TEST_INITCODE_SIZE,
+                    OP_PUSH1,
+                    TEST_INITCODE_OFFSET,
+                    OP_PUSH1,
+                    0,
+                    OP_CREATE2,
+                    // Same again
+                    OP_PUSH1,
+                    7,
+                    OP_PUSH1,
+                    TEST_INITCODE_SIZE,
+                    OP_PUSH1,
+                    TEST_INITCODE_OFFSET,
+                    OP_PUSH1,
+                    0,
+                    OP_CREATE2,
+                    OP_STOP};
+
+  world_state_t *ws = world_state_create(&test_arena);
+  TEST_ASSERT_NOT_NULL(ws);
+
+  initcode_cache_t cache;
+  TEST_ASSERT_TRUE(initcode_cache_init(&cache, &test_arena));
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  evm_set_state(&evm, world_state_access(ws));
+  evm_set_initcode_cache(&evm, &cache);
+
+  execution_env_t env = make_test_env(code, sizeof(code), 1000000);
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_EQUAL(EVM_OK, result.error);
+  TEST_ASSERT_EQUAL_UINT16(2, evm_stack_size(evm.current_frame->stack));
+  TEST_ASSERT_TRUE(uint256_is_zero(evm_stack_peek_unsafe(evm.current_frame->stack, 0)));
+  TEST_ASSERT_FALSE(uint256_is_zero(evm_stack_peek_unsafe(evm.current_frame->stack, 1)));
+
+  // Both CREATE2 calls share one cache entry
+  TEST_ASSERT_EQUAL(1, cache.count);
+  TEST_ASSERT_EQUAL(cache.capacity * sizeof(initcode_cache_entry_t) + TEST_INITCODE_SIZE +
+                        ((TEST_INITCODE_SIZE + 7) / 8),
+                    cache.size);
+
+  world_state_destroy(ws);
+}
+
+// =============================================================================
+// TLOAD/TSTORE tests
+// =============================================================================
+
+void test_evm_tstore_tload(void) {
+  // PUSH1 0x42, PUSH1 1, TSTORE, PUSH1 1, TLOAD, STOP
+  uint8_t code[] = {OP_PUSH1, 0x42, OP_PUSH1, 1, OP_TSTORE, OP_PUSH1, 1, OP_TLOAD, OP_STOP};
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_CANCUN);
+
+  execution_env_t env = make_test_env(code, sizeof(code), 100000);
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  // PUSH1(3) * 3 + TSTORE(100) + TLOAD(100)
+  TEST_ASSERT_EQUAL_UINT64(209, result.gas_used);
+  TEST_ASSERT_EQUAL_UINT64(0x42, evm_stack_peek_unsafe(evm.current_frame->stack, 0).limbs[0]);
+
+  // Transient storage does not outlive the transaction
+  evm_reset(&evm);
+  uint8_t load[] = {OP_PUSH1, 1, OP_TLOAD, OP_STOP};
+  env = make_test_env(load, sizeof(load), 100000);
+  result = evm_execute_env(&evm, &env);
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_TRUE(uint256_is_zero(evm_stack_peek_unsafe(evm.current_frame->stack, 0)));
+}
+
+void test_evm_tstore_invalid_before_cancun(void) {
+  uint8_t code[] = {OP_PUSH1, 0x42, OP_PUSH1, 1, OP_TSTORE, OP_STOP};
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+
+  execution_env_t env = make_test_env(code, sizeof(code), 100000);
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_ERROR, result.result);
+  TEST_ASSERT_EQUAL(EVM_INVALID_OPCODE, result.error);
+}
+
+void test_evm_tstore_reverted_by_subcall(void) {
+  // Without calldata: TSTORE(0, 1), call self with one byte of calldata, TLOAD(0).
+  // With calldata: TSTORE(0, 2), REVERT. The parent must still read 1.
+  uint8_t code[] = {OP_CALLDATASIZE, OP_PUSH1, 26, OP_JUMPI,
+                    // Parent
+                    OP_PUSH1, 1, OP_PUSH1, 0, OP_TSTORE, OP_PUSH1, 0, OP_PUSH1, 0, OP_PUSH1, 1,
+                    OP_PUSH1, 0, OP_PUSH1, 0, OP_ADDRESS, OP_GAS, OP_CALL, OP_PUSH1, 0, OP_TLOAD,
+                    OP_STOP,
+                    // Child (offset 26)
+                    OP_JUMPDEST, OP_PUSH1, 2, OP_PUSH1, 0, OP_TSTORE, OP_PUSH1, 0, OP_PUSH1, 0,
+                    OP_REVERT};
+  const address_t contract = {.bytes = {[19] = 0xC0}};
+
+  world_state_t *ws = world_state_create(&test_arena);
+  TEST_ASSERT_NOT_NULL(ws);
+  state_set_code(world_state_access(ws), &contract, code, sizeof(code));
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_CANCUN);
+  evm_set_state(&evm, world_state_access(ws));
+
+  execution_env_t env = make_test_env(code, sizeof(code), 1000000);
+  env.call.address = contract;
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_EQUAL_UINT16(2, evm_stack_size(evm.current_frame->stack));
+  // CALL failed, and the child's write was undone
+  TEST_ASSERT_TRUE(uint256_is_zero(evm_stack_peek_unsafe(evm.current_frame->stack, 1)));
+  TEST_ASSERT_EQUAL_UINT64(1, evm_stack_peek_unsafe(evm.current_frame->stack, 0).limbs[0]);
+
+  world_state_destroy(ws);
+}
+
+// =============================================================================
+// MCOPY tests
+// =============================================================================
+
+void test_evm_mcopy(void) {
+  // mem[0..1] = AB CD, then MCOPY(1, 0, 2) overlapping and MCOPY(64, 0, 3) into new memory
+  uint8_t code[] = {OP_PUSH1, 0xAB, OP_PUSH1, 0,  OP_MSTORE8, // mem[0] = AB
+                    OP_PUSH1, 0xCD, OP_PUSH1, 1,  OP_MSTORE8, // mem[1] = CD
+                    OP_PUSH1, 2,    OP_PUSH1, 0,  OP_PUSH1,   1, OP_MCOPY, // MCOPY(1, 0, 2)
+                    OP_PUSH1, 3,    OP_PUSH1, 0,  OP_PUSH1,   64, OP_MCOPY, // MCOPY(64, 0, 3)
+                    OP_STOP};
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_CANCUN);
+
+  execution_env_t env = make_test_env(code, sizeof(code), 100000);
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  // PUSH1*10 (30) + MSTORE8*2 (6, +3 expansion) + MCOPY (3+3) + MCOPY (3+3, +6 expansion)
+  TEST_ASSERT_EQUAL_UINT64(57, result.gas_used);
+
+  const evm_memory_t *mem = evm.current_frame->memory;
+  TEST_ASSERT_EQUAL(96, evm_memory_size(mem));
+  const uint8_t expected_low[] = {0xAB, 0xAB, 0xCD, 0x00};
+  TEST_ASSERT_EQUAL_MEMORY(expected_low, evm_memory_ptr_unsafe(mem, 0), sizeof(expected_low));
+  const uint8_t expected_high[] = {0xAB, 0xAB, 0xCD};
+  TEST_ASSERT_EQUAL_MEMORY(expected_high, evm_memory_ptr_unsafe(mem, 64), sizeof(expected_high));
+  for (size_t i = 32; i < 96; i++) {
+    if (i < 64 || i >= 67) {
+      TEST_ASSERT_EQUAL_UINT8(0, evm_memory_ptr_unsafe(mem, 0)[i]);
+    }
+  }
+}
+
+void test_evm_mcopy_invalid_before_cancun(void) {
+  uint8_t code[] = {OP_PUSH1, 0, OP_PUSH1, 0, OP_PUSH1, 0, OP_MCOPY, OP_STOP};
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+
+  execution_env_t env = make_test_env(code, sizeof(code), 100000);
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_ERROR, result.result);
+  TEST_ASSERT_EQUAL(EVM_INVALID_OPCODE, result.error);
+}
+
+void test_evm_mstore_unaffordable_offset(void) {
+  // MSTORE at 2^34 would need 16 GB of memory; it must fail on gas, not allocate first
+  uint8_t code[] = {OP_PUSH1, 1, OP_PUSH5, 0x04, 0x00, 0x00, 0x00, 0x00, OP_MSTORE, OP_STOP};
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+
+  execution_env_t env = make_test_env(code, sizeof(code), 1000000);
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_ERROR, result.result);
+  TEST_ASSERT_EQUAL(EVM_OUT_OF_GAS, result.error);
+  TEST_ASSERT_EQUAL(0, evm_memory_size(evm.current_frame->memory));
+}
+
+void test_evm_mapped_memory_reused_zeroed(void) {
+  // Write at 0 and 128 KB (recycled with madvise), then at 0 only (recycled with memset)
+  uint8_t write_large[] = {OP_PUSH1, 0x2A, OP_PUSH1, 0,    OP_MSTORE, OP_PUSH1,
+                           0x2A,     OP_PUSH3, 0x02, 0x00, 0x00,      OP_MSTORE, OP_STOP};
+  uint8_t write_small[] = {OP_PUSH1, 0x2A, OP_PUSH1, 0, OP_MSTORE, OP_STOP};
+  uint8_t read_large[] = {OP_PUSH3, 0x02, 0x00, 0x00, OP_MLOAD, OP_POP, OP_STOP};
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  // Without mapped memory in this build, the same checks cover the arena path
+  const bool mapped = evm_enable_mapped_memory(&evm);
+
+  execution_env_t env = make_test_env(write_large, sizeof(write_large), 1000000);
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  const uint8_t *const first = evm_memory_ptr_unsafe(evm.current_frame->memory, 0);
+  TEST_ASSERT_EQUAL(0x2A, first[0x20000 + 31]);
+
+  for (size_t round = 0; round < 2; round++) {
+    evm_reset(&evm);
+    env = make_test_env(read_large, sizeof(read_large), 1000000);
+    result = evm_execute_env(&evm, &env);
+    TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+
+    const evm_memory_t *mem = evm.current_frame->memory;
+    TEST_ASSERT_EQUAL(0x20020, evm_memory_size(mem));
+    if (mapped) {
+      TEST_ASSERT_EQUAL_PTR(first, evm_memory_ptr_unsafe(mem, 0));
+    }
+    for (size_t i = 0; i < evm_memory_size(mem); i++) {
+      TEST_ASSERT_EQUAL_UINT8(0, evm_memory_ptr_unsafe(mem, 0)[i]);
+    }
+
+    evm_reset(&evm);
+    env = make_test_env(write_small, sizeof(write_small), 1000000);
+    result = evm_execute_env(&evm, &env);
+    TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  }
+
+  evm_destroy(&evm);
+}
+
 // =============================================================================
 // Multi-fork tests
 // =============================================================================
@@ -629,6 +1058,21 @@ void test_evm_init_prague(void) {
   TEST_ASSERT_EQUAL(3, evm.gas_table[OP_PUSH1]);
 }
 
+void test_evm_fork_gas_tables(void) {
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  // Blob opcodes do not exist before Cancun
+  TEST_ASSERT_EQUAL(0, evm.gas_table[OP_BLOBHASH]);
+  TEST_ASSERT_EQUAL(2, evm.gas_table[OP_NUMBER]);
+
+  evm_init(&evm, &test_arena, FORK_CANCUN);
+  TEST_ASSERT_EQUAL(3, evm.gas_table[OP_BLOBHASH]);
+  TEST_ASSERT_EQUAL(2, evm.gas_table[OP_BLOBBASEFEE]);
+
+  evm_init(&evm, &test_arena, FORK_UNKNOWN);
+  TEST_ASSERT_EQUAL(3, evm.gas_table[OP_BLOBHASH]);
+}
+
 void test_evm_gas_refund_initialized(void) {
   evm_t evm;
   evm_init(&evm, &test_arena, FORK_SHANGHAI);
@@ -1167,3 +1611,40 @@ void test_evm_blobhash_no_blobs(void) {
   TEST_ASSERT_EQUAL_UINT16(1, evm_stack_size(evm.current_frame->stack));
   TEST_ASSERT_TRUE(uint256_is_zero(evm_stack_peek_unsafe(evm.current_frame->stack, 0)));
 }
+
+void test_evm_blob_opcodes_invalid_before_cancun(void) {
+  const uint8_t opcodes[] = {OP_BLOBHASH, OP_BLOBBASEFEE};
+  for (size_t i = 0; i < sizeof(opcodes); i++) {
+    // PUSH1 0, <opcode>, STOP
+    uint8_t code[] = {OP_PUSH1, 0, opcodes[i], OP_STOP};
+
+    evm_t evm;
+    evm_init(&evm, &test_arena, FORK_SHANGHAI);
+
+    block_context_t block;
+    block_context_init(&block);
+
+    execution_env_t env = make_test_env_with_block(code, sizeof(code), 100000, &block);
+    evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+    TEST_ASSERT_EQUAL(EVM_RESULT_ERROR, result.result);
+    TEST_ASSERT_EQUAL(EVM_INVALID_OPCODE, result.error);
+  }
+}
+
+void test_evm_block_opcode_gas(void) {
+  // NUMBER, STOP
+  uint8_t code[] = {OP_NUMBER, OP_STOP};
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+
+  block_context_t block;
+  block_context_init(&block);
+
+  execution_env_t env = make_test_env_with_block(code, sizeof(code), 100000, &block);
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_EQUAL(2, result.gas_used);
+}
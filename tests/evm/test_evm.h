@@ -25,15 +25,35 @@ void test_evm_call_without_state(void);
 // SLOAD/SSTORE tests
 void test_evm_sload_empty_slot(void);
 void test_evm_sstore_and_sload(void);
+void test_evm_state_unavailable_aborts(void);
 void test_evm_sstore_multiple_slots(void);
 void test_evm_sload_gas_cold(void);
 void test_evm_sload_gas_warm(void);
 void test_evm_sstore_without_state(void);
 
+// CREATE/CREATE2 tests
+void test_evm_create_deploys_code(void);
+void test_evm_create_failure_reverts_state(void);
+void test_evm_call_unimplemented_precompile(void);
+void test_evm_create_clears_return_data(void);
+void test_evm_create2_collision(void);
+
+// TLOAD/TSTORE tests
+void test_evm_tstore_tload(void);
+void test_evm_tstore_invalid_before_cancun(void);
+void test_evm_tstore_reverted_by_subcall(void);
+
+// MCOPY tests
+void test_evm_mcopy(void);
+void test_evm_mcopy_invalid_before_cancun(void);
+void test_evm_mstore_unaffordable_offset(void);
+void test_evm_mapped_memory_reused_zeroed(void);
+
 // Multi-fork tests
 void test_evm_init_shanghai(void);
 void test_evm_init_cancun(void);
 void test_evm_init_prague(void);
+void test_evm_fork_gas_tables(void);
 void test_evm_gas_refund_initialized(void);
 void test_evm_gas_refund_reset(void);
 
@@ -62,5 +82,7 @@ void test_evm_blockhash_no_callback(void);
 void test_evm_blobhash_valid(void);
 void test_evm_blobhash_out_of_bounds(void);
 void test_evm_blobhash_no_blobs(void);
+void test_evm_blob_opcodes_invalid_before_cancun(void);
+void test_evm_block_opcode_gas(void);
 
 #endif // TEST_EVM_H
@@ -0,0 +1,67 @@
+#include "div0/evm/evm.h"
+#include "div0/evm/json_tracer.h"
+#include "div0/evm/opcodes.h"
+#include "div0/mem/arena.h"
+
+#include "unity.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// External test arena from test_div0.c
+extern div0_arena_t test_arena;
+
+/// Runs code with a JSON tracer and reads the trace back into buf.
+static void run_traced(const uint8_t *code, size_t code_size, char *buf, size_t buf_size) {
+  FILE *out = tmpfile();
+  TEST_ASSERT_NOT_NULL(out);
+
+  evm_json_tracer_t tracer;
+  TEST_ASSERT_TRUE(evm_json_tracer_init(&tracer, out, &test_arena));
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  evm_set_tracer(&evm, &tracer.base);
+
+  execution_env_t env;
+  memset(&env, 0, sizeof(env));
+  env.call.code = code;
+  env.call.code_size = code_size;
+  env.call.gas = 100000;
+  (void)evm_execute_env(&evm, &env);
+
+  rewind(out);
+  const size_t len = fread(buf, 1, buf_size - 1, out);
+  buf[len] = '\0';
+  fclose(out);
+}
+
+void test_json_tracer_step_lines(void) {
+  // PUSH1 1, PUSH1 2, MUL, STOP
+  const uint8_t code[] = {OP_PUSH1, 1, OP_PUSH1, 2, OP_MUL, OP_STOP};
+  char buf[2048];
+  run_traced(code, sizeof(code), buf, sizeof(buf));
+
+  const char *const expected =
+      "{\"pc\":0,\"op\":96,\"gas\":\"0x186a0\",\"gasCost\":\"0x3\",\"memSize\":0,"
+      "\"stack\":[],\"depth\":1,\"refund\":0,\"opName\":\"PUSH1\"}\n"
+      "{\"pc\":2,\"op\":96,\"gas\":\"0x1869d\",\"gasCost\":\"0x3\",\"memSize\":0,"
+      "\"stack\":[\"0x1\"],\"depth\":1,\"refund\":0,\"opName\":\"PUSH1\"}\n"
+      "{\"pc\":4,\"op\":2,\"gas\":\"0x1869a\",\"gasCost\":\"0x5\",\"memSize\":0,"
+      "\"stack\":[\"0x1\",\"0x2\"],\"depth\":1,\"refund\":0,\"opName\":\"MUL\"}\n"
+      "{\"pc\":5,\"op\":0,\"gas\":\"0x18695\",\"gasCost\":\"0x0\",\"memSize\":0,"
+      "\"stack\":[\"0x2\"],\"depth\":1,\"refund\":0,\"opName\":\"STOP\"}\n"
+      "{\"output\":\"0x\",\"gasUsed\":\"0xb\"}\n";
+  TEST_ASSERT_EQUAL_STRING(expected, buf);
+}
+
+void test_json_tracer_error_summary(void) {
+  // ADD on an empty stack
+  const uint8_t code[] = {OP_ADD};
+  char buf[1024];
+  run_traced(code, sizeof(code), buf, sizeof(buf));
+
+  TEST_ASSERT_NOT_NULL(strstr(buf, "\"opName\":\"ADD\""));
+  TEST_ASSERT_NOT_NULL(
+      strstr(buf, "{\"output\":\"0x\",\"gasUsed\":\"0x186a0\",\"error\":\"stack underflow\"}\n"));
+}
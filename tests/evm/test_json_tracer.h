@@ -0,0 +1,7 @@
+#ifndef TEST_JSON_TRACER_H
+#define TEST_JSON_TRACER_H
+
+void test_json_tracer_step_lines(void);
+void test_json_tracer_error_summary(void);
+
+#endif // TEST_JSON_TRACER_H
@@ -595,6 +595,35 @@ void test_opcode_calldatacopy_out_of_bounds(void) {
   TEST_ASSERT_EQUAL(EVM_OK, result.error);
 }
 
+void test_opcode_calldatacopy_large_unaligned(void) {
+  // Copy 300000 bytes to offset 1 from 100 bytes of calldata: large enough for
+  // the streaming path, with an unaligned head and a long zero-padded tail
+  uint8_t code[] = {OP_PUSH3, 0x04, 0x93, 0xE0, OP_PUSH1, 0, OP_PUSH1, 1, OP_CALLDATACOPY, OP_STOP};
+  uint8_t input[100];
+  for (size_t i = 0; i < sizeof(input); i++) {
+    input[i] = (uint8_t)(i + 1);
+  }
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+
+  execution_env_t env = make_test_env(code, sizeof(code), 1000000);
+  env.call.input = input;
+  env.call.input_size = sizeof(input);
+
+  evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  const evm_memory_t *mem = evm.current_frame->memory;
+  const uint8_t *data = evm_memory_ptr_unsafe(mem, 0);
+  TEST_ASSERT_EQUAL(300032, evm_memory_size(mem));
+  TEST_ASSERT_EQUAL_UINT8(0, data[0]);
+  TEST_ASSERT_EQUAL_MEMORY(input, data + 1, sizeof(input));
+  for (size_t i = 1 + sizeof(input); i < evm_memory_size(mem); i++) {
+    TEST_ASSERT_EQUAL_UINT8(0, data[i]);
+  }
+}
+
 void test_opcode_calldatacopy_stack_underflow(void) {
   // Only 2 args on stack instead of 3
   uint8_t code[] = {OP_PUSH1, 0, OP_PUSH1, 0, OP_CALLDATACOPY};
@@ -48,6 +48,7 @@ void test_opcode_calldatacopy_basic(void);
 void test_opcode_calldatacopy_zero_size(void);
 void test_opcode_calldatacopy_zero_pad(void);
 void test_opcode_calldatacopy_out_of_bounds(void);
+void test_opcode_calldatacopy_large_unaligned(void);
 void test_opcode_calldatacopy_stack_underflow(void);
 
 // CODECOPY opcode tests
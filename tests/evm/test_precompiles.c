@@ -0,0 +1,176 @@
+// Unit tests for the native precompiled contracts
+// Expected values computed with hashlib and the EIP-152 test vectors
+
+#include "evm/test_precompiles.h"
+
+#include "div0/evm/precompiles.h"
+#include "div0/mem/arena.h"
+#include "div0/util/hex.h"
+
+#include "unity.h"
+
+// External test arena from test_div0.c
+extern div0_arena_t test_arena;
+
+static address_t precompile_address(const uint8_t index) {
+  address_t addr = address_zero();
+  addr.bytes[ADDRESS_SIZE - 1] = index;
+  return addr;
+}
+
+/// Run the precompile at an address with the given input and gas.
+static bool run(const uint8_t index, const uint8_t *const input, const size_t input_size,
+                const uint64_t gas, precompile_output_t *const out) {
+  const address_t addr = precompile_address(index);
+  const precompile_fn_t fn = precompile_get(FORK_PRAGUE, &addr);
+  TEST_ASSERT_NOT_NULL(fn);
+  const precompile_input_t in = {
+      .input = input,
+      .input_size = input_size,
+      .gas = gas,
+      .arena = &test_arena,
+      .secp_ctx = nullptr,
+  };
+  return fn(&in, out);
+}
+
+// =============================================================================
+// Registry
+// =============================================================================
+
+void test_precompile_get_by_fork(void) {
+  const address_t zero = address_zero();
+  const address_t blake2f = precompile_address(0x09);
+  const address_t point_eval = precompile_address(0x0a);
+
+  TEST_ASSERT_NULL(precompile_get(FORK_SHANGHAI, &zero));
+  TEST_ASSERT_NOT_NULL(precompile_get(FORK_SHANGHAI, &blake2f));
+  // Not a precompile before Cancun; active from Cancun but not implemented
+  // natively, so calls fail instead of running empty code
+  TEST_ASSERT_NULL(precompile_get(FORK_SHANGHAI, &point_eval));
+  const precompile_fn_t unavailable = precompile_get(FORK_CANCUN, &point_eval);
+  TEST_ASSERT_NOT_NULL(unavailable);
+  const precompile_input_t in = {.gas = 100000, .arena = &test_arena};
+  precompile_output_t out = {0};
+  TEST_ASSERT_FALSE(unavailable(&in, &out));
+  const address_t bls_last = precompile_address(0x11);
+  TEST_ASSERT_NOT_NULL(precompile_get(FORK_PRAGUE, &bls_last));
+  TEST_ASSERT_NULL(precompile_get(FORK_CANCUN, &bls_last));
+
+  TEST_ASSERT_EQUAL_UINT8(0x09, precompile_count(FORK_SHANGHAI));
+  TEST_ASSERT_EQUAL_UINT8(0x0a, precompile_count(FORK_CANCUN));
+  TEST_ASSERT_EQUAL_UINT8(0x11, precompile_count(FORK_PRAGUE));
+
+  // Any non-zero byte above the last one disqualifies the address
+  address_t high = blake2f;
+  high.bytes[0] = 0x01;
+  TEST_ASSERT_NULL(precompile_get(FORK_PRAGUE, &high));
+}
+
+// =============================================================================
+// Hashes and Identity
+// =============================================================================
+
+void test_precompile_sha256(void) {
+  const uint8_t input[] = {'a', 'b', 'c'};
+  uint8_t expected[32];
+  TEST_ASSERT_TRUE(hex_decode("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+                              expected, sizeof(expected)));
+
+  precompile_output_t out;
+  TEST_ASSERT_TRUE(run(0x02, input, sizeof(input), 100, &out));
+  TEST_ASSERT_EQUAL_UINT64(60 + 12, out.gas_used);
+  TEST_ASSERT_EQUAL_size_t(32, out.output_size);
+  TEST_ASSERT_EQUAL_MEMORY(expected, out.output, 32);
+}
+
+void test_precompile_ripemd160(void) {
+  const uint8_t input[] = {'a', 'b', 'c'};
+  uint8_t expected[32] = {0};
+  TEST_ASSERT_TRUE(
+      hex_decode("8eb208f7e05d987a9b044a8e98c6b087f15a0bfc", expected + 12, sizeof(expected) - 12));
+
+  precompile_output_t out;
+  TEST_ASSERT_TRUE(run(0x03, input, sizeof(input), 1000, &out));
+  TEST_ASSERT_EQUAL_UINT64(600 + 120, out.gas_used);
+  TEST_ASSERT_EQUAL_size_t(32, out.output_size);
+  TEST_ASSERT_EQUAL_MEMORY(expected, out.output, 32);
+}
+
+void test_precompile_identity(void) {
+  const uint8_t input[40] = {1, 2, 3, [39] = 0xff};
+
+  precompile_output_t out;
+  TEST_ASSERT_TRUE(run(0x04, input, sizeof(input), 100, &out));
+  TEST_ASSERT_EQUAL_UINT64(15 + (2 * 3), out.gas_used);
+  TEST_ASSERT_EQUAL_size_t(sizeof(input), out.output_size);
+  TEST_ASSERT_EQUAL_MEMORY(input, out.output, sizeof(input));
+}
+
+void test_precompile_out_of_gas(void) {
+  const uint8_t input[] = {'a', 'b', 'c'};
+  precompile_output_t out;
+  TEST_ASSERT_FALSE(run(0x02, input, sizeof(input), 71, &out));
+}
+
+// =============================================================================
+// Arithmetic
+// =============================================================================
+
+void test_precompile_modexp(void) {
+  // 3 ^ (p - 1) mod p == 1 for p = 2^255 - 19 (Fermat)
+  uint8_t input[(3 * 32) + 1 + 32 + 32] = {0};
+  input[31] = 1;  // base length
+  input[63] = 32; // exponent length
+  input[95] = 32; // modulus length
+  input[96] = 3;
+  static const char *const exp_hex =
+      "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffec";
+  static const char *const mod_hex =
+      "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed";
+  TEST_ASSERT_TRUE(hex_decode(exp_hex, input + 97, 32));
+  TEST_ASSERT_TRUE(hex_decode(mod_hex, input + 129, 32));
+
+  uint8_t expected[32] = {0};
+  expected[31] = 1;
+
+  precompile_output_t out;
+  TEST_ASSERT_TRUE(run(0x05, input, sizeof(input), 100000, &out));
+  TEST_ASSERT_EQUAL_size_t(32, out.output_size);
+  TEST_ASSERT_EQUAL_MEMORY(expected, out.output, 32);
+  // EIP-2565: max(200, words^2 * iterations / 3) with words = 4, iterations = 254
+  TEST_ASSERT_EQUAL_UINT64(16 * 254 / 3, out.gas_used);
+}
+
+// EIP-152 test vector 5: BLAKE2b-512("abc") with 12 rounds
+static const char *const BLAKE2F_INPUT_HEX =
+    "0000000c48c9bdf267e6096a3ba7ca8485ae67bb2bf894fe72f36e3cf1361d5f3af54fa5d182e6ad7f520e51"
+    "1f6c3e2b8c68059b6bbd41fbabd9831f79217e1319cde05b6162630000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+    "00000000000000000000000000000000000000000300000000000000000000000000000001";
+
+void test_precompile_blake2f(void) {
+  uint8_t input[213];
+  uint8_t expected[64];
+  TEST_ASSERT_TRUE(hex_decode(BLAKE2F_INPUT_HEX, input, sizeof(input)));
+  TEST_ASSERT_TRUE(hex_decode("ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d1"
+                              "7d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923",
+                              expected, sizeof(expected)));
+
+  precompile_output_t out;
+  TEST_ASSERT_TRUE(run(0x09, input, sizeof(input), 100, &out));
+  TEST_ASSERT_EQUAL_UINT64(12, out.gas_used);
+  TEST_ASSERT_EQUAL_size_t(64, out.output_size);
+  TEST_ASSERT_EQUAL_MEMORY(expected, out.output, 64);
+}
+
+void test_precompile_blake2f_rejects_bad_length(void) {
+  uint8_t input[213];
+  TEST_ASSERT_TRUE(hex_decode(BLAKE2F_INPUT_HEX, input, sizeof(input)));
+
+  precompile_output_t out;
+  TEST_ASSERT_FALSE(run(0x09, input, sizeof(input) - 1, 100, &out));
+  input[212] = 2; // final flag must be 0 or 1
+  TEST_ASSERT_FALSE(run(0x09, input, sizeof(input), 100, &out));
+}
@@ -0,0 +1,18 @@
+#ifndef TEST_PRECOMPILES_H
+#define TEST_PRECOMPILES_H
+
+// Registry
+void test_precompile_get_by_fork(void);
+
+// Hashes and identity
+void test_precompile_sha256(void);
+void test_precompile_ripemd160(void);
+void test_precompile_identity(void);
+void test_precompile_out_of_gas(void);
+
+// Arithmetic
+void test_precompile_modexp(void);
+void test_precompile_blake2f(void);
+void test_precompile_blake2f_rejects_bad_length(void);
+
+#endif // TEST_PRECOMPILES_H
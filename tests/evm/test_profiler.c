@@ -0,0 +1,95 @@
+#include "div0/evm/evm.h"
+#include "div0/evm/opcodes.h"
+#include "div0/evm/profiler.h"
+#include "div0/mem/arena.h"
+
+#include "unity.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// External test arena from test_div0.c
+extern div0_arena_t test_arena;
+
+// PUSH1 1, PUSH1 2, MUL, POP, STOP
+static const uint8_t MUL_CODE[] = {OP_PUSH1, 1, OP_PUSH1, 2, OP_MUL, OP_POP, OP_STOP};
+
+/// Runs MUL_CODE once at address 0x..01 with the profiler attached.
+static evm_execution_result_t run_profiled(evm_profiler_t *profiler) {
+  TEST_ASSERT_TRUE(evm_profiler_init(profiler, &test_arena));
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  evm_set_tracer(&evm, &profiler->base);
+
+  execution_env_t env;
+  memset(&env, 0, sizeof(env));
+  env.call.code = MUL_CODE;
+  env.call.code_size = sizeof(MUL_CODE);
+  env.call.gas = 100000;
+  env.call.address.bytes[19] = 0x01;
+  return evm_execute_env(&evm, &env);
+}
+
+/// Reads a stream written by the profiler back into buf.
+static void read_back(FILE *out, char *buf, size_t buf_size) {
+  rewind(out);
+  const size_t len = fread(buf, 1, buf_size - 1, out);
+  buf[len] = '\0';
+  fclose(out);
+}
+
+void test_profiler_attribution(void) {
+  evm_profiler_t profiler;
+  const evm_execution_result_t result = run_profiled(&profiler);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_EQUAL_UINT64(result.gas_used, profiler.total_gas);
+  TEST_ASSERT_FALSE(profiler.truncated);
+
+  // One call tree node and one code entry
+  TEST_ASSERT_NOT_NULL(profiler.nodes);
+  TEST_ASSERT_NULL(profiler.nodes->next);
+  TEST_ASSERT_EQUAL_PTR(profiler.root, profiler.nodes->parent);
+  TEST_ASSERT_EQUAL_UINT8(0x01, profiler.nodes->address.bytes[19]);
+  TEST_ASSERT_EQUAL_UINT64(5, profiler.nodes->gas[OP_MUL]);
+
+  TEST_ASSERT_NOT_NULL(profiler.codes);
+  TEST_ASSERT_NULL(profiler.codes->next);
+  TEST_ASSERT_EQUAL_UINT64(2, profiler.codes->counts[OP_PUSH1]);
+  TEST_ASSERT_EQUAL_UINT64(6, profiler.codes->gas[OP_PUSH1]);
+  TEST_ASSERT_EQUAL_UINT64(1, profiler.codes->counts[OP_STOP]);
+}
+
+void test_profiler_collapsed_gas(void) {
+  evm_profiler_t profiler;
+  (void)run_profiled(&profiler);
+
+  FILE *out = tmpfile();
+  TEST_ASSERT_NOT_NULL(out);
+  TEST_ASSERT_TRUE(evm_profiler_write_collapsed(&profiler, out, EVM_PROFILE_GAS));
+  char buf[1024];
+  read_back(out, buf, sizeof(buf));
+
+  // Opcodes in byte order; STOP costs no gas and is left out
+  const char *const expected = "0x0000000000000000000000000000000000000001;MUL 5\n"
+                               "0x0000000000000000000000000000000000000001;POP 2\n"
+                               "0x0000000000000000000000000000000000000001;PUSH1 6\n";
+  TEST_ASSERT_EQUAL_STRING(expected, buf);
+}
+
+void test_profiler_opcodes_csv(void) {
+  evm_profiler_t profiler;
+  (void)run_profiled(&profiler);
+
+  FILE *out = tmpfile();
+  TEST_ASSERT_NOT_NULL(out);
+  TEST_ASSERT_TRUE(evm_profiler_write_opcodes(&profiler, out));
+  char buf[2048];
+  read_back(out, buf, sizeof(buf));
+
+  // Header first
+  TEST_ASSERT_EQUAL_PTR(buf, strstr(buf, "code_hash,opcode,name,count,gas,ns\n"));
+  TEST_ASSERT_NOT_NULL(strstr(buf, ",0x02,MUL,1,5,"));
+  TEST_ASSERT_NOT_NULL(strstr(buf, ",0x60,PUSH1,2,6,"));
+}
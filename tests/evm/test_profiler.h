@@ -0,0 +1,8 @@
+#ifndef TEST_PROFILER_H
+#define TEST_PROFILER_H
+
+void test_profiler_attribution(void);
+void test_profiler_collapsed_gas(void);
+void test_profiler_opcodes_csv(void);
+
+#endif // TEST_PROFILER_H
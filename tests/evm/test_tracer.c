@@ -0,0 +1,133 @@
+#include "div0/evm/evm.h"
+#include "div0/evm/opcodes.h"
+#include "div0/evm/stack.h"
+#include "div0/evm/tracer.h"
+#include "div0/mem/arena.h"
+#include "div0/state/world_state.h"
+
+#include "unity.h"
+
+#include <string.h>
+
+// External test arena from test_div0.c
+extern div0_arena_t test_arena;
+
+/// Helper to create a minimal execution environment for testing.
+static execution_env_t make_test_env(const uint8_t *code, size_t code_size, uint64_t gas) {
+  execution_env_t env;
+  memset(&env, 0, sizeof(env));
+  env.call.code = code;
+  env.call.code_size = code_size;
+  env.call.gas = gas;
+  return env;
+}
+
+// PUSH1 1, PUSH1 2, MUL, POP, STOP
+static const uint8_t MUL_CODE[] = {OP_PUSH1, 1, OP_PUSH1, 2, OP_MUL, OP_POP, OP_STOP};
+
+void test_tracer_histogram_counts(void) {
+  evm_opcode_histogram_t hist;
+  evm_opcode_histogram_init(&hist);
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  evm_set_tracer(&evm, &hist.base);
+
+  execution_env_t env = make_test_env(MUL_CODE, sizeof(MUL_CODE), 100000);
+  const evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_EQUAL_UINT64(5, hist.steps);
+  TEST_ASSERT_EQUAL_UINT64(2, hist.counts[OP_PUSH1]);
+  TEST_ASSERT_EQUAL_UINT64(1, hist.counts[OP_MUL]);
+  TEST_ASSERT_EQUAL_UINT64(1, hist.counts[OP_POP]);
+  TEST_ASSERT_EQUAL_UINT64(1, hist.counts[OP_STOP]);
+  TEST_ASSERT_EQUAL_UINT64(0, hist.storage_reads);
+}
+
+void test_tracer_gas_profiler_attribution(void) {
+  evm_gas_profiler_t profiler;
+  TEST_ASSERT_TRUE(evm_gas_profiler_init(&profiler, &test_arena));
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  evm_set_tracer(&evm, &profiler.base);
+
+  execution_env_t env = make_test_env(MUL_CODE, sizeof(MUL_CODE), 100000);
+  const evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_EQUAL_UINT64(6, profiler.gas[OP_PUSH1]);
+  TEST_ASSERT_EQUAL_UINT64(5, profiler.gas[OP_MUL]);
+  TEST_ASSERT_EQUAL_UINT64(2, profiler.gas[OP_POP]);
+  TEST_ASSERT_EQUAL_UINT64(0, profiler.gas[OP_STOP]);
+  TEST_ASSERT_EQUAL_UINT64(2, profiler.counts[OP_PUSH1]);
+  // Every unit of gas is charged to exactly one opcode
+  TEST_ASSERT_EQUAL_UINT64(result.gas_used, profiler.total_gas);
+}
+
+void test_tracer_does_not_change_result(void) {
+  // PUSH1 0x20, PUSH1 0, MSTORE, PUSH1 0x20, PUSH1 0, RETURN
+  const uint8_t code[] = {OP_PUSH1, 0x20, OP_PUSH1, 0,    OP_MSTORE,
+                          OP_PUSH1, 0x20, OP_PUSH1, 0x00, OP_RETURN};
+
+  evm_t plain;
+  evm_init(&plain, &test_arena, FORK_CANCUN);
+  execution_env_t env = make_test_env(code, sizeof(code), 100000);
+  const evm_execution_result_t expected = evm_execute_env(&plain, &env);
+
+  evm_opcode_histogram_t hist;
+  evm_opcode_histogram_init(&hist);
+  evm_t traced;
+  evm_init(&traced, &test_arena, FORK_CANCUN);
+  evm_set_tracer(&traced, &hist.base);
+  env = make_test_env(code, sizeof(code), 100000);
+  const evm_execution_result_t actual = evm_execute_env(&traced, &env);
+
+  TEST_ASSERT_EQUAL(expected.result, actual.result);
+  TEST_ASSERT_EQUAL_UINT64(expected.gas_used, actual.gas_used);
+  TEST_ASSERT_EQUAL(expected.output_size, actual.output_size);
+  TEST_ASSERT_EQUAL_MEMORY(expected.output, actual.output, actual.output_size);
+  TEST_ASSERT_EQUAL_UINT64(6, hist.steps);
+}
+
+void test_tracer_storage_access_hook(void) {
+  // PUSH1 0x42, PUSH1 0, SSTORE, PUSH1 0, SLOAD, STOP
+  const uint8_t code[] = {OP_PUSH1, 0x42, OP_PUSH1, 0, OP_SSTORE, OP_PUSH1, 0, OP_SLOAD, OP_STOP};
+
+  world_state_t *ws = world_state_create(&test_arena);
+  TEST_ASSERT_NOT_NULL(ws);
+
+  evm_opcode_histogram_t hist;
+  evm_opcode_histogram_init(&hist);
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  evm_set_state(&evm, world_state_access(ws));
+  evm_set_tracer(&evm, &hist.base);
+
+  execution_env_t env = make_test_env(code, sizeof(code), 100000);
+  const evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_EQUAL_UINT64(1, hist.storage_writes);
+  TEST_ASSERT_EQUAL_UINT64(1, hist.storage_reads);
+
+  world_state_destroy(ws);
+}
+
+void test_tracer_detached(void) {
+  evm_opcode_histogram_t hist;
+  evm_opcode_histogram_init(&hist);
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_PRAGUE);
+  evm_set_tracer(&evm, &hist.base);
+  evm_set_tracer(&evm, nullptr);
+
+  execution_env_t env = make_test_env(MUL_CODE, sizeof(MUL_CODE), 100000);
+  const evm_execution_result_t result = evm_execute_env(&evm, &env);
+
+  TEST_ASSERT_EQUAL(EVM_RESULT_STOP, result.result);
+  TEST_ASSERT_EQUAL_UINT64(0, hist.steps);
+}
@@ -0,0 +1,10 @@
+#ifndef TEST_TRACER_H
+#define TEST_TRACER_H
+
+void test_tracer_histogram_counts(void);
+void test_tracer_gas_profiler_attribution(void);
+void test_tracer_does_not_change_result(void);
+void test_tracer_storage_access_hook(void);
+void test_tracer_detached(void);
+
+#endif // TEST_TRACER_H
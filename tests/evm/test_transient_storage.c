@@ -0,0 +1,85 @@
+#include "div0/evm/transient_storage.h"
+#include "div0/mem/arena.h"
+#include "div0/types/uint256.h"
+
+#include "unity.h"
+
+// External test arena from test_div0.c
+extern div0_arena_t test_arena;
+
+static const address_t ADDR_A = {.bytes = {[19] = 0xAA}};
+static const address_t ADDR_B = {.bytes = {[19] = 0xBB}};
+
+void test_transient_storage_set_get(void) {
+  transient_storage_t ts;
+  transient_storage_init(&ts, &test_arena);
+
+  // Unset slots read as zero, before and after the table exists
+  TEST_ASSERT_TRUE(uint256_is_zero(transient_storage_get(&ts, &ADDR_A, uint256_from_u64(1))));
+  TEST_ASSERT_TRUE(transient_storage_set(&ts, &ADDR_A, uint256_from_u64(1), uint256_from_u64(7)));
+  TEST_ASSERT_TRUE(uint256_is_zero(transient_storage_get(&ts, &ADDR_A, uint256_from_u64(2))));
+
+  // Slots are keyed by address as well as slot
+  TEST_ASSERT_EQUAL_UINT64(7, transient_storage_get(&ts, &ADDR_A, uint256_from_u64(1)).limbs[0]);
+  TEST_ASSERT_TRUE(uint256_is_zero(transient_storage_get(&ts, &ADDR_B, uint256_from_u64(1))));
+
+  // Overwrite
+  TEST_ASSERT_TRUE(transient_storage_set(&ts, &ADDR_A, uint256_from_u64(1), uint256_from_u64(9)));
+  TEST_ASSERT_EQUAL_UINT64(9, transient_storage_get(&ts, &ADDR_A, uint256_from_u64(1)).limbs[0]);
+}
+
+void test_transient_storage_clear(void) {
+  transient_storage_t ts;
+  transient_storage_init(&ts, &test_arena);
+
+  TEST_ASSERT_TRUE(transient_storage_set(&ts, &ADDR_A, uint256_from_u64(1), uint256_from_u64(7)));
+  transient_storage_clear(&ts);
+  TEST_ASSERT_TRUE(uint256_is_zero(transient_storage_get(&ts, &ADDR_A, uint256_from_u64(1))));
+  TEST_ASSERT_EQUAL(0, ts.journal_size);
+
+  // The stale entry's slot is reused by the next transaction
+  TEST_ASSERT_TRUE(transient_storage_set(&ts, &ADDR_A, uint256_from_u64(1), uint256_from_u64(3)));
+  TEST_ASSERT_EQUAL_UINT64(3, transient_storage_get(&ts, &ADDR_A, uint256_from_u64(1)).limbs[0]);
+  TEST_ASSERT_EQUAL(1, ts.count);
+}
+
+void test_transient_storage_revert(void) {
+  transient_storage_t ts;
+  transient_storage_init(&ts, &test_arena);
+
+  TEST_ASSERT_TRUE(transient_storage_set(&ts, &ADDR_A, uint256_from_u64(1), uint256_from_u64(1)));
+  const size_t outer = transient_storage_checkpoint(&ts);
+  TEST_ASSERT_TRUE(transient_storage_set(&ts, &ADDR_A, uint256_from_u64(1), uint256_from_u64(2)));
+  const size_t inner = transient_storage_checkpoint(&ts);
+  TEST_ASSERT_TRUE(transient_storage_set(&ts, &ADDR_B, uint256_from_u64(5), uint256_from_u64(3)));
+
+  // Inner revert only undoes the write to B
+  transient_storage_revert(&ts, inner);
+  TEST_ASSERT_TRUE(uint256_is_zero(transient_storage_get(&ts, &ADDR_B, uint256_from_u64(5))));
+  TEST_ASSERT_EQUAL_UINT64(2, transient_storage_get(&ts, &ADDR_A, uint256_from_u64(1)).limbs[0]);
+
+  // Outer revert restores the value from before the checkpoint
+  transient_storage_revert(&ts, outer);
+  TEST_ASSERT_EQUAL_UINT64(1, transient_storage_get(&ts, &ADDR_A, uint256_from_u64(1)).limbs[0]);
+}
+
+void test_transient_storage_grow(void) {
+  transient_storage_t ts;
+  transient_storage_init(&ts, &test_arena);
+
+  // Enough slots to grow the table several times
+  for (uint64_t i = 0; i < 1000; i++) {
+    TEST_ASSERT_TRUE(
+        transient_storage_set(&ts, &ADDR_A, uint256_from_u64(i), uint256_from_u64(i + 1)));
+  }
+  TEST_ASSERT_EQUAL(1000, ts.count);
+  for (uint64_t i = 0; i < 1000; i++) {
+    const uint256_t value = transient_storage_get(&ts, &ADDR_A, uint256_from_u64(i));
+    TEST_ASSERT_EQUAL_UINT64(i + 1, value.limbs[0]);
+  }
+
+  // The journal still reverts writes made before the table grew
+  transient_storage_revert(&ts, 0);
+  TEST_ASSERT_TRUE(uint256_is_zero(transient_storage_get(&ts, &ADDR_A, uint256_from_u64(0))));
+  TEST_ASSERT_TRUE(uint256_is_zero(transient_storage_get(&ts, &ADDR_A, uint256_from_u64(999))));
+}
@@ -0,0 +1,9 @@
+#ifndef TEST_TRANSIENT_STORAGE_H
+#define TEST_TRANSIENT_STORAGE_H
+
+void test_transient_storage_set_get(void);
+void test_transient_storage_clear(void);
+void test_transient_storage_revert(void);
+void test_transient_storage_grow(void);
+
+#endif // TEST_TRANSIENT_STORAGE_H
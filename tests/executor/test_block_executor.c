@@ -5,6 +5,9 @@
 
 #include "unity.h"
 
+#include <stdalign.h>
+#include <stdlib.h>
+
 // External arena from main test file
 extern div0_arena_t test_arena;
 
@@ -22,6 +25,7 @@ static void make_legacy_tx(transaction_t *tx, uint64_t nonce, uint64_t gas_limit
                            const address_t *to) {
   tx->type = TX_TYPE_LEGACY;
   legacy_tx_init(&tx->legacy);
+  transaction_clear_cache(tx);
   tx->legacy.nonce = nonce;
   tx->legacy.gas_limit = gas_limit;
   tx->legacy.gas_price = uint256_from_u64(1000000000); // 1 gwei
@@ -82,6 +86,7 @@ void test_intrinsic_gas_with_access_list(void) {
   transaction_t tx;
   tx.type = TX_TYPE_EIP2930;
   eip2930_tx_init(&tx.eip2930);
+  transaction_clear_cache(&tx);
 
   address_t to = make_test_address(0x03);
   tx.eip2930.nonce = 0;
@@ -615,3 +620,162 @@ void test_block_executor_nonce_increment_on_failed_execution(void) {
 
   world_state_destroy(ws);
 }
+
+// Runs a block that calls `caller`, which jumps and then CALLs `callee`, which jumps too.
+// Each run uses a fresh world state, like separate t8n requests sharing one cache.
+// @return Storage slot 0 of `caller` (the CALL's success flag)
+static uint256_t run_jumping_call(jumpdest_cache_t *const cache) {
+  world_state_t *ws = world_state_create(&test_arena);
+  state_access_t *state = world_state_access(ws);
+  world_state_set_jumpdest_cache(ws, cache);
+
+  const address_t sender = make_test_address(0x80);
+  const address_t caller = make_test_address(0x81);
+  const address_t callee = make_test_address(0x82);
+  state_set_balance(state, &sender, uint256_from_u64(1000000000000000));
+
+  // PUSH1 4, JUMP, INVALID, JUMPDEST, STOP
+  static const uint8_t callee_code[] = {0x60, 0x04, 0x56, 0xFE, 0x5B, 0x00};
+  state_set_code(state, &callee, callee_code, sizeof(callee_code));
+
+  // PUSH1 4, JUMP, INVALID, JUMPDEST, CALL(GAS, callee, 0, 0, 0, 0, 0), PUSH1 0, SSTORE, STOP
+  uint8_t caller_code[42] = {0x60, 0x04, 0x56, 0xFE, 0x5B, 0x60, 0x00, 0x60, 0x00, 0x60,
+                             0x00, 0x60, 0x00, 0x60, 0x00, 0x73};
+  __builtin___memcpy_chk(caller_code + 16, callee.bytes, ADDRESS_SIZE, sizeof(caller_code) - 16);
+  static const uint8_t tail[] = {0x5A, 0xF1, 0x60, 0x00, 0x55, 0x00};
+  __builtin___memcpy_chk(caller_code + 36, tail, sizeof(tail), sizeof(caller_code) - 36);
+  state_set_code(state, &caller, caller_code, sizeof(caller_code));
+
+  block_context_t block = {0};
+  block.gas_limit = 30000000;
+  block.base_fee = uint256_from_u64(1000000000);
+  block.coinbase = make_test_address(0x83);
+
+  transaction_t tx;
+  make_legacy_tx(&tx, 0, 200000, uint256_zero(), &caller);
+  block_tx_t btx = {.tx = &tx, .sender = sender, .sender_recovered = true, .original_index = 0};
+
+  evm_t evm;
+  evm_init(&evm, &test_arena, FORK_SHANGHAI);
+  block_executor_t exec;
+  block_executor_init(&exec, state, &block, &evm, &test_arena, 1);
+
+  block_exec_result_t result;
+  TEST_ASSERT_TRUE(block_executor_run(&exec, &btx, 1, &result));
+  TEST_ASSERT_EQUAL_size_t(1, result.receipt_count);
+  TEST_ASSERT_TRUE(result.receipts[0].success);
+
+  const uint256_t called = state_get_storage(state, &caller, uint256_zero());
+  evm_destroy(&evm);
+  world_state_destroy(ws);
+  return called;
+}
+
+void test_block_executor_jumpdest_cache_across_blocks(void) {
+  jumpdest_cache_t cache;
+  TEST_ASSERT_TRUE(jumpdest_cache_init(&cache, &test_arena));
+
+  // First run analyses the transaction target and the CALL target
+  TEST_ASSERT_TRUE(uint256_eq(uint256_from_u64(1), run_jumping_call(&cache)));
+  TEST_ASSERT_EQUAL_size_t(2, cache.count);
+  TEST_ASSERT_EQUAL_size_t(0, cache.hits);
+
+  // Second run finds both bitmaps by code hash
+  TEST_ASSERT_TRUE(uint256_eq(uint256_from_u64(1), run_jumping_call(&cache)));
+  TEST_ASSERT_EQUAL_size_t(2, cache.count);
+  TEST_ASSERT_EQUAL_size_t(2, cache.hits);
+}
+
+/// malloc-backed block provider that tracks peak bytes.
+typedef struct {
+  div0_arena_provider_t base;
+  size_t live_bytes;
+  size_t peak_bytes;
+} tracking_provider_t;
+
+static void *tracking_acquire(div0_arena_provider_t *provider, size_t size) {
+  const auto tracker = (tracking_provider_t *)provider;
+  void *ptr = malloc(size);
+  if (ptr != nullptr) {
+    tracker->live_bytes += size;
+    if (tracker->live_bytes > tracker->peak_bytes) {
+      tracker->peak_bytes = tracker->live_bytes;
+    }
+  }
+  return ptr;
+}
+
+static void tracking_release(div0_arena_provider_t *provider, void *ptr, size_t size) {
+  ((tracking_provider_t *)provider)->live_bytes -= size;
+  free(ptr);
+}
+
+// Runs a block of tx_count identical calls to a contract that expands its memory to 16 KiB and
+// returns it, with the EVM on its own arena.
+// @return Peak bytes held by the EVM's arena
+static size_t run_scratch_block(const size_t tx_count, const bool rewind) {
+  tracking_provider_t provider = {
+      .base = {.acquire = tracking_acquire, .release = tracking_release},
+  };
+  div0_arena_t scratch;
+  const div0_arena_config_t config = {.block_size = 0, .provider = &provider.base};
+  TEST_ASSERT_TRUE(div0_arena_init_with(&scratch, &config));
+
+  world_state_t *ws = world_state_create(&test_arena);
+  state_access_t *state = world_state_access(ws);
+  const address_t sender = make_test_address(0x90);
+  const address_t contract = make_test_address(0x91);
+  state_set_balance(state, &sender, uint256_from_u64(1000000000000000000));
+
+  // PUSH1 1, PUSH2 0x3FE0, MSTORE, PUSH2 0x4000, PUSH1 0, RETURN
+  static const uint8_t code[] = {0x60, 0x01, 0x61, 0x3F, 0xE0, 0x52,
+                                 0x61, 0x40, 0x00, 0x60, 0x00, 0xF3};
+  state_set_code(state, &contract, code, sizeof(code));
+
+  block_context_t block = {0};
+  block.gas_limit = 30000000;
+  block.base_fee = uint256_from_u64(1000000000);
+  block.coinbase = make_test_address(0x92);
+
+  transaction_t *txs = div0_arena_alloc_array(&test_arena, tx_count, sizeof(transaction_t),
+                                              alignof(transaction_t));
+  block_tx_t *btxs = div0_arena_alloc_array(&test_arena, tx_count, sizeof(block_tx_t),
+                                            alignof(block_tx_t));
+  TEST_ASSERT_NOT_NULL(txs);
+  TEST_ASSERT_NOT_NULL(btxs);
+  for (size_t i = 0; i < tx_count; i++) {
+    make_legacy_tx(&txs[i], i, 100000, uint256_zero(), &contract);
+    btxs[i] = (block_tx_t){
+        .tx = &txs[i], .sender = sender, .sender_recovered = true, .original_index = i};
+  }
+
+  evm_t evm;
+  evm_init(&evm, &scratch, FORK_SHANGHAI);
+  block_executor_t exec;
+  block_executor_init(&exec, state, &block, &evm, &test_arena, 1);
+  exec.rewind_evm_arena = rewind;
+
+  block_exec_result_t result;
+  TEST_ASSERT_TRUE(block_executor_run(&exec, btxs, tx_count, &result));
+  TEST_ASSERT_EQUAL_size_t(tx_count, result.receipt_count);
+  for (size_t i = 0; i < tx_count; i++) {
+    TEST_ASSERT_TRUE(result.receipts[i].success);
+    // Outputs are copied out of the scratch before it is rewound
+    TEST_ASSERT_EQUAL_size_t(0x4000, result.receipts[i].output_size);
+    TEST_ASSERT_EQUAL_UINT8(1, result.receipts[i].output[0x4000 - 1]);
+  }
+
+  evm_destroy(&evm);
+  world_state_destroy(ws);
+  div0_arena_destroy(&scratch);
+  return provider.peak_bytes;
+}
+
+void test_block_executor_rewinds_evm_arena(void) {
+  // With rewinding, the EVM's peak is that of a single transaction
+  const size_t single = run_scratch_block(1, true);
+  TEST_ASSERT_EQUAL_size_t(single, run_scratch_block(16, true));
+
+  // Without it, every transaction's scratch stays until the block ends
+  TEST_ASSERT_TRUE(run_scratch_block(16, false) > single);
+}
@@ -23,5 +23,7 @@ void test_block_executor_coinbase_fee(void);
 void test_block_executor_multiple_txs(void);
 void test_block_executor_mixed_valid_rejected(void);
 void test_block_executor_nonce_increment_on_failed_execution(void);
+void test_block_executor_jumpdest_cache_across_blocks(void);
+void test_block_executor_rewinds_evm_arena(void);
 
 #endif // TEST_BLOCK_EXECUTOR_H
@@ -2,6 +2,7 @@
 
 #include "div0/json/json.h"
 #include "div0/json/parse.h"
+#include "div0/json/reader.h"
 #include "div0/json/write.h"
 #include "div0/mem/arena.h"
 #include "div0/util/hex.h"
@@ -281,6 +282,89 @@ void test_json_write_hex_values(void) {
   json_writer_free(&w);
 }
 
+// ============================================================================
+// JSON Reader Tests
+// ============================================================================
+
+void test_json_reader_walk(void) {
+  const char *json = " {\"skip\": {\"a\": [1, {\"b\": \"]}\\\"\"}], \"c\": null},"
+                     "  \"list\": [\"0x1\", \"0x2\", \"0x3\"], \"flag\": true} ";
+  json_reader_t r;
+  json_reader_init(&r, json, strlen(json));
+
+  TEST_ASSERT_EQUAL(JSON_TOKEN_OBJ, json_reader_peek(&r));
+  TEST_ASSERT_EQUAL(3, json_reader_count(&r));
+  TEST_ASSERT_TRUE(json_reader_obj_begin(&r));
+
+  const char *key;
+  size_t key_len;
+  TEST_ASSERT_TRUE(json_reader_obj_next(&r, &key, &key_len));
+  TEST_ASSERT_TRUE(json_reader_key_eq(key, key_len, "skip"));
+  TEST_ASSERT_TRUE(json_reader_skip(&r));
+
+  TEST_ASSERT_TRUE(json_reader_obj_next(&r, &key, &key_len));
+  TEST_ASSERT_TRUE(json_reader_key_eq(key, key_len, "list"));
+  TEST_ASSERT_EQUAL(3, json_reader_count(&r));
+  TEST_ASSERT_TRUE(json_reader_arr_begin(&r));
+  uint64_t sum = 0;
+  uint64_t value;
+  while (json_reader_arr_next(&r)) {
+    TEST_ASSERT_TRUE(json_reader_hex_u64(&r, &value));
+    sum += value;
+  }
+  TEST_ASSERT_EQUAL_UINT64(6, sum);
+
+  // Non-string values are skipped without a reader error
+  TEST_ASSERT_TRUE(json_reader_obj_next(&r, &key, &key_len));
+  TEST_ASSERT_TRUE(json_reader_key_eq(key, key_len, "flag"));
+  TEST_ASSERT_FALSE(json_reader_hex_u64(&r, &value));
+  TEST_ASSERT_TRUE(json_reader_ok(&r));
+
+  TEST_ASSERT_FALSE(json_reader_obj_next(&r, &key, &key_len));
+  TEST_ASSERT_TRUE(json_is_ok(json_reader_finish(&r)));
+}
+
+/// Read a value member by member (containers are not skipped).
+static void reader_walk(json_reader_t *const r) {
+  const char *key;
+  size_t key_len;
+  switch (json_reader_peek(r)) {
+  case JSON_TOKEN_OBJ:
+    (void)json_reader_obj_begin(r);
+    while (json_reader_obj_next(r, &key, &key_len)) {
+      reader_walk(r);
+    }
+    break;
+  case JSON_TOKEN_ARR:
+    (void)json_reader_arr_begin(r);
+    while (json_reader_arr_next(r)) {
+      reader_walk(r);
+    }
+    break;
+  default:
+    (void)json_reader_skip(r);
+    break;
+  }
+}
+
+void test_json_reader_errors(void) {
+  const char *const invalid[] = {
+      "{\"a\": \"unterminated}",
+      "{\"a\": 1 \"b\": 2}",
+      "[1, 2",
+      "{\"a\": tru}",
+      "{} {}",
+  };
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+    json_reader_t r;
+    json_reader_init(&r, invalid[i], strlen(invalid[i]));
+    reader_walk(&r);
+    TEST_ASSERT_EQUAL(JSON_ERR_PARSE, json_reader_finish(&r).error);
+    // Errors are sticky
+    TEST_ASSERT_FALSE(json_reader_arr_next(&r));
+  }
+}
+
 // ============================================================================
 // Hex Encoding Tests
 // ============================================================================
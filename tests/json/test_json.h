@@ -15,6 +15,8 @@ void test_json_arr_iteration(void);
 void test_json_write_object(void);
 void test_json_write_array(void);
 void test_json_write_hex_values(void);
+void test_json_reader_walk(void);
+void test_json_reader_errors(void);
 
 // Hex encoding tests
 void test_hex_encode_u64(void);
@@ -2,6 +2,7 @@
 
 #include "unity.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 // External test arena from test_div0.c
@@ -117,4 +118,154 @@ void test_arena_alloc_large_multiple(void) {
   TEST_ASSERT_NOT_EQUAL(ptr1, ptr3);
 
   div0_arena_destroy(&local_arena);
-}
\ No newline at end of file
+}
+void test_arena_mark_rewind(void) {
+  div0_arena_t local_arena;
+  TEST_ASSERT_TRUE(div0_arena_init(&local_arena));
+
+  uint64_t *keep = div0_arena_alloc(&local_arena, sizeof(uint64_t));
+  TEST_ASSERT_NOT_NULL(keep);
+  *keep = 0x1234;
+
+  const div0_arena_mark_t mark = div0_arena_mark(&local_arena);
+  void *scratch = div0_arena_alloc(&local_arena, 256);
+  TEST_ASSERT_NOT_NULL(scratch);
+  div0_arena_rewind(&local_arena, mark);
+
+  // Allocations before the mark survive, the scratch space is reused
+  TEST_ASSERT_EQUAL_UINT64(0x1234, *keep);
+  TEST_ASSERT_EQUAL_PTR(scratch, div0_arena_alloc(&local_arena, 256));
+
+  div0_arena_destroy(&local_arena);
+}
+
+void test_arena_rewind_across_blocks(void) {
+  div0_arena_t local_arena;
+  TEST_ASSERT_TRUE(div0_arena_init(&local_arena));
+
+  const div0_arena_mark_t mark = div0_arena_mark(&local_arena);
+  void *first = div0_arena_alloc(&local_arena, DIV0_ARENA_BLOCK_SIZE / 2);
+  TEST_ASSERT_NOT_NULL(first);
+
+  // Spill into two more blocks
+  for (int i = 0; i < 4; i++) {
+    TEST_ASSERT_NOT_NULL(div0_arena_alloc(&local_arena, DIV0_ARENA_BLOCK_SIZE / 2 + 8));
+  }
+  TEST_ASSERT_NOT_EQUAL(local_arena.head, local_arena.current);
+
+  div0_arena_rewind(&local_arena, mark);
+  TEST_ASSERT_EQUAL_PTR(local_arena.head, local_arena.current);
+  TEST_ASSERT_EQUAL_PTR(first, div0_arena_alloc(&local_arena, DIV0_ARENA_BLOCK_SIZE / 2));
+
+  // Blocks after the mark are reused from the start, not appended
+  div0_arena_block_t *second = local_arena.head->next;
+  void *spill = div0_arena_alloc(&local_arena, DIV0_ARENA_BLOCK_SIZE / 2 + 8);
+  TEST_ASSERT_EQUAL_PTR(second, local_arena.current);
+  TEST_ASSERT_EQUAL_PTR(second->data, spill);
+
+  div0_arena_destroy(&local_arena);
+}
+
+void test_arena_rewind_frees_large_blocks(void) {
+  div0_arena_t local_arena;
+  TEST_ASSERT_TRUE(div0_arena_init(&local_arena));
+
+  TEST_ASSERT_NOT_NULL(div0_arena_alloc_large(&local_arena, 100 * 1024, 8));
+  div0_arena_block_t *kept = local_arena.large_blocks;
+
+  const div0_arena_mark_t mark = div0_arena_mark(&local_arena);
+  TEST_ASSERT_NOT_NULL(div0_arena_alloc_large(&local_arena, 200 * 1024, 8));
+  TEST_ASSERT_NOT_NULL(div0_arena_alloc_large(&local_arena, 300 * 1024, 8));
+  div0_arena_rewind(&local_arena, mark);
+
+  // Only large blocks allocated after the mark are freed
+  TEST_ASSERT_EQUAL_PTR(kept, local_arena.large_blocks);
+  TEST_ASSERT_NULL(local_arena.large_blocks->next);
+
+  div0_arena_destroy(&local_arena);
+}
+
+void test_arena_rewind_nested(void) {
+  div0_arena_t local_arena;
+  TEST_ASSERT_TRUE(div0_arena_init(&local_arena));
+
+  const div0_arena_mark_t outer = div0_arena_mark(&local_arena);
+  uint32_t *a = div0_arena_alloc(&local_arena, sizeof(uint32_t));
+  TEST_ASSERT_NOT_NULL(a);
+  *a = 1;
+
+  const div0_arena_mark_t inner = div0_arena_mark(&local_arena);
+  void *b = div0_arena_alloc(&local_arena, 64);
+  div0_arena_rewind(&local_arena, inner);
+  TEST_ASSERT_EQUAL_UINT32(1, *a);
+  TEST_ASSERT_EQUAL_PTR(b, div0_arena_alloc(&local_arena, 64));
+
+  div0_arena_rewind(&local_arena, outer);
+  TEST_ASSERT_EQUAL_PTR(a, div0_arena_alloc(&local_arena, sizeof(uint32_t)));
+
+  div0_arena_destroy(&local_arena);
+}
+
+// Provider that counts outstanding bytes on top of malloc
+typedef struct {
+  div0_arena_provider_t base;
+  size_t outstanding;
+  size_t acquired;
+} counting_provider_t;
+
+static void *counting_acquire(div0_arena_provider_t *provider, size_t size) {
+  counting_provider_t *counter = (counting_provider_t *)provider;
+  counter->outstanding += size;
+  counter->acquired++;
+  return malloc(size);
+}
+
+static void counting_release(div0_arena_provider_t *provider, void *ptr, size_t size) {
+  counting_provider_t *counter = (counting_provider_t *)provider;
+  counter->outstanding -= size;
+  free(ptr);
+}
+
+void test_arena_init_with_block_size(void) {
+  div0_arena_t local_arena;
+  const div0_arena_config_t config = {.block_size = 4 * DIV0_ARENA_BLOCK_SIZE, .provider = nullptr};
+  TEST_ASSERT_TRUE(div0_arena_init_with(&local_arena, &config));
+  TEST_ASSERT_EQUAL(4 * DIV0_ARENA_BLOCK_SIZE, local_arena.block_size);
+
+  // Allocations up to the configured block size stay in regular blocks
+  void *ptr = div0_arena_alloc(&local_arena, 3 * DIV0_ARENA_BLOCK_SIZE);
+  TEST_ASSERT_NOT_NULL(ptr);
+  TEST_ASSERT_EQUAL_PTR(local_arena.head, local_arena.current);
+  TEST_ASSERT_NULL(local_arena.large_blocks);
+
+  div0_arena_destroy(&local_arena);
+
+  // Blocks smaller than the default are rejected
+  const div0_arena_config_t small = {.block_size = DIV0_ARENA_BLOCK_SIZE / 2, .provider = nullptr};
+  TEST_ASSERT_FALSE(div0_arena_init_with(&local_arena, &small));
+}
+
+void test_arena_custom_provider(void) {
+  counting_provider_t counter = {
+      .base = {.acquire = counting_acquire, .release = counting_release},
+      .outstanding = 0,
+      .acquired = 0,
+  };
+  const div0_arena_config_t config = {.block_size = 0, .provider = &counter.base};
+  div0_arena_t local_arena;
+  TEST_ASSERT_TRUE(div0_arena_init_with(&local_arena, &config));
+  TEST_ASSERT_EQUAL(DIV0_ARENA_BLOCK_SIZE, local_arena.block_size);
+
+  // Regular and large blocks all come from the provider
+  for (int i = 0; i < 3; i++) {
+    TEST_ASSERT_NOT_NULL(div0_arena_alloc(&local_arena, DIV0_ARENA_BLOCK_SIZE - 64));
+  }
+  TEST_ASSERT_NOT_NULL(div0_arena_alloc_large(&local_arena, 100 * 1024, 8));
+  TEST_ASSERT_EQUAL(4, counter.acquired);
+
+  // Large blocks go back on reset, regular blocks on destroy
+  div0_arena_reset(&local_arena);
+  TEST_ASSERT_EQUAL(3 * (sizeof(div0_arena_block_t) + DIV0_ARENA_BLOCK_SIZE), counter.outstanding);
+  div0_arena_destroy(&local_arena);
+  TEST_ASSERT_EQUAL(0, counter.outstanding);
+}
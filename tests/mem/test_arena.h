@@ -9,5 +9,11 @@ void test_arena_alloc_large(void);
 void test_arena_alloc_large_alignment(void);
 void test_arena_alloc_large_freed_on_reset(void);
 void test_arena_alloc_large_multiple(void);
+void test_arena_mark_rewind(void);
+void test_arena_rewind_across_blocks(void);
+void test_arena_rewind_frees_large_blocks(void);
+void test_arena_rewind_nested(void);
+void test_arena_init_with_block_size(void);
+void test_arena_custom_provider(void);
 
 #endif // TEST_ARENA_H
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "test_huge_pages.h"
+
+#include "div0/mem/arena.h"
+#include "div0/mem/huge_pages.h"
+
+#include "unity.h"
+
+#include <stdint.h>
+#include <string.h>
+
+// Helper: arena with huge page sized blocks on top of a provider
+static void init_huge_arena(div0_arena_t *arena, div0_huge_page_provider_t *provider) {
+  const div0_arena_config_t config = {
+      .block_size = DIV0_HUGE_PAGE_BLOCK_SIZE,
+      .provider = div0_huge_page_provider(provider),
+  };
+  TEST_ASSERT_TRUE(div0_arena_init_with(arena, &config));
+}
+
+void test_huge_pages_reserve_aligned(void) {
+  div0_huge_page_provider_t provider;
+  TEST_ASSERT_TRUE(div0_huge_page_provider_init(&provider, 1, true));
+
+  // Reservation is rounded up to one huge page and aligned for THP
+  TEST_ASSERT_EQUAL(DIV0_HUGE_PAGE_SIZE, provider.mapped_size);
+  TEST_ASSERT_EQUAL(DIV0_HUGE_PAGE_SIZE, provider.remaining);
+  TEST_ASSERT_EQUAL_UINT64(0, (uintptr_t)provider.cursor % DIV0_HUGE_PAGE_SIZE);
+
+  div0_huge_page_provider_destroy(&provider);
+  TEST_ASSERT_EQUAL(0, provider.mapped_size);
+}
+
+void test_huge_pages_arena_blocks_fill_page(void) {
+  div0_huge_page_provider_t provider;
+  TEST_ASSERT_TRUE(div0_huge_page_provider_init(&provider, 0, false));
+  div0_arena_t arena;
+  init_huge_arena(&arena, &provider);
+
+  // Four blocks, headers included, fit one huge page exactly
+  for (int i = 0; i < 4; i++) {
+    uint8_t *ptr = div0_arena_alloc(&arena, DIV0_HUGE_PAGE_BLOCK_SIZE - 64);
+    TEST_ASSERT_NOT_NULL(ptr);
+    memset(ptr, 0xA5, DIV0_HUGE_PAGE_BLOCK_SIZE - 64);
+  }
+  TEST_ASSERT_EQUAL(DIV0_HUGE_PAGE_SIZE, provider.mapped_size);
+  TEST_ASSERT_EQUAL(0, provider.remaining);
+
+  // The fifth block starts a new region
+  TEST_ASSERT_NOT_NULL(div0_arena_alloc(&arena, DIV0_HUGE_PAGE_BLOCK_SIZE - 64));
+  TEST_ASSERT_EQUAL(2 * DIV0_HUGE_PAGE_SIZE, provider.mapped_size);
+
+  div0_arena_destroy(&arena);
+  div0_huge_page_provider_destroy(&provider);
+}
+
+void test_huge_pages_default_block_fills_class(void) {
+  div0_huge_page_provider_t provider;
+  TEST_ASSERT_TRUE(div0_huge_page_provider_init(&provider, 0, false));
+  const div0_arena_config_t config = {
+      .block_size = 0,
+      .provider = div0_huge_page_provider(&provider),
+  };
+  div0_arena_t arena;
+  TEST_ASSERT_TRUE(div0_arena_init_with(&arena, &config));
+
+  // The default block, header included, takes a 64KB class and not the next one
+  TEST_ASSERT_EQUAL(DIV0_HUGE_PAGE_SIZE - (size_t)64 * 1024, provider.remaining);
+
+  div0_arena_destroy(&arena);
+  div0_huge_page_provider_destroy(&provider);
+}
+
+void test_huge_pages_large_alloc_unmapped_on_reset(void) {
+  div0_huge_page_provider_t provider;
+  TEST_ASSERT_TRUE(div0_huge_page_provider_init(&provider, 0, false));
+  div0_arena_t arena;
+  init_huge_arena(&arena, &provider);
+  const size_t base_mapped = provider.mapped_size;
+
+  // Larger than a huge page: mapped on its own, 64-byte aligned
+  const size_t large_size = 3 * DIV0_HUGE_PAGE_SIZE;
+  uint8_t *ptr = div0_arena_alloc_large(&arena, large_size, 64);
+  TEST_ASSERT_NOT_NULL(ptr);
+  TEST_ASSERT_EQUAL_UINT64(0, (uintptr_t)ptr % 64);
+  ptr[0] = 1;
+  ptr[large_size - 1] = 2;
+  TEST_ASSERT_EQUAL(base_mapped + 4 * DIV0_HUGE_PAGE_SIZE, provider.mapped_size);
+
+  div0_arena_reset(&arena);
+  TEST_ASSERT_EQUAL(base_mapped, provider.mapped_size);
+
+  div0_arena_destroy(&arena);
+  div0_huge_page_provider_destroy(&provider);
+}
+
+void test_huge_pages_reuse_released_blocks(void) {
+  div0_huge_page_provider_t provider;
+  TEST_ASSERT_TRUE(div0_huge_page_provider_init(&provider, 0, false));
+
+  div0_arena_t first;
+  init_huge_arena(&first, &provider);
+  div0_arena_block_t *const block = first.head;
+  div0_arena_destroy(&first);
+
+  // A second arena with the same block size gets the released block back
+  div0_arena_t second;
+  init_huge_arena(&second, &provider);
+  TEST_ASSERT_EQUAL_PTR(block, second.head);
+  TEST_ASSERT_EQUAL(DIV0_HUGE_PAGE_SIZE, provider.mapped_size);
+
+  div0_arena_destroy(&second);
+  div0_huge_page_provider_destroy(&provider);
+}
+
+void test_huge_pages_reuse_larger_block(void) {
+  div0_huge_page_provider_t provider;
+  TEST_ASSERT_TRUE(div0_huge_page_provider_init(&provider, 0, false));
+  div0_arena_provider_t *const blocks = div0_huge_page_provider(&provider);
+
+  // Sizes in the same class share a block
+  uint8_t *const first = blocks->acquire(blocks, 700 * 1024);
+  TEST_ASSERT_NOT_NULL(first);
+  blocks->release(blocks, first, 700 * 1024);
+  uint8_t *const second = blocks->acquire(blocks, 600 * 1024);
+  TEST_ASSERT_EQUAL_PTR(first, second);
+
+  // A smaller request splits the released block instead of carving new memory
+  blocks->release(blocks, second, 600 * 1024);
+  uint8_t *const quarter = blocks->acquire(blocks, 200 * 1024);
+  uint8_t *const rest = blocks->acquire(blocks, 500 * 1024);
+  TEST_ASSERT_EQUAL_PTR(first, quarter);
+  TEST_ASSERT_EQUAL_PTR(first + 512 * 1024, rest);
+  TEST_ASSERT_EQUAL(DIV0_HUGE_PAGE_SIZE, provider.mapped_size);
+
+  blocks->release(blocks, quarter, 200 * 1024);
+  blocks->release(blocks, rest, 500 * 1024);
+  div0_huge_page_provider_destroy(&provider);
+}
+
+void test_huge_pages_cache_limit_unmaps(void) {
+  div0_huge_page_provider_t provider;
+  TEST_ASSERT_TRUE(div0_huge_page_provider_init(&provider, 0, false));
+  provider.cache_limit = DIV0_HUGE_PAGE_SIZE;
+
+  // Five arena blocks span two regions
+  div0_arena_t arena;
+  init_huge_arena(&arena, &provider);
+  for (int i = 0; i < 5; i++) {
+    TEST_ASSERT_NOT_NULL(div0_arena_alloc(&arena, DIV0_HUGE_PAGE_BLOCK_SIZE - 64));
+  }
+  TEST_ASSERT_EQUAL(2 * DIV0_HUGE_PAGE_SIZE, provider.mapped_size);
+
+  // Released blocks beyond the limit are unmapped with their region
+  div0_arena_destroy(&arena);
+  TEST_ASSERT_TRUE(provider.cached_size <= provider.cache_limit);
+  TEST_ASSERT_EQUAL(DIV0_HUGE_PAGE_SIZE, provider.mapped_size);
+
+  // What stays cached is reused
+  init_huge_arena(&arena, &provider);
+  TEST_ASSERT_EQUAL(DIV0_HUGE_PAGE_SIZE, provider.mapped_size);
+
+  div0_arena_destroy(&arena);
+  div0_huge_page_provider_destroy(&provider);
+}
@@ -0,0 +1,12 @@
+#ifndef TEST_HUGE_PAGES_H
+#define TEST_HUGE_PAGES_H
+
+void test_huge_pages_reserve_aligned(void);
+void test_huge_pages_arena_blocks_fill_page(void);
+void test_huge_pages_default_block_fills_class(void);
+void test_huge_pages_large_alloc_unmapped_on_reset(void);
+void test_huge_pages_reuse_released_blocks(void);
+void test_huge_pages_reuse_larger_block(void);
+void test_huge_pages_cache_limit_unmaps(void);
+
+#endif // TEST_HUGE_PAGES_H
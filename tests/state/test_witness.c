@@ -0,0 +1,247 @@
+#include "test_witness.h"
+
+#include "div0/state/state_access.h"
+#include "div0/state/witness.h"
+#include "div0/state/world_state.h"
+
+#include "unity.h"
+
+#include <string.h>
+
+// External arena from main test file
+extern div0_arena_t test_arena;
+
+/// Number of plain accounts in the test state.
+static constexpr uint8_t WITNESS_ACCOUNT_COUNT = 32;
+
+// Helper to create a test address
+static address_t make_test_address(uint8_t seed) {
+  address_t addr = {0};
+  for (size_t i = 0; i < 20; i++) {
+    addr.bytes[i] = (uint8_t)(seed * (i + 7));
+  }
+  return addr;
+}
+
+static const uint8_t CONTRACT_CODE[] = {0x60, 0x01, 0x60, 0x00, 0x55, 0x00};
+
+// Helper: accounts with balances, plus one contract with code and storage
+static void populate_state(state_access_t *state) {
+  for (uint8_t i = 1; i <= WITNESS_ACCOUNT_COUNT; i++) {
+    const address_t addr = make_test_address(i);
+    state_set_balance(state, &addr, uint256_from_u64(1000U * i));
+    state_set_nonce(state, &addr, i);
+  }
+  const address_t contract = make_test_address(0xC0);
+  state_set_code(state, &contract, CONTRACT_CODE, sizeof(CONTRACT_CODE));
+  for (uint64_t slot = 0; slot < 16; slot++) {
+    state_set_storage(state, &contract, uint256_from_u64(slot), uint256_from_u64(slot + 100));
+  }
+}
+
+// Helper: a block's worth of reads and writes
+static void execute_block(state_access_t *state) {
+  const address_t from = make_test_address(3);
+  const address_t to = make_test_address(4);
+  const address_t fresh = make_test_address(0xEE);
+  const address_t contract = make_test_address(0xC0);
+
+  TEST_ASSERT_TRUE(state_sub_balance(state, &from, uint256_from_u64(500)));
+  TEST_ASSERT_TRUE(state_add_balance(state, &to, uint256_from_u64(500)));
+  (void)state_increment_nonce(state, &from);
+  state_set_balance(state, &fresh, uint256_from_u64(1));
+
+  // Read, update, delete and create slots
+  const uint256_t value = state_get_storage(state, &contract, uint256_from_u64(2));
+  TEST_ASSERT_TRUE(uint256_eq(value, uint256_from_u64(102)));
+  state_set_storage(state, &contract, uint256_from_u64(5), uint256_from_u64(7));
+  state_set_storage(state, &contract, uint256_from_u64(9), uint256_zero());
+  state_set_storage(state, &contract, uint256_from_u64(1000), uint256_from_u64(1));
+
+  // Empty an account so it is deleted from the state trie (EIP-161)
+  const address_t drained = make_test_address(5);
+  state_set_nonce(state, &drained, 0);
+  state_set_balance(state, &drained, uint256_zero());
+}
+
+// ===========================================================================
+// Witness format tests
+// ===========================================================================
+
+void test_witness_encode_decode_roundtrip(void) {
+  uint8_t node_a[40];
+  uint8_t node_b[200];
+  memset(node_a, 0xA1, sizeof(node_a));
+  memset(node_b, 0xB2, sizeof(node_b));
+  bytes_t nodes[2] = {{.data = node_a, .size = sizeof(node_a)},
+                      {.data = node_b, .size = sizeof(node_b)}};
+  bytes_t codes[1] = {{.data = (uint8_t *)CONTRACT_CODE, .size = sizeof(CONTRACT_CODE)}};
+  address_t addresses[3] = {make_test_address(1), make_test_address(2), make_test_address(3)};
+
+  const witness_t witness = {
+      .pre_state_root = MPT_EMPTY_ROOT,
+      .nodes = {.nodes = nodes, .count = 2},
+      .codes = codes,
+      .code_count = 1,
+      .addresses = addresses,
+      .address_count = 3,
+  };
+
+  const bytes_t encoded = witness_encode(&witness, &test_arena);
+  TEST_ASSERT_NOT_NULL(encoded.data);
+  // Header + 3 counts + length prefixes (1, 2 and 1 bytes) + payloads
+  TEST_ASSERT_EQUAL(37 + 3 + 1 + 2 + 1 + 40 + 200 + sizeof(CONTRACT_CODE) + 60, encoded.size);
+
+  witness_t decoded;
+  TEST_ASSERT_TRUE(witness_decode(encoded.data, encoded.size, &test_arena, &decoded));
+  TEST_ASSERT_TRUE(hash_equal(&decoded.pre_state_root, &MPT_EMPTY_ROOT));
+  TEST_ASSERT_EQUAL(2, decoded.nodes.count);
+  TEST_ASSERT_EQUAL(200, decoded.nodes.nodes[1].size);
+  TEST_ASSERT_EQUAL_MEMORY(node_b, decoded.nodes.nodes[1].data, sizeof(node_b));
+  TEST_ASSERT_EQUAL(1, decoded.code_count);
+  TEST_ASSERT_EQUAL_MEMORY(CONTRACT_CODE, decoded.codes[0].data, sizeof(CONTRACT_CODE));
+  TEST_ASSERT_EQUAL(3, decoded.address_count);
+  TEST_ASSERT_TRUE(address_equal(&addresses[2], &decoded.addresses[2]));
+}
+
+void test_witness_decode_rejects_malformed(void) {
+  uint8_t node[8] = {0};
+  bytes_t nodes[1] = {{.data = node, .size = sizeof(node)}};
+  const witness_t witness = {.pre_state_root = MPT_EMPTY_ROOT,
+                             .nodes = {.nodes = nodes, .count = 1}};
+
+  const bytes_t encoded = witness_encode(&witness, &test_arena);
+  TEST_ASSERT_NOT_NULL(encoded.data);
+
+  witness_t decoded;
+  TEST_ASSERT_TRUE(witness_decode(encoded.data, encoded.size, &test_arena, &decoded));
+
+  // Every truncation fails
+  for (size_t len = 0; len < encoded.size; len++) {
+    TEST_ASSERT_FALSE(witness_decode(encoded.data, len, &test_arena, &decoded));
+  }
+
+  // Bad magic
+  encoded.data[0] ^= 0xFF;
+  TEST_ASSERT_FALSE(witness_decode(encoded.data, encoded.size, &test_arena, &decoded));
+  encoded.data[0] ^= 0xFF;
+
+  // Node count larger than the remaining input
+  encoded.data[37] = 0x7F;
+  TEST_ASSERT_FALSE(witness_decode(encoded.data, encoded.size, &test_arena, &decoded));
+}
+
+// ===========================================================================
+// Witness recording and replay tests
+// ===========================================================================
+
+void test_witness_replay_matches_full_state(void) {
+  // Pre-state twice: one copy is executed on, the other stays untouched
+  world_state_t *live = world_state_create(&test_arena);
+  world_state_t *pre = world_state_create(&test_arena);
+  TEST_ASSERT_NOT_NULL(live);
+  TEST_ASSERT_NOT_NULL(pre);
+  populate_state(world_state_access(live));
+  populate_state(world_state_access(pre));
+  const hash_t pre_root = world_state_root(live);
+
+  witness_recorder_t *rec = witness_recorder_create(world_state_access(live), &test_arena);
+  TEST_ASSERT_NOT_NULL(rec);
+  execute_block(witness_recorder_access(rec));
+  const hash_t expected = world_state_root(live);
+
+  witness_t witness;
+  TEST_ASSERT_TRUE(witness_build(rec, pre, &test_arena, &witness));
+  TEST_ASSERT_TRUE(hash_equal(&pre_root, &witness.pre_state_root));
+  TEST_ASSERT_TRUE(witness.nodes.count > 0);
+
+  const bytes_t encoded = witness_encode(&witness, &test_arena);
+  witness_t decoded;
+  TEST_ASSERT_TRUE(witness_decode(encoded.data, encoded.size, &test_arena, &decoded));
+
+  world_state_t *replay = world_state_from_witness(&decoded, &test_arena);
+  TEST_ASSERT_NOT_NULL(replay);
+  hash_t root = world_state_root(replay);
+  TEST_ASSERT_TRUE(hash_equal(&pre_root, &root));
+
+  execute_block(world_state_access(replay));
+  root = world_state_root(replay);
+  TEST_ASSERT_TRUE(hash_equal(&expected, &root));
+
+  witness_recorder_destroy(rec);
+  world_state_destroy(replay);
+  world_state_destroy(pre);
+  world_state_destroy(live);
+}
+
+void test_witness_records_code(void) {
+  world_state_t *live = world_state_create(&test_arena);
+  world_state_t *pre = world_state_create(&test_arena);
+  populate_state(world_state_access(live));
+  populate_state(world_state_access(pre));
+
+  witness_recorder_t *rec = witness_recorder_create(world_state_access(live), &test_arena);
+  state_access_t *access = witness_recorder_access(rec);
+  const address_t contract = make_test_address(0xC0);
+  const address_t plain = make_test_address(1);
+  TEST_ASSERT_EQUAL(sizeof(CONTRACT_CODE), state_get_code_size(access, &contract));
+  TEST_ASSERT_EQUAL(0, state_get_code_size(access, &plain));
+
+  witness_t witness;
+  TEST_ASSERT_TRUE(witness_build(rec, pre, &test_arena, &witness));
+  TEST_ASSERT_EQUAL(2, witness.address_count);
+  TEST_ASSERT_EQUAL(1, witness.code_count);
+
+  world_state_t *replay = world_state_from_witness(&witness, &test_arena);
+  TEST_ASSERT_NOT_NULL(replay);
+  const bytes_t code = state_get_code(world_state_access(replay), &contract);
+  TEST_ASSERT_EQUAL(sizeof(CONTRACT_CODE), code.size);
+  TEST_ASSERT_EQUAL_MEMORY(CONTRACT_CODE, code.data, sizeof(CONTRACT_CODE));
+
+  witness_recorder_destroy(rec);
+  world_state_destroy(replay);
+  world_state_destroy(pre);
+  world_state_destroy(live);
+}
+
+void test_witness_unrecorded_read_unavailable(void) {
+  world_state_t *live = world_state_create(&test_arena);
+  world_state_t *pre = world_state_create(&test_arena);
+  populate_state(world_state_access(live));
+  populate_state(world_state_access(pre));
+
+  // Only balances are read: the contract's storage root is in the witness, its slots are not
+  witness_recorder_t *rec = witness_recorder_create(world_state_access(live), &test_arena);
+  const address_t recorded = make_test_address(1);
+  const address_t contract = make_test_address(0xC0);
+  (void)state_get_balance(witness_recorder_access(rec), &recorded);
+  (void)state_get_balance(witness_recorder_access(rec), &contract);
+
+  witness_t witness;
+  TEST_ASSERT_TRUE(witness_build(rec, pre, &test_arena, &witness));
+  world_state_t *replay = world_state_from_witness(&witness, &test_arena);
+  TEST_ASSERT_NOT_NULL(replay);
+  state_access_t *access = world_state_access(replay);
+
+  // Recorded accounts read normally
+  TEST_ASSERT_TRUE(uint256_eq(state_get_balance(access, &recorded), uint256_from_u64(1000)));
+  TEST_ASSERT_FALSE(state_is_unavailable(access));
+
+  // An account under a subtree the witness does not hold cannot be read
+  const address_t unrecorded = make_test_address(17);
+  TEST_ASSERT_TRUE(uint256_is_zero(state_get_balance(access, &unrecorded)));
+  TEST_ASSERT_TRUE(state_is_unavailable(access));
+
+  // Nor can a slot that was not read
+  world_state_t *slot_replay = world_state_from_witness(&witness, &test_arena);
+  TEST_ASSERT_NOT_NULL(slot_replay);
+  access = world_state_access(slot_replay);
+  TEST_ASSERT_TRUE(uint256_is_zero(state_get_storage(access, &contract, uint256_from_u64(3))));
+  TEST_ASSERT_TRUE(state_is_unavailable(access));
+
+  witness_recorder_destroy(rec);
+  world_state_destroy(slot_replay);
+  world_state_destroy(replay);
+  world_state_destroy(pre);
+  world_state_destroy(live);
+}
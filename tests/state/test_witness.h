@@ -0,0 +1,13 @@
+#ifndef TEST_WITNESS_H
+#define TEST_WITNESS_H
+
+// Witness format tests
+void test_witness_encode_decode_roundtrip(void);
+void test_witness_decode_rejects_malformed(void);
+
+// Witness recording and replay tests
+void test_witness_replay_matches_full_state(void);
+void test_witness_records_code(void);
+void test_witness_unrecorded_read_unavailable(void);
+
+#endif // TEST_WITNESS_H
@@ -546,6 +546,108 @@ void test_world_state_original_storage_unset_slot(void) {
   world_state_destroy(ws);
 }
 
+// ===========================================================================
+// Fused access tests
+// ===========================================================================
+
+void test_world_state_storage_access_fused(void) {
+  world_state_t *ws = world_state_create(&test_arena);
+  state_access_t *access = world_state_access(ws);
+  address_t addr = make_test_address(0x83);
+  uint256_t slot = uint256_from_u64(7);
+
+  access->vtable->set_storage(access, &addr, slot, uint256_from_u64(100));
+  access->vtable->begin_transaction(access);
+
+  // First access is cold and returns current and original value
+  uint256_t current;
+  uint256_t original;
+  bool was_cold;
+  state_storage_access(access, &addr, slot, &current, &original, &was_cold);
+  TEST_ASSERT_TRUE(was_cold);
+  TEST_ASSERT_TRUE(uint256_eq(current, uint256_from_u64(100)));
+  TEST_ASSERT_TRUE(uint256_eq(original, uint256_from_u64(100)));
+  TEST_ASSERT_TRUE(access->vtable->is_slot_warm(access, &addr, slot));
+
+  // Write with the original value from the access
+  state_storage_write(access, &addr, slot, current, original, uint256_from_u64(200));
+
+  // Second access is warm; original stays at the value from tx start
+  state_storage_access(access, &addr, slot, &current, &original, &was_cold);
+  TEST_ASSERT_FALSE(was_cold);
+  TEST_ASSERT_TRUE(uint256_eq(current, uint256_from_u64(200)));
+  TEST_ASSERT_TRUE(uint256_eq(original, uint256_from_u64(100)));
+
+  // A later write does not replace the recorded original
+  state_storage_write(access, &addr, slot, current, uint256_from_u64(200),
+                      uint256_from_u64(300));
+  original = access->vtable->get_original_storage(access, &addr, slot);
+  TEST_ASSERT_TRUE(uint256_eq(original, uint256_from_u64(100)));
+
+  // Original is optional
+  state_storage_access(access, &addr, slot, &current, nullptr, &was_cold);
+  TEST_ASSERT_TRUE(uint256_eq(current, uint256_from_u64(300)));
+
+  // New transaction: slot is cold again and the original resets
+  access->vtable->begin_transaction(access);
+  state_storage_access(access, &addr, slot, &current, &original, &was_cold);
+  TEST_ASSERT_TRUE(was_cold);
+  TEST_ASSERT_TRUE(uint256_eq(original, uint256_from_u64(300)));
+
+  world_state_destroy(ws);
+}
+
+void test_world_state_set_storage_does_not_warm(void) {
+  world_state_t *ws = world_state_create(&test_arena);
+  state_access_t *access = world_state_access(ws);
+  address_t addr = make_test_address(0x84);
+  uint256_t slot = uint256_from_u64(8);
+
+  access->vtable->set_storage(access, &addr, slot, uint256_from_u64(1));
+  TEST_ASSERT_FALSE(access->vtable->is_slot_warm(access, &addr, slot));
+  TEST_ASSERT_TRUE(access->vtable->warm_slot(access, &addr, slot));
+
+  world_state_destroy(ws);
+}
+
+void test_world_state_account_access_fused(void) {
+  world_state_t *ws = world_state_create(&test_arena);
+  state_access_t *access = world_state_access(ws);
+  address_t addr = make_test_address(0x85);
+  address_t missing = make_test_address(0x86);
+
+  access->vtable->create_contract(access, &addr);
+  access->vtable->set_balance(access, &addr, uint256_from_u64(500));
+  uint8_t bytecode[] = {0x60, 0x01, 0x00}; // PUSH1 1 STOP
+  access->vtable->set_code(access, &addr, bytecode, sizeof(bytecode));
+
+  // First access is cold and loads the account fields
+  state_account_view_t view;
+  bool was_cold = state_account_access(access, &addr, STATE_ACCOUNT_INFO, &view);
+  TEST_ASSERT_TRUE(was_cold);
+  TEST_ASSERT_TRUE(view.exists);
+  TEST_ASSERT_TRUE(uint256_eq(view.balance, uint256_from_u64(500)));
+  TEST_ASSERT_EQUAL_UINT64(1, view.nonce);
+  hash_t code_hash = access->vtable->get_code_hash(access, &addr);
+  TEST_ASSERT_EQUAL_MEMORY(code_hash.bytes, view.code_hash.bytes, HASH_SIZE);
+  TEST_ASSERT_TRUE(access->vtable->is_address_warm(access, &addr));
+
+  // Second access is warm and can load code instead
+  was_cold = state_account_access(access, &addr, STATE_ACCOUNT_CODE, &view);
+  TEST_ASSERT_FALSE(was_cold);
+  TEST_ASSERT_EQUAL(sizeof(bytecode), view.code.size);
+  TEST_ASSERT_EQUAL_MEMORY(bytecode, view.code.data, sizeof(bytecode));
+
+  // Missing accounts still get warmed
+  was_cold = state_account_access(access, &missing, STATE_ACCOUNT_INFO | STATE_ACCOUNT_CODE, &view);
+  TEST_ASSERT_TRUE(was_cold);
+  TEST_ASSERT_FALSE(view.exists);
+  TEST_ASSERT_TRUE(uint256_is_zero(view.balance));
+  TEST_ASSERT_EQUAL(0, view.code.size);
+
+  world_state_destroy(ws);
+}
+
 // ===========================================================================
 // Multi-account isolation tests
 // ===========================================================================
@@ -868,3 +970,152 @@ void test_world_state_snapshot_with_code(void) {
 
   world_state_destroy(ws);
 }
+
+// ===========================================================================
+// Snapshot/revert tests
+// ===========================================================================
+
+void test_world_state_revert_to_snapshot(void) {
+  world_state_t *ws = world_state_create(&test_arena);
+  state_access_t *access = world_state_access(ws);
+  const address_t existing = make_test_address(0x10);
+  const address_t created = make_test_address(0x20);
+  const uint256_t slot = uint256_from_u64(1);
+  const uint8_t code[] = {0x60, 0x00, 0x00};
+
+  state_set_balance(access, &existing, uint256_from_u64(1000));
+  state_set_storage(access, &existing, slot, uint256_from_u64(7));
+  const hash_t pre_root = world_state_root(ws);
+
+  state_begin_transaction(access);
+  const uint64_t snapshot = state_snapshot(access);
+  TEST_ASSERT_TRUE(state_sub_balance(access, &existing, uint256_from_u64(400)));
+  (void)state_increment_nonce(access, &existing);
+  state_set_storage(access, &existing, slot, uint256_from_u64(8));
+  state_set_storage(access, &existing, uint256_from_u64(2), uint256_from_u64(9));
+  state_create_contract(access, &created);
+  TEST_ASSERT_TRUE(state_add_balance(access, &created, uint256_from_u64(400)));
+  state_set_code(access, &created, code, sizeof(code));
+  state_set_storage(access, &created, slot, uint256_from_u64(5));
+  state_revert_to_snapshot(access, snapshot);
+
+  TEST_ASSERT_TRUE(uint256_eq(state_get_balance(access, &existing), uint256_from_u64(1000)));
+  TEST_ASSERT_EQUAL_UINT64(0, state_get_nonce(access, &existing));
+  TEST_ASSERT_TRUE(uint256_eq(state_get_storage(access, &existing, slot), uint256_from_u64(7)));
+  TEST_ASSERT_TRUE(uint256_is_zero(state_get_storage(access, &existing, uint256_from_u64(2))));
+  TEST_ASSERT_FALSE(state_account_exists(access, &created));
+  TEST_ASSERT_EQUAL(0, state_get_code_size(access, &created));
+  TEST_ASSERT_TRUE(uint256_is_zero(state_get_storage(access, &created, slot)));
+
+  const hash_t root = world_state_root(ws);
+  TEST_ASSERT_TRUE(hash_equal(&pre_root, &root));
+
+  world_state_destroy(ws);
+}
+
+void test_world_state_nested_snapshots(void) {
+  world_state_t *ws = world_state_create(&test_arena);
+  state_access_t *access = world_state_access(ws);
+  const address_t addr = make_test_address(0x30);
+  const uint256_t slot = uint256_from_u64(3);
+
+  state_set_storage(access, &addr, slot, uint256_from_u64(1));
+  state_set_nonce(access, &addr, 1);
+  const hash_t pre_root = world_state_root(ws);
+
+  state_begin_transaction(access);
+  const uint64_t outer = state_snapshot(access);
+  state_set_storage(access, &addr, slot, uint256_from_u64(2));
+
+  // Inner changes are reverted alone
+  const uint64_t inner = state_snapshot(access);
+  state_set_storage(access, &addr, slot, uint256_from_u64(3));
+  state_delete_account(access, &addr);
+  state_revert_to_snapshot(access, inner);
+  TEST_ASSERT_EQUAL_UINT64(1, state_get_nonce(access, &addr));
+  TEST_ASSERT_TRUE(uint256_eq(state_get_storage(access, &addr, slot), uint256_from_u64(2)));
+
+  // A committed inner snapshot is still undone by the outer revert
+  const uint64_t committed = state_snapshot(access);
+  state_set_storage(access, &addr, slot, uint256_from_u64(4));
+  state_commit_snapshot(access, committed);
+  TEST_ASSERT_TRUE(uint256_eq(state_get_storage(access, &addr, slot), uint256_from_u64(4)));
+  state_revert_to_snapshot(access, outer);
+  TEST_ASSERT_TRUE(uint256_eq(state_get_storage(access, &addr, slot), uint256_from_u64(1)));
+
+  const hash_t root = world_state_root(ws);
+  TEST_ASSERT_TRUE(hash_equal(&pre_root, &root));
+
+  world_state_destroy(ws);
+}
+
+void test_world_state_stats(void) {
+  world_state_t *ws = world_state_create(&test_arena);
+  state_access_t *access = world_state_access(ws);
+
+  world_state_stats_t stats = world_state_stats(ws);
+  TEST_ASSERT_EQUAL(0, stats.all_accounts.size);
+  TEST_ASSERT_EQUAL(0, stats.all_storage_slots.size);
+
+  address_t addr = make_test_address(0xD1);
+  access->vtable->set_balance(access, &addr, uint256_from_u64(1));
+  access->vtable->set_storage(access, &addr, uint256_from_u64(1), uint256_from_u64(2));
+  access->vtable->set_storage(access, &addr, uint256_from_u64(2), uint256_from_u64(3));
+
+  stats = world_state_stats(ws);
+  TEST_ASSERT_EQUAL(1, stats.all_accounts.size);
+  TEST_ASSERT_EQUAL(2, stats.all_storage_slots.size);
+  TEST_ASSERT_TRUE(stats.all_storage_slots.buckets >= stats.all_storage_slots.size);
+  TEST_ASSERT_EQUAL(0, stats.code_store.size);
+
+  world_state_destroy(ws);
+}
+
+void test_world_state_jumpdest_cache(void) {
+  jumpdest_cache_t cache;
+  TEST_ASSERT_TRUE(jumpdest_cache_init(&cache, &test_arena));
+
+  world_state_t *ws = world_state_create(&test_arena);
+  state_access_t *access = world_state_access(ws);
+
+  hash_t code_hash = hash_zero();
+  code_hash.bytes[0] = 0x42;
+  const uint8_t bitmap[2] = {0x05, 0x80};
+
+  // Without a cache, analyses are neither stored nor found
+  access->vtable->set_jumpdest_analysis(access, &code_hash, bitmap, sizeof(bitmap));
+  TEST_ASSERT_NULL(access->vtable->get_jumpdest_analysis(access, &code_hash));
+
+  // The cache keeps its own copy
+  world_state_set_jumpdest_cache(ws, &cache);
+  access->vtable->set_jumpdest_analysis(access, &code_hash, bitmap, sizeof(bitmap));
+  const uint8_t *cached = access->vtable->get_jumpdest_analysis(access, &code_hash);
+  TEST_ASSERT_NOT_NULL(cached);
+  TEST_ASSERT_NOT_EQUAL(bitmap, cached);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(bitmap, cached, sizeof(bitmap));
+  world_state_destroy(ws);
+
+  // Entries survive the world state and table growth
+  for (uint32_t i = 0; i < 1000; i++) {
+    hash_t h = hash_zero();
+    h.bytes[0] = (uint8_t)i;
+    h.bytes[1] = (uint8_t)(i >> 8);
+    h.bytes[31] = 1;
+    const uint8_t b = (uint8_t)i;
+    TEST_ASSERT_TRUE(jumpdest_cache_put(&cache, &h, &b, 1));
+  }
+  TEST_ASSERT_EQUAL(1001, cache.count);
+  // Size counts the live table, the retired ones and every bitmap copy
+  TEST_ASSERT_TRUE(cache.size >=
+                   cache.capacity * sizeof(jumpdest_cache_entry_t) + sizeof(bitmap) + 1000);
+  TEST_ASSERT_EQUAL_PTR(cached, jumpdest_cache_get(&cache, &code_hash));
+  for (uint32_t i = 0; i < 1000; i++) {
+    hash_t h = hash_zero();
+    h.bytes[0] = (uint8_t)i;
+    h.bytes[1] = (uint8_t)(i >> 8);
+    h.bytes[31] = 1;
+    const uint8_t *b = jumpdest_cache_get(&cache, &h);
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)i, *b);
+  }
+}
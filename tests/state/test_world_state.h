@@ -43,6 +43,9 @@ void test_world_state_begin_transaction(void);
 // Original storage tests (EIP-2200)
 void test_world_state_get_original_storage(void);
 void test_world_state_original_storage_unset_slot(void);
+void test_world_state_storage_access_fused(void);
+void test_world_state_set_storage_does_not_warm(void);
+void test_world_state_account_access_fused(void);
 
 // Multi-account isolation tests
 void test_world_state_multi_account_storage_isolation(void);
@@ -64,5 +67,9 @@ void test_world_state_snapshot_single_account(void);
 void test_world_state_snapshot_with_storage(void);
 void test_world_state_snapshot_multiple_accounts(void);
 void test_world_state_snapshot_with_code(void);
+void test_world_state_revert_to_snapshot(void);
+void test_world_state_nested_snapshots(void);
+void test_world_state_stats(void);
+void test_world_state_jumpdest_cache(void);
 
 #endif // TEST_WORLD_STATE_H
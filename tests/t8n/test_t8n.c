@@ -1,8 +1,12 @@
 #include "test_t8n.h"
 
+#include "div0/ethereum/transaction/rlp.h"
 #include "div0/mem/arena.h"
+#include "div0/rlp/encode.h"
 #include "div0/t8n/alloc.h"
+#include "div0/t8n/alloc_bin.h"
 #include "div0/t8n/env.h"
+#include "div0/t8n/result.h"
 #include "div0/t8n/txs.h"
 
 #include <stdlib.h>
@@ -138,6 +142,227 @@ void test_alloc_roundtrip(void) {
   div0_arena_destroy(&arena);
 }
 
+void test_alloc_bin_roundtrip(void) {
+  // Unsorted accounts sharing one code, unsorted storage
+  const char *json = "{"
+                     "  \"0xbb00000000000000000000000000000000000000\": {"
+                     "    \"balance\": \"0x2\", \"code\": \"0x6001600055\","
+                     "    \"storage\": {\"0x02\": \"0x20\", \"0x01\": \"0x10\"}"
+                     "  },"
+                     "  \"0xaa00000000000000000000000000000000000000\": {"
+                     "    \"balance\": \"0x1\", \"nonce\": \"0x7\", \"code\": \"0x6001600055\""
+                     "  },"
+                     "  \"0xcc00000000000000000000000000000000000000\": {\"balance\": \"0x3\"}"
+                     "}";
+  div0_arena_t arena;
+  TEST_ASSERT_TRUE(div0_arena_init(&arena));
+
+  state_snapshot_t snapshot;
+  TEST_ASSERT_TRUE(json_is_ok(t8n_parse_alloc(json, strlen(json), &arena, &snapshot)));
+
+  bytes_t encoded;
+  TEST_ASSERT_TRUE(json_is_ok(t8n_alloc_bin_encode(&snapshot, &arena, &encoded)));
+
+  state_snapshot_t decoded;
+  TEST_ASSERT_TRUE(json_is_ok(t8n_parse_alloc_bin(encoded.data, encoded.size, &arena, &decoded)));
+  TEST_ASSERT_EQUAL(3, decoded.account_count);
+
+  // Accounts come back sorted by address
+  TEST_ASSERT_EQUAL_UINT8(0xaa, decoded.accounts[0].address.bytes[0]);
+  TEST_ASSERT_EQUAL_UINT8(0xbb, decoded.accounts[1].address.bytes[0]);
+  TEST_ASSERT_EQUAL_UINT8(0xcc, decoded.accounts[2].address.bytes[0]);
+  TEST_ASSERT_EQUAL_UINT64(1, decoded.accounts[0].balance.limbs[0]);
+  TEST_ASSERT_EQUAL_UINT64(7, decoded.accounts[0].nonce);
+
+  // Identical code is stored once and shared
+  TEST_ASSERT_EQUAL(5, decoded.accounts[0].code.size);
+  TEST_ASSERT_EQUAL_PTR(decoded.accounts[0].code.data, decoded.accounts[1].code.data);
+  TEST_ASSERT_EQUAL_UINT8(0x60, decoded.accounts[0].code.data[0]);
+  TEST_ASSERT_EQUAL(0, decoded.accounts[2].code.size);
+
+  // Storage sorted by slot, viewed in place
+  TEST_ASSERT_EQUAL(2, decoded.accounts[1].storage_count);
+  TEST_ASSERT_EQUAL_UINT64(1, decoded.accounts[1].storage[0].slot.limbs[0]);
+  TEST_ASSERT_EQUAL_UINT64(0x10, decoded.accounts[1].storage[0].value.limbs[0]);
+  TEST_ASSERT_EQUAL_UINT64(2, decoded.accounts[1].storage[1].slot.limbs[0]);
+  TEST_ASSERT_TRUE((uint8_t *)decoded.accounts[1].storage > encoded.data);
+  TEST_ASSERT_TRUE((uint8_t *)decoded.accounts[1].storage < encoded.data + encoded.size);
+
+  // Truncated or corrupted input is rejected
+  TEST_ASSERT_FALSE(
+      json_is_ok(t8n_parse_alloc_bin(encoded.data, encoded.size - 1, &arena, &decoded)));
+  encoded.data[0] = 'X';
+  TEST_ASSERT_FALSE(json_is_ok(t8n_parse_alloc_bin(encoded.data, encoded.size, &arena, &decoded)));
+
+  div0_arena_destroy(&arena);
+}
+
+/// Stream a document into a temporary file and return its contents.
+static char *stream_to_string(void (*fn)(const void *, json_stream_t *), const void *const value,
+                              const json_write_flags_t flags, size_t *const out_len) {
+  FILE *const fp = tmpfile();
+  TEST_ASSERT_NOT_NULL(fp);
+  json_stream_t s;
+  TEST_ASSERT_TRUE(json_is_ok(json_stream_init(&s, fp, flags)));
+  fn(value, &s);
+  TEST_ASSERT_TRUE(json_is_ok(json_stream_finish(&s)));
+
+  const long len = ftell(fp);
+  TEST_ASSERT_TRUE(len >= 0);
+  char *const out = malloc((size_t)len + 1);
+  TEST_ASSERT_NOT_NULL(out);
+  rewind(fp);
+  TEST_ASSERT_EQUAL((size_t)len, fread(out, 1, (size_t)len, fp));
+  out[len] = '\0';
+  (void)fclose(fp);
+  *out_len = (size_t)len;
+  return out;
+}
+
+static void stream_alloc(const void *const value, json_stream_t *const s) {
+  t8n_stream_alloc(value, s);
+}
+
+static void stream_result(const void *const value, json_stream_t *const s) {
+  t8n_stream_result(value, s);
+}
+
+void test_alloc_stream_matches_dom(void) {
+  // Code, nonce, storage with a zero value, and all-zero storage
+  const char *json = "{"
+                     "  \"0xaa00000000000000000000000000000000000000\": {"
+                     "    \"balance\": \"0x1\", \"nonce\": \"0x7\", \"code\": \"0x6001600055\","
+                     "    \"storage\": {\"0x01\": \"0x10\", \"0x02\": \"0x00\"}"
+                     "  },"
+                     "  \"0xbb00000000000000000000000000000000000000\": {"
+                     "    \"balance\": \"0x0\", \"storage\": {\"0x05\": \"0x0\"}"
+                     "  },"
+                     "  \"0xcc00000000000000000000000000000000000000\": {\"balance\": \"0x3\"}"
+                     "}";
+  div0_arena_t arena;
+  TEST_ASSERT_TRUE(div0_arena_init(&arena));
+
+  state_snapshot_t snapshot;
+  TEST_ASSERT_TRUE(json_is_ok(t8n_parse_alloc(json, strlen(json), &arena, &snapshot)));
+
+  const json_write_flags_t modes[] = {JSON_WRITE_COMPACT, JSON_WRITE_PRETTY};
+  for (size_t i = 0; i < 2; i++) {
+    json_writer_t w;
+    TEST_ASSERT_TRUE(json_is_ok(json_writer_init(&w)));
+    size_t dom_len;
+    char *const dom = json_write_string(&w, t8n_write_alloc(&snapshot, &w), modes[i], &dom_len);
+    TEST_ASSERT_NOT_NULL(dom);
+
+    size_t stream_len;
+    char *const streamed = stream_to_string(stream_alloc, &snapshot, modes[i], &stream_len);
+    TEST_ASSERT_EQUAL(dom_len, stream_len);
+    TEST_ASSERT_EQUAL_STRING(dom, streamed);
+
+    free(streamed);
+    free(dom);
+    json_writer_free(&w);
+  }
+
+  div0_arena_destroy(&arena);
+}
+
+void test_result_stream_matches_dom(void) {
+  hash_t topics[2] = {};
+  topics[0].bytes[31] = 0x01;
+  topics[1].bytes[0] = 0xff;
+  uint8_t data[3] = {0xde, 0xad, 0x00};
+  t8n_log_t logs[2] = {
+      {.topics = topics, .topic_count = 2, .data = {.data = data, .size = 3}},
+      {.topic_count = 0},
+  };
+  logs[0].address.bytes[19] = 0x42;
+
+  address_t created = {};
+  created.bytes[0] = 0x99;
+  t8n_receipt_t receipts[2] = {
+      {.type = 2, .gas_used = 21000, .cumulative_gas = 21000, .status = true},
+      {.transaction_index = 1, .gas_used = 53000, .cumulative_gas = 74000,
+       .logs = logs, .log_count = 2, .contract_address = &created},
+  };
+  receipts[1].bloom[7] = 0x80;
+
+  t8n_rejected_tx_t rejected[1] = {{.index = 2, .error = "nonce too low: \"3\"\n"}};
+  t8n_result_t result = {
+      .gas_used = 74000,
+      .has_blob_gas_used = true,
+      .receipts = receipts,
+      .receipt_count = 2,
+      .rejected = rejected,
+      .rejected_count = 1,
+      .has_current_base_fee = true,
+      .current_base_fee = uint256_from_u64(7),
+  };
+  result.state_root.bytes[0] = 0xab;
+
+  const json_write_flags_t modes[] = {JSON_WRITE_COMPACT, JSON_WRITE_PRETTY};
+  for (size_t i = 0; i < 2; i++) {
+    json_writer_t w;
+    TEST_ASSERT_TRUE(json_is_ok(json_writer_init(&w)));
+    size_t dom_len;
+    char *const dom = json_write_string(&w, t8n_write_result(&result, &w), modes[i], &dom_len);
+    TEST_ASSERT_NOT_NULL(dom);
+
+    size_t stream_len;
+    char *const streamed = stream_to_string(stream_result, &result, modes[i], &stream_len);
+    TEST_ASSERT_EQUAL(dom_len, stream_len);
+    TEST_ASSERT_EQUAL_STRING(dom, streamed);
+
+    free(streamed);
+    free(dom);
+    json_writer_free(&w);
+  }
+}
+
+void test_alloc_read_matches_parse(void) {
+  // Storage holds a zero value, which both parsers drop
+  const char *json = "{"
+                     "  \"0x1234567890123456789012345678901234567890\": {"
+                     "    \"storage\": {\"0x01\": \"0x02\", \"0x03\": \"0x00\"},"
+                     "    \"code\": \"0x6080604052\","
+                     "    \"unknown\": [1, {\"x\": null}],"
+                     "    \"nonce\": \"0x5\","
+                     "    \"balance\": \"0x100\""
+                     "  },"
+                     "  \"0x0000000000000000000000000000000000000001\": {\"balance\": \"0x0\"}"
+                     "}";
+  div0_arena_t arena;
+  TEST_ASSERT_TRUE(div0_arena_init(&arena));
+
+  state_snapshot_t parsed;
+  TEST_ASSERT_TRUE(json_is_ok(t8n_parse_alloc(json, strlen(json), &arena, &parsed)));
+
+  state_snapshot_t read;
+  json_reader_t r;
+  json_reader_init(&r, json, strlen(json));
+  TEST_ASSERT_TRUE(json_is_ok(t8n_read_alloc(&r, &arena, &read)));
+  TEST_ASSERT_TRUE(json_is_ok(json_reader_finish(&r)));
+
+  TEST_ASSERT_EQUAL(parsed.account_count, read.account_count);
+  for (size_t i = 0; i < read.account_count; i++) {
+    const account_snapshot_t *const a = &parsed.accounts[i];
+    const account_snapshot_t *const b = &read.accounts[i];
+    TEST_ASSERT_EQUAL_MEMORY(a->address.bytes, b->address.bytes, ADDRESS_SIZE);
+    TEST_ASSERT_TRUE(uint256_eq(a->balance, b->balance));
+    TEST_ASSERT_EQUAL_UINT64(a->nonce, b->nonce);
+    TEST_ASSERT_EQUAL(a->code.size, b->code.size);
+    TEST_ASSERT_EQUAL_MEMORY(a->code.data, b->code.data, a->code.size);
+    TEST_ASSERT_EQUAL(a->storage_count, b->storage_count);
+  }
+  TEST_ASSERT_EQUAL(1, read.accounts[0].storage_count);
+
+  // A non-object account is a type error
+  const char *bad = "{\"0x1234567890123456789012345678901234567890\": \"0x1\"}";
+  json_reader_init(&r, bad, strlen(bad));
+  TEST_ASSERT_EQUAL(JSON_ERR_INVALID_TYPE, t8n_read_alloc(&r, &arena, &read).error);
+
+  div0_arena_destroy(&arena);
+}
+
 // ============================================================================
 // Env Parsing Tests
 // ============================================================================
@@ -244,6 +469,52 @@ void test_env_parse_withdrawals(void) {
   div0_arena_destroy(&arena);
 }
 
+void test_env_read_single_pass(void) {
+  // Keys in a different order than the DOM parser looks them up
+  const char *json = "{"
+                     "  \"withdrawals\": [{\"amount\": \"0x100\", \"index\": \"0x0\","
+                     "    \"validatorIndex\": \"0x1\","
+                     "    \"address\": \"0x1234567890123456789012345678901234567890\"}],"
+                     "  \"blockHashes\": {\"0x0f\": "
+                     "\"0x0000000000000000000000000000000000000000000000000000000000001234\"},"
+                     "  \"currentTimestamp\": \"0x5f5e100\","
+                     "  \"currentBaseFee\": \"0x3b9aca00\","
+                     "  \"currentNumber\": \"0x10\","
+                     "  \"currentGasLimit\": \"0x1000000\","
+                     "  \"currentCoinbase\": \"0x1234567890123456789012345678901234567890\""
+                     "}";
+  div0_arena_t arena;
+  TEST_ASSERT_TRUE(div0_arena_init(&arena));
+
+  t8n_env_t env;
+  t8n_env_init(&env);
+  json_reader_t r;
+  json_reader_init(&r, json, strlen(json));
+  json_result_t result = t8n_read_env(&r, &arena, &env);
+
+  TEST_ASSERT_TRUE(json_is_ok(result));
+  TEST_ASSERT_EQUAL_UINT8(0x12, env.coinbase.bytes[0]);
+  TEST_ASSERT_EQUAL_UINT64(0x1000000, env.gas_limit);
+  TEST_ASSERT_EQUAL_UINT64(0x10, env.number);
+  TEST_ASSERT_EQUAL_UINT64(0x5f5e100, env.timestamp);
+  TEST_ASSERT_TRUE(env.has_base_fee);
+  TEST_ASSERT_EQUAL_UINT64(0x3b9aca00, env.base_fee.limbs[0]);
+  TEST_ASSERT_EQUAL(1, env.block_hash_count);
+  TEST_ASSERT_EQUAL_UINT64(0x0f, env.block_hashes[0].number);
+  TEST_ASSERT_EQUAL_UINT8(0x34, env.block_hashes[0].hash.bytes[31]);
+  TEST_ASSERT_EQUAL(1, env.withdrawal_count);
+  TEST_ASSERT_EQUAL_UINT64(1, env.withdrawals[0].validator_index);
+  TEST_ASSERT_EQUAL_UINT64(0x100, env.withdrawals[0].amount);
+
+  // Required fields are still enforced
+  const char *missing = "{\"currentGasLimit\": \"0x1\"}";
+  t8n_env_init(&env);
+  json_reader_init(&r, missing, strlen(missing));
+  TEST_ASSERT_EQUAL(JSON_ERR_MISSING_FIELD, t8n_read_env(&r, &arena, &env).error);
+
+  div0_arena_destroy(&arena);
+}
+
 // ============================================================================
 // Txs Parsing Tests
 // ============================================================================
@@ -326,3 +597,104 @@ void test_txs_parse_eip1559(void) {
 
   div0_arena_destroy(&arena);
 }
+
+void test_txs_read_single_pass(void) {
+  // The type comes after the fields it decides about
+  const char *json = "["
+                     "  {"
+                     "    \"accessList\": [{\"address\": "
+                     "\"0x1234567890123456789012345678901234567890\", \"storageKeys\": ["
+                     "\"0x0000000000000000000000000000000000000000000000000000000000000001\"]}],"
+                     "    \"input\": \"0x6001\","
+                     "    \"gasLimit\": \"0x1\","
+                     "    \"gas\": \"0x5208\","
+                     "    \"to\": \"0x1234567890123456789012345678901234567890\","
+                     "    \"v\": \"0x1\","
+                     "    \"chainId\": \"0x1\","
+                     "    \"type\": \"0x2\""
+                     "  },"
+                     "  {\"type\": \"0x0\", \"to\": null, \"data\": \"0x60\", \"v\": \"0x1b\"}"
+                     "]";
+  div0_arena_t arena;
+  TEST_ASSERT_TRUE(div0_arena_init(&arena));
+
+  t8n_txs_t txs;
+  json_reader_t r;
+  json_reader_init(&r, json, strlen(json));
+  json_result_t result = t8n_read_txs(&r, &arena, &txs);
+
+  TEST_ASSERT_TRUE(json_is_ok(result));
+  TEST_ASSERT_EQUAL(2, txs.tx_count);
+
+  const eip1559_tx_t *const tx = &txs.txs[0].eip1559;
+  TEST_ASSERT_EQUAL(TX_TYPE_EIP1559, txs.txs[0].type);
+  TEST_ASSERT_EQUAL_UINT64(1, tx->chain_id);
+  TEST_ASSERT_EQUAL_UINT64(0x5208, tx->gas_limit);
+  TEST_ASSERT_NOT_NULL(tx->to);
+  TEST_ASSERT_EQUAL(2, tx->data.size);
+  TEST_ASSERT_EQUAL_UINT8(1, tx->y_parity);
+  TEST_ASSERT_EQUAL(1, tx->access_list.count);
+  TEST_ASSERT_EQUAL(1, tx->access_list.entries[0].storage_keys_count);
+
+  TEST_ASSERT_EQUAL(TX_TYPE_LEGACY, txs.txs[1].type);
+  TEST_ASSERT_NULL(txs.txs[1].legacy.to);
+  TEST_ASSERT_EQUAL(1, txs.txs[1].legacy.data.size);
+  TEST_ASSERT_EQUAL_UINT64(0x1b, txs.txs[1].legacy.v);
+
+  const char *blob = "[{\"type\": \"0x3\"}]";
+  json_reader_init(&r, blob, strlen(blob));
+  TEST_ASSERT_EQUAL(JSON_ERR_MISSING_FIELD, t8n_read_txs(&r, &arena, &txs).error);
+
+  div0_arena_destroy(&arena);
+}
+
+void test_txs_parse_rlp(void) {
+  div0_arena_t arena;
+  TEST_ASSERT_TRUE(div0_arena_init(&arena));
+
+  transaction_t legacy;
+  transaction_init(&legacy);
+  legacy.legacy.nonce = 7;
+  legacy.legacy.gas_limit = 21000;
+  legacy.legacy.v = 27;
+  transaction_t typed;
+  typed.type = TX_TYPE_EIP1559;
+  eip1559_tx_init(&typed.eip1559);
+  transaction_clear_cache(&typed);
+  typed.eip1559.chain_id = 1;
+  typed.eip1559.to = div0_arena_alloc(&arena, sizeof(address_t));
+  __builtin___memset_chk(typed.eip1559.to->bytes, 0xAB, ADDRESS_SIZE, ADDRESS_SIZE);
+  static const uint8_t calldata[] = {0x60, 0x00};
+  bytes_init_arena(&typed.eip1559.data, &arena);
+  TEST_ASSERT_TRUE(bytes_from_data(&typed.eip1559.data, calldata, sizeof(calldata)));
+
+  // Block body encoding: legacy as a list, typed as a byte string
+  const bytes_t legacy_rlp = transaction_encode(&legacy, &arena);
+  const bytes_t typed_raw = transaction_encode(&typed, &arena);
+  const bytes_t typed_rlp = rlp_encode_bytes(&arena, typed_raw.data, typed_raw.size);
+  bytes_t list;
+  bytes_init(&list);
+  rlp_list_builder_t builder;
+  rlp_list_start(&builder, &list);
+  rlp_list_append(&list, &legacy_rlp);
+  rlp_list_append(&list, &typed_rlp);
+  rlp_list_end(&builder);
+
+  t8n_txs_t txs;
+  json_result_t result = t8n_parse_txs_rlp(list.data, list.size, &arena, &txs);
+  TEST_ASSERT_TRUE(json_is_ok(result));
+  TEST_ASSERT_EQUAL(2, txs.tx_count);
+  TEST_ASSERT_EQUAL(TX_TYPE_LEGACY, txs.txs[0].type);
+  TEST_ASSERT_EQUAL_UINT64(7, txs.txs[0].legacy.nonce);
+  TEST_ASSERT_EQUAL(legacy_rlp.size, txs.txs[0].encoded_size);
+  TEST_ASSERT_EQUAL(TX_TYPE_EIP1559, txs.txs[1].type);
+  TEST_ASSERT_EQUAL(typed_raw.size, txs.txs[1].encoded_size);
+  TEST_ASSERT_EQUAL_MEMORY(typed_raw.data, txs.txs[1].encoded, typed_raw.size);
+  TEST_ASSERT_EQUAL(2, txs.txs[1].eip1559.data.size);
+
+  // A truncated list is rejected
+  TEST_ASSERT_FALSE(json_is_ok(t8n_parse_txs_rlp(list.data, list.size - 1, &arena, &txs)));
+
+  bytes_free(&list);
+  div0_arena_destroy(&arena);
+}
@@ -7,16 +7,23 @@ void test_alloc_parse_single_account(void);
 void test_alloc_parse_with_storage(void);
 void test_alloc_parse_with_code(void);
 void test_alloc_roundtrip(void);
+void test_alloc_bin_roundtrip(void);
+void test_alloc_stream_matches_dom(void);
+void test_result_stream_matches_dom(void);
+void test_alloc_read_matches_parse(void);
 
 // Env parsing tests
 void test_env_parse_required_fields(void);
 void test_env_parse_optional_fields(void);
 void test_env_parse_block_hashes(void);
 void test_env_parse_withdrawals(void);
+void test_env_read_single_pass(void);
 
 // Txs parsing tests
 void test_txs_parse_legacy(void);
 void test_txs_parse_eip1559(void);
 void test_txs_parse_empty_array(void);
+void test_txs_read_single_pass(void);
+void test_txs_parse_rlp(void);
 
 #endif // TEST_T8N_H
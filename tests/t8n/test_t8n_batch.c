@@ -0,0 +1,226 @@
+#include "test_t8n_batch.h"
+
+#include "cli/exit_codes.h"
+#include "cli/t8n/t8n_batch.h"
+
+#include "unity.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static constexpr size_t TEST_PATH_LEN = 512;
+
+static const char *const TEST_ENV =
+    "{"
+    "  \"currentCoinbase\": \"0x0000000000000000000000000000000000000000\","
+    "  \"currentGasLimit\": \"0x1000000\","
+    "  \"currentNumber\": \"0x1\","
+    "  \"currentTimestamp\": \"0x1000\""
+    "}";
+
+// Helper: create a scratch directory under /tmp
+static void make_scratch(char *root) {
+  strcpy(root, "/tmp/div0-t8n-batch-XXXXXX");
+  TEST_ASSERT_NOT_NULL(mkdtemp(root));
+}
+
+// Helper: delete a scratch directory and everything under it
+static void remove_tree(const char *path) {
+  DIR *const d = opendir(path);
+  if (d != nullptr) {
+    const struct dirent *entry;
+    while ((entry = readdir(d)) != nullptr) {
+      if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+        continue;
+      }
+      char child[TEST_PATH_LEN];
+      (void)snprintf(child, sizeof(child), "%s/%s", path, entry->d_name);
+      remove_tree(child);
+    }
+    closedir(d);
+  }
+  TEST_ASSERT_EQUAL(0, remove(path));
+}
+
+static void make_dir(const char *path) {
+  TEST_ASSERT_EQUAL(0, mkdir(path, 0755));
+}
+
+static void write_file(const char *dir, const char *name, const char *contents) {
+  char path[TEST_PATH_LEN];
+  (void)snprintf(path, sizeof(path), "%s/%s", dir, name);
+  FILE *const fp = fopen(path, "w");
+  TEST_ASSERT_NOT_NULL(fp);
+  TEST_ASSERT_EQUAL(strlen(contents), fwrite(contents, 1, strlen(contents), fp));
+  TEST_ASSERT_EQUAL(0, fclose(fp));
+}
+
+// Helper: fixture directory whose pre-state holds one funded account
+static void write_fixture(const char *dir, const char *address) {
+  char alloc[TEST_PATH_LEN];
+  (void)snprintf(alloc, sizeof(alloc), "{\"%s\": {\"balance\": \"0x100\"}}", address);
+  make_dir(dir);
+  write_file(dir, "alloc.json", alloc);
+  write_file(dir, "env.json", TEST_ENV);
+  write_file(dir, "txs.json", "[]");
+}
+
+// Helper: read a whole file, nullptr if it does not exist
+static char *read_file(const char *dir, const char *name) {
+  char path[TEST_PATH_LEN];
+  (void)snprintf(path, sizeof(path), "%s/%s", dir, name);
+  FILE *const fp = fopen(path, "r");
+  if (fp == nullptr) {
+    return nullptr;
+  }
+  TEST_ASSERT_EQUAL(0, fseek(fp, 0, SEEK_END));
+  const long len = ftell(fp);
+  TEST_ASSERT_TRUE(len >= 0);
+  rewind(fp);
+  char *const out = malloc((size_t)len + 1);
+  TEST_ASSERT_NOT_NULL(out);
+  TEST_ASSERT_EQUAL((size_t)len, fread(out, 1, (size_t)len, fp));
+  out[len] = '\0';
+  fclose(fp);
+  return out;
+}
+
+// Helper: assert a fixture's output directory holds its result and post-state
+static void assert_fixture_output(const char *out, const char *name, const char *address) {
+  char dir[TEST_PATH_LEN];
+  (void)snprintf(dir, sizeof(dir), "%s/%s", out, name);
+
+  char *const result = read_file(dir, "result.json");
+  TEST_ASSERT_NOT_NULL_MESSAGE(result, dir);
+  TEST_ASSERT_NOT_NULL(strstr(result, "stateRoot"));
+  free(result);
+
+  char *const alloc = read_file(dir, "alloc.json");
+  TEST_ASSERT_NOT_NULL_MESSAGE(alloc, dir);
+  TEST_ASSERT_NOT_NULL_MESSAGE(strstr(alloc, address), dir);
+  free(alloc);
+}
+
+// Helper: output directory name the batch derives from a manifest line
+static void manifest_name(char *name, const char *path) {
+  strcpy(name, path);
+  for (char *c = name; *c != '\0'; c++) {
+    if (*c == '/') {
+      *c = '_';
+    }
+  }
+}
+
+static int run_batch(const char *input, const char *output) {
+  const char *argv[] = {
+      "t8n-batch", "--quiet", "--input", input, "--output.basedir", output, "-j", "2", nullptr,
+  };
+  return cmd_t8n_batch((int)(sizeof(argv) / sizeof(argv[0])) - 1, argv);
+}
+
+static const char *const ADDRESS_A = "0x0000000000000000000000000000000000001111";
+static const char *const ADDRESS_B = "0x0000000000000000000000000000000000002222";
+
+void test_t8n_batch_manifest_outputs(void) {
+  char root[TEST_PATH_LEN];
+  make_scratch(root);
+  char fixtures[TEST_PATH_LEN];
+  char nested[TEST_PATH_LEN];
+  char flat[TEST_PATH_LEN];
+  char out[TEST_PATH_LEN];
+  (void)snprintf(fixtures, sizeof(fixtures), "%s/fixtures", root);
+  (void)snprintf(nested, sizeof(nested), "%s/nested", fixtures);
+  (void)snprintf(out, sizeof(out), "%s/out", root);
+  make_dir(fixtures);
+  make_dir(nested);
+  (void)snprintf(flat, sizeof(flat), "%s/a", nested);
+  write_fixture(flat, ADDRESS_A);
+  (void)snprintf(flat, sizeof(flat), "%s/b", fixtures);
+  write_fixture(flat, ADDRESS_B);
+
+  // Comments, blank lines and trailing separators are ignored
+  char manifest[3 * TEST_PATH_LEN];
+  (void)snprintf(manifest, sizeof(manifest), "# fixtures\n\n%s/a/\n  %s/b\n", nested, fixtures);
+  write_file(root, "manifest.txt", manifest);
+  char manifest_path[TEST_PATH_LEN];
+  (void)snprintf(manifest_path, sizeof(manifest_path), "%s/manifest.txt", root);
+
+  TEST_ASSERT_EQUAL(DIV0_EXIT_SUCCESS, run_batch(manifest_path, out));
+
+  char path[TEST_PATH_LEN];
+  char name[TEST_PATH_LEN];
+  (void)snprintf(path, sizeof(path), "%s/a", nested);
+  manifest_name(name, path);
+  assert_fixture_output(out, name, ADDRESS_A);
+  (void)snprintf(path, sizeof(path), "%s/b", fixtures);
+  manifest_name(name, path);
+  assert_fixture_output(out, name, ADDRESS_B);
+
+  remove_tree(root);
+}
+
+void test_t8n_batch_manifest_name_collision(void) {
+  char root[TEST_PATH_LEN];
+  make_scratch(root);
+  char fixtures[TEST_PATH_LEN];
+  char path[TEST_PATH_LEN];
+  char out[TEST_PATH_LEN];
+  (void)snprintf(fixtures, sizeof(fixtures), "%s/fixtures", root);
+  (void)snprintf(out, sizeof(out), "%s/out", root);
+  make_dir(fixtures);
+  (void)snprintf(path, sizeof(path), "%s/a", fixtures);
+  make_dir(path);
+  (void)snprintf(path, sizeof(path), "%s/a/b", fixtures);
+  write_fixture(path, ADDRESS_A);
+  (void)snprintf(path, sizeof(path), "%s/a_b", fixtures);
+  write_fixture(path, ADDRESS_B);
+
+  // "a/b" and "a_b" flatten to the same output directory
+  char manifest[3 * TEST_PATH_LEN];
+  (void)snprintf(manifest, sizeof(manifest), "%s/a/b\n%s/a_b\n", fixtures, fixtures);
+  write_file(root, "manifest.txt", manifest);
+  char manifest_path[TEST_PATH_LEN];
+  (void)snprintf(manifest_path, sizeof(manifest_path), "%s/manifest.txt", root);
+
+  TEST_ASSERT_EQUAL(DIV0_EXIT_CONFIG_ERROR, run_batch(manifest_path, out));
+
+  // Rejected before anything ran
+  struct stat st;
+  TEST_ASSERT_NOT_EQUAL(0, stat(out, &st));
+
+  remove_tree(root);
+}
+
+void test_t8n_batch_directory_outputs(void) {
+  char root[TEST_PATH_LEN];
+  make_scratch(root);
+  char fixtures[TEST_PATH_LEN];
+  char path[TEST_PATH_LEN];
+  char out[TEST_PATH_LEN];
+  (void)snprintf(fixtures, sizeof(fixtures), "%s/fixtures", root);
+  (void)snprintf(out, sizeof(out), "%s/out", root);
+  make_dir(fixtures);
+  (void)snprintf(path, sizeof(path), "%s/first", fixtures);
+  write_fixture(path, ADDRESS_A);
+  (void)snprintf(path, sizeof(path), "%s/second", fixtures);
+  write_fixture(path, ADDRESS_B);
+
+  // Subdirectories without alloc.json and plain files are not fixtures
+  (void)snprintf(path, sizeof(path), "%s/notes", fixtures);
+  make_dir(path);
+  write_file(path, "readme.txt", "not a fixture");
+  write_file(fixtures, "index.txt", "not a fixture");
+
+  TEST_ASSERT_EQUAL(DIV0_EXIT_SUCCESS, run_batch(fixtures, out));
+
+  assert_fixture_output(out, "first", ADDRESS_A);
+  assert_fixture_output(out, "second", ADDRESS_B);
+  struct stat st;
+  (void)snprintf(path, sizeof(path), "%s/notes", out);
+  TEST_ASSERT_NOT_EQUAL(0, stat(path, &st));
+
+  remove_tree(root);
+}
@@ -0,0 +1,8 @@
+#ifndef TEST_T8N_BATCH_H
+#define TEST_T8N_BATCH_H
+
+void test_t8n_batch_manifest_outputs(void);
+void test_t8n_batch_manifest_name_collision(void);
+void test_t8n_batch_directory_outputs(void);
+
+#endif // TEST_T8N_BATCH_H
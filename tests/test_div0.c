@@ -23,10 +23,14 @@
 #include "evm/test_opcodes_context.h"
 #include "evm/test_opcodes_logging.h"
 #include "evm/test_opcodes_stack.h"
+#include "evm/test_precompiles.h"
 #include "evm/test_stack.h"
 #include "evm/test_stack_pool.h"
+#include "evm/test_tracer.h"
+#include "evm/test_transient_storage.h"
 
 // Test headers - crypto
+#include "crypto/test_bn254.h"
 #include "crypto/test_keccak256.h"
 #include "crypto/test_secp256k1.h"
 
@@ -38,9 +42,11 @@
 #include "trie/test_mpt.h"
 #include "trie/test_nibbles.h"
 #include "trie/test_node.h"
+#include "trie/test_proof.h"
 
 // Test headers - state
 #include "state/test_account.h"
+#include "state/test_witness.h"
 #include "state/test_world_state.h"
 
 // Test headers - ethereum
@@ -51,8 +57,12 @@
 
 // Test headers - JSON and t8n (hosted only)
 #ifndef DIV0_FREESTANDING
+#include "evm/test_json_tracer.h"
+#include "evm/test_profiler.h"
 #include "json/test_json.h"
+#include "mem/test_huge_pages.h"
 #include "t8n/test_t8n.h"
+#include "t8n/test_t8n_batch.h"
 #endif
 
 // Global arena for tests (shared across test files)
@@ -226,6 +236,12 @@ int main(void) {
   RUN_TEST(test_arena_alloc_large_alignment);
   RUN_TEST(test_arena_alloc_large_freed_on_reset);
   RUN_TEST(test_arena_alloc_large_multiple);
+  RUN_TEST(test_arena_mark_rewind);
+  RUN_TEST(test_arena_rewind_across_blocks);
+  RUN_TEST(test_arena_rewind_frees_large_blocks);
+  RUN_TEST(test_arena_rewind_nested);
+  RUN_TEST(test_arena_init_with_block_size);
+  RUN_TEST(test_arena_custom_provider);
 
   // hex utility tests
   RUN_TEST(test_hex_char_to_nibble_digits);
@@ -240,6 +256,9 @@ int main(void) {
   RUN_TEST(test_hex_decode_null_output);
   RUN_TEST(test_hex_decode_wrong_length);
   RUN_TEST(test_hex_decode_invalid_char);
+  RUN_TEST(test_hex_roundtrip_block_lengths);
+  RUN_TEST(test_hex_decode_invalid_char_any_position);
+  RUN_TEST(test_hex_decode_uint256_limbs);
 
   // stack tests
   RUN_TEST(test_stack_init_is_empty);
@@ -258,6 +277,29 @@ int main(void) {
   RUN_TEST(test_stack_pool_borrow);
   RUN_TEST(test_stack_pool_multiple_borrows);
 
+  // Transient storage tests
+  RUN_TEST(test_transient_storage_set_get);
+  RUN_TEST(test_transient_storage_clear);
+  RUN_TEST(test_transient_storage_revert);
+  RUN_TEST(test_transient_storage_grow);
+
+  // Tracer tests
+  RUN_TEST(test_tracer_histogram_counts);
+  RUN_TEST(test_tracer_gas_profiler_attribution);
+  RUN_TEST(test_tracer_does_not_change_result);
+  RUN_TEST(test_tracer_storage_access_hook);
+  RUN_TEST(test_tracer_detached);
+
+  // Precompile tests
+  RUN_TEST(test_precompile_get_by_fork);
+  RUN_TEST(test_precompile_sha256);
+  RUN_TEST(test_precompile_ripemd160);
+  RUN_TEST(test_precompile_identity);
+  RUN_TEST(test_precompile_out_of_gas);
+  RUN_TEST(test_precompile_modexp);
+  RUN_TEST(test_precompile_blake2f);
+  RUN_TEST(test_precompile_blake2f_rejects_bad_length);
+
   // evm tests
   RUN_TEST(test_evm_stop);
   RUN_TEST(test_evm_empty_code);
@@ -281,13 +323,27 @@ int main(void) {
   RUN_TEST(test_evm_call_without_state);
   RUN_TEST(test_evm_sload_empty_slot);
   RUN_TEST(test_evm_sstore_and_sload);
+  RUN_TEST(test_evm_state_unavailable_aborts);
   RUN_TEST(test_evm_sstore_multiple_slots);
   RUN_TEST(test_evm_sload_gas_cold);
   RUN_TEST(test_evm_sload_gas_warm);
   RUN_TEST(test_evm_sstore_without_state);
+  RUN_TEST(test_evm_create_deploys_code);
+  RUN_TEST(test_evm_create_failure_reverts_state);
+  RUN_TEST(test_evm_call_unimplemented_precompile);
+  RUN_TEST(test_evm_create_clears_return_data);
+  RUN_TEST(test_evm_create2_collision);
+  RUN_TEST(test_evm_tstore_tload);
+  RUN_TEST(test_evm_tstore_invalid_before_cancun);
+  RUN_TEST(test_evm_tstore_reverted_by_subcall);
+  RUN_TEST(test_evm_mcopy);
+  RUN_TEST(test_evm_mcopy_invalid_before_cancun);
+  RUN_TEST(test_evm_mstore_unaffordable_offset);
+  RUN_TEST(test_evm_mapped_memory_reused_zeroed);
   RUN_TEST(test_evm_init_shanghai);
   RUN_TEST(test_evm_init_cancun);
   RUN_TEST(test_evm_init_prague);
+  RUN_TEST(test_evm_fork_gas_tables);
   RUN_TEST(test_evm_gas_refund_initialized);
   RUN_TEST(test_evm_gas_refund_reset);
   RUN_TEST(test_evm_mload_underflow);
@@ -314,6 +370,8 @@ int main(void) {
   RUN_TEST(test_evm_blobhash_valid);
   RUN_TEST(test_evm_blobhash_out_of_bounds);
   RUN_TEST(test_evm_blobhash_no_blobs);
+  RUN_TEST(test_evm_blob_opcodes_invalid_before_cancun);
+  RUN_TEST(test_evm_block_opcode_gas);
 
   // Arithmetic opcode tests
   RUN_TEST(test_opcode_sub_basic);
@@ -499,6 +557,7 @@ int main(void) {
   RUN_TEST(test_opcode_calldatacopy_zero_size);
   RUN_TEST(test_opcode_calldatacopy_zero_pad);
   RUN_TEST(test_opcode_calldatacopy_out_of_bounds);
+  RUN_TEST(test_opcode_calldatacopy_large_unaligned);
   RUN_TEST(test_opcode_calldatacopy_stack_underflow);
 
   // Context opcode tests - CODECOPY
@@ -595,6 +654,16 @@ int main(void) {
   RUN_TEST(test_secp256k1_ecrecover_invalid_v);
   RUN_TEST(test_secp256k1_ecrecover_zero_signature);
   RUN_TEST(test_secp256k1_recover_pubkey_invalid_recovery_id);
+  RUN_TEST(test_secp256k1_secret_to_address);
+  RUN_TEST(test_secp256k1_sign_recover_roundtrip);
+
+  // BN254 tests
+  RUN_TEST(test_bn254_g1_add_doubles_generator);
+  RUN_TEST(test_bn254_g1_mul_matches_add);
+  RUN_TEST(test_bn254_g1_rejects_off_curve);
+  RUN_TEST(test_bn254_pairing_empty_is_true);
+  RUN_TEST(test_bn254_pairing_inverse_pair_is_true);
+  RUN_TEST(test_bn254_pairing_single_pair_is_false);
 
   // RLP encoding tests
   RUN_TEST(test_rlp_encode_empty_string);
@@ -649,6 +718,7 @@ int main(void) {
   RUN_TEST(test_nibbles_from_bytes_empty);
   RUN_TEST(test_nibbles_from_bytes_single);
   RUN_TEST(test_nibbles_from_bytes_multiple);
+  RUN_TEST(test_nibbles_from_bytes_view);
   RUN_TEST(test_nibbles_to_bytes_empty);
   RUN_TEST(test_nibbles_to_bytes_single);
   RUN_TEST(test_nibbles_to_bytes_multiple);
@@ -657,6 +727,8 @@ int main(void) {
   RUN_TEST(test_nibbles_common_prefix_partial);
   RUN_TEST(test_nibbles_common_prefix_full);
   RUN_TEST(test_nibbles_common_prefix_different_lengths);
+  RUN_TEST(test_nibbles_common_prefix_long);
+  RUN_TEST(test_nibbles_common_prefix_unaligned);
   RUN_TEST(test_nibbles_slice_full);
   RUN_TEST(test_nibbles_slice_partial);
   RUN_TEST(test_nibbles_slice_view);
@@ -750,6 +822,22 @@ int main(void) {
   RUN_TEST(test_mpt_delete_collapses_branch);
   RUN_TEST(test_mpt_delete_and_reinsert);
 
+  // Proof tests
+  RUN_TEST(test_proof_inclusion);
+  RUN_TEST(test_proof_exclusion);
+  RUN_TEST(test_proof_empty_trie);
+  RUN_TEST(test_proof_wrong_root);
+  RUN_TEST(test_proof_tampered_node);
+  RUN_TEST(test_proof_missing_node);
+  RUN_TEST(test_proof_all_keys);
+  RUN_TEST(test_multiproof_dedup);
+  RUN_TEST(test_multiproof_mixed);
+  RUN_TEST(test_witness_replay);
+  RUN_TEST(test_witness_load_missing_root);
+  RUN_TEST(test_witness_lookup_unresolved);
+  RUN_TEST(test_witness_shared_subtree);
+  RUN_TEST(test_witness_delete_missing_copies_nothing);
+
   // Account tests
   RUN_TEST(test_account_empty_creation);
   RUN_TEST(test_account_empty_has_correct_defaults);
@@ -786,6 +874,9 @@ int main(void) {
   RUN_TEST(test_world_state_begin_transaction);
   RUN_TEST(test_world_state_get_original_storage);
   RUN_TEST(test_world_state_original_storage_unset_slot);
+  RUN_TEST(test_world_state_storage_access_fused);
+  RUN_TEST(test_world_state_set_storage_does_not_warm);
+  RUN_TEST(test_world_state_account_access_fused);
   RUN_TEST(test_world_state_multi_account_storage_isolation);
   RUN_TEST(test_world_state_multi_account_balance_isolation);
   RUN_TEST(test_world_state_large_balance);
@@ -799,6 +890,17 @@ int main(void) {
   RUN_TEST(test_world_state_snapshot_with_storage);
   RUN_TEST(test_world_state_snapshot_multiple_accounts);
   RUN_TEST(test_world_state_snapshot_with_code);
+  RUN_TEST(test_world_state_revert_to_snapshot);
+  RUN_TEST(test_world_state_nested_snapshots);
+  RUN_TEST(test_world_state_stats);
+  RUN_TEST(test_world_state_jumpdest_cache);
+
+  // Witness tests
+  RUN_TEST(test_witness_encode_decode_roundtrip);
+  RUN_TEST(test_witness_decode_rejects_malformed);
+  RUN_TEST(test_witness_replay_matches_full_state);
+  RUN_TEST(test_witness_records_code);
+  RUN_TEST(test_witness_unrecorded_read_unavailable);
 
   // Transaction tests
   RUN_TEST(test_transaction_type_enum);
@@ -833,6 +935,9 @@ int main(void) {
   RUN_TEST(test_roundtrip_eip2930_tx);
   RUN_TEST(test_roundtrip_constructed_legacy);
   RUN_TEST(test_roundtrip_constructed_eip1559);
+  RUN_TEST(test_decode_view_zero_copy);
+  RUN_TEST(test_signing_hash_from_encoding);
+  RUN_TEST(test_cache_hashes);
 
   // Block executor - intrinsic gas tests
   RUN_TEST(test_intrinsic_gas_simple_transfer);
@@ -856,8 +961,28 @@ int main(void) {
   RUN_TEST(test_block_executor_multiple_txs);
   RUN_TEST(test_block_executor_mixed_valid_rejected);
   RUN_TEST(test_block_executor_nonce_increment_on_failed_execution);
+  RUN_TEST(test_block_executor_jumpdest_cache_across_blocks);
+  RUN_TEST(test_block_executor_rewinds_evm_arena);
 
 #ifndef DIV0_FREESTANDING
+  // Huge page provider tests
+  RUN_TEST(test_huge_pages_reserve_aligned);
+  RUN_TEST(test_huge_pages_arena_blocks_fill_page);
+  RUN_TEST(test_huge_pages_default_block_fills_class);
+  RUN_TEST(test_huge_pages_large_alloc_unmapped_on_reset);
+  RUN_TEST(test_huge_pages_reuse_released_blocks);
+  RUN_TEST(test_huge_pages_reuse_larger_block);
+  RUN_TEST(test_huge_pages_cache_limit_unmaps);
+
+  // EIP-3155 JSON tracer tests
+  RUN_TEST(test_json_tracer_step_lines);
+  RUN_TEST(test_json_tracer_error_summary);
+
+  // Execution profiler tests
+  RUN_TEST(test_profiler_attribution);
+  RUN_TEST(test_profiler_collapsed_gas);
+  RUN_TEST(test_profiler_opcodes_csv);
+
   // JSON core tests
   RUN_TEST(test_json_parse_empty_object);
   RUN_TEST(test_json_parse_nested_object);
@@ -872,6 +997,8 @@ int main(void) {
   RUN_TEST(test_json_write_object);
   RUN_TEST(test_json_write_array);
   RUN_TEST(test_json_write_hex_values);
+  RUN_TEST(test_json_reader_walk);
+  RUN_TEST(test_json_reader_errors);
 
   // Hex encoding tests
   RUN_TEST(test_hex_encode_u64);
@@ -886,17 +1013,29 @@ int main(void) {
   RUN_TEST(test_alloc_parse_with_storage);
   RUN_TEST(test_alloc_parse_with_code);
   RUN_TEST(test_alloc_roundtrip);
+  RUN_TEST(test_alloc_bin_roundtrip);
+  RUN_TEST(test_alloc_stream_matches_dom);
+  RUN_TEST(test_result_stream_matches_dom);
+  RUN_TEST(test_alloc_read_matches_parse);
 
   // Env parsing tests
   RUN_TEST(test_env_parse_required_fields);
   RUN_TEST(test_env_parse_optional_fields);
   RUN_TEST(test_env_parse_block_hashes);
   RUN_TEST(test_env_parse_withdrawals);
+  RUN_TEST(test_env_read_single_pass);
 
   // Txs parsing tests
   RUN_TEST(test_txs_parse_legacy);
   RUN_TEST(test_txs_parse_eip1559);
   RUN_TEST(test_txs_parse_empty_array);
+  RUN_TEST(test_txs_read_single_pass);
+  RUN_TEST(test_txs_parse_rlp);
+
+  // Batch transition tests
+  RUN_TEST(test_t8n_batch_manifest_outputs);
+  RUN_TEST(test_t8n_batch_manifest_name_collision);
+  RUN_TEST(test_t8n_batch_directory_outputs);
 #endif
 
   // Cleanup
@@ -14,7 +14,7 @@ extern div0_arena_t test_arena;
 void test_hex_prefix_encode_odd_extension(void) {
   // [1, 2, 3, 4, 5], leaf=false -> [0x11, 0x23, 0x45]
   uint8_t nibble_data[] = {1, 2, 3, 4, 5};
-  nibbles_t nibbles = {.data = nibble_data, .len = 5};
+  nibbles_t nibbles = nibbles_pack(nibble_data, 5, &test_arena);
 
   bytes_t result = hex_prefix_encode(&nibbles, false, &test_arena);
 
@@ -27,7 +27,7 @@ void test_hex_prefix_encode_odd_extension(void) {
 void test_hex_prefix_encode_even_extension(void) {
   // [0, 1, 2, 3, 4, 5], leaf=false -> [0x00, 0x01, 0x23, 0x45]
   uint8_t nibble_data[] = {0, 1, 2, 3, 4, 5};
-  nibbles_t nibbles = {.data = nibble_data, .len = 6};
+  nibbles_t nibbles = nibbles_pack(nibble_data, 6, &test_arena);
 
   bytes_t result = hex_prefix_encode(&nibbles, false, &test_arena);
 
@@ -41,7 +41,7 @@ void test_hex_prefix_encode_even_extension(void) {
 void test_hex_prefix_encode_odd_leaf(void) {
   // [1, 2, 3, 4, 5], leaf=true -> [0x31, 0x23, 0x45]
   uint8_t nibble_data[] = {1, 2, 3, 4, 5};
-  nibbles_t nibbles = {.data = nibble_data, .len = 5};
+  nibbles_t nibbles = nibbles_pack(nibble_data, 5, &test_arena);
 
   bytes_t result = hex_prefix_encode(&nibbles, true, &test_arena);
 
@@ -54,7 +54,7 @@ void test_hex_prefix_encode_odd_leaf(void) {
 void test_hex_prefix_encode_even_leaf(void) {
   // [0, 1, 2, 3, 4, 5], leaf=true -> [0x20, 0x01, 0x23, 0x45]
   uint8_t nibble_data[] = {0, 1, 2, 3, 4, 5};
-  nibbles_t nibbles = {.data = nibble_data, .len = 6};
+  nibbles_t nibbles = nibbles_pack(nibble_data, 6, &test_arena);
 
   bytes_t result = hex_prefix_encode(&nibbles, true, &test_arena);
 
@@ -78,7 +78,7 @@ void test_hex_prefix_encode_empty(void) {
 void test_hex_prefix_encode_single_nibble(void) {
   // [0x0F], leaf=true -> [0x3F] (odd, leaf, nibble=F)
   uint8_t nibble_data[] = {0x0F};
-  nibbles_t nibbles = {.data = nibble_data, .len = 1};
+  nibbles_t nibbles = nibbles_pack(nibble_data, 1, &test_arena);
 
   bytes_t result = hex_prefix_encode(&nibbles, true, &test_arena);
 
@@ -99,11 +99,11 @@ void test_hex_prefix_decode_odd_extension(void) {
   TEST_ASSERT_TRUE(result.success);
   TEST_ASSERT_FALSE(result.is_leaf);
   TEST_ASSERT_EQUAL_size_t(5, result.nibbles.len);
-  TEST_ASSERT_EQUAL_UINT8(1, result.nibbles.data[0]);
-  TEST_ASSERT_EQUAL_UINT8(2, result.nibbles.data[1]);
-  TEST_ASSERT_EQUAL_UINT8(3, result.nibbles.data[2]);
-  TEST_ASSERT_EQUAL_UINT8(4, result.nibbles.data[3]);
-  TEST_ASSERT_EQUAL_UINT8(5, result.nibbles.data[4]);
+  TEST_ASSERT_EQUAL_UINT8(1, nibbles_get(&result.nibbles, 0));
+  TEST_ASSERT_EQUAL_UINT8(2, nibbles_get(&result.nibbles, 1));
+  TEST_ASSERT_EQUAL_UINT8(3, nibbles_get(&result.nibbles, 2));
+  TEST_ASSERT_EQUAL_UINT8(4, nibbles_get(&result.nibbles, 3));
+  TEST_ASSERT_EQUAL_UINT8(5, nibbles_get(&result.nibbles, 4));
 }
 
 void test_hex_prefix_decode_even_extension(void) {
@@ -115,12 +115,12 @@ void test_hex_prefix_decode_even_extension(void) {
   TEST_ASSERT_TRUE(result.success);
   TEST_ASSERT_FALSE(result.is_leaf);
   TEST_ASSERT_EQUAL_size_t(6, result.nibbles.len);
-  TEST_ASSERT_EQUAL_UINT8(0, result.nibbles.data[0]);
-  TEST_ASSERT_EQUAL_UINT8(1, result.nibbles.data[1]);
-  TEST_ASSERT_EQUAL_UINT8(2, result.nibbles.data[2]);
-  TEST_ASSERT_EQUAL_UINT8(3, result.nibbles.data[3]);
-  TEST_ASSERT_EQUAL_UINT8(4, result.nibbles.data[4]);
-  TEST_ASSERT_EQUAL_UINT8(5, result.nibbles.data[5]);
+  TEST_ASSERT_EQUAL_UINT8(0, nibbles_get(&result.nibbles, 0));
+  TEST_ASSERT_EQUAL_UINT8(1, nibbles_get(&result.nibbles, 1));
+  TEST_ASSERT_EQUAL_UINT8(2, nibbles_get(&result.nibbles, 2));
+  TEST_ASSERT_EQUAL_UINT8(3, nibbles_get(&result.nibbles, 3));
+  TEST_ASSERT_EQUAL_UINT8(4, nibbles_get(&result.nibbles, 4));
+  TEST_ASSERT_EQUAL_UINT8(5, nibbles_get(&result.nibbles, 5));
 }
 
 void test_hex_prefix_decode_odd_leaf(void) {
@@ -132,11 +132,11 @@ void test_hex_prefix_decode_odd_leaf(void) {
   TEST_ASSERT_TRUE(result.success);
   TEST_ASSERT_TRUE(result.is_leaf);
   TEST_ASSERT_EQUAL_size_t(5, result.nibbles.len);
-  TEST_ASSERT_EQUAL_UINT8(1, result.nibbles.data[0]);
-  TEST_ASSERT_EQUAL_UINT8(2, result.nibbles.data[1]);
-  TEST_ASSERT_EQUAL_UINT8(3, result.nibbles.data[2]);
-  TEST_ASSERT_EQUAL_UINT8(4, result.nibbles.data[3]);
-  TEST_ASSERT_EQUAL_UINT8(5, result.nibbles.data[4]);
+  TEST_ASSERT_EQUAL_UINT8(1, nibbles_get(&result.nibbles, 0));
+  TEST_ASSERT_EQUAL_UINT8(2, nibbles_get(&result.nibbles, 1));
+  TEST_ASSERT_EQUAL_UINT8(3, nibbles_get(&result.nibbles, 2));
+  TEST_ASSERT_EQUAL_UINT8(4, nibbles_get(&result.nibbles, 3));
+  TEST_ASSERT_EQUAL_UINT8(5, nibbles_get(&result.nibbles, 4));
 }
 
 void test_hex_prefix_decode_even_leaf(void) {
@@ -148,12 +148,12 @@ void test_hex_prefix_decode_even_leaf(void) {
   TEST_ASSERT_TRUE(result.success);
   TEST_ASSERT_TRUE(result.is_leaf);
   TEST_ASSERT_EQUAL_size_t(6, result.nibbles.len);
-  TEST_ASSERT_EQUAL_UINT8(0, result.nibbles.data[0]);
-  TEST_ASSERT_EQUAL_UINT8(1, result.nibbles.data[1]);
-  TEST_ASSERT_EQUAL_UINT8(2, result.nibbles.data[2]);
-  TEST_ASSERT_EQUAL_UINT8(3, result.nibbles.data[3]);
-  TEST_ASSERT_EQUAL_UINT8(4, result.nibbles.data[4]);
-  TEST_ASSERT_EQUAL_UINT8(5, result.nibbles.data[5]);
+  TEST_ASSERT_EQUAL_UINT8(0, nibbles_get(&result.nibbles, 0));
+  TEST_ASSERT_EQUAL_UINT8(1, nibbles_get(&result.nibbles, 1));
+  TEST_ASSERT_EQUAL_UINT8(2, nibbles_get(&result.nibbles, 2));
+  TEST_ASSERT_EQUAL_UINT8(3, nibbles_get(&result.nibbles, 3));
+  TEST_ASSERT_EQUAL_UINT8(4, nibbles_get(&result.nibbles, 4));
+  TEST_ASSERT_EQUAL_UINT8(5, nibbles_get(&result.nibbles, 5));
 }
 
 void test_hex_prefix_decode_empty(void) {
@@ -192,7 +192,7 @@ void test_hex_prefix_roundtrip_various(void) {
   };
 
   for (size_t i = 0; i < sizeof(test_cases) / sizeof(test_cases[0]); i++) {
-    nibbles_t original = {.data = test_cases[i].nibbles, .len = test_cases[i].len};
+    nibbles_t original = nibbles_pack(test_cases[i].nibbles, test_cases[i].len, &test_arena);
 
     // Test as extension node
     bytes_t encoded_ext = hex_prefix_encode(&original, false, &test_arena);
@@ -203,7 +203,7 @@ void test_hex_prefix_roundtrip_various(void) {
     TEST_ASSERT_FALSE(decoded_ext.is_leaf);
     TEST_ASSERT_EQUAL_size_t(original.len, decoded_ext.nibbles.len);
     for (size_t j = 0; j < original.len; j++) {
-      TEST_ASSERT_EQUAL_UINT8(original.data[j], decoded_ext.nibbles.data[j]);
+      TEST_ASSERT_EQUAL_UINT8(test_cases[i].nibbles[j], nibbles_get(&decoded_ext.nibbles, j));
     }
 
     // Test as leaf node
@@ -215,7 +215,7 @@ void test_hex_prefix_roundtrip_various(void) {
     TEST_ASSERT_TRUE(decoded_leaf.is_leaf);
     TEST_ASSERT_EQUAL_size_t(original.len, decoded_leaf.nibbles.len);
     for (size_t j = 0; j < original.len; j++) {
-      TEST_ASSERT_EQUAL_UINT8(original.data[j], decoded_leaf.nibbles.data[j]);
+      TEST_ASSERT_EQUAL_UINT8(test_cases[i].nibbles[j], nibbles_get(&decoded_leaf.nibbles, j));
     }
   }
 }
@@ -26,8 +26,8 @@ void test_nibbles_from_bytes_single(void) {
 
   TEST_ASSERT_EQUAL_size_t(2, result.len);
   TEST_ASSERT_NOT_NULL(result.data);
-  TEST_ASSERT_EQUAL_UINT8(0x0A, result.data[0]);
-  TEST_ASSERT_EQUAL_UINT8(0x0B, result.data[1]);
+  TEST_ASSERT_EQUAL_UINT8(0x0A, nibbles_get(&result, 0));
+  TEST_ASSERT_EQUAL_UINT8(0x0B, nibbles_get(&result, 1));
 }
 
 void test_nibbles_from_bytes_multiple(void) {
@@ -37,12 +37,23 @@ void test_nibbles_from_bytes_multiple(void) {
 
   TEST_ASSERT_EQUAL_size_t(6, result.len);
   TEST_ASSERT_NOT_NULL(result.data);
-  TEST_ASSERT_EQUAL_UINT8(0x01, result.data[0]);
-  TEST_ASSERT_EQUAL_UINT8(0x02, result.data[1]);
-  TEST_ASSERT_EQUAL_UINT8(0x03, result.data[2]);
-  TEST_ASSERT_EQUAL_UINT8(0x04, result.data[3]);
-  TEST_ASSERT_EQUAL_UINT8(0x05, result.data[4]);
-  TEST_ASSERT_EQUAL_UINT8(0x06, result.data[5]);
+  TEST_ASSERT_EQUAL_UINT8(0x01, nibbles_get(&result, 0));
+  TEST_ASSERT_EQUAL_UINT8(0x02, nibbles_get(&result, 1));
+  TEST_ASSERT_EQUAL_UINT8(0x03, nibbles_get(&result, 2));
+  TEST_ASSERT_EQUAL_UINT8(0x04, nibbles_get(&result, 3));
+  TEST_ASSERT_EQUAL_UINT8(0x05, nibbles_get(&result, 4));
+  TEST_ASSERT_EQUAL_UINT8(0x06, nibbles_get(&result, 5));
+}
+
+void test_nibbles_from_bytes_view(void) {
+  // Without an arena the result is a view over the input bytes
+  uint8_t input[] = {0x12, 0x34};
+  nibbles_t result = nibbles_from_bytes(input, 2, NULL);
+
+  TEST_ASSERT_EQUAL_size_t(4, result.len);
+  TEST_ASSERT_EQUAL_PTR(input, result.data);
+  TEST_ASSERT_EQUAL_UINT8(0x01, nibbles_get(&result, 0));
+  TEST_ASSERT_EQUAL_UINT8(0x04, nibbles_get(&result, 3));
 }
 
 // ===========================================================================
@@ -60,7 +71,7 @@ void test_nibbles_to_bytes_empty(void) {
 void test_nibbles_to_bytes_single(void) {
   // [0x0A, 0x0B] -> 0xAB
   uint8_t nibble_data[] = {0x0A, 0x0B};
-  nibbles_t input = {.data = nibble_data, .len = 2};
+  nibbles_t input = nibbles_pack(nibble_data, 2, &test_arena);
   uint8_t output[1] = {0};
 
   nibbles_to_bytes(&input, output);
@@ -70,7 +81,7 @@ void test_nibbles_to_bytes_single(void) {
 void test_nibbles_to_bytes_multiple(void) {
   // [0x01, 0x02, 0x03, 0x04, 0x05, 0x06] -> 0x12 0x34 0x56
   uint8_t nibble_data[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
-  nibbles_t input = {.data = nibble_data, .len = 6};
+  nibbles_t input = nibbles_pack(nibble_data, 6, &test_arena);
   uint8_t output[3] = {0};
 
   nibbles_to_bytes(&input, output);
@@ -85,7 +96,7 @@ void test_nibbles_to_bytes_multiple(void) {
 
 void test_nibbles_to_bytes_alloc_works(void) {
   uint8_t nibble_data[] = {0x0A, 0x0B, 0x0C, 0x0D};
-  nibbles_t input = {.data = nibble_data, .len = 4};
+  nibbles_t input = nibbles_pack(nibble_data, 4, &test_arena);
 
   uint8_t *output = nibbles_to_bytes_alloc(&input, &test_arena);
   TEST_ASSERT_NOT_NULL(output);
@@ -100,8 +111,8 @@ void test_nibbles_to_bytes_alloc_works(void) {
 void test_nibbles_common_prefix_none(void) {
   uint8_t data_a[] = {0x01, 0x02, 0x03};
   uint8_t data_b[] = {0x04, 0x05, 0x06};
-  nibbles_t a = {.data = data_a, .len = 3};
-  nibbles_t b = {.data = data_b, .len = 3};
+  nibbles_t a = nibbles_pack(data_a, 3, &test_arena);
+  nibbles_t b = nibbles_pack(data_b, 3, &test_arena);
 
   size_t common = nibbles_common_prefix(&a, &b);
   TEST_ASSERT_EQUAL_size_t(0, common);
@@ -110,8 +121,8 @@ void test_nibbles_common_prefix_none(void) {
 void test_nibbles_common_prefix_partial(void) {
   uint8_t data_a[] = {0x01, 0x02, 0x03, 0x04};
   uint8_t data_b[] = {0x01, 0x02, 0x05, 0x06};
-  nibbles_t a = {.data = data_a, .len = 4};
-  nibbles_t b = {.data = data_b, .len = 4};
+  nibbles_t a = nibbles_pack(data_a, 4, &test_arena);
+  nibbles_t b = nibbles_pack(data_b, 4, &test_arena);
 
   size_t common = nibbles_common_prefix(&a, &b);
   TEST_ASSERT_EQUAL_size_t(2, common);
@@ -120,8 +131,8 @@ void test_nibbles_common_prefix_partial(void) {
 void test_nibbles_common_prefix_full(void) {
   uint8_t data_a[] = {0x01, 0x02, 0x03};
   uint8_t data_b[] = {0x01, 0x02, 0x03};
-  nibbles_t a = {.data = data_a, .len = 3};
-  nibbles_t b = {.data = data_b, .len = 3};
+  nibbles_t a = nibbles_pack(data_a, 3, &test_arena);
+  nibbles_t b = nibbles_pack(data_b, 3, &test_arena);
 
   size_t common = nibbles_common_prefix(&a, &b);
   TEST_ASSERT_EQUAL_size_t(3, common);
@@ -130,53 +141,89 @@ void test_nibbles_common_prefix_full(void) {
 void test_nibbles_common_prefix_different_lengths(void) {
   uint8_t data_a[] = {0x01, 0x02, 0x03, 0x04, 0x05};
   uint8_t data_b[] = {0x01, 0x02, 0x03};
-  nibbles_t a = {.data = data_a, .len = 5};
-  nibbles_t b = {.data = data_b, .len = 3};
+  nibbles_t a = nibbles_pack(data_a, 5, &test_arena);
+  nibbles_t b = nibbles_pack(data_b, 3, &test_arena);
 
   size_t common = nibbles_common_prefix(&a, &b);
   TEST_ASSERT_EQUAL_size_t(3, common);
 }
 
+void test_nibbles_common_prefix_long(void) {
+  // 64-nibble keys differing at nibble 45 (exercises the word-wise path)
+  uint8_t key_a[32];
+  uint8_t key_b[32];
+  for (size_t i = 0; i < 32; i++) {
+    key_a[i] = (uint8_t)(i * 7);
+    key_b[i] = (uint8_t)(i * 7);
+  }
+  key_b[22] ^= 0x01; // Low nibble of byte 22 = nibble 45
+
+  nibbles_t a = nibbles_from_bytes(key_a, 32, NULL);
+  nibbles_t b = nibbles_from_bytes(key_b, 32, NULL);
+  TEST_ASSERT_EQUAL_size_t(45, nibbles_common_prefix(&a, &b));
+  TEST_ASSERT_EQUAL_size_t(64, nibbles_common_prefix(&a, &a));
+}
+
+void test_nibbles_common_prefix_unaligned(void) {
+  // Views with different nibble parity: a starts at nibble 1, b at nibble 0
+  uint8_t key[32];
+  for (size_t i = 0; i < 32; i++) {
+    key[i] = (uint8_t)((i * 13) + 5);
+  }
+  nibbles_t full = nibbles_from_bytes(key, 32, NULL);
+  nibbles_t a = nibbles_slice(&full, 1, SIZE_MAX, NULL);
+  nibbles_t b = nibbles_copy(&a, &test_arena);
+
+  TEST_ASSERT_EQUAL_size_t(0, b.offset);
+  TEST_ASSERT_EQUAL_size_t(63, nibbles_common_prefix(&a, &b));
+  TEST_ASSERT_TRUE(nibbles_equal(&a, &b));
+
+  nibbles_t c = nibbles_concat3(&NIBBLES_EMPTY, nibbles_get(&a, 0), &NIBBLES_EMPTY, &test_arena);
+  nibbles_t d = nibbles_concat(&c, &b, &test_arena);
+  TEST_ASSERT_EQUAL_size_t(1, nibbles_common_prefix(&a, &d));
+}
+
 // ===========================================================================
 // nibbles_slice tests
 // ===========================================================================
 
 void test_nibbles_slice_full(void) {
   uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-  nibbles_t src = {.data = data, .len = 4};
+  nibbles_t src = nibbles_pack(data, 4, &test_arena);
 
   nibbles_t result = nibbles_slice(&src, 0, SIZE_MAX, &test_arena);
   TEST_ASSERT_EQUAL_size_t(4, result.len);
-  TEST_ASSERT_EQUAL_UINT8(0x01, result.data[0]);
-  TEST_ASSERT_EQUAL_UINT8(0x04, result.data[3]);
+  TEST_ASSERT_EQUAL_UINT8(0x01, nibbles_get(&result, 0));
+  TEST_ASSERT_EQUAL_UINT8(0x04, nibbles_get(&result, 3));
 }
 
 void test_nibbles_slice_partial(void) {
   uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
-  nibbles_t src = {.data = data, .len = 5};
+  nibbles_t src = nibbles_pack(data, 5, &test_arena);
 
   nibbles_t result = nibbles_slice(&src, 1, 3, &test_arena);
   TEST_ASSERT_EQUAL_size_t(3, result.len);
-  TEST_ASSERT_EQUAL_UINT8(0x02, result.data[0]);
-  TEST_ASSERT_EQUAL_UINT8(0x03, result.data[1]);
-  TEST_ASSERT_EQUAL_UINT8(0x04, result.data[2]);
+  TEST_ASSERT_EQUAL_UINT8(0x02, nibbles_get(&result, 0));
+  TEST_ASSERT_EQUAL_UINT8(0x03, nibbles_get(&result, 1));
+  TEST_ASSERT_EQUAL_UINT8(0x04, nibbles_get(&result, 2));
 }
 
 void test_nibbles_slice_view(void) {
   uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-  nibbles_t src = {.data = data, .len = 4};
+  nibbles_t src = nibbles_pack(data, 4, &test_arena);
 
   // When arena is NULL, return a view
   nibbles_t result = nibbles_slice(&src, 1, 2, NULL);
   TEST_ASSERT_EQUAL_size_t(2, result.len);
-  TEST_ASSERT_EQUAL_PTR(data + 1, result.data); // Should point to original data
-  TEST_ASSERT_EQUAL_UINT8(0x02, result.data[0]);
-  TEST_ASSERT_EQUAL_UINT8(0x03, result.data[1]);
+  TEST_ASSERT_EQUAL_PTR(src.data, result.data); // Should point to original data
+  TEST_ASSERT_EQUAL_size_t(1, result.offset);
+  TEST_ASSERT_EQUAL_UINT8(0x02, nibbles_get(&result, 0));
+  TEST_ASSERT_EQUAL_UINT8(0x03, nibbles_get(&result, 1));
 }
 
 void test_nibbles_slice_empty(void) {
   uint8_t data[] = {0x01, 0x02, 0x03};
-  nibbles_t src = {.data = data, .len = 3};
+  nibbles_t src = nibbles_pack(data, 3, &test_arena);
 
   nibbles_t result = nibbles_slice(&src, 0, 0, &test_arena);
   TEST_ASSERT_EQUAL_size_t(0, result.len);
@@ -184,7 +231,7 @@ void test_nibbles_slice_empty(void) {
 
 void test_nibbles_slice_out_of_bounds(void) {
   uint8_t data[] = {0x01, 0x02, 0x03};
-  nibbles_t src = {.data = data, .len = 3};
+  nibbles_t src = nibbles_pack(data, 3, &test_arena);
 
   // Start beyond end
   nibbles_t result = nibbles_slice(&src, 10, 5, &test_arena);
@@ -197,15 +244,15 @@ void test_nibbles_slice_out_of_bounds(void) {
 
 void test_nibbles_copy_works(void) {
   uint8_t data[] = {0x01, 0x02, 0x03};
-  nibbles_t src = {.data = data, .len = 3};
+  nibbles_t src = nibbles_pack(data, 3, &test_arena);
 
   nibbles_t copy = nibbles_copy(&src, &test_arena);
   TEST_ASSERT_EQUAL_size_t(3, copy.len);
   TEST_ASSERT_NOT_NULL(copy.data);
   TEST_ASSERT_NOT_EQUAL(src.data, copy.data); // Should be different memory
-  TEST_ASSERT_EQUAL_UINT8(0x01, copy.data[0]);
-  TEST_ASSERT_EQUAL_UINT8(0x02, copy.data[1]);
-  TEST_ASSERT_EQUAL_UINT8(0x03, copy.data[2]);
+  TEST_ASSERT_EQUAL_UINT8(0x01, nibbles_get(&copy, 0));
+  TEST_ASSERT_EQUAL_UINT8(0x02, nibbles_get(&copy, 1));
+  TEST_ASSERT_EQUAL_UINT8(0x03, nibbles_get(&copy, 2));
 }
 
 void test_nibbles_copy_empty(void) {
@@ -221,8 +268,8 @@ void test_nibbles_copy_empty(void) {
 void test_nibbles_cmp_equal(void) {
   uint8_t data_a[] = {0x01, 0x02, 0x03};
   uint8_t data_b[] = {0x01, 0x02, 0x03};
-  nibbles_t a = {.data = data_a, .len = 3};
-  nibbles_t b = {.data = data_b, .len = 3};
+  nibbles_t a = nibbles_pack(data_a, 3, &test_arena);
+  nibbles_t b = nibbles_pack(data_b, 3, &test_arena);
 
   TEST_ASSERT_EQUAL_INT(0, nibbles_cmp(&a, &b));
 }
@@ -230,8 +277,8 @@ void test_nibbles_cmp_equal(void) {
 void test_nibbles_cmp_less(void) {
   uint8_t data_a[] = {0x01, 0x02, 0x03};
   uint8_t data_b[] = {0x01, 0x02, 0x04};
-  nibbles_t a = {.data = data_a, .len = 3};
-  nibbles_t b = {.data = data_b, .len = 3};
+  nibbles_t a = nibbles_pack(data_a, 3, &test_arena);
+  nibbles_t b = nibbles_pack(data_b, 3, &test_arena);
 
   TEST_ASSERT_LESS_THAN_INT(0, nibbles_cmp(&a, &b));
 }
@@ -239,8 +286,8 @@ void test_nibbles_cmp_less(void) {
 void test_nibbles_cmp_greater(void) {
   uint8_t data_a[] = {0x01, 0x02, 0x04};
   uint8_t data_b[] = {0x01, 0x02, 0x03};
-  nibbles_t a = {.data = data_a, .len = 3};
-  nibbles_t b = {.data = data_b, .len = 3};
+  nibbles_t a = nibbles_pack(data_a, 3, &test_arena);
+  nibbles_t b = nibbles_pack(data_b, 3, &test_arena);
 
   TEST_ASSERT_GREATER_THAN_INT(0, nibbles_cmp(&a, &b));
 }
@@ -248,8 +295,8 @@ void test_nibbles_cmp_greater(void) {
 void test_nibbles_cmp_prefix(void) {
   uint8_t data_a[] = {0x01, 0x02};
   uint8_t data_b[] = {0x01, 0x02, 0x03};
-  nibbles_t a = {.data = data_a, .len = 2};
-  nibbles_t b = {.data = data_b, .len = 3};
+  nibbles_t a = nibbles_pack(data_a, 2, &test_arena);
+  nibbles_t b = nibbles_pack(data_b, 3, &test_arena);
 
   // Shorter prefix comes first
   TEST_ASSERT_LESS_THAN_INT(0, nibbles_cmp(&a, &b));
@@ -264,9 +311,9 @@ void test_nibbles_equal_works(void) {
   uint8_t data_a[] = {0x01, 0x02, 0x03};
   uint8_t data_b[] = {0x01, 0x02, 0x03};
   uint8_t data_c[] = {0x01, 0x02, 0x04};
-  nibbles_t a = {.data = data_a, .len = 3};
-  nibbles_t b = {.data = data_b, .len = 3};
-  nibbles_t c = {.data = data_c, .len = 3};
+  nibbles_t a = nibbles_pack(data_a, 3, &test_arena);
+  nibbles_t b = nibbles_pack(data_b, 3, &test_arena);
+  nibbles_t c = nibbles_pack(data_c, 3, &test_arena);
 
   TEST_ASSERT_TRUE(nibbles_equal(&a, &b));
   TEST_ASSERT_FALSE(nibbles_equal(&a, &c));
@@ -279,7 +326,7 @@ void test_nibbles_equal_works(void) {
 void test_nibbles_is_empty(void) {
   nibbles_t empty = NIBBLES_EMPTY;
   uint8_t data[] = {0x01};
-  nibbles_t non_empty = {.data = data, .len = 1};
+  nibbles_t non_empty = nibbles_pack(data, 1, &test_arena);
 
   TEST_ASSERT_TRUE(nibbles_is_empty(&empty));
   TEST_ASSERT_FALSE(nibbles_is_empty(&non_empty));
@@ -287,7 +334,7 @@ void test_nibbles_is_empty(void) {
 
 void test_nibbles_get(void) {
   uint8_t data[] = {0x0A, 0x0B, 0x0C};
-  nibbles_t n = {.data = data, .len = 3};
+  nibbles_t n = nibbles_pack(data, 3, &test_arena);
 
   TEST_ASSERT_EQUAL_UINT8(0x0A, nibbles_get(&n, 0));
   TEST_ASSERT_EQUAL_UINT8(0x0B, nibbles_get(&n, 1));
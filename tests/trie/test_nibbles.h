@@ -5,6 +5,7 @@
 void test_nibbles_from_bytes_empty(void);
 void test_nibbles_from_bytes_single(void);
 void test_nibbles_from_bytes_multiple(void);
+void test_nibbles_from_bytes_view(void);
 
 // nibbles_to_bytes tests
 void test_nibbles_to_bytes_empty(void);
@@ -19,6 +20,8 @@ void test_nibbles_common_prefix_none(void);
 void test_nibbles_common_prefix_partial(void);
 void test_nibbles_common_prefix_full(void);
 void test_nibbles_common_prefix_different_lengths(void);
+void test_nibbles_common_prefix_long(void);
+void test_nibbles_common_prefix_unaligned(void);
 
 // nibbles_slice tests
 void test_nibbles_slice_full(void);
@@ -28,7 +28,7 @@ void test_mpt_node_empty(void) {
 
 void test_mpt_node_leaf(void) {
   uint8_t path_data[] = {1, 2, 3, 4};
-  nibbles_t path = {.data = path_data, .len = 4};
+  nibbles_t path = nibbles_pack(path_data, 4, &test_arena);
 
   uint8_t value_data[] = {0xDE, 0xAD, 0xBE, 0xEF};
   bytes_t value;
@@ -46,7 +46,7 @@ void test_mpt_node_leaf(void) {
 
 void test_mpt_node_extension(void) {
   uint8_t path_data[] = {0xA, 0xB, 0xC};
-  nibbles_t path = {.data = path_data, .len = 3};
+  nibbles_t path = nibbles_pack(path_data, 3, &test_arena);
   node_ref_t child = node_ref_null();
 
   mpt_node_t node = mpt_node_extension(path, child);
@@ -122,7 +122,7 @@ void test_mpt_node_encode_empty(void) {
 void test_mpt_node_encode_leaf(void) {
   // Create a simple leaf with path [1, 2] and value [0xAB]
   uint8_t path_data[] = {1, 2};
-  nibbles_t path = {.data = path_data, .len = 2};
+  nibbles_t path = nibbles_pack(path_data, 2, &test_arena);
 
   uint8_t value_data[] = {0xAB};
   bytes_t value;
@@ -145,7 +145,7 @@ void test_mpt_node_encode_leaf(void) {
 
 void test_mpt_node_encode_extension(void) {
   uint8_t path_data[] = {0xA};
-  nibbles_t path = {.data = path_data, .len = 1};
+  nibbles_t path = nibbles_pack(path_data, 1, &test_arena);
   node_ref_t child = node_ref_null();
 
   mpt_node_t node = mpt_node_extension(path, child);
@@ -180,7 +180,7 @@ void test_mpt_node_hash_empty(void) {
 
 void test_mpt_node_hash_leaf(void) {
   uint8_t path_data[] = {1, 2, 3};
-  nibbles_t path = {.data = path_data, .len = 3};
+  nibbles_t path = nibbles_pack(path_data, 3, &test_arena);
 
   uint8_t value_data[] = {0xFF};
   bytes_t value;
@@ -199,7 +199,7 @@ void test_mpt_node_hash_leaf(void) {
 
 void test_mpt_node_hash_caching(void) {
   uint8_t path_data[] = {5, 6};
-  nibbles_t path = {.data = path_data, .len = 2};
+  nibbles_t path = nibbles_pack(path_data, 2, &test_arena);
 
   uint8_t value_data[] = {0x12, 0x34};
   bytes_t value;
@@ -231,7 +231,7 @@ void test_mpt_node_hash_caching(void) {
 void test_mpt_node_ref_small_embeds(void) {
   // Small leaf should be embedded
   uint8_t path_data[] = {1};
-  nibbles_t path = {.data = path_data, .len = 1};
+  nibbles_t path = nibbles_pack(path_data, 1, &test_arena);
 
   uint8_t value_data[] = {0x01};
   bytes_t value;
@@ -253,7 +253,7 @@ void test_mpt_node_ref_large_hashes(void) {
   for (int i = 0; i < 16; i++) {
     path_data[i] = (uint8_t)i;
   }
-  nibbles_t path = {.data = path_data, .len = 16};
+  nibbles_t path = nibbles_pack(path_data, 16, &test_arena);
 
   uint8_t value_data[32];
   memset(value_data, 0xFF, 32);
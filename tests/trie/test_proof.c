@@ -0,0 +1,443 @@
+#include "test_proof.h"
+
+#include "div0/crypto/keccak256.h"
+#include "div0/trie/mpt.h"
+#include "div0/trie/proof.h"
+
+#include "unity.h"
+
+#include <string.h>
+
+// External arena from main test file
+extern div0_arena_t test_arena;
+
+/// Number of keys in the populated test trie.
+static constexpr size_t PROOF_KEY_COUNT = 64;
+
+// Helper to create a fresh MPT for each test
+static mpt_t create_test_mpt(void) {
+  mpt_backend_t *backend = mpt_memory_backend_create(&test_arena);
+  mpt_t mpt;
+  mpt_init(&mpt, backend, &test_arena);
+  return mpt;
+}
+
+// Helper: 32-byte key derived from an index (spreads keys across branches)
+static void make_key(const size_t i, uint8_t key[32]) {
+  memset(key, 0, 32);
+  key[0] = (uint8_t)(i * 37);
+  key[1] = (uint8_t)(i * 11);
+  key[31] = (uint8_t)i;
+}
+
+// Helper: insert PROOF_KEY_COUNT keys with values long enough to force hashed nodes
+static void populate(mpt_t *mpt) {
+  for (size_t i = 0; i < PROOF_KEY_COUNT; i++) {
+    uint8_t key[32];
+    uint8_t value[40];
+    make_key(i, key);
+    memset(value, (int)(i + 1), sizeof(value));
+    TEST_ASSERT_TRUE(mpt_insert(mpt, key, sizeof(key), value, sizeof(value)));
+  }
+}
+
+// ===========================================================================
+// Proof generation and verification tests
+// ===========================================================================
+
+void test_proof_inclusion(void) {
+  mpt_t mpt = create_test_mpt();
+  populate(&mpt);
+  const hash_t root = mpt_root_hash(&mpt);
+
+  uint8_t key[32];
+  make_key(5, key);
+  mpt_proof_t proof;
+  TEST_ASSERT_TRUE(mpt_prove(&mpt, key, sizeof(key), &proof));
+  TEST_ASSERT_TRUE(proof.count > 1);
+
+  // First node is the root
+  const hash_t first = keccak256(proof.nodes[0].data, proof.nodes[0].size);
+  TEST_ASSERT_TRUE(hash_equal(&first, &root));
+
+  bytes_t value;
+  TEST_ASSERT_EQUAL(MPT_PROOF_FOUND,
+                    mpt_verify_proof(&root, key, sizeof(key), &proof, &test_arena, &value));
+  TEST_ASSERT_EQUAL(40, value.size);
+  TEST_ASSERT_EQUAL_HEX8(6, value.data[0]);
+  TEST_ASSERT_EQUAL_HEX8(6, value.data[39]);
+
+  mpt_destroy(&mpt);
+}
+
+void test_proof_exclusion(void) {
+  mpt_t mpt = create_test_mpt();
+  populate(&mpt);
+  const hash_t root = mpt_root_hash(&mpt);
+
+  uint8_t key[32];
+  make_key(5, key);
+  key[31] = 0xFF; // Shares a long prefix with an existing key
+  mpt_proof_t proof;
+  TEST_ASSERT_TRUE(mpt_prove(&mpt, key, sizeof(key), &proof));
+  TEST_ASSERT_TRUE(proof.count > 0);
+
+  TEST_ASSERT_EQUAL(MPT_PROOF_ABSENT,
+                    mpt_verify_proof(&root, key, sizeof(key), &proof, &test_arena, nullptr));
+
+  mpt_destroy(&mpt);
+}
+
+void test_proof_empty_trie(void) {
+  mpt_t mpt = create_test_mpt();
+  const hash_t root = mpt_root_hash(&mpt);
+
+  const uint8_t key[] = {0x01, 0x02};
+  mpt_proof_t proof;
+  TEST_ASSERT_TRUE(mpt_prove(&mpt, key, sizeof(key), &proof));
+  TEST_ASSERT_EQUAL(0, proof.count);
+
+  TEST_ASSERT_EQUAL(MPT_PROOF_ABSENT,
+                    mpt_verify_proof(&root, key, sizeof(key), &proof, &test_arena, nullptr));
+
+  mpt_destroy(&mpt);
+}
+
+void test_proof_wrong_root(void) {
+  mpt_t mpt = create_test_mpt();
+  populate(&mpt);
+
+  uint8_t key[32];
+  make_key(7, key);
+  mpt_proof_t proof;
+  TEST_ASSERT_TRUE(mpt_prove(&mpt, key, sizeof(key), &proof));
+
+  hash_t wrong = mpt_root_hash(&mpt);
+  wrong.bytes[0] ^= 0x01;
+  TEST_ASSERT_EQUAL(MPT_PROOF_INVALID,
+                    mpt_verify_proof(&wrong, key, sizeof(key), &proof, &test_arena, nullptr));
+
+  mpt_destroy(&mpt);
+}
+
+void test_proof_tampered_node(void) {
+  mpt_t mpt = create_test_mpt();
+  populate(&mpt);
+  const hash_t root = mpt_root_hash(&mpt);
+
+  uint8_t key[32];
+  make_key(9, key);
+  mpt_proof_t proof;
+  TEST_ASSERT_TRUE(mpt_prove(&mpt, key, sizeof(key), &proof));
+
+  // Flip a byte in the last (deepest) node: its hash no longer matches the parent
+  bytes_t *last = &proof.nodes[proof.count - 1];
+  last->data[last->size - 1] ^= 0x01;
+  TEST_ASSERT_EQUAL(MPT_PROOF_INVALID,
+                    mpt_verify_proof(&root, key, sizeof(key), &proof, &test_arena, nullptr));
+
+  mpt_destroy(&mpt);
+}
+
+void test_proof_missing_node(void) {
+  mpt_t mpt = create_test_mpt();
+  populate(&mpt);
+  const hash_t root = mpt_root_hash(&mpt);
+
+  uint8_t key[32];
+  make_key(3, key);
+  mpt_proof_t proof;
+  TEST_ASSERT_TRUE(mpt_prove(&mpt, key, sizeof(key), &proof));
+
+  proof.count--;
+  TEST_ASSERT_EQUAL(MPT_PROOF_INVALID,
+                    mpt_verify_proof(&root, key, sizeof(key), &proof, &test_arena, nullptr));
+
+  mpt_destroy(&mpt);
+}
+
+void test_proof_all_keys(void) {
+  mpt_t mpt = create_test_mpt();
+  populate(&mpt);
+  const hash_t root = mpt_root_hash(&mpt);
+
+  for (size_t i = 0; i < PROOF_KEY_COUNT; i++) {
+    uint8_t key[32];
+    make_key(i, key);
+    mpt_proof_t proof;
+    TEST_ASSERT_TRUE(mpt_prove(&mpt, key, sizeof(key), &proof));
+
+    bytes_t value;
+    TEST_ASSERT_EQUAL(MPT_PROOF_FOUND,
+                      mpt_verify_proof(&root, key, sizeof(key), &proof, &test_arena, &value));
+    TEST_ASSERT_EQUAL(40, value.size);
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)(i + 1), value.data[0]);
+  }
+
+  mpt_destroy(&mpt);
+}
+
+// ===========================================================================
+// Multiproof tests
+// ===========================================================================
+
+void test_multiproof_dedup(void) {
+  mpt_t mpt = create_test_mpt();
+  populate(&mpt);
+  const hash_t root = mpt_root_hash(&mpt);
+
+  uint8_t key_bytes[8][32];
+  mpt_proof_key_t keys[8];
+  size_t single_total = 0;
+  for (size_t i = 0; i < 8; i++) {
+    make_key(i * 3, key_bytes[i]);
+    keys[i] = (mpt_proof_key_t){.data = key_bytes[i], .len = 32};
+
+    mpt_proof_t single;
+    TEST_ASSERT_TRUE(mpt_prove(&mpt, key_bytes[i], 32, &single));
+    single_total += single.count;
+  }
+
+  mpt_proof_t proof;
+  TEST_ASSERT_TRUE(mpt_prove_multi(&mpt, keys, 8, &proof));
+  // The root (at least) is shared by every key
+  TEST_ASSERT_TRUE(proof.count <= single_total - 7);
+
+  mpt_proof_status_t statuses[8];
+  bytes_t values[8];
+  TEST_ASSERT_TRUE(
+      mpt_verify_multiproof(&root, keys, 8, &proof, &test_arena, statuses, values));
+  for (size_t i = 0; i < 8; i++) {
+    TEST_ASSERT_EQUAL(MPT_PROOF_FOUND, statuses[i]);
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)((i * 3) + 1), values[i].data[0]);
+  }
+
+  mpt_destroy(&mpt);
+}
+
+void test_multiproof_mixed(void) {
+  mpt_t mpt = create_test_mpt();
+  populate(&mpt);
+  const hash_t root = mpt_root_hash(&mpt);
+
+  uint8_t present[32];
+  uint8_t absent[32];
+  make_key(10, present);
+  make_key(10, absent);
+  absent[20] = 0xAA;
+  const mpt_proof_key_t keys[2] = {{.data = present, .len = 32}, {.data = absent, .len = 32}};
+
+  mpt_proof_t proof;
+  TEST_ASSERT_TRUE(mpt_prove_multi(&mpt, keys, 2, &proof));
+
+  mpt_proof_status_t statuses[2];
+  TEST_ASSERT_TRUE(mpt_verify_multiproof(&root, keys, 2, &proof, &test_arena, statuses, nullptr));
+  TEST_ASSERT_EQUAL(MPT_PROOF_FOUND, statuses[0]);
+  TEST_ASSERT_EQUAL(MPT_PROOF_ABSENT, statuses[1]);
+
+  mpt_destroy(&mpt);
+}
+
+// ===========================================================================
+// Witness tests
+// ===========================================================================
+
+// Helper: apply the same reads and writes to a trie
+static void apply_witness_ops(mpt_t *mpt, const uint8_t keys[4][32]) {
+  const uint8_t updated[40] = {0xEE};
+  const bytes_t read = mpt_get(mpt, keys[0], 32);
+  TEST_ASSERT_EQUAL(40, read.size);
+  TEST_ASSERT_TRUE(mpt_insert(mpt, keys[1], 32, updated, sizeof(updated)));
+  TEST_ASSERT_TRUE(mpt_delete(mpt, keys[2], 32));
+  TEST_ASSERT_TRUE(mpt_insert(mpt, keys[3], 32, updated, sizeof(updated)));
+}
+
+void test_witness_replay(void) {
+  mpt_t full = create_test_mpt();
+  populate(&full);
+
+  // Two keys differing only in the last nibble share a deep two-child branch;
+  // deleting one collapses the branch into the untouched other
+  uint8_t pair_a[32];
+  uint8_t pair_b[32];
+  make_key(200, pair_a);
+  make_key(200, pair_b);
+  pair_b[31] ^= 0x01;
+  const uint8_t value_a[40] = {0x55};
+  const uint8_t value_b[40] = {0x66};
+  TEST_ASSERT_TRUE(mpt_insert(&full, pair_a, 32, value_a, sizeof(value_a)));
+  TEST_ASSERT_TRUE(mpt_insert(&full, pair_b, 32, value_b, sizeof(value_b)));
+  const hash_t pre_root = mpt_root_hash(&full);
+
+  uint8_t keys[4][32];
+  make_key(1, keys[0]);
+  make_key(2, keys[1]);
+  memcpy(keys[2], pair_a, 32);
+  make_key(300, keys[3]); // New key
+  mpt_proof_key_t proof_keys[4];
+  for (size_t i = 0; i < 4; i++) {
+    proof_keys[i] = (mpt_proof_key_t){.data = keys[i], .len = 32};
+  }
+
+  const mpt_witness_query_t query = {.mpt = &full, .keys = proof_keys, .key_count = 4};
+  mpt_proof_t witness;
+  TEST_ASSERT_TRUE(mpt_collect_witness(&query, 1, &test_arena, &witness));
+
+  mpt_proof_t plain;
+  TEST_ASSERT_TRUE(mpt_prove_multi(&full, proof_keys, 4, &plain));
+  TEST_ASSERT_TRUE(witness.count > plain.count); // Collapse sibling added
+
+  mpt_t partial;
+  mpt_init(&partial, mpt_memory_backend_create(&test_arena), &test_arena);
+  TEST_ASSERT_TRUE(mpt_load_proof(&partial, &pre_root, &witness));
+  hash_t root = mpt_root_hash(&partial);
+  TEST_ASSERT_TRUE(hash_equal(&pre_root, &root));
+
+  apply_witness_ops(&full, (const uint8_t(*)[32])keys);
+  apply_witness_ops(&partial, (const uint8_t(*)[32])keys);
+
+  const hash_t full_root = mpt_root_hash(&full);
+  root = mpt_root_hash(&partial);
+  TEST_ASSERT_TRUE(hash_equal(&full_root, &root));
+
+  mpt_destroy(&full);
+}
+
+void test_witness_load_missing_root(void) {
+  mpt_t mpt = create_test_mpt();
+  populate(&mpt);
+
+  uint8_t key[32];
+  make_key(4, key);
+  mpt_proof_t proof;
+  TEST_ASSERT_TRUE(mpt_prove(&mpt, key, sizeof(key), &proof));
+
+  mpt_t partial;
+  mpt_init(&partial, mpt_memory_backend_create(&test_arena), &test_arena);
+  hash_t wrong = mpt_root_hash(&mpt);
+  wrong.bytes[31] ^= 0xFF;
+  TEST_ASSERT_FALSE(mpt_load_proof(&partial, &wrong, &proof));
+  TEST_ASSERT_TRUE(mpt_load_proof(&partial, &MPT_EMPTY_ROOT, &proof));
+  TEST_ASSERT_TRUE(mpt_is_empty(&partial));
+
+  mpt_destroy(&mpt);
+}
+
+void test_witness_lookup_unresolved(void) {
+  mpt_t mpt = create_test_mpt();
+  populate(&mpt);
+  const hash_t root = mpt_root_hash(&mpt);
+
+  uint8_t key[32];
+  make_key(4, key);
+  mpt_proof_t proof;
+  TEST_ASSERT_TRUE(mpt_prove(&mpt, key, sizeof(key), &proof));
+
+  mpt_t partial;
+  mpt_init(&partial, mpt_memory_backend_create(&test_arena), &test_arena);
+  TEST_ASSERT_TRUE(mpt_load_proof(&partial, &root, &proof));
+
+  bytes_t value;
+  TEST_ASSERT_EQUAL(MPT_LOOKUP_FOUND, mpt_lookup(&partial, key, sizeof(key), &value));
+  TEST_ASSERT_EQUAL(40, value.size);
+
+  // Key 5 sits under another root child, which the proof does not cover
+  make_key(5, key);
+  TEST_ASSERT_EQUAL(MPT_LOOKUP_UNRESOLVED, mpt_lookup(&partial, key, sizeof(key), &value));
+  TEST_ASSERT_NULL(value.data);
+  TEST_ASSERT_EQUAL(MPT_LOOKUP_FOUND, mpt_lookup(&mpt, key, sizeof(key), &value));
+
+  mpt_destroy(&mpt);
+}
+
+// Helper: key whose first nibble is prefix and whose remaining nibbles depend only on i
+static void make_twin_key(const uint8_t prefix, const size_t i, uint8_t key[32]) {
+  memset(key, 0, 32);
+  key[0] = (uint8_t)((prefix << 4) | 0x01);
+  key[1] = (uint8_t)(i << 6);
+  key[31] = (uint8_t)i;
+}
+
+void test_witness_shared_subtree(void) {
+  // Keys under root children 0 and 1 with equal suffixes and values: both
+  // children hash to the same node, so the witness is a DAG
+  mpt_t full = create_test_mpt();
+  mpt_proof_key_t proof_keys[8];
+  uint8_t keys[8][32];
+  for (size_t i = 0; i < 4; i++) {
+    uint8_t value[40];
+    memset(value, (int)(i + 1), sizeof(value));
+    for (uint8_t prefix = 0; prefix < 2; prefix++) {
+      uint8_t *const key = keys[(prefix * 4) + i];
+      make_twin_key(prefix, i, key);
+      TEST_ASSERT_TRUE(mpt_insert(&full, key, 32, value, sizeof(value)));
+      proof_keys[(prefix * 4) + i] = (mpt_proof_key_t){.data = key, .len = 32};
+    }
+  }
+  const hash_t pre_root = mpt_root_hash(&full);
+
+  mpt_proof_t witness;
+  TEST_ASSERT_TRUE(mpt_prove_multi(&full, proof_keys, 8, &witness));
+
+  mpt_t partial;
+  mpt_init(&partial, mpt_memory_backend_create(&test_arena), &test_arena);
+  TEST_ASSERT_TRUE(mpt_load_proof(&partial, &pre_root, &witness));
+  hash_t root = mpt_root_hash(&partial);
+  TEST_ASSERT_TRUE(hash_equal(&pre_root, &root));
+
+  // Writes under one parent must not show through the other
+  const uint8_t updated[40] = {0xEE};
+  TEST_ASSERT_TRUE(mpt_insert(&full, keys[0], 32, updated, sizeof(updated)));
+  TEST_ASSERT_TRUE(mpt_insert(&partial, keys[0], 32, updated, sizeof(updated)));
+  TEST_ASSERT_TRUE(mpt_delete(&full, keys[5], 32));
+  TEST_ASSERT_TRUE(mpt_delete(&partial, keys[5], 32));
+
+  const bytes_t twin = mpt_get(&partial, keys[4], 32);
+  TEST_ASSERT_EQUAL(40, twin.size);
+  TEST_ASSERT_EQUAL_UINT8(0x01, twin.data[0]);
+  TEST_ASSERT_TRUE(mpt_contains(&partial, keys[1], 32));
+
+  const hash_t full_root = mpt_root_hash(&full);
+  root = mpt_root_hash(&partial);
+  TEST_ASSERT_TRUE(hash_equal(&full_root, &root));
+
+  mpt_destroy(&full);
+}
+
+void test_witness_delete_missing_copies_nothing(void) {
+  mpt_t full = create_test_mpt();
+  mpt_proof_key_t proof_keys[8];
+  uint8_t keys[8][32];
+  for (size_t i = 0; i < 4; i++) {
+    const uint8_t value[40] = {(uint8_t)(i + 1)};
+    for (uint8_t prefix = 0; prefix < 2; prefix++) {
+      uint8_t *const key = keys[(prefix * 4) + i];
+      make_twin_key(prefix, i, key);
+      TEST_ASSERT_TRUE(mpt_insert(&full, key, 32, value, sizeof(value)));
+      proof_keys[(prefix * 4) + i] = (mpt_proof_key_t){.data = key, .len = 32};
+    }
+  }
+  const hash_t pre_root = mpt_root_hash(&full);
+  mpt_proof_t witness;
+  TEST_ASSERT_TRUE(mpt_prove_multi(&full, proof_keys, 8, &witness));
+
+  mpt_t partial;
+  mpt_init(&partial, mpt_memory_backend_create(&test_arena), &test_arena);
+  TEST_ASSERT_TRUE(mpt_load_proof(&partial, &pre_root, &witness));
+
+  // Same path as a present key down to its leaf, different tail
+  uint8_t missing[32];
+  make_twin_key(0, 3, missing);
+  missing[31] = 0x77;
+
+  // A miss walks through the shared subtree but copies none of it
+  const div0_arena_mark_t before = div0_arena_mark(&test_arena);
+  TEST_ASSERT_FALSE(mpt_delete(&partial, missing, 32));
+  const div0_arena_mark_t after = div0_arena_mark(&test_arena);
+  TEST_ASSERT_TRUE(before.block == after.block && before.offset == after.offset);
+
+  const hash_t root = mpt_root_hash(&partial);
+  TEST_ASSERT_TRUE(hash_equal(&pre_root, &root));
+
+  mpt_destroy(&full);
+}
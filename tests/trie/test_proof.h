@@ -0,0 +1,24 @@
+#ifndef TEST_PROOF_H
+#define TEST_PROOF_H
+
+// Proof generation and verification tests
+void test_proof_inclusion(void);
+void test_proof_exclusion(void);
+void test_proof_empty_trie(void);
+void test_proof_wrong_root(void);
+void test_proof_tampered_node(void);
+void test_proof_missing_node(void);
+void test_proof_all_keys(void);
+
+// Multiproof tests
+void test_multiproof_dedup(void);
+void test_multiproof_mixed(void);
+
+// Witness tests
+void test_witness_replay(void);
+void test_witness_load_missing_root(void);
+void test_witness_lookup_unresolved(void);
+void test_witness_shared_subtree(void);
+void test_witness_delete_missing_copies_nothing(void);
+
+#endif // TEST_PROOF_H
@@ -143,4 +143,76 @@ void test_hex_decode_invalid_char(void) {
 
   // Space in string
   TEST_ASSERT_FALSE(hex_decode("dead beef", out, 4));
-}
\ No newline at end of file
+}
+
+// =============================================================================
+// Vector Kernel Tests
+// =============================================================================
+
+// Lengths around the 8/16/32-byte vector block sizes, so every kernel and the
+// scalar tail are exercised on every build target.
+static constexpr size_t KERNEL_MAX_BYTES = 70;
+
+void test_hex_roundtrip_block_lengths(void) {
+  uint8_t data[KERNEL_MAX_BYTES];
+  uint8_t decoded[KERNEL_MAX_BYTES];
+  char hex[2 + (KERNEL_MAX_BYTES * 2) + 1];
+
+  for (size_t i = 0; i < KERNEL_MAX_BYTES; i++) {
+    data[i] = (uint8_t)((i * 37) + 11);
+  }
+
+  for (size_t len = 0; len <= KERNEL_MAX_BYTES; len++) {
+    hex_encode(data, len, hex);
+    TEST_ASSERT_EQUAL_size_t(2 + (len * 2), strlen(hex));
+    if (len > 0) {
+      // 11 = 0x0b: lowercase digits, most significant nibble first
+      TEST_ASSERT_EQUAL_CHAR('0', hex[2]);
+      TEST_ASSERT_EQUAL_CHAR('b', hex[3]);
+    }
+    // Uppercase every other letter; decoding is case-insensitive
+    for (size_t i = 2; i < 2 + (len * 2); i += 2) {
+      if (hex[i] >= 'a') {
+        hex[i] = (char)(hex[i] - 'a' + 'A');
+      }
+    }
+    TEST_ASSERT_TRUE(hex_decode(hex, decoded, len));
+    if (len > 0) {
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(data, decoded, len);
+    }
+  }
+}
+
+void test_hex_decode_invalid_char_any_position(void) {
+  // Characters adjacent to the valid ranges, plus non-ASCII
+  static const char bad[] = {'/', ':', '@', 'G', '`', 'g', ' ', '\x10', '\x80', '\xff'};
+  char hex[(KERNEL_MAX_BYTES * 2) + 1];
+  uint8_t out[KERNEL_MAX_BYTES];
+  memset(hex, 'a', KERNEL_MAX_BYTES * 2);
+  hex[KERNEL_MAX_BYTES * 2] = '\0';
+  TEST_ASSERT_TRUE(hex_decode(hex, out, KERNEL_MAX_BYTES));
+
+  for (size_t pos = 0; pos < KERNEL_MAX_BYTES * 2; pos++) {
+    hex[pos] = bad[pos % sizeof(bad)];
+    TEST_ASSERT_FALSE(hex_decode(hex, out, KERNEL_MAX_BYTES));
+    hex[pos] = 'a';
+  }
+}
+
+void test_hex_decode_uint256_limbs(void) {
+  uint256_t value;
+
+  // Digit groups straddling limb boundaries
+  TEST_ASSERT_TRUE(hex_decode_uint256("0x123456789abcdef0123", &value));
+  TEST_ASSERT_EQUAL_HEX64(0x456789abcdef0123ULL, value.limbs[0]);
+  TEST_ASSERT_EQUAL_HEX64(0x123ULL, value.limbs[1]);
+  TEST_ASSERT_EQUAL_HEX64(0, value.limbs[2]);
+
+  TEST_ASSERT_TRUE(hex_decode_uint256(
+      "0x0102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f20", &value));
+  TEST_ASSERT_EQUAL_HEX64(0x191a1b1c1d1e1f20ULL, value.limbs[0]);
+  TEST_ASSERT_EQUAL_HEX64(0x0102030405060708ULL, value.limbs[3]);
+
+  // Invalid digit inside a full 16-digit group
+  TEST_ASSERT_FALSE(hex_decode_uint256("0x1000000000000000z000000000000000", &value));
+}
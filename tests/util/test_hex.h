@@ -14,5 +14,8 @@ void test_hex_decode_null_input(void);
 void test_hex_decode_null_output(void);
 void test_hex_decode_wrong_length(void);
 void test_hex_decode_invalid_char(void);
+void test_hex_roundtrip_block_lengths(void);
+void test_hex_decode_invalid_char_any_position(void);
+void test_hex_decode_uint256_limbs(void);
 
 #endif // TEST_HEX_H
\ No newline at end of file